@@ -0,0 +1,221 @@
+/**
+ * @file BenchHarness.cpp
+ * @brief 최소 벤치마크 하니스 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "BenchHarness.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace cpyhwpx {
+namespace bench {
+
+const void* volatile g_benchSink = nullptr;
+
+namespace {
+
+struct Registration {
+    const char* name;
+    BenchFunction fn;
+};
+
+std::vector<Registration>& GetRegistry()
+{
+    static std::vector<Registration> s_registry;
+    return s_registry;
+}
+
+struct Options {
+    std::string filter;
+    double min_time = 0.5;
+    uint32_t latency_ns = 0;
+    bool json = false;
+    bool list = false;
+};
+
+struct Result {
+    const char* name;
+    int64_t iterations;
+    double ns_per_iter;
+    double invoke_per_iter;
+    double get_ids_per_iter;
+    double items_per_sec;
+};
+
+constexpr int64_t kMaxIterations = 1000000000;
+
+bool ParseOptions(int argc, char** argv, Options& opts)
+{
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (strncmp(arg, "--filter=", 9) == 0) {
+            opts.filter = arg + 9;
+        } else if (strncmp(arg, "--min_time=", 11) == 0) {
+            opts.min_time = atof(arg + 11);
+        } else if (strncmp(arg, "--latency_ns=", 13) == 0) {
+            opts.latency_ns = static_cast<uint32_t>(strtoul(arg + 13, nullptr, 10));
+        } else if (strcmp(arg, "--format=json") == 0) {
+            opts.json = true;
+        } else if (strcmp(arg, "--format=console") == 0) {
+            opts.json = false;
+        } else if (strcmp(arg, "--list") == 0) {
+            opts.list = true;
+        } else {
+            fprintf(stderr, "unknown option: %s\n", arg);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 측정 시간이 min_time을 넘을 때까지 반복 횟수를 늘려 실행
+ */
+Result RunOne(const Registration& reg, double min_time)
+{
+    const double min_ns = min_time * 1e9;
+    int64_t iterations = 1;
+
+    for (;;) {
+        State state(iterations);
+        reg.fn(state);
+
+        double elapsed = state.elapsed_ns();
+        if (elapsed >= min_ns || iterations >= kMaxIterations) {
+            Result r;
+            r.name = reg.name;
+            r.iterations = iterations;
+            r.ns_per_iter = elapsed / static_cast<double>(iterations);
+            r.invoke_per_iter = static_cast<double>(state.invoke_calls()) / iterations;
+            r.get_ids_per_iter = static_cast<double>(state.get_ids_calls()) / iterations;
+            r.items_per_sec = (state.items_processed() > 0 && elapsed > 0)
+                ? static_cast<double>(state.items_processed()) * iterations * 1e9 / elapsed
+                : 0.0;
+            return r;
+        }
+
+        // 남은 시간을 채우도록 추정하되 한 번에 10배 이상 늘리지 않음
+        double multiplier = elapsed > 0 ? (min_ns * 1.4) / elapsed : 10.0;
+        multiplier = (std::min)((std::max)(multiplier, 2.0), 10.0);
+        iterations = (std::min)(static_cast<int64_t>(iterations * multiplier), kMaxIterations);
+    }
+}
+
+void PrintConsoleHeader(const Options& opts)
+{
+    printf("latency_ns=%u min_time=%.2fs\n", opts.latency_ns, opts.min_time);
+    printf("%-36s %14s %10s %10s %12s\n",
+           "Benchmark", "Time/op", "Invoke/op", "GetIDs/op", "Iterations");
+    printf("%s\n", std::string(86, '-').c_str());
+}
+
+void PrintConsoleRow(const Result& r)
+{
+    printf("%-36s %11.0f ns %10.2f %10.2f %12lld",
+           r.name, r.ns_per_iter, r.invoke_per_iter, r.get_ids_per_iter,
+           static_cast<long long>(r.iterations));
+    if (r.items_per_sec > 0) {
+        printf("  %.3g items/s", r.items_per_sec);
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+void PrintJson(const Options& opts, const std::vector<Result>& results)
+{
+    printf("{\n  \"context\": {\"latency_ns\": %u, \"min_time\": %.3f},\n",
+           opts.latency_ns, opts.min_time);
+    printf("  \"benchmarks\": [");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        printf("%s\n    {\"name\": \"%s\", \"iterations\": %lld, \"real_time_ns\": %.1f, "
+               "\"invoke_per_iter\": %.3f, \"get_ids_per_iter\": %.3f, \"items_per_second\": %.1f}",
+               i ? "," : "", r.name, static_cast<long long>(r.iterations), r.ns_per_iter,
+               r.invoke_per_iter, r.get_ids_per_iter, r.items_per_sec);
+    }
+    printf("\n  ]\n}\n");
+}
+
+} // namespace
+
+//=============================================================================
+// State
+//=============================================================================
+
+State::State(int64_t iterations)
+    : m_iterations(iterations)
+{
+}
+
+void State::StartTiming()
+{
+    if (m_running) return;
+    m_running = true;
+    m_startCounts = FakeDispatch::Counts();
+    m_start = std::chrono::steady_clock::now();
+}
+
+void State::StopTiming()
+{
+    if (!m_running) return;
+    auto now = std::chrono::steady_clock::now();
+    FakeCallCounts counts = FakeDispatch::Counts();
+    m_running = false;
+
+    m_elapsedNs += static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_start).count());
+    m_invoke += counts.invoke - m_startCounts.invoke;
+    m_getIds += counts.get_ids - m_startCounts.get_ids;
+}
+
+//=============================================================================
+// 등록/실행
+//=============================================================================
+
+Registrar::Registrar(const char* name, BenchFunction fn)
+{
+    GetRegistry().push_back(Registration{ name, fn });
+}
+
+int RunBenchmarks(int argc, char** argv)
+{
+    Options opts;
+    if (!ParseOptions(argc, argv, opts)) {
+        return 2;
+    }
+
+    std::vector<Registration> selected;
+    for (const Registration& reg : GetRegistry()) {
+        if (opts.filter.empty() || strstr(reg.name, opts.filter.c_str())) {
+            selected.push_back(reg);
+        }
+    }
+
+    if (opts.list) {
+        for (const Registration& reg : selected) {
+            printf("%s\n", reg.name);
+        }
+        return 0;
+    }
+
+    FakeDispatch::SetLatency(opts.latency_ns);
+
+    std::vector<Result> results;
+    if (!opts.json) PrintConsoleHeader(opts);
+    for (const Registration& reg : selected) {
+        Result r = RunOne(reg, opts.min_time);
+        if (!opts.json) PrintConsoleRow(r);
+        results.push_back(r);
+    }
+    if (opts.json) PrintJson(opts, results);
+
+    return selected.empty() ? 1 : 0;
+}
+
+} // namespace bench
+} // namespace cpyhwpx
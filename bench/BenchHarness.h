@@ -0,0 +1,138 @@
+/**
+ * @file BenchHarness.h
+ * @brief 최소 벤치마크 하니스 (google-benchmark 형태)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 반복 횟수를 최소 측정 시간까지 늘려 가며 실행하고,
+ * 반복당 시간과 가짜 HwpObject가 센 COM 왕복 횟수를 함께 보고한다.
+ *
+ * @example
+ *   static void BM_InsertText(State& state) {
+ *       HwpFixture fx;
+ *       for (auto _ : state) fx.hwp().InsertText(L"abc");
+ *   }
+ *   CPYHWPX_BENCHMARK(BM_InsertText);
+ */
+
+#pragma once
+
+#include "FakeHwpObject.h"
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace cpyhwpx {
+namespace bench {
+
+/**
+ * @class State
+ * @brief 벤치마크 함수 하나의 실행 상태
+ *
+ * `for (auto _ : state)` 루프 구간만 시간과 COM 호출 수를 잰다.
+ * 루프 앞뒤의 준비/정리 코드는 측정에 포함되지 않는다.
+ */
+class State {
+public:
+    explicit State(int64_t iterations);
+
+    State(const State&) = delete;
+    State& operator=(const State&) = delete;
+
+    /**
+     * @brief 루프 변수 타입 (사용자 정의 소멸자로 미사용 변수 경고 방지)
+     */
+    struct Value {
+        ~Value() {}
+    };
+
+    struct Iterator {
+        State* state;
+        int64_t remaining;
+
+        bool operator!=(const Iterator&) const
+        {
+            if (remaining > 0) return true;
+            state->StopTiming();
+            return false;
+        }
+        void operator++() { --remaining; }
+        Value operator*() const { return Value(); }
+    };
+
+    Iterator begin()
+    {
+        StartTiming();
+        return Iterator{ this, m_iterations };
+    }
+    Iterator end() { return Iterator{ this, 0 }; }
+
+    int64_t iterations() const { return m_iterations; }
+
+    /**
+     * @brief 루프 안에서 측정 일시 중지/재개 (반복마다 다시 준비할 때)
+     */
+    void PauseTiming() { StopTiming(); }
+    void ResumeTiming() { StartTiming(); }
+
+    /**
+     * @brief 반복당 처리 항목 수 (보고서의 items/s 계산용)
+     */
+    void SetItemsProcessed(int64_t items) { m_items = items; }
+
+    double elapsed_ns() const { return m_elapsedNs; }
+    uint64_t invoke_calls() const { return m_invoke; }
+    uint64_t get_ids_calls() const { return m_getIds; }
+    int64_t items_processed() const { return m_items; }
+
+private:
+    void StartTiming();
+    void StopTiming();
+
+    int64_t m_iterations;
+    int64_t m_items = 0;
+    bool m_running = false;
+    double m_elapsedNs = 0.0;
+    uint64_t m_invoke = 0;
+    uint64_t m_getIds = 0;
+    std::chrono::steady_clock::time_point m_start;
+    FakeCallCounts m_startCounts;
+};
+
+extern const void* volatile g_benchSink;
+
+/**
+ * @brief 결과 값이 최적화로 제거되지 않도록 관찰
+ */
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+    g_benchSink = &value;
+}
+
+using BenchFunction = void (*)(State&);
+
+/**
+ * @brief 정적 초기화 시점에 벤치마크 등록
+ */
+struct Registrar {
+    Registrar(const char* name, BenchFunction fn);
+};
+
+/**
+ * @brief 명령행 옵션을 해석해 등록된 벤치마크 실행
+ *
+ * --filter=<부분문자열>  이름에 포함된 것만 실행
+ * --min_time=<초>        벤치마크당 최소 측정 시간 (기본 0.5)
+ * --latency_ns=<ns>      가짜 COM 호출 1회당 지연 (기본 0)
+ * --format=console|json  출력 형식 (기본 console)
+ * --list                 이름만 출력
+ *
+ * @return 프로세스 종료 코드
+ */
+int RunBenchmarks(int argc, char** argv);
+
+} // namespace bench
+} // namespace cpyhwpx
+
+#define CPYHWPX_BENCHMARK(fn) \
+    static ::cpyhwpx::bench::Registrar cpyhwpx_bench_registrar_##fn(#fn, fn)
@@ -0,0 +1,456 @@
+/**
+ * @file FakeHwpObject.cpp
+ * @brief 벤치마크용 가짜 HwpObject 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "FakeHwpObject.h"
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace cpyhwpx {
+namespace bench {
+
+namespace {
+
+constexpr DISPID kFirstDispid = 1000;
+
+/**
+ * @brief 프로세스 전역 이름 ↔ DISPID 표
+ */
+struct NameTable {
+    std::mutex mutex;
+    std::unordered_map<std::wstring, DISPID> ids;
+    std::deque<std::wstring> names;     // 추가만 하므로 항목 주소가 유지됨
+};
+
+NameTable& GetNameTable()
+{
+    static NameTable* s_table = new NameTable();
+    return *s_table;
+}
+
+std::atomic<uint32_t> s_latencyNs{ 0 };
+std::atomic<uint64_t> s_invokeCount{ 0 };
+std::atomic<uint64_t> s_getIdsCount{ 0 };
+
+/**
+ * @brief 설정한 지연만큼 대기 (Sleep보다 정밀하도록 busy-wait)
+ */
+void SimulateLatency()
+{
+    uint32_t ns = s_latencyNs.load(std::memory_order_relaxed);
+    if (ns == 0) return;
+
+    auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(ns);
+    while (std::chrono::steady_clock::now() < until) {
+    }
+}
+
+} // namespace
+
+//=============================================================================
+// FakeDispatch
+//=============================================================================
+
+FakeDispatch::FakeDispatch()
+    : m_refCount(1)
+{
+}
+
+FakeDispatch::~FakeDispatch()
+{
+    for (auto& kv : m_values) {
+        VariantClear(&kv.second);
+    }
+    for (auto& kv : m_items) {
+        VariantClear(&kv.second);
+    }
+    for (auto& kv : m_children) {
+        kv.second->Release();
+    }
+}
+
+HRESULT STDMETHODCALLTYPE FakeDispatch::QueryInterface(REFIID riid, void** ppv)
+{
+    if (!ppv) return E_POINTER;
+    if (IsEqualIID(riid, IID_IUnknown) || IsEqualIID(riid, IID_IDispatch)) {
+        *ppv = static_cast<IDispatch*>(this);
+        AddRef();
+        return S_OK;
+    }
+    *ppv = nullptr;
+    return E_NOINTERFACE;
+}
+
+ULONG STDMETHODCALLTYPE FakeDispatch::AddRef()
+{
+    return m_refCount.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+ULONG STDMETHODCALLTYPE FakeDispatch::Release()
+{
+    ULONG count = m_refCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+    if (count == 0) {
+        delete this;
+    }
+    return count;
+}
+
+HRESULT STDMETHODCALLTYPE FakeDispatch::GetTypeInfoCount(UINT* pctinfo)
+{
+    if (pctinfo) *pctinfo = 0;
+    return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE FakeDispatch::GetTypeInfo(UINT, LCID, ITypeInfo** ppTInfo)
+{
+    if (ppTInfo) *ppTInfo = nullptr;
+    return E_NOTIMPL;
+}
+
+HRESULT STDMETHODCALLTYPE FakeDispatch::GetIDsOfNames(REFIID, LPOLESTR* names, UINT count,
+                                                      LCID, DISPID* dispids)
+{
+    s_getIdsCount.fetch_add(1, std::memory_order_relaxed);
+    SimulateLatency();
+
+    if (!names || !dispids) return E_POINTER;
+    for (UINT i = 0; i < count; ++i) {
+        dispids[i] = IdOf(names[i]);
+    }
+    return S_OK;
+}
+
+HRESULT STDMETHODCALLTYPE FakeDispatch::Invoke(DISPID dispid, REFIID, LCID, WORD flags,
+                                               DISPPARAMS* params, VARIANT* result,
+                                               EXCEPINFO*, UINT*)
+{
+    s_invokeCount.fetch_add(1, std::memory_order_relaxed);
+    SimulateLatency();
+
+    const std::wstring* name = NameOf(dispid);
+    if (!name) return DISP_E_MEMBERNOTFOUND;
+
+    UINT argc = params ? params->cArgs : 0;
+    if (result) VariantInit(result);
+
+    // 속성 설정 (Item(name) = value 포함)
+    if (flags & (DISPATCH_PROPERTYPUT | DISPATCH_PROPERTYPUTREF)) {
+        if (argc == 0) return DISP_E_BADPARAMCOUNT;
+        const VARIANT& value = params->rgvarg[0];
+        if (*name == L"Item" && argc >= 2) {
+            VARIANT& slot = m_items[ArgString(params, 0)];
+            VariantClear(&slot);
+            VariantCopy(&slot, &value);
+        } else {
+            SetValue(name->c_str(), value);
+        }
+        return S_OK;
+    }
+
+    if (OnInvoke(*name, flags, params, result)) {
+        return S_OK;
+    }
+
+    if (*name == L"Item" && argc >= 1) {
+        auto it = m_items.find(ArgString(params, 0));
+        if (result) {
+            if (it != m_items.end()) {
+                VariantCopy(result, &it->second);
+            } else {
+                result->vt = VT_I4;
+                result->lVal = 0;
+            }
+        }
+        return S_OK;
+    }
+
+    auto value = m_values.find(dispid);
+    if (value != m_values.end()) {
+        if (result) VariantCopy(result, &value->second);
+        return S_OK;
+    }
+
+    if (*name == L"Clear" && argc == 0 && (flags & DISPATCH_METHOD)) {
+        for (auto& kv : m_items) {
+            VariantClear(&kv.second);
+        }
+        m_items.clear();
+        return S_OK;
+    }
+
+    if (*name == L"CreateAction" || *name == L"CreateSet" || *name == L"CreateItemSet") {
+        FakeDispatch* obj = new FakeDispatch();
+        ReturnDispatch(result, obj);
+        obj->Release();
+        return S_OK;
+    }
+
+    // 값이 없는 속성 조회: 하위 객체 (HParameterSet.HFindReplace 등)
+    if ((flags & DISPATCH_PROPERTYGET) && argc == 0) {
+        FakeDispatch*& child = m_children[dispid];
+        if (!child) {
+            child = new FakeDispatch();
+        }
+        ReturnDispatch(result, child);
+        return S_OK;
+    }
+
+    if (result) {
+        result->vt = VT_BOOL;
+        result->boolVal = VARIANT_TRUE;
+    }
+    return S_OK;
+}
+
+bool FakeDispatch::OnInvoke(const std::wstring&, WORD, DISPPARAMS*, VARIANT*)
+{
+    return false;
+}
+
+void FakeDispatch::SetValue(const wchar_t* name, const VARIANT& value)
+{
+    VARIANT& slot = m_values[IdOf(name)];
+    VariantClear(&slot);
+    VariantCopy(&slot, &value);
+}
+
+void FakeDispatch::SetString(const wchar_t* name, const std::wstring& value)
+{
+    VARIANT v;
+    VariantInit(&v);
+    v.vt = VT_BSTR;
+    v.bstrVal = SysAllocStringLen(value.c_str(), static_cast<UINT>(value.size()));
+    SetValue(name, v);
+    VariantClear(&v);
+}
+
+void FakeDispatch::SetInt(const wchar_t* name, int value)
+{
+    VARIANT v;
+    VariantInit(&v);
+    v.vt = VT_I4;
+    v.lVal = value;
+    SetValue(name, v);
+}
+
+//=============================================================================
+// 전역 설정/카운터
+//=============================================================================
+
+void FakeDispatch::SetLatency(uint32_t latency_ns)
+{
+    s_latencyNs.store(latency_ns, std::memory_order_relaxed);
+}
+
+uint32_t FakeDispatch::GetLatency()
+{
+    return s_latencyNs.load(std::memory_order_relaxed);
+}
+
+FakeCallCounts FakeDispatch::Counts()
+{
+    FakeCallCounts counts;
+    counts.invoke = s_invokeCount.load(std::memory_order_relaxed);
+    counts.get_ids = s_getIdsCount.load(std::memory_order_relaxed);
+    return counts;
+}
+
+void FakeDispatch::ResetCounts()
+{
+    s_invokeCount.store(0, std::memory_order_relaxed);
+    s_getIdsCount.store(0, std::memory_order_relaxed);
+}
+
+//=============================================================================
+// 보조 함수
+//=============================================================================
+
+DISPID FakeDispatch::IdOf(const wchar_t* name)
+{
+    NameTable& table = GetNameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.ids.find(name);
+    if (it != table.ids.end()) {
+        return it->second;
+    }
+    DISPID id = kFirstDispid + static_cast<DISPID>(table.names.size());
+    table.names.emplace_back(name);
+    table.ids.emplace(name, id);
+    return id;
+}
+
+const std::wstring* FakeDispatch::NameOf(DISPID dispid)
+{
+    NameTable& table = GetNameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    size_t index = static_cast<size_t>(dispid - kFirstDispid);
+    if (dispid < kFirstDispid || index >= table.names.size()) {
+        return nullptr;
+    }
+    return &table.names[index];
+}
+
+std::wstring FakeDispatch::ArgString(const DISPPARAMS* params, UINT index)
+{
+    // rgvarg는 역순: 첫 번째 인자가 마지막
+    UINT positional = params->cArgs - params->cNamedArgs;
+    if (index >= positional) return L"";
+    const VARIANT& v = params->rgvarg[params->cArgs - 1 - index];
+    if (v.vt == VT_BSTR && v.bstrVal) {
+        return std::wstring(v.bstrVal, SysStringLen(v.bstrVal));
+    }
+    return L"";
+}
+
+void FakeDispatch::ReturnString(VARIANT* result, const std::wstring& value)
+{
+    if (!result) return;
+    result->vt = VT_BSTR;
+    result->bstrVal = SysAllocStringLen(value.c_str(), static_cast<UINT>(value.size()));
+}
+
+void FakeDispatch::ReturnDispatch(VARIANT* result, IDispatch* obj)
+{
+    if (!result) return;
+    obj->AddRef();
+    result->vt = VT_DISPATCH;
+    result->pdispVal = obj;
+}
+
+//=============================================================================
+// FakeCtrl
+//=============================================================================
+
+FakeCtrl::FakeCtrl(const std::wstring& ctrl_id)
+{
+    SetString(L"CtrlID", ctrl_id);
+    SetInt(L"CtrlCh", 11);
+    SetString(L"UserDesc", ctrl_id);
+}
+
+bool FakeCtrl::OnInvoke(const std::wstring& name, WORD, DISPPARAMS*, VARIANT* result)
+{
+    if (name == L"Next" || name == L"Prev") {
+        FakeCtrl* target = (name == L"Next") ? next : prev;
+        if (target) {
+            ReturnDispatch(result, target);
+        }
+        return true;    // 끝이면 VT_EMPTY
+    }
+    return false;
+}
+
+//=============================================================================
+// FakeHwpObject
+//=============================================================================
+
+FakeHwpObject::FakeHwpObject(const FakeHwpConfig& config)
+    : m_config(config)
+{
+    // 실제 문서처럼 secd(구역 정의), cold(단 정의)로 시작
+    static const wchar_t* kCtrlIds[] = { L"tbl", L"gso", L"eqed", L"%clk", L"fn" };
+
+    m_ctrls.push_back(new FakeCtrl(L"secd"));
+    m_ctrls.push_back(new FakeCtrl(L"cold"));
+    for (int i = 0; i < config.ctrl_count; ++i) {
+        m_ctrls.push_back(new FakeCtrl(kCtrlIds[i % 5]));
+    }
+    for (size_t i = 1; i < m_ctrls.size(); ++i) {
+        m_ctrls[i - 1]->next = m_ctrls[i];
+        m_ctrls[i]->prev = m_ctrls[i - 1];
+    }
+
+    for (int i = 0; i < config.field_count; ++i) {
+        if (i > 0) m_fieldList += L'\x02';
+        m_fieldList += L"field" + std::to_wstring(i);
+    }
+    for (int i = 0; i < config.metatag_count; ++i) {
+        if (i > 0) m_metatagList += L'\x02';
+        m_metatagList += L"#tag" + std::to_wstring(i);
+    }
+
+    static const wchar_t kSentence[] = L"한글 문서 자동화 벤치마크 본문입니다. ";
+    m_text.reserve(config.text_chars);
+    while (m_text.size() < config.text_chars) {
+        m_text += kSentence;
+    }
+    m_text.resize(config.text_chars);
+}
+
+FakeHwpObject::~FakeHwpObject()
+{
+    for (FakeCtrl* ctrl : m_ctrls) {
+        ctrl->next = nullptr;
+        ctrl->prev = nullptr;
+        ctrl->Release();
+    }
+}
+
+void FakeHwpObject::Unhang()
+{
+    // 잠금 안에서 알림: 깨어난 호출이 끝나면 이 객체가 곧바로 해제될 수 있음
+    std::lock_guard<std::mutex> lock(m_hangMutex);
+    m_unhung = true;
+    m_hangCv.notify_all();
+}
+
+bool FakeHwpObject::OnInvoke(const std::wstring& name, WORD, DISPPARAMS* params, VARIANT* result)
+{
+    if (!m_config.hang_on.empty() && name == m_config.hang_on) {
+        std::unique_lock<std::mutex> lock(m_hangMutex);
+        m_hangCv.wait(lock, [this] { return m_unhung; });
+        if (result) {
+            result->vt = VT_BOOL;
+            result->boolVal = VARIANT_FALSE;
+        }
+        return true;
+    }
+    if (name == L"HeadCtrl") {
+        ReturnDispatch(result, m_ctrls.front());
+        return true;
+    }
+    if (name == L"LastCtrl") {
+        ReturnDispatch(result, m_ctrls.back());
+        return true;
+    }
+    if (name == L"GetFieldList") {
+        ReturnString(result, m_fieldList);
+        return true;
+    }
+    if (name == L"GetFieldText") {
+        // "\x02"로 이은 필드 목록이면 값도 "\x02"로 이어 반환
+        std::wstring fields = ArgString(params, 0);
+        std::wstring texts;
+        size_t start = 0;
+        while (true) {
+            size_t end = fields.find(L'\x02', start);
+            texts += fields.substr(start, end == std::wstring::npos ? end : end - start) + L" 값";
+            if (end == std::wstring::npos) break;
+            texts += L'\x02';
+            start = end + 1;
+        }
+        ReturnString(result, texts);
+        return true;
+    }
+    if (name == L"GetMetatagList") {
+        ReturnString(result, m_metatagList);
+        return true;
+    }
+    if (name == L"GetMetatagNameText") {
+        ReturnString(result, ArgString(params, 0) + L" 값");
+        return true;
+    }
+    if (name == L"GetTextFile" || name == L"Gettextfile") {    // IDispatch 이름은 대소문자 무시
+        ReturnString(result, m_text);
+        return true;
+    }
+    return false;
+}
+
+} // namespace bench
+} // namespace cpyhwpx
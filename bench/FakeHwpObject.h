@@ -0,0 +1,176 @@
+/**
+ * @file FakeHwpObject.h
+ * @brief 벤치마크용 가짜 HwpObject (결정적 IDispatch 구현)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 한/글 없이 HwpWrapper의 COM 호출 경로를 그대로 실행하기 위한 객체.
+ * 호출마다 설정한 지연만큼 대기하고 Invoke/GetIDsOfNames 횟수를 센다.
+ */
+
+#pragma once
+
+#include "ComPlatform.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cpyhwpx {
+namespace bench {
+
+/**
+ * @brief 가짜 문서 구성
+ */
+struct FakeHwpConfig {
+    int ctrl_count = 32;            // secd/cold 뒤에 이어지는 컨트롤 수
+    int field_count = 32;           // 누름틀 필드 수
+    int metatag_count = 50;         // 메타태그 수
+    size_t text_chars = 4096;       // GetTextFile이 돌려주는 본문 길이
+    std::wstring hang_on;           // 이 이름의 메서드는 Unhang()까지 멈춤 (모달 대화상자 흉내)
+};
+
+/**
+ * @brief 누적 COM 왕복 횟수
+ */
+struct FakeCallCounts {
+    uint64_t invoke = 0;
+    uint64_t get_ids = 0;
+};
+
+/**
+ * @class FakeDispatch
+ * @brief 이름 기반으로 동작하는 범용 IDispatch
+ *
+ * - 모든 이름은 프로세스 전역 표에서 DISPID를 받는다 (실패 없음)
+ * - PROPERTYPUT은 값을 저장하고, 이후 PROPERTYGET은 저장한 값을 돌려준다
+ * - 값이 없는 인자 없는 PROPERTYGET은 하위 FakeDispatch를 만들어 캐시한다
+ * - Item(name) / Item(name) = value 는 항목 표로 처리한다
+ * - CreateAction/CreateSet/CreateItemSet은 새 객체를 돌려준다
+ * - 그 밖의 메서드는 VT_BOOL TRUE
+ */
+class FakeDispatch : public IDispatch {
+public:
+    FakeDispatch();
+    virtual ~FakeDispatch();
+
+    FakeDispatch(const FakeDispatch&) = delete;
+    FakeDispatch& operator=(const FakeDispatch&) = delete;
+
+    // IUnknown
+    HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppv) override;
+    ULONG STDMETHODCALLTYPE AddRef() override;
+    ULONG STDMETHODCALLTYPE Release() override;
+
+    // IDispatch
+    HRESULT STDMETHODCALLTYPE GetTypeInfoCount(UINT* pctinfo) override;
+    HRESULT STDMETHODCALLTYPE GetTypeInfo(UINT, LCID, ITypeInfo** ppTInfo) override;
+    HRESULT STDMETHODCALLTYPE GetIDsOfNames(REFIID riid, LPOLESTR* names, UINT count,
+                                            LCID lcid, DISPID* dispids) override;
+    HRESULT STDMETHODCALLTYPE Invoke(DISPID dispid, REFIID riid, LCID lcid, WORD flags,
+                                     DISPPARAMS* params, VARIANT* result,
+                                     EXCEPINFO* excepInfo, UINT* argErr) override;
+
+    /**
+     * @brief 속성 값 미리 지정 (VARIANT 복사)
+     */
+    void SetValue(const wchar_t* name, const VARIANT& value);
+    void SetString(const wchar_t* name, const std::wstring& value);
+    void SetInt(const wchar_t* name, int value);
+
+    //=========================================================================
+    // 전역 설정/카운터
+    //=========================================================================
+
+    /**
+     * @brief Invoke/GetIDsOfNames 1회당 지연 (ns, busy-wait)
+     */
+    static void SetLatency(uint32_t latency_ns);
+    static uint32_t GetLatency();
+
+    static FakeCallCounts Counts();
+    static void ResetCounts();
+
+protected:
+    /**
+     * @brief 파생 클래스 전용 멤버 처리 (처리했으면 true)
+     */
+    virtual bool OnInvoke(const std::wstring& name, WORD flags,
+                          DISPPARAMS* params, VARIANT* result);
+
+    static DISPID IdOf(const wchar_t* name);
+    static const std::wstring* NameOf(DISPID dispid);
+
+    /**
+     * @brief 인자 i번째 (호출 순서 기준, 0부터) BSTR 값
+     */
+    static std::wstring ArgString(const DISPPARAMS* params, UINT index);
+
+    static void ReturnString(VARIANT* result, const std::wstring& value);
+    static void ReturnDispatch(VARIANT* result, IDispatch* obj);
+
+private:
+    std::atomic<ULONG> m_refCount;
+    std::map<DISPID, VARIANT> m_values;
+    std::map<DISPID, FakeDispatch*> m_children;
+    std::map<std::wstring, VARIANT> m_items;
+};
+
+/**
+ * @class FakeCtrl
+ * @brief 컨트롤 체인 노드 (CtrlID, Next, Prev)
+ *
+ * 이웃 노드는 소유하지 않는다. 체인은 FakeHwpObject가 소유한다.
+ */
+class FakeCtrl : public FakeDispatch {
+public:
+    explicit FakeCtrl(const std::wstring& ctrl_id);
+
+    FakeCtrl* next = nullptr;
+    FakeCtrl* prev = nullptr;
+
+protected:
+    bool OnInvoke(const std::wstring& name, WORD flags,
+                  DISPPARAMS* params, VARIANT* result) override;
+};
+
+/**
+ * @class FakeHwpObject
+ * @brief HWPFrame.HwpObject 대역
+ *
+ * HeadCtrl/LastCtrl, GetFieldList/GetFieldText, GetMetatagList/GetMetatagNameText,
+ * GetTextFile을
+ * 구성값에 따라 결정적으로 돌려준다.
+ */
+class FakeHwpObject : public FakeDispatch {
+public:
+    explicit FakeHwpObject(const FakeHwpConfig& config = FakeHwpConfig());
+    ~FakeHwpObject() override;
+
+    const FakeHwpConfig& config() const { return m_config; }
+
+    /**
+     * @brief 멈춘 호출을 풀고 이후 hang_on 호출은 바로 실패시킴 (프로세스 종료 흉내)
+     */
+    void Unhang();
+
+protected:
+    bool OnInvoke(const std::wstring& name, WORD flags,
+                  DISPPARAMS* params, VARIANT* result) override;
+
+private:
+    FakeHwpConfig m_config;
+    std::vector<FakeCtrl*> m_ctrls;
+    std::wstring m_fieldList;
+    std::wstring m_metatagList;
+    std::wstring m_text;
+
+    std::mutex m_hangMutex;
+    std::condition_variable m_hangCv;
+    bool m_unhung = false;
+};
+
+} // namespace bench
+} // namespace cpyhwpx
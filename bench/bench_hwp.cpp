@@ -0,0 +1,738 @@
+/**
+ * @file bench_hwp.cpp
+ * @brief HwpWrapper 주요 경로 벤치마크 (가짜 HwpObject 사용)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 한/글 없이 실행되며, 반복당 시간과 COM 왕복 횟수를 보고한다.
+ * 왕복 횟수는 결정적이므로 CI에서 회귀 비교 기준으로 사용할 수 있다.
+ *
+ * 사용법:
+ *   cpyhwpx_bench --latency_ns=20000 --filter=Field --format=json
+ */
+
+#include "BenchHarness.h"
+#include "FakeHwpObject.h"
+#include "HwpWrapper.h"
+#include "HwpCtrl.h"
+#include "HwpParameter.h"
+#include "ComScope.h"
+#include "AsyncHwp.h"
+#include "HwpInstancePool.h"
+#include "BulkEditScope.h"
+#include "BatchConverter.h"
+#include "HwpxWriter.h"
+#include "ZipReader.h"
+#include "Utils.h"
+#include "FontDefs.h"
+#include <cstdio>
+
+using namespace cpyhwpx;
+using namespace cpyhwpx::bench;
+
+namespace {
+
+/**
+ * @class HwpFixture
+ * @brief 가짜 HwpObject를 연결한 HwpWrapper
+ */
+class HwpFixture {
+public:
+    explicit HwpFixture(const FakeHwpConfig& config = FakeHwpConfig())
+        : m_hwp(false, false, false)
+    {
+        FakeHwpObject* obj = new FakeHwpObject(config);
+        m_hwp.Attach(obj);
+        obj->Release();
+    }
+
+    HwpWrapper& hwp() { return m_hwp; }
+
+private:
+    HwpWrapper m_hwp;
+};
+
+std::vector<std::vector<std::wstring>> MakeTableData(int rows, int cols)
+{
+    std::vector<std::vector<std::wstring>> data(rows);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            data[r].push_back(r == 0 ? L"항목" + std::to_wstring(c)
+                                     : std::to_wstring(r * cols + c));
+        }
+    }
+    return data;
+}
+
+} // namespace
+
+//=============================================================================
+// 텍스트 입력
+//=============================================================================
+
+static void BM_InsertText(State& state)
+{
+    HwpFixture fx;
+    const std::wstring text = L"한글 문서 자동화 벤치마크";
+    for (auto _ : state) {
+        DoNotOptimize(fx.hwp().InsertText(text));
+    }
+}
+CPYHWPX_BENCHMARK(BM_InsertText);
+
+static void BM_InsertText_4K(State& state)
+{
+    HwpFixture fx;
+    const std::wstring text(4096, L'가');
+    for (auto _ : state) {
+        DoNotOptimize(fx.hwp().InsertText(text));
+    }
+}
+CPYHWPX_BENCHMARK(BM_InsertText_4K);
+
+//=============================================================================
+// 표
+//=============================================================================
+
+static void BM_TableFromData_5x4(State& state)
+{
+    HwpFixture fx;
+    const auto data = MakeTableData(5, 4);
+    for (auto _ : state) {
+        DoNotOptimize(fx.hwp().TableFromData(data));
+    }
+    state.SetItemsProcessed(5 * 4);
+}
+CPYHWPX_BENCHMARK(BM_TableFromData_5x4);
+
+static void BM_TableFromData_5x4_BulkEdit(State& state)
+{
+    HwpFixture fx;
+    const auto data = MakeTableData(5, 4);
+    for (auto _ : state) {
+        // 범위 진입/복원 비용 포함 (화면 갱신 절감은 실제 한/글에서만 측정 가능)
+        BulkEditScope bulk(fx.hwp());
+        DoNotOptimize(fx.hwp().TableFromData(data));
+    }
+    state.SetItemsProcessed(5 * 4);
+}
+CPYHWPX_BENCHMARK(BM_TableFromData_5x4_BulkEdit);
+
+static void BM_CellFill(State& state)
+{
+    HwpFixture fx;
+    for (auto _ : state) {
+        DoNotOptimize(fx.hwp().CellFill(230, 230, 230));
+    }
+}
+CPYHWPX_BENCHMARK(BM_CellFill);
+
+static void BM_CellFill_NoPool(State& state)
+{
+    HwpFixture fx;
+    fx.hwp().SetParameterSetPoolLimit(0);
+    for (auto _ : state) {
+        DoNotOptimize(fx.hwp().CellFill(230, 230, 230));
+    }
+}
+CPYHWPX_BENCHMARK(BM_CellFill_NoPool);
+
+//=============================================================================
+// 파라미터셋
+//=============================================================================
+
+namespace {
+
+const wchar_t* const kShapeItems[] = {
+    L"Height", L"Bold", L"Italic", L"UnderlineType", L"UnderlineShape", L"UnderlineColor",
+    L"StrikeOutType", L"StrikeOutShape", L"StrikeOutColor", L"TextColor", L"ShadeColor",
+    L"Superscript", L"Subscript", L"UseFontSpace", L"UseKerning", L"BorderType",
+    L"OutlineType", L"ShadowType", L"ShadowColor", L"ShadowOffsetX", L"ShadowOffsetY",
+    L"Emboss", L"Engrave", L"SmallCaps", L"SizeHangul", L"SizeLatin", L"SizeHanja",
+    L"SizeJapanese", L"SizeOther", L"SizeSymbol", L"SizeUser", L"DiacSymMark",
+};
+constexpr int kShapeItemCount = sizeof(kShapeItems) / sizeof(kShapeItems[0]);
+
+} // namespace
+
+static void BM_ParameterSet_SetItem_32(State& state)
+{
+    HwpFixture fx;
+    for (auto _ : state) {
+        IDispatch* pSet = fx.hwp().CreateSet(L"CharShape");
+        HwpParameterSet pset(pSet);
+        for (int i = 0; i < kShapeItemCount; ++i) {
+            DoNotOptimize(pset.SetItem(kShapeItems[i], i));
+        }
+        pSet->Release();
+    }
+    state.SetItemsProcessed(kShapeItemCount);
+}
+CPYHWPX_BENCHMARK(BM_ParameterSet_SetItem_32);
+
+static void BM_ParameterSet_SetItems_32(State& state)
+{
+    HwpFixture fx;
+    std::vector<std::pair<std::wstring, VARIANT>> items;
+    for (int i = 0; i < kShapeItemCount; ++i) {
+        items.emplace_back(kShapeItems[i], IntArg(i));
+    }
+    for (auto _ : state) {
+        auto pset = fx.hwp().AcquireParameterSet(L"CharShape");
+        DoNotOptimize(pset->SetItems(items));
+    }
+    state.SetItemsProcessed(kShapeItemCount);
+}
+CPYHWPX_BENCHMARK(BM_ParameterSet_SetItems_32);
+
+//=============================================================================
+// 필드
+//=============================================================================
+
+static void BM_FieldsToMap_32(State& state)
+{
+    FakeHwpConfig config;
+    config.field_count = 32;
+    HwpFixture fx(config);
+    for (auto _ : state) {
+        auto fields = fx.hwp().FieldsToMap();
+        DoNotOptimize(fields);
+    }
+    state.SetItemsProcessed(config.field_count);
+}
+CPYHWPX_BENCHMARK(BM_FieldsToMap_32);
+
+static void BM_FieldsToMap_32_AfterEdit(State& state)
+{
+    FakeHwpConfig config;
+    config.field_count = 32;
+    HwpFixture fx(config);
+    for (auto _ : state) {
+        fx.hwp().NoteEdit(EditKind::Content);
+        auto fields = fx.hwp().FieldsToMap();
+        DoNotOptimize(fields);
+    }
+    state.SetItemsProcessed(config.field_count);
+}
+CPYHWPX_BENCHMARK(BM_FieldsToMap_32_AfterEdit);
+
+static void BM_FieldExist_PutFieldText_32(State& state)
+{
+    FakeHwpConfig config;
+    config.field_count = 32;
+    HwpFixture fx(config);
+    for (auto _ : state) {
+        for (int i = 0; i < config.field_count; ++i) {
+            std::wstring field = L"field" + std::to_wstring(i);
+            if (fx.hwp().FieldExist(field)) {
+                DoNotOptimize(fx.hwp().PutFieldText(field, L"값"));
+            }
+        }
+    }
+    state.SetItemsProcessed(config.field_count);
+}
+CPYHWPX_BENCHMARK(BM_FieldExist_PutFieldText_32);
+
+static void BM_MetatagsToMap_50(State& state)
+{
+    FakeHwpConfig config;
+    config.metatag_count = 50;
+    HwpFixture fx(config);
+    for (auto _ : state) {
+        auto tags = fx.hwp().MetatagsToMap();
+        DoNotOptimize(tags);
+    }
+    state.SetItemsProcessed(config.metatag_count);
+}
+CPYHWPX_BENCHMARK(BM_MetatagsToMap_50);
+
+static void BM_PutMetatagTexts_50(State& state)
+{
+    std::map<std::wstring, std::wstring> texts;
+    for (int i = 0; i < 50; ++i) {
+        texts[L"#tag" + std::to_wstring(i)] = L"값";
+    }
+    HwpFixture fx;
+    for (auto _ : state) {
+        DoNotOptimize(fx.hwp().PutMetatagTexts(texts));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(texts.size()));
+}
+CPYHWPX_BENCHMARK(BM_PutMetatagTexts_50);
+
+//=============================================================================
+// 글자모양 / 찾기·바꾸기
+//=============================================================================
+
+static void BM_GetCharShape(State& state)
+{
+    HwpFixture fx;
+    for (auto _ : state) {
+        auto shape = fx.hwp().GetCharShape();
+        DoNotOptimize(shape);
+    }
+}
+CPYHWPX_BENCHMARK(BM_GetCharShape);
+
+static void BM_ReplaceAll(State& state)
+{
+    HwpFixture fx;
+    for (auto _ : state) {
+        DoNotOptimize(fx.hwp().ReplaceAll(L"홍길동", L"김철수"));
+    }
+}
+CPYHWPX_BENCHMARK(BM_ReplaceAll);
+
+//=============================================================================
+// 컨트롤 순회
+//=============================================================================
+
+static void BM_GetCtrlList_32(State& state)
+{
+    FakeHwpConfig config;
+    config.ctrl_count = 32;
+    HwpFixture fx(config);
+    for (auto _ : state) {
+        auto ctrls = fx.hwp().GetCtrlList();
+        DoNotOptimize(ctrls);
+    }
+    state.SetItemsProcessed(config.ctrl_count);
+}
+CPYHWPX_BENCHMARK(BM_GetCtrlList_32);
+
+//=============================================================================
+// AsyncHwp (실행 스레드 왕복)
+//=============================================================================
+
+namespace {
+
+bool AttachFake(HwpWrapper& hwp)
+{
+    FakeHwpObject* obj = new FakeHwpObject();
+    bool ok = hwp.Attach(obj);
+    obj->Release();
+    return ok;
+}
+
+} // namespace
+
+static void BM_Async_InsertText_RoundTrip(State& state)
+{
+    AsyncHwp async(false, false, false, AttachFake);
+    async.Ready().wait();
+    const std::wstring text = L"한글 문서 자동화 벤치마크";
+    for (auto _ : state) {
+        // 결과를 받은 뒤 다음 호출 (호출마다 스레드 왕복)
+        DoNotOptimize(async.Submit([&text](HwpWrapper& hwp) { return hwp.InsertText(text); }).get());
+    }
+}
+CPYHWPX_BENCHMARK(BM_Async_InsertText_RoundTrip);
+
+static void BM_Async_InsertText_RoundTrip_Watched(State& state)
+{
+    AsyncHwp async(false, false, false, AttachFake);
+    async.Ready().wait();
+    async.SetCallTimeout(std::chrono::seconds(10));
+    const std::wstring text = L"한글 문서 자동화 벤치마크";
+    for (auto _ : state) {
+        // 워치독 등록/해제 비용
+        DoNotOptimize(async.Submit([&text](HwpWrapper& hwp) { return hwp.InsertText(text); }).get());
+    }
+}
+CPYHWPX_BENCHMARK(BM_Async_InsertText_RoundTrip_Watched);
+
+static void BM_Async_HangTimeout_Recover(State& state)
+{
+    // Open에서 멈추는 가짜 한/글: 워치독이 Unhang()으로 "종료"하면 새 인스턴스로 교체
+    std::atomic<FakeHwpObject*> current{nullptr};
+    AsyncHwp async(false, false, false, [&current](HwpWrapper& hwp) {
+        FakeHwpConfig config;
+        config.hang_on = L"Open";
+        FakeHwpObject* obj = new FakeHwpObject(config);
+        current.store(obj);
+        bool ok = hwp.Attach(obj);
+        obj->Release();
+        return ok;
+    });
+    async.Ready().wait();
+    async.SetHangHandler([&current] { current.load()->Unhang(); });
+    for (auto _ : state) {
+        std::future<bool> result = async.Submit([](HwpWrapper& hwp) { return hwp.Open(L"stuck.hwp"); },
+                                                std::chrono::milliseconds(1));
+        try {
+            result.get();
+        } catch (const HwpTimeoutError&) {
+        }
+        // 교체가 끝날 때까지 (다음 작업은 새 인스턴스에서 실행)
+        DoNotOptimize(async.Submit([](HwpWrapper& hwp) { return hwp.InsertText(L"가"); }).get());
+    }
+}
+CPYHWPX_BENCHMARK(BM_Async_HangTimeout_Recover);
+
+static void BM_Async_InsertText_Pipelined_64(State& state)
+{
+    AsyncHwp async(false, false, false, AttachFake);
+    async.Ready().wait();
+    const std::wstring text = L"한글 문서 자동화 벤치마크";
+    std::vector<std::future<bool>> results;
+    results.reserve(64);
+    for (auto _ : state) {
+        // 64개를 연달아 넣고 마지막에 한 번에 수거
+        for (int i = 0; i < 64; ++i) {
+            results.push_back(async.Submit([&text](HwpWrapper& hwp) { return hwp.InsertText(text); }));
+        }
+        for (auto& f : results) {
+            DoNotOptimize(f.get());
+        }
+        results.clear();
+    }
+    state.SetItemsProcessed(64);
+}
+CPYHWPX_BENCHMARK(BM_Async_InsertText_Pipelined_64);
+
+static void BM_Async_InsertText_Batch_64(State& state)
+{
+    AsyncHwp async(false, false, false, AttachFake);
+    async.Ready().wait();
+    HwpBatch batch;
+    for (int i = 0; i < 64; ++i) {
+        batch.InsertText(L"한글 문서 자동화 벤치마크");
+    }
+    for (auto _ : state) {
+        // 64개를 한 번의 스레드 왕복으로
+        auto results = async.SubmitBatch(batch).get();
+        DoNotOptimize(results);
+    }
+    state.SetItemsProcessed(64);
+}
+CPYHWPX_BENCHMARK(BM_Async_InsertText_Batch_64);
+
+static void BM_InstancePool_AcquireRun(State& state)
+{
+    HwpInstancePoolConfig config;
+    config.warm_count = 2;
+    config.max_jobs = 0;
+    HwpInstancePool pool(config, [] { return std::make_unique<AsyncHwp>(false, false, false, AttachFake); });
+    for (auto _ : state) {
+        // 대기 인스턴스를 빌려 작업 하나 실행 후 반환 (반환 시 ClearDocument)
+        HwpInstancePool::Lease lease = pool.Acquire();
+        DoNotOptimize(lease->Submit([](HwpWrapper& hwp) { return hwp.InsertText(L"가"); }).get());
+    }
+}
+CPYHWPX_BENCHMARK(BM_InstancePool_AcquireRun);
+
+static void BM_InstancePool_AcquireRun_Cold(State& state)
+{
+    HwpInstancePoolConfig config;
+    config.warm_count = 0;
+    HwpInstancePool pool(config, [] { return std::make_unique<AsyncHwp>(false, false, false, AttachFake); });
+    for (auto _ : state) {
+        // 요청마다 새 인스턴스를 띄우고 종료 (풀 없는 기준선)
+        HwpInstancePool::Lease lease = pool.Acquire();
+        DoNotOptimize(lease->Submit([](HwpWrapper& hwp) { return hwp.InsertText(L"가"); }).get());
+    }
+}
+CPYHWPX_BENCHMARK(BM_InstancePool_AcquireRun_Cold);
+
+static void BM_BatchConverter_32Files(State& state)
+{
+    BatchConvertConfig config;
+    config.workers = 2;
+    config.skip_up_to_date = false;
+    config.max_jobs_per_instance = 0;
+    BatchConverter converter(config, [] { return std::make_unique<AsyncHwp>(false, false, false, AttachFake); });
+    std::vector<std::wstring> inputs;
+    for (int i = 0; i < 32; ++i) {
+        inputs.push_back(L"doc" + std::to_wstring(i) + L".hwp");
+    }
+    for (auto _ : state) {
+        // 인스턴스 2개, 인스턴스마다 2개씩 미리 넣어 두고 Open → SaveAs → ClearDocument
+        DoNotOptimize(converter.Run(inputs));
+    }
+    state.SetItemsProcessed(32);
+}
+CPYHWPX_BENCHMARK(BM_BatchConverter_32Files);
+
+static void BM_BatchConverter_32Files_Serial(State& state)
+{
+    AsyncHwp async(false, false, false, AttachFake);
+    async.Ready().wait();
+    std::vector<std::wstring> inputs;
+    for (int i = 0; i < 32; ++i) {
+        inputs.push_back(L"doc" + std::to_wstring(i) + L".hwp");
+    }
+    for (auto _ : state) {
+        // 파일마다 결과를 받은 뒤 다음 파일 (Python 루프 기준선)
+        for (const std::wstring& input : inputs) {
+            DoNotOptimize(async.Submit([&input](HwpWrapper& hwp) {
+                bool ok = hwp.Open(input, L"", L"forceopen:true") &&
+                          hwp.SaveAs(Utils::GetFileNameWithoutExtension(input) + L".pdf", L"PDF", L"");
+                hwp.ClearDocument(1);
+                return ok;
+            }).get());
+        }
+    }
+    state.SetItemsProcessed(32);
+}
+CPYHWPX_BENCHMARK(BM_BatchConverter_32Files_Serial);
+
+//=============================================================================
+// 서식 캐시 / 체크포인트
+//=============================================================================
+
+static void BM_OpenTemplate(State& state)
+{
+    HwpFixture fx;
+    fx.hwp().OpenTemplate(L"form.hwt");
+    for (auto _ : state) {
+        DoNotOptimize(fx.hwp().OpenTemplate(L"form.hwt"));
+    }
+}
+CPYHWPX_BENCHMARK(BM_OpenTemplate);
+
+static void BM_OpenTemplate_NoCache(State& state)
+{
+    HwpFixture fx;
+    fx.hwp().SetTemplateCacheLimit(0);
+    for (auto _ : state) {
+        DoNotOptimize(fx.hwp().OpenTemplate(L"form.hwt"));
+    }
+}
+CPYHWPX_BENCHMARK(BM_OpenTemplate_NoCache);
+
+static void BM_Checkpoint_Restore(State& state)
+{
+    HwpFixture fx;
+    for (auto _ : state) {
+        int token = fx.hwp().Checkpoint();
+        DoNotOptimize(fx.hwp().Restore(token));
+        fx.hwp().DropCheckpoint(token);
+    }
+}
+CPYHWPX_BENCHMARK(BM_Checkpoint_Restore);
+
+//=============================================================================
+// 작업 기록
+//=============================================================================
+
+static void BM_InsertText_Recording(State& state)
+{
+    HwpFixture fx;
+    fx.hwp().StartRecording();
+    const std::wstring text = L"한글 문서 자동화 벤치마크";
+    for (auto _ : state) {
+        DoNotOptimize(fx.hwp().InsertText(text));
+    }
+    DoNotOptimize(fx.hwp().StopRecording());
+}
+CPYHWPX_BENCHMARK(BM_InsertText_Recording);
+
+static void BM_Batch_BinaryRoundTrip_64(State& state)
+{
+    HwpBatch batch;
+    for (int i = 0; i < 64; ++i) {
+        batch.InsertText(L"한글 문서 자동화 벤치마크");
+        batch.ExecuteSet(L"CharShape", L"CharShape").Item(L"Bold", i % 2 == 0);
+    }
+    for (auto _ : state) {
+        HwpBatch restored;
+        DoNotOptimize(HwpBatch::FromBinary(batch.ToBinary(), restored));
+    }
+    state.SetItemsProcessed(128);
+}
+CPYHWPX_BENCHMARK(BM_Batch_BinaryRoundTrip_64);
+
+//=============================================================================
+// Utils / FontDefs (COM 호출 없음)
+//=============================================================================
+
+static void BM_Utils_AddrToTuple(State& state)
+{
+    for (auto _ : state) {
+        DoNotOptimize(Utils::AddrToTuple(L"AB1024"));
+    }
+}
+CPYHWPX_BENCHMARK(BM_Utils_AddrToTuple);
+
+static void BM_Utils_ExpandRange(State& state)
+{
+    for (auto _ : state) {
+        auto cells = Utils::ExpandRange(L"A1:H20");
+        DoNotOptimize(cells);
+    }
+    state.SetItemsProcessed(8 * 20);
+}
+CPYHWPX_BENCHMARK(BM_Utils_ExpandRange);
+
+static void BM_Utils_SplitJoin(State& state)
+{
+    const std::wstring csv = L"가,나,다,라,마,바,사,아,자,차,카,타,파,하";
+    for (auto _ : state) {
+        auto joined = Utils::Join(Utils::Split(csv, L","), L"\x02");
+        DoNotOptimize(joined);
+    }
+}
+CPYHWPX_BENCHMARK(BM_Utils_SplitJoin);
+
+static void BM_Utils_HexToColorRef(State& state)
+{
+    for (auto _ : state) {
+        DoNotOptimize(Utils::HexToColorRef(L"#1E90FF"));
+    }
+}
+CPYHWPX_BENCHMARK(BM_Utils_HexToColorRef);
+
+static void BM_Utils_Base64RoundTrip_64K(State& state)
+{
+    std::string raw(64 * 1024, '\0');
+    for (size_t i = 0; i < raw.size(); ++i) {
+        raw[i] = static_cast<char>(i * 131);
+    }
+    std::wstring encoded(Utils::Base64EncodedLength(raw.size()), L'\0');
+    std::string decoded;
+    for (auto _ : state) {
+        Utils::Base64Encode(reinterpret_cast<const unsigned char*>(raw.data()), raw.size(), &encoded[0]);
+        DoNotOptimize(Utils::Base64Decode(encoded.data(), encoded.size(), decoded));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(raw.size()));
+}
+CPYHWPX_BENCHMARK(BM_Utils_Base64RoundTrip_64K);
+
+static void BM_FontDefs_GetPreset(State& state)
+{
+    for (auto _ : state) {
+        auto preset = FontDefs::GetPreset(L"맑은고딕");
+        DoNotOptimize(preset);
+    }
+}
+CPYHWPX_BENCHMARK(BM_FontDefs_GetPreset);
+
+static void BM_FontDefs_GetPresetNames(State& state)
+{
+    for (auto _ : state) {
+        auto names = FontDefs::GetPresetNames();
+        DoNotOptimize(names);
+    }
+}
+CPYHWPX_BENCHMARK(BM_FontDefs_GetPresetNames);
+
+//=============================================================================
+// HWPX 쓰기 (COM 호출 없음)
+//=============================================================================
+
+static std::string SampleSectionXml(size_t size)
+{
+    std::string xml;
+    for (int i = 0; xml.size() < size; ++i) {
+        xml += "<hp:p id=\"0\" paraPrIDRef=\"0\" styleIDRef=\"0\" pageBreak=\"0\" columnBreak=\"0\" merged=\"0\">"
+               "<hp:run charPrIDRef=\"0\"><hp:t>\xEB\xB3\xB4\xEA\xB3\xA0\xEC\x84\x9C \xEB\xAC\xB8\xEB\x8B\xA8 ";
+        xml += std::to_string(i * 7919);
+        xml += "</hp:t></hp:run></hp:p>";
+    }
+    xml.resize(size);
+    return xml;
+}
+
+static void BM_Deflate_SectionXml_256K(State& state)
+{
+    const std::string xml = SampleSectionXml(256 * 1024);
+    for (auto _ : state) {
+        DoNotOptimize(DeflateBuffer(xml.data(), xml.size(), 6));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(xml.size()));
+}
+CPYHWPX_BENCHMARK(BM_Deflate_SectionXml_256K);
+
+static void BM_HwpxWriter_Report_200Paras(State& state)
+{
+    const std::wstring path = L"cpyhwpx_bench.hwpx";
+    std::vector<std::vector<std::wstring>> rows;
+    for (int r = 0; r < 20; ++r) {
+        rows.push_back({ L"항목 " + std::to_wstring(r), std::to_wstring(r * 1234), L"비고" });
+    }
+    const HwpxTable table = HwpxTable::FromRows(rows);
+
+    for (auto _ : state) {
+        HwpxWriter writer;
+        CharShape bold;
+        bold.Bold = true;
+        int title = writer.AddCharShape(bold);
+        writer.Open(path);
+        for (int i = 0; i < 200; ++i) {
+            HwpxParagraph paragraph;
+            paragraph.AddText(L"보고서 문단 ", title).AddText(std::to_wstring(i)).AddField(L"f", L"값");
+            writer.AddParagraph(paragraph);
+        }
+        HwpxParagraph holder;
+        holder.AddTable(table);
+        writer.AddParagraph(holder);
+        DoNotOptimize(writer.Close());
+    }
+    std::remove("cpyhwpx_bench.hwpx");
+    state.SetItemsProcessed(201);
+}
+CPYHWPX_BENCHMARK(BM_HwpxWriter_Report_200Paras);
+
+static void ZipSections(State& state, size_t threads)
+{
+    // 4MB 섹션 XML 네 개 + 이미 압축된 그림 (병렬 압축 확장성)
+    const std::string xml = SampleSectionXml(4 * 1024 * 1024);
+    std::string jpeg(512 * 1024, '\0');
+    for (size_t i = 0; i < jpeg.size(); ++i) {
+        jpeg[i] = static_cast<char>((i * 2654435761u) >> 13);
+    }
+    for (auto _ : state) {
+        ZipWriter zip;
+        zip.SetThreads(threads);
+        zip.Open(L"cpyhwpx_bench.zip");
+        for (int i = 0; i < 4; ++i) {
+            zip.AddEntry("Contents/section" + std::to_string(i) + ".xml", xml.data(), xml.size());
+        }
+        zip.AddEntry("BinData/image1.jpg", jpeg.data(), jpeg.size(), ZipWriter::Method::Store);
+        DoNotOptimize(zip.Close());
+    }
+    std::remove("cpyhwpx_bench.zip");
+    state.SetItemsProcessed(static_cast<int64_t>(xml.size() * 4));
+}
+
+static void BM_ZipWriter_16MB_Threads1(State& state)
+{
+    ZipSections(state, 1);
+}
+CPYHWPX_BENCHMARK(BM_ZipWriter_16MB_Threads1);
+
+static void BM_ZipWriter_16MB_ThreadsAll(State& state)
+{
+    ZipSections(state, 0);
+}
+CPYHWPX_BENCHMARK(BM_ZipWriter_16MB_ThreadsAll);
+
+static void BM_HwpxRewrite_OnePart(State& state)
+{
+    // 섹션 하나만 바꾸고 나머지(섹션 3개 + 그림)는 압축된 그대로 복사
+    {
+        HwpxWriter writer;
+        writer.Open(L"cpyhwpx_bench_src.hwpx");
+        for (int s = 0; s < 4; ++s) {
+            writer.BeginSection();
+            for (int i = 0; i < 5000; ++i) {
+                writer.AddText(L"보고서 문단 " + std::to_wstring(i * 7919));
+            }
+        }
+        writer.Close();
+    }
+    std::string section;
+    HwpxWriter::ReadPart(L"cpyhwpx_bench_src.hwpx", "Contents/section0.xml", section);
+    const std::map<std::string, std::string> parts = { { "Contents/section0.xml", section } };
+
+    for (auto _ : state) {
+        DoNotOptimize(HwpxWriter::RewritePackage(L"cpyhwpx_bench_src.hwpx", L"cpyhwpx_bench.hwpx", parts));
+    }
+    std::remove("cpyhwpx_bench_src.hwpx");
+    std::remove("cpyhwpx_bench.hwpx");
+}
+CPYHWPX_BENCHMARK(BM_HwpxRewrite_OnePart);
+
+int main(int argc, char** argv)
+{
+    return RunBenchmarks(argc, argv);
+}
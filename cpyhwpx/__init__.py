@@ -44,6 +44,21 @@ FontPreset = getattr(_native_module, 'FontPreset', None)
 utils = getattr(_native_module, 'utils', None)
 units = getattr(_native_module, 'units', None)
 FontDefs = getattr(_native_module, 'FontDefs', None)
+PrivateInfoScanner = getattr(_native_module, 'PrivateInfoScanner', None)
+PrivateInfoMatch = getattr(_native_module, 'PrivateInfoMatch', None)
+ComCallStat = getattr(_native_module, 'ComCallStat', None)
+BulkEditScope = getattr(_native_module, 'BulkEditScope', None)
+AsyncHwp = getattr(_native_module, 'AsyncHwp', None)
+HwpTimeoutError = getattr(_native_module, 'HwpTimeoutError', None)
+HwpInstancePool = getattr(_native_module, 'HwpInstancePool', None)
+HwpLease = getattr(_native_module, 'HwpLease', None)
+BatchConverter = getattr(_native_module, 'BatchConverter', None)
+BatchConvertResult = getattr(_native_module, 'BatchConvertResult', None)
+HwpxWriter = getattr(_native_module, 'HwpxWriter', None)
+HwpxParagraph = getattr(_native_module, 'HwpxParagraph', None)
+HwpxTable = getattr(_native_module, 'HwpxTable', None)
+Batch = getattr(_native_module, 'Batch', None)
+EditKind = getattr(_native_module, 'EditKind', None)
 
 # 아키텍처 정보
 def get_architecture_info():
@@ -62,5 +77,10 @@ __all__ = [
     'ViewState', 'MoveID', 'CtrlType', 'FileFormat',
     'LineStyle', 'HAlign', 'VAlign',
     'HwpPos', 'CharShape', 'ParaShape', 'FontPreset',
-    'utils', 'units', 'FontDefs'
+    'utils', 'units', 'FontDefs',
+    'PrivateInfoScanner', 'PrivateInfoMatch',
+    'ComCallStat', 'BulkEditScope',
+    'AsyncHwp', 'HwpTimeoutError', 'HwpInstancePool', 'HwpLease',
+    'BatchConverter', 'BatchConvertResult',
+    'HwpxWriter', 'HwpxParagraph', 'HwpxTable', 'Batch', 'EditKind'
 ]
@@ -0,0 +1,261 @@
+/**
+ * @file ActionRecorder.cpp
+ * @brief ActionRecorder 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "ActionRecorder.h"
+#include "Utils.h"
+#include <algorithm>
+
+namespace cpyhwpx {
+
+namespace {
+
+// 이 스레드에서 기록 중인 기록기 (시작 순서, 중지하면 어느 위치에서든 빠짐)
+thread_local std::vector<ActionRecorder*> t_active;
+
+FILE* OpenLog(const std::wstring& path)
+{
+#if defined(_WIN32)
+    return _wfopen(path.c_str(), L"wb");
+#else
+    return fopen(Utils::ToUtf8(path).c_str(), "wb");
+#endif
+}
+
+} // namespace
+
+//=============================================================================
+// 생성자/소멸자
+//=============================================================================
+
+ActionRecorder::ActionRecorder()
+    : m_log(nullptr)
+    , m_depth(0)
+    , m_active(false)
+{
+}
+
+ActionRecorder::~ActionRecorder()
+{
+    Stop();
+    if (m_log) {
+        fclose(m_log);
+        m_log = nullptr;
+    }
+}
+
+//=============================================================================
+// 시작/중지
+//=============================================================================
+
+bool ActionRecorder::Start(const std::wstring& log_path)
+{
+    Stop();
+    m_journal.Clear();
+    m_pendingItems.clear();
+    m_incompleteSets.clear();
+
+    if (m_log) {
+        fclose(m_log);
+        m_log = nullptr;
+    }
+    if (!log_path.empty()) {
+        m_log = OpenLog(log_path);
+        if (!m_log) return false;
+
+        std::string header = HwpBatch::BinaryHeader();
+        fwrite(header.data(), 1, header.size(), m_log);
+        fflush(m_log);
+    }
+
+    t_active.push_back(this);
+    m_depth = 0;
+    m_active = true;
+    return true;
+}
+
+void ActionRecorder::Stop()
+{
+    if (!m_active) return;
+
+    // Start와 같은 스레드에서 중지한다고 가정 (HwpWrapper 스레드 규칙)
+    t_active.erase(std::remove(t_active.begin(), t_active.end(), this), t_active.end());
+    m_pendingItems.clear();
+    m_incompleteSets.clear();
+    m_active = false;
+
+    if (m_log) {
+        fflush(m_log);
+    }
+}
+
+HwpBatch ActionRecorder::TakeJournal()
+{
+    HwpBatch journal = std::move(m_journal);
+    m_journal.Clear();
+    return journal;
+}
+
+void ActionRecorder::NotifySetItem(IDispatch* pset, const std::wstring& name, const VARIANT& value)
+{
+    for (ActionRecorder* recorder : t_active) {
+        recorder->OnSetItem(pset, name, value);
+    }
+}
+
+void ActionRecorder::NotifyResetSet(IDispatch* pset)
+{
+    for (ActionRecorder* recorder : t_active) {
+        recorder->OnResetSet(pset);
+    }
+}
+
+void ActionRecorder::NotifySubSet(IDispatch* pset)
+{
+    for (ActionRecorder* recorder : t_active) {
+        recorder->OnSubSet(pset);
+    }
+}
+
+void ActionRecorder::Flush()
+{
+    if (!m_log || m_journal.empty()) return;
+
+    std::string record;
+    m_journal.AppendRecord(m_journal.size() - 1, record);
+    fwrite(record.data(), 1, record.size(), m_log);
+    fflush(m_log);
+}
+
+//=============================================================================
+// 기록 지점
+//=============================================================================
+
+void ActionRecorder::OnRunAction(const std::wstring& action_name)
+{
+    m_journal.RunAction(action_name);
+    Flush();
+}
+
+void ActionRecorder::OnSetPos(int list, int para, int pos)
+{
+    m_journal.SetPos(list, para, pos);
+    Flush();
+}
+
+void ActionRecorder::OnMovePos(int move_id, int para, int pos)
+{
+    m_journal.MovePos(move_id, para, pos);
+    Flush();
+}
+
+void ActionRecorder::OnInsertText(const std::wstring& text)
+{
+    m_journal.InsertText(text);
+    Flush();
+}
+
+void ActionRecorder::OnPutFieldText(const std::wstring& field, const std::wstring& text)
+{
+    m_journal.PutFieldText(field, text);
+    Flush();
+}
+
+void ActionRecorder::OnMoveToField(const std::wstring& field, int idx,
+                                   bool text, bool start, bool select)
+{
+    m_journal.MoveToField(field, idx, text, start, select);
+    Flush();
+}
+
+void ActionRecorder::OnSetItem(IDispatch* pset, const std::wstring& name, const VARIANT& value)
+{
+    if (!pset) return;
+
+    PendingItem item{ name, VT_EMPTY, 0, 0.0, std::wstring() };
+    switch (value.vt) {
+    case VT_I4:   item.vt = VT_I4; item.i = value.lVal; break;
+    case VT_INT:  item.vt = VT_I4; item.i = value.intVal; break;
+    case VT_I2:   item.vt = VT_I4; item.i = value.iVal; break;
+    case VT_UI4:  item.vt = VT_I4; item.i = static_cast<int>(value.ulVal); break;
+    case VT_R8:   item.vt = VT_R8; item.d = value.dblVal; break;
+    case VT_R4:   item.vt = VT_R8; item.d = value.fltVal; break;
+    case VT_BOOL: item.vt = VT_BOOL; item.i = (value.boolVal != VARIANT_FALSE) ? 1 : 0; break;
+    case VT_BSTR:
+        item.vt = VT_BSTR;
+        if (value.bstrVal) item.s.assign(value.bstrVal, SysStringLen(value.bstrVal));
+        break;
+    default:
+        m_incompleteSets.insert(pset);  // 서브셋/배열 등은 HwpBatch에 담을 수 없음
+        return;
+    }
+
+    // 같은 항목을 다시 쓰면 마지막 값만 남김 (순서는 처음 쓴 위치)
+    std::vector<PendingItem>& items = m_pendingItems[pset];
+    for (PendingItem& existing : items) {
+        if (existing.name == name) {
+            existing = std::move(item);
+            return;
+        }
+    }
+    items.push_back(std::move(item));
+}
+
+void ActionRecorder::OnResetSet(IDispatch* pset)
+{
+    m_pendingItems.erase(pset);
+    m_incompleteSets.erase(pset);
+}
+
+void ActionRecorder::OnSubSet(IDispatch* pset)
+{
+    if (pset) m_incompleteSets.insert(pset);
+}
+
+void ActionRecorder::OnExecute(const std::wstring& action_name,
+                               const std::wstring& set_name, IDispatch* pset)
+{
+    auto it = m_pendingItems.find(pset);
+    if (m_incompleteSets.erase(pset) > 0) {
+        // 일부 항목만으로 재생하면 다른 편집이 되므로 실행하지 않을 자리만 남김
+        if (it != m_pendingItems.end()) m_pendingItems.erase(it);
+        OnUnreplayable(action_name);
+        return;
+    }
+
+    m_journal.ExecuteSet(action_name, set_name);
+    if (it != m_pendingItems.end()) {
+        for (const PendingItem& item : it->second) {
+            switch (item.vt) {
+            case VT_I4:   m_journal.Item(item.name, item.i); break;
+            case VT_R8:   m_journal.Item(item.name, item.d); break;
+            case VT_BOOL: m_journal.Item(item.name, item.i != 0); break;
+            case VT_BSTR: m_journal.Item(item.name, item.s); break;
+            default: break;
+            }
+        }
+        m_pendingItems.erase(it);
+    }
+    Flush();
+}
+
+void ActionRecorder::OnExecuteProps(const std::wstring& action_name, const std::wstring& set_name,
+                                    const std::map<std::wstring, int>& props)
+{
+    m_journal.ExecuteSet(action_name, set_name);
+    for (const auto& prop : props) {
+        m_journal.Item(prop.first, prop.second);
+    }
+    Flush();
+}
+
+void ActionRecorder::OnUnreplayable(const std::wstring& name)
+{
+    m_journal.Skipped(name);
+    Flush();
+}
+
+} // namespace cpyhwpx
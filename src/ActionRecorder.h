@@ -0,0 +1,187 @@
+/**
+ * @file ActionRecorder.h
+ * @brief HwpWrapper 작업 기록기 (재생 가능한 작업 기록 + 비정상 종료 대비 로그)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 기록 중에는 RunAction, 캐럿 이동, 텍스트 입력, 필드 작업, 파라미터셋 액션 실행
+ * (HwpAction::Run/Execute, SetCharShape, SetParaShape)을 HwpBatch 형식으로 모은다.
+ * 기록 결과는 HwpBatch::Execute()로 다른 문서/인스턴스에 그대로 재생할 수 있다.
+ */
+
+#pragma once
+
+#include "HwpBatch.h"
+#include "ComPlatform.h"
+#include <cstdio>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace cpyhwpx {
+
+/**
+ * @class ActionRecorder
+ * @brief HwpWrapper별 작업 기록기
+ *
+ * 기록기는 HwpWrapper가 소유하고, 기록 지점은 그 HwpWrapper의 기록기만 본다.
+ * 같은 스레드의 다른 HwpWrapper 호출은 기록되지 않으며, 기록하지 않을 때의
+ * 비용은 멤버 포인터 확인 한 번이다.
+ *
+ * 파라미터셋 내용은 HParameterSet에 항목 열거 기능이 없으므로
+ * HwpParameterSet::SetItem으로 쓴 값을 세트별로 모아 두었다가 Execute 시점에 붙인다.
+ * HwpParameterSet은 어느 HwpWrapper의 것인지 모르므로 항목 쓰기는 이 스레드에서
+ * 기록 중인 모든 기록기에 알리고, 실행한 HwpWrapper의 기록기만 세트 항목을 붙인다.
+ *
+ * 서브셋/배열 항목을 쓰거나 서브셋을 연 세트는 내용을 다 모을 수 없으므로
+ * 일부 항목만 담은 ExecuteSet 대신 HwpBatch::Skipped로 기록한다.
+ * 원시 IDispatch로 파라미터셋을 채우는 메서드(CellFill, Find 등)도 OnUnreplayable로
+ * Skipped를 남기므로, 재생 결과에서 실패로 보이고 HwpBatch::SkippedCount()로 셀 수 있다.
+ *
+ * 다른 기록 대상 메서드를 안에서 부르는 메서드는 바깥 호출 하나로만 기록된다.
+ */
+class ActionRecorder {
+public:
+    ActionRecorder();
+    ~ActionRecorder();
+
+    ActionRecorder(const ActionRecorder&) = delete;
+    ActionRecorder& operator=(const ActionRecorder&) = delete;
+
+    /**
+     * @brief 기록 시작 (기존 기록 삭제)
+     * @param log_path 비어 있지 않으면 작업마다 이 파일에 이어 쓰고 flush
+     * @return 로그 파일을 열지 못하면 false (기록은 시작하지 않음)
+     */
+    bool Start(const std::wstring& log_path = L"");
+
+    /**
+     * @brief 기록 중지 (기록 내용과 로그 파일은 유지)
+     */
+    void Stop();
+
+    bool IsActive() const { return m_active; }
+
+    const HwpBatch& GetJournal() const { return m_journal; }
+
+    /**
+     * @brief 기록 내용을 꺼내고 비움
+     */
+    HwpBatch TakeJournal();
+
+    /**
+     * @brief 이 스레드에서 기록 중인 모든 기록기에 파라미터셋 항목 쓰기 알림
+     */
+    static void NotifySetItem(IDispatch* pset, const std::wstring& name, const VARIANT& value);
+
+    /**
+     * @brief 이 스레드에서 기록 중인 모든 기록기에 파라미터셋 초기화 알림
+     */
+    static void NotifyResetSet(IDispatch* pset);
+
+    /**
+     * @brief 이 스레드에서 기록 중인 모든 기록기에 서브셋 접근 알림
+     */
+    static void NotifySubSet(IDispatch* pset);
+
+    //=========================================================================
+    // 기록 지점
+    //=========================================================================
+
+    /**
+     * @class Scope
+     * @brief 기록 대상 메서드 범위 (중첩된 안쪽 호출은 기록하지 않음)
+     *
+     * 이 범위 안에서 Record()가 처음 호출될 때만 기록한다.
+     */
+    class Scope {
+    public:
+        /**
+         * @param recorder 호출한 HwpWrapper의 기록기 (없거나 중지됐으면 기록 안 함)
+         */
+        explicit Scope(ActionRecorder* recorder)
+            : m_recorder(recorder && recorder->m_active ? recorder : nullptr)
+        {
+            if (m_recorder) m_outer = (m_recorder->m_depth++ == 0);
+        }
+        ~Scope()
+        {
+            if (m_recorder) m_recorder->m_depth--;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        /**
+         * @brief 바깥 호출이면 기록기, 아니면 nullptr
+         */
+        ActionRecorder* Record() const { return m_outer ? m_recorder : nullptr; }
+
+    private:
+        ActionRecorder* m_recorder;
+        bool m_outer = false;
+    };
+
+    void OnRunAction(const std::wstring& action_name);
+    void OnSetPos(int list, int para, int pos);
+    void OnMovePos(int move_id, int para, int pos);
+    void OnInsertText(const std::wstring& text);
+    void OnPutFieldText(const std::wstring& field, const std::wstring& text);
+    void OnMoveToField(const std::wstring& field, int idx, bool text, bool start, bool select);
+
+    /**
+     * @brief 파라미터셋 항목 쓰기 (세트별로 모아 둠, 중첩 여부와 무관)
+     */
+    void OnSetItem(IDispatch* pset, const std::wstring& name, const VARIANT& value);
+
+    /**
+     * @brief 파라미터셋 초기화 (Clear, 풀 재사용) - 모아 둔 항목 버림
+     */
+    void OnResetSet(IDispatch* pset);
+
+    /**
+     * @brief 서브셋 생성/접근 (CreateItemSet, GetItemSet) - 세트를 재생 불가로 표시
+     */
+    void OnSubSet(IDispatch* pset);
+
+    /**
+     * @brief 파라미터셋 액션 실행 (모아 둔 pset 항목을 붙여 기록)
+     */
+    void OnExecute(const std::wstring& action_name, const std::wstring& set_name, IDispatch* pset);
+
+    /**
+     * @brief 정수 속성 맵으로 파라미터셋 액션 실행 (SetCharShape 등)
+     */
+    void OnExecuteProps(const std::wstring& action_name, const std::wstring& set_name,
+                        const std::map<std::wstring, int>& props);
+
+    /**
+     * @brief 기록기가 내용을 볼 수 없는 작업 (Skipped로 기록)
+     * @param name 액션 또는 메서드 이름
+     */
+    void OnUnreplayable(const std::wstring& name);
+
+private:
+    struct PendingItem {
+        std::wstring name;
+        VARTYPE vt;
+        int i;
+        double d;
+        std::wstring s;
+    };
+
+    /**
+     * @brief 마지막으로 추가한 작업을 로그 파일에 이어 쓰기
+     */
+    void Flush();
+
+    HwpBatch m_journal;
+    std::unordered_map<IDispatch*, std::vector<PendingItem>> m_pendingItems;
+    std::unordered_set<IDispatch*> m_incompleteSets;   // 모으지 못한 항목이 있는 세트
+    FILE* m_log;
+    int m_depth;
+    bool m_active;
+};
+
+} // namespace cpyhwpx
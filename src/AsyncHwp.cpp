@@ -0,0 +1,468 @@
+/**
+ * @file AsyncHwp.cpp
+ * @brief AsyncHwp 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "AsyncHwp.h"
+#include "HwpWrapper.h"
+#include "ComPlatform.h"
+
+#if defined(_WIN32)
+#include <ole2.h>
+#else
+#endif
+
+namespace cpyhwpx {
+
+//=============================================================================
+// 실행 스레드 깨우기
+//=============================================================================
+
+/**
+ * @brief 실행 스레드 대기/깨우기
+ *
+ * 생산자는 실행 스레드가 잠든 경우(sleeping)에만 Notify()를 부르므로
+ * 큐가 계속 차 있는 동안에는 커널 호출이 없다.
+ * Windows에서는 STA 규칙에 따라 대기 중에도 창 메시지를 처리한다.
+ */
+struct AsyncHwp::Signal {
+    std::atomic<bool> sleeping{false};
+
+#if defined(_WIN32)
+    HANDLE event;
+
+    Signal() : event(CreateEventW(NULL, FALSE, FALSE, NULL)) {}
+    ~Signal() { if (event) CloseHandle(event); }
+
+    void Notify() { SetEvent(event); }
+
+    void Wait()
+    {
+        MsgWaitForMultipleObjectsEx(1, &event, INFINITE, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+
+        MSG msg;
+        while (PeekMessageW(&msg, NULL, 0, 0, PM_REMOVE)) {
+            TranslateMessage(&msg);
+            DispatchMessageW(&msg);
+        }
+    }
+#else
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool notified = false;
+
+    void Notify()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            notified = true;
+        }
+        cv.notify_one();
+    }
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return notified; });
+        notified = false;
+    }
+#endif
+};
+
+/**
+ * @brief Post()용 노드 (결과 없음, 예외 무시)
+ */
+struct AsyncHwp::PostCommand : AsyncHwp::Command {
+    explicit PostCommand(std::function<void(HwpWrapper&)> f) : fn(std::move(f)) {}
+
+    void Run(HwpWrapper& hwp) override
+    {
+        try {
+            fn(hwp);
+        } catch (...) {
+        }
+        Settle();
+    }
+
+    void Expire() override
+    {
+        if (onTimeout) {
+            try {
+                onTimeout();
+            } catch (...) {
+            }
+        }
+    }
+
+    std::function<void(HwpWrapper&)> fn;
+    std::function<void()> onTimeout;
+};
+
+/**
+ * @brief 실행 스레드에서 작업이 AsyncHwp를 해제했는지 (소멸자가 설정)
+ */
+static thread_local bool t_ownerDestroyed = false;
+
+/**
+ * @brief 기본 시간 초과 처리: 호출 취소 후 (직접 띄운 경우) 한/글 종료
+ */
+static void CancelAndKill(uint32_t thread_id, uint32_t process_id, bool kill)
+{
+#if defined(_WIN32)
+    // 실행 스레드에서 CoEnableCallCancellation()을 불러 두었으므로 나가는 호출이 취소된다
+    if (thread_id != 0) {
+        CoCancelCall(thread_id, 0);
+    }
+    // 모달 대화상자에 걸린 한/글은 다시 쓸 수 없으므로 취소 여부와 관계없이 종료
+    if (kill && process_id != 0) {
+        HANDLE process = OpenProcess(PROCESS_TERMINATE, FALSE, process_id);
+        if (process) {
+            TerminateProcess(process, 1);
+            CloseHandle(process);
+        }
+    }
+#else
+    (void)thread_id;
+    (void)process_id;
+    (void)kill;
+#endif
+}
+
+//=============================================================================
+// 생성자/소멸자
+//=============================================================================
+
+AsyncHwp::AsyncHwp(bool visible, bool new_instance, bool register_module)
+    : AsyncHwp(visible, new_instance, register_module, SetupFunc())
+{
+}
+
+AsyncHwp::AsyncHwp(bool visible, bool new_instance, bool register_module, SetupFunc setup)
+    : m_head(&m_stub)
+    , m_tail(&m_stub)
+    , m_signal(std::make_unique<Signal>())
+    , m_killOnHang(new_instance)
+    , m_ready(m_readyPromise.get_future().share())
+{
+    m_thread = std::thread(&AsyncHwp::ThreadMain, this,
+                           visible, new_instance, register_module, std::move(setup));
+}
+
+AsyncHwp::~AsyncHwp()
+{
+    if (m_thread.joinable() && m_thread.get_id() == std::this_thread::get_id()) {
+        // 작업이 마지막 참조를 놓았다: 자기 자신은 join할 수 없으므로 남은 작업을 버리고 분리
+        m_accepting.store(false);
+        m_stopRequested.store(true);
+        while (m_pending.load() > 1) {      // 1 = 지금 실행 중인 작업
+            if (Command* cmd = Dequeue()) {
+                delete cmd;
+                m_pending.fetch_sub(1);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        StopWatchdog();
+        m_thread.detach();
+        t_ownerDestroyed = true;
+        return;
+    }
+    Shutdown();
+}
+
+//=============================================================================
+// 큐
+//=============================================================================
+
+void AsyncHwp::Enqueue(Command* cmd)
+{
+    // 먼저 세어 두면 실행 스레드가 이 작업을 끝내기 전에는 종료하지 않는다
+    m_pending.fetch_add(1);
+    if (!m_accepting.load()) {
+        m_pending.fetch_sub(1);
+        delete cmd;                     // future는 broken_promise
+        return;
+    }
+
+    cmd->next.store(nullptr, std::memory_order_relaxed);
+    Command* prev = m_head.exchange(cmd, std::memory_order_acq_rel);
+    prev->next.store(cmd, std::memory_order_release);
+
+    if (m_signal->sleeping.load()) {
+        m_signal->Notify();
+    }
+}
+
+AsyncHwp::Command* AsyncHwp::Dequeue()
+{
+    Command* tail = m_tail;
+    Command* next = tail->next.load(std::memory_order_acquire);
+
+    if (tail == &m_stub) {
+        if (!next) return nullptr;
+        m_tail = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if (next) {
+        m_tail = next;
+        return tail;
+    }
+
+    // 마지막 노드: 생산자가 연결 중이면 다음 기회에
+    if (tail != m_head.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    // stub을 뒤에 붙여 마지막 노드를 떼어낸다
+    m_stub.next.store(nullptr, std::memory_order_relaxed);
+    Command* prev = m_head.exchange(&m_stub, std::memory_order_acq_rel);
+    prev->next.store(&m_stub, std::memory_order_release);
+
+    next = tail->next.load(std::memory_order_acquire);
+    if (next) {
+        m_tail = next;
+        return tail;
+    }
+    return nullptr;
+}
+
+void AsyncHwp::DrainDiscard()
+{
+    while (Command* cmd = Dequeue()) {
+        delete cmd;
+        m_pending.fetch_sub(1);
+    }
+}
+
+void AsyncHwp::Post(std::function<void(HwpWrapper&)> fn)
+{
+    Enqueue(new PostCommand(std::move(fn)));
+}
+
+void AsyncHwp::Post(std::function<void(HwpWrapper&)> fn, std::chrono::milliseconds timeout)
+{
+    Command* cmd = new PostCommand(std::move(fn));
+    cmd->timeoutMs = timeout.count();
+    Enqueue(cmd);
+}
+
+void AsyncHwp::Post(std::function<void(HwpWrapper&)> fn, std::chrono::milliseconds timeout,
+                    std::function<void()> on_timeout)
+{
+    PostCommand* cmd = new PostCommand(std::move(fn));
+    cmd->timeoutMs = timeout.count() >= 0 ? timeout.count() : kDefaultTimeout;
+    cmd->onTimeout = std::move(on_timeout);
+    Enqueue(cmd);
+}
+
+std::future<std::vector<bool>> AsyncHwp::SubmitBatch(HwpBatch batch, bool stop_on_error)
+{
+    return Submit([batch = std::move(batch), stop_on_error](HwpWrapper& hwp) {
+        return batch.Execute(hwp, stop_on_error);
+    });
+}
+
+//=============================================================================
+// 실행 스레드
+//=============================================================================
+
+void AsyncHwp::ThreadMain(bool visible, bool new_instance, bool register_module, SetupFunc setup)
+{
+#if defined(_WIN32)
+    HRESULT hrCo = CoInitializeEx(NULL, COINIT_APARTMENTTHREADED);
+    CoEnableCallCancellation(NULL);
+    m_threadNativeId.store(GetCurrentThreadId());
+#endif
+
+    {
+        // 시간 초과 후 교체할 수 있도록 힙에 둔다
+        std::unique_ptr<HwpWrapper> hwp;
+        auto start = [&]() {
+            hwp = std::make_unique<HwpWrapper>(visible, new_instance, register_module);
+            bool ok = false;
+            try {
+                ok = setup ? setup(*hwp) : hwp->Initialize();
+            } catch (...) {
+                ok = false;
+            }
+            m_processId.store(ok ? hwp->GetProcessId() : 0);
+            m_healthy.store(ok, std::memory_order_release);
+            return ok;
+        };
+
+        m_readyPromise.set_value(start());
+
+        for (;;) {
+            if (Command* cmd = Dequeue()) {
+                bool watched = BeginWatch(cmd);
+                cmd->Run(*hwp);
+                bool hung = !t_ownerDestroyed && watched && EndWatch(cmd);
+                delete cmd;
+                if (t_ownerDestroyed) {
+                    // 작업이 AsyncHwp를 해제했다 (스레드는 분리됨): 멤버는 더 만지지 않는다
+                    break;
+                }
+                if (hung) {
+                    // 멈췄던 인스턴스는 버리고 새로 띄움 (대기 중인 작업은 새 인스턴스에서 실행)
+                    hwp.reset();
+                    start();
+                    m_recoveries.fetch_add(1, std::memory_order_relaxed);
+                }
+                m_pending.fetch_sub(1, std::memory_order_release);
+                continue;
+            }
+
+            if (m_pending.load() > 0) {
+                // 생산자가 노드를 연결하는 중
+                std::this_thread::yield();
+                continue;
+            }
+
+            if (m_stopRequested.load()) {
+                break;
+            }
+
+            m_signal->sleeping.store(true);
+            if (m_pending.load() == 0 && !m_stopRequested.load()) {
+                m_signal->Wait();
+            }
+            m_signal->sleeping.store(false);
+        }
+    }   // HwpWrapper는 이 스레드에서 해제
+
+#if defined(_WIN32)
+    if (SUCCEEDED(hrCo)) {
+        CoUninitialize();
+    }
+#endif
+}
+
+void AsyncHwp::Shutdown()
+{
+    m_accepting.store(false);
+    m_stopRequested.store(true);
+    m_signal->Notify();
+
+    if (!m_thread.joinable() || m_thread.get_id() == std::this_thread::get_id()) {
+        return;
+    }
+
+    m_thread.join();
+    DrainDiscard();
+    StopWatchdog();
+}
+
+//=============================================================================
+// 워치독
+//=============================================================================
+
+void AsyncHwp::SetCallTimeout(std::chrono::milliseconds timeout)
+{
+    m_callTimeoutMs.store(timeout.count() > 0 ? timeout.count() : 0, std::memory_order_relaxed);
+}
+
+void AsyncHwp::SetHangHandler(HangHandler handler)
+{
+    std::lock_guard<std::mutex> lock(m_watchMutex);
+    m_hangHandler = std::move(handler);
+}
+
+bool AsyncHwp::IsCallTimedOut() const
+{
+    return m_running && m_running->timedOut.load();
+}
+
+bool AsyncHwp::BeginWatch(Command* cmd)
+{
+    int64_t timeout = cmd->timeoutMs >= 0 ? cmd->timeoutMs
+                                          : m_callTimeoutMs.load(std::memory_order_relaxed);
+    if (timeout <= 0) return false;
+
+    std::lock_guard<std::mutex> lock(m_watchMutex);
+    if (!m_watchdog.joinable() && !m_watchStop) {
+        m_watchdog = std::thread(&AsyncHwp::WatchdogMain, this);
+    }
+    m_running = cmd;
+    m_deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+    // 이전 마감 시각을 기다리는 중이면 깨우지 않는다 (깨어나서 새 마감 시각으로 다시 대기)
+    if (m_watchIdle) {
+        m_watchCv.notify_one();
+    }
+    return true;
+}
+
+bool AsyncHwp::EndWatch(Command* cmd)
+{
+    std::unique_lock<std::mutex> lock(m_watchMutex);
+    // Expire()가 끝나기 전에 작업을 지우지 않도록
+    m_expireCv.wait(lock, [this] { return !m_expiring; });
+    m_running = nullptr;
+    return cmd->timedOut.load();
+}
+
+void AsyncHwp::StopWatchdog()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_watchMutex);
+        m_watchStop = true;
+    }
+    m_watchCv.notify_one();
+    if (m_watchdog.joinable() && m_watchdog.get_id() != std::this_thread::get_id()) {
+        m_watchdog.join();
+    }
+}
+
+void AsyncHwp::WatchdogMain()
+{
+    std::unique_lock<std::mutex> lock(m_watchMutex);
+    while (!m_watchStop) {
+        // 이미 결과가 확정된 작업은 감시할 필요 없음 (EndWatch/다음 BeginWatch까지 대기)
+        if (!m_running || m_running->settled.load()) {
+            m_watchIdle = true;
+            m_watchCv.wait(lock);
+            m_watchIdle = false;
+            continue;
+        }
+        if (std::chrono::steady_clock::now() < m_deadline) {
+            m_watchCv.wait_until(lock, m_deadline);
+            continue;
+        }
+
+        // 작업이 마감 직전에 끝나 먼저 확정했으면 시간 초과가 아님
+        Command* expired = m_running;
+        if (!expired->Settle()) continue;
+
+        // 실행 스레드는 m_expiring이 풀려야 m_running을 지우므로 작업은 아직 살아 있다
+        expired->timedOut.store(true);
+        m_timeouts.fetch_add(1, std::memory_order_relaxed);
+        HangHandler handler = m_hangHandler;
+        uint32_t threadId = m_threadNativeId.load();
+        uint32_t processId = m_processId.load();
+        m_expiring = true;
+
+        // 기다리는 쪽을 먼저 풀고 (한/글을 종료하지 않는 경우에도) 멈춘 호출 처리.
+        // m_expiring을 풀기 전에 처리해야 실행 스레드가 새 인스턴스를 띄운 뒤
+        // 그 초기화 호출을 취소하거나 새 프로세스를 종료하는 일이 없다
+        lock.unlock();
+        expired->Expire();
+        if (handler) {
+            handler();
+        } else {
+            OnHang(threadId, processId);
+        }
+        lock.lock();
+        m_expiring = false;
+        m_expireCv.notify_all();
+    }
+}
+
+void AsyncHwp::OnHang(uint32_t thread_id, uint32_t process_id)
+{
+    CancelAndKill(thread_id, process_id, m_killOnHang);
+}
+
+} // namespace cpyhwpx
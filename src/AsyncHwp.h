@@ -0,0 +1,358 @@
+/**
+ * @file AsyncHwp.h
+ * @brief 전용 STA 실행 스레드 위의 비동기 HwpWrapper
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * HwpWrapper는 만든 스레드에서만 써야 하고 모든 호출이 호출자를 막는다.
+ * AsyncHwp는 HwpWrapper를 자기 실행 스레드에서 만들고, 작업을 잠금 없는
+ * MPSC 큐로 받아 순서대로 실행한 뒤 std::future로 결과를 돌려준다.
+ * 호출자는 결과를 기다리지 않고 여러 작업을 연달아 넣을 수 있다.
+ * 작업마다 제한 시간을 줄 수 있으며, 워치독 스레드가 넘긴 작업을 찾아
+ * 호출을 취소하고 한/글을 종료한 뒤 실행 스레드에서 새 인스턴스로 교체한다.
+ */
+
+#pragma once
+
+#include "HwpBatch.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cpyhwpx {
+
+class HwpWrapper;
+
+/**
+ * @brief 작업이 제한 시간을 넘겨 취소된 경우 future로 전달되는 예외
+ */
+class HwpTimeoutError : public std::runtime_error {
+public:
+    HwpTimeoutError() : std::runtime_error("HWP call timed out") {}
+};
+
+/**
+ * @class AsyncHwp
+ * @brief HwpWrapper 하나를 소유하는 단일 실행 스레드
+ *
+ * - 실행 스레드는 STA로 COM을 초기화하고 그 안에서 HwpWrapper를 만든다
+ * - Submit()은 어느 스레드에서나 호출할 수 있고 곧바로 반환한다
+ * - 작업은 제출 순서대로 하나씩 실행된다
+ * - 작업이 던진 예외는 해당 future로 전달된다
+ * - Shutdown() 뒤에 제출한 작업은 실행되지 않는다 (future는 broken_promise)
+ * - 제한 시간을 넘긴 작업의 future는 마감 시각에 바로 HwpTimeoutError를 받는다
+ *   (호출이 아직 멈춰 있어도). 그 작업이 끝나면 HwpWrapper를 새로 만들어 다시
+ *   초기화한다 (이후 작업은 새 인스턴스에서 실행)
+ * - 마감 시각 직전에 끝난 작업은 결과를 먼저 확정한 쪽(작업 또는 워치독)을 따르며,
+ *   작업이 먼저 확정했으면 시간 초과로 보지 않는다
+ *
+ * 작업에 넘어오는 HwpWrapper&는 실행 스레드 밖으로 가지고 나가면 안 된다.
+ */
+class AsyncHwp {
+public:
+    /**
+     * @brief 실행 스레드에서 HwpWrapper를 만든 직후 호출되는 준비 함수
+     * @return 준비 성공 여부 (Ready()로 전달됨)
+     */
+    using SetupFunc = std::function<bool(HwpWrapper&)>;
+
+    /**
+     * @brief 작업이 제한 시간을 넘겼을 때 워치독 스레드에서 호출되는 함수
+     *
+     * 멈춘 호출을 풀어 주어야 한다. 기본 동작은 CoCancelCall로 호출을 취소하고
+     * 새로 띄운 한/글(new_instance)이면 프로세스를 종료한다.
+     */
+    using HangHandler = std::function<void()>;
+
+    /**
+     * @brief 실행 스레드 시작 후 HwpWrapper::Initialize() 호출
+     * @param visible 창 표시 여부
+     * @param new_instance 새 인스턴스 생성 여부
+     * @param register_module 보안 모듈 자동 등록 여부
+     */
+    AsyncHwp(bool visible = true,
+             bool new_instance = true,
+             bool register_module = true);
+
+    /**
+     * @brief 실행 스레드 시작 후 Initialize() 대신 setup 호출
+     *
+     * 가짜 HwpObject를 Attach()하는 테스트/벤치마크용.
+     */
+    AsyncHwp(bool visible, bool new_instance, bool register_module, SetupFunc setup);
+
+    /**
+     * @brief 남은 작업을 모두 실행한 뒤 스레드 종료
+     *
+     * 실행 스레드의 작업 안에서 해제되면 (마지막 shared_ptr을 작업이 놓은 경우)
+     * 대기 중인 작업은 버리고 (future는 broken_promise) 스레드를 분리한다.
+     * 스레드는 현재 작업이 끝나면 HwpWrapper를 해제하고 종료한다.
+     * 시간 초과 처리기(SetHangHandler) 안에서 해제해서는 안 된다.
+     */
+    ~AsyncHwp();
+
+    AsyncHwp(const AsyncHwp&) = delete;
+    AsyncHwp& operator=(const AsyncHwp&) = delete;
+
+    //=========================================================================
+    // 작업 제출
+    //=========================================================================
+
+    /**
+     * @brief 작업 제출
+     * @param fn HwpWrapper&를 받는 호출 가능 객체
+     * @return fn 반환값의 future
+     */
+    template <typename F>
+    auto Submit(F&& fn) -> std::future<std::invoke_result_t<std::decay_t<F>&, HwpWrapper&>>
+    {
+        return SubmitWithTimeout(std::forward<F>(fn), kDefaultTimeout);
+    }
+
+    /**
+     * @brief 제한 시간을 지정해 작업 제출
+     * @param timeout 실행 시작부터의 제한 시간 (0이면 제한 없음)
+     */
+    template <typename F>
+    auto Submit(F&& fn, std::chrono::milliseconds timeout)
+        -> std::future<std::invoke_result_t<std::decay_t<F>&, HwpWrapper&>>
+    {
+        return SubmitWithTimeout(std::forward<F>(fn), timeout.count());
+    }
+
+    /**
+     * @brief 결과가 필요 없는 작업 제출 (promise 할당 없음)
+     *
+     * 예외는 버려진다.
+     */
+    void Post(std::function<void(HwpWrapper&)> fn);
+    void Post(std::function<void(HwpWrapper&)> fn, std::chrono::milliseconds timeout);
+
+    /**
+     * @brief 제한 시간을 넘기면 워치독 스레드에서 on_timeout을 부르는 작업 제출
+     *
+     * on_timeout은 작업이 아직 멈춰 있어도 마감 시각에 한 번 불린다 (결과를 직접
+     * 전달하는 작업이 기다리는 쪽을 풀어 주는 용도). 작업이 먼저 끝나면 불리지 않는다.
+     * @param timeout 음수면 SetCallTimeout() 값
+     */
+    void Post(std::function<void(HwpWrapper&)> fn, std::chrono::milliseconds timeout,
+              std::function<void()> on_timeout);
+
+    /**
+     * @brief 작업 묶음 제출 (실행 스레드 왕복 1회)
+     * @return 작업별 성공 여부의 future
+     */
+    std::future<std::vector<bool>> SubmitBatch(HwpBatch batch, bool stop_on_error = false);
+
+    //=========================================================================
+    // 상태
+    //=========================================================================
+
+    /**
+     * @brief 초기화(Initialize 또는 setup) 결과
+     */
+    std::shared_future<bool> Ready() const { return m_ready; }
+
+    /**
+     * @brief 큐에 들어 있거나 실행 중인 작업 수
+     */
+    size_t GetPendingCount() const { return m_pending.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 작업을 받는 중인지 여부
+     */
+    bool IsRunning() const { return m_accepting.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 실행 스레드 ID
+     */
+    std::thread::id GetThreadId() const { return m_thread.get_id(); }
+
+    //=========================================================================
+    // 워치독
+    //=========================================================================
+
+    /**
+     * @brief 제한 시간을 지정하지 않은 작업의 기본 제한 시간 (0이면 제한 없음, 기본값)
+     */
+    void SetCallTimeout(std::chrono::milliseconds timeout);
+    std::chrono::milliseconds GetCallTimeout() const
+    {
+        return std::chrono::milliseconds(m_callTimeoutMs.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief 제한 시간 초과 시 동작 교체 (빈 함수면 기본 동작)
+     *
+     * 처리기가 끝날 때까지 실행 스레드는 멈춘 호출에서 돌아와도 다음으로 넘어가지 않는다
+     * (처리기 안에서 이 AsyncHwp의 작업 결과를 기다리면 안 됨).
+     */
+    void SetHangHandler(HangHandler handler);
+
+    /**
+     * @brief 지금 실행 중인 작업이 제한 시간을 넘겼는지 (실행 스레드의 작업 안에서만 호출)
+     *
+     * Post()한 작업이 결과를 직접 전달하는 경우 시간 초과를 알리는 데 쓴다.
+     */
+    bool IsCallTimedOut() const;
+
+    /**
+     * @brief 마지막 초기화(처음 또는 교체 후) 성공 여부
+     */
+    bool IsHealthy() const { return m_healthy.load(std::memory_order_acquire); }
+
+    uint64_t GetTimeoutCount() const { return m_timeouts.load(std::memory_order_relaxed); }
+    uint64_t GetRecoveryCount() const { return m_recoveries.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 새 작업을 막고, 이미 받은 작업을 모두 실행한 뒤 스레드 종료
+     *
+     * HwpWrapper는 실행 스레드에서 해제된다 (한/글 종료는 하지 않음).
+     * 실행 스레드 안의 작업에서 호출하면 종료 요청만 하고 바로 반환한다
+     * (이미 받은 작업은 그대로 실행되고, 스레드는 소멸자에서 join된다).
+     */
+    void Shutdown();
+
+private:
+    //=========================================================================
+    // 큐 노드
+    //=========================================================================
+
+    static constexpr int64_t kDefaultTimeout = -1;     // SetCallTimeout() 값 사용
+
+    struct Command {
+        std::atomic<Command*> next{nullptr};
+        int64_t timeoutMs = kDefaultTimeout;
+        std::atomic<bool> timedOut{false};              // 워치독이 설정
+        std::atomic<bool> settled{false};               // 결과 확정 (작업 또는 워치독)
+        virtual ~Command() = default;
+
+        /**
+         * @brief 실행 (끝나면 Settle()로 결과 확정을 시도해야 함)
+         */
+        virtual void Run(HwpWrapper& hwp) = 0;
+
+        /**
+         * @brief 워치독이 결과를 확정했을 때 시간 초과 전달 (워치독 스레드)
+         */
+        virtual void Expire() {}
+
+        /**
+         * @brief 결과 확정 (먼저 부른 쪽만 true)
+         */
+        bool Settle() { return !settled.exchange(true); }
+    };
+
+    template <typename R, typename F>
+    struct TaskCommand : Command {
+        explicit TaskCommand(F&& f) : fn(std::move(f)) {}
+        explicit TaskCommand(const F& f) : fn(f) {}
+
+        void Run(HwpWrapper& hwp) override
+        {
+            // 워치독이 먼저 확정했으면 멈췄던 호출의 결과(취소/연결 끊김)는 버림
+            try {
+                if constexpr (std::is_void_v<R>) {
+                    fn(hwp);
+                    if (Settle()) promise.set_value();
+                } else {
+                    R result = fn(hwp);
+                    if (Settle()) promise.set_value(std::forward<R>(result));
+                }
+            } catch (...) {
+                if (Settle()) promise.set_exception(std::current_exception());
+            }
+        }
+
+        void Expire() override
+        {
+            promise.set_exception(std::make_exception_ptr(HwpTimeoutError()));
+        }
+
+        F fn;
+        std::promise<R> promise;
+    };
+
+    struct PostCommand;
+    struct Signal;
+
+    template <typename F>
+    auto SubmitWithTimeout(F&& fn, int64_t timeout_ms)
+        -> std::future<std::invoke_result_t<std::decay_t<F>&, HwpWrapper&>>
+    {
+        using R = std::invoke_result_t<std::decay_t<F>&, HwpWrapper&>;
+        auto* cmd = new TaskCommand<R, std::decay_t<F>>(std::forward<F>(fn));
+        cmd->timeoutMs = timeout_ms;
+        std::future<R> future = cmd->promise.get_future();
+        Enqueue(cmd);
+        return future;
+    }
+
+    void Enqueue(Command* cmd);
+    Command* Dequeue();
+    void DrainDiscard();
+    void ThreadMain(bool visible, bool new_instance, bool register_module, SetupFunc setup);
+
+    /**
+     * @brief 실행 직전 감시 등록 (제한 시간이 없으면 false, 워치독 잠금 사용)
+     */
+    bool BeginWatch(Command* cmd);
+
+    /**
+     * @brief 실행 직후 감시 해제 (워치독이 Expire()/시간 초과 처리 중이면 끝날 때까지 대기)
+     * @return 작업이 제한 시간을 넘겼으면 true
+     */
+    bool EndWatch(Command* cmd);
+
+    void StopWatchdog();
+    void WatchdogMain();
+    void OnHang(uint32_t thread_id, uint32_t process_id);
+
+    // Vyukov MPSC: 생산자는 m_head를 교환하고, 소비자(실행 스레드)만 m_tail을 만진다
+    std::atomic<Command*> m_head;
+    Command* m_tail;
+    struct StubCommand : Command {
+        void Run(HwpWrapper&) override {}
+    } m_stub;
+
+    std::atomic<size_t> m_pending{0};
+    std::atomic<bool> m_accepting{true};
+    std::atomic<bool> m_stopRequested{false};
+    std::unique_ptr<Signal> m_signal;
+
+    // 워치독 (m_watchMutex 보호, m_running은 실행 스레드만 씀)
+    std::atomic<int64_t> m_callTimeoutMs{0};
+    std::mutex m_watchMutex;
+    std::condition_variable m_watchCv;
+    std::thread m_watchdog;
+    bool m_watchStop = false;
+    bool m_watchIdle = false;           // 감시할 작업이 없어 무기한 대기 중
+    bool m_expiring = false;            // 워치독이 잠금 밖에서 Expire()/시간 초과 처리 중
+    std::condition_variable m_expireCv;
+    Command* m_running = nullptr;
+    std::chrono::steady_clock::time_point m_deadline;
+    HangHandler m_hangHandler;
+    bool m_killOnHang = false;
+    std::atomic<uint32_t> m_threadNativeId{0};
+    std::atomic<uint32_t> m_processId{0};
+    std::atomic<bool> m_healthy{false};
+    std::atomic<uint64_t> m_timeouts{0};
+    std::atomic<uint64_t> m_recoveries{0};
+
+    std::promise<bool> m_readyPromise;
+    std::shared_future<bool> m_ready;
+    std::thread m_thread;
+};
+
+} // namespace cpyhwpx
@@ -0,0 +1,606 @@
+/**
+ * @file BatchConverter.cpp
+ * @brief BatchConverter 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "BatchConverter.h"
+#include "HwpWrapper.h"
+#include "Platform.h"
+#include "Utils.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace cpyhwpx {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// 인스턴스마다 실행 큐에 미리 넣어 두는 파일 수
+constexpr size_t kInFlightPerWorker = 2;
+
+double ElapsedMs(Clock::time_point from, Clock::time_point to)
+{
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+FILE* OpenManifest(const std::wstring& path, bool write)
+{
+#if defined(_WIN32)
+    return _wfopen(path.c_str(), write ? L"wb" : L"rb");
+#else
+    return fopen(Utils::ToUtf8(path).c_str(), write ? "wb" : "rb");
+#endif
+}
+
+/**
+ * @brief 결과 한 줄 기록 (중간에 멈춰도 끝난 파일은 남도록 줄마다 flush)
+ */
+void WriteManifestLine(FILE* file, const BatchConvertResult& result)
+{
+    std::string line = "{\"input\":";
+    Utils::AppendJsonString(line, result.input);
+    line += ",\"output\":";
+    Utils::AppendJsonString(line, result.output);
+    line += ",\"status\":\"";
+    line += ConvertStatusName(result.status);
+
+    char buf[192];
+    snprintf(buf, sizeof(buf), "\",\"attempts\":%d,\"open_ms\":%.3f,\"save_ms\":%.3f,\"total_ms\":%.3f"
+             ",\"input_size\":%llu,\"output_size\":%llu",
+             result.attempts, result.open_ms, result.save_ms, result.total_ms,
+             static_cast<unsigned long long>(result.input_size),
+             static_cast<unsigned long long>(result.output_size));
+    line += buf;
+    line += ",\"error\":";
+    Utils::AppendJsonString(line, result.error);
+    line += "}\n";
+
+    fwrite(line.data(), 1, line.size(), file);
+    fflush(file);
+}
+
+/**
+ * @brief WriteManifestLine이 쓴 "key":"..." 값 (이스케이프 해제)
+ */
+bool FindJsonString(const std::string& line, const char* key, std::wstring& out)
+{
+    std::string marker = std::string("\"") + key + "\":\"";
+    size_t pos = line.find(marker);
+    if (pos == std::string::npos) return false;
+
+    std::string value;
+    for (pos += marker.size(); pos < line.size(); ++pos) {
+        char c = line[pos];
+        if (c == '"') {
+            out = Utils::FromUtf8(value);
+            return true;
+        }
+        if (c != '\\') {
+            value += c;
+        } else if (pos + 1 < line.size() && line[pos + 1] == 'u') {
+            if (pos + 5 >= line.size()) return false;
+            value += static_cast<char>(strtoul(line.substr(pos + 2, 4).c_str(), nullptr, 16));
+            pos += 5;
+        } else if (pos + 1 < line.size()) {
+            value += line[++pos];
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief WriteManifestLine이 쓴 "key":숫자 값
+ */
+bool FindJsonNumber(const std::string& line, const char* key, uint64_t& out)
+{
+    std::string marker = std::string("\"") + key + "\":";
+    size_t pos = line.find(marker);
+    if (pos == std::string::npos) return false;
+    const char* begin = line.c_str() + pos + marker.size();
+    char* end = nullptr;
+    out = strtoull(begin, &end, 10);
+    return end != begin;
+}
+
+bool IsSeparator(wchar_t ch)
+{
+    return ch == L'\\' || ch == L'/';
+}
+
+/**
+ * @brief input이 root 아래에 있으면 그 사이의 디렉터리 ("a/b"), 아니면 빈 문자열
+ */
+std::wstring RelativeDirectory(const std::wstring& input, std::wstring root)
+{
+    while (root.size() > 1 && IsSeparator(root.back())) root.pop_back();
+    std::wstring dir = Utils::GetDirectory(input);
+    if (root.empty() || dir.size() <= root.size() || dir.compare(0, root.size(), root) != 0) {
+        return std::wstring();
+    }
+    if (!IsSeparator(root.back()) && !IsSeparator(dir[root.size()])) return std::wstring();
+
+    size_t start = root.size();
+    while (start < dir.size() && IsSeparator(dir[start])) ++start;
+    return dir.substr(start);
+}
+
+/**
+ * @brief 출력 경로 비교 키 (Windows 파일 시스템은 대소문자 구분 없음)
+ */
+std::wstring OutputKey(const std::wstring& path)
+{
+#if defined(_WIN32)
+    return Utils::ToLower(Utils::Replace(path, L"/", L"\\"));
+#else
+    return path;
+#endif
+}
+
+/**
+ * @brief 패턴을 디렉터리/파일 패턴으로 나눔 (디렉터리가 "**"이면 그 위 디렉터리와 recursive)
+ */
+void SplitGlob(const std::wstring& pattern, std::wstring& dir, std::wstring& file_pattern,
+               bool& recursive, wchar_t& separator)
+{
+    size_t slash = pattern.find_last_of(L"\\/");
+    separator = (slash != std::wstring::npos) ? pattern[slash] : L'\\';
+    dir = (slash != std::wstring::npos) ? pattern.substr(0, slash) : L".";
+    file_pattern = (slash != std::wstring::npos) ? pattern.substr(slash + 1) : pattern;
+
+    recursive = false;
+    if (Utils::GetFileName(dir) == L"**") {
+        recursive = true;
+        size_t parent = dir.find_last_of(L"\\/");
+        dir = (parent != std::wstring::npos) ? dir.substr(0, parent) : L".";
+    }
+    if (dir.empty()) dir = std::wstring(1, separator);    // 루트 ("/*.hwp")
+}
+
+bool HasWildcard(const std::wstring& str)
+{
+    return str.find_first_of(L"*?") != std::wstring::npos;
+}
+
+void CollectMatches(const std::wstring& dir, const std::wstring& file_pattern, bool recursive,
+                    wchar_t separator, std::vector<std::wstring>& out)
+{
+    std::vector<DirEntry> entries;
+    if (!PlatformServices::Get().ListDirectory(dir, entries)) return;
+
+    std::sort(entries.begin(), entries.end(),
+              [](const DirEntry& a, const DirEntry& b) { return a.name < b.name; });
+
+    std::wstring prefix = dir;
+    if (prefix.back() != L'\\' && prefix.back() != L'/') prefix += separator;
+
+    for (const DirEntry& entry : entries) {
+        if (entry.is_directory) {
+            if (recursive) {
+                CollectMatches(prefix + entry.name, file_pattern, true, separator, out);
+            }
+        } else if (Utils::MatchWildcard(file_pattern, entry.name)) {
+            out.push_back(prefix + entry.name);
+        }
+    }
+}
+
+} // namespace
+
+const char* ConvertStatusName(ConvertStatus status)
+{
+    switch (status) {
+    case ConvertStatus::Converted: return "converted";
+    case ConvertStatus::Skipped:   return "skipped";
+    case ConvertStatus::Failed:    return "failed";
+    case ConvertStatus::TimedOut:  return "timeout";
+    }
+    return "";
+}
+
+//=============================================================================
+// 작업자/완료 알림
+//=============================================================================
+
+/**
+ * @brief 실행 스레드 → Run() 스레드 완료 알림
+ */
+struct BatchConverter::Completion {
+    struct Done {
+        size_t worker;
+        size_t index;
+        bool ok;
+        bool timedOut;
+        double openMs;
+        double saveMs;
+        std::wstring error;
+    };
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Done> done;
+
+    void Push(Done item)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done.push_back(std::move(item));
+        }
+        cv.notify_one();
+    }
+
+    Done Pop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return !done.empty(); });
+        Done item = std::move(done.front());
+        done.pop_front();
+        return item;
+    }
+};
+
+//=============================================================================
+// 생성자
+//=============================================================================
+
+BatchConverter::BatchConverter(const BatchConvertConfig& config, HwpInstancePool::Factory factory)
+    : m_config(config)
+    , m_pool([&config] {
+          HwpInstancePoolConfig pool;
+          pool.warm_count = config.workers > 0 ? config.workers : 1;
+          pool.max_jobs = config.max_jobs_per_instance;
+          pool.visible = config.visible;
+          return pool;
+      }(), std::move(factory))
+    , m_converted(0)
+    , m_skipped(0)
+    , m_failed(0)
+    , m_timedOut(0)
+    , m_retried(0)
+{
+    if (m_config.workers == 0) m_config.workers = 1;
+    if (m_config.retries < 0) m_config.retries = 0;
+}
+
+void BatchConverter::Shutdown()
+{
+    m_leases.clear();
+    m_pool.Shutdown();
+}
+
+//=============================================================================
+// 경로
+//=============================================================================
+
+std::vector<std::wstring> BatchConverter::ExpandGlob(const std::wstring& pattern)
+{
+    std::vector<std::wstring> out;
+
+    std::wstring dir, filePattern;
+    bool recursive;
+    wchar_t separator;
+    SplitGlob(pattern, dir, filePattern, recursive, separator);
+
+    if (!recursive && !HasWildcard(filePattern) && !HasWildcard(dir)) {
+        if (Utils::FileExists(pattern)) out.push_back(pattern);
+        return out;
+    }
+
+    CollectMatches(dir, filePattern, recursive, separator, out);
+    return out;
+}
+
+std::wstring BatchConverter::GlobRoot(const std::wstring& pattern)
+{
+    std::wstring dir, filePattern;
+    bool recursive;
+    wchar_t separator;
+    SplitGlob(pattern, dir, filePattern, recursive, separator);
+    return dir;
+}
+
+std::wstring BatchConverter::ExtensionFor(const std::wstring& format)
+{
+    static const struct { const wchar_t* format; const wchar_t* ext; } kExtensions[] = {
+        { L"HWP",     L".hwp" },
+        { L"HWPX",    L".hwpx" },
+        { L"PDF",     L".pdf" },
+        { L"PDFA",    L".pdf" },
+        { L"TEXT",    L".txt" },
+        { L"UNICODE", L".txt" },
+        { L"HTML",    L".html" },
+        { L"HTML+",   L".html" },
+        { L"OOXML",   L".docx" },
+        { L"MSWORD",  L".doc" },
+        { L"RTF",     L".rtf" },
+        { L"ODT",     L".odt" },
+        { L"HWPML2X", L".hml" },
+    };
+    for (const auto& entry : kExtensions) {
+        if (Utils::EqualsIgnoreCase(format, entry.format)) return entry.ext;
+    }
+    return L"." + Utils::ToLower(format);
+}
+
+std::wstring BatchConverter::OutputPathFor(const std::wstring& input, const std::wstring& input_root) const
+{
+    std::wstring ext = m_config.extension.empty() ? ExtensionFor(m_config.format) : m_config.extension;
+    if (!ext.empty() && ext[0] != L'.') ext = L"." + ext;
+    std::wstring name = Utils::GetFileNameWithoutExtension(input) + ext;
+
+    if (m_config.output_dir.empty()) {
+        std::wstring dir = Utils::GetDirectory(input);
+        if (dir.empty()) return name;
+        return dir + input[dir.size()] + name;      // 입력 경로의 구분자 유지
+    }
+
+    std::wstring dir = m_config.output_dir;
+    wchar_t separator = (dir.find(L'/') != std::wstring::npos) ? L'/' : L'\\';
+    if (!IsSeparator(dir.back())) dir += separator;
+
+    // 하위 디렉터리를 그대로 옮겨 서로 다른 디렉터리의 같은 이름이 겹치지 않도록
+    std::wstring rel = input_root.empty() ? std::wstring() : RelativeDirectory(input, input_root);
+    for (wchar_t& ch : rel) {
+        if (IsSeparator(ch)) ch = separator;
+    }
+    if (!rel.empty()) dir += rel + separator;
+    return dir + name;
+}
+
+bool BatchConverter::IsUpToDate(const std::wstring& input, const std::wstring& output) const
+{
+    PlatformServices& platform = PlatformServices::Get();
+    FileInfo in, out;
+    if (!platform.GetFileInfo(output, out) || out.size == 0) return false;
+    if (!platform.GetFileInfo(input, in)) return false;
+    if (out.mtime_ns < in.mtime_ns) return false;
+
+    auto it = m_records.find(OutputKey(output));
+    if (it == m_records.end()) return true;
+    const Record& record = it->second;
+    return record.ok && record.input_size == in.size && record.output_size == out.size;
+}
+
+//=============================================================================
+// 결과 기록
+//=============================================================================
+
+void BatchConverter::LoadManifest()
+{
+    std::unique_ptr<FILE, int (*)(FILE*)> file(OpenManifest(m_config.manifest_path, false), &fclose);
+    if (!file) return;
+
+    std::string line;
+    char buf[4096];
+    while (fgets(buf, sizeof(buf), file.get())) {
+        line += buf;
+        if (line.back() != '\n' && !feof(file.get())) continue;
+
+        std::wstring output, status;
+        Record record{};
+        if (FindJsonString(line, "output", output) && FindJsonString(line, "status", status)) {
+            record.ok = status == L"converted" || status == L"skipped";
+            if (!record.ok || (FindJsonNumber(line, "input_size", record.input_size) &&
+                               FindJsonNumber(line, "output_size", record.output_size))) {
+                m_records[OutputKey(output)] = record;
+            }
+        }
+        line.clear();
+    }
+}
+
+void BatchConverter::Remember(BatchConvertResult& result)
+{
+    Record record{};
+    record.ok = result.status == ConvertStatus::Converted || result.status == ConvertStatus::Skipped;
+    if (record.ok) {
+        PlatformServices& platform = PlatformServices::Get();
+        FileInfo in, out;
+        if (platform.GetFileInfo(result.input, in)) result.input_size = in.size;
+        if (platform.GetFileInfo(result.output, out)) result.output_size = out.size;
+        record.input_size = result.input_size;
+        record.output_size = result.output_size;
+    }
+    m_records[OutputKey(result.output)] = record;
+}
+
+//=============================================================================
+// 변환
+//=============================================================================
+
+std::vector<BatchConvertResult> BatchConverter::RunGlob(const std::wstring& pattern,
+                                                        const Progress& progress)
+{
+    return Run(ExpandGlob(pattern), progress, GlobRoot(pattern));
+}
+
+void BatchConverter::Dispatch(AsyncHwp& worker, size_t worker_index, size_t index,
+                              const BatchConvertResult& result,
+                              const std::shared_ptr<Completion>& completion)
+{
+    AsyncHwp* async = &worker;
+    std::wstring input = result.input;
+    std::wstring output = result.output;
+    const BatchConvertConfig& config = m_config;
+
+    auto convert = [completion, async, worker_index, index, input, output,
+                    format = config.format, openArg = config.open_arg,
+                    saveArg = config.save_arg](HwpWrapper& hwp) {
+        Completion::Done done{ worker_index, index, false, false, 0.0, 0.0, std::wstring() };
+        try {
+            Clock::time_point t0 = Clock::now();
+            bool opened = hwp.Open(input, L"", openArg);
+            Clock::time_point t1 = Clock::now();
+            bool saved = opened && !async->IsCallTimedOut() && hwp.SaveAs(output, format, saveArg);
+            Clock::time_point t2 = Clock::now();
+
+            done.timedOut = async->IsCallTimedOut();
+            if (opened && !done.timedOut) {
+                hwp.ClearDocument(1);       // 다음 파일을 위해 닫기 (저장하지 않음)
+            }
+            done.openMs = ElapsedMs(t0, t1);
+            done.saveMs = opened ? ElapsedMs(t1, t2) : 0.0;
+            done.ok = saved && !done.timedOut;
+            if (done.timedOut) {
+                done.error = L"timed out";
+            } else if (!opened) {
+                done.error = L"open failed";
+            } else if (!saved) {
+                done.error = L"save failed";
+            }
+        } catch (...) {
+            done.ok = false;
+            done.error = L"exception";
+        }
+        completion->Push(std::move(done));
+    };
+
+    async->Post(convert, config.timeout);
+}
+
+std::vector<BatchConvertResult> BatchConverter::Run(const std::vector<std::wstring>& inputs,
+                                                    const Progress& progress,
+                                                    const std::wstring& input_root)
+{
+    const size_t total = inputs.size();
+    std::vector<BatchConvertResult> results(total);
+    std::vector<Clock::time_point> started(total);
+
+    // 이전 목록의 크기 기록을 읽은 뒤 새로 씀 (진행 콜백이 예외를 던져도 닫히도록)
+    if (!m_config.manifest_path.empty()) LoadManifest();
+    std::unique_ptr<FILE, int (*)(FILE*)> manifest(
+        m_config.manifest_path.empty() ? nullptr : OpenManifest(m_config.manifest_path, true), &fclose);
+    size_t finished = 0;
+
+    auto finish = [&](size_t index) {
+        BatchConvertResult& result = results[index];
+        Remember(result);
+        switch (result.status) {
+        case ConvertStatus::Converted: m_converted++; break;
+        case ConvertStatus::Skipped:   m_skipped++; break;
+        case ConvertStatus::Failed:    m_failed++; break;
+        case ConvertStatus::TimedOut:  m_timedOut++; break;
+        }
+        if (manifest) WriteManifestLine(manifest.get(), result);
+        ++finished;
+        if (progress) progress(result, finished, total);
+    };
+
+    // 1. 출력 경로가 겹치는 파일은 서로 덮어쓰지 않도록 모두 실패
+    std::map<std::wstring, size_t> owners;
+    std::vector<bool> collided(total, false);
+    for (size_t i = 0; i < total; ++i) {
+        results[i].input = inputs[i];
+        results[i].output = OutputPathFor(inputs[i], input_root);
+        auto inserted = owners.emplace(OutputKey(results[i].output), i);
+        if (!inserted.second) {
+            collided[i] = true;
+            collided[inserted.first->second] = true;
+        }
+    }
+
+    // 2. 출력이 최신인 파일은 한/글 없이 바로 끝냄
+    std::deque<size_t> pending;
+    std::vector<std::wstring> outputDirs;
+    for (size_t i = 0; i < total; ++i) {
+        if (collided[i]) {
+            results[i].status = ConvertStatus::Failed;
+            results[i].error = L"output path collision";
+            finish(i);
+        } else if (m_config.skip_up_to_date && IsUpToDate(results[i].input, results[i].output)) {
+            results[i].status = ConvertStatus::Skipped;
+            finish(i);
+        } else {
+            pending.push_back(i);
+            if (!m_config.output_dir.empty()) {
+                std::wstring dir = Utils::GetDirectory(results[i].output);
+                if (outputDirs.empty() || outputDirs.back() != dir) outputDirs.push_back(dir);
+            }
+        }
+    }
+
+    std::sort(outputDirs.begin(), outputDirs.end());
+    outputDirs.erase(std::unique(outputDirs.begin(), outputDirs.end()), outputDirs.end());
+    for (const std::wstring& dir : outputDirs) {
+        PlatformServices::Get().CreateDirectories(dir);
+    }
+
+    // 3. 인스턴스 빌리기 (다음 Run()에서도 그대로 씀)
+    size_t wanted = std::min(m_config.workers, pending.size());
+    while (m_leases.size() < wanted) {
+        m_leases.push_back(m_pool.Acquire());
+    }
+    std::vector<size_t> workerInflight(m_leases.size(), 0);
+
+    auto completion = std::make_shared<Completion>();
+    size_t inflight = 0;
+
+    // 4. 인스턴스마다 kInFlightPerWorker개씩 채우고 끝나는 대로 다음 파일
+    while (!pending.empty() || inflight > 0) {
+        for (size_t w = 0; w < m_leases.size(); ++w) {
+            HwpInstancePool::Lease& lease = m_leases[w];
+            while (lease && lease->IsRunning() &&
+                   workerInflight[w] < kInFlightPerWorker && !pending.empty()) {
+                size_t index = pending.front();
+                pending.pop_front();
+                if (results[index].attempts++ == 0) {
+                    started[index] = Clock::now();
+                }
+                Dispatch(*lease, w, index, results[index], completion);
+                workerInflight[w]++;
+                inflight++;
+            }
+        }
+
+        if (inflight == 0) {
+            // 쓸 수 있는 인스턴스가 없음
+            while (!pending.empty()) {
+                size_t index = pending.front();
+                pending.pop_front();
+                results[index].status = ConvertStatus::Failed;
+                results[index].error = L"no HWP instance";
+                finish(index);
+            }
+            break;
+        }
+
+        Completion::Done done = completion->Pop();
+        inflight--;
+        workerInflight[done.worker]--;
+
+        BatchConvertResult& result = results[done.index];
+        result.open_ms = done.openMs;
+        result.save_ms = done.saveMs;
+        result.error = done.error;
+        result.status = done.ok ? ConvertStatus::Converted
+                                : (done.timedOut ? ConvertStatus::TimedOut : ConvertStatus::Failed);
+
+        if (!done.ok && result.attempts <= m_config.retries) {
+            m_retried++;
+            pending.push_front(done.index);
+        } else {
+            result.total_ms = ElapsedMs(started[done.index], Clock::now());
+            finish(done.index);
+        }
+
+        // 다시 초기화하지 못한 인스턴스는 남은 파일이 빠진 뒤 교체
+        HwpInstancePool::Lease& lease = m_leases[done.worker];
+        if (lease && workerInflight[done.worker] == 0 && !lease->IsHealthy()) {
+            lease.Discard();
+            lease.Release();
+            lease = m_pool.Acquire();
+        }
+    }
+
+    return results;
+}
+
+} // namespace cpyhwpx
@@ -0,0 +1,200 @@
+/**
+ * @file BatchConverter.h
+ * @brief 디렉터리 단위 일괄 변환 (HWP → PDF/HWPX/TXT/HTML)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * Python에서 open/save_as를 파일마다 차례로 부르는 대신, HwpInstancePool의
+ * 한/글 인스턴스 N개에 파일을 나눠 변환하고 결과를 JSONL 목록으로 남긴다.
+ */
+
+#pragma once
+
+#include "HwpInstancePool.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace cpyhwpx {
+
+/**
+ * @brief 일괄 변환 설정
+ */
+struct BatchConvertConfig {
+    std::wstring format = L"PDF";               // SaveAs 형식 (PDF, HWPX, TEXT, HTML, HWP ...)
+    std::wstring output_dir;                    // 비어 있으면 입력 파일과 같은 디렉터리
+                                                // (RunGlob은 패턴 기준 하위 디렉터리를 그대로 만듦)
+    std::wstring extension;                     // 출력 확장자 (비어 있으면 형식에서 결정)
+    std::wstring open_arg = L"forceopen:true";  // Open 인자
+    std::wstring save_arg;                      // SaveAs 인자
+    size_t workers = 2;                         // 동시에 쓰는 한/글 인스턴스 수
+    std::chrono::milliseconds timeout{120000};  // 파일당 제한 시간 (0이면 제한 없음)
+    int retries = 1;                            // 실패/시간 초과 후 다시 시도할 횟수
+    bool skip_up_to_date = true;                // 출력이 최신이면 건너뜀 (IsUpToDate)
+    std::wstring manifest_path;                 // JSONL 결과 목록 (비어 있으면 쓰지 않음, 이전 목록의
+                                                // 크기 기록은 Run() 시작 시 읽어 IsUpToDate에 사용)
+    size_t max_jobs_per_instance = 200;         // 이만큼 변환한 인스턴스는 교체 (0=무제한)
+    bool visible = false;                       // 창 표시 여부
+};
+
+/**
+ * @brief 파일별 변환 결과 종류
+ */
+enum class ConvertStatus {
+    Converted,
+    Skipped,        // 출력이 최신
+    Failed,
+    TimedOut,
+};
+
+/**
+ * @brief 결과 이름 ("converted", "skipped", "failed", "timeout")
+ */
+const char* ConvertStatusName(ConvertStatus status);
+
+/**
+ * @brief 파일별 변환 결과
+ */
+struct BatchConvertResult {
+    std::wstring input;
+    std::wstring output;
+    ConvertStatus status = ConvertStatus::Failed;
+    int attempts = 0;           // 건너뛴 파일은 0
+    double open_ms = 0.0;       // 마지막 시도의 Open 시간
+    double save_ms = 0.0;       // 마지막 시도의 SaveAs 시간
+    double total_ms = 0.0;      // 처음 보낸 때부터 끝날 때까지 (대기/재시도 포함)
+    uint64_t input_size = 0;    // 변환/건너뜀 시점의 입력 크기 (그 밖에는 0)
+    uint64_t output_size = 0;   // 변환/건너뜀 시점의 출력 크기 (그 밖에는 0)
+    std::wstring error;
+};
+
+/**
+ * @class BatchConverter
+ * @brief 여러 한/글 인스턴스로 파일 목록 변환
+ *
+ * - 인스턴스는 생성 시 HwpInstancePool에 미리 띄워 두고, 처음 Run()에서 빌린 workers개를
+ *   Shutdown()까지 계속 쓴다 (Run()마다 반환하면 풀이 예비 인스턴스를 새로 띄우고 버린다)
+ * - 인스턴스마다 파일 두 개를 실행 큐에 미리 넣어 두므로 한 파일의 SaveAs가 끝나면
+ *   호출자 왕복 없이 바로 다음 파일의 Open이 시작된다
+ * - 제한 시간을 넘긴 파일은 AsyncHwp 워치독이 인스턴스를 교체하고, retries번까지 다시 시도한다
+ * - 출력 경로가 겹치는 입력(다른 디렉터리의 같은 이름 등)은 변환하지 않고 실패로 끝낸다
+ * - 진행 콜백과 결과 목록 기록은 Run()을 부른 스레드에서 실행된다
+ * - Run()은 한 번에 한 스레드에서만 부른다
+ */
+class BatchConverter {
+public:
+    /**
+     * @brief 파일 하나가 끝날 때마다 호출 (done: 끝난 파일 수, total: 전체 파일 수)
+     */
+    using Progress = std::function<void(const BatchConvertResult& result, size_t done, size_t total)>;
+
+    /**
+     * @param factory 인스턴스 생성 함수 (기본: 설정대로 새 한/글 인스턴스, 테스트에서는 가짜)
+     */
+    explicit BatchConverter(const BatchConvertConfig& config = BatchConvertConfig(),
+                            HwpInstancePool::Factory factory = HwpInstancePool::Factory());
+
+    BatchConverter(const BatchConverter&) = delete;
+    BatchConverter& operator=(const BatchConverter&) = delete;
+
+    /**
+     * @brief 파일 목록 변환 (모두 끝날 때까지 대기)
+     * @param input_root OutputPathFor() 참고 (비우면 output_dir에 파일 이름만)
+     * @return 입력 순서대로의 결과 (출력 경로가 겹치는 입력은 "output path collision" 실패)
+     */
+    std::vector<BatchConvertResult> Run(const std::vector<std::wstring>& inputs,
+                                        const Progress& progress = Progress(),
+                                        const std::wstring& input_root = std::wstring());
+
+    /**
+     * @brief ExpandGlob(pattern)으로 찾은 파일을 GlobRoot(pattern) 기준으로 변환
+     */
+    std::vector<BatchConvertResult> RunGlob(const std::wstring& pattern,
+                                            const Progress& progress = Progress());
+
+    /**
+     * @brief 경로 패턴 전개
+     * @param pattern 마지막 구성 요소에 *, ? 사용 가능. 바로 위 디렉터리가 "**"이면 하위 디렉터리 포함
+     *                (예: "D:\\archive\\**\\*.hwp")
+     * @return 이름순으로 정렬한 파일 경로
+     */
+    static std::vector<std::wstring> ExpandGlob(const std::wstring& pattern);
+
+    /**
+     * @brief 패턴이 찾는 디렉터리 ("**" 앞, 예: "D:\\archive\\**\\*.hwp" → "D:\\archive")
+     */
+    static std::wstring GlobRoot(const std::wstring& pattern);
+
+    /**
+     * @brief 형식별 기본 확장자 (".pdf", ".hwpx", ".txt", ".html" ...)
+     */
+    static std::wstring ExtensionFor(const std::wstring& format);
+
+    /**
+     * @brief 입력 파일의 출력 경로
+     * @param input_root output_dir이 있을 때, 입력이 이 디렉터리 아래에 있으면
+     *                   그 상대 디렉터리를 output_dir 아래에 그대로 씀
+     */
+    std::wstring OutputPathFor(const std::wstring& input,
+                               const std::wstring& input_root = std::wstring()) const;
+
+    /**
+     * @brief 출력이 비어 있지 않고 입력보다 나중에 수정되었는지
+     *
+     * 이전에 변환/건너뜀으로 기록된 출력이면 입력/출력 크기도 기록과 같아야 한다
+     * (중간에 끊긴 출력, 시각이 보존된 채 바뀐 입력). 실패로 기록된 출력은 최신이 아니다.
+     */
+    bool IsUpToDate(const std::wstring& input, const std::wstring& output) const;
+
+    /**
+     * @brief 빌린 인스턴스 반환 후 풀 종료 (소멸자에서도 수행)
+     */
+    void Shutdown();
+
+    const BatchConvertConfig& GetConfig() const { return m_config; }
+    HwpInstancePool& GetPool() { return m_pool; }
+
+    //=========================================================================
+    // 통계 (누적)
+    //=========================================================================
+
+    uint64_t GetConvertedCount() const { return m_converted; }
+    uint64_t GetSkippedCount() const { return m_skipped; }
+    uint64_t GetFailedCount() const { return m_failed; }
+    uint64_t GetTimeoutCount() const { return m_timedOut; }
+    uint64_t GetRetryCount() const { return m_retried; }
+
+private:
+    struct Completion;
+
+    /**
+     * @brief 출력별 마지막 결과 (결과 목록과 같은 내용)
+     */
+    struct Record {
+        bool ok;                // 변환/건너뜀
+        uint64_t input_size;
+        uint64_t output_size;
+    };
+
+    void LoadManifest();
+    void Remember(BatchConvertResult& result);
+
+    void Dispatch(AsyncHwp& worker, size_t worker_index, size_t index,
+                  const BatchConvertResult& result, const std::shared_ptr<Completion>& completion);
+
+    BatchConvertConfig m_config;
+    HwpInstancePool m_pool;
+    std::vector<HwpInstancePool::Lease> m_leases;   // 작업자 (m_pool보다 먼저 해제)
+    std::map<std::wstring, Record> m_records;       // 출력 경로 → 마지막 결과
+
+    uint64_t m_converted;
+    uint64_t m_skipped;
+    uint64_t m_failed;
+    uint64_t m_timedOut;
+    uint64_t m_retried;
+};
+
+} // namespace cpyhwpx
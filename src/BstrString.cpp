@@ -0,0 +1,110 @@
+/**
+ * @file BstrString.cpp
+ * @brief BSTR 소유 래퍼 변환 함수 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "BstrString.h"
+#include <cwchar>
+
+// SIMD 폭 확장: wchar_t가 UTF-16(2바이트)인 환경에서만 사용
+#if WCHAR_MAX <= 0xFFFF
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CPYHWPX_BSTR_SSE2 1
+#include <emmintrin.h>
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace cpyhwpx {
+
+namespace {
+
+/**
+ * @brief 앞에서부터 연속된 ASCII(0x00~0x7F) 바이트 수
+ */
+size_t AsciiPrefixLength(const unsigned char* s, size_t n)
+{
+    size_t i = 0;
+#if defined(CPYHWPX_BSTR_SSE2)
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(v));
+        if (mask) {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return i + index;
+#else
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+#endif
+        }
+    }
+#endif
+    while (i < n && s[i] < 0x80) ++i;
+    return i;
+}
+
+/**
+ * @brief 1바이트 문자를 UTF-16으로 폭 확장 (ASCII/Latin-1)
+ */
+void Widen(const unsigned char* s, size_t n, wchar_t* out)
+{
+    size_t i = 0;
+#if defined(CPYHWPX_BSTR_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = static_cast<wchar_t>(s[i]);
+    }
+}
+
+} // namespace
+
+BstrString BstrString::FromUtf16(const wchar_t* data, size_t len)
+{
+    return BstrString(SysAllocStringLen(len ? data : L"", static_cast<UINT>(len)));
+}
+
+BstrString BstrString::FromLatin1(const unsigned char* data, size_t len)
+{
+    BSTR bstr = SysAllocStringLen(nullptr, static_cast<UINT>(len));
+    if (!bstr) return BstrString();
+    Widen(data, len, bstr);
+    return BstrString(bstr);
+}
+
+BstrString BstrString::FromUtf8(const char* data, size_t len)
+{
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    size_t ascii = AsciiPrefixLength(bytes, len);
+    if (ascii == len) {
+        return FromLatin1(bytes, len);
+    }
+
+    // 비 ASCII 구간 길이 계산 후 최종 크기로 한 번만 할당
+    const char* rest = data + ascii;
+    int restBytes = static_cast<int>(len - ascii);
+    int restChars = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, rest, restBytes,
+                                        nullptr, 0);
+    if (restChars <= 0) return BstrString();
+
+    BSTR bstr = SysAllocStringLen(nullptr, static_cast<UINT>(ascii + restChars));
+    if (!bstr) return BstrString();
+
+    Widen(bytes, ascii, bstr);
+    MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, rest, restBytes,
+                        bstr + ascii, restChars);
+    return BstrString(bstr);
+}
+
+} // namespace cpyhwpx
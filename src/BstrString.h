@@ -0,0 +1,136 @@
+/**
+ * @file BstrString.h
+ * @brief COM이 반환한 BSTR 소유 래퍼
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 큰 문자열 결과를 std::wstring으로 복사하지 않고 그대로 전달
+ */
+
+#pragma once
+
+#include "ComPlatform.h"
+#include <string>
+#include <utility>
+
+namespace cpyhwpx {
+
+/**
+ * @class BstrString
+ * @brief BSTR 소유권을 가지는 이동 전용 래퍼
+ *
+ * GetTextFile 등 대용량 결과를 BSTR 버퍼 그대로 보관한다.
+ * Python 바인딩에서는 버퍼에서 바로 str 객체를 만든 뒤 해제되므로
+ * BSTR → std::wstring → str의 중간 복사가 없다.
+ */
+class BstrString {
+public:
+    BstrString() = default;
+
+    /**
+     * @brief 이미 할당된 BSTR의 소유권을 넘겨받음
+     */
+    explicit BstrString(BSTR owned) : m_bstr(owned) {}
+
+    ~BstrString() { Reset(); }
+
+    // 복사 금지, 이동 허용
+    BstrString(const BstrString&) = delete;
+    BstrString& operator=(const BstrString&) = delete;
+
+    BstrString(BstrString&& other) noexcept : m_bstr(other.m_bstr)
+    {
+        other.m_bstr = nullptr;
+    }
+
+    BstrString& operator=(BstrString&& other) noexcept
+    {
+        if (this != &other) {
+            Reset();
+            m_bstr = other.m_bstr;
+            other.m_bstr = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief VARIANT 결과에서 BSTR을 가져옴 (VT_BSTR이 아니면 비움)
+     *
+     * 소유권을 가져오므로 result는 VT_EMPTY가 된다.
+     */
+    static BstrString FromVariant(VARIANT& result)
+    {
+        BstrString str;
+        if (result.vt == VT_BSTR) {
+            str.m_bstr = result.bstrVal;
+            result.bstrVal = nullptr;
+            result.vt = VT_EMPTY;
+        } else {
+            VariantClear(&result);
+        }
+        return str;
+    }
+
+    /**
+     * @brief UTF-16 버퍼에서 BSTR 한 번 할당 (SysAllocStringLen)
+     */
+    static BstrString FromUtf16(const wchar_t* data, size_t len);
+
+    /**
+     * @brief UTF-8 버퍼를 BSTR로 직접 변환
+     *
+     * 앞부분 ASCII 구간은 SIMD로 폭 확장하고 나머지는 MultiByteToWideChar로 변환한다.
+     * 중간 std::wstring 없이 최종 BSTR에 바로 기록한다.
+     * 잘못된 UTF-8이면 빈(null) BstrString을 반환한다.
+     */
+    static BstrString FromUtf8(const char* data, size_t len);
+
+    /**
+     * @brief Latin-1(1바이트) 버퍼를 BSTR로 폭 확장 (SIMD)
+     */
+    static BstrString FromLatin1(const unsigned char* data, size_t len);
+
+    /**
+     * @brief VARIANT 인자로 넘길 BSTR (소유권 유지)
+     */
+    BSTR bstr() const { return m_bstr; }
+
+    /**
+     * @brief UTF-16 버퍼 (nullptr 가능)
+     */
+    const wchar_t* data() const { return m_bstr; }
+
+    /**
+     * @brief 문자 수 (SysStringLen, O(1))
+     */
+    size_t size() const { return m_bstr ? SysStringLen(m_bstr) : 0; }
+
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief std::wstring 복사본 (C++ 호출자용)
+     */
+    std::wstring str() const { return std::wstring(m_bstr ? m_bstr : L"", size()); }
+
+    /**
+     * @brief 소유권 반환 (호출자가 SysFreeString 책임)
+     */
+    BSTR Detach()
+    {
+        BSTR b = m_bstr;
+        m_bstr = nullptr;
+        return b;
+    }
+
+    void Reset()
+    {
+        if (m_bstr) {
+            SysFreeString(m_bstr);
+            m_bstr = nullptr;
+        }
+    }
+
+private:
+    BSTR m_bstr = nullptr;
+};
+
+} // namespace cpyhwpx
@@ -0,0 +1,87 @@
+/**
+ * @file BulkEditScope.cpp
+ * @brief BulkEditScope 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "BulkEditScope.h"
+#include "HwpWrapper.h"
+
+namespace cpyhwpx {
+
+//=============================================================================
+// 생성자/소멸자
+//=============================================================================
+
+BulkEditScope::BulkEditScope(HwpWrapper& hwp, const BulkEditOptions& options)
+    : m_hwp(&hwp)
+    , m_active(true)
+    , m_outer(hwp.m_bulkEditDepth++ == 0)
+    , m_messageBoxChanged(false)
+    , m_oldMessageBoxMode(0)
+    , m_hidden(false)
+    , m_redrawHwnd(NULL)
+{
+    if (!m_outer || !hwp.m_pHwp) return;
+
+    if (options.message_box_mode >= 0) {
+        m_oldMessageBoxMode = hwp.SetMessageBoxMode(options.message_box_mode);
+        m_messageBoxChanged = true;
+    }
+
+    if (options.hide_window && hwp.IsVisible()) {
+        hwp.SetVisible(false);
+        m_hidden = true;
+    }
+
+#if defined(_WIN32)
+    // 숨긴 창은 어차피 그리지 않는다
+    if (options.suppress_redraw && !m_hidden && hwp.IsVisible()) {
+        HWND hwnd = hwp.GetHwnd();
+        if (hwnd) {
+            SendMessageW(hwnd, WM_SETREDRAW, FALSE, 0);
+            m_redrawHwnd = hwnd;
+        }
+    }
+#endif
+}
+
+BulkEditScope::~BulkEditScope()
+{
+    Restore();
+}
+
+//=============================================================================
+// 복원
+//=============================================================================
+
+void BulkEditScope::Restore()
+{
+    if (!m_active) return;
+    m_active = false;
+    m_hwp->m_bulkEditDepth--;
+
+    if (!m_outer || !m_hwp->m_pHwp) return;
+
+#if defined(_WIN32)
+    if (m_redrawHwnd) {
+        SendMessageW(m_redrawHwnd, WM_SETREDRAW, TRUE, 0);
+        RedrawWindow(m_redrawHwnd, NULL, NULL,
+                     RDW_ERASE | RDW_FRAME | RDW_INVALIDATE | RDW_ALLCHILDREN);
+        m_redrawHwnd = NULL;
+    }
+#endif
+
+    if (m_hidden) {
+        m_hwp->SetVisible(true);
+        m_hidden = false;
+    }
+
+    if (m_messageBoxChanged) {
+        m_hwp->SetMessageBoxMode(m_oldMessageBoxMode);
+        m_messageBoxChanged = false;
+    }
+}
+
+} // namespace cpyhwpx
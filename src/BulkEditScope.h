@@ -0,0 +1,75 @@
+/**
+ * @file BulkEditScope.h
+ * @brief 대량 편집용 빠른 편집 범위 (대화상자/화면 갱신 억제)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * TableFromData, PutFieldText, ReplaceAll 반복 같은 대량 편집은 편집마다
+ * 화면을 다시 그리고, 도중에 뜨는 메시지 박스에서 멈출 수 있다.
+ * BulkEditScope는 범위 안에서 메시지 박스를 자동 응답으로 바꾸고 창을 숨기거나
+ * 다시 그리기를 멈춘 뒤, 범위를 벗어날 때(예외 포함) 원래대로 되돌린다.
+ */
+
+#pragma once
+
+#include "ComPlatform.h"
+
+namespace cpyhwpx {
+
+class HwpWrapper;
+
+/**
+ * @brief BulkEditScope 설정
+ */
+struct BulkEditOptions {
+    int message_box_mode = 0x2FFF1;     // 모든 메시지 박스의 기본 버튼 자동 선택 (-1이면 그대로)
+    bool hide_window = true;            // 보이는 창을 범위 동안 숨김
+    bool suppress_redraw = true;        // 숨기지 않은 창의 다시 그리기 중지 (Windows, WM_SETREDRAW)
+};
+
+/**
+ * @class BulkEditScope
+ * @brief 빠른 편집 범위 (RAII)
+ *
+ * - 중첩되면 가장 바깥 범위만 설정을 바꾸고 되돌린다
+ * - 한/글 오토메이션에는 실행 취소 기록을 끄는 API가 없어 실행 취소는 그대로 기록된다
+ * - HwpWrapper와 같은 스레드에서만 사용하며 HwpWrapper보다 먼저 끝나야 한다
+ */
+class BulkEditScope {
+public:
+    explicit BulkEditScope(HwpWrapper& hwp, const BulkEditOptions& options = BulkEditOptions());
+
+    /**
+     * @brief Restore()
+     */
+    ~BulkEditScope();
+
+    BulkEditScope(const BulkEditScope&) = delete;
+    BulkEditScope& operator=(const BulkEditScope&) = delete;
+
+    /**
+     * @brief 바꾼 설정을 되돌리고 범위 종료 (여러 번 호출해도 됨)
+     */
+    void Restore();
+
+    /**
+     * @brief 아직 Restore()하지 않았는지
+     */
+    bool IsActive() const { return m_active; }
+
+    /**
+     * @brief 가장 바깥 범위인지 (설정을 실제로 바꾼 범위)
+     */
+    bool IsOutermost() const { return m_outer; }
+
+private:
+    HwpWrapper* m_hwp;
+    bool m_active;
+    bool m_outer;
+
+    bool m_messageBoxChanged;
+    int m_oldMessageBoxMode;
+    bool m_hidden;
+    HWND m_redrawHwnd;                  // 다시 그리기를 멈춘 창 (없으면 NULL)
+};
+
+} // namespace cpyhwpx
@@ -0,0 +1,125 @@
+/**
+ * @file CheckpointStore.cpp
+ * @brief CheckpointStore 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "CheckpointStore.h"
+#include "Utils.h"
+#include <cstring>
+
+namespace cpyhwpx {
+
+//=============================================================================
+// 생성자
+//=============================================================================
+
+CheckpointStore::CheckpointStore(size_t max_bytes, size_t max_count)
+    : m_maxBytes(max_bytes)
+    , m_maxCount(max_count)
+    , m_bytes(0)
+    , m_evictions(0)
+    , m_nextToken(1)
+{
+}
+
+//=============================================================================
+// 보관/꺼내기
+//=============================================================================
+
+int CheckpointStore::Add(const std::wstring& format, const BstrString& data, const HwpPos& pos, int doc_id)
+{
+    if (data.empty()) return 0;
+
+    Entry entry{ 0, format, std::string(), false, pos, doc_id };
+    if (Utils::EqualsIgnoreCase(format, L"HWP") &&
+        Utils::Base64Decode(data.data(), data.size(), entry.bytes)) {
+        entry.base64 = true;
+    } else {
+        entry.bytes.assign(reinterpret_cast<const char*>(data.data()),
+                           data.size() * sizeof(wchar_t));
+    }
+    if (!Fits(entry.bytes.size())) return 0;
+
+    Trim(entry.bytes.size());
+
+    entry.token = m_nextToken++;
+    if (m_nextToken <= 0) m_nextToken = 1;
+
+    m_bytes += entry.bytes.size();
+    m_entries.push_front(std::move(entry));
+    m_lookup[m_entries.front().token] = m_entries.begin();
+    return m_entries.front().token;
+}
+
+bool CheckpointStore::Get(int token, std::wstring& format, BstrString& data, HwpPos& pos)
+{
+    auto it = m_lookup.find(token);
+    if (it == m_lookup.end()) return false;
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    const Entry& entry = *it->second;
+
+    if (entry.base64) {
+        const unsigned char* raw = reinterpret_cast<const unsigned char*>(entry.bytes.data());
+        size_t len = Utils::Base64EncodedLength(entry.bytes.size());
+        BSTR bstr = SysAllocStringLen(NULL, static_cast<UINT>(len));
+        if (!bstr) return false;
+        Utils::Base64Encode(raw, entry.bytes.size(), bstr);
+        data = BstrString(bstr);
+    } else {
+        data = BstrString::FromUtf16(reinterpret_cast<const wchar_t*>(entry.bytes.data()),
+                                     entry.bytes.size() / sizeof(wchar_t));
+    }
+    format = entry.format;
+    pos = entry.pos;
+    return true;
+}
+
+int CheckpointStore::GetDocumentID(int token) const
+{
+    auto it = m_lookup.find(token);
+    return it == m_lookup.end() ? -1 : it->second->docId;
+}
+
+bool CheckpointStore::Erase(int token)
+{
+    auto it = m_lookup.find(token);
+    if (it == m_lookup.end()) return false;
+
+    m_bytes -= it->second->bytes.size();
+    m_entries.erase(it->second);
+    m_lookup.erase(it);
+    return true;
+}
+
+void CheckpointStore::Clear()
+{
+    m_lookup.clear();
+    m_entries.clear();
+    m_bytes = 0;
+}
+
+void CheckpointStore::SetLimits(size_t max_bytes, size_t max_count)
+{
+    m_maxBytes = max_bytes;
+    m_maxCount = max_count;
+    Trim(0);
+}
+
+void CheckpointStore::Trim(size_t incoming_bytes)
+{
+    // 새 스냅샷이 들어올 자리를 만든다 (incoming_bytes가 0이면 현재 상태만 맞춤)
+    size_t incoming = incoming_bytes > 0 ? 1 : 0;
+    while (!m_entries.empty() &&
+           (m_bytes + incoming_bytes > m_maxBytes || m_entries.size() + incoming > m_maxCount)) {
+        Entry& oldest = m_entries.back();
+        m_bytes -= oldest.bytes.size();
+        m_lookup.erase(oldest.token);
+        m_entries.pop_back();
+        m_evictions++;
+    }
+}
+
+} // namespace cpyhwpx
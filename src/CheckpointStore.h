@@ -0,0 +1,119 @@
+/**
+ * @file CheckpointStore.h
+ * @brief 문서 체크포인트 저장소 (메모리 한도 LRU)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 여러 단계 편집이 중간에 실패했을 때 파일을 닫고 다시 여는 대신
+ * GetTextFile("HWP") 스냅샷으로 되돌린다.
+ */
+
+#pragma once
+
+#include "BstrString.h"
+#include "HwpTypes.h"
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace cpyhwpx {
+
+/**
+ * @class CheckpointStore
+ * @brief 토큰 → 문서 스냅샷
+ *
+ * BASE64 스냅샷("HWP" 형식)은 디코딩한 바이트로 보관하므로 UTF-16 BSTR 대비
+ * 메모리가 3/8로 줄고, 꺼낼 때 다시 인코딩한다. 그 밖의 형식은 UTF-16 그대로 보관한다.
+ * 보관 바이트 합이나 개수가 한도를 넘으면 가장 오래 쓰지 않은 스냅샷부터 버린다.
+ * HwpWrapper와 같은 스레드에서만 사용한다.
+ */
+class CheckpointStore {
+public:
+    static constexpr size_t kDefaultMaxBytes = 256 * 1024 * 1024;
+    static constexpr size_t kDefaultMaxCount = 16;
+
+    CheckpointStore(size_t max_bytes = kDefaultMaxBytes, size_t max_count = kDefaultMaxCount);
+
+    CheckpointStore(const CheckpointStore&) = delete;
+    CheckpointStore& operator=(const CheckpointStore&) = delete;
+
+    /**
+     * @brief 스냅샷 보관
+     * @param format GetTextFile 형식
+     * @param data GetTextFile 결과
+     * @param pos 스냅샷 시점 캐럿 위치
+     * @param doc_id 스냅샷을 뜬 문서의 DocumentID
+     * @return 토큰 (한도보다 크거나 비어 있으면 0)
+     */
+    int Add(const std::wstring& format, const BstrString& data, const HwpPos& pos, int doc_id);
+
+    /**
+     * @brief 스냅샷 꺼내기 (가장 최근 항목으로, 저장소에는 남겨 둠)
+     * @return 없는 토큰이면 false
+     */
+    bool Get(int token, std::wstring& format, BstrString& data, HwpPos& pos);
+
+    /**
+     * @brief 스냅샷 존재 여부
+     */
+    bool Contains(int token) const { return m_lookup.count(token) != 0; }
+
+    /**
+     * @brief 스냅샷을 뜬 문서의 DocumentID
+     * @return 없는 토큰이면 -1
+     */
+    int GetDocumentID(int token) const;
+
+    /**
+     * @brief 스냅샷 삭제
+     * @return 있었으면 true
+     */
+    bool Erase(int token);
+
+    /**
+     * @brief 모든 스냅샷 삭제 (토큰 번호는 이어서 발급)
+     */
+    void Clear();
+
+    /**
+     * @brief 한도 변경 (둘 중 하나라도 0이면 체크포인트 사용 안 함, 넘치는 스냅샷은 바로 버림)
+     */
+    void SetLimits(size_t max_bytes, size_t max_count);
+    size_t GetMaxBytes() const { return m_maxBytes; }
+    size_t GetMaxCount() const { return m_maxCount; }
+
+    //=========================================================================
+    // 통계
+    //=========================================================================
+
+    size_t GetBytes() const { return m_bytes; }
+    size_t GetCount() const { return m_entries.size(); }
+    uint64_t GetEvictionCount() const { return m_evictions; }
+
+private:
+    struct Entry {
+        int token;
+        std::wstring format;
+        std::string bytes;      // 디코딩한 BASE64 또는 UTF-16 원본
+        bool base64;
+        HwpPos pos;
+        int docId;
+    };
+
+    /**
+     * @brief 한도 안으로 들어올 때까지 가장 오래된 스냅샷 삭제
+     */
+    void Trim(size_t incoming_bytes);
+
+    bool Fits(size_t bytes) const { return m_maxCount > 0 && bytes <= m_maxBytes; }
+
+    std::list<Entry> m_entries;     // 앞쪽이 가장 최근
+    std::unordered_map<int, std::list<Entry>::iterator> m_lookup;
+    size_t m_maxBytes;
+    size_t m_maxCount;
+    size_t m_bytes;
+    uint64_t m_evictions;
+    int m_nextToken;
+};
+
+} // namespace cpyhwpx
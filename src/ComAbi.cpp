@@ -0,0 +1,557 @@
+/**
+ * @file ComAbi.cpp
+ * @brief Windows 이외 환경용 BSTR/VARIANT/SAFEARRAY 및 Win32 대체 함수 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 메모리 배치는 oleaut32와 같게 맞춘다 (BSTR 앞 4바이트 길이, SAFEARRAY 경계 역순 저장).
+ */
+
+#include "ComPlatform.h"
+
+#if !defined(_WIN32)
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <thread>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+const IID IID_NULL = { 0x00000000, 0x0000, 0x0000,
+                       { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } };
+const IID IID_IUnknown = { 0x00000000, 0x0000, 0x0000,
+                           { 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46 } };
+const IID IID_IDispatch = { 0x00020400, 0x0000, 0x0000,
+                            { 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46 } };
+
+//=============================================================================
+// BSTR
+//=============================================================================
+
+namespace {
+
+/**
+ * @brief 바이트 길이만큼 BSTR 할당 (앞 4바이트 길이 + 데이터 + NUL 문자)
+ */
+BSTR AllocBstrBytes(const void* data, UINT bytes)
+{
+    size_t total = sizeof(UINT) + static_cast<size_t>(bytes) + sizeof(OLECHAR);
+    char* block = static_cast<char*>(malloc(total));
+    if (!block) return nullptr;
+
+    memcpy(block, &bytes, sizeof(UINT));
+    char* payload = block + sizeof(UINT);
+    if (data) {
+        memcpy(payload, data, bytes);
+    }
+    memset(payload + bytes, 0, sizeof(OLECHAR));
+    return reinterpret_cast<BSTR>(payload);
+}
+
+inline char* BstrBlock(BSTR bstr)
+{
+    return reinterpret_cast<char*>(bstr) - sizeof(UINT);
+}
+
+} // namespace
+
+BSTR SysAllocString(const OLECHAR* psz)
+{
+    if (!psz) return nullptr;
+    return SysAllocStringLen(psz, static_cast<UINT>(wcslen(psz)));
+}
+
+BSTR SysAllocStringLen(const OLECHAR* strIn, UINT ui)
+{
+    return AllocBstrBytes(strIn, ui * static_cast<UINT>(sizeof(OLECHAR)));
+}
+
+BSTR SysAllocStringByteLen(const char* psz, UINT len)
+{
+    return AllocBstrBytes(psz, len);
+}
+
+BOOL SysReAllocStringLen(BSTR* pbstr, const OLECHAR* psz, UINT len)
+{
+    if (!pbstr) return FALSE;
+    // psz가 기존 BSTR 내부를 가리킬 수 있으므로 새로 만든 뒤 해제
+    BSTR fresh = SysAllocStringLen(psz, len);
+    if (!fresh) return FALSE;
+    SysFreeString(*pbstr);
+    *pbstr = fresh;
+    return TRUE;
+}
+
+void SysFreeString(BSTR bstrString)
+{
+    if (bstrString) {
+        free(BstrBlock(bstrString));
+    }
+}
+
+UINT SysStringByteLen(BSTR bstr)
+{
+    if (!bstr) return 0;
+    UINT bytes;
+    memcpy(&bytes, BstrBlock(bstr), sizeof(UINT));
+    return bytes;
+}
+
+UINT SysStringLen(BSTR pbstr)
+{
+    return SysStringByteLen(pbstr) / static_cast<UINT>(sizeof(OLECHAR));
+}
+
+//=============================================================================
+// SAFEARRAY
+//=============================================================================
+
+namespace {
+
+/**
+ * @brief SAFEARRAY 앞에 요소 타입을 함께 저장 (FADF_HAVEVARTYPE과 같은 용도)
+ */
+struct SafeArrayHeader {
+    VARTYPE vt;
+    alignas(alignof(void*)) unsigned char descriptor[1];
+};
+
+constexpr size_t kDescriptorOffset = offsetof(SafeArrayHeader, descriptor);
+
+ULONG ElementSize(VARTYPE vt)
+{
+    switch (vt) {
+    case VT_I1: case VT_UI1:
+        return 1;
+    case VT_I2: case VT_UI2: case VT_BOOL:
+        return 2;
+    case VT_I4: case VT_UI4: case VT_INT: case VT_UINT: case VT_R4: case VT_ERROR:
+        return 4;
+    case VT_I8: case VT_UI8: case VT_R8: case VT_DATE: case VT_CY:
+        return 8;
+    case VT_BSTR: case VT_UNKNOWN: case VT_DISPATCH:
+        return sizeof(void*);
+    case VT_VARIANT:
+        return sizeof(VARIANT);
+    default:
+        return 0;
+    }
+}
+
+USHORT FeaturesFor(VARTYPE vt)
+{
+    switch (vt) {
+    case VT_BSTR:     return FADF_BSTR;
+    case VT_UNKNOWN:  return FADF_UNKNOWN;
+    case VT_DISPATCH: return FADF_DISPATCH;
+    case VT_VARIANT:  return FADF_VARIANT;
+    default:          return 0;
+    }
+}
+
+SafeArrayHeader* HeaderOf(SAFEARRAY* psa)
+{
+    return reinterpret_cast<SafeArrayHeader*>(reinterpret_cast<unsigned char*>(psa) - kDescriptorOffset);
+}
+
+size_t ElementCount(const SAFEARRAY* psa)
+{
+    size_t count = 1;
+    for (USHORT i = 0; i < psa->cDims; ++i) {
+        count *= psa->rgsabound[i].cElements;
+    }
+    return count;
+}
+
+/**
+ * @brief 요소가 소유한 자원 해제 (BSTR, 인터페이스, VARIANT)
+ */
+void ClearElements(SAFEARRAY* psa)
+{
+    size_t count = ElementCount(psa);
+    if (psa->fFeatures & FADF_BSTR) {
+        BSTR* items = static_cast<BSTR*>(psa->pvData);
+        for (size_t i = 0; i < count; ++i) {
+            SysFreeString(items[i]);
+            items[i] = nullptr;
+        }
+    } else if (psa->fFeatures & (FADF_UNKNOWN | FADF_DISPATCH)) {
+        IUnknown** items = static_cast<IUnknown**>(psa->pvData);
+        for (size_t i = 0; i < count; ++i) {
+            if (items[i]) items[i]->Release();
+            items[i] = nullptr;
+        }
+    } else if (psa->fFeatures & FADF_VARIANT) {
+        VARIANT* items = static_cast<VARIANT*>(psa->pvData);
+        for (size_t i = 0; i < count; ++i) {
+            VariantClear(&items[i]);
+        }
+    }
+}
+
+HRESULT SafeArrayCopy(SAFEARRAY* psa, SAFEARRAY** ppsaOut)
+{
+    *ppsaOut = nullptr;
+    if (!psa) return S_OK;
+
+    VARTYPE vt = HeaderOf(psa)->vt;
+    // 저장된 경계는 역순이므로 생성 인자 순서로 되돌린다
+    SAFEARRAYBOUND bounds[64];
+    if (psa->cDims > 64) return E_INVALIDARG;
+    for (USHORT i = 0; i < psa->cDims; ++i) {
+        bounds[i] = psa->rgsabound[psa->cDims - 1 - i];
+    }
+
+    SAFEARRAY* copy = SafeArrayCreate(vt, psa->cDims, bounds);
+    if (!copy) return E_OUTOFMEMORY;
+
+    size_t count = ElementCount(psa);
+    if (psa->fFeatures & FADF_BSTR) {
+        BSTR* src = static_cast<BSTR*>(psa->pvData);
+        BSTR* dst = static_cast<BSTR*>(copy->pvData);
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = src[i] ? SysAllocStringLen(src[i], SysStringLen(src[i])) : nullptr;
+        }
+    } else if (psa->fFeatures & (FADF_UNKNOWN | FADF_DISPATCH)) {
+        IUnknown** src = static_cast<IUnknown**>(psa->pvData);
+        IUnknown** dst = static_cast<IUnknown**>(copy->pvData);
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = src[i];
+            if (dst[i]) dst[i]->AddRef();
+        }
+    } else if (psa->fFeatures & FADF_VARIANT) {
+        VARIANT* src = static_cast<VARIANT*>(psa->pvData);
+        VARIANT* dst = static_cast<VARIANT*>(copy->pvData);
+        for (size_t i = 0; i < count; ++i) {
+            VariantCopy(&dst[i], &src[i]);
+        }
+    } else {
+        memcpy(copy->pvData, psa->pvData, count * psa->cbElements);
+    }
+
+    *ppsaOut = copy;
+    return S_OK;
+}
+
+} // namespace
+
+SAFEARRAY* SafeArrayCreate(VARTYPE vt, UINT cDims, SAFEARRAYBOUND* rgsabound)
+{
+    ULONG elementSize = ElementSize(vt);
+    if (cDims == 0 || !rgsabound || elementSize == 0) return nullptr;
+
+    size_t descriptorSize = sizeof(SAFEARRAY) + (cDims - 1) * sizeof(SAFEARRAYBOUND);
+    void* block = calloc(1, kDescriptorOffset + descriptorSize);
+    if (!block) return nullptr;
+
+    SafeArrayHeader* header = static_cast<SafeArrayHeader*>(block);
+    header->vt = vt;
+    SAFEARRAY* psa = reinterpret_cast<SAFEARRAY*>(header->descriptor);
+    psa->cDims = static_cast<USHORT>(cDims);
+    psa->fFeatures = FeaturesFor(vt);
+    psa->cbElements = elementSize;
+    for (UINT i = 0; i < cDims; ++i) {
+        psa->rgsabound[cDims - 1 - i] = rgsabound[i];
+    }
+
+    size_t count = ElementCount(psa);
+    psa->pvData = calloc(count ? count : 1, elementSize);
+    if (!psa->pvData) {
+        free(block);
+        return nullptr;
+    }
+    // VARIANT 요소는 VT_EMPTY(0)로, 포인터 요소는 nullptr로 초기화됨 (calloc)
+    return psa;
+}
+
+SAFEARRAY* SafeArrayCreateVector(VARTYPE vt, LONG lLbound, ULONG cElements)
+{
+    SAFEARRAYBOUND bound = { cElements, lLbound };
+    return SafeArrayCreate(vt, 1, &bound);
+}
+
+HRESULT SafeArrayDestroy(SAFEARRAY* psa)
+{
+    if (!psa) return S_OK;
+    if (psa->cLocks > 0) return DISP_E_ARRAYISLOCKED;
+
+    ClearElements(psa);
+    free(psa->pvData);
+    free(HeaderOf(psa));
+    return S_OK;
+}
+
+HRESULT SafeArrayAccessData(SAFEARRAY* psa, void** ppvData)
+{
+    if (!psa || !ppvData) return E_INVALIDARG;
+    ++psa->cLocks;
+    *ppvData = psa->pvData;
+    return S_OK;
+}
+
+HRESULT SafeArrayUnaccessData(SAFEARRAY* psa)
+{
+    if (!psa) return E_INVALIDARG;
+    if (psa->cLocks == 0) return E_UNEXPECTED;
+    --psa->cLocks;
+    return S_OK;
+}
+
+HRESULT SafeArrayGetLBound(SAFEARRAY* psa, UINT nDim, LONG* plLbound)
+{
+    if (!psa || !plLbound) return E_INVALIDARG;
+    if (nDim == 0 || nDim > psa->cDims) return DISP_E_BADINDEX;
+    *plLbound = psa->rgsabound[psa->cDims - nDim].lLbound;
+    return S_OK;
+}
+
+HRESULT SafeArrayGetUBound(SAFEARRAY* psa, UINT nDim, LONG* plUbound)
+{
+    if (!psa || !plUbound) return E_INVALIDARG;
+    if (nDim == 0 || nDim > psa->cDims) return DISP_E_BADINDEX;
+    const SAFEARRAYBOUND& bound = psa->rgsabound[psa->cDims - nDim];
+    *plUbound = bound.lLbound + static_cast<LONG>(bound.cElements) - 1;
+    return S_OK;
+}
+
+UINT SafeArrayGetDim(SAFEARRAY* psa)
+{
+    return psa ? psa->cDims : 0;
+}
+
+HRESULT SafeArrayGetVartype(SAFEARRAY* psa, VARTYPE* pvt)
+{
+    if (!psa || !pvt) return E_INVALIDARG;
+    *pvt = HeaderOf(psa)->vt;
+    return S_OK;
+}
+
+//=============================================================================
+// VARIANT
+//=============================================================================
+
+void VariantInit(VARIANT* pvarg)
+{
+    if (!pvarg) return;
+    memset(pvarg, 0, sizeof(VARIANT));
+    pvarg->vt = VT_EMPTY;
+}
+
+HRESULT VariantClear(VARIANT* pvarg)
+{
+    if (!pvarg) return E_INVALIDARG;
+
+    if (!(pvarg->vt & VT_BYREF)) {
+        if (pvarg->vt & VT_ARRAY) {
+            SafeArrayDestroy(pvarg->parray);
+        } else {
+            switch (pvarg->vt) {
+            case VT_BSTR:
+                SysFreeString(pvarg->bstrVal);
+                break;
+            case VT_DISPATCH:
+            case VT_UNKNOWN:
+                if (pvarg->punkVal) pvarg->punkVal->Release();
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    VariantInit(pvarg);
+    return S_OK;
+}
+
+HRESULT VariantCopy(VARIANT* pvargDest, const VARIANT* pvargSrc)
+{
+    if (!pvargDest || !pvargSrc) return E_INVALIDARG;
+    if (pvargDest == pvargSrc) return S_OK;
+
+    VariantClear(pvargDest);
+
+    VARIANT copy = *pvargSrc;
+    if (!(copy.vt & VT_BYREF)) {
+        if (copy.vt & VT_ARRAY) {
+            HRESULT hr = SafeArrayCopy(pvargSrc->parray, &copy.parray);
+            if (FAILED(hr)) return hr;
+        } else if (copy.vt == VT_BSTR && copy.bstrVal) {
+            copy.bstrVal = SysAllocStringByteLen(reinterpret_cast<const char*>(pvargSrc->bstrVal),
+                                                 SysStringByteLen(pvargSrc->bstrVal));
+            if (!copy.bstrVal) return E_OUTOFMEMORY;
+        } else if ((copy.vt == VT_DISPATCH || copy.vt == VT_UNKNOWN) && copy.punkVal) {
+            copy.punkVal->AddRef();
+        }
+    }
+
+    *pvargDest = copy;
+    return S_OK;
+}
+
+//=============================================================================
+// 문자 변환 (UTF-8 전용)
+//=============================================================================
+
+namespace {
+
+constexpr uint32_t kReplacementChar = 0xFFFD;
+
+/**
+ * @brief UTF-8 한 글자 해석 (잘못된 바이트열은 U+FFFD, 1바이트 소비)
+ */
+uint32_t DecodeUtf8(const unsigned char* s, size_t n, size_t& used)
+{
+    unsigned char c = s[0];
+    used = 1;
+    if (c < 0x80) return c;
+
+    int extra;
+    uint32_t cp;
+    uint32_t min;
+    if ((c & 0xE0) == 0xC0) { extra = 1; cp = c & 0x1F; min = 0x80; }
+    else if ((c & 0xF0) == 0xE0) { extra = 2; cp = c & 0x0F; min = 0x800; }
+    else if ((c & 0xF8) == 0xF0) { extra = 3; cp = c & 0x07; min = 0x10000; }
+    else return kReplacementChar;
+
+    if (n < static_cast<size_t>(extra) + 1) return kReplacementChar;
+    for (int i = 1; i <= extra; ++i) {
+        if ((s[i] & 0xC0) != 0x80) return kReplacementChar;
+        cp = (cp << 6) | (s[i] & 0x3F);
+    }
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+        return kReplacementChar;
+    }
+    used = static_cast<size_t>(extra) + 1;
+    return cp;
+}
+
+size_t EncodeUtf8(uint32_t cp, char* out)
+{
+    if (cp < 0x80) {
+        out[0] = static_cast<char>(cp);
+        return 1;
+    }
+    if (cp < 0x800) {
+        out[0] = static_cast<char>(0xC0 | (cp >> 6));
+        out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = static_cast<char>(0xE0 | (cp >> 12));
+        out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = static_cast<char>(0xF0 | (cp >> 18));
+    out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+} // namespace
+
+int MultiByteToWideChar(UINT, DWORD flags, LPCSTR src, int srcLen, LPWSTR dst, int dstLen)
+{
+    if (!src) return 0;
+    size_t n = srcLen < 0 ? strlen(src) + 1 : static_cast<size_t>(srcLen);
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(src);
+
+    size_t written = 0;
+    for (size_t i = 0; i < n;) {
+        size_t used;
+        uint32_t cp = DecodeUtf8(s + i, n - i, used);
+        if ((flags & MB_ERR_INVALID_CHARS) && cp == kReplacementChar && used == 1) {
+            return 0;       // 잘못된 바이트열 (원문의 U+FFFD는 3바이트)
+        }
+        i += used;
+
+        WCHAR units[2];
+        size_t count = 1;
+        if (sizeof(WCHAR) == 2 && cp >= 0x10000) {
+            cp -= 0x10000;
+            units[0] = static_cast<WCHAR>(0xD800 + (cp >> 10));
+            units[1] = static_cast<WCHAR>(0xDC00 + (cp & 0x3FF));
+            count = 2;
+        } else {
+            units[0] = static_cast<WCHAR>(cp);
+        }
+
+        if (dstLen > 0) {
+            if (written + count > static_cast<size_t>(dstLen)) return 0;
+            for (size_t k = 0; k < count; ++k) dst[written + k] = units[k];
+        }
+        written += count;
+    }
+    return static_cast<int>(written);
+}
+
+int WideCharToMultiByte(UINT, DWORD, LPCWSTR src, int srcLen, LPSTR dst, int dstLen,
+                        LPCSTR, BOOL* usedDefaultChar)
+{
+    if (usedDefaultChar) *usedDefaultChar = FALSE;
+    if (!src) return 0;
+    size_t n = srcLen < 0 ? wcslen(src) + 1 : static_cast<size_t>(srcLen);
+
+    size_t written = 0;
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t cp = static_cast<uint32_t>(src[i]);
+        if (sizeof(WCHAR) == 2 && cp >= 0xD800 && cp <= 0xDBFF && i + 1 < n) {
+            uint32_t low = static_cast<uint32_t>(src[i + 1]);
+            if (low >= 0xDC00 && low <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                ++i;
+            }
+        }
+        if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+            cp = kReplacementChar;
+        }
+
+        char bytes[4];
+        size_t count = EncodeUtf8(cp, bytes);
+        if (dstLen > 0) {
+            if (written + count > static_cast<size_t>(dstLen)) return 0;
+            memcpy(dst + written, bytes, count);
+        }
+        written += count;
+    }
+    return static_cast<int>(written);
+}
+
+//=============================================================================
+// 시각 / 프로세스 정보
+//=============================================================================
+
+BOOL QueryPerformanceCounter(LARGE_INTEGER* count)
+{
+    if (!count) return FALSE;
+    count->QuadPart = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    return TRUE;
+}
+
+BOOL QueryPerformanceFrequency(LARGE_INTEGER* frequency)
+{
+    if (!frequency) return FALSE;
+    frequency->QuadPart = 1000000000LL;     // ns 단위 틱
+    return TRUE;
+}
+
+DWORD GetCurrentThreadId()
+{
+#if defined(__linux__)
+    return static_cast<DWORD>(syscall(SYS_gettid));
+#else
+    return static_cast<DWORD>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+}
+
+DWORD GetCurrentProcessId()
+{
+    return static_cast<DWORD>(getpid());
+}
+
+#endif // !_WIN32
@@ -0,0 +1,17 @@
+/**
+ * @file ComPlatform.h
+ * @brief COM 타입 포함 지점 (Windows SDK 또는 이식용 ComAbi)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 소스 파일은 <Windows.h>/<oleauto.h> 대신 이 헤더를 포함한다.
+ * Windows에서는 SDK 헤더를, 그 밖의 환경에서는 ComAbi.h의 최소 정의를 쓴다.
+ */
+
+#pragma once
+
+#if defined(_WIN32)
+#include <Windows.h>
+#include <oleauto.h>
+#else
+#include "ComAbi.h"
+#endif
@@ -0,0 +1,184 @@
+/**
+ * @file ComScope.cpp
+ * @brief VARIANT/BSTR RAII 타입과 BSTR 재사용 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "ComScope.h"
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace cpyhwpx {
+
+//=============================================================================
+// 상수 이름 BSTR
+//=============================================================================
+
+BSTR InternBstr(const wchar_t* literal)
+{
+    // 프로세스 종료 시까지 해제하지 않음 (COM 종료 이후 해제 방지)
+    static std::mutex s_mutex;
+    static auto* s_table = new std::unordered_map<std::wstring, BSTR>();
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    auto it = s_table->find(literal);
+    if (it != s_table->end()) {
+        return it->second;
+    }
+    BSTR bstr = SysAllocString(literal);
+    s_table->emplace(literal, bstr);
+    return bstr;
+}
+
+//=============================================================================
+// 스레드 로컬 BSTR 풀
+//=============================================================================
+
+namespace {
+
+constexpr size_t kPoolMaxEntries = 16;
+constexpr UINT kPoolMaxChars = 256;     // 이보다 긴 BSTR은 풀에 넣지 않음
+
+struct BstrPool {
+    std::vector<BSTR> free;
+
+    ~BstrPool()
+    {
+        for (BSTR b : free) {
+            SysFreeString(b);
+        }
+    }
+
+    BSTR Acquire(const wchar_t* data, UINT len)
+    {
+        if (len <= kPoolMaxChars && !free.empty()) {
+            BSTR b = free.back();
+            free.pop_back();
+            // 풀 항목은 kPoolMaxChars 이하이므로 보통 제자리 재할당
+            if (SysReAllocStringLen(&b, data, len)) {
+                return b;
+            }
+            SysFreeString(b);
+        }
+        return SysAllocStringLen(data, len);
+    }
+
+    void Release(BSTR b)
+    {
+        if (!b) return;
+        if (SysStringLen(b) <= kPoolMaxChars && free.size() < kPoolMaxEntries) {
+            free.push_back(b);
+        } else {
+            SysFreeString(b);
+        }
+    }
+};
+
+BstrPool& ThreadPool()
+{
+    thread_local BstrPool pool;
+    return pool;
+}
+
+} // namespace
+
+//=============================================================================
+// ScopedBstr
+//=============================================================================
+
+ScopedBstr::ScopedBstr(const std::wstring& str)
+    : m_bstr(ThreadPool().Acquire(str.c_str(), static_cast<UINT>(str.size())))
+{
+}
+
+ScopedBstr::ScopedBstr(const wchar_t* data, size_t len)
+    : m_bstr(ThreadPool().Acquire(data, static_cast<UINT>(len)))
+{
+}
+
+ScopedBstr::~ScopedBstr()
+{
+    ThreadPool().Release(m_bstr);
+}
+
+ScopedBstr& ScopedBstr::operator=(ScopedBstr&& other) noexcept
+{
+    if (this != &other) {
+        ThreadPool().Release(m_bstr);
+        m_bstr = other.m_bstr;
+        other.m_bstr = nullptr;
+    }
+    return *this;
+}
+
+BSTR ScopedBstr::Detach()
+{
+    BSTR b = m_bstr;
+    m_bstr = nullptr;
+    return b;
+}
+
+//=============================================================================
+// ScopedVariant
+//=============================================================================
+
+int ScopedVariant::ToInt(int default_value) const
+{
+    switch (m_var.vt) {
+    case VT_I4:   return m_var.lVal;
+    case VT_I2:   return m_var.iVal;
+    case VT_UI4:  return static_cast<int>(m_var.ulVal);
+    case VT_INT:  return m_var.intVal;
+    case VT_BOOL: return m_var.boolVal != VARIANT_FALSE ? 1 : 0;
+    default:      return default_value;
+    }
+}
+
+double ScopedVariant::ToDouble(double default_value) const
+{
+    switch (m_var.vt) {
+    case VT_R8:  return m_var.dblVal;
+    case VT_R4:  return m_var.fltVal;
+    case VT_I4:  return m_var.lVal;
+    case VT_I2:  return m_var.iVal;
+    default:     return default_value;
+    }
+}
+
+bool ScopedVariant::ToBool(bool default_value) const
+{
+    switch (m_var.vt) {
+    case VT_BOOL: return m_var.boolVal != VARIANT_FALSE;
+    case VT_I4:   return m_var.lVal != 0;
+    case VT_I2:   return m_var.iVal != 0;
+    default:      return default_value;
+    }
+}
+
+std::wstring ScopedVariant::ToString() const
+{
+    if (m_var.vt == VT_BSTR && m_var.bstrVal) {
+        return std::wstring(m_var.bstrVal, SysStringLen(m_var.bstrVal));
+    }
+    return L"";
+}
+
+IDispatch* ScopedVariant::DetachDispatch()
+{
+    if (m_var.vt != VT_DISPATCH) return nullptr;
+    IDispatch* p = m_var.pdispVal;
+    m_var.pdispVal = nullptr;
+    m_var.vt = VT_EMPTY;
+    return p;
+}
+
+VARIANT ScopedVariant::Detach()
+{
+    VARIANT v = m_var;
+    VariantInit(&m_var);
+    return v;
+}
+
+} // namespace cpyhwpx
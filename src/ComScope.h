@@ -0,0 +1,174 @@
+/**
+ * @file ComScope.h
+ * @brief VARIANT/BSTR RAII 타입과 BSTR 재사용
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 수동 VariantClear/SysFreeString 누락으로 인한 누수를 막고
+ * 상수 이름 BSTR의 반복 할당을 없앤다.
+ */
+
+#pragma once
+
+#include "ComPlatform.h"
+#include <string>
+
+namespace cpyhwpx {
+
+//=============================================================================
+// 상수 이름 BSTR (프로세스 수명)
+//=============================================================================
+
+/**
+ * @brief 상수 문자열의 BSTR을 한 번만 만들어 프로세스 수명 동안 재사용
+ *
+ * 호출 측에서 함수 내 static으로 받아 두면 이후 호출은 할당이 없다.
+ *     static const BSTR s_name = InternBstr(L"InsertText");
+ * 반환된 BSTR은 절대 해제하면 안 된다 (VariantClear 금지).
+ */
+BSTR InternBstr(const wchar_t* literal);
+
+//=============================================================================
+// ScopedBstr
+//=============================================================================
+
+/**
+ * @class ScopedBstr
+ * @brief 임시 인자용 BSTR 소유 래퍼 (스레드 로컬 풀 사용)
+ *
+ * 소멸 시 짧은 BSTR은 스레드 로컬 풀에 반환되어 다음 할당에 재사용된다.
+ */
+class ScopedBstr {
+public:
+    ScopedBstr() = default;
+    explicit ScopedBstr(const std::wstring& str);
+    ScopedBstr(const wchar_t* data, size_t len);
+    ~ScopedBstr();
+
+    // 복사 금지, 이동 허용
+    ScopedBstr(const ScopedBstr&) = delete;
+    ScopedBstr& operator=(const ScopedBstr&) = delete;
+    ScopedBstr(ScopedBstr&& other) noexcept : m_bstr(other.m_bstr) { other.m_bstr = nullptr; }
+    ScopedBstr& operator=(ScopedBstr&& other) noexcept;
+
+    BSTR get() const { return m_bstr; }
+
+    /**
+     * @brief 소유권 반환 (호출자가 SysFreeString 책임)
+     */
+    BSTR Detach();
+
+private:
+    BSTR m_bstr = nullptr;
+};
+
+//=============================================================================
+// ScopedVariant
+//=============================================================================
+
+/**
+ * @class ScopedVariant
+ * @brief 소멸 시 VariantClear 하는 VARIANT 래퍼
+ *
+ * Invoke 결과 수신용. 인터페이스 포인터/BSTR 결과가 어느 경로로 빠져나가도
+ * 참조와 메모리가 해제된다.
+ */
+class ScopedVariant {
+public:
+    ScopedVariant() { VariantInit(&m_var); }
+
+    /**
+     * @brief VARIANT 반환 API의 결과 소유권을 넘겨받음
+     */
+    explicit ScopedVariant(const VARIANT& owned) : m_var(owned) {}
+
+    ~ScopedVariant() { VariantClear(&m_var); }
+
+    // 복사 금지
+    ScopedVariant(const ScopedVariant&) = delete;
+    ScopedVariant& operator=(const ScopedVariant&) = delete;
+
+    /**
+     * @brief Invoke의 pVarResult로 넘길 포인터 (기존 값은 해제)
+     */
+    VARIANT* Receive()
+    {
+        VariantClear(&m_var);
+        return &m_var;
+    }
+
+    const VARIANT& get() const { return m_var; }
+    VARTYPE vt() const { return m_var.vt; }
+
+    //=========================================================================
+    // 값 변환
+    //=========================================================================
+
+    /**
+     * @brief 정수 값 (VT_I4/VT_I2/VT_UI4/VT_BOOL, 그 외 default_value)
+     */
+    int ToInt(int default_value = 0) const;
+
+    /**
+     * @brief 실수 값 (VT_R8/VT_R4/정수형, 그 외 default_value)
+     */
+    double ToDouble(double default_value = 0.0) const;
+
+    /**
+     * @brief 불리언 값 (VT_BOOL/정수형, 그 외 default_value)
+     */
+    bool ToBool(bool default_value = false) const;
+
+    /**
+     * @brief 문자열 값 (VT_BSTR, 그 외 빈 문자열)
+     */
+    std::wstring ToString() const;
+
+    /**
+     * @brief IDispatch 결과의 참조를 넘겨받음 (호출자가 Release 책임)
+     */
+    IDispatch* DetachDispatch();
+
+    /**
+     * @brief 내부 VARIANT 소유권 반환 (기존 VARIANT 반환 API 호환용)
+     */
+    VARIANT Detach();
+
+private:
+    VARIANT m_var;
+};
+
+//=============================================================================
+// 빌린 값 인자 (해제하지 않음)
+//=============================================================================
+
+/**
+ * @brief BSTR을 빌려 쓰는 인자 VARIANT (InternBstr/ScopedBstr 소유 유지)
+ */
+inline VARIANT BstrArg(BSTR value)
+{
+    VARIANT v;
+    VariantInit(&v);
+    v.vt = VT_BSTR;
+    v.bstrVal = value;
+    return v;
+}
+
+inline VARIANT IntArg(int value)
+{
+    VARIANT v;
+    VariantInit(&v);
+    v.vt = VT_I4;
+    v.lVal = value;
+    return v;
+}
+
+inline VARIANT DispatchArg(IDispatch* value)
+{
+    VARIANT v;
+    VariantInit(&v);
+    v.vt = VT_DISPATCH;
+    v.pdispVal = value;
+    return v;
+}
+
+} // namespace cpyhwpx
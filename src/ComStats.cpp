@@ -0,0 +1,400 @@
+/**
+ * @file ComStats.cpp
+ * @brief COM 호출 계측 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "ComStats.h"
+#include "ComTrace.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+
+namespace cpyhwpx {
+
+std::atomic<bool> ComStats::s_enabled{ false };
+
+namespace {
+
+constexpr size_t kMaxLabels = 4096;     // 넘으면 자동 부여된 이름만 비움
+
+//=============================================================================
+// 누적기
+//=============================================================================
+
+struct Accum {
+    uint64_t calls = 0;
+    uint64_t failures = 0;
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+    uint64_t bstr_out = 0;
+    uint64_t bstr_in = 0;
+    uint64_t hist[ComStats::kHistogramBuckets] = {};
+
+    void Merge(const Accum& other)
+    {
+        calls += other.calls;
+        failures += other.failures;
+        total_ns += other.total_ns;
+        max_ns = (std::max)(max_ns, other.max_ns);
+        bstr_out += other.bstr_out;
+        bstr_in += other.bstr_in;
+        for (int i = 0; i < ComStats::kHistogramBuckets; ++i) {
+            hist[i] += other.hist[i];
+        }
+    }
+};
+
+// 키: 인터페이스 \x1f 멤버 \x1f 종류
+using AccumMap = std::unordered_map<std::wstring, Accum>;
+
+const wchar_t kKeySep = L'\x1f';
+const wchar_t kKindInvoke = L'I';
+const wchar_t kKindGetIDs = L'N';
+
+std::wstring MakeKey(const std::wstring& iface, const std::wstring& member, wchar_t kind)
+{
+    std::wstring key;
+    key.reserve(iface.size() + member.size() + 3);
+    key += iface;
+    key += kKeySep;
+    key += member;
+    key += kKeySep;
+    key += kind;
+    return key;
+}
+
+struct Label {
+    std::wstring name;
+    bool pinned;    // Label()로 직접 지정한 이름은 비우지 않음
+};
+
+struct MemberKeyHash {
+    size_t operator()(const std::pair<std::wstring, DISPID>& k) const
+    {
+        return std::hash<std::wstring>()(k.first) ^ (static_cast<size_t>(k.second) * 0x9E3779B1u);
+    }
+};
+
+struct ThreadStats;
+
+/**
+ * @brief 살아 있는 스레드 누적기 목록과 종료된 스레드의 합계
+ *
+ * 프로세스 종료 중 thread_local 소멸 순서 문제를 피하려고 해제하지 않는다.
+ */
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadStats*> threads;
+    AccumMap retired;
+};
+
+Registry& GetRegistry()
+{
+    static Registry* s_registry = new Registry();
+    return *s_registry;
+}
+
+struct ThreadStats {
+    std::mutex mutex;       // 기록 스레드와 Snapshot/Reset만 경합
+    AccumMap entries;
+
+    // 이름 정보는 이 스레드에서만 사용 (잠금 불필요)
+    std::unordered_map<IDispatch*, Label> labels;
+    std::unordered_map<std::pair<std::wstring, DISPID>, std::wstring, MemberKeyHash> members;
+
+    ThreadStats()
+    {
+        Registry& reg = GetRegistry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.threads.push_back(this);
+    }
+
+    ~ThreadStats()
+    {
+        Registry& reg = GetRegistry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.threads.erase(std::remove(reg.threads.begin(), reg.threads.end(), this),
+                          reg.threads.end());
+        for (const auto& kv : entries) {
+            reg.retired[kv.first].Merge(kv.second);
+        }
+    }
+
+    const std::wstring& LabelOf(IDispatch* obj)
+    {
+        static const std::wstring s_unknown = L"IDispatch";
+        auto it = labels.find(obj);
+        return it != labels.end() ? it->second.name : s_unknown;
+    }
+
+    void SetLabel(IDispatch* obj, const std::wstring& name, bool pinned)
+    {
+        if (labels.size() >= kMaxLabels) {
+            for (auto it = labels.begin(); it != labels.end();) {
+                it = it->second.pinned ? std::next(it) : labels.erase(it);
+            }
+        }
+        auto& label = labels[obj];
+        if (!label.pinned || pinned) {
+            label.name = name;
+            label.pinned = pinned;
+        }
+    }
+
+    void Record(const std::wstring& key, uint64_t ns, bool failed,
+                uint64_t bstr_out, uint64_t bstr_in)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Accum& a = entries[key];
+        ++a.calls;
+        if (failed) ++a.failures;
+        a.total_ns += ns;
+        a.max_ns = (std::max)(a.max_ns, ns);
+        a.bstr_out += bstr_out;
+        a.bstr_in += bstr_in;
+
+        // 로그 구간: 0 = 1µs 미만, i = [2^(i-1), 2^i) µs
+        uint64_t us = ns / 1000;
+        int bucket = 0;
+        while (us && bucket < ComStats::kHistogramBuckets - 1) {
+            us >>= 1;
+            ++bucket;
+        }
+        ++a.hist[bucket];
+    }
+};
+
+ThreadStats& Local()
+{
+    thread_local ThreadStats stats;
+    return stats;
+}
+
+//=============================================================================
+// 시간/크기 측정
+//=============================================================================
+
+uint64_t TicksToNs(uint64_t ticks)
+{
+    static const uint64_t s_freq = [] {
+        LARGE_INTEGER f;
+        QueryPerformanceFrequency(&f);
+        return static_cast<uint64_t>(f.QuadPart);
+    }();
+    // 오버플로 방지를 위해 몫/나머지 분리
+    return (ticks / s_freq) * 1000000000ull + (ticks % s_freq) * 1000000000ull / s_freq;
+}
+
+uint64_t BstrBytes(const VARIANT& v)
+{
+    switch (v.vt) {
+    case VT_BSTR:
+        return v.bstrVal ? SysStringByteLen(v.bstrVal) : 0;
+    case VT_BSTR | VT_BYREF:
+        return (v.pbstrVal && *v.pbstrVal) ? SysStringByteLen(*v.pbstrVal) : 0;
+    case VT_VARIANT | VT_BYREF:
+        return v.pvarVal ? BstrBytes(*v.pvarVal) : 0;
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief HAction.Run/Execute의 첫 번째 인자 (액션 ID), 없으면 nullptr
+ */
+const VARIANT* ActionIdArg(const std::wstring& iface, const std::wstring& member,
+                           const DISPPARAMS* params)
+{
+    if (!params || params->cArgs == 0) return nullptr;
+    if (iface != L"HAction" || (member != L"Run" && member != L"Execute")) return nullptr;
+    // 인자는 역순으로 들어 있음
+    const VARIANT& first = params->rgvarg[params->cArgs - 1];
+    return (first.vt == VT_BSTR && first.bstrVal) ? &first : nullptr;
+}
+
+} // namespace
+
+//=============================================================================
+// ComCallStat
+//=============================================================================
+
+double ComCallStat::Percentile(double p) const
+{
+    uint64_t total = 0;
+    for (uint64_t n : histogram) total += n;
+    if (total == 0) return 0.0;
+
+    p = (std::min)((std::max)(p, 0.0), 1.0);
+    uint64_t target = (std::max)(uint64_t(1), static_cast<uint64_t>(std::ceil(p * total)));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < histogram.size(); ++i) {
+        seen += histogram[i];
+        if (seen >= target) {
+            return std::ldexp(1.0, static_cast<int>(i));   // 구간 상한 2^i µs
+        }
+    }
+    return std::ldexp(1.0, static_cast<int>(histogram.size()) - 1);
+}
+
+//=============================================================================
+// ComStats
+//=============================================================================
+
+void ComStats::SetEnabled(bool enabled)
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void ComStats::Reset()
+{
+    Registry& reg = GetRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (ThreadStats* t : reg.threads) {
+        std::lock_guard<std::mutex> tlock(t->mutex);
+        t->entries.clear();
+    }
+    reg.retired.clear();
+}
+
+std::vector<ComCallStat> ComStats::Snapshot()
+{
+    AccumMap merged;
+    {
+        Registry& reg = GetRegistry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        merged = reg.retired;
+        for (ThreadStats* t : reg.threads) {
+            std::lock_guard<std::mutex> tlock(t->mutex);
+            for (const auto& kv : t->entries) {
+                merged[kv.first].Merge(kv.second);
+            }
+        }
+    }
+
+    std::vector<ComCallStat> stats;
+    stats.reserve(merged.size());
+    for (const auto& kv : merged) {
+        const std::wstring& key = kv.first;
+        size_t sep1 = key.find(kKeySep);
+        size_t sep2 = key.find(kKeySep, sep1 + 1);
+
+        ComCallStat s;
+        s.interface_name = key.substr(0, sep1);
+        s.member = key.substr(sep1 + 1, sep2 - sep1 - 1);
+        s.kind = (key[sep2 + 1] == kKindInvoke) ? L"Invoke" : L"GetIDsOfNames";
+        s.calls = kv.second.calls;
+        s.failures = kv.second.failures;
+        s.total_ns = kv.second.total_ns;
+        s.max_ns = kv.second.max_ns;
+        s.bstr_bytes_out = kv.second.bstr_out;
+        s.bstr_bytes_in = kv.second.bstr_in;
+        s.histogram.assign(kv.second.hist, kv.second.hist + kHistogramBuckets);
+        stats.push_back(std::move(s));
+    }
+
+    std::sort(stats.begin(), stats.end(), [](const ComCallStat& a, const ComCallStat& b) {
+        if (a.calls != b.calls) return a.calls > b.calls;
+        return a.total_ns > b.total_ns;
+    });
+    return stats;
+}
+
+void ComStats::Label(IDispatch* obj, const wchar_t* name)
+{
+    if (!obj || !name) return;
+    Local().SetLabel(obj, name, true);
+}
+
+void ComStats::NameMember(IDispatch* obj, DISPID dispid, const std::wstring& name)
+{
+    if (!obj) return;
+    ThreadStats& local = Local();
+    local.members.emplace(std::make_pair(local.LabelOf(obj), dispid), name);
+}
+
+HRESULT ComStats::TracedInvoke(IDispatch* obj, DISPID dispid, WORD flags,
+                               DISPPARAMS* params, VARIANT* result,
+                               EXCEPINFO* excepInfo, UINT* argErr)
+{
+    ThreadStats& local = Local();
+    const bool stats = IsEnabled();
+
+    uint64_t bstr_out = 0;
+    if (stats && params) {
+        for (UINT i = 0; i < params->cArgs; ++i) {
+            bstr_out += BstrBytes(params->rgvarg[i]);
+        }
+    }
+
+    uint64_t start = ComTrace::Now();
+    HRESULT hr = obj->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, flags,
+                             params, result, excepInfo, argErr);
+    uint64_t end = ComTrace::Now();
+
+    // 멤버 이름은 (인터페이스, DISPID)로 찾음 (GetIDsOfNames 때 기록)
+    std::wstring iface = local.LabelOf(obj);
+    std::wstring member;
+    auto it = local.members.find(std::make_pair(iface, dispid));
+    if (it != local.members.end()) {
+        member = it->second;
+    } else {
+        member = L"#" + std::to_wstring(dispid);
+    }
+
+    uint64_t bstr_in = 0;
+    if (SUCCEEDED(hr) && result) {
+        bstr_in = BstrBytes(*result);
+        // 반환된 객체에는 만든 멤버 이름을 인터페이스 이름으로 부여
+        if (result->vt == VT_DISPATCH && result->pdispVal) {
+            local.SetLabel(result->pdispVal, member, false);
+        }
+    }
+
+    if (stats) {
+        local.Record(MakeKey(iface, member, kKindInvoke), TicksToNs(end - start),
+                     FAILED(hr), bstr_out, bstr_in);
+    }
+
+    if (ComTrace::IsEnabled()) {
+        std::wstring name = iface + L"." + member;
+        ComTrace::Record(ComTrace::Com, name.c_str(), name.size(), start, end);
+
+        if (const VARIANT* actionId = ActionIdArg(iface, member, params)) {
+            ComTrace::Record(ComTrace::Action, actionId->bstrVal,
+                             SysStringLen(actionId->bstrVal), start, end);
+        }
+    }
+    return hr;
+}
+
+HRESULT ComStats::TracedGetIDsOfNames(IDispatch* obj, LPOLESTR* names,
+                                      UINT count, DISPID* dispids)
+{
+    ThreadStats& local = Local();
+
+    uint64_t start = ComTrace::Now();
+    HRESULT hr = obj->GetIDsOfNames(IID_NULL, names, count, LOCALE_USER_DEFAULT, dispids);
+    uint64_t end = ComTrace::Now();
+
+    std::wstring iface = local.LabelOf(obj);
+    std::wstring member = (count > 0 && names[0]) ? names[0] : L"";
+    if (SUCCEEDED(hr) && count > 0) {
+        local.members[std::make_pair(iface, dispids[0])] = member;
+    }
+
+    if (IsEnabled()) {
+        local.Record(MakeKey(iface, member, kKindGetIDs), TicksToNs(end - start),
+                     FAILED(hr), 0, 0);
+    }
+
+    if (ComTrace::IsEnabled()) {
+        std::wstring name = iface + L".GetIDsOfNames(" + member + L")";
+        ComTrace::Record(ComTrace::Com, name.c_str(), name.size(), start, end);
+    }
+    return hr;
+}
+
+} // namespace cpyhwpx
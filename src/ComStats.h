@@ -0,0 +1,150 @@
+/**
+ * @file ComStats.h
+ * @brief COM 호출 계측 (멤버별 호출 수, 지연 히스토그램, BSTR 전송량)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 모든 IDispatch::Invoke/GetIDsOfNames 호출은 ComInvoke/ComGetIDsOfNames를 거친다.
+ * 계측과 추적(ComTrace)이 모두 꺼져 있으면 원자적 플래그만 확인하고 바로 호출한다.
+ */
+
+#pragma once
+
+#include "ComPlatform.h"
+#include "ComTrace.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// CPYHWPX_COM_STATS=0 으로 빌드하면 계측 코드 자체가 빠진다
+#ifndef CPYHWPX_COM_STATS
+#define CPYHWPX_COM_STATS 1
+#endif
+
+namespace cpyhwpx {
+
+/**
+ * @struct ComCallStat
+ * @brief (인터페이스, 멤버, 종류)별 누적 통계
+ */
+struct ComCallStat {
+    std::wstring interface_name;    // 객체를 만든 속성/메서드 이름 (루트는 "HwpObject")
+    std::wstring member;            // 멤버 이름 (모르면 "#<dispid>")
+    std::wstring kind;              // "Invoke" 또는 "GetIDsOfNames"
+    uint64_t calls = 0;
+    uint64_t failures = 0;          // FAILED(hr) 횟수
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+    uint64_t bstr_bytes_out = 0;    // 인자로 COM에 넘긴 BSTR 바이트
+    uint64_t bstr_bytes_in = 0;     // 결과로 받은 BSTR 바이트
+
+    /**
+     * @brief 로그 구간 지연 히스토그램
+     *
+     * histogram[0]은 1µs 미만, histogram[i]는 [2^(i-1), 2^i) µs 구간.
+     * 마지막 구간은 그 이상 전부.
+     */
+    std::vector<uint64_t> histogram;
+
+    /**
+     * @brief 히스토그램에서 백분위 지연 추정 (구간 상한, µs)
+     * @param p 0.0 ~ 1.0
+     */
+    double Percentile(double p) const;
+};
+
+/**
+ * @class ComStats
+ * @brief COM 호출 계측 전역 상태
+ *
+ * 스레드마다 자기 누적기에만 기록하고 Snapshot 시점에 합친다.
+ * 프로세스 전역이므로 여러 Hwp 인스턴스의 호출이 함께 집계된다.
+ */
+class ComStats {
+public:
+    static constexpr int kHistogramBuckets = 24;
+
+    /**
+     * @brief 계측 켜기/끄기 (기본값 꺼짐)
+     */
+    static void SetEnabled(bool enabled);
+
+    static bool IsEnabled()
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 모든 스레드의 누적값 초기화
+     */
+    static void Reset();
+
+    /**
+     * @brief 모든 스레드의 누적값을 합친 스냅샷 (호출 수 내림차순)
+     */
+    static std::vector<ComCallStat> Snapshot();
+
+    /**
+     * @brief 객체에 인터페이스 이름 지정
+     *
+     * 계측 중에는 Invoke가 돌려준 IDispatch에 그 멤버 이름이 자동으로 붙는다.
+     * 루트 객체처럼 Invoke 밖에서 얻은 객체는 직접 지정한다.
+     */
+    static void Label(IDispatch* obj, const wchar_t* name);
+
+    /**
+     * @brief 멤버 이름 등록 (이미 있으면 그대로)
+     *
+     * 캐시된 DISPID는 GetIDsOfNames를 다시 거치지 않으므로, 계측을 나중에 켜도
+     * "#DISPID" 대신 이름이 나오도록 캐시 적중 시 호출한다.
+     */
+    static void NameMember(IDispatch* obj, DISPID dispid, const std::wstring& name);
+
+    /**
+     * @brief 계측/추적 경로 (둘 중 하나라도 켜져 있을 때만 호출)
+     */
+    static HRESULT TracedInvoke(IDispatch* obj, DISPID dispid, WORD flags,
+                                DISPPARAMS* params, VARIANT* result,
+                                EXCEPINFO* excepInfo, UINT* argErr);
+
+    static HRESULT TracedGetIDsOfNames(IDispatch* obj, LPOLESTR* names,
+                                       UINT count, DISPID* dispids);
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+//=============================================================================
+// 호출 진입점
+//=============================================================================
+
+/**
+ * @brief IDispatch::Invoke (IID_NULL, LOCALE_USER_DEFAULT 고정)
+ */
+inline HRESULT ComInvoke(IDispatch* obj, DISPID dispid, WORD flags,
+                         DISPPARAMS* params, VARIANT* result,
+                         EXCEPINFO* excepInfo = NULL, UINT* argErr = NULL)
+{
+#if CPYHWPX_COM_STATS
+    if (ComStats::IsEnabled() || ComTrace::IsEnabled()) {
+        return ComStats::TracedInvoke(obj, dispid, flags, params, result, excepInfo, argErr);
+    }
+#endif
+    return obj->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, flags,
+                       params, result, excepInfo, argErr);
+}
+
+/**
+ * @brief IDispatch::GetIDsOfNames (IID_NULL, LOCALE_USER_DEFAULT 고정)
+ */
+inline HRESULT ComGetIDsOfNames(IDispatch* obj, LPOLESTR* names, UINT count, DISPID* dispids)
+{
+#if CPYHWPX_COM_STATS
+    if (ComStats::IsEnabled() || ComTrace::IsEnabled()) {
+        return ComStats::TracedGetIDsOfNames(obj, names, count, dispids);
+    }
+#endif
+    return obj->GetIDsOfNames(IID_NULL, names, count, LOCALE_USER_DEFAULT, dispids);
+}
+
+} // namespace cpyhwpx
@@ -0,0 +1,274 @@
+/**
+ * @file ComTrace.cpp
+ * @brief Chrome trace-event 형식 호출 추적 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "ComTrace.h"
+#include "Utils.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cpyhwpx {
+
+std::atomic<bool> ComTrace::s_enabled{ false };
+
+namespace {
+
+constexpr size_t kNameMax = 128;        // UTF-8 바이트 (NUL 포함)
+
+/**
+ * @brief 링 버퍼 슬롯 (seqlock: 홀수 seq = 쓰는 중)
+ */
+struct Slot {
+    std::atomic<uint32_t> seq{ 0 };
+    uint8_t category = 0;
+    uint64_t start = 0;
+    uint64_t end = 0;
+    char name[kNameMax] = {};
+};
+
+struct Ring {
+    DWORD tid = 0;
+    size_t capacity = 0;
+    uint32_t generation = 0;
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<uint64_t> head{ 0 };    // 지금까지 기록한 이벤트 수
+};
+
+/**
+ * @brief 링 목록은 스레드 종료 후에도 덤프할 수 있도록 공유 소유
+ */
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Ring>> rings;
+    size_t capacity = 65536;
+    uint64_t origin = 0;                // 추적 시작 시각 (ts 기준점)
+    std::atomic<uint32_t> generation{ 1 };
+};
+
+TraceRegistry& GetRegistry()
+{
+    static TraceRegistry* s_registry = new TraceRegistry();
+    return *s_registry;
+}
+
+Ring& LocalRing()
+{
+    thread_local std::shared_ptr<Ring> t_ring;
+
+    TraceRegistry& reg = GetRegistry();
+    uint32_t generation = reg.generation.load(std::memory_order_acquire);
+    if (!t_ring || t_ring->generation != generation) {
+        // Start/Clear 이후 첫 기록: 새 링 생성 (스레드당 한 번)
+        auto ring = std::make_shared<Ring>();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        ring->tid = GetCurrentThreadId();
+        ring->capacity = reg.capacity;
+        ring->generation = reg.generation.load(std::memory_order_relaxed);
+        ring->slots.reset(new Slot[ring->capacity]);
+        reg.rings.push_back(ring);
+        t_ring = std::move(ring);
+    }
+    return *t_ring;
+}
+
+void Write(Ring& ring, ComTrace::Category category, const char* name, size_t nameLen,
+           uint64_t start, uint64_t end)
+{
+    uint64_t h = ring.head.load(std::memory_order_relaxed);
+    Slot& slot = ring.slots[h % ring.capacity];
+
+    uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.category = category;
+    slot.start = start;
+    slot.end = end;
+    nameLen = (std::min)(nameLen, kNameMax - 1);
+    memcpy(slot.name, name, nameLen);
+    slot.name[nameLen] = '\0';
+
+    slot.seq.store(seq + 2, std::memory_order_release);
+    ring.head.store(h + 1, std::memory_order_release);
+}
+
+struct EventCopy {
+    uint8_t category;
+    uint64_t start;
+    uint64_t end;
+    char name[kNameMax];
+};
+
+const char* CategoryName(uint8_t category)
+{
+    switch (category) {
+    case ComTrace::Api:    return "api";
+    case ComTrace::Com:    return "com";
+    case ComTrace::Action: return "action";
+    default:               return "other";
+    }
+}
+
+} // namespace
+
+//=============================================================================
+// 제어
+//=============================================================================
+
+void ComTrace::Start(size_t events_per_thread)
+{
+    TraceRegistry& reg = GetRegistry();
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.rings.clear();
+        reg.capacity = (std::max)(events_per_thread, size_t(16));
+        reg.origin = Now();
+        reg.generation.fetch_add(1, std::memory_order_acq_rel);
+    }
+    s_enabled.store(true, std::memory_order_relaxed);
+}
+
+void ComTrace::Stop()
+{
+    s_enabled.store(false, std::memory_order_relaxed);
+}
+
+void ComTrace::Clear()
+{
+    TraceRegistry& reg = GetRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.rings.clear();
+    reg.origin = Now();
+    reg.generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+//=============================================================================
+// 기록
+//=============================================================================
+
+void ComTrace::Record(Category category, const char* name, uint64_t start, uint64_t end)
+{
+    if (!name) name = "";
+    Write(LocalRing(), category, name, strlen(name), start, end);
+}
+
+void ComTrace::Record(Category category, const wchar_t* name, size_t len,
+                      uint64_t start, uint64_t end)
+{
+    char utf8[kNameMax];
+    int n = 0;
+    if (len > 0) {
+        n = WideCharToMultiByte(CP_UTF8, 0, name, static_cast<int>(len),
+                                utf8, static_cast<int>(kNameMax - 1), NULL, NULL);
+        if (n == 0) {
+            // 버퍼 초과: 최악의 경우(3바이트/문자)에도 들어가는 길이로 잘라 다시 변환
+            int fit = static_cast<int>((std::min)(len, (kNameMax - 1) / 3));
+            n = WideCharToMultiByte(CP_UTF8, 0, name, fit,
+                                    utf8, static_cast<int>(kNameMax - 1), NULL, NULL);
+        }
+    }
+    Write(LocalRing(), category, utf8, static_cast<size_t>(n), start, end);
+}
+
+//=============================================================================
+// 출력
+//=============================================================================
+
+std::string ComTrace::ToJson()
+{
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    const double ticksPerUs = static_cast<double>(freq.QuadPart) / 1e6;
+    const DWORD pid = GetCurrentProcessId();
+
+    std::vector<std::shared_ptr<Ring>> rings;
+    uint64_t origin;
+    {
+        TraceRegistry& reg = GetRegistry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        rings = reg.rings;
+        origin = reg.origin;
+    }
+
+    std::string out;
+    out.reserve(256 + rings.size() * 4096);
+    out += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    char buf[256];
+    snprintf(buf, sizeof(buf),
+             "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%lu,\"tid\":0,"
+             "\"args\":{\"name\":\"cpyhwpx\"}}", static_cast<unsigned long>(pid));
+    out += buf;
+
+    std::vector<EventCopy> events;
+    for (const auto& ring : rings) {
+        snprintf(buf, sizeof(buf),
+                 ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%lu,\"tid\":%lu,"
+                 "\"args\":{\"name\":\"thread %lu\"}}",
+                 static_cast<unsigned long>(pid), static_cast<unsigned long>(ring->tid),
+                 static_cast<unsigned long>(ring->tid));
+        out += buf;
+
+        // 기록 중인 슬롯과 읽는 사이 덮어쓰인 슬롯은 건너뜀
+        uint64_t head = ring->head.load(std::memory_order_acquire);
+        uint64_t count = (std::min)(head, static_cast<uint64_t>(ring->capacity));
+        events.clear();
+        events.reserve(static_cast<size_t>(count));
+        for (uint64_t i = head - count; i < head; ++i) {
+            const Slot& slot = ring->slots[i % ring->capacity];
+            uint32_t seq1 = slot.seq.load(std::memory_order_acquire);
+            if (seq1 & 1) continue;
+
+            EventCopy e;
+            e.category = slot.category;
+            e.start = slot.start;
+            e.end = slot.end;
+            memcpy(e.name, slot.name, kNameMax);
+            e.name[kNameMax - 1] = '\0';
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != seq1) continue;
+            events.push_back(e);
+        }
+
+        for (const EventCopy& e : events) {
+            double ts = (static_cast<double>(e.start) - static_cast<double>(origin)) / ticksPerUs;
+            double dur = static_cast<double>(e.end - e.start) / ticksPerUs;
+
+            out += ",\n{\"name\":\"";
+            Utils::AppendJsonEscaped(out, e.name, strlen(e.name));
+            snprintf(buf, sizeof(buf),
+                     "\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                     "\"pid\":%lu,\"tid\":%lu}",
+                     CategoryName(e.category), ts, dur,
+                     static_cast<unsigned long>(pid), static_cast<unsigned long>(ring->tid));
+            out += buf;
+        }
+    }
+
+    out += "\n]}\n";
+    return out;
+}
+
+bool ComTrace::Save(const std::wstring& path)
+{
+    std::string json = ToJson();
+#if defined(_WIN32)
+    std::ofstream file(path.c_str(), std::ios::binary | std::ios::trunc);
+#else
+    std::ofstream file(Utils::ToUtf8(path).c_str(), std::ios::binary | std::ios::trunc);
+#endif
+    if (!file) return false;
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    return static_cast<bool>(file);
+}
+
+} // namespace cpyhwpx
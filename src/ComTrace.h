@@ -0,0 +1,135 @@
+/**
+ * @file ComTrace.h
+ * @brief Chrome trace-event 형식 호출 추적 (스레드별 링 버퍼)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * HwpWrapper 공개 메서드, 그 안의 COM Invoke, HAction Run/Execute 액션 ID를
+ * 시작/끝 시각과 함께 기록하고 Perfetto/chrome://tracing에서 볼 수 있는 JSON으로 저장한다.
+ */
+
+#pragma once
+
+#include "ComPlatform.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace cpyhwpx {
+
+/**
+ * @class ComTrace
+ * @brief 스레드별 고정 크기 링 버퍼 추적기
+ *
+ * 기록은 자기 스레드의 링 버퍼에만 쓰므로 잠금이 없다.
+ * 버퍼가 가득 차면 가장 오래된 이벤트부터 덮어쓴다.
+ */
+class ComTrace {
+public:
+    enum Category : uint8_t {
+        Api = 0,        // HwpWrapper 공개 메서드
+        Com = 1,        // IDispatch::Invoke
+        Action = 2      // HAction 액션 (Run/Execute 대상 ID)
+    };
+
+    /**
+     * @brief 추적 시작 (기존 기록 삭제)
+     * @param events_per_thread 스레드당 링 버퍼 크기 (이벤트 수)
+     */
+    static void Start(size_t events_per_thread = 65536);
+
+    /**
+     * @brief 추적 중지 (기록은 유지)
+     */
+    static void Stop();
+
+    static bool IsEnabled()
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 모든 스레드의 기록 삭제
+     */
+    static void Clear();
+
+    /**
+     * @brief 기록을 Chrome trace-event JSON으로 변환
+     *
+     * 기록 중에도 호출할 수 있으나 그 사이 덮어쓰인 이벤트는 빠진다.
+     */
+    static std::string ToJson();
+
+    /**
+     * @brief ToJson 결과를 파일로 저장
+     */
+    static bool Save(const std::wstring& path);
+
+    /**
+     * @brief 현재 시각 (QueryPerformanceCounter 틱)
+     */
+    static uint64_t Now()
+    {
+        LARGE_INTEGER t;
+        QueryPerformanceCounter(&t);
+        return static_cast<uint64_t>(t.QuadPart);
+    }
+
+    /**
+     * @brief 완료된 구간 기록 (이름은 UTF-8, 길면 잘림)
+     */
+    static void Record(Category category, const char* name,
+                       uint64_t start, uint64_t end);
+
+    /**
+     * @brief 완료된 구간 기록 (UTF-16 이름)
+     */
+    static void Record(Category category, const wchar_t* name, size_t len,
+                       uint64_t start, uint64_t end);
+
+    /**
+     * @class Scope
+     * @brief 생성~소멸 구간을 하나의 이벤트로 기록
+     *
+     * 생성 시점에 추적이 꺼져 있으면 아무것도 하지 않는다.
+     */
+    class Scope {
+    public:
+        Scope(Category category, const char* name)
+            : m_category(category), m_name(name), m_wname(nullptr)
+            , m_start(IsEnabled() ? Now() : 0) {}
+
+        Scope(Category category, const std::wstring& name)
+            : m_category(category), m_name(nullptr), m_wname(&name)
+            , m_start(IsEnabled() ? Now() : 0) {}
+
+        ~Scope()
+        {
+            if (!m_start) return;
+            if (m_wname) {
+                Record(m_category, m_wname->c_str(), m_wname->size(), m_start, Now());
+            } else {
+                Record(m_category, m_name, m_start, Now());
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Category m_category;
+        const char* m_name;
+        const std::wstring* m_wname;
+        uint64_t m_start;
+    };
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+} // namespace cpyhwpx
+
+/**
+ * @brief 현재 함수 구간 추적 (HwpWrapper 공개 메서드 진입부에 사용)
+ */
+#define CPYHWPX_TRACE_METHOD() \
+    ::cpyhwpx::ComTrace::Scope cpyhwpx_trace_scope_(::cpyhwpx::ComTrace::Api, __func__)
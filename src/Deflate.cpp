@@ -0,0 +1,838 @@
+/**
+ * @file Deflate.cpp
+ * @brief Deflater/Crc32 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "Deflate.h"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <queue>
+#include <utility>
+
+namespace cpyhwpx {
+
+namespace {
+
+constexpr int kWindowBits = 15;
+constexpr uint64_t kWindowSize = 1u << kWindowBits;    // 최대 거리 32768
+constexpr uint64_t kWindowMask = kWindowSize - 1;
+constexpr int kHashBits = 15;
+constexpr uint32_t kHashSize = 1u << kHashBits;
+constexpr int kMinMatch = 3;
+constexpr int kMaxMatch = 258;
+constexpr size_t kBlockSize = 64 * 1024;                // 블록당 입력
+constexpr size_t kMaxStored = 65535;
+
+constexpr int kLitCodes = 286;
+constexpr int kDistCodes = 30;
+constexpr int kLenCodes = 19;
+constexpr int kEndOfBlock = 256;
+
+constexpr uint32_t kMatchFlag = 0x80000000u;
+
+const uint16_t kLengthBase[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+const uint8_t kLengthExtra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+const uint8_t kCodeLengthOrder[kLenCodes] = {
+    16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+/**
+ * @brief 압축 수준별 탐색 한도 (zlib 설정을 따름)
+ */
+struct LevelConfig {
+    int maxChain;
+    int niceLength;
+    bool lazy;
+};
+const LevelConfig kLevels[10] = {
+    { 0, 0, false },
+    { 4, 8, false }, { 8, 16, false }, { 16, 32, false },
+    { 16, 32, true }, { 32, 64, true }, { 128, 128, true },
+    { 256, 128, true }, { 1024, 258, true }, { 4096, 258, true },
+};
+
+struct Tables {
+    uint32_t crc[256];
+    uint8_t lengthCode[kMaxMatch + 1];      // 길이 → 0..28
+
+    Tables()
+    {
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+            }
+            crc[i] = c;
+        }
+        for (int code = 0; code < 29; ++code) {
+            int count = 1 << kLengthExtra[code];
+            for (int i = 0; i < count && kLengthBase[code] + i <= kMaxMatch; ++i) {
+                lengthCode[kLengthBase[code] + i] = static_cast<uint8_t>(code);
+            }
+        }
+        lengthCode[kMaxMatch] = 28;
+    }
+};
+
+const Tables& GetTables()
+{
+    static const Tables tables;
+    return tables;
+}
+
+int DistanceCode(int distance)
+{
+    int d = distance - 1;
+    if (d < 4) return d;
+    int bit = 2;
+    while ((d >> (bit + 1)) != 0) ++bit;
+    return bit * 2 + ((d >> (bit - 1)) & 1);
+}
+
+int DistanceExtra(int code)
+{
+    return code < 4 ? 0 : (code / 2) - 1;
+}
+
+int DistanceBase(int code)
+{
+    if (code < 4) return code + 1;
+    return ((2 + (code & 1)) << DistanceExtra(code)) + 1;
+}
+
+/**
+ * @brief 길이 제한 허프만 부호 길이 (넘치면 빈도를 반으로 줄여 다시 만듦)
+ */
+void BuildLengths(const uint32_t* freq, int count, int limit, uint8_t* lengths)
+{
+    std::vector<uint32_t> weights(freq, freq + count);
+    for (;;) {
+        std::fill(lengths, lengths + count, 0);
+
+        std::vector<int> parent;
+        using Node = std::pair<uint64_t, int>;
+        std::priority_queue<Node, std::vector<Node>, std::greater<Node>> heap;
+        std::vector<int> leaves;
+        for (int i = 0; i < count; ++i) {
+            if (weights[i] == 0) continue;
+            heap.push(Node(weights[i], static_cast<int>(parent.size())));
+            leaves.push_back(i);
+            parent.push_back(-1);
+        }
+        if (leaves.empty()) return;
+        if (leaves.size() == 1) {
+            lengths[leaves[0]] = 1;
+            return;
+        }
+
+        while (heap.size() > 1) {
+            Node a = heap.top(); heap.pop();
+            Node b = heap.top(); heap.pop();
+            int node = static_cast<int>(parent.size());
+            parent.push_back(-1);
+            parent[a.second] = node;
+            parent[b.second] = node;
+            heap.push(Node(a.first + b.first, node));
+        }
+
+        int longest = 0;
+        for (size_t i = 0; i < leaves.size(); ++i) {
+            int depth = 0;
+            for (int n = static_cast<int>(i); parent[n] >= 0; n = parent[n]) ++depth;
+            lengths[leaves[i]] = static_cast<uint8_t>(depth);
+            longest = std::max(longest, depth);
+        }
+        if (longest <= limit) return;
+
+        for (uint32_t& w : weights) {
+            if (w > 0) w = (w >> 1) | 1;
+        }
+    }
+}
+
+/**
+ * @brief 정규 허프만 부호 (deflate는 부호를 뒤집어서 LSB부터 씀)
+ */
+void BuildCodes(const uint8_t* lengths, int count, uint16_t* codes)
+{
+    uint16_t blCount[16] = {};
+    for (int i = 0; i < count; ++i) blCount[lengths[i]]++;
+    blCount[0] = 0;
+
+    uint16_t next[16] = {};
+    uint16_t code = 0;
+    for (int bits = 1; bits < 16; ++bits) {
+        code = static_cast<uint16_t>((code + blCount[bits - 1]) << 1);
+        next[bits] = code;
+    }
+    for (int i = 0; i < count; ++i) {
+        int len = lengths[i];
+        if (len == 0) {
+            codes[i] = 0;
+            continue;
+        }
+        uint16_t c = next[len]++;
+        uint16_t reversed = 0;
+        for (int b = 0; b < len; ++b) {
+            reversed = static_cast<uint16_t>((reversed << 1) | ((c >> b) & 1));
+        }
+        codes[i] = reversed;
+    }
+}
+
+/**
+ * @brief 기호가 두 개 미만이면 아무 기호나 더해 완전한 부호로 만듦 (일부 디코더 요구)
+ */
+void EnsureTwoSymbols(uint32_t* freq, int count)
+{
+    int used = 0;
+    for (int i = 0; i < count && used < 2; ++i) {
+        if (freq[i] > 0) used++;
+    }
+    for (int i = 0; i < count && used < 2; ++i) {
+        if (freq[i] == 0) {
+            freq[i] = 1;
+            used++;
+        }
+    }
+}
+
+} // namespace
+
+//=============================================================================
+// CRC-32
+//=============================================================================
+
+uint32_t Crc32(const void* data, size_t size, uint32_t crc)
+{
+    const uint32_t* table = GetTables().crc;
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+//=============================================================================
+// 생성자
+//=============================================================================
+
+Deflater::Deflater(int level)
+    : m_level(std::min(std::max(level, 0), 9))
+    , m_maxChain(kLevels[m_level].maxChain)
+    , m_niceLength(kLevels[m_level].niceLength)
+    , m_lazy(kLevels[m_level].lazy)
+    , m_base(0)
+    , m_pending(0)
+    , m_origin(0)
+    , m_bitBuf(0)
+    , m_bitCount(0)
+    , m_totalIn(0)
+    , m_finished(false)
+{
+    Reset();
+}
+
+void Deflater::Reset()
+{
+    // 해시 표를 비우는 대신 기준을 옮겨 이전 스트림의 위치가 모두 음수가 되게 함
+    // (작은 항목이 많은 ZIP에서 항목마다 512KB를 채우지 않음)
+    m_origin += static_cast<int64_t>(m_base + m_window.size()) + 1;
+    m_window.clear();
+    m_base = 0;
+    m_pending = 0;
+    m_tokens.clear();
+    m_bitBuf = 0;
+    m_bitCount = 0;
+    m_totalIn = 0;
+    m_finished = false;
+}
+
+void Deflater::EnsureTables()
+{
+    if (m_head.empty()) {
+        m_head.assign(kHashSize, -1);
+        m_prev.assign(kWindowSize, -1);
+    }
+}
+
+void Deflater::SetDictionary(const void* data, size_t size)
+{
+    if (m_finished || !m_window.empty() || size == 0) return;
+
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    if (size > kWindowSize) {
+        p += size - kWindowSize;
+        size = kWindowSize;
+    }
+    m_window.assign(p, p + size);
+    m_pending = size;
+
+    if (m_level > 0) {
+        EnsureTables();
+        for (uint64_t pos = 0; pos < size; ++pos) {
+            Insert(pos);
+        }
+    }
+}
+
+//=============================================================================
+// 입력
+//=============================================================================
+
+void Deflater::Write(const void* data, size_t size, std::string& out)
+{
+    if (m_finished || size == 0) return;
+
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    m_window.insert(m_window.end(), p, p + size);
+    m_totalIn += size;
+
+    while (m_base + m_window.size() - m_pending >= kBlockSize) {
+        CompressBlock(kBlockSize, false, out);
+    }
+}
+
+void Deflater::Finish(std::string& out)
+{
+    if (m_finished) return;
+    CompressBlock(static_cast<size_t>(m_base + m_window.size() - m_pending), true, out);
+    AlignToByte(out);
+    m_finished = true;
+}
+
+void Deflater::Flush(std::string& out)
+{
+    if (m_finished) return;
+    CompressBlock(static_cast<size_t>(m_base + m_window.size() - m_pending), false, out);
+    EmitStored(m_pending, 0, false, out);
+}
+
+void Deflater::CompressBlock(size_t length, bool final, std::string& out)
+{
+    uint64_t start = m_pending;
+    if (m_level > 0 && length > 0) {
+        Tokenize(start, start + length);
+        EmitBlock(start, length, final, out);
+    } else if (length > 0 || final) {
+        EmitStored(start, length, final, out);
+    }
+    m_pending = start + length;
+    Slide();
+}
+
+void Deflater::Slide()
+{
+    // 압축할 위치에서 32KB 이전까지만 남김
+    uint64_t keep = m_pending > kWindowSize ? m_pending - kWindowSize : 0;
+    if (keep > m_base + kWindowSize) {
+        m_window.erase(m_window.begin(), m_window.begin() + static_cast<ptrdiff_t>(keep - m_base));
+        m_base = keep;
+    }
+}
+
+//=============================================================================
+// LZ77
+//=============================================================================
+
+namespace {
+
+inline uint32_t Hash3(const uint8_t* p)
+{
+    uint32_t v = (uint32_t(p[0]) << 16) | (uint32_t(p[1]) << 8) | p[2];
+    return (v * 2654435761u) >> (32 - kHashBits);
+}
+
+} // namespace
+
+void Deflater::Insert(uint64_t pos)
+{
+    if (pos + kMinMatch > m_base + m_window.size()) return;
+    uint32_t h = Hash3(At(pos));
+    m_prev[pos & kWindowMask] = m_head[h];
+    m_head[h] = static_cast<int64_t>(pos) + m_origin;
+}
+
+Deflater::Match Deflater::FindMatch(uint64_t pos, uint64_t end) const
+{
+    Match best{ 0, 0 };
+    if (pos + kMinMatch > end) return best;
+
+    int maxLength = static_cast<int>(std::min<uint64_t>(kMaxMatch, end - pos));
+    const uint8_t* cur = At(pos);
+    int64_t candidate = m_head[Hash3(cur)] - m_origin;
+    int chain = m_maxChain;
+
+    while (candidate >= 0 && chain-- > 0) {
+        uint64_t cand = static_cast<uint64_t>(candidate);
+        if (cand >= pos || pos - cand > kWindowSize) break;
+
+        const uint8_t* ref = At(cand);
+        if (ref[best.length] == cur[best.length] && ref[0] == cur[0] && ref[1] == cur[1]) {
+            int len = 2;
+            while (len < maxLength && ref[len] == cur[len]) ++len;
+            if (len > best.length) {
+                best.length = len;
+                best.distance = static_cast<int>(pos - cand);
+                if (len >= m_niceLength || len >= maxLength) break;
+            }
+        }
+
+        int64_t next = m_prev[cand & kWindowMask] - m_origin;
+        if (next >= candidate) break;   // 창이 한 바퀴 돌아 덮어쓴 항목
+        candidate = next;
+    }
+
+    if (best.length < kMinMatch) best.length = 0;
+    return best;
+}
+
+void Deflater::Tokenize(uint64_t start, uint64_t end)
+{
+    m_tokens.clear();
+    EnsureTables();
+
+    uint64_t pos = start;
+    bool haveNext = false;
+    Match next{ 0, 0 };
+
+    while (pos < end) {
+        Match match = haveNext ? next : FindMatch(pos, end);
+        haveNext = false;
+        Insert(pos);
+
+        if (match.length >= kMinMatch) {
+            if (m_lazy && match.length < m_niceLength && pos + 1 < end) {
+                // 한 글자 뒤에서 더 긴 일치가 있으면 지금 글자는 리터럴로
+                next = FindMatch(pos + 1, end);
+                if (next.length > match.length) {
+                    m_tokens.push_back(*At(pos));
+                    haveNext = true;
+                    ++pos;
+                    continue;
+                }
+            }
+            m_tokens.push_back(kMatchFlag | (uint32_t(match.length - kMinMatch) << 16) |
+                               uint32_t(match.distance - 1));
+            for (uint64_t q = pos + 1; q < pos + static_cast<uint64_t>(match.length); ++q) {
+                Insert(q);
+            }
+            pos += static_cast<uint64_t>(match.length);
+        } else {
+            m_tokens.push_back(*At(pos));
+            ++pos;
+        }
+    }
+}
+
+//=============================================================================
+// 블록 출력
+//=============================================================================
+
+void Deflater::EmitBlock(uint64_t start, size_t length, bool final, std::string& out)
+{
+    const Tables& tables = GetTables();
+
+    uint32_t litFreq[kLitCodes] = {};
+    uint32_t distFreq[kDistCodes] = {};
+    for (uint32_t token : m_tokens) {
+        if (token & kMatchFlag) {
+            litFreq[257 + tables.lengthCode[((token >> 16) & 0xFF) + kMinMatch]]++;
+            distFreq[DistanceCode(static_cast<int>(token & 0xFFFF) + 1)]++;
+        } else {
+            litFreq[token]++;
+        }
+    }
+    litFreq[kEndOfBlock] = 1;
+    EnsureTwoSymbols(litFreq, kLitCodes);
+    EnsureTwoSymbols(distFreq, kDistCodes);
+
+    uint8_t litLen[kLitCodes];
+    uint8_t distLen[kDistCodes];
+    BuildLengths(litFreq, kLitCodes, 15, litLen);
+    BuildLengths(distFreq, kDistCodes, 15, distLen);
+
+    int hlit = kLitCodes;
+    while (hlit > 257 && litLen[hlit - 1] == 0) --hlit;
+    int hdist = kDistCodes;
+    while (hdist > 1 && distLen[hdist - 1] == 0) --hdist;
+
+    // 부호 길이 나열을 16/17/18 반복 부호로 줄임
+    std::vector<uint8_t> all(litLen, litLen + hlit);
+    all.insert(all.end(), distLen, distLen + hdist);
+
+    std::vector<std::pair<uint8_t, uint8_t>> rle;   // (부호, 추가 비트 값)
+    uint32_t clFreq[kLenCodes] = {};
+    for (size_t i = 0; i < all.size();) {
+        uint8_t len = all[i];
+        size_t run = 1;
+        while (i + run < all.size() && all[i + run] == len) ++run;
+
+        if (len == 0 && run >= 3) {
+            size_t n = std::min<size_t>(run, 138);
+            if (n >= 11) {
+                rle.emplace_back(18, static_cast<uint8_t>(n - 11));
+            } else {
+                rle.emplace_back(17, static_cast<uint8_t>(n - 3));
+            }
+            clFreq[rle.back().first]++;
+            i += n;
+        } else if (len != 0 && run >= 4) {
+            rle.emplace_back(len, 0);
+            clFreq[len]++;
+            size_t n = std::min<size_t>(run - 1, 6);
+            rle.emplace_back(16, static_cast<uint8_t>(n - 3));
+            clFreq[16]++;
+            i += 1 + n;
+        } else {
+            rle.emplace_back(len, 0);
+            clFreq[len]++;
+            i += 1;
+        }
+    }
+
+    uint8_t clLen[kLenCodes];
+    BuildLengths(clFreq, kLenCodes, 7, clLen);
+    int hclen = kLenCodes;
+    while (hclen > 4 && clLen[kCodeLengthOrder[hclen - 1]] == 0) --hclen;
+
+    // 동적 블록 비트 수와 stored 비교
+    uint64_t bits = 3 + 5 + 5 + 4 + 3 * static_cast<uint64_t>(hclen);
+    for (const auto& item : rle) {
+        bits += clLen[item.first];
+        bits += item.first == 16 ? 2 : item.first == 17 ? 3 : item.first == 18 ? 7 : 0;
+    }
+    for (int i = 0; i < kLitCodes; ++i) {
+        bits += uint64_t(litFreq[i]) * litLen[i];
+        if (i >= 257) bits += uint64_t(litFreq[i]) * kLengthExtra[i - 257];
+    }
+    for (int i = 0; i < kDistCodes; ++i) {
+        bits += uint64_t(distFreq[i]) * (distLen[i] + DistanceExtra(i));
+    }
+    uint64_t storedBits = (length / kMaxStored + 1) * (3 + 7 + 32) + uint64_t(length) * 8;
+    if (bits >= storedBits) {
+        EmitStored(start, length, final, out);
+        return;
+    }
+
+    uint16_t litCode[kLitCodes];
+    uint16_t distCode[kDistCodes];
+    uint16_t clCode[kLenCodes];
+    BuildCodes(litLen, kLitCodes, litCode);
+    BuildCodes(distLen, kDistCodes, distCode);
+    BuildCodes(clLen, kLenCodes, clCode);
+
+    PutBits(final ? 1 : 0, 1, out);
+    PutBits(2, 2, out);                 // 동적 허프만
+    PutBits(static_cast<uint32_t>(hlit - 257), 5, out);
+    PutBits(static_cast<uint32_t>(hdist - 1), 5, out);
+    PutBits(static_cast<uint32_t>(hclen - 4), 4, out);
+    for (int i = 0; i < hclen; ++i) {
+        PutBits(clLen[kCodeLengthOrder[i]], 3, out);
+    }
+    for (const auto& item : rle) {
+        PutBits(clCode[item.first], clLen[item.first], out);
+        if (item.first == 16) PutBits(item.second, 2, out);
+        else if (item.first == 17) PutBits(item.second, 3, out);
+        else if (item.first == 18) PutBits(item.second, 7, out);
+    }
+
+    for (uint32_t token : m_tokens) {
+        if (token & kMatchFlag) {
+            int len = static_cast<int>((token >> 16) & 0xFF) + kMinMatch;
+            int distance = static_cast<int>(token & 0xFFFF) + 1;
+            int lc = tables.lengthCode[len];
+            PutBits(litCode[257 + lc], litLen[257 + lc], out);
+            if (kLengthExtra[lc]) PutBits(static_cast<uint32_t>(len - kLengthBase[lc]), kLengthExtra[lc], out);
+            int dc = DistanceCode(distance);
+            PutBits(distCode[dc], distLen[dc], out);
+            if (DistanceExtra(dc)) PutBits(static_cast<uint32_t>(distance - DistanceBase(dc)), DistanceExtra(dc), out);
+        } else {
+            PutBits(litCode[token], litLen[token], out);
+        }
+    }
+    PutBits(litCode[kEndOfBlock], litLen[kEndOfBlock], out);
+}
+
+void Deflater::EmitStored(uint64_t start, size_t length, bool final, std::string& out)
+{
+    size_t offset = 0;
+    do {
+        size_t n = std::min(length - offset, kMaxStored);
+        bool last = final && offset + n == length;
+        PutBits(last ? 1 : 0, 1, out);
+        PutBits(0, 2, out);
+        AlignToByte(out);
+
+        uint16_t len = static_cast<uint16_t>(n);
+        uint16_t nlen = static_cast<uint16_t>(~len);
+        out.push_back(static_cast<char>(len & 0xFF));
+        out.push_back(static_cast<char>(len >> 8));
+        out.push_back(static_cast<char>(nlen & 0xFF));
+        out.push_back(static_cast<char>(nlen >> 8));
+        if (n > 0) {
+            out.append(reinterpret_cast<const char*>(At(start + offset)), n);
+        }
+        offset += n;
+    } while (offset < length);
+}
+
+//=============================================================================
+// 비트 출력
+//=============================================================================
+
+void Deflater::PutBits(uint32_t value, int count, std::string& out)
+{
+    m_bitBuf |= uint64_t(value) << m_bitCount;
+    m_bitCount += count;
+    if (m_bitCount >= 32) {
+        char bytes[4] = {
+            static_cast<char>(m_bitBuf & 0xFF), static_cast<char>((m_bitBuf >> 8) & 0xFF),
+            static_cast<char>((m_bitBuf >> 16) & 0xFF), static_cast<char>((m_bitBuf >> 24) & 0xFF),
+        };
+        out.append(bytes, 4);
+        m_bitBuf >>= 32;
+        m_bitCount -= 32;
+    }
+}
+
+void Deflater::AlignToByte(std::string& out)
+{
+    while (m_bitCount > 0) {
+        out.push_back(static_cast<char>(m_bitBuf & 0xFF));
+        m_bitBuf >>= 8;
+        m_bitCount = m_bitCount > 8 ? m_bitCount - 8 : 0;
+    }
+    m_bitBuf = 0;
+}
+
+//=============================================================================
+// 한 번에 압축
+//=============================================================================
+
+std::string DeflateBuffer(const void* data, size_t size, int level)
+{
+    std::string out;
+    out.reserve(size / 3 + 64);
+    Deflater deflater(level);
+    deflater.Write(data, size, out);
+    deflater.Finish(out);
+    return out;
+}
+
+//=============================================================================
+// 풀기
+//=============================================================================
+
+namespace {
+
+/**
+ * @brief 정규 허프만 부호 (길이별 개수와 부호 순서의 기호)
+ */
+struct Huffman {
+    uint16_t count[16];
+    uint16_t symbol[kLitCodes + 2];
+};
+
+/**
+ * @brief 비트 단위 입력
+ */
+struct BitReader {
+    const uint8_t* data;
+    size_t size;
+    size_t pos;
+    uint32_t bitBuf;
+    int bitCount;
+    bool overrun;
+
+    int Bits(int need)
+    {
+        while (bitCount < need) {
+            if (pos >= size) {
+                overrun = true;
+                return 0;
+            }
+            bitBuf |= uint32_t(data[pos++]) << bitCount;
+            bitCount += 8;
+        }
+        int value = static_cast<int>(bitBuf & ((1u << need) - 1));
+        bitBuf >>= need;
+        bitCount -= need;
+        return value;
+    }
+
+    int Decode(const Huffman& h)
+    {
+        int code = 0, first = 0, index = 0;
+        for (int len = 1; len < 16; ++len) {
+            code |= Bits(1);
+            if (overrun) return -1;
+            int count = h.count[len];
+            if (code - count < first) return h.symbol[index + (code - first)];
+            index += count;
+            first += count;
+            first <<= 1;
+            code <<= 1;
+        }
+        return -1;
+    }
+};
+
+/**
+ * @return 부호가 넘치면 false (모자란 부호는 허용)
+ */
+bool BuildHuffman(Huffman& h, const uint8_t* lengths, int n)
+{
+    std::fill(std::begin(h.count), std::end(h.count), 0);
+    for (int i = 0; i < n; ++i) h.count[lengths[i]]++;
+    if (h.count[0] == n) return true;
+
+    int left = 1;
+    for (int len = 1; len < 16; ++len) {
+        left <<= 1;
+        left -= h.count[len];
+        if (left < 0) return false;
+    }
+
+    uint16_t offsets[16];
+    offsets[1] = 0;
+    for (int len = 1; len < 15; ++len) offsets[len + 1] = offsets[len] + h.count[len];
+    for (int i = 0; i < n; ++i) {
+        if (lengths[i] != 0) h.symbol[offsets[lengths[i]]++] = static_cast<uint16_t>(i);
+    }
+    return true;
+}
+
+const uint16_t kDistBase[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+const uint8_t kDistExtra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+bool InflateCodes(BitReader& in, const Huffman& lit, const Huffman& dist, std::string& out, size_t start)
+{
+    for (;;) {
+        int symbol = in.Decode(lit);
+        if (symbol < 0) return false;
+        if (symbol < 256) {
+            out.push_back(static_cast<char>(symbol));
+        } else if (symbol == kEndOfBlock) {
+            return true;
+        } else {
+            symbol -= 257;
+            if (symbol >= 29) return false;
+            size_t length = kLengthBase[symbol] + static_cast<size_t>(in.Bits(kLengthExtra[symbol]));
+            int d = in.Decode(dist);
+            if (d < 0 || d >= 30) return false;
+            size_t distance = kDistBase[d] + static_cast<size_t>(in.Bits(kDistExtra[d]));
+            if (in.overrun || distance > out.size() - start) return false;
+
+            size_t from = out.size() - distance;
+            for (size_t i = 0; i < length; ++i) {
+                out.push_back(out[from + i]);
+            }
+        }
+    }
+}
+
+} // namespace
+
+bool InflateBuffer(const void* data, size_t size, std::string& out)
+{
+    BitReader in{ static_cast<const uint8_t*>(data), size, 0, 0, 0, false };
+    const size_t start = out.size();
+
+    static const struct FixedCodes {
+        Huffman lit;
+        Huffman dist;
+        FixedCodes()
+        {
+            uint8_t lengths[288];
+            for (int i = 0; i < 144; ++i) lengths[i] = 8;
+            for (int i = 144; i < 256; ++i) lengths[i] = 9;
+            for (int i = 256; i < 280; ++i) lengths[i] = 7;
+            for (int i = 280; i < 288; ++i) lengths[i] = 8;
+            BuildHuffman(lit, lengths, 288);
+            std::fill(lengths, lengths + 30, uint8_t(5));
+            BuildHuffman(dist, lengths, 30);
+        }
+    } fixed;
+
+    int final;
+    do {
+        final = in.Bits(1);
+        int type = in.Bits(2);
+        if (in.overrun) return false;
+
+        if (type == 0) {
+            in.bitBuf = 0;
+            in.bitCount = 0;
+            if (in.pos + 4 > size) return false;
+            size_t len = in.data[in.pos] | (in.data[in.pos + 1] << 8);
+            size_t nlen = in.data[in.pos + 2] | (in.data[in.pos + 3] << 8);
+            in.pos += 4;
+            if (len != (~nlen & 0xFFFF) || in.pos + len > size) return false;
+            out.append(reinterpret_cast<const char*>(in.data + in.pos), len);
+            in.pos += len;
+        } else if (type == 1) {
+            if (!InflateCodes(in, fixed.lit, fixed.dist, out, start)) return false;
+        } else if (type == 2) {
+            int hlit = in.Bits(5) + 257;
+            int hdist = in.Bits(5) + 1;
+            int hclen = in.Bits(4) + 4;
+            if (in.overrun || hlit > kLitCodes || hdist > kDistCodes) return false;
+
+            uint8_t lengths[kLitCodes + kDistCodes] = {};
+            for (int i = 0; i < hclen; ++i) lengths[kCodeLengthOrder[i]] = static_cast<uint8_t>(in.Bits(3));
+            Huffman lenCode;
+            if (!BuildHuffman(lenCode, lengths, kLenCodes)) return false;
+
+            std::fill(std::begin(lengths), std::end(lengths), uint8_t(0));
+            int index = 0;
+            while (index < hlit + hdist) {
+                int symbol = in.Decode(lenCode);
+                if (symbol < 0) return false;
+                if (symbol < 16) {
+                    lengths[index++] = static_cast<uint8_t>(symbol);
+                    continue;
+                }
+                uint8_t value = 0;
+                int repeat;
+                if (symbol == 16) {
+                    if (index == 0) return false;
+                    value = lengths[index - 1];
+                    repeat = 3 + in.Bits(2);
+                } else if (symbol == 17) {
+                    repeat = 3 + in.Bits(3);
+                } else {
+                    repeat = 11 + in.Bits(7);
+                }
+                if (in.overrun || index + repeat > hlit + hdist) return false;
+                while (repeat-- > 0) lengths[index++] = value;
+            }
+
+            Huffman lit, dist;
+            if (!BuildHuffman(lit, lengths, hlit) || !BuildHuffman(dist, lengths + hlit, hdist)) return false;
+            if (!InflateCodes(in, lit, dist, out, start)) return false;
+        } else {
+            return false;
+        }
+    } while (!final);
+
+    return true;
+}
+
+} // namespace cpyhwpx
@@ -0,0 +1,124 @@
+/**
+ * @file Deflate.h
+ * @brief raw deflate(RFC 1951) 압축/해제와 CRC-32
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * HWPX(ZIP) 패키지를 COM/zlib 없이 쓰기 위한 최소 구현.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cpyhwpx {
+
+/**
+ * @brief CRC-32 (ZIP/PNG와 같은 다항식)
+ * @param crc 이전 조각의 결과 (이어서 계산할 때)
+ */
+uint32_t Crc32(const void* data, size_t size, uint32_t crc = 0);
+
+/**
+ * @class Deflater
+ * @brief raw deflate 스트림 압축기
+ *
+ * - 32KB 창의 해시 체인 LZ77 (level 4 이상은 한 글자 늦춰 보는 lazy 매칭)
+ * - 입력 64KB마다 블록 하나, 블록마다 동적 허프만 부호
+ * - 줄지 않는 블록(JPEG/PNG 등)은 stored 블록으로 내보냄
+ * - Write()는 블록 크기만큼 모일 때까지 입력을 보관하므로 XML을 조각조각 넘겨도 된다
+ */
+class Deflater {
+public:
+    /**
+     * @param level 0=압축 안 함(stored), 1(빠름) ~ 9(작음)
+     */
+    explicit Deflater(int level = 6);
+
+    /**
+     * @brief 입력 추가 (완성된 블록은 out 뒤에 붙임)
+     */
+    void Write(const void* data, size_t size, std::string& out);
+
+    /**
+     * @brief 남은 입력을 마지막 블록으로 내보냄 (이후 Reset() 전까지 Write 불가)
+     */
+    void Finish(std::string& out);
+
+    /**
+     * @brief 새 스트림 시작 (압축 수준 유지)
+     */
+    void Reset();
+
+    /**
+     * @brief 앞 조각의 마지막 32KB를 일치 검색 창으로 미리 채움 (Reset() 직후에만)
+     *
+     * 큰 항목을 조각으로 나눠 여러 스레드에서 압축할 때, 각 조각이 앞 조각을 참조할 수 있게 한다.
+     * 사전 자체는 출력되지 않는다.
+     */
+    void SetDictionary(const void* data, size_t size);
+
+    /**
+     * @brief 지금까지의 입력을 모두 내보내고 바이트 경계에 맞춤 (sync flush, 스트림은 계속)
+     *
+     * 빈 stored 블록으로 끝나므로 다음 조각의 압축 결과를 그대로 이어 붙일 수 있다.
+     */
+    void Flush(std::string& out);
+
+    int GetLevel() const { return m_level; }
+    uint64_t GetInputSize() const { return m_totalIn; }
+
+private:
+    struct Match {
+        int length;
+        int distance;
+    };
+
+    void CompressBlock(size_t length, bool final, std::string& out);
+    void Tokenize(uint64_t start, uint64_t end);
+    Match FindMatch(uint64_t pos, uint64_t end) const;
+    void Insert(uint64_t pos);
+    void EnsureTables();
+    void EmitBlock(uint64_t start, size_t length, bool final, std::string& out);
+    void EmitStored(uint64_t start, size_t length, bool final, std::string& out);
+    void Slide();
+
+    void PutBits(uint32_t value, int count, std::string& out);
+    void AlignToByte(std::string& out);
+
+    const uint8_t* At(uint64_t pos) const { return m_window.data() + (pos - m_base); }
+
+    int m_level;
+    int m_maxChain;
+    int m_niceLength;
+    bool m_lazy;
+
+    std::vector<uint8_t> m_window;      // m_base부터의 바이트 (이전 32KB + 아직 압축하지 않은 입력)
+    uint64_t m_base;
+    uint64_t m_pending;                 // 아직 압축하지 않은 첫 위치
+    int64_t m_origin;                   // 해시 표에 저장한 위치 = 스트림 위치 + m_origin
+    std::vector<int64_t> m_head;        // 해시 → 마지막 위치 (처음 압축할 때 할당)
+    std::vector<int64_t> m_prev;        // 위치 & 창 마스크 → 같은 해시의 이전 위치
+    std::vector<uint32_t> m_tokens;     // 블록의 리터럴/일치 기호
+
+    uint64_t m_bitBuf;
+    int m_bitCount;
+    uint64_t m_totalIn;
+    bool m_finished;
+};
+
+/**
+ * @brief 한 번에 압축 (raw deflate)
+ */
+std::string DeflateBuffer(const void* data, size_t size, int level = 6);
+
+/**
+ * @brief raw deflate 스트림 풀기
+ * @param out 풀린 내용을 뒤에 붙임
+ * @return 스트림이 손상되었으면 false
+ */
+bool InflateBuffer(const void* data, size_t size, std::string& out);
+
+} // namespace cpyhwpx
@@ -0,0 +1,232 @@
+/**
+ * @file EditTracker.cpp
+ * @brief EditTracker 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "EditTracker.h"
+#include <algorithm>
+#include <unordered_map>
+
+namespace cpyhwpx {
+
+namespace {
+
+// 이름 전체로 분류하는 액션 (접두어 규칙보다 우선)
+const std::unordered_map<std::wstring, int>& ExactActions()
+{
+    static const std::unordered_map<std::wstring, int> s_table = {
+        // 캐럿/선택만 이동
+        { L"Cancel",                EditKind::Caret },
+        { L"TableLeftCell",         EditKind::Caret },
+        { L"TableRightCell",        EditKind::Caret },
+        { L"TableUpperCell",        EditKind::Caret },
+        { L"TableLowerCell",        EditKind::Caret },
+        { L"TableColBegin",         EditKind::Caret },
+        { L"TableColEnd",           EditKind::Caret },
+        { L"TableColPageUp",        EditKind::Caret },
+        { L"TableColPageDown",      EditKind::Caret },
+        { L"TableRowBegin",         EditKind::Caret },
+        { L"TableRowEnd",           EditKind::Caret },
+        { L"ForwardFind",           EditKind::Caret },
+        { L"BackwardFind",          EditKind::Caret },
+        { L"RepeatFind",            EditKind::Caret },
+        { L"ReverseFind",           EditKind::Caret },
+        { L"Goto",                  EditKind::Caret },
+        { L"GotoStyle",             EditKind::Caret },
+
+        // 문서를 바꾸지 않음
+        { L"Copy",                  EditKind::None },
+        { L"FileSave",              EditKind::None },
+        { L"FileSaveAs",            EditKind::None },
+        { L"Print",                 EditKind::None },
+        { L"PrintToPDF",            EditKind::None },
+
+        // 모양만 변경
+        { L"CharShape",             EditKind::Layout },
+        { L"ParaShape",             EditKind::Layout },
+        { L"ParagraphShape",        EditKind::Layout },
+        { L"CellShape",             EditKind::Layout },
+        { L"CellBorder",            EditKind::Layout },
+        { L"CellFill",              EditKind::Layout },
+        { L"CellBorderFill",        EditKind::Layout },
+        { L"PageSetup",             EditKind::Layout },
+        { L"Style",                 EditKind::Layout },
+        { L"StyleEx",               EditKind::Layout },
+
+        // 문서 교체
+        { L"FileNew",               EditKind::Document },
+        { L"FileNewTab",            EditKind::Document },
+        { L"FileOpen",              EditKind::Document },
+        { L"FileClose",             EditKind::Document },
+        { L"FileQuit",              EditKind::Document },
+
+        // 되돌리기 (무엇이 되돌아갈지 모르므로 내용과 모양 모두)
+        { L"Undo",                  EditKind::Content | EditKind::Layout },
+        { L"Redo",                  EditKind::Content | EditKind::Layout },
+    };
+    return s_table;
+}
+
+struct PrefixRule {
+    const wchar_t* prefix;
+    size_t length;
+    int kinds;
+};
+
+#define CPYHWPX_PREFIX(text, kinds) { text, sizeof(text) / sizeof(wchar_t) - 1, kinds }
+
+// 앞에서부터 처음 맞는 규칙 사용 (긴 접두어를 먼저)
+const PrefixRule kPrefixRules[] = {
+    CPYHWPX_PREFIX(L"TableCellBlock",     EditKind::Caret),
+    CPYHWPX_PREFIX(L"TableCellBorder",    EditKind::Layout),
+    CPYHWPX_PREFIX(L"TableCellShade",     EditKind::Layout),
+    CPYHWPX_PREFIX(L"TableCellAlign",     EditKind::Layout),
+    CPYHWPX_PREFIX(L"TableVAlign",        EditKind::Layout),
+    CPYHWPX_PREFIX(L"ParagraphShape",     EditKind::Layout),
+    CPYHWPX_PREFIX(L"CharShape",          EditKind::Layout),
+    CPYHWPX_PREFIX(L"ParaShape",          EditKind::Layout),
+    CPYHWPX_PREFIX(L"ShapeObjAlign",      EditKind::Layout),
+    CPYHWPX_PREFIX(L"Select",             EditKind::Caret),
+    CPYHWPX_PREFIX(L"Move",               EditKind::Caret),
+    CPYHWPX_PREFIX(L"View",               EditKind::None),
+    CPYHWPX_PREFIX(L"Zoom",               EditKind::None),
+};
+
+#undef CPYHWPX_PREFIX
+
+} // namespace
+
+//=============================================================================
+// 생성자
+//=============================================================================
+
+EditTracker::EditTracker()
+    : m_generation(0)
+    , m_kindGenerations{}
+    , m_nextId(1)
+    , m_notifying(false)
+    , m_pendingErase(false)
+{
+}
+
+//=============================================================================
+// 액션 분류
+//=============================================================================
+
+int EditTracker::ClassifyAction(const std::wstring& action_id)
+{
+    const auto& exact = ExactActions();
+    auto it = exact.find(action_id);
+    if (it != exact.end()) {
+        return it->second;
+    }
+
+    for (const PrefixRule& rule : kPrefixRules) {
+        if (action_id.compare(0, rule.length, rule.prefix) == 0) {
+            return rule.kinds;
+        }
+    }
+
+    // 모르는 액션은 내용이 바뀐 것으로 취급 (캐시를 잘못 살리는 것보다 안전)
+    return EditKind::Content | EditKind::Layout;
+}
+
+//=============================================================================
+// 편집 기록
+//=============================================================================
+
+int EditTracker::Normalize(int kinds)
+{
+    if (kinds & EditKind::Document) return EditKind::All;
+    if (kinds & EditKind::Content) kinds |= EditKind::Caret;
+    return kinds & EditKind::All;
+}
+
+void EditTracker::Note(int kinds)
+{
+    kinds = Normalize(kinds);
+    if (kinds == EditKind::None) return;
+
+    if (kinds & ~EditKind::Caret) {
+        m_generation++;
+    }
+    for (int bit = 0; bit < kKindCount; ++bit) {
+        if (kinds & (1 << bit)) {
+            m_kindGenerations[bit]++;
+        }
+    }
+
+    if (m_entries.empty()) return;
+
+    // 콜백이 등록/해제해도 안전하도록 인덱스로 순회하고 삭제는 끝에서
+    bool outer = !m_notifying;
+    m_notifying = true;
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        Entry* entry = m_entries[i].get();
+        if (entry->active && (entry->dependsOn & kinds)) {
+            entry->fn(kinds);
+        }
+    }
+    if (!outer) return;
+
+    m_notifying = false;
+    if (m_pendingErase) {
+        m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
+                                       [](const std::unique_ptr<Entry>& e) { return !e->active; }),
+                        m_entries.end());
+        m_pendingErase = false;
+    }
+}
+
+uint64_t EditTracker::Stamp(int kinds) const
+{
+    kinds = kinds & EditKind::All;
+
+    // 세대는 줄지 않으므로 합이 같으면 조합 안의 어느 종류도 바뀌지 않은 것
+    uint64_t stamp = 0;
+    for (int bit = 0; bit < kKindCount; ++bit) {
+        if (kinds & (1 << bit)) {
+            stamp += m_kindGenerations[bit];
+        }
+    }
+    return stamp;
+}
+
+//=============================================================================
+// 캐시 등록부
+//=============================================================================
+
+int EditTracker::Register(int depends_on, Invalidator fn)
+{
+    int id = m_nextId++;
+    m_entries.push_back(std::make_unique<Entry>(Entry{ id, depends_on, std::move(fn), true }));
+    return id;
+}
+
+void EditTracker::Unregister(int id)
+{
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if ((*it)->id != id) continue;
+
+        if (m_notifying) {
+            (*it)->active = false;
+            m_pendingErase = true;
+        } else {
+            m_entries.erase(it);
+        }
+        return;
+    }
+}
+
+size_t EditTracker::GetCacheCount() const
+{
+    size_t count = 0;
+    for (const auto& entry : m_entries) {
+        if (entry->active) count++;
+    }
+    return count;
+}
+
+} // namespace cpyhwpx
@@ -0,0 +1,137 @@
+/**
+ * @file EditTracker.h
+ * @brief 문서 편집 세대 카운터와 캐시 무효화 등록부
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 표 색인, 필드 색인, 모양 상태, 컨트롤/텍스트 스냅샷 같은 읽기 캐시가
+ * 문서가 바뀌었는지 알 수 있도록 HwpWrapper의 변경 메서드가 편집 종류를 기록한다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cpyhwpx {
+
+/**
+ * @brief 편집 종류 (비트 조합)
+ *
+ * Document는 모든 종류를, Content는 Caret을 함께 포함하는 것으로 취급한다.
+ */
+namespace EditKind {
+    constexpr int None     = 0x0000;
+    constexpr int Caret    = 0x0001;  // 캐럿/선택 영역만 이동
+    constexpr int Layout   = 0x0002;  // 글자/문단/셀 모양 (본문 내용은 그대로)
+    constexpr int Content  = 0x0004;  // 본문 내용 (텍스트, 표, 컨트롤, 필드)
+    constexpr int Document = 0x0008;  // 문서 교체 (열기, 닫기, 새 문서, 전환)
+    constexpr int All = Caret | Layout | Content | Document;
+}
+
+/**
+ * @class EditTracker
+ * @brief 편집 종류별 세대 카운터 + 의존 캐시 무효화
+ *
+ * 캐시는 두 방식 중 하나로 쓴다.
+ * - 당겨 쓰기: 채울 때 Stamp(의존 종류)를 저장해 두고 읽을 때 다시 비교
+ * - 밀어 받기: Register(의존 종류, 콜백)로 등록하면 해당 편집 때 콜백 호출
+ *
+ * HwpWrapper를 거치지 않은 변경(한/글 화면에서의 직접 편집, 원시 IDispatch 호출)은
+ * 알 수 없으므로 그런 경우에는 HwpWrapper::NoteEdit()으로 직접 알린다.
+ * HwpWrapper와 같은 스레드에서만 사용한다.
+ */
+class EditTracker {
+public:
+    /**
+     * @brief 무효화 콜백 (인자: 이번 편집 종류)
+     */
+    using Invalidator = std::function<void(int kinds)>;
+
+    EditTracker();
+
+    EditTracker(const EditTracker&) = delete;
+    EditTracker& operator=(const EditTracker&) = delete;
+
+    //=========================================================================
+    // 액션 분류
+    //=========================================================================
+
+    /**
+     * @brief HAction ID가 바꾸는 것
+     * @return EditKind 조합 (모르는 액션은 Content | Layout)
+     */
+    static int ClassifyAction(const std::wstring& action_id);
+
+    //=========================================================================
+    // 편집 기록
+    //=========================================================================
+
+    /**
+     * @brief 편집 기록 (해당 세대 증가 후 의존 캐시 무효화)
+     */
+    void Note(int kinds);
+
+    /**
+     * @brief 액션 실행 기록 (ClassifyAction 결과로 Note)
+     */
+    void NoteAction(const std::wstring& action_id) { Note(ClassifyAction(action_id)); }
+
+    /**
+     * @brief 문서 세대 (캐럿 이동을 뺀 모든 편집마다 증가)
+     */
+    uint64_t GetGeneration() const { return m_generation; }
+
+    /**
+     * @brief 종류 조합의 도장 값
+     *
+     * 조합에 든 종류의 편집이 있었을 때만 값이 바뀐다. 캐시를 채울 때 저장해 두고
+     * 읽을 때 같은 조합의 Stamp()와 비교한다.
+     */
+    uint64_t Stamp(int kinds) const;
+
+    //=========================================================================
+    // 캐시 등록부
+    //=========================================================================
+
+    /**
+     * @brief 무효화 콜백 등록
+     * @param depends_on 캐시가 의존하는 EditKind 조합
+     * @return 등록 ID (Unregister용)
+     */
+    int Register(int depends_on, Invalidator fn);
+
+    /**
+     * @brief 등록 해제 (무효화 콜백 안에서 불러도 됨)
+     */
+    void Unregister(int id);
+
+    /**
+     * @brief 등록된 캐시 수
+     */
+    size_t GetCacheCount() const;
+
+private:
+    static constexpr int kKindCount = 4;
+
+    struct Entry {
+        int id;
+        int dependsOn;
+        Invalidator fn;
+        bool active;
+    };
+
+    static int Normalize(int kinds);
+
+    uint64_t m_generation;
+    uint64_t m_kindGenerations[kKindCount];
+
+    std::vector<std::unique_ptr<Entry>> m_entries;  // 콜백 중 등록돼도 주소 유지
+    int m_nextId;
+    bool m_notifying;
+    bool m_pendingErase;
+};
+
+} // namespace cpyhwpx
@@ -0,0 +1,202 @@
+/**
+ * @file FieldIndex.cpp
+ * @brief FieldIndex 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "FieldIndex.h"
+
+namespace cpyhwpx {
+
+namespace {
+
+constexpr wchar_t kSeparator = L'\x02';
+
+// "\x02" 구분 문자열 분리 (빈 문자열은 항목 없음)
+std::vector<std::wstring> SplitList(const std::wstring& list)
+{
+    std::vector<std::wstring> items;
+    if (list.empty()) return items;
+
+    size_t start = 0;
+    while (true) {
+        size_t end = list.find(kSeparator, start);
+        if (end == std::wstring::npos) {
+            items.push_back(list.substr(start));
+            break;
+        }
+        items.push_back(list.substr(start, end - start));
+        start = end + 1;
+    }
+    return items;
+}
+
+} // namespace
+
+//=============================================================================
+// 필드 참조 해석
+//=============================================================================
+
+int FieldIndex::SplitReference(const std::wstring& field, std::wstring& name)
+{
+    size_t open = field.rfind(L"{{");
+    if (open == std::wstring::npos || field.size() < open + 5 ||
+        field.compare(field.size() - 2, 2, L"}}") != 0) {
+        name = field;
+        return -1;
+    }
+
+    int idx = 0;
+    for (size_t i = open + 2; i < field.size() - 2; ++i) {
+        wchar_t ch = field[i];
+        if (ch < L'0' || ch > L'9' || idx > 100000000) {
+            name = field;
+            return -1;
+        }
+        idx = idx * 10 + (ch - L'0');
+    }
+
+    name = field.substr(0, open);
+    return idx;
+}
+
+bool FieldIndex::Resolve(const std::wstring& field, std::vector<size_t>& out) const
+{
+    std::wstring name;
+    int idx = SplitReference(field, name);
+
+    auto it = m_names.find(name);
+    if (it == m_names.end()) return false;
+
+    const std::vector<size_t>& occurrences = it->second.occurrences;
+    if (idx < 0) {
+        out.insert(out.end(), occurrences.begin(), occurrences.end());
+        return true;
+    }
+    if (static_cast<size_t>(idx) >= occurrences.size()) return false;
+
+    out.push_back(occurrences[static_cast<size_t>(idx)]);
+    return true;
+}
+
+//=============================================================================
+// 구성
+//=============================================================================
+
+void FieldIndex::Build(const std::wstring& field_list)
+{
+    Clear();
+
+    m_entries = SplitList(field_list);
+    m_names.reserve(m_entries.size());
+
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        std::wstring name;
+        SplitReference(m_entries[i], name);
+        m_names[name].occurrences.push_back(i);
+    }
+    m_built = true;
+}
+
+bool FieldIndex::LoadTexts(const std::wstring& texts)
+{
+    m_texts.clear();
+    m_hasTexts = false;
+    if (!m_built) return false;
+
+    std::vector<std::wstring> values = SplitList(texts);
+    if (m_entries.size() == 1 && values.empty()) {
+        values.emplace_back();      // 필드 하나의 값이 빈 문자열
+    }
+    if (values.size() != m_entries.size()) return false;
+
+    m_texts = std::move(values);
+    m_hasTexts = true;
+    return true;
+}
+
+void FieldIndex::Clear()
+{
+    m_entries.clear();
+    m_texts.clear();
+    m_names.clear();
+    m_built = false;
+    m_hasTexts = false;
+}
+
+//=============================================================================
+// 조회
+//=============================================================================
+
+bool FieldIndex::Exists(const std::wstring& field) const
+{
+    std::wstring name;
+    int idx = SplitReference(field, name);
+
+    auto it = m_names.find(name);
+    if (it == m_names.end()) return false;
+    return idx < 0 || static_cast<size_t>(idx) < it->second.occurrences.size();
+}
+
+int FieldIndex::Count(const std::wstring& name) const
+{
+    auto it = m_names.find(name);
+    if (it == m_names.end()) return 0;
+    return static_cast<int>(it->second.occurrences.size());
+}
+
+const std::wstring* FieldIndex::Text(const std::wstring& field) const
+{
+    if (!m_hasTexts) return nullptr;
+
+    std::vector<size_t> targets;
+    if (!Resolve(field, targets) || targets.empty()) return nullptr;
+    return &m_texts[targets.front()];
+}
+
+std::wstring FieldIndex::GetFieldListString() const
+{
+    std::wstring list;
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (i > 0) list += kSeparator;
+        list += m_entries[i];
+    }
+    return list;
+}
+
+//=============================================================================
+// 갱신
+//=============================================================================
+
+bool FieldIndex::Update(const std::wstring& field, const std::wstring& text)
+{
+    if (!m_hasTexts) return m_built;
+
+    std::vector<std::wstring> fields = SplitList(field);
+    std::vector<std::wstring> values = SplitList(text);
+
+    // 필드 하나에 "\x02"가 없는 값은 그대로 씀
+    if (fields.size() == 1) {
+        values.assign(1, text);
+    }
+
+    // 값이 모자라면 한/글과 같은 결과를 장담할 수 없으므로 값 캐시를 버림
+    bool ok = !fields.empty() && values.size() >= fields.size();
+    std::vector<size_t> targets;
+    for (size_t i = 0; ok && i < fields.size(); ++i) {
+        targets.clear();
+        ok = Resolve(fields[i], targets);
+        for (size_t target : targets) {
+            m_texts[target] = values[i];
+        }
+    }
+
+    if (!ok) {
+        m_texts.clear();
+        m_hasTexts = false;
+    }
+    return ok;
+}
+
+} // namespace cpyhwpx
@@ -0,0 +1,135 @@
+/**
+ * @file FieldIndex.h
+ * @brief 문서 필드 색인 (필드 이름 → 개수/값)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * GetFieldList(1, option) 한 번과 GetFieldText 일괄 호출 한 번으로 만든 색인으로
+ * FieldExist, 필드 개수, GetFieldText를 COM 호출 없이 답한다.
+ */
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cpyhwpx {
+
+/**
+ * @class FieldIndex
+ * @brief 필드 이름별 발생 위치와 값 캐시
+ *
+ * 필드 참조는 "이름" 또는 "이름{{n}}" (n번째, 0부터) 형식이다.
+ * 색인이 최신인지는 소유자(HwpWrapper)가 편집 세대로 판단한다.
+ */
+class FieldIndex {
+public:
+    FieldIndex() = default;
+
+    //=========================================================================
+    // 구성
+    //=========================================================================
+
+    /**
+     * @brief GetFieldList(1, option) 결과로 이름 색인 구성 (값은 비어 있음)
+     * @param field_list "\x02"로 구분된 "이름{{n}}" 목록
+     */
+    void Build(const std::wstring& field_list);
+
+    /**
+     * @brief GetFieldText(GetFieldListString()) 결과로 값 채우기
+     * @param texts "\x02"로 구분된 값 (필드 수와 다르면 값 캐시를 버림)
+     * @return 값을 채웠으면 true
+     */
+    bool LoadTexts(const std::wstring& texts);
+
+    /**
+     * @brief 색인 삭제
+     */
+    void Clear();
+
+    /**
+     * @brief 이름 색인이 있는지 여부
+     */
+    bool IsBuilt() const { return m_built; }
+
+    /**
+     * @brief 값 캐시가 있는지 여부
+     */
+    bool HasTexts() const { return m_hasTexts; }
+
+    //=========================================================================
+    // 조회 (COM 호출 없음)
+    //=========================================================================
+
+    /**
+     * @brief 필드 존재 여부 ("이름" 또는 "이름{{n}}")
+     */
+    bool Exists(const std::wstring& field) const;
+
+    /**
+     * @brief 같은 이름의 필드 개수
+     */
+    int Count(const std::wstring& name) const;
+
+    /**
+     * @brief 필드 값 ("이름"은 첫 번째 필드)
+     * @return 값 캐시가 없거나 필드가 없으면 nullptr
+     */
+    const std::wstring* Text(const std::wstring& field) const;
+
+    /**
+     * @brief 문서 순서의 필드 참조 목록 (GetFieldList(1, option) 항목 그대로)
+     */
+    const std::vector<std::wstring>& GetEntries() const { return m_entries; }
+
+    /**
+     * @brief GetEntries()를 "\x02"로 이은 문자열 (GetFieldText 일괄 조회 인자)
+     */
+    std::wstring GetFieldListString() const;
+
+    /**
+     * @brief 필드 이름 수 (같은 이름은 하나로)
+     */
+    size_t GetNameCount() const { return m_names.size(); }
+
+    //=========================================================================
+    // 갱신
+    //=========================================================================
+
+    /**
+     * @brief PutFieldText 결과 반영
+     * @param field "\x02"로 구분된 필드 참조 ("이름"은 같은 이름 전체)
+     * @param text "\x02"로 구분된 값
+     * @return 반영했으면 true (모르는 필드가 있으면 false, 이때 값 캐시를 버림)
+     */
+    bool Update(const std::wstring& field, const std::wstring& text);
+
+    //=========================================================================
+    // 필드 참조 해석
+    //=========================================================================
+
+    /**
+     * @brief "이름{{n}}"을 이름과 순번으로 분리
+     * @return 순번 (없으면 -1)
+     */
+    static int SplitReference(const std::wstring& field, std::wstring& name);
+
+private:
+    struct NameEntry {
+        std::vector<size_t> occurrences;    // m_entries 인덱스 (순번 순)
+    };
+
+    /**
+     * @brief 필드 참조 → m_entries 인덱스 목록
+     */
+    bool Resolve(const std::wstring& field, std::vector<size_t>& out) const;
+
+    std::vector<std::wstring> m_entries;                // 문서 순서 필드 참조
+    std::vector<std::wstring> m_texts;                  // m_entries와 같은 순서의 값
+    std::unordered_map<std::wstring, NameEntry> m_names;
+    bool m_built = false;
+    bool m_hasTexts = false;
+};
+
+} // namespace cpyhwpx
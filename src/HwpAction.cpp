@@ -7,16 +7,50 @@
 
 #include "HwpAction.h"
 #include "HwpWrapper.h"
+#include "ComScope.h"
+#include "ComStats.h"
+#include "ComTrace.h"
+#include "ActionRecorder.h"
+#include "HwpParameter.h"
+#include <unordered_map>
 
 namespace cpyhwpx {
 
+namespace {
+
+// HAction 객체 멤버 DISPID (액션 객체는 모두 같은 형식이므로 이름별로 공유)
+thread_local std::unordered_map<std::wstring, DISPID> t_actionDispids;
+
+DISPID ActionDispid(IDispatch* action, const std::wstring& name)
+{
+    auto it = t_actionDispids.find(name);
+    if (it != t_actionDispids.end()) {
+#if CPYHWPX_COM_STATS
+        if (ComStats::IsEnabled() || ComTrace::IsEnabled()) {
+            ComStats::NameMember(action, it->second, name);
+        }
+#endif
+        return it->second;
+    }
+
+    DISPID dispid;
+    OLECHAR* pName = const_cast<OLECHAR*>(name.c_str());
+    if (FAILED(ComGetIDsOfNames(action, &pName, 1, &dispid))) return DISPID_UNKNOWN;
+
+    t_actionDispids.emplace(name, dispid);
+    return dispid;
+}
+
+} // namespace
+
 //=============================================================================
 // HwpAction 구현
 //=============================================================================
 
-HwpAction::HwpAction(IDispatch* action, HwpWrapper* hwp)
+HwpAction::HwpAction(IDispatch* action, HwpWrapper* hwp, const std::wstring& action_id)
     : m_pAction(action)
     , m_pHwp(hwp)
+    , m_actionId(action_id)
 {
     if (m_pAction) {
         m_pAction->AddRef();
@@ -31,78 +65,88 @@ HwpAction::~HwpAction()
     }
 }
 
+void HwpAction::NoteEdit()
+{
+    if (!m_pHwp) return;
+
+    if (m_actionId.empty()) {
+        // ID를 모르면 내용 변경으로 취급
+        m_pHwp->NoteEdit(EditKind::Content | EditKind::Layout);
+    } else {
+        m_pHwp->GetEditTracker().NoteAction(m_actionId);
+    }
+}
+
 bool HwpAction::Run()
 {
-    VARIANT result = InvokeMethod(L"Run");
-    if (result.vt == VT_BOOL) {
-        return result.boolVal != VARIANT_FALSE;
+    NoteEdit();
+
+    ActionRecorder::Scope recordScope(m_pHwp ? m_pHwp->GetActionRecorder() : nullptr);
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnRunAction(m_actionId.empty() ? GetActionID() : m_actionId);
     }
-    return false;
+
+    ScopedVariant result(InvokeMethod(L"Run"));
+    return result.vt() == VT_BOOL && result.ToBool();
 }
 
 bool HwpAction::Execute(IDispatch* pset)
 {
     if (!pset) return false;
 
+    NoteEdit();
+
+    ActionRecorder::Scope recordScope(m_pHwp ? m_pHwp->GetActionRecorder() : nullptr);
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnExecute(m_actionId.empty() ? GetActionID() : m_actionId,
+                            HwpParameterSet(pset).GetSetID(), pset);
+    }
+
     VARIANT args[1];
     VariantInit(&args[0]);
     args[0].vt = VT_DISPATCH;
     args[0].pdispVal = pset;
 
-    VARIANT result = InvokeMethod(L"Execute", { args[0] });
-    if (result.vt == VT_BOOL) {
-        return result.boolVal != VARIANT_FALSE;
-    }
-    return false;
+    ScopedVariant result(InvokeMethod(L"Execute", { args[0] }));
+    return result.vt() == VT_BOOL && result.ToBool();
 }
 
 IDispatch* HwpAction::GetDefault()
 {
-    VARIANT result = InvokeMethod(L"GetDefault");
-    if (result.vt == VT_DISPATCH) {
-        return result.pdispVal;
-    }
-    return nullptr;
+    ScopedVariant result(InvokeMethod(L"GetDefault"));
+    return result.DetachDispatch();
 }
 
 bool HwpAction::PopupDialog(IDispatch* pset)
 {
     if (!pset) return false;
 
+    NoteEdit();
+
     VARIANT args[1];
     VariantInit(&args[0]);
     args[0].vt = VT_DISPATCH;
     args[0].pdispVal = pset;
 
-    VARIANT result = InvokeMethod(L"PopupDialog", { args[0] });
-    if (result.vt == VT_BOOL) {
-        return result.boolVal != VARIANT_FALSE;
-    }
-    return false;
+    ScopedVariant result(InvokeMethod(L"PopupDialog", { args[0] }));
+    return result.vt() == VT_BOOL && result.ToBool();
 }
 
 std::wstring HwpAction::GetActionID() const
 {
     if (!m_pAction) return L"";
 
-    DISPID dispid;
-    OLECHAR* name = const_cast<OLECHAR*>(L"ActionID");
-    HRESULT hr = m_pAction->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return L"";
+    DISPID dispid = ActionDispid(m_pAction, L"ActionID");
+    if (dispid == DISPID_UNKNOWN) return L"";
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                           &params, &result, NULL, NULL);
+    HRESULT hr = ComInvoke(m_pAction, dispid, DISPATCH_PROPERTYGET,
+                           &params, result.Receive(), NULL, NULL);
 
-    if (SUCCEEDED(hr) && result.vt == VT_BSTR && result.bstrVal) {
-        std::wstring id(result.bstrVal);
-        SysFreeString(result.bstrVal);
-        return id;
-    }
-    return L"";
+    if (FAILED(hr)) return L"";
+    return result.ToString();
 }
 
 VARIANT HwpAction::InvokeMethod(const std::wstring& name,
@@ -113,10 +157,8 @@ VARIANT HwpAction::InvokeMethod(const std::wstring& name,
 
     if (!m_pAction) return result;
 
-    DISPID dispid;
-    OLECHAR* methodName = const_cast<OLECHAR*>(name.c_str());
-    HRESULT hr = m_pAction->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return result;
+    DISPID dispid = ActionDispid(m_pAction, name);
+    if (dispid == DISPID_UNKNOWN) return result;
 
     std::vector<VARIANT> reversedArgs(args.rbegin(), args.rend());
 
@@ -127,8 +169,8 @@ VARIANT HwpAction::InvokeMethod(const std::wstring& name,
         0
     };
 
-    m_pAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                      &params, &result, NULL, NULL);
+    ComInvoke(m_pAction, dispid, DISPATCH_METHOD,
+              &params, &result, NULL, NULL);
 
     return result;
 }
@@ -155,15 +197,18 @@ bool HwpActionHelper::RunWithSet(HwpWrapper* hwp,
     if (!pAction) return false;
 
     // 파라미터셋 생성
-    IDispatch* pSet = hwp->CreateSet(set_name);
+    IDispatch* pSet = hwp->AcquireSet(set_name);
     if (!pSet) {
         pAction->Release();
         return false;
     }
 
     // GetDefault 호출
-    HwpAction action(pAction, hwp);
+    HwpAction action(pAction, hwp, action_name);
     IDispatch* pDefault = action.GetDefault();
+    if (pDefault) {
+        pDefault->Release();
+    }
 
     // 커스텀 setter 호출
     if (setter && pSet) {
@@ -173,7 +218,7 @@ bool HwpActionHelper::RunWithSet(HwpWrapper* hwp,
     // Execute 실행
     bool success = action.Execute(pSet);
 
-    pSet->Release();
+    hwp->ReleaseSet(set_name, pSet);
     pAction->Release();
 
     return success;
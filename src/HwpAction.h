@@ -9,8 +9,7 @@
 #pragma once
 
 #include "HwpTypes.h"
-#include <Windows.h>
-#include <comdef.h>
+#include "ComPlatform.h"
 #include <string>
 #include <vector>
 #include <functional>
@@ -38,8 +37,9 @@ public:
      * @brief HwpAction 생성자
      * @param action COM 액션 객체
      * @param hwp 부모 HwpWrapper 참조
+     * @param action_id 액션 ID (알면 지정: 편집 분류와 작업 기록에서 COM 조회 생략)
      */
-    HwpAction(IDispatch* action, HwpWrapper* hwp);
+    HwpAction(IDispatch* action, HwpWrapper* hwp, const std::wstring& action_id = L"");
 
     /**
      * @brief 소멸자
@@ -111,8 +111,14 @@ protected:
                          const std::vector<VARIANT>& args = {});
 
 private:
+    /**
+     * @brief 실행 전 편집 세대 기록
+     */
+    void NoteEdit();
+
     IDispatch* m_pAction;   // HAction COM 포인터
     HwpWrapper* m_pHwp;     // 부모 HwpWrapper
+    std::wstring m_actionId;    // 액션 ID (모르면 빈 문자열)
 };
 
 /**
@@ -0,0 +1,697 @@
+/**
+ * @file HwpBatch.cpp
+ * @brief HwpBatch 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "HwpBatch.h"
+#include "HwpWrapper.h"
+#include "HwpAction.h"
+#include "HwpParameter.h"
+#include "ComScope.h"
+#include "ComTrace.h"
+#include "ComPlatform.h"
+#include "Utils.h"
+#include <cstdio>
+#include <cstring>
+
+namespace cpyhwpx {
+
+namespace {
+
+constexpr uint8_t kFieldText = 0x01;
+constexpr uint8_t kFieldStart = 0x02;
+constexpr uint8_t kFieldSelect = 0x04;
+
+constexpr char kMagic[4] = { 'H', 'W', 'P', 'J' };
+constexpr uint32_t kVersion = 1;
+
+//=============================================================================
+// 직렬화 도우미 (리틀 엔디언, 문자열은 UTF-8)
+//=============================================================================
+
+FILE* OpenFile(const std::wstring& path, bool write)
+{
+#if defined(_WIN32)
+    return _wfopen(path.c_str(), write ? L"wb" : L"rb");
+#else
+    return fopen(Utils::ToUtf8(path).c_str(), write ? "wb" : "rb");
+#endif
+}
+
+void PutU8(std::string& out, uint8_t v)
+{
+    out += static_cast<char>(v);
+}
+
+void PutU32(std::string& out, uint32_t v)
+{
+    for (int i = 0; i < 4; ++i) {
+        out += static_cast<char>((v >> (8 * i)) & 0xFF);
+    }
+}
+
+void PutF64(std::string& out, double v)
+{
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    for (int i = 0; i < 8; ++i) {
+        out += static_cast<char>((bits >> (8 * i)) & 0xFF);
+    }
+}
+
+void PutStr(std::string& out, const std::wstring& str)
+{
+    std::string utf8 = Utils::ToUtf8(str);
+    PutU32(out, static_cast<uint32_t>(utf8.size()));
+    out += utf8;
+}
+
+/**
+ * @brief 순차 읽기 (범위를 벗어나면 이후 모든 읽기가 실패)
+ */
+struct Reader {
+    const std::string& data;
+    size_t pos;
+    bool ok;
+
+    bool Has(size_t n) { ok = ok && (data.size() - pos >= n); return ok; }
+
+    uint8_t U8()
+    {
+        if (!Has(1)) return 0;
+        return static_cast<uint8_t>(data[pos++]);
+    }
+
+    uint32_t U32()
+    {
+        if (!Has(4)) return 0;
+        uint32_t v = 0;
+        for (int i = 0; i < 4; ++i) {
+            v |= static_cast<uint32_t>(static_cast<uint8_t>(data[pos++])) << (8 * i);
+        }
+        return v;
+    }
+
+    int32_t I32() { return static_cast<int32_t>(U32()); }
+
+    double F64()
+    {
+        if (!Has(8)) return 0.0;
+        uint64_t bits = 0;
+        for (int i = 0; i < 8; ++i) {
+            bits |= static_cast<uint64_t>(static_cast<uint8_t>(data[pos++])) << (8 * i);
+        }
+        double v;
+        memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+    std::wstring Str()
+    {
+        uint32_t len = U32();
+        if (!Has(len)) return std::wstring();
+        std::wstring str = Utils::FromUtf8(data.data() + pos, len);
+        pos += len;
+        return str;
+    }
+};
+
+const char* OpName(HwpBatch::Op op)
+{
+    switch (op) {
+    case HwpBatch::Op::RunAction:    return "RunAction";
+    case HwpBatch::Op::SetPos:       return "SetPos";
+    case HwpBatch::Op::MovePos:      return "MovePos";
+    case HwpBatch::Op::InsertText:   return "InsertText";
+    case HwpBatch::Op::PutFieldText: return "PutFieldText";
+    case HwpBatch::Op::MoveToField:  return "MoveToField";
+    case HwpBatch::Op::ExecuteSet:   return "ExecuteSet";
+    case HwpBatch::Op::Skipped:      return "Skipped";
+    }
+    return "";
+}
+
+} // namespace
+
+//=============================================================================
+// 기록
+//=============================================================================
+
+HwpBatch::Command& HwpBatch::Push(Op op)
+{
+    m_commands.push_back(Command{ op, 0, 0, 0, 0, 0, 0 });
+    return m_commands.back();
+}
+
+uint32_t HwpBatch::Intern(const std::wstring& name)
+{
+    auto it = m_names.find(name);
+    if (it != m_names.end()) return it->second;
+
+    uint32_t index = Store(name);
+    m_names.emplace(name, index);
+    return index;
+}
+
+uint32_t HwpBatch::Store(const std::wstring& text)
+{
+    m_strings.push_back(text);
+    return static_cast<uint32_t>(m_strings.size() - 1);
+}
+
+HwpBatch& HwpBatch::RunAction(const std::wstring& action_name)
+{
+    Push(Op::RunAction).s0 = Intern(action_name);
+    return *this;
+}
+
+HwpBatch& HwpBatch::SetPos(int list, int para, int pos)
+{
+    Command& cmd = Push(Op::SetPos);
+    cmd.a = list;
+    cmd.b = para;
+    cmd.c = pos;
+    return *this;
+}
+
+HwpBatch& HwpBatch::MovePos(int move_id, int para, int pos)
+{
+    Command& cmd = Push(Op::MovePos);
+    cmd.a = move_id;
+    cmd.b = para;
+    cmd.c = pos;
+    return *this;
+}
+
+HwpBatch& HwpBatch::InsertText(const std::wstring& text)
+{
+    Push(Op::InsertText).s0 = Store(text);
+    return *this;
+}
+
+HwpBatch& HwpBatch::PutFieldText(const std::wstring& field, const std::wstring& text)
+{
+    uint32_t fieldIndex = Intern(field);
+    uint32_t textIndex = Store(text);
+    Command& cmd = Push(Op::PutFieldText);
+    cmd.s0 = fieldIndex;
+    cmd.s1 = textIndex;
+    return *this;
+}
+
+HwpBatch& HwpBatch::MoveToField(const std::wstring& field, int idx,
+                                bool text, bool start, bool select)
+{
+    uint32_t fieldIndex = Intern(field);
+    Command& cmd = Push(Op::MoveToField);
+    cmd.s0 = fieldIndex;
+    cmd.a = idx;
+    cmd.flags = static_cast<uint8_t>((text ? kFieldText : 0) |
+                                     (start ? kFieldStart : 0) |
+                                     (select ? kFieldSelect : 0));
+    return *this;
+}
+
+HwpBatch& HwpBatch::ExecuteSet(const std::wstring& action_name, const std::wstring& set_name)
+{
+    uint32_t actionIndex = Intern(action_name);
+    uint32_t setIndex = Intern(set_name);
+    Command& cmd = Push(Op::ExecuteSet);
+    cmd.s0 = actionIndex;
+    cmd.s1 = setIndex;
+    cmd.a = static_cast<int32_t>(m_items.size());
+    cmd.b = 0;
+    return *this;
+}
+
+HwpBatch& HwpBatch::PushItem(const SetItem& item)
+{
+    // 아이템은 마지막 ExecuteSet 뒤에만 이어 붙일 수 있다
+    if (m_commands.empty() || m_commands.back().op != Op::ExecuteSet) {
+        return *this;
+    }
+    m_items.push_back(item);
+    m_commands.back().b++;
+    return *this;
+}
+
+HwpBatch& HwpBatch::Item(const std::wstring& name, int value)
+{
+    return PushItem(SetItem{ SetItem::Int, Intern(name), value, 0.0, 0 });
+}
+
+HwpBatch& HwpBatch::Item(const std::wstring& name, double value)
+{
+    return PushItem(SetItem{ SetItem::Double, Intern(name), 0, value, 0 });
+}
+
+HwpBatch& HwpBatch::Item(const std::wstring& name, bool value)
+{
+    return PushItem(SetItem{ SetItem::Bool, Intern(name), value ? 1 : 0, 0.0, 0 });
+}
+
+HwpBatch& HwpBatch::Item(const std::wstring& name, const std::wstring& value)
+{
+    uint32_t nameIndex = Intern(name);
+    return PushItem(SetItem{ SetItem::String, nameIndex, 0, 0.0, Store(value) });
+}
+
+HwpBatch& HwpBatch::Item(const std::wstring& name, const wchar_t* value)
+{
+    // 문자열 리터럴이 bool 오버로드로 가지 않도록
+    return Item(name, std::wstring(value ? value : L""));
+}
+
+HwpBatch& HwpBatch::Skipped(const std::wstring& name)
+{
+    Push(Op::Skipped).s0 = Intern(name);
+    return *this;
+}
+
+HwpBatch& HwpBatch::Append(const HwpBatch& other)
+{
+    if (&other == this) {
+        HwpBatch copy(other);
+        return Append(copy);
+    }
+
+    for (const Command& src : other.m_commands) {
+        Command cmd = src;
+        switch (src.op) {
+        case Op::RunAction:
+        case Op::MoveToField:
+        case Op::Skipped:
+            cmd.s0 = Intern(other.m_strings[src.s0]);
+            break;
+        case Op::InsertText:
+            cmd.s0 = Store(other.m_strings[src.s0]);
+            break;
+        case Op::PutFieldText:
+            cmd.s0 = Intern(other.m_strings[src.s0]);
+            cmd.s1 = Store(other.m_strings[src.s1]);
+            break;
+        case Op::ExecuteSet:
+            cmd.s0 = Intern(other.m_strings[src.s0]);
+            cmd.s1 = Intern(other.m_strings[src.s1]);
+            cmd.a = static_cast<int32_t>(m_items.size());
+            for (int32_t k = src.a; k < src.a + src.b; ++k) {
+                SetItem item = other.m_items[static_cast<size_t>(k)];
+                item.name = Intern(other.m_strings[item.name]);
+                if (item.kind == SetItem::String) {
+                    item.s = Store(other.m_strings[item.s]);
+                }
+                m_items.push_back(item);
+            }
+            break;
+        case Op::SetPos:
+        case Op::MovePos:
+            break;
+        }
+        m_commands.push_back(cmd);
+    }
+    return *this;
+}
+
+size_t HwpBatch::SkippedCount() const
+{
+    size_t count = 0;
+    for (const Command& cmd : m_commands) {
+        if (cmd.op == Op::Skipped) ++count;
+    }
+    return count;
+}
+
+void HwpBatch::Clear()
+{
+    m_commands.clear();
+    m_items.clear();
+    m_strings.clear();
+    m_names.clear();
+}
+
+//=============================================================================
+// 실행
+//=============================================================================
+
+struct HwpBatch::Replay {
+    std::unordered_map<uint32_t, IDispatch*> actions;  // 액션 이름 인덱스 → HAction 객체
+    std::unordered_map<uint32_t, ScopedBstr> bstrs;    // 문자열 풀 인덱스 → 값 BSTR
+
+    Replay() = default;
+    Replay(const Replay&) = delete;
+    Replay& operator=(const Replay&) = delete;
+
+    ~Replay()
+    {
+        for (auto& action : actions) {
+            if (action.second) action.second->Release();
+        }
+    }
+};
+
+std::vector<bool> HwpBatch::Execute(HwpWrapper& hwp, bool stop_on_error) const
+{
+    CPYHWPX_TRACE_METHOD();
+    std::vector<bool> results(m_commands.size(), false);
+    Replay replay;
+
+    for (size_t i = 0; i < m_commands.size(); ++i) {
+        bool ok = Run(hwp, m_commands[i], replay);
+        results[i] = ok;
+        if (!ok && stop_on_error) break;
+    }
+    return results;
+}
+
+bool HwpBatch::Run(HwpWrapper& hwp, const Command& cmd, Replay& replay) const
+{
+    switch (cmd.op) {
+    case Op::RunAction:
+        return hwp.RunAction(m_strings[cmd.s0]);
+
+    case Op::SetPos:
+        return hwp.SetPos(cmd.a, cmd.b, cmd.c);
+
+    case Op::MovePos:
+        return hwp.MovePos(cmd.a, cmd.b, cmd.c);
+
+    case Op::InsertText:
+        return hwp.InsertText(m_strings[cmd.s0]);
+
+    case Op::PutFieldText:
+        return hwp.PutFieldText(m_strings[cmd.s0], m_strings[cmd.s1]);
+
+    case Op::MoveToField:
+        return hwp.MoveToField(m_strings[cmd.s0], cmd.a,
+                               (cmd.flags & kFieldText) != 0,
+                               (cmd.flags & kFieldStart) != 0,
+                               (cmd.flags & kFieldSelect) != 0);
+
+    case Op::ExecuteSet:
+        return RunExecuteSet(hwp, cmd, replay);
+
+    case Op::Skipped:
+        return false;
+    }
+    return false;
+}
+
+bool HwpBatch::RunExecuteSet(HwpWrapper& hwp, const Command& cmd, Replay& replay) const
+{
+    const std::wstring& actionName = m_strings[cmd.s0];
+    const std::wstring& setName = m_strings[cmd.s1];
+
+    IDispatch*& pAction = replay.actions[cmd.s0];
+    if (!pAction) pAction = hwp.CreateAction(actionName);
+    if (!pAction) return false;
+
+    IDispatch* pSet = hwp.AcquireSet(setName);
+    if (!pSet) return false;
+
+    HwpAction action(pAction, &hwp, actionName);
+    IDispatch* pDefault = action.GetDefault();
+    if (pDefault) pDefault->Release();
+
+    std::vector<std::pair<std::wstring, VARIANT>> values;
+    values.reserve(static_cast<size_t>(cmd.b));
+    for (int32_t k = cmd.a; k < cmd.a + cmd.b; ++k) {
+        const SetItem& item = m_items[static_cast<size_t>(k)];
+        VARIANT var;
+        VariantInit(&var);
+        switch (item.kind) {
+        case SetItem::Int:
+            var = IntArg(static_cast<int>(item.i));
+            break;
+        case SetItem::Double:
+            var.vt = VT_R8;
+            var.dblVal = item.d;
+            break;
+        case SetItem::Bool:
+            var.vt = VT_BOOL;
+            var.boolVal = item.i ? VARIANT_TRUE : VARIANT_FALSE;
+            break;
+        case SetItem::String: {
+            auto it = replay.bstrs.find(item.s);
+            if (it == replay.bstrs.end()) {
+                it = replay.bstrs.emplace(item.s, ScopedBstr(m_strings[item.s])).first;
+            }
+            var = BstrArg(it->second.get());
+            break;
+        }
+        }
+        values.emplace_back(m_strings[item.name], var);
+    }
+    HwpParameterSet(pSet, setName).SetItems(values);
+
+    bool ok = action.Execute(pSet);
+    hwp.ReleaseSet(setName, pSet);
+    return ok;
+}
+
+//=============================================================================
+// 저장 (작업 기록 파일)
+//=============================================================================
+
+std::string HwpBatch::BinaryHeader()
+{
+    std::string out(kMagic, sizeof(kMagic));
+    PutU32(out, kVersion);
+    return out;
+}
+
+void HwpBatch::AppendRecord(size_t index, std::string& out) const
+{
+    const Command& cmd = m_commands[index];
+    PutU8(out, static_cast<uint8_t>(cmd.op));
+
+    switch (cmd.op) {
+    case Op::RunAction:
+    case Op::InsertText:
+    case Op::Skipped:
+        PutStr(out, m_strings[cmd.s0]);
+        break;
+
+    case Op::SetPos:
+    case Op::MovePos:
+        PutU32(out, static_cast<uint32_t>(cmd.a));
+        PutU32(out, static_cast<uint32_t>(cmd.b));
+        PutU32(out, static_cast<uint32_t>(cmd.c));
+        break;
+
+    case Op::PutFieldText:
+        PutStr(out, m_strings[cmd.s0]);
+        PutStr(out, m_strings[cmd.s1]);
+        break;
+
+    case Op::MoveToField:
+        PutStr(out, m_strings[cmd.s0]);
+        PutU32(out, static_cast<uint32_t>(cmd.a));
+        PutU8(out, cmd.flags);
+        break;
+
+    case Op::ExecuteSet:
+        PutStr(out, m_strings[cmd.s0]);
+        PutStr(out, m_strings[cmd.s1]);
+        PutU32(out, static_cast<uint32_t>(cmd.b));
+        for (int32_t k = cmd.a; k < cmd.a + cmd.b; ++k) {
+            const SetItem& item = m_items[static_cast<size_t>(k)];
+            PutU8(out, static_cast<uint8_t>(item.kind));
+            PutStr(out, m_strings[item.name]);
+            switch (item.kind) {
+            case SetItem::Int:
+            case SetItem::Bool:   PutU32(out, static_cast<uint32_t>(item.i)); break;
+            case SetItem::Double: PutF64(out, item.d); break;
+            case SetItem::String: PutStr(out, m_strings[item.s]); break;
+            }
+        }
+        break;
+    }
+}
+
+std::string HwpBatch::ToBinary() const
+{
+    std::string out = BinaryHeader();
+    for (size_t i = 0; i < m_commands.size(); ++i) {
+        AppendRecord(i, out);
+    }
+    return out;
+}
+
+bool HwpBatch::FromBinary(const std::string& data, HwpBatch& out)
+{
+    out.Clear();
+    if (data.size() < 8 || memcmp(data.data(), kMagic, sizeof(kMagic)) != 0) {
+        return false;
+    }
+
+    Reader r{ data, sizeof(kMagic), true };
+    if (r.U32() != kVersion) return false;
+
+    // 레코드를 임시 묶음에 읽고, 온전히 읽힌 레코드만 out에 옮긴다
+    while (r.ok && r.pos < data.size()) {
+        HwpBatch record;
+        Op op = static_cast<Op>(r.U8());
+
+        switch (op) {
+        case Op::RunAction:
+            record.RunAction(r.Str());
+            break;
+        case Op::InsertText:
+            record.InsertText(r.Str());
+            break;
+        case Op::Skipped:
+            record.Skipped(r.Str());
+            break;
+        case Op::SetPos:
+        case Op::MovePos: {
+            int32_t a = r.I32();
+            int32_t b = r.I32();
+            int32_t c = r.I32();
+            if (op == Op::SetPos) record.SetPos(a, b, c);
+            else record.MovePos(a, b, c);
+            break;
+        }
+        case Op::PutFieldText: {
+            std::wstring field = r.Str();
+            std::wstring text = r.Str();
+            record.PutFieldText(field, text);
+            break;
+        }
+        case Op::MoveToField: {
+            std::wstring field = r.Str();
+            int32_t idx = r.I32();
+            uint8_t flags = r.U8();
+            record.MoveToField(field, idx, (flags & kFieldText) != 0,
+                               (flags & kFieldStart) != 0, (flags & kFieldSelect) != 0);
+            break;
+        }
+        case Op::ExecuteSet: {
+            std::wstring action = r.Str();
+            std::wstring set = r.Str();
+            record.ExecuteSet(action, set);
+            uint32_t count = r.U32();
+            for (uint32_t k = 0; k < count && r.ok; ++k) {
+                uint8_t kind = r.U8();
+                std::wstring name = r.Str();
+                switch (kind) {
+                case SetItem::Int:    record.Item(name, static_cast<int>(r.I32())); break;
+                case SetItem::Bool:   record.Item(name, r.I32() != 0); break;
+                case SetItem::Double: record.Item(name, r.F64()); break;
+                case SetItem::String: record.Item(name, r.Str()); break;
+                default:              r.ok = false; break;
+                }
+            }
+            break;
+        }
+        default:
+            r.ok = false;
+            break;
+        }
+
+        if (!r.ok) break;   // 끝이 잘린 레코드 (기록 중 비정상 종료)
+        out.Append(record);
+    }
+    return true;
+}
+
+std::string HwpBatch::ToJson() const
+{
+    std::string out = "[";
+    for (size_t i = 0; i < m_commands.size(); ++i) {
+        const Command& cmd = m_commands[i];
+        if (i > 0) out += ",";
+        out += "\n  {\"op\":\"";
+        out += OpName(cmd.op);
+        out += "\"";
+
+        switch (cmd.op) {
+        case Op::RunAction:
+        case Op::Skipped:
+            out += ",\"action\":";
+            Utils::AppendJsonString(out, m_strings[cmd.s0]);
+            break;
+        case Op::InsertText:
+            out += ",\"text\":";
+            Utils::AppendJsonString(out, m_strings[cmd.s0]);
+            break;
+        case Op::SetPos:
+        case Op::MovePos:
+            out += (cmd.op == Op::SetPos) ? ",\"list\":" : ",\"move_id\":";
+            out += std::to_string(cmd.a);
+            out += ",\"para\":" + std::to_string(cmd.b);
+            out += ",\"pos\":" + std::to_string(cmd.c);
+            break;
+        case Op::PutFieldText:
+            out += ",\"field\":";
+            Utils::AppendJsonString(out, m_strings[cmd.s0]);
+            out += ",\"text\":";
+            Utils::AppendJsonString(out, m_strings[cmd.s1]);
+            break;
+        case Op::MoveToField:
+            out += ",\"field\":";
+            Utils::AppendJsonString(out, m_strings[cmd.s0]);
+            out += ",\"idx\":" + std::to_string(cmd.a);
+            out += (cmd.flags & kFieldText) ? ",\"text\":true" : ",\"text\":false";
+            out += (cmd.flags & kFieldStart) ? ",\"start\":true" : ",\"start\":false";
+            out += (cmd.flags & kFieldSelect) ? ",\"select\":true" : ",\"select\":false";
+            break;
+        case Op::ExecuteSet:
+            out += ",\"action\":";
+            Utils::AppendJsonString(out, m_strings[cmd.s0]);
+            out += ",\"set\":";
+            Utils::AppendJsonString(out, m_strings[cmd.s1]);
+            out += ",\"items\":{";
+            for (int32_t k = cmd.a; k < cmd.a + cmd.b; ++k) {
+                const SetItem& item = m_items[static_cast<size_t>(k)];
+                if (k > cmd.a) out += ",";
+                Utils::AppendJsonString(out, m_strings[item.name]);
+                out += ":";
+                switch (item.kind) {
+                case SetItem::Int:    out += std::to_string(item.i); break;
+                case SetItem::Bool:   out += item.i ? "true" : "false"; break;
+                case SetItem::Double: {
+                    char buf[32];
+                    snprintf(buf, sizeof(buf), "%.17g", item.d);
+                    out += buf;
+                    break;
+                }
+                case SetItem::String: Utils::AppendJsonString(out, m_strings[item.s]); break;
+                }
+            }
+            out += "}";
+            break;
+        }
+        out += "}";
+    }
+    out += m_commands.empty() ? "]" : "\n]";
+    return out;
+}
+
+bool HwpBatch::SaveFile(const std::wstring& path) const
+{
+    FILE* file = OpenFile(path, true);
+    if (!file) return false;
+    std::string data = ToBinary();
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok = (fclose(file) == 0) && ok;
+    return ok;
+}
+
+bool HwpBatch::LoadFile(const std::wstring& path, HwpBatch& out)
+{
+    FILE* file = OpenFile(path, false);
+    if (!file) return false;
+
+    std::string data;
+    char buf[65536];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        data.append(buf, n);
+    }
+    fclose(file);
+    return FromBinary(data, out);
+}
+
+} // namespace cpyhwpx
@@ -0,0 +1,245 @@
+/**
+ * @file HwpBatch.h
+ * @brief 작업 묶음 (기록 후 한 번에 실행)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * "필드로 이동 → 텍스트 입력 → 다음 셀 → 진하게" 같은 작은 편집을 하나씩 호출하면
+ * 호출마다 Python→C++ 전환(GIL)과, AsyncHwp를 쓰는 경우 스레드 왕복이 생긴다.
+ * HwpBatch는 작업을 고정 크기 명령 배열과 문자열 풀에 기록해 두었다가
+ * HwpWrapper 소유 스레드에서 한 번에 실행하고 작업별 결과를 돌려준다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cpyhwpx {
+
+class HwpWrapper;
+
+/**
+ * @class HwpBatch
+ * @brief 기록된 HwpWrapper 작업 목록
+ *
+ * 기록 메서드는 *this를 반환하므로 이어서 쓸 수 있다.
+ * 액션/필드/아이템 이름은 풀에서 공유하므로 같은 이름을 수천 번 기록해도
+ * 문자열은 한 번만 저장된다.
+ *
+ * ```cpp
+ * HwpBatch batch;
+ * batch.MoveToField(L"이름").InsertText(L"홍길동")
+ *      .RunAction(L"TableRightCell")
+ *      .ExecuteSet(L"CharShape", L"CharShape").Item(L"Bold", true);
+ * std::vector<bool> ok = batch.Execute(hwp);
+ * ```
+ */
+class HwpBatch {
+public:
+    /**
+     * @brief 명령 종류
+     */
+    enum class Op : uint8_t {
+        RunAction = 0,      // RunAction(s0)
+        SetPos,             // SetPos(a, b, c)
+        MovePos,            // MovePos(a, b, c)
+        InsertText,         // InsertText(s0)
+        PutFieldText,       // PutFieldText(s0, s1)
+        MoveToField,        // MoveToField(s0, a, flags)
+        ExecuteSet,         // CreateAction(s0) + CreateSet(s1) + 아이템[a, a+b) + Execute
+        Skipped             // 재생할 수 없어 기록만 남긴 작업 s0 (실행하면 실패)
+    };
+
+    HwpBatch() = default;
+
+    //=========================================================================
+    // 기록
+    //=========================================================================
+
+    /**
+     * @brief HAction.Run(action_name)
+     */
+    HwpBatch& RunAction(const std::wstring& action_name);
+
+    /**
+     * @brief 캐럿 위치 설정
+     */
+    HwpBatch& SetPos(int list, int para, int pos);
+
+    /**
+     * @brief 캐럿 이동 (MoveID)
+     */
+    HwpBatch& MovePos(int move_id, int para = 0, int pos = 0);
+
+    /**
+     * @brief 현재 위치에 텍스트 삽입
+     */
+    HwpBatch& InsertText(const std::wstring& text);
+
+    /**
+     * @brief 필드 텍스트 설정
+     */
+    HwpBatch& PutFieldText(const std::wstring& field, const std::wstring& text);
+
+    /**
+     * @brief 필드로 캐럿 이동
+     */
+    HwpBatch& MoveToField(const std::wstring& field, int idx = 0,
+                          bool text = true, bool start = true, bool select = false);
+
+    /**
+     * @brief 파라미터셋과 함께 액션 실행
+     * @param action_name 액션 이름 ("CharShape" 등)
+     * @param set_name 파라미터셋 이름 ("CharShape" 등)
+     *
+     * 이어서 Item()으로 기록한 값이 이 액션의 파라미터셋에 설정된다.
+     */
+    HwpBatch& ExecuteSet(const std::wstring& action_name, const std::wstring& set_name);
+
+    /**
+     * @brief 마지막 ExecuteSet의 파라미터 값 (ExecuteSet 직후가 아니면 무시)
+     */
+    HwpBatch& Item(const std::wstring& name, int value);
+    HwpBatch& Item(const std::wstring& name, double value);
+    HwpBatch& Item(const std::wstring& name, bool value);
+    HwpBatch& Item(const std::wstring& name, const std::wstring& value);
+    HwpBatch& Item(const std::wstring& name, const wchar_t* value);
+
+    /**
+     * @brief 재생할 수 없는 작업 자리 표시 (ActionRecorder가 내용을 다 모으지 못한 작업)
+     * @param name 액션 또는 메서드 이름
+     *
+     * Execute()에서는 실행하지 않고 실패로 보고한다.
+     */
+    HwpBatch& Skipped(const std::wstring& name);
+
+    /**
+     * @brief 다른 묶음의 작업을 뒤에 이어 붙임
+     */
+    HwpBatch& Append(const HwpBatch& other);
+
+    //=========================================================================
+    // 실행
+    //=========================================================================
+
+    /**
+     * @brief 기록된 작업을 순서대로 실행
+     * @param hwp 대상 (호출 스레드가 hwp 소유 스레드여야 함)
+     * @param stop_on_error true면 처음 실패한 작업 이후는 실행하지 않음 (false)
+     * @return 작업별 성공 여부 (size()개)
+     *
+     * 같은 액션의 HAction 객체와 문자열 값 BSTR은 실행 한 번 동안 한 번만 만들고,
+     * 파라미터셋은 hwp의 세트 풀에서 빌린다.
+     */
+    std::vector<bool> Execute(HwpWrapper& hwp, bool stop_on_error = false) const;
+
+    //=========================================================================
+    // 저장 (작업 기록 파일)
+    //=========================================================================
+
+    /**
+     * @brief 이진 형식으로 직렬화 ("HWPJ" 헤더 + 작업 레코드)
+     *
+     * 레코드는 문자열을 직접 담으므로 파일 끝에 계속 이어 쓸 수 있다 (ActionRecorder).
+     */
+    std::string ToBinary() const;
+
+    /**
+     * @brief 이진 형식 읽기
+     * @return 헤더가 잘못되었으면 false. 끝이 잘린 레코드는 버리고 앞부분만 읽는다.
+     */
+    static bool FromBinary(const std::string& data, HwpBatch& out);
+
+    /**
+     * @brief 파일 헤더 ("HWPJ" + 버전)
+     */
+    static std::string BinaryHeader();
+
+    /**
+     * @brief index번째 작업 레코드를 out 끝에 추가
+     */
+    void AppendRecord(size_t index, std::string& out) const;
+
+    /**
+     * @brief 사람이 읽을 수 있는 JSON 배열 (확인/비교용, 읽기는 지원하지 않음)
+     */
+    std::string ToJson() const;
+
+    /**
+     * @brief 이진 형식으로 파일 저장/읽기
+     */
+    bool SaveFile(const std::wstring& path) const;
+    static bool LoadFile(const std::wstring& path, HwpBatch& out);
+
+    //=========================================================================
+    // 상태
+    //=========================================================================
+
+    size_t size() const { return m_commands.size(); }
+    bool empty() const { return m_commands.empty(); }
+
+    /**
+     * @brief Skipped 작업 수
+     */
+    size_t SkippedCount() const;
+
+    /**
+     * @brief 기록 삭제 (풀 용량은 유지)
+     */
+    void Clear();
+
+private:
+    /**
+     * @brief 명령 1개 (24바이트)
+     */
+    struct Command {
+        Op op;
+        uint8_t flags;      // MoveToField: bit0=text, bit1=start, bit2=select
+        int32_t a;
+        int32_t b;
+        int32_t c;
+        uint32_t s0;        // 문자열 풀 인덱스
+        uint32_t s1;
+    };
+
+    /**
+     * @brief ExecuteSet 파라미터 값
+     */
+    struct SetItem {
+        enum Kind : uint8_t { Int, Double, Bool, String } kind;
+        uint32_t name;      // 문자열 풀 인덱스
+        int32_t i;          // Int/Bool
+        double d;           // Double
+        uint32_t s;         // String (문자열 풀 인덱스)
+    };
+
+    Command& Push(Op op);
+    HwpBatch& PushItem(const SetItem& item);
+
+    /**
+     * @brief 이름 풀 (같은 이름은 같은 인덱스)
+     */
+    uint32_t Intern(const std::wstring& name);
+
+    /**
+     * @brief 본문 텍스트 풀 (중복 제거 없음)
+     */
+    uint32_t Store(const std::wstring& text);
+
+    /**
+     * @brief Execute() 한 번 동안 재사용하는 COM 객체 (HwpBatch.cpp)
+     */
+    struct Replay;
+
+    bool Run(HwpWrapper& hwp, const Command& cmd, Replay& replay) const;
+    bool RunExecuteSet(HwpWrapper& hwp, const Command& cmd, Replay& replay) const;
+
+    std::vector<Command> m_commands;
+    std::vector<SetItem> m_items;
+    std::vector<std::wstring> m_strings;
+    std::unordered_map<std::wstring, uint32_t> m_names;
+};
+
+} // namespace cpyhwpx
@@ -7,6 +7,8 @@
 
 #include "HwpCtrl.h"
 #include "HwpWrapper.h"
+#include "ComScope.h"
+#include "ComStats.h"
 
 namespace cpyhwpx {
 
@@ -59,13 +61,8 @@ HwpCtrl& HwpCtrl::operator=(HwpCtrl&& other) noexcept
 
 std::wstring HwpCtrl::GetCtrlID() const
 {
-    VARIANT result = GetProperty(L"CtrlID");
-    if (result.vt == VT_BSTR && result.bstrVal) {
-        std::wstring id(result.bstrVal);
-        SysFreeString(result.bstrVal);
-        return id;
-    }
-    return L"";
+    ScopedVariant result(GetProperty(L"CtrlID"));
+    return result.ToString();
 }
 
 CtrlType HwpCtrl::GetCtrlType() const
@@ -75,11 +72,8 @@ CtrlType HwpCtrl::GetCtrlType() const
 
 int HwpCtrl::GetCtrlCh() const
 {
-    VARIANT result = GetProperty(L"CtrlCh");
-    if (result.vt == VT_I4) {
-        return result.lVal;
-    }
-    return 0;
+    ScopedVariant result(GetProperty(L"CtrlCh"));
+    return result.vt() == VT_I4 ? result.ToInt() : 0;
 }
 
 CtrlType HwpCtrl::CtrlIDToType(const std::wstring& id)
@@ -123,36 +117,40 @@ CtrlType HwpCtrl::CtrlIDToType(const std::wstring& id)
 
 std::unique_ptr<HwpCtrl> HwpCtrl::Next() const
 {
-    VARIANT result = GetProperty(L"Next");
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        return std::make_unique<HwpCtrl>(result.pdispVal, m_pHwp);
+    // HwpCtrl이 AddRef 하므로 결과 참조는 ScopedVariant가 해제
+    ScopedVariant result(GetProperty(L"Next"));
+    if (result.vt() == VT_DISPATCH && result.get().pdispVal) {
+        return std::make_unique<HwpCtrl>(result.get().pdispVal, m_pHwp);
     }
     return nullptr;
 }
 
 std::unique_ptr<HwpCtrl> HwpCtrl::Prev() const
 {
-    VARIANT result = GetProperty(L"Prev");
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        return std::make_unique<HwpCtrl>(result.pdispVal, m_pHwp);
+    // HwpCtrl이 AddRef 하므로 결과 참조는 ScopedVariant가 해제
+    ScopedVariant result(GetProperty(L"Prev"));
+    if (result.vt() == VT_DISPATCH && result.get().pdispVal) {
+        return std::make_unique<HwpCtrl>(result.get().pdispVal, m_pHwp);
     }
     return nullptr;
 }
 
 std::unique_ptr<HwpCtrl> HwpCtrl::Parent() const
 {
-    VARIANT result = GetProperty(L"Parent");
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        return std::make_unique<HwpCtrl>(result.pdispVal, m_pHwp);
+    // HwpCtrl이 AddRef 하므로 결과 참조는 ScopedVariant가 해제
+    ScopedVariant result(GetProperty(L"Parent"));
+    if (result.vt() == VT_DISPATCH && result.get().pdispVal) {
+        return std::make_unique<HwpCtrl>(result.get().pdispVal, m_pHwp);
     }
     return nullptr;
 }
 
 std::unique_ptr<HwpCtrl> HwpCtrl::FirstChild() const
 {
-    VARIANT result = GetProperty(L"FirstChild");
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        return std::make_unique<HwpCtrl>(result.pdispVal, m_pHwp);
+    // HwpCtrl이 AddRef 하므로 결과 참조는 ScopedVariant가 해제
+    ScopedVariant result(GetProperty(L"FirstChild"));
+    if (result.vt() == VT_DISPATCH && result.get().pdispVal) {
+        return std::make_unique<HwpCtrl>(result.get().pdispVal, m_pHwp);
     }
     return nullptr;
 }
@@ -163,11 +161,8 @@ std::unique_ptr<HwpCtrl> HwpCtrl::FirstChild() const
 
 IDispatch* HwpCtrl::GetProperties() const
 {
-    VARIANT result = GetProperty(L"Properties");
-    if (result.vt == VT_DISPATCH) {
-        return result.pdispVal;
-    }
-    return nullptr;
+    ScopedVariant result(GetProperty(L"Properties"));
+    return result.DetachDispatch();
 }
 
 bool HwpCtrl::SetProperties(IDispatch* pset)
@@ -184,34 +179,20 @@ bool HwpCtrl::SetProperties(IDispatch* pset)
 
 std::wstring HwpCtrl::GetUserData() const
 {
-    VARIANT result = GetProperty(L"UserData");
-    if (result.vt == VT_BSTR && result.bstrVal) {
-        std::wstring data(result.bstrVal);
-        SysFreeString(result.bstrVal);
-        return data;
-    }
-    return L"";
+    ScopedVariant result(GetProperty(L"UserData"));
+    return result.ToString();
 }
 
 bool HwpCtrl::SetUserData(const std::wstring& data)
 {
-    VARIANT val;
-    VariantInit(&val);
-    val.vt = VT_BSTR;
-    val.bstrVal = SysAllocString(data.c_str());
-
-    bool success = SetProperty(L"UserData", val);
-    SysFreeString(val.bstrVal);
-    return success;
+    ScopedBstr bstr(data);
+    return SetProperty(L"UserData", BstrArg(bstr.get()));
 }
 
 int HwpCtrl::GetInstID() const
 {
-    VARIANT result = GetProperty(L"InstID");
-    if (result.vt == VT_I4) {
-        return result.lVal;
-    }
-    return 0;
+    ScopedVariant result(GetProperty(L"InstID"));
+    return result.vt() == VT_I4 ? result.ToInt() : 0;
 }
 
 //=============================================================================
@@ -232,23 +213,23 @@ int HwpCtrl::GetRowCount() const
 
     // Properties에서 RowCount 가져오기
     DISPID dispid;
-    OLECHAR* name = const_cast<OLECHAR*>(L"RowCount");
-    HRESULT hr = props->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    static const BSTR s_rowCount = InternBstr(L"RowCount");
+    OLECHAR* name = s_rowCount;
+    HRESULT hr = ComGetIDsOfNames(props, &name, 1, &dispid);
     if (FAILED(hr)) {
         props->Release();
         return 0;
     }
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = props->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                       &params, &result, NULL, NULL);
+    hr = ComInvoke(props, dispid, DISPATCH_PROPERTYGET,
+                   &params, result.Receive(), NULL, NULL);
     props->Release();
 
-    if (SUCCEEDED(hr) && result.vt == VT_I4) {
-        return result.lVal;
+    if (SUCCEEDED(hr) && result.vt() == VT_I4) {
+        return result.ToInt();
     }
     return 0;
 }
@@ -261,23 +242,23 @@ int HwpCtrl::GetColCount() const
     if (!props) return 0;
 
     DISPID dispid;
-    OLECHAR* name = const_cast<OLECHAR*>(L"ColCount");
-    HRESULT hr = props->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    static const BSTR s_colCount = InternBstr(L"ColCount");
+    OLECHAR* name = s_colCount;
+    HRESULT hr = ComGetIDsOfNames(props, &name, 1, &dispid);
     if (FAILED(hr)) {
         props->Release();
         return 0;
     }
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = props->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                       &params, &result, NULL, NULL);
+    hr = ComInvoke(props, dispid, DISPATCH_PROPERTYGET,
+                   &params, result.Receive(), NULL, NULL);
     props->Release();
 
-    if (SUCCEEDED(hr) && result.vt == VT_I4) {
-        return result.lVal;
+    if (SUCCEEDED(hr) && result.vt() == VT_I4) {
+        return result.ToInt();
     }
     return 0;
 }
@@ -296,7 +277,7 @@ std::unique_ptr<HwpCtrl> HwpCtrl::GetCell(int row, int col) const
     args[1].vt = VT_I4;
     args[1].lVal = row;
 
-    VARIANT result = InvokeMethod(L"GetCellAddr", { args[1], args[0] });
+    ScopedVariant result(InvokeMethod(L"GetCellAddr", { args[1], args[0] }));
     // TODO: 셀 컨트롤 반환 구현
 
     return nullptr;
@@ -356,37 +337,37 @@ std::tuple<HwpUnit, HwpUnit> HwpCtrl::GetPosition() const
 
     // X 좌표
     DISPID dispidX;
-    OLECHAR* nameX = const_cast<OLECHAR*>(L"XPos");
-    HRESULT hr = props->GetIDsOfNames(IID_NULL, &nameX, 1, LOCALE_USER_DEFAULT, &dispidX);
+    static const BSTR s_xPos = InternBstr(L"XPos");
+    OLECHAR* nameX = s_xPos;
+    HRESULT hr = ComGetIDsOfNames(props, &nameX, 1, &dispidX);
 
     HwpUnit x = 0, y = 0;
 
     if (SUCCEEDED(hr)) {
         DISPPARAMS params = { NULL, NULL, 0, 0 };
-        VARIANT result;
-        VariantInit(&result);
+        ScopedVariant result;
 
-        hr = props->Invoke(dispidX, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                           &params, &result, NULL, NULL);
-        if (SUCCEEDED(hr) && result.vt == VT_I4) {
-            x = result.lVal;
+        hr = ComInvoke(props, dispidX, DISPATCH_PROPERTYGET,
+                       &params, result.Receive(), NULL, NULL);
+        if (SUCCEEDED(hr) && result.vt() == VT_I4) {
+            x = result.ToInt();
         }
     }
 
     // Y 좌표
     DISPID dispidY;
-    OLECHAR* nameY = const_cast<OLECHAR*>(L"YPos");
-    hr = props->GetIDsOfNames(IID_NULL, &nameY, 1, LOCALE_USER_DEFAULT, &dispidY);
+    static const BSTR s_yPos = InternBstr(L"YPos");
+    OLECHAR* nameY = s_yPos;
+    hr = ComGetIDsOfNames(props, &nameY, 1, &dispidY);
 
     if (SUCCEEDED(hr)) {
         DISPPARAMS params = { NULL, NULL, 0, 0 };
-        VARIANT result;
-        VariantInit(&result);
+        ScopedVariant result;
 
-        hr = props->Invoke(dispidY, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                           &params, &result, NULL, NULL);
-        if (SUCCEEDED(hr) && result.vt == VT_I4) {
-            y = result.lVal;
+        hr = ComInvoke(props, dispidY, DISPATCH_PROPERTYGET,
+                       &params, result.Receive(), NULL, NULL);
+        if (SUCCEEDED(hr) && result.vt() == VT_I4) {
+            y = result.ToInt();
         }
     }
 
@@ -403,35 +384,35 @@ std::tuple<HwpUnit, HwpUnit> HwpCtrl::GetSize() const
 
     // Width
     DISPID dispidW;
-    OLECHAR* nameW = const_cast<OLECHAR*>(L"Width");
-    HRESULT hr = props->GetIDsOfNames(IID_NULL, &nameW, 1, LOCALE_USER_DEFAULT, &dispidW);
+    static const BSTR s_width = InternBstr(L"Width");
+    OLECHAR* nameW = s_width;
+    HRESULT hr = ComGetIDsOfNames(props, &nameW, 1, &dispidW);
 
     if (SUCCEEDED(hr)) {
         DISPPARAMS params = { NULL, NULL, 0, 0 };
-        VARIANT result;
-        VariantInit(&result);
+        ScopedVariant result;
 
-        hr = props->Invoke(dispidW, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                           &params, &result, NULL, NULL);
-        if (SUCCEEDED(hr) && result.vt == VT_I4) {
-            width = result.lVal;
+        hr = ComInvoke(props, dispidW, DISPATCH_PROPERTYGET,
+                       &params, result.Receive(), NULL, NULL);
+        if (SUCCEEDED(hr) && result.vt() == VT_I4) {
+            width = result.ToInt();
         }
     }
 
     // Height
     DISPID dispidH;
-    OLECHAR* nameH = const_cast<OLECHAR*>(L"Height");
-    hr = props->GetIDsOfNames(IID_NULL, &nameH, 1, LOCALE_USER_DEFAULT, &dispidH);
+    static const BSTR s_height = InternBstr(L"Height");
+    OLECHAR* nameH = s_height;
+    hr = ComGetIDsOfNames(props, &nameH, 1, &dispidH);
 
     if (SUCCEEDED(hr)) {
         DISPPARAMS params = { NULL, NULL, 0, 0 };
-        VARIANT result;
-        VariantInit(&result);
+        ScopedVariant result;
 
-        hr = props->Invoke(dispidH, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                           &params, &result, NULL, NULL);
-        if (SUCCEEDED(hr) && result.vt == VT_I4) {
-            height = result.lVal;
+        hr = ComInvoke(props, dispidH, DISPATCH_PROPERTYGET,
+                       &params, result.Receive(), NULL, NULL);
+        if (SUCCEEDED(hr) && result.vt() == VT_I4) {
+            height = result.ToInt();
         }
     }
 
@@ -448,8 +429,9 @@ bool HwpCtrl::SetSize(HwpUnit width, HwpUnit height)
 
     // Width 설정
     DISPID dispidW;
-    OLECHAR* nameW = const_cast<OLECHAR*>(L"Width");
-    HRESULT hr = props->GetIDsOfNames(IID_NULL, &nameW, 1, LOCALE_USER_DEFAULT, &dispidW);
+    static const BSTR s_width = InternBstr(L"Width");
+    OLECHAR* nameW = s_width;
+    HRESULT hr = ComGetIDsOfNames(props, &nameW, 1, &dispidW);
 
     if (SUCCEEDED(hr)) {
         VARIANT val;
@@ -460,15 +442,16 @@ bool HwpCtrl::SetSize(HwpUnit width, HwpUnit height)
         DISPID putid = DISPID_PROPERTYPUT;
         DISPPARAMS params = { &val, &putid, 1, 1 };
 
-        hr = props->Invoke(dispidW, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                           &params, NULL, NULL, NULL);
+        hr = ComInvoke(props, dispidW, DISPATCH_PROPERTYPUT,
+                       &params, NULL, NULL, NULL);
         if (FAILED(hr)) success = false;
     }
 
     // Height 설정
     DISPID dispidH;
-    OLECHAR* nameH = const_cast<OLECHAR*>(L"Height");
-    hr = props->GetIDsOfNames(IID_NULL, &nameH, 1, LOCALE_USER_DEFAULT, &dispidH);
+    static const BSTR s_height = InternBstr(L"Height");
+    OLECHAR* nameH = s_height;
+    hr = ComGetIDsOfNames(props, &nameH, 1, &dispidH);
 
     if (SUCCEEDED(hr)) {
         VARIANT val;
@@ -479,12 +462,13 @@ bool HwpCtrl::SetSize(HwpUnit width, HwpUnit height)
         DISPID putid = DISPID_PROPERTYPUT;
         DISPPARAMS params = { &val, &putid, 1, 1 };
 
-        hr = props->Invoke(dispidH, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                           &params, NULL, NULL, NULL);
+        hr = ComInvoke(props, dispidH, DISPATCH_PROPERTYPUT,
+                       &params, NULL, NULL, NULL);
         if (FAILED(hr)) success = false;
     }
 
     props->Release();
+    if (m_pHwp) m_pHwp->NoteEdit(EditKind::Layout);
     return success;
 }
 
@@ -514,9 +498,8 @@ bool HwpCtrl::Delete()
 {
     if (!m_pHwp || !m_pCtrl) return false;
 
-    // 컨트롤 삭제
-    // TODO: 구현
-    return false;
+    // 컨트롤 삭제 (편집 기록은 DeleteCtrl에서)
+    return m_pHwp->DeleteCtrl(m_pCtrl);
 }
 
 bool HwpCtrl::Copy()
@@ -541,12 +524,12 @@ VARIANT HwpCtrl::GetProperty(const std::wstring& name) const
 
     DISPID dispid;
     OLECHAR* propName = const_cast<OLECHAR*>(name.c_str());
-    HRESULT hr = m_pCtrl->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pCtrl, &propName, 1, &dispid);
     if (FAILED(hr)) return result;
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    m_pCtrl->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                    &params, &result, NULL, NULL);
+    ComInvoke(m_pCtrl, dispid, DISPATCH_PROPERTYGET,
+              &params, &result, NULL, NULL);
 
     return result;
 }
@@ -557,15 +540,17 @@ bool HwpCtrl::SetProperty(const std::wstring& name, const VARIANT& value)
 
     DISPID dispid;
     OLECHAR* propName = const_cast<OLECHAR*>(name.c_str());
-    HRESULT hr = m_pCtrl->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pCtrl, &propName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     DISPID putid = DISPID_PROPERTYPUT;
     DISPPARAMS params = { const_cast<VARIANT*>(&value), &putid, 1, 1 };
 
-    hr = m_pCtrl->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                         &params, NULL, NULL, NULL);
+    hr = ComInvoke(m_pCtrl, dispid, DISPATCH_PROPERTYPUT,
+                   &params, NULL, NULL, NULL);
 
+    // 컨트롤 속성/UserData는 본문 내용으로 취급
+    if (m_pHwp) m_pHwp->NoteEdit(EditKind::Content);
     return SUCCEEDED(hr);
 }
 
@@ -579,7 +564,7 @@ VARIANT HwpCtrl::InvokeMethod(const std::wstring& name,
 
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(name.c_str());
-    HRESULT hr = m_pCtrl->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pCtrl, &methodName, 1, &dispid);
     if (FAILED(hr)) return result;
 
     std::vector<VARIANT> reversedArgs(args.rbegin(), args.rend());
@@ -591,8 +576,8 @@ VARIANT HwpCtrl::InvokeMethod(const std::wstring& name,
         0
     };
 
-    m_pCtrl->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                    &params, &result, NULL, NULL);
+    ComInvoke(m_pCtrl, dispid, DISPATCH_METHOD,
+              &params, &result, NULL, NULL);
 
     return result;
 }
@@ -9,8 +9,7 @@
 #pragma once
 
 #include "HwpTypes.h"
-#include <Windows.h>
-#include <comdef.h>
+#include "ComPlatform.h"
 #include <memory>
 #include <string>
 
@@ -0,0 +1,351 @@
+/**
+ * @file HwpInstancePool.cpp
+ * @brief HwpInstancePool 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "HwpInstancePool.h"
+#include "HwpWrapper.h"
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cpyhwpx {
+
+//=============================================================================
+// 공유 상태
+//=============================================================================
+
+struct HwpInstancePool::Instance {
+    std::unique_ptr<AsyncHwp> hwp;
+    size_t jobs = 0;
+    std::shared_ptr<std::atomic<size_t>> memory = std::make_shared<std::atomic<size_t>>(0);
+};
+
+/**
+ * @brief 풀과 Lease가 함께 보는 상태 (Lease가 풀보다 오래 살아도 안전)
+ */
+struct HwpInstancePool::Shared {
+    HwpInstancePoolConfig config;
+    Factory factory;
+
+    mutable std::mutex mutex;
+    std::deque<std::unique_ptr<Instance>> idle;
+    std::vector<std::future<void>> retiring;
+    size_t leased = 0;
+    uint64_t warmHits = 0;
+    uint64_t coldStarts = 0;
+    uint64_t recycled = 0;
+    bool shutdown = false;
+
+    std::unique_ptr<Instance> Create()
+    {
+        auto instance = std::make_unique<Instance>();
+        instance->hwp = factory ? factory()
+                                : std::make_unique<AsyncHwp>(config.visible, true, config.register_module);
+        if (!instance->hwp) return nullptr;
+        return instance;
+    }
+
+    /**
+     * @brief 채워 둘 대기 인스턴스 수
+     *
+     * 빌려 간 인스턴스도 돌아와 대기 인스턴스가 되므로 warm_count에서 빼되,
+     * 동시 요청에 대비해 하나는 항상 남긴다 (반환마다 새로 띄우고 버리는 일을 막음).
+     */
+    size_t IdleTarget() const
+    {
+        if (config.warm_count == 0) return 0;
+        return config.warm_count > leased ? config.warm_count - leased : 1;
+    }
+
+    /**
+     * @brief 대기 인스턴스 채우기 (잠금 안에서, 초기화는 각 실행 스레드에서)
+     */
+    void Refill()
+    {
+        while (!shutdown && idle.size() < IdleTarget()) {
+            std::unique_ptr<Instance> instance = Create();
+            if (!instance) break;
+            idle.push_back(std::move(instance));
+        }
+    }
+
+    /**
+     * @brief 백그라운드에서 한/글 종료 후 실행 스레드 정리 (잠금 밖에서)
+     *
+     * std::async의 future는 소멸자에서 끝날 때까지 기다리므로 분리한 스레드와
+     * promise를 쓴다. 멈춘 인스턴스도 Shutdown()을 무기한 막지 않는다.
+     */
+    void Retire(std::vector<std::unique_ptr<Instance>> instances)
+    {
+        for (std::unique_ptr<Instance>& instance : instances) {
+            auto done = std::make_shared<std::promise<void>>();
+            std::future<void> finished = done->get_future();
+            std::thread([instance = std::move(instance), done]() mutable {
+                instance->hwp->Post([](HwpWrapper& hwp) { hwp.Quit(false); });
+                instance.reset();   // 남은 작업을 실행한 뒤 실행 스레드 종료
+                done->set_value();
+            }).detach();
+
+            std::lock_guard<std::mutex> lock(mutex);
+            recycled++;
+            retiring.push_back(std::move(finished));
+        }
+    }
+
+    /**
+     * @brief 끝난 종료 작업 정리 (잠금 안에서)
+     */
+    void PruneRetiring()
+    {
+        for (size_t i = 0; i < retiring.size();) {
+            if (retiring[i].wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                retiring[i] = std::move(retiring.back());
+                retiring.pop_back();
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    bool OverMemory(const Instance& instance) const
+    {
+        return config.max_memory_bytes > 0 && instance.memory->load() > config.max_memory_bytes;
+    }
+
+    void Return(std::unique_ptr<Instance> instance, bool discard)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        leased--;
+        instance->jobs++;
+        PruneRetiring();
+
+        bool recycle = discard || shutdown ||
+                       !instance->hwp->IsRunning() || !instance->hwp->IsHealthy() ||
+                       (config.max_jobs > 0 && instance->jobs >= config.max_jobs) ||
+                       idle.size() >= config.warm_count;
+        if (recycle) {
+            Refill();
+            lock.unlock();
+            std::vector<std::unique_ptr<Instance>> retired;
+            retired.push_back(std::move(instance));
+            Retire(std::move(retired));
+            return;
+        }
+
+        // 종료 대신 문서만 비움 (메모리는 다음 Acquire에서 확인)
+        size_t limit = config.max_memory_bytes;
+        instance->hwp->Post([memory = instance->memory, limit](HwpWrapper& hwp) {
+            hwp.ClearDocument(1);
+            if (limit > 0) {
+                memory->store(hwp.GetProcessMemory());
+            }
+        });
+        idle.push_back(std::move(instance));
+    }
+};
+
+//=============================================================================
+// Lease
+//=============================================================================
+
+HwpInstancePool::Lease::Lease() = default;
+
+HwpInstancePool::Lease::Lease(Lease&& other) noexcept = default;
+
+HwpInstancePool::Lease::~Lease()
+{
+    Release();
+}
+
+HwpInstancePool::Lease& HwpInstancePool::Lease::operator=(Lease&& other) noexcept
+{
+    if (this != &other) {
+        Release();
+        m_instance = std::move(other.m_instance);
+        m_pool = std::move(other.m_pool);
+        m_discard = other.m_discard;
+        other.m_discard = false;
+    }
+    return *this;
+}
+
+AsyncHwp* HwpInstancePool::Lease::get() const
+{
+    return m_instance ? m_instance->hwp.get() : nullptr;
+}
+
+size_t HwpInstancePool::Lease::GetJobCount() const
+{
+    return m_instance ? m_instance->jobs : 0;
+}
+
+void HwpInstancePool::Lease::Release()
+{
+    if (!m_instance) return;
+
+    if (std::shared_ptr<Shared> pool = m_pool.lock()) {
+        pool->Return(std::move(m_instance), m_discard);
+    } else {
+        // 풀이 먼저 사라짐: 직접 종료
+        m_instance->hwp->Post([](HwpWrapper& hwp) { hwp.Quit(false); });
+        m_instance.reset();
+    }
+    m_pool.reset();
+    m_discard = false;
+}
+
+//=============================================================================
+// 생성자/소멸자
+//=============================================================================
+
+HwpInstancePool::HwpInstancePool(const HwpInstancePoolConfig& config, Factory factory)
+    : m_shared(std::make_shared<Shared>())
+{
+    m_shared->config = config;
+    m_shared->factory = std::move(factory);
+
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    m_shared->Refill();
+}
+
+HwpInstancePool::~HwpInstancePool()
+{
+    Shutdown();
+}
+
+//=============================================================================
+// 빌리기/종료
+//=============================================================================
+
+HwpInstancePool::Lease HwpInstancePool::Acquire()
+{
+    // 대기 인스턴스가 모두 초기화에 실패하는 경우 무한히 다시 띄우지 않도록 제한
+    size_t attempts = m_shared->config.warm_count + 1;
+
+    for (size_t attempt = 0; attempt < attempts; ++attempt) {
+        std::unique_ptr<Instance> instance;
+        std::vector<std::unique_ptr<Instance>> retired;
+        bool cold = false;
+        {
+            std::lock_guard<std::mutex> lock(m_shared->mutex);
+            if (m_shared->shutdown) return Lease();
+            m_shared->PruneRetiring();
+
+            while (!m_shared->idle.empty() && !instance) {
+                std::unique_ptr<Instance> candidate = std::move(m_shared->idle.front());
+                m_shared->idle.pop_front();
+                if (m_shared->OverMemory(*candidate)) {
+                    retired.push_back(std::move(candidate));
+                } else {
+                    instance = std::move(candidate);
+                }
+            }
+            if (!instance) {
+                instance = m_shared->Create();
+                if (instance) {
+                    m_shared->coldStarts++;
+                    cold = true;
+                }
+            }
+            if (instance) {
+                m_shared->leased++;
+                m_shared->Refill();
+            }
+        }
+        m_shared->Retire(std::move(retired));
+        if (!instance) return Lease();
+
+        // 초기화가 끝나지 않았으면 잠금 밖에서 기다림
+        std::shared_future<bool> ready = instance->hwp->Ready();
+        bool warm = ready.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        if (ready.get()) {
+            Lease lease;
+            lease.m_instance = std::move(instance);
+            lease.m_pool = m_shared;
+            if (warm && !cold) {
+                std::lock_guard<std::mutex> lock(m_shared->mutex);
+                m_shared->warmHits++;
+            }
+            return lease;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_shared->mutex);
+            m_shared->leased--;
+        }
+        std::vector<std::unique_ptr<Instance>> failed;
+        failed.push_back(std::move(instance));
+        m_shared->Retire(std::move(failed));
+        if (cold) return Lease();
+    }
+    return Lease();
+}
+
+void HwpInstancePool::Shutdown()
+{
+    std::vector<std::unique_ptr<Instance>> idle;
+    {
+        std::lock_guard<std::mutex> lock(m_shared->mutex);
+        m_shared->shutdown = true;
+        while (!m_shared->idle.empty()) {
+            idle.push_back(std::move(m_shared->idle.front()));
+            m_shared->idle.pop_front();
+        }
+    }
+    m_shared->Retire(std::move(idle));
+
+    std::vector<std::future<void>> retiring;
+    {
+        std::lock_guard<std::mutex> lock(m_shared->mutex);
+        retiring.swap(m_shared->retiring);
+    }
+
+    // 멈춘 인스턴스는 기다리지 않음 (분리된 종료 스레드가 계속 처리)
+    auto deadline = std::chrono::steady_clock::now() + m_shared->config.shutdown_timeout;
+    for (std::future<void>& done : retiring) {
+        done.wait_until(deadline);
+    }
+}
+
+//=============================================================================
+// 통계
+//=============================================================================
+
+size_t HwpInstancePool::GetIdleCount() const
+{
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    return m_shared->idle.size();
+}
+
+size_t HwpInstancePool::GetLeasedCount() const
+{
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    return m_shared->leased;
+}
+
+uint64_t HwpInstancePool::GetWarmHitCount() const
+{
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    return m_shared->warmHits;
+}
+
+uint64_t HwpInstancePool::GetColdStartCount() const
+{
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    return m_shared->coldStarts;
+}
+
+uint64_t HwpInstancePool::GetRecycleCount() const
+{
+    std::lock_guard<std::mutex> lock(m_shared->mutex);
+    return m_shared->recycled;
+}
+
+} // namespace cpyhwpx
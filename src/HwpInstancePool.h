@@ -0,0 +1,145 @@
+/**
+ * @file HwpInstancePool.h
+ * @brief 미리 초기화해 둔 한/글 인스턴스 풀 (콜드 스타트 제거)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * Initialize()는 COM 초기화, HwpObject 생성, 편집 모드/창 설정, 보안 모듈 등록을
+ * 동기로 하므로 한/글을 새로 띄우는 요청마다 수 초가 걸린다.
+ * HwpInstancePool은 숨겨진 인스턴스 K개를 AsyncHwp 실행 스레드 위에 미리 띄워 두고
+ * 요청마다 하나씩 빌려 준다.
+ */
+
+#pragma once
+
+#include "AsyncHwp.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace cpyhwpx {
+
+/**
+ * @brief 인스턴스 풀 설정
+ */
+struct HwpInstancePoolConfig {
+    size_t warm_count = 2;          // 대기 인스턴스 수 (0이면 빌릴 때마다 새로 띄움)
+    size_t max_jobs = 100;          // 이만큼 빌려 쓴 인스턴스는 종료 후 교체 (0=무제한)
+    size_t max_memory_bytes = 0;    // 반환 후 한/글 프로세스 메모리가 넘으면 교체 (0=검사 안 함)
+    bool visible = false;           // 창 표시 여부
+    bool register_module = true;    // 보안 모듈 자동 등록 여부
+    std::chrono::milliseconds shutdown_timeout{10000};  // Shutdown()이 종료 중인 인스턴스를 기다리는 시간
+};
+
+/**
+ * @class HwpInstancePool
+ * @brief 대기 중인 AsyncHwp 인스턴스 풀
+ *
+ * - 대기 인스턴스는 AsyncHwp 생성자에서 바로 반환되고 초기화는 각 실행 스레드에서
+ *   진행되므로, 빈자리 채우기는 호출자를 막지 않는다
+ * - 대기 + 대여 인스턴스가 warm_count개가 되도록 채우되, 대기 인스턴스는 최소 1개 유지
+ * - 반환된 인스턴스는 종료하지 않고 ClearDocument(1)로 비워서 다시 쓴다
+ * - max_jobs/max_memory_bytes를 넘거나 Discard()한 인스턴스는 백그라운드에서 Quit
+ *   (풀 잠금 밖에서, 멈춘 인스턴스가 Acquire()/반환을 막지 않음)
+ * - 어느 스레드에서나 Acquire()할 수 있다
+ */
+class HwpInstancePool {
+public:
+    /**
+     * @brief 인스턴스 생성 함수 (기본: 설정대로 새 한/글 인스턴스)
+     *
+     * 가짜 HwpObject를 Attach()하는 테스트/벤치마크용.
+     */
+    using Factory = std::function<std::unique_ptr<AsyncHwp>()>;
+
+    struct Shared;
+    struct Instance;
+
+    /**
+     * @class Lease
+     * @brief 빌린 인스턴스 (소멸 시 풀에 반환)
+     */
+    class Lease {
+    public:
+        Lease();
+        ~Lease();
+
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        /**
+         * @brief 빌린 인스턴스 (비어 있으면 nullptr)
+         */
+        AsyncHwp* get() const;
+        AsyncHwp* operator->() const { return get(); }
+        AsyncHwp& operator*() const { return *get(); }
+        explicit operator bool() const { return get() != nullptr; }
+
+        /**
+         * @brief 지금까지 이 인스턴스가 처리한 대여 수 (이번 대여 제외)
+         */
+        size_t GetJobCount() const;
+
+        /**
+         * @brief 풀에 반환 (이후 비어 있음)
+         */
+        void Release();
+
+        /**
+         * @brief 다시 쓰지 않고 종료하도록 표시 (작업이 실패했거나 멈춘 경우)
+         */
+        void Discard() { m_discard = true; }
+
+    private:
+        friend class HwpInstancePool;
+
+        std::unique_ptr<Instance> m_instance;
+        std::weak_ptr<Shared> m_pool;
+        bool m_discard = false;
+    };
+
+    explicit HwpInstancePool(const HwpInstancePoolConfig& config = HwpInstancePoolConfig(),
+                             Factory factory = Factory());
+
+    /**
+     * @brief Shutdown()
+     */
+    ~HwpInstancePool();
+
+    HwpInstancePool(const HwpInstancePool&) = delete;
+    HwpInstancePool& operator=(const HwpInstancePool&) = delete;
+
+    /**
+     * @brief 인스턴스 빌리기 (대기 인스턴스가 초기화 중이면 끝날 때까지 기다림)
+     * @return 초기화에 실패했거나 종료된 풀이면 빈 Lease
+     */
+    Lease Acquire();
+
+    /**
+     * @brief 대기 인스턴스 종료, 교체 중인 인스턴스 종료 대기
+     *
+     * 종료 대기는 shutdown_timeout까지만 하고, 그때까지 끝나지 않은(멈춘) 인스턴스는
+     * 백그라운드 스레드에 맡긴 채 반환한다.
+     * 아직 반환되지 않은 인스턴스는 반환될 때 종료된다.
+     */
+    void Shutdown();
+
+    //=========================================================================
+    // 통계
+    //=========================================================================
+
+    size_t GetIdleCount() const;
+    size_t GetLeasedCount() const;
+    uint64_t GetWarmHitCount() const;       // 초기화가 끝난 인스턴스를 바로 준 횟수
+    uint64_t GetColdStartCount() const;     // 대기 인스턴스가 없어 새로 띄운 횟수
+    uint64_t GetRecycleCount() const;       // 교체를 위해 종료한 인스턴스 수
+
+private:
+    std::shared_ptr<Shared> m_shared;
+};
+
+} // namespace cpyhwpx
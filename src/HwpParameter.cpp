@@ -7,6 +7,10 @@
 
 #include "HwpParameter.h"
 #include "HwpWrapper.h"
+#include "ComScope.h"
+#include "ComStats.h"
+#include "ActionRecorder.h"
+#include <unordered_set>
 
 namespace cpyhwpx {
 
@@ -14,20 +18,114 @@ namespace cpyhwpx {
 // HwpParameterSet 구현
 //=============================================================================
 
-HwpParameterSet::HwpParameterSet(IDispatch* pset)
+namespace {
+
+// 세트 ID별 Item DISPID (같은 종류의 HParameterSet은 DISPID가 같음)
+thread_local std::unordered_map<std::wstring, DISPID> t_itemDispids;
+
+/**
+ * @brief InternBstr로 재사용할 항목 이름 (CharShape/ParaShape/찾기/표 등 고정 이름)
+ *
+ * 호출자가 넘긴 임의 이름까지 InternBstr에 넣으면 프로세스 수명 동안 쌓이므로
+ * 이 표에 없는 이름은 호출마다 ScopedBstr로 할당한다.
+ */
+bool IsKnownItemName(const std::wstring& name)
+{
+    static const std::unordered_set<std::wstring> s_names = {
+        // CharShape
+        L"FaceNameHangul", L"FaceNameLatin", L"FaceNameHanja", L"FaceNameJapanese",
+        L"FaceNameOther", L"FaceNameSymbol", L"FaceNameUser",
+        L"FontTypeHangul", L"FontTypeLatin", L"FontTypeHanja", L"FontTypeJapanese",
+        L"FontTypeOther", L"FontTypeSymbol", L"FontTypeUser",
+        L"SizeHangul", L"SizeLatin", L"SizeHanja", L"SizeJapanese",
+        L"SizeOther", L"SizeSymbol", L"SizeUser",
+        L"RatioHangul", L"RatioLatin", L"RatioHanja", L"RatioJapanese",
+        L"RatioOther", L"RatioSymbol", L"RatioUser",
+        L"SpacingHangul", L"SpacingLatin", L"SpacingHanja", L"SpacingJapanese",
+        L"SpacingOther", L"SpacingSymbol", L"SpacingUser",
+        L"OffsetHangul", L"OffsetLatin", L"OffsetHanja", L"OffsetJapanese",
+        L"OffsetOther", L"OffsetSymbol", L"OffsetUser",
+        L"Height", L"Bold", L"Italic", L"SmallCaps", L"Emboss", L"Engrave",
+        L"SuperScript", L"SubScript", L"UnderlineType", L"UnderlineShape", L"UnderlineColor",
+        L"StrikeOutType", L"StrikeOutShape", L"StrikeOutColor", L"OutlineType",
+        L"ShadowType", L"ShadowColor", L"ShadowOffsetX", L"ShadowOffsetY",
+        L"TextColor", L"ShadeColor", L"UseFontSpace", L"UseKerning", L"DiacSymMark",
+        // ParaShape
+        L"AlignType", L"LeftMargin", L"RightMargin", L"Indentation", L"PrevSpacing",
+        L"NextSpacing", L"LineSpacingType", L"LineSpacing", L"BreakLatinWord",
+        L"BreakNonLatinWord", L"SnapToGrid", L"Condense", L"WidowOrphan", L"KeepWithNext",
+        L"KeepLinesTogether", L"PagebreakBefore", L"TextAlignment", L"FontLineHeight",
+        L"HeadingType", L"Level", L"LineWrap", L"AutoSpaceEAsianEng", L"AutoSpaceEAsianNum",
+        // 찾기/바꾸기
+        L"FindString", L"ReplaceString", L"MatchCase", L"WholeWord", L"UseRegexp",
+        L"Direction", L"IgnoreMessage", L"FindType", L"ReplaceMode",
+        // 표/셀/그림
+        L"Rows", L"Cols", L"RowHeight", L"Width", L"Align", L"VAlign", L"BackColor",
+        L"Color", L"Style", L"SizeOption", L"Embedded", L"Path",
+        // 파일/문서
+        L"FileName", L"Format", L"Attributes", L"Encrypted", L"VersionNum", L"VersionStr",
+        L"Text",
+    };
+    return s_names.count(name) > 0;
+}
+
+} // namespace
+
+HwpParameterSet::HwpParameterSet(IDispatch* pset, const std::wstring& set_id)
     : m_pSet(pset)
+    , m_setId(set_id)
+    , m_itemId(DISPID_UNKNOWN)
 {
     if (m_pSet) {
         m_pSet->AddRef();
     }
 }
 
+HwpParameterSet::HwpParameterSet(IDispatch* pset, std::weak_ptr<ParameterSetPool> pool,
+                                 const std::wstring& set_id)
+    : m_pSet(pset)
+    , m_setId(set_id)
+    , m_itemId(DISPID_UNKNOWN)
+    , m_pool(std::move(pool))
+{
+}
+
 HwpParameterSet::~HwpParameterSet()
 {
-    if (m_pSet) {
-        m_pSet->Release();
+    if (!m_pSet) return;
+
+    if (std::shared_ptr<ParameterSetPool> pool = m_pool.lock()) {
+        pool->Give(m_setId, m_pSet);
         m_pSet = nullptr;
+        return;
+    }
+    m_pSet->Release();
+    m_pSet = nullptr;
+}
+
+DISPID HwpParameterSet::ItemDispid()
+{
+    if (m_itemId != DISPID_UNKNOWN || !m_pSet) return m_itemId;
+
+    if (!m_setId.empty()) {
+        auto it = t_itemDispids.find(m_setId);
+        if (it != t_itemDispids.end()) {
+            m_itemId = it->second;
+            return m_itemId;
+        }
+    }
+
+    static const BSTR s_item = InternBstr(L"Item");
+    DISPID dispid;
+    OLECHAR* propName = s_item;
+    HRESULT hr = ComGetIDsOfNames(m_pSet, &propName, 1, &dispid);
+    if (FAILED(hr)) return DISPID_UNKNOWN;
+
+    m_itemId = dispid;
+    if (!m_setId.empty()) {
+        t_itemDispids[m_setId] = dispid;
     }
+    return m_itemId;
 }
 
 //=============================================================================
@@ -36,10 +134,7 @@ HwpParameterSet::~HwpParameterSet()
 
 bool HwpParameterSet::SetItem(const std::wstring& name, int value)
 {
-    VARIANT var;
-    VariantInit(&var);
-    var.vt = VT_I4;
-    var.lVal = value;
+    VARIANT var = IntArg(value);
     return SetItemInternal(name, var);
 }
 
@@ -54,14 +149,9 @@ bool HwpParameterSet::SetItem(const std::wstring& name, double value)
 
 bool HwpParameterSet::SetItem(const std::wstring& name, const std::wstring& value)
 {
-    VARIANT var;
-    VariantInit(&var);
-    var.vt = VT_BSTR;
-    var.bstrVal = SysAllocString(value.c_str());
-
-    bool result = SetItemInternal(name, var);
-    SysFreeString(var.bstrVal);
-    return result;
+    ScopedBstr bstr(value);
+    VARIANT var = BstrArg(bstr.get());
+    return SetItemInternal(name, var);
 }
 
 bool HwpParameterSet::SetItem(const std::wstring& name, bool value)
@@ -75,125 +165,148 @@ bool HwpParameterSet::SetItem(const std::wstring& name, bool value)
 
 bool HwpParameterSet::SetItem(const std::wstring& name, const VARIANT& value)
 {
-    VARIANT var;
-    VariantInit(&var);
-    VariantCopy(&var, const_cast<VARIANT*>(&value));
-
-    bool result = SetItemInternal(name, var);
-    VariantClear(&var);
-    return result;
+    // 호출자 VARIANT는 빌려서 전달 (Invoke는 인자를 변경하지 않음)
+    VARIANT var = value;
+    return SetItemInternal(name, var);
 }
 
 bool HwpParameterSet::SetItemInternal(const std::wstring& name, VARIANT& value)
 {
     if (!m_pSet) return false;
 
-    // Item 속성에 값 설정
-    DISPID dispid;
-    OLECHAR* propName = const_cast<OLECHAR*>(L"Item");
-    HRESULT hr = m_pSet->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return false;
+    ScopedBstr nameBstr(name);
+    return PutItem(name, nameBstr.get(), value);
+}
 
-    // 파라미터 이름
-    VARIANT nameVar;
-    VariantInit(&nameVar);
-    nameVar.vt = VT_BSTR;
-    nameVar.bstrVal = SysAllocString(name.c_str());
+bool HwpParameterSet::PutItem(const std::wstring& name, BSTR name_bstr, VARIANT& value)
+{
+    ActionRecorder::NotifySetItem(m_pSet, name, value);
+
+    // Item 속성에 값 설정
+    DISPID dispid = ItemDispid();
+    if (dispid == DISPID_UNKNOWN) return false;
 
     // 인자: [value, name] (역순)
-    VARIANT args[2] = { value, nameVar };
+    VARIANT args[2] = { value, BstrArg(name_bstr) };
 
     DISPID putid = DISPID_PROPERTYPUT;
     DISPPARAMS params = { args, &putid, 2, 1 };
 
-    hr = m_pSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                        &params, NULL, NULL, NULL);
-
-    SysFreeString(nameVar.bstrVal);
+    HRESULT hr = ComInvoke(m_pSet, dispid, DISPATCH_PROPERTYPUT,
+                           &params, NULL, NULL, NULL);
 
     return SUCCEEDED(hr);
 }
 
+bool HwpParameterSet::SetItems(const std::vector<std::pair<std::wstring, VARIANT>>& items)
+{
+    if (!m_pSet) return false;
+
+    bool ok = true;
+    for (const auto& item : items) {
+        VARIANT value = item.second;
+        bool put;
+        if (IsKnownItemName(item.first)) {
+            put = PutItem(item.first, InternBstr(item.first.c_str()), value);
+        } else {
+            ScopedBstr nameBstr(item.first);
+            put = PutItem(item.first, nameBstr.get(), value);
+        }
+        if (!put) ok = false;
+    }
+    return ok;
+}
+
 //=============================================================================
 // 파라미터 가져오기
 //=============================================================================
 
 int HwpParameterSet::GetItemInt(const std::wstring& name, int default_value)
 {
-    VARIANT result = GetItemInternal(name);
-    if (result.vt == VT_I4) {
-        return result.lVal;
-    }
-    if (result.vt == VT_I2) {
-        return result.iVal;
+    ScopedVariant result;
+    if (!GetItemInternal(name, result)) return default_value;
+    if (result.vt() == VT_I4 || result.vt() == VT_I2) {
+        return result.ToInt(default_value);
     }
-    VariantClear(&result);
     return default_value;
 }
 
 double HwpParameterSet::GetItemDouble(const std::wstring& name, double default_value)
 {
-    VARIANT result = GetItemInternal(name);
-    if (result.vt == VT_R8) {
-        return result.dblVal;
-    }
-    if (result.vt == VT_R4) {
-        return result.fltVal;
+    ScopedVariant result;
+    if (!GetItemInternal(name, result)) return default_value;
+    if (result.vt() == VT_R8 || result.vt() == VT_R4) {
+        return result.ToDouble(default_value);
     }
-    VariantClear(&result);
     return default_value;
 }
 
 std::wstring HwpParameterSet::GetItemString(const std::wstring& name, const std::wstring& default_value)
 {
-    VARIANT result = GetItemInternal(name);
-    if (result.vt == VT_BSTR && result.bstrVal) {
-        std::wstring str(result.bstrVal);
-        SysFreeString(result.bstrVal);
-        return str;
+    ScopedVariant result;
+    if (!GetItemInternal(name, result)) return default_value;
+    if (result.vt() == VT_BSTR && result.get().bstrVal) {
+        return result.ToString();
     }
-    VariantClear(&result);
     return default_value;
 }
 
 bool HwpParameterSet::GetItemBool(const std::wstring& name, bool default_value)
 {
-    VARIANT result = GetItemInternal(name);
-    if (result.vt == VT_BOOL) {
-        return result.boolVal != VARIANT_FALSE;
+    ScopedVariant result;
+    if (!GetItemInternal(name, result)) return default_value;
+    if (result.vt() == VT_BOOL) {
+        return result.ToBool(default_value);
     }
-    VariantClear(&result);
     return default_value;
 }
 
 VARIANT HwpParameterSet::GetItem(const std::wstring& name)
 {
-    return GetItemInternal(name);
+    ScopedVariant result;
+    GetItemInternal(name, result);
+    return result.Detach();
 }
 
-VARIANT HwpParameterSet::GetItemInternal(const std::wstring& name)
+bool HwpParameterSet::GetItemInternal(const std::wstring& name, ScopedVariant& result)
 {
-    VARIANT result;
-    VariantInit(&result);
+    if (!m_pSet) return false;
 
-    if (!m_pSet) return result;
+    ScopedBstr nameBstr(name);
+    return FetchItem(nameBstr.get(), result);
+}
 
-    DISPID dispid;
-    OLECHAR* propName = const_cast<OLECHAR*>(L"Item");
-    HRESULT hr = m_pSet->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return result;
+bool HwpParameterSet::FetchItem(BSTR name_bstr, ScopedVariant& result)
+{
+    DISPID dispid = ItemDispid();
+    if (dispid == DISPID_UNKNOWN) return false;
 
-    VARIANT nameVar;
-    VariantInit(&nameVar);
-    nameVar.vt = VT_BSTR;
-    nameVar.bstrVal = SysAllocString(name.c_str());
+    VARIANT nameVar = BstrArg(name_bstr);
 
     DISPPARAMS params = { &nameVar, NULL, 1, 0 };
-    m_pSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                   &params, &result, NULL, NULL);
+    HRESULT hr = ComInvoke(m_pSet, dispid, DISPATCH_PROPERTYGET,
+                           &params, result.Receive(), NULL, NULL);
+    return SUCCEEDED(hr);
+}
 
-    SysFreeString(nameVar.bstrVal);
-    return result;
+std::vector<VARIANT> HwpParameterSet::GetItems(const std::vector<std::wstring>& names)
+{
+    std::vector<VARIANT> values;
+    values.reserve(names.size());
+
+    for (const std::wstring& name : names) {
+        ScopedVariant result;
+        if (m_pSet) {
+            if (IsKnownItemName(name)) {
+                FetchItem(InternBstr(name.c_str()), result);
+            } else {
+                ScopedBstr nameBstr(name);
+                FetchItem(nameBstr.get(), result);
+            }
+        }
+        values.push_back(result.Detach());
+    }
+    return values;
 }
 
 //=============================================================================
@@ -204,72 +317,53 @@ IDispatch* HwpParameterSet::CreateItemSet(const std::wstring& item_id, const std
 {
     if (!m_pSet) return nullptr;
 
+    static const BSTR s_createItemSet = InternBstr(L"CreateItemSet");
     DISPID dispid;
-    OLECHAR* methodName = const_cast<OLECHAR*>(L"CreateItemSet");
-    HRESULT hr = m_pSet->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    OLECHAR* methodName = s_createItemSet;
+    HRESULT hr = ComGetIDsOfNames(m_pSet, &methodName, 1, &dispid);
     if (FAILED(hr)) return nullptr;
 
-    VARIANT args[2];
-    VariantInit(&args[0]);
-    VariantInit(&args[1]);
-
-    args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(set_id.c_str());
-    args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(item_id.c_str());
+    ScopedBstr itemBstr(item_id);
+    ScopedBstr setBstr(set_id);
+    VARIANT args[2] = { BstrArg(setBstr.get()), BstrArg(itemBstr.get()) };
 
     DISPPARAMS params = { args, NULL, 2, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pSet, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    SysFreeString(args[0].bstrVal);
-    SysFreeString(args[1].bstrVal);
-
-    if (SUCCEEDED(hr) && result.vt == VT_DISPATCH) {
-        return result.pdispVal;
-    }
-    return nullptr;
+    if (FAILED(hr)) return nullptr;
+    ActionRecorder::NotifySubSet(m_pSet);
+    return result.DetachDispatch();
 }
 
 IDispatch* HwpParameterSet::GetItemSet(const std::wstring& item_id)
 {
-    VARIANT result = GetItemInternal(item_id);
-    if (result.vt == VT_DISPATCH) {
-        return result.pdispVal;
-    }
-    VariantClear(&result);
-    return nullptr;
+    ScopedVariant result;
+    if (!GetItemInternal(item_id, result)) return nullptr;
+    // 서브셋에 쓴 항목은 이 세트의 항목으로 모이지 않음
+    ActionRecorder::NotifySubSet(m_pSet);
+    return result.DetachDispatch();
 }
 
 IDispatch* HwpParameterSet::GetItemByIndex(int index)
 {
     if (!m_pSet) return nullptr;
 
-    DISPID dispid;
-    OLECHAR* propName = const_cast<OLECHAR*>(L"Item");
-    HRESULT hr = m_pSet->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return nullptr;
+    DISPID dispid = ItemDispid();
+    if (dispid == DISPID_UNKNOWN) return nullptr;
 
-    VARIANT indexVar;
-    VariantInit(&indexVar);
-    indexVar.vt = VT_I4;
-    indexVar.lVal = index;
+    VARIANT indexVar = IntArg(index);
 
     DISPPARAMS params = { &indexVar, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                        &params, &result, NULL, NULL);
+    HRESULT hr = ComInvoke(m_pSet, dispid, DISPATCH_PROPERTYGET,
+                           &params, result.Receive(), NULL, NULL);
 
-    if (SUCCEEDED(hr) && result.vt == VT_DISPATCH) {
-        return result.pdispVal;
-    }
-    VariantClear(&result);
-    return nullptr;
+    if (FAILED(hr)) return nullptr;
+    return result.DetachDispatch();
 }
 
 //=============================================================================
@@ -280,60 +374,154 @@ std::wstring HwpParameterSet::GetSetID() const
 {
     if (!m_pSet) return L"";
 
+    static const BSTR s_setId = InternBstr(L"SetID");
     DISPID dispid;
-    OLECHAR* name = const_cast<OLECHAR*>(L"SetID");
-    HRESULT hr = m_pSet->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    OLECHAR* name = s_setId;
+    HRESULT hr = ComGetIDsOfNames(m_pSet, &name, 1, &dispid);
     if (FAILED(hr)) return L"";
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pSet, dispid, DISPATCH_PROPERTYGET,
+                   &params, result.Receive(), NULL, NULL);
 
-    if (SUCCEEDED(hr) && result.vt == VT_BSTR && result.bstrVal) {
-        std::wstring id(result.bstrVal);
-        SysFreeString(result.bstrVal);
-        return id;
-    }
-    return L"";
+    if (FAILED(hr)) return L"";
+    return result.ToString();
 }
 
 int HwpParameterSet::GetCount()
 {
     if (!m_pSet) return 0;
 
+    static const BSTR s_count = InternBstr(L"Count");
     DISPID dispid;
-    OLECHAR* name = const_cast<OLECHAR*>(L"Count");
-    HRESULT hr = m_pSet->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    OLECHAR* name = s_count;
+    HRESULT hr = ComGetIDsOfNames(m_pSet, &name, 1, &dispid);
     if (FAILED(hr)) return 0;
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pSet, dispid, DISPATCH_PROPERTYGET,
+                   &params, result.Receive(), NULL, NULL);
 
-    if (SUCCEEDED(hr) && result.vt == VT_I4) {
-        return result.lVal;
-    }
-    return 0;
+    if (FAILED(hr) || result.vt() != VT_I4) return 0;
+    return result.ToInt();
 }
 
 void HwpParameterSet::Clear()
 {
     if (!m_pSet) return;
 
+    ActionRecorder::NotifyResetSet(m_pSet);
+
+    static const BSTR s_clear = InternBstr(L"Clear");
     DISPID dispid;
-    OLECHAR* name = const_cast<OLECHAR*>(L"Clear");
-    HRESULT hr = m_pSet->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    OLECHAR* name = s_clear;
+    HRESULT hr = ComGetIDsOfNames(m_pSet, &name, 1, &dispid);
     if (FAILED(hr)) return;
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    m_pSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                   &params, NULL, NULL, NULL);
+    ScopedVariant result;
+    ComInvoke(m_pSet, dispid, DISPATCH_METHOD,
+              &params, result.Receive(), NULL, NULL);
+}
+
+//=============================================================================
+// ParameterSetPool 구현
+//=============================================================================
+
+ParameterSetPool::ParameterSetPool(size_t max_per_id)
+    : m_maxPerId(max_per_id)
+    , m_idleCount(0)
+    , m_hits(0)
+    , m_misses(0)
+{
+}
+
+ParameterSetPool::~ParameterSetPool()
+{
+    Clear();
+}
+
+IDispatch* ParameterSetPool::Take(const std::wstring& set_id)
+{
+    auto it = m_buckets.find(set_id);
+    if (it == m_buckets.end() || it->second.idle.empty()) {
+        m_misses++;
+        return nullptr;
+    }
+
+    Bucket& bucket = it->second;
+    IDispatch* pset = bucket.idle.back();
+    bucket.idle.pop_back();
+    m_idleCount--;
+
+    // 이전 사용자가 쓴 항목 비우기
+    if (bucket.clearId == DISPID_UNKNOWN) {
+        static const BSTR s_clear = InternBstr(L"Clear");
+        OLECHAR* name = s_clear;
+        if (FAILED(ComGetIDsOfNames(pset, &name, 1, &bucket.clearId))) {
+            bucket.clearId = DISPID_UNKNOWN;
+        }
+    }
+    DISPPARAMS params = { NULL, NULL, 0, 0 };
+    if (bucket.clearId == DISPID_UNKNOWN ||
+        FAILED(ComInvoke(pset, bucket.clearId, DISPATCH_METHOD, &params, NULL, NULL, NULL))) {
+        // 비우지 못한 세트는 재사용하지 않음
+        pset->Release();
+        m_misses++;
+        return nullptr;
+    }
+
+    ActionRecorder::NotifyResetSet(pset);
+
+    m_hits++;
+    return pset;
+}
+
+void ParameterSetPool::Give(const std::wstring& set_id, IDispatch* pset)
+{
+    if (!pset) return;
+
+    if (m_maxPerId == 0) {
+        pset->Release();
+        return;
+    }
+
+    Bucket& bucket = m_buckets[set_id];
+    if (bucket.idle.size() >= m_maxPerId) {
+        pset->Release();
+        return;
+    }
+    bucket.idle.push_back(pset);
+    m_idleCount++;
+}
+
+void ParameterSetPool::SetMaxPerId(size_t max_per_id)
+{
+    m_maxPerId = max_per_id;
+
+    for (auto& entry : m_buckets) {
+        std::vector<IDispatch*>& idle = entry.second.idle;
+        while (idle.size() > m_maxPerId) {
+            idle.back()->Release();
+            idle.pop_back();
+            m_idleCount--;
+        }
+    }
+}
+
+void ParameterSetPool::Clear()
+{
+    for (auto& entry : m_buckets) {
+        for (IDispatch* pset : entry.second.idle) {
+            pset->Release();
+        }
+    }
+    m_buckets.clear();
+    m_idleCount = 0;
 }
 
 //=============================================================================
@@ -350,10 +538,8 @@ std::unique_ptr<HwpParameterSet> HwpParameterSetHelper::CreateFindReplace(
 {
     if (!hwp) return nullptr;
 
-    IDispatch* pSet = hwp->CreateSet(L"FindReplace");
-    if (!pSet) return nullptr;
-
-    auto set = std::make_unique<HwpParameterSet>(pSet);
+    auto set = hwp->AcquireParameterSet(L"FindReplace");
+    if (!set) return nullptr;
 
     set->SetItem(L"FindString", find_text);
     if (!replace_text.empty()) {
@@ -363,7 +549,6 @@ std::unique_ptr<HwpParameterSet> HwpParameterSetHelper::CreateFindReplace(
     set->SetItem(L"WholeWord", whole_word);
     set->SetItem(L"UseRegexp", regex);
 
-    pSet->Release();
     return set;
 }
 
@@ -376,10 +561,8 @@ std::unique_ptr<HwpParameterSet> HwpParameterSetHelper::CreateTable(
 {
     if (!hwp) return nullptr;
 
-    IDispatch* pSet = hwp->CreateSet(L"Table");
-    if (!pSet) return nullptr;
-
-    auto set = std::make_unique<HwpParameterSet>(pSet);
+    auto set = hwp->AcquireParameterSet(L"Table");
+    if (!set) return nullptr;
 
     set->SetItem(L"Rows", rows);
     set->SetItem(L"Cols", cols);
@@ -390,7 +573,6 @@ std::unique_ptr<HwpParameterSet> HwpParameterSetHelper::CreateTable(
         set->SetItem(L"RowHeight", row_height);
     }
 
-    pSet->Release();
     return set;
 }
 
@@ -402,10 +584,8 @@ std::unique_ptr<HwpParameterSet> HwpParameterSetHelper::CreateCharShape(
 {
     if (!hwp) return nullptr;
 
-    IDispatch* pSet = hwp->CreateSet(L"CharShape");
-    if (!pSet) return nullptr;
-
-    auto set = std::make_unique<HwpParameterSet>(pSet);
+    auto set = hwp->AcquireParameterSet(L"CharShape");
+    if (!set) return nullptr;
 
     if (!face_name.empty()) {
         set->SetItem(L"FaceNameHangul", face_name);
@@ -418,7 +598,6 @@ std::unique_ptr<HwpParameterSet> HwpParameterSetHelper::CreateCharShape(
         set->SetItem(L"TextColor", static_cast<int>(color));
     }
 
-    pSet->Release();
     return set;
 }
 
@@ -429,15 +608,12 @@ std::unique_ptr<HwpParameterSet> HwpParameterSetHelper::CreateParaShape(
 {
     if (!hwp) return nullptr;
 
-    IDispatch* pSet = hwp->CreateSet(L"ParaShape");
-    if (!pSet) return nullptr;
-
-    auto set = std::make_unique<HwpParameterSet>(pSet);
+    auto set = hwp->AcquireParameterSet(L"ParaShape");
+    if (!set) return nullptr;
 
     set->SetItem(L"Align", static_cast<int>(align));
     set->SetItem(L"LineSpacing", line_spacing);
 
-    pSet->Release();
     return set;
 }
 
@@ -449,16 +625,13 @@ std::unique_ptr<HwpParameterSet> HwpParameterSetHelper::CreateInsertPicture(
 {
     if (!hwp) return nullptr;
 
-    IDispatch* pSet = hwp->CreateSet(L"InsertPicture");
-    if (!pSet) return nullptr;
-
-    auto set = std::make_unique<HwpParameterSet>(pSet);
+    auto set = hwp->AcquireParameterSet(L"InsertPicture");
+    if (!set) return nullptr;
 
     set->SetItem(L"Path", path);
     set->SetItem(L"Embedded", embedded);
     set->SetItem(L"SizeOption", size_option);
 
-    pSet->Release();
     return set;
 }
 
@@ -469,15 +642,12 @@ std::unique_ptr<HwpParameterSet> HwpParameterSetHelper::CreateCellShape(
 {
     if (!hwp) return nullptr;
 
-    IDispatch* pSet = hwp->CreateSet(L"CellShape");
-    if (!pSet) return nullptr;
-
-    auto set = std::make_unique<HwpParameterSet>(pSet);
+    auto set = hwp->AcquireParameterSet(L"CellShape");
+    if (!set) return nullptr;
 
     set->SetItem(L"BackColor", static_cast<int>(bg_color));
     set->SetItem(L"VAlign", static_cast<int>(valign));
 
-    pSet->Release();
     return set;
 }
 
@@ -489,16 +659,13 @@ std::unique_ptr<HwpParameterSet> HwpParameterSetHelper::CreateBorderLine(
 {
     if (!hwp) return nullptr;
 
-    IDispatch* pSet = hwp->CreateSet(L"BorderLine");
-    if (!pSet) return nullptr;
-
-    auto set = std::make_unique<HwpParameterSet>(pSet);
+    auto set = hwp->AcquireParameterSet(L"BorderLine");
+    if (!set) return nullptr;
 
     set->SetItem(L"Style", static_cast<int>(style));
     set->SetItem(L"Width", width);
     set->SetItem(L"Color", static_cast<int>(color));
 
-    pSet->Release();
     return set;
 }
 
@@ -9,16 +9,19 @@
 #pragma once
 
 #include "HwpTypes.h"
-#include <Windows.h>
-#include <comdef.h>
+#include "ComPlatform.h"
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
+#include <utility>
 
 namespace cpyhwpx {
 
 // 전방 선언
 class HwpWrapper;
+class ScopedVariant;
+class ParameterSetPool;
 
 /**
  * @class HwpParameterSet
@@ -35,8 +38,17 @@ public:
     /**
      * @brief HwpParameterSet 생성자
      * @param pset COM 파라미터셋 객체
+     * @param set_id 파라미터셋 ID (알면 지정: 같은 ID의 Item DISPID를 스레드별로 재사용)
      */
-    HwpParameterSet(IDispatch* pset);
+    HwpParameterSet(IDispatch* pset, const std::wstring& set_id = L"");
+
+    /**
+     * @brief 풀에서 빌린 파라미터셋 (소멸 시 풀로 반환)
+     * @param pset COM 파라미터셋 객체 (참조를 넘겨받음)
+     * @param pool 반환할 풀 (이미 해제되었으면 Release)
+     * @param set_id 풀의 세트 ID
+     */
+    HwpParameterSet(IDispatch* pset, std::weak_ptr<ParameterSetPool> pool, const std::wstring& set_id);
 
     /**
      * @brief 소멸자
@@ -76,6 +88,27 @@ public:
      */
     bool SetItem(const std::wstring& name, const VARIANT& value);
 
+    //=========================================================================
+    // 파라미터 일괄 설정/가져오기
+    //=========================================================================
+
+    /**
+     * @brief 여러 파라미터 한 번에 설정
+     * @param items (이름, 값) 목록 (값 VARIANT는 빌려서 전달)
+     * @return 모두 성공하면 true (실패한 항목이 있어도 나머지는 설정)
+     *
+     * 알려진 파라미터 이름(CharShape/ParaShape 등)은 InternBstr로 재사용하고,
+     * 그 밖의 이름은 호출마다 할당한다 (임의 이름이 프로세스 수명 동안 쌓이지 않음).
+     */
+    bool SetItems(const std::vector<std::pair<std::wstring, VARIANT>>& items);
+
+    /**
+     * @brief 여러 파라미터 한 번에 가져오기
+     * @param names 파라미터 이름 목록
+     * @return names 순서의 값 (호출자가 VariantClear 책임, 실패한 항목은 VT_EMPTY)
+     */
+    std::vector<VARIANT> GetItems(const std::vector<std::wstring>& names);
+
     //=========================================================================
     // 파라미터 가져오기 - 기본 타입
     //=========================================================================
@@ -167,11 +200,97 @@ protected:
 
     /**
      * @brief GetItem 내부 구현
+     * @param result 결과 수신 (소멸 시 자동 해제)
+     * @return Invoke 성공 여부
      */
-    VARIANT GetItemInternal(const std::wstring& name);
+    bool GetItemInternal(const std::wstring& name, ScopedVariant& result);
+
+    /**
+     * @brief 이름 BSTR을 받는 SetItem/GetItem 내부 구현
+     */
+    bool PutItem(const std::wstring& name, BSTR name_bstr, VARIANT& value);
+    bool FetchItem(BSTR name_bstr, ScopedVariant& result);
+
+    /**
+     * @brief Item DISPID (인스턴스 및 세트 ID별 캐시)
+     */
+    DISPID ItemDispid();
 
 private:
     IDispatch* m_pSet;  // HParameterSet COM 포인터
+    std::wstring m_setId;                       // 파라미터셋 ID (모르면 빈 문자열)
+    DISPID m_itemId;                            // Item DISPID 캐시
+    std::weak_ptr<ParameterSetPool> m_pool;     // 빌린 세트의 반환 풀
+};
+
+/**
+ * @class ParameterSetPool
+ * @brief 세트 ID별 HParameterSet 재사용 풀
+ *
+ * CreateSet은 호출마다 새 COM 객체를 만든다. 셀 서식처럼 같은 세트를
+ * 수백 번 만드는 반복에서는 다 쓴 세트를 돌려받아 Clear()로 비운 뒤 다시 쓴다.
+ * HwpWrapper와 같은 스레드에서만 사용한다.
+ */
+class ParameterSetPool {
+public:
+    static constexpr size_t kDefaultMaxPerId = 8;
+
+    explicit ParameterSetPool(size_t max_per_id = kDefaultMaxPerId);
+
+    /**
+     * @brief 보관 중인 세트 모두 Release
+     */
+    ~ParameterSetPool();
+
+    ParameterSetPool(const ParameterSetPool&) = delete;
+    ParameterSetPool& operator=(const ParameterSetPool&) = delete;
+
+    /**
+     * @brief 보관 중인 세트 꺼내기 (Clear()로 초기화됨)
+     * @return 세트 (호출자가 참조 소유), 없으면 nullptr
+     */
+    IDispatch* Take(const std::wstring& set_id);
+
+    /**
+     * @brief 다 쓴 세트 반환 (호출자 참조를 넘겨받음)
+     *
+     * 세트 ID별 한도를 넘으면 보관하지 않고 Release.
+     */
+    void Give(const std::wstring& set_id, IDispatch* pset);
+
+    /**
+     * @brief 세트 ID별 최대 보관 수 (0이면 풀 사용 안 함)
+     */
+    void SetMaxPerId(size_t max_per_id);
+    size_t GetMaxPerId() const { return m_maxPerId; }
+
+    /**
+     * @brief 보관 중인 세트 수 (전체)
+     */
+    size_t GetIdleCount() const { return m_idleCount; }
+
+    /**
+     * @brief Take() 성공/실패 횟수
+     */
+    size_t GetHitCount() const { return m_hits; }
+    size_t GetMissCount() const { return m_misses; }
+
+    /**
+     * @brief 보관 중인 세트 모두 Release
+     */
+    void Clear();
+
+private:
+    struct Bucket {
+        std::vector<IDispatch*> idle;
+        DISPID clearId = DISPID_UNKNOWN;    // 같은 세트 ID면 Clear의 DISPID도 같음
+    };
+
+    std::unordered_map<std::wstring, Bucket> m_buckets;
+    size_t m_maxPerId;
+    size_t m_idleCount;
+    size_t m_hits;
+    size_t m_misses;
 };
 
 /**
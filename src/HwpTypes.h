@@ -16,7 +16,7 @@
 #define NOMINMAX
 #endif
 
-#include <Windows.h>
+#include "ComPlatform.h"
 #include <string>
 #include <vector>
 #include <map>
@@ -7,13 +7,22 @@
 
 #include "HwpWrapper.h"
 #include "HwpCtrl.h"
+#include "HwpParameter.h"
+#include "HwpAction.h"
+#include "TextChunkReader.h"
+#include "ComScope.h"
+#include "ComStats.h"
+#include "ComTrace.h"
+#include "Platform.h"
+#include "ActionRecorder.h"
+#include "Utils.h"
 #include <stdexcept>
 #include <cmath>
-#include <atlbase.h>
-#include <atlcom.h>
-#include <shlwapi.h>
 
-#pragma comment(lib, "shlwapi.lib")
+#if defined(_WIN32)
+#include <ole2.h>   // CoCreateInstance, IOleObject
+#include <psapi.h>  // GetProcessMemoryInfo
+#endif
 
 namespace cpyhwpx {
 
@@ -28,13 +37,18 @@ DISPID DISPIDCache::GetOrLoad(IDispatch* pObj, const std::wstring& name)
     // 캐시에서 먼저 검색
     auto it = m_cache.find(name);
     if (it != m_cache.end()) {
+#if CPYHWPX_COM_STATS
+        if (ComStats::IsEnabled() || ComTrace::IsEnabled()) {
+            ComStats::NameMember(pObj, it->second, name);
+        }
+#endif
         return it->second;
     }
 
     // 캐시에 없으면 GetIDsOfNames 호출
     DISPID dispid;
     OLECHAR* pName = const_cast<OLECHAR*>(name.c_str());
-    HRESULT hr = pObj->GetIDsOfNames(IID_NULL, &pName, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(pObj, &pName, 1, &dispid);
 
     if (SUCCEEDED(hr)) {
         m_cache[name] = dispid;
@@ -56,24 +70,58 @@ HwpWrapper::HwpWrapper(bool visible, bool new_instance, bool register_module)
     , m_bVisible(visible)
     , m_bNewInstance(new_instance)
     , m_bRegisterModule(register_module)
+    , m_setPool(std::make_shared<ParameterSetPool>())
+    , m_fieldIndexStamp(0)
+    , m_fieldTextsTried(false)
+    , m_bulkEditDepth(0)
 {
 }
 
 HwpWrapper::~HwpWrapper()
 {
+    m_recorder.reset();
     Release();
 }
 
+//=============================================================================
+// 작업 기록
+//=============================================================================
+
+bool HwpWrapper::StartRecording(const std::wstring& log_path)
+{
+    if (!m_recorder) {
+        m_recorder = std::make_unique<ActionRecorder>();
+    }
+    return m_recorder->Start(log_path);
+}
+
+HwpBatch HwpWrapper::StopRecording()
+{
+    if (!m_recorder) return HwpBatch();
+
+    m_recorder->Stop();
+    HwpBatch journal = m_recorder->TakeJournal();
+    m_recorder.reset();     // 로그 파일 닫기
+    return journal;
+}
+
+bool HwpWrapper::IsRecording() const
+{
+    return m_recorder && m_recorder->IsActive();
+}
+
 //=============================================================================
 // 초기화 및 종료
 //=============================================================================
 
 bool HwpWrapper::InitializeCOM()
 {
+#if defined(_WIN32)
     HRESULT hr = CoInitialize(NULL);
     if (FAILED(hr) && hr != RPC_E_CHANGED_MODE) {
         return false;
     }
+#endif
     return true;
 }
 
@@ -83,6 +131,7 @@ bool HwpWrapper::CreateHwpObject()
         return true;  // 이미 생성됨
     }
 
+#if defined(_WIN32)
     CLSID clsid;
     HRESULT hr = CLSIDFromProgID(L"HWPFrame.HwpObject", &clsid);
     if (FAILED(hr)) {
@@ -95,11 +144,17 @@ bool HwpWrapper::CreateHwpObject()
         return false;
     }
 
+    ComStats::Label(m_pHwp, L"HwpObject");
     return true;
+#else
+    // COM 서버 없음: Attach()로 같은 프로세스의 IDispatch 구현을 연결해야 함
+    return false;
+#endif
 }
 
 bool HwpWrapper::Initialize()
 {
+    CPYHWPX_TRACE_METHOD();
     if (m_bInitialized) {
         return true;
     }
@@ -135,37 +190,46 @@ bool HwpWrapper::Initialize()
     return true;
 }
 
+bool HwpWrapper::Attach(IDispatch* hwp_object)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!hwp_object) return false;
+
+    hwp_object->AddRef();
+    ClearPosCache();
+    Release();
+    m_dispidCache.Clear();
+
+    m_pHwp = hwp_object;
+    ComStats::Label(m_pHwp, L"HwpObject");
+    m_bInitialized = true;
+    m_edits.Note(EditKind::Document);
+    return true;
+}
+
 bool HwpWrapper::RegisterModule(const std::wstring& module_type,
                                  const std::wstring& module_data)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
     // DISPID 캐시 사용 (성능 최적화)
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"RegisterModule");
     if (dispid == DISPID_UNKNOWN) return false;
 
-    VARIANT args[2];
-    VariantInit(&args[0]);
-    VariantInit(&args[1]);
-
     // 인자는 역순으로
-    args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(module_data.c_str());
-    args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(module_type.c_str());
+    ScopedBstr dataBstr(module_data);
+    ScopedBstr typeBstr(module_type);
+    VARIANT args[2] = { BstrArg(dataBstr.get()), BstrArg(typeBstr.get()) };
 
     DISPPARAMS params = { args, NULL, 2, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    SysFreeString(args[0].bstrVal);
-    SysFreeString(args[1].bstrVal);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                           &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
+    return (result.vt() == VT_BOOL) ? result.ToBool() : true;
 }
 
 //=============================================================================
@@ -174,45 +238,31 @@ bool HwpWrapper::RegisterModule(const std::wstring& module_type,
 
 bool HwpWrapper::CheckRegistryKey(const std::wstring& key_name)
 {
-    HKEY hKey;
+    CPYHWPX_TRACE_METHOD();
+    PlatformServices& platform = PlatformServices::Get();
     std::wstring subKey = L"Software\\HNC\\HwpAutomation\\Modules";
 
-    // 첫 번째 경로 시도
-    if (RegOpenKeyExW(HKEY_CURRENT_USER, subKey.c_str(), 0, KEY_READ, &hKey) != ERROR_SUCCESS) {
-        // 대체 경로 시도
+    // 첫 번째 경로가 없으면 대체 경로 시도
+    if (!platform.RegistryKeyExists(subKey)) {
         subKey = L"Software\\Hnc\\HwpUserAction\\Modules";
-        if (RegOpenKeyExW(HKEY_CURRENT_USER, subKey.c_str(), 0, KEY_READ, &hKey) != ERROR_SUCCESS) {
-            return false;
-        }
     }
 
-    wchar_t buffer[MAX_PATH];
-    DWORD bufferSize = sizeof(buffer);
-    DWORD type;
-
-    LONG result = RegQueryValueExW(hKey, key_name.c_str(), NULL, &type,
-                                    (LPBYTE)buffer, &bufferSize);
-    RegCloseKey(hKey);
-
-    if (result != ERROR_SUCCESS || type != REG_SZ) {
+    std::wstring dllPath;
+    if (!platform.RegistryReadString(subKey, key_name, dllPath)) {
         return false;
     }
 
     // DLL 파일 존재 확인
-    return PathFileExistsW(buffer) == TRUE;
+    return platform.FileExists(dllPath);
 }
 
 std::wstring HwpWrapper::FindDllPath()
 {
-    wchar_t modulePath[MAX_PATH];
+    CPYHWPX_TRACE_METHOD();
+    PlatformServices& platform = PlatformServices::Get();
 
     // 1. 현재 모듈(cpyhwpx.pyd) 경로에서 검색
-    HMODULE hModule = NULL;
-    GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS,
-                       (LPCWSTR)&HwpWrapper::FindDllPath, &hModule);
-    GetModuleFileNameW(hModule, modulePath, MAX_PATH);
-
-    std::wstring basePath(modulePath);
+    std::wstring basePath = platform.ModulePath();
     size_t pos = basePath.find_last_of(L"\\/");
     if (pos != std::wstring::npos) {
         basePath = basePath.substr(0, pos + 1);
@@ -220,7 +270,7 @@ std::wstring HwpWrapper::FindDllPath()
 
     // 같은 폴더에서 검색 (_native 폴더)
     std::wstring dllPath = basePath + L"FilePathCheckerModule.dll";
-    if (PathFileExistsW(dllPath.c_str())) {
+    if (platform.FileExists(dllPath)) {
         return dllPath;
     }
 
@@ -229,7 +279,7 @@ std::wstring HwpWrapper::FindDllPath()
     if (pos != std::wstring::npos) {
         std::wstring parentPath = basePath.substr(0, pos + 1);
         dllPath = parentPath + L"cpyhwpx\\_native\\FilePathCheckerModule.dll";
-        if (PathFileExistsW(dllPath.c_str())) {
+        if (platform.FileExists(dllPath)) {
             return dllPath;
         }
     }
@@ -240,36 +290,27 @@ std::wstring HwpWrapper::FindDllPath()
 bool HwpWrapper::RegisterToRegistry(const std::wstring& dll_path,
                                      const std::wstring& key_name)
 {
+    CPYHWPX_TRACE_METHOD();
     std::wstring actualPath = dll_path.empty() ? FindDllPath() : dll_path;
     if (actualPath.empty()) {
         return false;
     }
 
-    HKEY hKey;
-    std::wstring subKey = L"Software\\HNC\\HwpAutomation\\Modules";
+    PlatformServices& platform = PlatformServices::Get();
 
-    // 키 열기/생성
-    if (RegCreateKeyExW(HKEY_CURRENT_USER, subKey.c_str(), 0, NULL,
-                        REG_OPTION_NON_VOLATILE, KEY_WRITE, NULL, &hKey, NULL) != ERROR_SUCCESS) {
-        // 대체 경로 시도
-        subKey = L"Software\\Hnc\\HwpUserAction\\Modules";
-        if (RegCreateKeyExW(HKEY_CURRENT_USER, subKey.c_str(), 0, NULL,
-                            REG_OPTION_NON_VOLATILE, KEY_WRITE, NULL, &hKey, NULL) != ERROR_SUCCESS) {
-            return false;
-        }
+    // 키 열기/생성 (실패하면 대체 경로)
+    if (platform.RegistryWriteString(L"Software\\HNC\\HwpAutomation\\Modules",
+                                     key_name, actualPath)) {
+        return true;
     }
-
-    LONG result = RegSetValueExW(hKey, key_name.c_str(), 0, REG_SZ,
-                                  (const BYTE*)actualPath.c_str(),
-                                  (DWORD)((actualPath.length() + 1) * sizeof(wchar_t)));
-    RegCloseKey(hKey);
-
-    return result == ERROR_SUCCESS;
+    return platform.RegistryWriteString(L"Software\\Hnc\\HwpUserAction\\Modules",
+                                        key_name, actualPath);
 }
 
 bool HwpWrapper::AutoRegisterModule(const std::wstring& module_type,
                                      const std::wstring& module_data)
 {
+    CPYHWPX_TRACE_METHOD();
     // 1. 레지스트리 확인
     if (!CheckRegistryKey(module_data)) {
         // 2. 미등록이면 등록
@@ -284,6 +325,7 @@ bool HwpWrapper::AutoRegisterModule(const std::wstring& module_type,
 
 void HwpWrapper::Quit(bool save)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return;
 
     // pyhwpx 방식: Clear() 후 Quit()
@@ -300,8 +342,7 @@ void HwpWrapper::Quit(bool save)
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"Quit");
     if (dispid != DISPID_UNKNOWN) {
         DISPPARAMS params = { NULL, NULL, 0, 0 };
-        m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                       DISPATCH_METHOD, &params, NULL, NULL, NULL);
+        ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, NULL, NULL, NULL);
     }
 
     Release();
@@ -309,6 +350,10 @@ void HwpWrapper::Quit(bool save)
 
 void HwpWrapper::Release()
 {
+    // 빌려 간 세트가 이전 HwpObject의 세트를 새 풀에 반환하지 않도록 풀 교체
+    m_setPool = std::make_shared<ParameterSetPool>(m_setPool->GetMaxPerId());
+    InvalidateFieldIndex();
+
     if (m_pHAction) {
         m_pHAction->Release();
         m_pHAction = nullptr;
@@ -332,48 +377,41 @@ bool HwpWrapper::Open(const std::wstring& filename,
                        const std::wstring& format,
                        const std::wstring& arg)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Document);
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"Open");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return false;
 
-    VARIANT args[3];
-    VariantInit(&args[0]);
-    VariantInit(&args[1]);
-    VariantInit(&args[2]);
-
     // 인자는 역순
-    args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(arg.c_str());
-    args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(format.c_str());
-    args[2].vt = VT_BSTR;
-    args[2].bstrVal = SysAllocString(filename.c_str());
+    ScopedBstr argBstr(arg);
+    ScopedBstr formatBstr(format);
+    ScopedBstr filenameBstr(filename);
+    VARIANT args[3] = {
+        BstrArg(argBstr.get()), BstrArg(formatBstr.get()), BstrArg(filenameBstr.get())
+    };
 
     DISPPARAMS params = { args, NULL, 3, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
-
-    SysFreeString(args[0].bstrVal);
-    SysFreeString(args[1].bstrVal);
-    SysFreeString(args[2].bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
+    return (result.vt() == VT_BOOL) ? result.ToBool() : true;
 }
 
 bool HwpWrapper::Save(bool save_if_dirty)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"Save");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return false;
 
     VARIANT args[1];
@@ -382,61 +420,53 @@ bool HwpWrapper::Save(bool save_if_dirty)
     args[0].boolVal = save_if_dirty ? VARIANT_TRUE : VARIANT_FALSE;
 
     DISPPARAMS params = { args, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
+    return (result.vt() == VT_BOOL) ? result.ToBool() : true;
 }
 
 bool HwpWrapper::SaveAs(const std::wstring& filename,
                          const std::wstring& format,
                          const std::wstring& arg)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"SaveAs");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return false;
 
-    VARIANT args[3];
-    VariantInit(&args[0]);
-    VariantInit(&args[1]);
-    VariantInit(&args[2]);
-
-    args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(arg.c_str());
-    args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(format.c_str());
-    args[2].vt = VT_BSTR;
-    args[2].bstrVal = SysAllocString(filename.c_str());
+    ScopedBstr argBstr(arg);
+    ScopedBstr formatBstr(format);
+    ScopedBstr filenameBstr(filename);
+    VARIANT args[3] = {
+        BstrArg(argBstr.get()), BstrArg(formatBstr.get()), BstrArg(filenameBstr.get())
+    };
 
     DISPPARAMS params = { args, NULL, 3, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    SysFreeString(args[0].bstrVal);
-    SysFreeString(args[1].bstrVal);
-    SysFreeString(args[2].bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
+    return (result.vt() == VT_BOOL) ? result.ToBool() : true;
 }
 
 void HwpWrapper::Clear(int option)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return;
+    m_edits.Note(EditKind::Document);
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"Clear");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return;
 
     VARIANT args[1];
@@ -445,79 +475,56 @@ void HwpWrapper::Clear(int option)
     args[0].lVal = option;
 
     DISPPARAMS params = { args, NULL, 1, 0 };
-    m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                   &params, NULL, NULL, NULL);
+    ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+              &params, NULL, NULL, NULL);
 }
 
 bool HwpWrapper::ClearDocument(int option)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Document);
 
     // pyhwpx 방식: XHwpDocuments.Active_XHwpDocument.Clear(option)
 
     // 1. XHwpDocuments 속성 획득
-    VARIANT xhwpDocsVar = GetProperty(L"XHwpDocuments");
-    if (xhwpDocsVar.vt != VT_DISPATCH || !xhwpDocsVar.pdispVal) {
-        VariantClear(&xhwpDocsVar);
-        return false;
-    }
+    ScopedVariant xhwpDocsVar(GetProperty(L"XHwpDocuments"));
+    if (xhwpDocsVar.vt() != VT_DISPATCH || !xhwpDocsVar.get().pdispVal) return false;
 
-    IDispatch* pXHwpDocuments = xhwpDocsVar.pdispVal;
+    IDispatch* pXHwpDocuments = xhwpDocsVar.get().pdispVal;
 
     // 2. Active_XHwpDocument 속성 획득
     DISPID dispidActive;
     OLECHAR* activeName = const_cast<OLECHAR*>(L"Active_XHwpDocument");
-    HRESULT hr = pXHwpDocuments->GetIDsOfNames(IID_NULL, &activeName, 1,
-                                                LOCALE_USER_DEFAULT, &dispidActive);
-    if (FAILED(hr)) {
-        pXHwpDocuments->Release();
-        return false;
-    }
+    HRESULT hr = ComGetIDsOfNames(pXHwpDocuments, &activeName, 1, &dispidActive);
+    if (FAILED(hr)) return false;
 
     DISPPARAMS paramsEmpty = { NULL, NULL, 0, 0 };
-    VARIANT activeDocVar;
-    VariantInit(&activeDocVar);
-    hr = pXHwpDocuments->Invoke(dispidActive, IID_NULL, LOCALE_USER_DEFAULT,
-                                 DISPATCH_PROPERTYGET, &paramsEmpty, &activeDocVar, NULL, NULL);
-
-    if (FAILED(hr) || activeDocVar.vt != VT_DISPATCH || !activeDocVar.pdispVal) {
-        VariantClear(&activeDocVar);
-        pXHwpDocuments->Release();
-        return false;
-    }
+    ScopedVariant activeDocVar;
+    hr = ComInvoke(pXHwpDocuments, dispidActive, DISPATCH_PROPERTYGET, &paramsEmpty,
+                   activeDocVar.Receive(), NULL, NULL);
+    if (FAILED(hr) || activeDocVar.vt() != VT_DISPATCH || !activeDocVar.get().pdispVal) return false;
 
-    IDispatch* pActiveDoc = activeDocVar.pdispVal;
+    IDispatch* pActiveDoc = activeDocVar.get().pdispVal;
 
     // 3. Clear(option) 메서드 호출
     DISPID dispidClear;
     OLECHAR* clearName = const_cast<OLECHAR*>(L"Clear");
-    hr = pActiveDoc->GetIDsOfNames(IID_NULL, &clearName, 1,
-                                    LOCALE_USER_DEFAULT, &dispidClear);
-    bool result = false;
-    if (SUCCEEDED(hr)) {
-        VARIANT arg;
-        VariantInit(&arg);
-        arg.vt = VT_I4;
-        arg.lVal = option;  // 1 = hwpDiscard
-
-        DISPPARAMS params = { &arg, NULL, 1, 0 };
-        VARIANT clearResult;
-        VariantInit(&clearResult);
-        hr = pActiveDoc->Invoke(dispidClear, IID_NULL, LOCALE_USER_DEFAULT,
-                                 DISPATCH_METHOD, &params, &clearResult, NULL, NULL);
-        result = SUCCEEDED(hr);
-        VariantClear(&clearResult);
-    }
-
-    pActiveDoc->Release();
-    pXHwpDocuments->Release();
+    hr = ComGetIDsOfNames(pActiveDoc, &clearName, 1, &dispidClear);
+    if (FAILED(hr)) return false;
 
-    return result;
+    VARIANT arg = IntArg(option);  // 1 = hwpDiscard
+    DISPPARAMS params = { &arg, NULL, 1, 0 };
+    ScopedVariant clearResult;
+    hr = ComInvoke(pActiveDoc, dispidClear, DISPATCH_METHOD, &params, clearResult.Receive(), NULL, NULL);
+    return SUCCEEDED(hr);
 }
 
 bool HwpWrapper::Close(bool is_dirty)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Document);
 
     // dirty 상태 설정
     VARIANT val;
@@ -536,193 +543,110 @@ bool HwpWrapper::InsertFile(const std::wstring& filename,
                              int keep_style,
                              bool move_doc_end)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
 
-    HRESULT hr;
-    DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"InsertFile");
+    }
 
-    // 1. HParameterSet 속성 가져오기
-    OLECHAR* psetName = const_cast<OLECHAR*>(L"HParameterSet");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &psetName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return false;
+    static const BSTR s_insertFile = InternBstr(L"InsertFile");
 
+    HRESULT hr;
+    DISPID dispid;
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                        &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
 
-    IDispatch* pHParameterSet = result.pdispVal;
+    // 1. HParameterSet 가져오기 (캐시됨, Release 불필요)
+    IDispatch* pHParameterSet = GetHParameterSet();
+    if (!pHParameterSet) return false;
 
     // 2. HInsertFile 속성 가져오기
     OLECHAR* insertFileName = const_cast<OLECHAR*>(L"HInsertFile");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &insertFileName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHParameterSet->Release();
-        return false;
-    }
+    hr = ComGetIDsOfNames(pHParameterSet, &insertFileName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    pHParameterSet->Release();
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    ScopedVariant insertFile;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, insertFile.Receive(), NULL, NULL);
+    if (FAILED(hr) || insertFile.vt() != VT_DISPATCH || !insertFile.get().pdispVal) return false;
 
-    IDispatch* pHInsertFile = result.pdispVal;
+    IDispatch* pHInsertFile = insertFile.get().pdispVal;
 
     // 3. HSet 속성 가져오기
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHInsertFile->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHInsertFile->Release();
-        return false;
-    }
+    hr = ComGetIDsOfNames(pHInsertFile, &hsetName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHInsertFile->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                               &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
-        pHInsertFile->Release();
-        return false;
-    }
+    ScopedVariant hset;
+    hr = ComInvoke(pHInsertFile, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, hset.Receive(), NULL, NULL);
+    if (FAILED(hr) || hset.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = hset.get().pdispVal;
 
     // 4. HAction 가져오기
     IDispatch* pHAction = GetHAction();
-    if (!pHAction) {
-        pHSet->Release();
-        pHInsertFile->Release();
-        return false;
-    }
+    if (!pHAction) return false;
 
     // 5. HAction.GetDefault("InsertFile", HSet) 호출
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHSet->Release();
-        pHInsertFile->Release();
-        return false;
-    }
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    VARIANT getDefaultArgs[2];
-    VariantInit(&getDefaultArgs[0]);
-    VariantInit(&getDefaultArgs[1]);
-    getDefaultArgs[0].vt = VT_DISPATCH;
-    getDefaultArgs[0].pdispVal = pHSet;
-    getDefaultArgs[1].vt = VT_BSTR;
-    getDefaultArgs[1].bstrVal = SysAllocString(L"InsertFile");
+    VARIANT actionArgs[2] = { DispatchArg(pHSet), BstrArg(s_insertFile) };
 
-    DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &getDefaultParams, &result, NULL, NULL);
-    SysFreeString(getDefaultArgs[1].bstrVal);
+    DISPPARAMS getDefaultParams = { actionArgs, NULL, 2, 0 };
+    ScopedVariant result;
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &getDefaultParams, result.Receive(), NULL, NULL);
 
     // 6. 파라미터 설정: filename
     OLECHAR* filenamePropName = const_cast<OLECHAR*>(L"filename");
-    hr = pHInsertFile->GetIDsOfNames(IID_NULL, &filenamePropName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHInsertFile, &filenamePropName, 1, &dispid);
     if (SUCCEEDED(hr)) {
-        VARIANT filenameVal;
-        VariantInit(&filenameVal);
-        filenameVal.vt = VT_BSTR;
-        filenameVal.bstrVal = SysAllocString(filename.c_str());
+        ScopedBstr filenameBstr(filename);
+        VARIANT filenameVal = BstrArg(filenameBstr.get());
 
         DISPID putid = DISPID_PROPERTYPUT;
         DISPPARAMS filenameParams = { &filenameVal, &putid, 1, 1 };
-        pHInsertFile->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                              &filenameParams, NULL, NULL, NULL);
-        SysFreeString(filenameVal.bstrVal);
-    }
-
-    // 7. 파라미터 설정: KeepSection
-    OLECHAR* keepSectionName = const_cast<OLECHAR*>(L"KeepSection");
-    hr = pHInsertFile->GetIDsOfNames(IID_NULL, &keepSectionName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (SUCCEEDED(hr)) {
-        VARIANT keepVal;
-        VariantInit(&keepVal);
-        keepVal.vt = VT_I4;
-        keepVal.lVal = keep_section;
-
-        DISPID putid = DISPID_PROPERTYPUT;
-        DISPPARAMS keepParams = { &keepVal, &putid, 1, 1 };
-        pHInsertFile->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                              &keepParams, NULL, NULL, NULL);
-    }
-
-    // 8. 파라미터 설정: KeepCharshape
-    OLECHAR* keepCharshapeName = const_cast<OLECHAR*>(L"KeepCharshape");
-    hr = pHInsertFile->GetIDsOfNames(IID_NULL, &keepCharshapeName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (SUCCEEDED(hr)) {
-        VARIANT keepVal;
-        VariantInit(&keepVal);
-        keepVal.vt = VT_I4;
-        keepVal.lVal = keep_charshape;
-
-        DISPID putid = DISPID_PROPERTYPUT;
-        DISPPARAMS keepParams = { &keepVal, &putid, 1, 1 };
-        pHInsertFile->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                              &keepParams, NULL, NULL, NULL);
-    }
-
-    // 9. 파라미터 설정: KeepParashape
-    OLECHAR* keepParashapeName = const_cast<OLECHAR*>(L"KeepParashape");
-    hr = pHInsertFile->GetIDsOfNames(IID_NULL, &keepParashapeName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (SUCCEEDED(hr)) {
-        VARIANT keepVal;
-        VariantInit(&keepVal);
-        keepVal.vt = VT_I4;
-        keepVal.lVal = keep_parashape;
-
-        DISPID putid = DISPID_PROPERTYPUT;
-        DISPPARAMS keepParams = { &keepVal, &putid, 1, 1 };
-        pHInsertFile->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                              &keepParams, NULL, NULL, NULL);
-    }
-
-    // 10. 파라미터 설정: KeepStyle
-    OLECHAR* keepStyleName = const_cast<OLECHAR*>(L"KeepStyle");
-    hr = pHInsertFile->GetIDsOfNames(IID_NULL, &keepStyleName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (SUCCEEDED(hr)) {
-        VARIANT keepVal;
-        VariantInit(&keepVal);
-        keepVal.vt = VT_I4;
-        keepVal.lVal = keep_style;
+        ComInvoke(pHInsertFile, dispid, DISPATCH_PROPERTYPUT,
+                  &filenameParams, NULL, NULL, NULL);
+    }
+
+    // 7~10. 파라미터 설정: KeepSection, KeepCharshape, KeepParashape, KeepStyle
+    const struct {
+        const wchar_t* name;
+        int value;
+    } keeps[] = {
+        { L"KeepSection", keep_section },
+        { L"KeepCharshape", keep_charshape },
+        { L"KeepParashape", keep_parashape },
+        { L"KeepStyle", keep_style },
+    };
+    for (const auto& keep : keeps) {
+        OLECHAR* keepName = const_cast<OLECHAR*>(keep.name);
+        hr = ComGetIDsOfNames(pHInsertFile, &keepName, 1, &dispid);
+        if (FAILED(hr)) continue;
 
+        VARIANT keepVal = IntArg(keep.value);
         DISPID putid = DISPID_PROPERTYPUT;
         DISPPARAMS keepParams = { &keepVal, &putid, 1, 1 };
-        pHInsertFile->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                              &keepParams, NULL, NULL, NULL);
+        ComInvoke(pHInsertFile, dispid, DISPATCH_PROPERTYPUT,
+                  &keepParams, NULL, NULL, NULL);
     }
 
     // 11. HAction.Execute("InsertFile", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHSet->Release();
-        pHInsertFile->Release();
-        return false;
-    }
-
-    VARIANT executeArgs[2];
-    VariantInit(&executeArgs[0]);
-    VariantInit(&executeArgs[1]);
-    executeArgs[0].vt = VT_DISPATCH;
-    executeArgs[0].pdispVal = pHSet;
-    executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"InsertFile");
-
-    DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    pHSet->Release();
-    pHInsertFile->Release();
+    DISPPARAMS executeParams = { actionArgs, NULL, 2, 0 };
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
-    bool success = SUCCEEDED(hr) && (result.vt == VT_BOOL ? result.boolVal != VARIANT_FALSE : true);
+    bool success = SUCCEEDED(hr) && (result.vt() == VT_BOOL ? result.ToBool() : true);
 
     // 12. move_doc_end 처리
     if (success && move_doc_end) {
@@ -735,7 +659,15 @@ bool HwpWrapper::InsertFile(const std::wstring& filename,
 std::wstring HwpWrapper::GetTextFile(const std::wstring& format,
                                       const std::wstring& option)
 {
-    if (!m_pHwp) return L"";
+    CPYHWPX_TRACE_METHOD();
+    return GetTextFileBstr(format, option).str();
+}
+
+BstrString HwpWrapper::GetTextFileBstr(const std::wstring& format,
+                                       const std::wstring& option)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return BstrString();
 
     // COM 이름 지정 파라미터 호출:
     // hwp.GetTextFile(Format=format, option=option)
@@ -745,8 +677,8 @@ std::wstring HwpWrapper::GetTextFile(const std::wstring& format,
 
     // 1. GetTextFile 메서드의 DISPID 획득
     OLECHAR* methodName = const_cast<OLECHAR*>(L"Gettextfile");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return L"";
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
+    if (FAILED(hr)) return BstrString();
 
     // 2. 이름 지정 파라미터의 DISPID 획득
     OLECHAR* paramNames[2] = {
@@ -754,75 +686,76 @@ std::wstring HwpWrapper::GetTextFile(const std::wstring& format,
         const_cast<OLECHAR*>(L"option")
     };
     DISPID namedDispids[2];
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, paramNames, 2, LOCALE_USER_DEFAULT, namedDispids);
+    hr = ComGetIDsOfNames(m_pHwp, paramNames, 2, namedDispids);
+
+    ScopedBstr formatBstr(format);
+    ScopedBstr optionBstr(option);
+
     if (FAILED(hr)) {
         // 이름 지정 파라미터 실패 시 위치 기반으로 시도
-        VARIANT args[2];
-        VariantInit(&args[0]);
-        VariantInit(&args[1]);
-
         // 인자는 역순 (option, format)
-        args[0].vt = VT_BSTR;
-        args[0].bstrVal = SysAllocString(option.c_str());
-        args[1].vt = VT_BSTR;
-        args[1].bstrVal = SysAllocString(format.c_str());
+        VARIANT args[2] = { BstrArg(optionBstr.get()), BstrArg(formatBstr.get()) };
 
         DISPPARAMS params = { args, NULL, 2, 0 };
         VARIANT result;
         VariantInit(&result);
 
-        hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                            &params, &result, NULL, NULL);
-
-        SysFreeString(args[0].bstrVal);
-        SysFreeString(args[1].bstrVal);
+        hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                       &params, &result, NULL, NULL);
+        if (FAILED(hr)) return BstrString();
 
-        if (FAILED(hr)) return L"";
-
-        std::wstring text;
-        if (result.vt == VT_BSTR && result.bstrVal) {
-            text = result.bstrVal;
-            SysFreeString(result.bstrVal);
-        }
-        return text;
+        return BstrString::FromVariant(result);
     }
 
     // 3. 이름 지정 파라미터로 호출
-    VARIANT args[2];
-    VariantInit(&args[0]);
-    VariantInit(&args[1]);
-
     // 이름 지정 시 순서는 namedDispids 순서와 일치해야 함
-    args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(format.c_str());
-    args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(option.c_str());
+    VARIANT args[2] = { BstrArg(formatBstr.get()), BstrArg(optionBstr.get()) };
 
     DISPPARAMS params = { args, namedDispids, 2, 2 };
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, &result, NULL, NULL);
+    if (FAILED(hr)) return BstrString();
 
-    SysFreeString(args[0].bstrVal);
-    SysFreeString(args[1].bstrVal);
+    return BstrString::FromVariant(result);
+}
 
-    if (FAILED(hr)) return L"";
+int HwpWrapper::GetTextFileChunks(const std::wstring& format, int chunk_paras,
+                                  const std::function<bool(const BstrString&, int)>& callback,
+                                  size_t max_chunk_bytes)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp || !callback) return 0;
 
-    std::wstring text;
-    if (result.vt == VT_BSTR && result.bstrVal) {
-        text = result.bstrVal;
-        SysFreeString(result.bstrVal);
+    TextChunkReader reader(this, format, chunk_paras, max_chunk_bytes);
+    BstrString chunk;
+    int count = 0;
+    while (reader.Next(chunk)) {
+        ++count;
+        if (!callback(chunk, count - 1)) break;
+        chunk.Reset();
     }
-    return text;
+    return count;
 }
 
 int HwpWrapper::SetTextFile(const std::wstring& data,
                              const std::wstring& format,
                              const std::wstring& option)
 {
+    CPYHWPX_TRACE_METHOD();
+    m_edits.Note(EditKind::Content);
+    return SetTextFileBstr(BstrString::FromUtf16(data.data(), data.size()), format, option);
+}
+
+int HwpWrapper::SetTextFileBstr(const BstrString& data,
+                                const std::wstring& format,
+                                const std::wstring& option)
+{
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return 0;
+    m_edits.Note(EditKind::Content);
 
     // COM 이름 지정 파라미터 호출:
     // hwp.SetTextFile(data=data, Format=format, option=option)
@@ -832,449 +765,395 @@ int HwpWrapper::SetTextFile(const std::wstring& data,
 
     // 1. SetTextFile 메서드의 DISPID 획득
     OLECHAR* methodName = const_cast<OLECHAR*>(L"SetTextFile");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return 0;
 
     // 2. 위치 기반 파라미터로 호출 (data, Format, option 순서)
-    VARIANT args[3];
-    VariantInit(&args[0]);
-    VariantInit(&args[1]);
-    VariantInit(&args[2]);
-
-    // 인자는 역순 (option, Format, data)
-    args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(option.c_str());
-    args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(format.c_str());
-    args[2].vt = VT_BSTR;
-    args[2].bstrVal = SysAllocString(data.c_str());
+    // 인자는 역순 (option, Format, data), data는 호출자 소유라 복사하지 않음
+    ScopedBstr optionBstr(option);
+    ScopedBstr formatBstr(format);
+    VARIANT args[3] = {
+        BstrArg(optionBstr.get()), BstrArg(formatBstr.get()), BstrArg(data.bstr())
+    };
 
     DISPPARAMS params = { args, NULL, 3, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    SysFreeString(args[0].bstrVal);
-    SysFreeString(args[1].bstrVal);
-    SysFreeString(args[2].bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return 0;
 
     // 반환값 처리 (성공=1, 실패=0)
-    if (result.vt == VT_I4) return result.lVal;
-    if (result.vt == VT_BOOL) return result.boolVal != VARIANT_FALSE ? 1 : 0;
+    if (result.vt() == VT_I4) return result.get().lVal;
+    if (result.vt() == VT_BOOL) return result.ToBool() ? 1 : 0;
     return 1;  // 성공으로 간주
 }
 
+//=============================================================================
+// 서식 캐시 (Template Cache)
+//=============================================================================
+
+namespace {
+
+std::wstring TemplateKey(const std::wstring& filename, const std::wstring& format)
+{
+    return format + L'|' + filename;
+}
+
+} // namespace
+
+bool HwpWrapper::OpenTemplate(const std::wstring& filename, const std::wstring& format)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return false;
+
+    // 읽지 못하면 빈 정보끼리 비교 (키만으로 찾음)
+    FileInfo stamp;
+    PlatformServices::Get().GetFileInfo(filename, stamp);
+
+    std::wstring key = TemplateKey(filename, format);
+    if (const BstrString* data = m_templates.Find(key, stamp)) {
+        // 파일 열기/해석 없이 현재 문서를 비우고 직렬화된 내용으로 교체
+        if (ClearDocument(1) && SetTextFileBstr(*data, format, L"") == 1) {
+            return true;
+        }
+        m_templates.Erase(key);     // 다시 열어서 새로 보관
+    }
+
+    if (!Open(filename)) return false;
+
+    BstrString data = GetTextFileBstr(format, L"");
+    m_templates.Insert(key, data, stamp);
+    return true;
+}
+
+bool HwpWrapper::EvictTemplate(const std::wstring& filename, const std::wstring& format)
+{
+    return m_templates.Erase(TemplateKey(filename, format));
+}
+
+//=============================================================================
+// 체크포인트 (Checkpoint)
+//=============================================================================
+
+int HwpWrapper::Checkpoint(const std::wstring& format)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return 0;
+
+    int docId = GetActiveDocumentID();
+    if (docId < 0) return 0;
+
+    HwpPos pos = GetPos();
+    BstrString data = GetTextFileBstr(format, L"");
+    return m_checkpoints.Add(format, data, pos, docId);
+}
+
+bool HwpWrapper::Restore(int token)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return false;
+
+    // 다른 문서로 전환한 뒤라면 엉뚱한 문서를 덮어쓰므로 거부
+    int docId = m_checkpoints.GetDocumentID(token);
+    if (docId < 0 || docId != GetActiveDocumentID()) return false;
+
+    std::wstring format;
+    BstrString data;
+    HwpPos pos;
+    if (!m_checkpoints.Get(token, format, data, pos)) return false;
+
+    // option이 빈 문자열이면 SetTextFile은 문서 전체를 교체 (문서 경로는 유지)
+    m_edits.Note(EditKind::Document);
+    if (SetTextFileBstr(data, format, L"") != 1) return false;
+
+    SetPos(pos.list, pos.para, pos.pos);
+    return true;
+}
+
+int HwpWrapper::GetActiveDocumentID()
+{
+    std::unique_ptr<XHwpDocuments> docs = GetXHwpDocuments();
+    if (!docs) return -1;
+    std::unique_ptr<XHwpDocument> doc = docs->GetActiveDocument();
+    return doc ? doc->GetDocumentID() : -1;
+}
+
 bool HwpWrapper::OpenPdf(const std::wstring& pdfPath, int thisWindow)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Document);
+
+    static const BSTR s_fileOpenPdf = InternBstr(L"FileOpenPDF");
+    static const BSTR s_callPdfConverter = InternBstr(L"CallPDFConverter");
+    static const BSTR s_empty = InternBstr(L"");
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
-
-    // 1. HParameterSet 속성 가져오기
-    OLECHAR* psetName = const_cast<OLECHAR*>(L"HParameterSet");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &psetName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return false;
-
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                        &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
 
-    IDispatch* pHParameterSet = result.pdispVal;
+    // 1. HParameterSet 가져오기 (캐시됨, Release 불필요)
+    IDispatch* pHParameterSet = GetHParameterSet();
+    if (!pHParameterSet) return false;
 
     // 2. HFileOpenSave 속성 가져오기
     OLECHAR* fileOpenSaveName = const_cast<OLECHAR*>(L"HFileOpenSave");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &fileOpenSaveName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHParameterSet->Release();
-        return false;
-    }
+    hr = ComGetIDsOfNames(pHParameterSet, &fileOpenSaveName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    pHParameterSet->Release();
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    ScopedVariant fileOpenSave;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, fileOpenSave.Receive(), NULL, NULL);
+    if (FAILED(hr) || fileOpenSave.vt() != VT_DISPATCH || !fileOpenSave.get().pdispVal) return false;
 
-    IDispatch* pHFileOpenSave = result.pdispVal;
+    IDispatch* pHFileOpenSave = fileOpenSave.get().pdispVal;
 
     // 3. HSet 속성 가져오기
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHFileOpenSave->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHFileOpenSave->Release();
-        return false;
-    }
+    hr = ComGetIDsOfNames(pHFileOpenSave, &hsetName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHFileOpenSave->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
-        pHFileOpenSave->Release();
-        return false;
-    }
+    ScopedVariant hset;
+    hr = ComInvoke(pHFileOpenSave, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, hset.Receive(), NULL, NULL);
+    if (FAILED(hr) || hset.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = hset.get().pdispVal;
 
-    // 4. HAction 가져오기
+    // 4. HAction 가져오기 (캐시됨, Release 불필요)
     IDispatch* pHAction = GetHAction();
-    if (!pHAction) {
-        pHSet->Release();
-        pHFileOpenSave->Release();
-        return false;
-    }
+    if (!pHAction) return false;
+
+    ScopedVariant result;
 
     // 5. CallPDFConverter 먼저 실행
     OLECHAR* runName = const_cast<OLECHAR*>(L"Run");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &runName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &runName, 1, &dispid);
     if (SUCCEEDED(hr)) {
-        VARIANT runArgs[2];
-        VariantInit(&runArgs[0]);
-        VariantInit(&runArgs[1]);
-        runArgs[0].vt = VT_BSTR;
-        runArgs[0].bstrVal = SysAllocString(L"");
-        runArgs[1].vt = VT_BSTR;
-        runArgs[1].bstrVal = SysAllocString(L"CallPDFConverter");
+        VARIANT runArgs[2] = { BstrArg(s_empty), BstrArg(s_callPdfConverter) };
 
         DISPPARAMS runParams = { runArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &runParams, &result, NULL, NULL);
-        SysFreeString(runArgs[0].bstrVal);
-        SysFreeString(runArgs[1].bstrVal);
-        VariantClear(&result);
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &runParams, result.Receive(), NULL, NULL);
     }
 
+    VARIANT actionArgs[2] = { DispatchArg(pHSet), BstrArg(s_fileOpenPdf) };
+
     // 6. HAction.GetDefault("FileOpenPDF", HSet) 호출
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (SUCCEEDED(hr)) {
-        VARIANT getDefaultArgs[2];
-        VariantInit(&getDefaultArgs[0]);
-        VariantInit(&getDefaultArgs[1]);
-        getDefaultArgs[0].vt = VT_DISPATCH;
-        getDefaultArgs[0].pdispVal = pHSet;
-        getDefaultArgs[1].vt = VT_BSTR;
-        getDefaultArgs[1].bstrVal = SysAllocString(L"FileOpenPDF");
-
-        DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &getDefaultParams, &result, NULL, NULL);
-        SysFreeString(getDefaultArgs[1].bstrVal);
-        VariantClear(&result);
+        DISPPARAMS getDefaultParams = { actionArgs, NULL, 2, 0 };
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &getDefaultParams, result.Receive(), NULL, NULL);
     }
 
     // 7. filename 속성 설정
     OLECHAR* filenamePropName = const_cast<OLECHAR*>(L"filename");
-    hr = pHFileOpenSave->GetIDsOfNames(IID_NULL, &filenamePropName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFileOpenSave, &filenamePropName, 1, &dispid);
     if (SUCCEEDED(hr)) {
-        VARIANT filenameVal;
-        VariantInit(&filenameVal);
-        filenameVal.vt = VT_BSTR;
-        filenameVal.bstrVal = SysAllocString(pdfPath.c_str());
+        ScopedBstr pathBstr(pdfPath);
+        VARIANT filenameVal = BstrArg(pathBstr.get());
 
         DISPID putid = DISPID_PROPERTYPUT;
         DISPPARAMS filenameParams = { &filenameVal, &putid, 1, 1 };
-        pHFileOpenSave->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                                &filenameParams, NULL, NULL, NULL);
-        SysFreeString(filenameVal.bstrVal);
+        ComInvoke(pHFileOpenSave, dispid, DISPATCH_PROPERTYPUT,
+                  &filenameParams, NULL, NULL, NULL);
     }
 
     // 8. OpenFlag 속성 설정
     OLECHAR* openFlagName = const_cast<OLECHAR*>(L"OpenFlag");
-    hr = pHFileOpenSave->GetIDsOfNames(IID_NULL, &openFlagName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFileOpenSave, &openFlagName, 1, &dispid);
     if (SUCCEEDED(hr)) {
-        VARIANT flagVal;
-        VariantInit(&flagVal);
-        flagVal.vt = VT_I4;
-        flagVal.lVal = thisWindow;
+        VARIANT flagVal = IntArg(thisWindow);
 
         DISPID putid = DISPID_PROPERTYPUT;
         DISPPARAMS flagParams = { &flagVal, &putid, 1, 1 };
-        pHFileOpenSave->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                                &flagParams, NULL, NULL, NULL);
+        ComInvoke(pHFileOpenSave, dispid, DISPATCH_PROPERTYPUT,
+                  &flagParams, NULL, NULL, NULL);
     }
 
     // 9. HAction.Execute("FileOpenPDF", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
-    bool success = false;
-    if (SUCCEEDED(hr)) {
-        VARIANT executeArgs[2];
-        VariantInit(&executeArgs[0]);
-        VariantInit(&executeArgs[1]);
-        executeArgs[0].vt = VT_DISPATCH;
-        executeArgs[0].pdispVal = pHSet;
-        executeArgs[1].vt = VT_BSTR;
-        executeArgs[1].bstrVal = SysAllocString(L"FileOpenPDF");
-
-        DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                              &executeParams, &result, NULL, NULL);
-        SysFreeString(executeArgs[1].bstrVal);
-
-        if (SUCCEEDED(hr) && result.vt == VT_BOOL) {
-            success = (result.boolVal != VARIANT_FALSE);
-        }
-        VariantClear(&result);
-    }
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    pHSet->Release();
-    pHFileOpenSave->Release();
-    pHAction->Release();
-    return success;
+    DISPPARAMS executeParams = { actionArgs, NULL, 2, 0 };
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
+    return SUCCEEDED(hr) && result.vt() == VT_BOOL && result.ToBool();
 }
 
 bool HwpWrapper::SaveBlockAs(const std::wstring& path,
                               const std::wstring& format,
                               int attributes)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
     // 선택 모드 확인
-    VARIANT selModeVar = GetProperty(L"SelectionMode");
-    if (selModeVar.vt == VT_I4 && selModeVar.lVal == 0) {
+    ScopedVariant selModeVar(GetProperty(L"SelectionMode"));
+    if (selModeVar.vt() == VT_I4 && selModeVar.get().lVal == 0) {
         return false;  // 선택된 블록 없음
     }
 
+    static const BSTR s_fileSaveBlock = InternBstr(L"FileSaveBlock_S");
+
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
-
-    // 1. HParameterSet 속성 가져오기
-    OLECHAR* psetName = const_cast<OLECHAR*>(L"HParameterSet");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &psetName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return false;
-
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                        &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
 
-    IDispatch* pHParameterSet = result.pdispVal;
+    // 1. HParameterSet 가져오기 (캐시됨, Release 불필요)
+    IDispatch* pHParameterSet = GetHParameterSet();
+    if (!pHParameterSet) return false;
 
     // 2. HFileOpenSave 속성 가져오기
     OLECHAR* fileOpenSaveName = const_cast<OLECHAR*>(L"HFileOpenSave");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &fileOpenSaveName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHParameterSet->Release();
-        return false;
-    }
+    hr = ComGetIDsOfNames(pHParameterSet, &fileOpenSaveName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    pHParameterSet->Release();
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    ScopedVariant fileOpenSave;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, fileOpenSave.Receive(), NULL, NULL);
+    if (FAILED(hr) || fileOpenSave.vt() != VT_DISPATCH || !fileOpenSave.get().pdispVal) return false;
 
-    IDispatch* pHFileOpenSave = result.pdispVal;
+    IDispatch* pHFileOpenSave = fileOpenSave.get().pdispVal;
 
     // 3. HSet 속성 가져오기
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHFileOpenSave->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHFileOpenSave->Release();
-        return false;
-    }
+    hr = ComGetIDsOfNames(pHFileOpenSave, &hsetName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHFileOpenSave->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
-        pHFileOpenSave->Release();
-        return false;
-    }
+    ScopedVariant hset;
+    hr = ComInvoke(pHFileOpenSave, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, hset.Receive(), NULL, NULL);
+    if (FAILED(hr) || hset.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = hset.get().pdispVal;
 
-    // 4. HAction 가져오기
+    // 4. HAction 가져오기 (캐시됨, Release 불필요)
     IDispatch* pHAction = GetHAction();
-    if (!pHAction) {
-        pHSet->Release();
-        pHFileOpenSave->Release();
-        return false;
-    }
+    if (!pHAction) return false;
+
+    VARIANT actionArgs[2] = { DispatchArg(pHSet), BstrArg(s_fileSaveBlock) };
+    ScopedVariant result;
 
     // 5. HAction.GetDefault("FileSaveBlock_S", HSet) 호출
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (SUCCEEDED(hr)) {
-        VARIANT getDefaultArgs[2];
-        VariantInit(&getDefaultArgs[0]);
-        VariantInit(&getDefaultArgs[1]);
-        getDefaultArgs[0].vt = VT_DISPATCH;
-        getDefaultArgs[0].pdispVal = pHSet;
-        getDefaultArgs[1].vt = VT_BSTR;
-        getDefaultArgs[1].bstrVal = SysAllocString(L"FileSaveBlock_S");
-
-        DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &getDefaultParams, &result, NULL, NULL);
-        SysFreeString(getDefaultArgs[1].bstrVal);
-        VariantClear(&result);
+        DISPPARAMS getDefaultParams = { actionArgs, NULL, 2, 0 };
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &getDefaultParams, result.Receive(), NULL, NULL);
     }
 
     // 6. filename 속성 설정
     OLECHAR* filenamePropName = const_cast<OLECHAR*>(L"filename");
-    hr = pHFileOpenSave->GetIDsOfNames(IID_NULL, &filenamePropName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFileOpenSave, &filenamePropName, 1, &dispid);
     if (SUCCEEDED(hr)) {
-        VARIANT filenameVal;
-        VariantInit(&filenameVal);
-        filenameVal.vt = VT_BSTR;
-        filenameVal.bstrVal = SysAllocString(path.c_str());
+        ScopedBstr pathBstr(path);
+        VARIANT filenameVal = BstrArg(pathBstr.get());
 
         DISPID putid = DISPID_PROPERTYPUT;
         DISPPARAMS filenameParams = { &filenameVal, &putid, 1, 1 };
-        pHFileOpenSave->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                                &filenameParams, NULL, NULL, NULL);
-        SysFreeString(filenameVal.bstrVal);
+        ComInvoke(pHFileOpenSave, dispid, DISPATCH_PROPERTYPUT,
+                  &filenameParams, NULL, NULL, NULL);
     }
 
     // 7. Format 속성 설정
     OLECHAR* formatPropName = const_cast<OLECHAR*>(L"Format");
-    hr = pHFileOpenSave->GetIDsOfNames(IID_NULL, &formatPropName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFileOpenSave, &formatPropName, 1, &dispid);
     if (SUCCEEDED(hr)) {
-        VARIANT formatVal;
-        VariantInit(&formatVal);
-        formatVal.vt = VT_BSTR;
-        formatVal.bstrVal = SysAllocString(format.c_str());
+        ScopedBstr formatBstr(format);
+        VARIANT formatVal = BstrArg(formatBstr.get());
 
         DISPID putid = DISPID_PROPERTYPUT;
         DISPPARAMS formatParams = { &formatVal, &putid, 1, 1 };
-        pHFileOpenSave->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                                &formatParams, NULL, NULL, NULL);
-        SysFreeString(formatVal.bstrVal);
+        ComInvoke(pHFileOpenSave, dispid, DISPATCH_PROPERTYPUT,
+                  &formatParams, NULL, NULL, NULL);
     }
 
     // 8. Attributes 속성 설정
     OLECHAR* attrPropName = const_cast<OLECHAR*>(L"Attributes");
-    hr = pHFileOpenSave->GetIDsOfNames(IID_NULL, &attrPropName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFileOpenSave, &attrPropName, 1, &dispid);
     if (SUCCEEDED(hr)) {
-        VARIANT attrVal;
-        VariantInit(&attrVal);
-        attrVal.vt = VT_I4;
-        attrVal.lVal = attributes;
+        VARIANT attrVal = IntArg(attributes);
 
         DISPID putid = DISPID_PROPERTYPUT;
         DISPPARAMS attrParams = { &attrVal, &putid, 1, 1 };
-        pHFileOpenSave->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                                &attrParams, NULL, NULL, NULL);
+        ComInvoke(pHFileOpenSave, dispid, DISPATCH_PROPERTYPUT,
+                  &attrParams, NULL, NULL, NULL);
     }
 
     // 9. HAction.Execute("FileSaveBlock_S", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
-    bool success = false;
-    if (SUCCEEDED(hr)) {
-        VARIANT executeArgs[2];
-        VariantInit(&executeArgs[0]);
-        VariantInit(&executeArgs[1]);
-        executeArgs[0].vt = VT_DISPATCH;
-        executeArgs[0].pdispVal = pHSet;
-        executeArgs[1].vt = VT_BSTR;
-        executeArgs[1].bstrVal = SysAllocString(L"FileSaveBlock_S");
-
-        DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                              &executeParams, &result, NULL, NULL);
-        SysFreeString(executeArgs[1].bstrVal);
-
-        if (SUCCEEDED(hr) && result.vt == VT_BOOL) {
-            success = (result.boolVal != VARIANT_FALSE);
-        }
-        VariantClear(&result);
-    }
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    pHSet->Release();
-    pHFileOpenSave->Release();
-    pHAction->Release();
-    return success;
+    DISPPARAMS executeParams = { actionArgs, NULL, 2, 0 };
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
+    return SUCCEEDED(hr) && result.vt() == VT_BOOL && result.ToBool();
 }
 
 std::map<std::wstring, std::wstring> HwpWrapper::GetFileInfo(const std::wstring& filename)
 {
+    CPYHWPX_TRACE_METHOD();
     std::map<std::wstring, std::wstring> result;
     if (!m_pHwp) return result;
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"GetFileInfo");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return result;
 
-    VARIANT arg;
-    VariantInit(&arg);
-    arg.vt = VT_BSTR;
-    arg.bstrVal = SysAllocString(filename.c_str());
+    ScopedBstr filenameBstr(filename);
+    VARIANT arg = BstrArg(filenameBstr.get());
 
     DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT retVal;
-    VariantInit(&retVal);
+    ScopedVariant retVal;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &retVal, NULL, NULL);
-    SysFreeString(arg.bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, retVal.Receive(), NULL, NULL);
+    if (FAILED(hr) || retVal.vt() != VT_DISPATCH || !retVal.get().pdispVal) return result;
 
-    if (FAILED(hr) || retVal.vt != VT_DISPATCH || !retVal.pdispVal) {
-        VariantClear(&retVal);
-        return result;
-    }
-
-    IDispatch* pFileInfo = retVal.pdispVal;
+    IDispatch* pFileInfo = retVal.get().pdispVal;
 
     // Item 메서드로 각 속성 추출
     auto getItem = [&](const wchar_t* itemName) -> std::wstring {
         DISPID dispidItem;
         OLECHAR* itemMethod = const_cast<OLECHAR*>(L"Item");
-        hr = pFileInfo->GetIDsOfNames(IID_NULL, &itemMethod, 1, LOCALE_USER_DEFAULT, &dispidItem);
+        hr = ComGetIDsOfNames(pFileInfo, &itemMethod, 1, &dispidItem);
         if (FAILED(hr)) return L"";
 
-        VARIANT vItemName;
-        VariantInit(&vItemName);
-        vItemName.vt = VT_BSTR;
-        vItemName.bstrVal = SysAllocString(itemName);
+        VARIANT vItemName = BstrArg(InternBstr(itemName));    // 상수 이름: 해제 금지
 
         DISPPARAMS itemParams = { &vItemName, NULL, 1, 0 };
-        VARIANT itemResult;
-        VariantInit(&itemResult);
+        ScopedVariant itemResult;
 
-        hr = pFileInfo->Invoke(dispidItem, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_METHOD | DISPATCH_PROPERTYGET, &itemParams, &itemResult, NULL, NULL);
-        SysFreeString(vItemName.bstrVal);
+        hr = ComInvoke(pFileInfo, dispidItem, DISPATCH_METHOD | DISPATCH_PROPERTYGET,
+                       &itemParams, itemResult.Receive(), NULL, NULL);
+        if (FAILED(hr)) return L"";
 
-        std::wstring value;
-        if (SUCCEEDED(hr)) {
-            if (itemResult.vt == VT_BSTR && itemResult.bstrVal) {
-                value = itemResult.bstrVal;
-            } else if (itemResult.vt == VT_I4) {
-                value = std::to_wstring(itemResult.lVal);
-            } else if (itemResult.vt == VT_UI4) {
-                wchar_t buf[32];
-                swprintf_s(buf, L"0x%08X", itemResult.ulVal);
-                value = buf;
-            }
+        const VARIANT& item = itemResult.get();
+        if (item.vt == VT_BSTR && item.bstrVal) {
+            return item.bstrVal;
+        } else if (item.vt == VT_I4) {
+            return std::to_wstring(item.lVal);
+        } else if (item.vt == VT_UI4) {
+            wchar_t buf[32];
+            swprintf(buf, 32, L"0x%08X", item.ulVal);
+            return buf;
         }
-        VariantClear(&itemResult);
-        return value;
+        return L"";
     };
 
     result[L"Format"] = getItem(L"Format");
     result[L"VersionStr"] = getItem(L"VersionStr");
     result[L"VersionNum"] = getItem(L"VersionNum");
     result[L"Encrypted"] = getItem(L"Encrypted");
-
-    pFileInfo->Release();
     return result;
 }
 
@@ -1284,180 +1163,140 @@ std::map<std::wstring, std::wstring> HwpWrapper::GetFileInfo(const std::wstring&
 
 bool HwpWrapper::InsertText(const std::wstring& text)
 {
+    CPYHWPX_TRACE_METHOD();
+    return InsertTextBstr(BstrString::FromUtf16(text.data(), text.size()));
+}
+
+bool HwpWrapper::InsertTextBstr(const BstrString& text)
+{
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnInsertText(text.str());
+    }
 
     // pyhwpx 방식: HParameterSet.HInsertText + HAction.Execute 사용
     // 이 방식이 직접 InsertText 호출보다 더 안정적임
+    static const BSTR s_hInsertText = InternBstr(L"HInsertText");
+    static const BSTR s_hSet = InternBstr(L"HSet");
+    static const BSTR s_getDefault = InternBstr(L"GetDefault");
+    static const BSTR s_text = InternBstr(L"Text");
+    static const BSTR s_execute = InternBstr(L"Execute");
+    static const BSTR s_insertText = InternBstr(L"InsertText");
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
-
-    // 1. HParameterSet 속성 가져오기
-    OLECHAR* psetName = const_cast<OLECHAR*>(L"HParameterSet");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &psetName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return false;
-
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                        &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
 
-    IDispatch* pHParameterSet = result.pdispVal;
+    // 1. HParameterSet 가져오기 (캐시됨, Release 불필요)
+    IDispatch* pHParameterSet = GetHParameterSet();
+    if (!pHParameterSet) return false;
 
     // 2. HInsertText 속성 가져오기
-    OLECHAR* insertTextName = const_cast<OLECHAR*>(L"HInsertText");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &insertTextName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHParameterSet->Release();
-        return false;
-    }
+    OLECHAR* insertTextName = s_hInsertText;
+    hr = ComGetIDsOfNames(pHParameterSet, &insertTextName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    pHParameterSet->Release();
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    ScopedVariant insertText;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, insertText.Receive(), NULL, NULL);
+    if (FAILED(hr) || insertText.vt() != VT_DISPATCH || !insertText.get().pdispVal) return false;
 
-    IDispatch* pHInsertText = result.pdispVal;
+    IDispatch* pHInsertText = insertText.get().pdispVal;
 
     // 3. HSet 속성 가져오기
-    OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHInsertText->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHInsertText->Release();
-        return false;
-    }
+    OLECHAR* hsetName = s_hSet;
+    hr = ComGetIDsOfNames(pHInsertText, &hsetName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHInsertText->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                               &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
-        pHInsertText->Release();
-        return false;
-    }
+    ScopedVariant hset;
+    hr = ComInvoke(pHInsertText, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, hset.Receive(), NULL, NULL);
+    if (FAILED(hr) || hset.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = hset.get().pdispVal;
 
     // 4. HAction 가져오기
     IDispatch* pHAction = GetHAction();
-    if (!pHAction) {
-        pHSet->Release();
-        pHInsertText->Release();
-        return false;
-    }
+    if (!pHAction) return false;
 
     // 5. HAction.GetDefault("InsertText", HSet) 호출
-    OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHSet->Release();
-        pHInsertText->Release();
-        return false;
-    }
+    OLECHAR* getDefaultName = s_getDefault;
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    VARIANT getDefaultArgs[2];
-    VariantInit(&getDefaultArgs[0]);
-    VariantInit(&getDefaultArgs[1]);
-    getDefaultArgs[0].vt = VT_DISPATCH;
-    getDefaultArgs[0].pdispVal = pHSet;
-    getDefaultArgs[1].vt = VT_BSTR;
-    getDefaultArgs[1].bstrVal = SysAllocString(L"InsertText");
+    VARIANT actionArgs[2] = { DispatchArg(pHSet), BstrArg(s_insertText) };
 
-    DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &getDefaultParams, &result, NULL, NULL);
-    SysFreeString(getDefaultArgs[1].bstrVal);
+    DISPPARAMS getDefaultParams = { actionArgs, NULL, 2, 0 };
+    ScopedVariant result;
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &getDefaultParams, result.Receive(), NULL, NULL);
 
     // 6. HInsertText.Text = text 설정
-    OLECHAR* textPropName = const_cast<OLECHAR*>(L"Text");
-    hr = pHInsertText->GetIDsOfNames(IID_NULL, &textPropName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHSet->Release();
-        pHInsertText->Release();
-        return false;
-    }
+    OLECHAR* textPropName = s_text;
+    hr = ComGetIDsOfNames(pHInsertText, &textPropName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    VARIANT textVal;
-    VariantInit(&textVal);
-    textVal.vt = VT_BSTR;
-    textVal.bstrVal = SysAllocString(text.c_str());
+    // 호출자가 할당한 BSTR을 그대로 전달 (추가 복사 없음)
+    VARIANT textVal = BstrArg(text.bstr());
 
     DISPID putid = DISPID_PROPERTYPUT;
     DISPPARAMS textParams = { &textVal, &putid, 1, 1 };
-    hr = pHInsertText->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &textParams, NULL, NULL, NULL);
-    SysFreeString(textVal.bstrVal);
-
-    if (FAILED(hr)) {
-        pHSet->Release();
-        pHInsertText->Release();
-        return false;
-    }
+    hr = ComInvoke(pHInsertText, dispid, DISPATCH_PROPERTYPUT,
+                   &textParams, NULL, NULL, NULL);
+    if (FAILED(hr)) return false;
 
     // 7. HAction.Execute("InsertText", HSet) 호출
-    OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pHSet->Release();
-        pHInsertText->Release();
-        return false;
-    }
-
-    VARIANT executeArgs[2];
-    VariantInit(&executeArgs[0]);
-    VariantInit(&executeArgs[1]);
-    executeArgs[0].vt = VT_DISPATCH;
-    executeArgs[0].pdispVal = pHSet;
-    executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"InsertText");
-
-    DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    OLECHAR* executeName = s_execute;
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
+    if (FAILED(hr)) return false;
 
-    pHSet->Release();
-    pHInsertText->Release();
+    DISPPARAMS executeParams = { actionArgs, NULL, 2, 0 };
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
+    return (result.vt() == VT_BOOL) ? result.ToBool() : true;
 }
 
 std::tuple<int, std::wstring> HwpWrapper::GetText()
 {
-    if (!m_pHwp) return std::make_tuple(-1, L"");
+    CPYHWPX_TRACE_METHOD();
+    auto result = GetTextBstr();
+    return std::make_tuple(std::get<0>(result), std::get<1>(result).str());
+}
+
+std::tuple<int, BstrString> HwpWrapper::GetTextBstr()
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return std::make_tuple(-1, BstrString());
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"GetText");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return std::make_tuple(-1, L"");
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
+    if (FAILED(hr)) return std::make_tuple(-1, BstrString());
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, &result, NULL, NULL);
 
-    if (FAILED(hr)) return std::make_tuple(-1, L"");
+    if (FAILED(hr)) return std::make_tuple(-1, BstrString());
 
     // GetText는 (상태, 텍스트) 튜플 반환
-    // COM에서는 SAFEARRAY로 반환될 수 있음
-    if (result.vt == VT_BSTR) {
-        std::wstring text(result.bstrVal ? result.bstrVal : L"");
-        SysFreeString(result.bstrVal);
-        return std::make_tuple(0, text);
-    }
-
-    return std::make_tuple(-1, L"");
+    // COM에서는 SAFEARRAY로 반환될 수 있음 (BSTR이 아니면 FromVariant가 해제)
+    int state = (result.vt == VT_BSTR) ? 0 : -1;
+    return std::make_tuple(state, BstrString::FromVariant(result));
 }
 
 std::wstring HwpWrapper::GetSelectedText(bool keep_select)
 {
+    CPYHWPX_TRACE_METHOD();
     // 현재 선택 영역의 텍스트 반환
     // HAction.GetSelectedText() 호출
     if (!m_pHwp) return L"";
@@ -1472,23 +1311,23 @@ std::wstring HwpWrapper::GetSelectedText(bool keep_select)
 
 HwpPos HwpWrapper::GetPos()
 {
+    CPYHWPX_TRACE_METHOD();
     HwpPos pos = { 0, 0, 0 };
     if (!m_pHwp) return pos;
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"GetPos");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return pos;
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    if (SUCCEEDED(hr) && result.vt == (VT_ARRAY | VT_VARIANT)) {
-        SAFEARRAY* psa = result.parray;
+    if (SUCCEEDED(hr) && result.vt() == (VT_ARRAY | VT_VARIANT)) {
+        SAFEARRAY* psa = result.get().parray;
         VARIANT* pData;
         SafeArrayAccessData(psa, (void**)&pData);
 
@@ -1499,17 +1338,23 @@ HwpPos HwpWrapper::GetPos()
         SafeArrayUnaccessData(psa);
     }
 
-    VariantClear(&result);
     return pos;
 }
 
 bool HwpWrapper::SetPos(int list, int para, int pos)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Caret);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnSetPos(list, para, pos);
+    }
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"SetPos");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return false;
 
     VARIANT args[3];
@@ -1528,8 +1373,8 @@ bool HwpWrapper::SetPos(int list, int para, int pos)
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, &result, NULL, NULL);
 
     if (FAILED(hr)) return false;
     return true;
@@ -1537,11 +1382,18 @@ bool HwpWrapper::SetPos(int list, int para, int pos)
 
 bool HwpWrapper::MovePos(int move_id, int para, int pos)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Caret);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnMovePos(move_id, para, pos);
+    }
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"MovePos");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return false;
 
     VARIANT args[3];
@@ -1560,8 +1412,8 @@ bool HwpWrapper::MovePos(int move_id, int para, int pos)
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, &result, NULL, NULL);
 
     if (FAILED(hr)) return false;
     return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
@@ -1569,11 +1421,12 @@ bool HwpWrapper::MovePos(int move_id, int para, int pos)
 
 bool HwpWrapper::InitScan(int option, int range, int spara, int spos, int epara, int epos)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"InitScan");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return false;
 
     // 파라미터 순서: epos, epara, spos, spara, range, option (역순)
@@ -1591,8 +1444,8 @@ bool HwpWrapper::InitScan(int option, int range, int spara, int spos, int epara,
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, &result, NULL, NULL);
 
     if (FAILED(hr)) return false;
     return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
@@ -1600,32 +1453,33 @@ bool HwpWrapper::InitScan(int option, int range, int spara, int spos, int epara,
 
 void HwpWrapper::ReleaseScan()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return;
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"ReleaseScan");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return;
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                   &params, &result, NULL, NULL);
-    VariantClear(&result);
+    ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+              &params, result.Receive(), NULL, NULL);
 }
 
 bool HwpWrapper::SelectText(int spara, int spos, int epara, int epos, int slist)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Caret);
 
     // 먼저 set_pos로 리스트 설정
     SetPos(slist, 0, 0);
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"SelectText");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return false;
 
     // 파라미터 순서: epos, epara, spos, spara (역순)
@@ -1638,18 +1492,19 @@ bool HwpWrapper::SelectText(int spara, int spos, int epara, int epos, int slist)
     args[3].vt = VT_I4; args[3].lVal = spara;
 
     DISPPARAMS params = { args, NULL, 4, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
+    return (result.vt() == VT_BOOL) ? result.ToBool() : true;
 }
 
 bool HwpWrapper::SelectTextByGetPos(const HwpPos& s_pos, const HwpPos& e_pos)
 {
+    CPYHWPX_TRACE_METHOD();
+    m_edits.Note(EditKind::Caret);
     // set_pos로 리스트 설정 후 SelectText 호출
     SetPos(s_pos.list, 0, 0);
     return SelectText(s_pos.para, s_pos.pos, e_pos.para, e_pos.pos, s_pos.list);
@@ -1657,35 +1512,33 @@ bool HwpWrapper::SelectTextByGetPos(const HwpPos& s_pos, const HwpPos& e_pos)
 
 IDispatch* HwpWrapper::GetPosBySet()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"GetPosBySet");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return nullptr;
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
-
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
-        VariantClear(&result);
-        return nullptr;
-    }
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    return result.pdispVal;
+    if (FAILED(hr)) return nullptr;
+    return result.DetachDispatch();
 }
 
 bool HwpWrapper::SetPosBySet(IDispatch* pDispVal)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || !pDispVal) return false;
+    m_edits.Note(EditKind::Caret);
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"SetPosBySet");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return false;
 
     VARIANT arg;
@@ -1694,18 +1547,17 @@ bool HwpWrapper::SetPosBySet(IDispatch* pDispVal)
     arg.pdispVal = pDispVal;
 
     DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    VariantClear(&result);
     return SUCCEEDED(hr);
 }
 
 int HwpWrapper::GetPosBySetPy()
 {
+    CPYHWPX_TRACE_METHOD();
     IDispatch* pPos = GetPosBySet();
     if (!pPos) return -1;
 
@@ -1715,12 +1567,14 @@ int HwpWrapper::GetPosBySetPy()
 
 bool HwpWrapper::SetPosBySetPy(int idx)
 {
+    CPYHWPX_TRACE_METHOD();
     if (idx < 0 || idx >= static_cast<int>(m_posCache.size())) return false;
     return SetPosBySet(m_posCache[idx]);
 }
 
 void HwpWrapper::ClearPosCache()
 {
+    CPYHWPX_TRACE_METHOD();
     for (auto p : m_posCache) {
         if (p) p->Release();
     }
@@ -1733,54 +1587,40 @@ void HwpWrapper::ClearPosCache()
 
 void HwpWrapper::SetVisible(bool visible)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return;
 
     // pyhwpx 방식: XHwpWindows.Active_XHwpWindow.Visible = visible
 
     // 1. XHwpWindows 속성 획득
-    VARIANT xhwpWindowsVar = GetProperty(L"XHwpWindows");
-    if (xhwpWindowsVar.vt != VT_DISPATCH || !xhwpWindowsVar.pdispVal) {
-        VariantClear(&xhwpWindowsVar);
-        return;
-    }
+    ScopedVariant xhwpWindowsVar(GetProperty(L"XHwpWindows"));
+    if (xhwpWindowsVar.vt() != VT_DISPATCH || !xhwpWindowsVar.get().pdispVal) return;
 
-    IDispatch* pXHwpWindows = xhwpWindowsVar.pdispVal;
+    IDispatch* pXHwpWindows = xhwpWindowsVar.get().pdispVal;
 
     // 2. Active_XHwpWindow 속성 획득 (또는 Active)
     DISPID dispidActive;
     OLECHAR* activeName = const_cast<OLECHAR*>(L"Active_XHwpWindow");
-    HRESULT hr = pXHwpWindows->GetIDsOfNames(IID_NULL, &activeName, 1,
-                                              LOCALE_USER_DEFAULT, &dispidActive);
+    HRESULT hr = ComGetIDsOfNames(pXHwpWindows, &activeName, 1, &dispidActive);
     if (FAILED(hr)) {
         // 대체: "Active" 시도
         activeName = const_cast<OLECHAR*>(L"Active");
-        hr = pXHwpWindows->GetIDsOfNames(IID_NULL, &activeName, 1,
-                                          LOCALE_USER_DEFAULT, &dispidActive);
-    }
-    if (FAILED(hr)) {
-        pXHwpWindows->Release();
-        return;
+        hr = ComGetIDsOfNames(pXHwpWindows, &activeName, 1, &dispidActive);
     }
+    if (FAILED(hr)) return;
 
     DISPPARAMS paramsEmpty = { NULL, NULL, 0, 0 };
-    VARIANT activeWindowVar;
-    VariantInit(&activeWindowVar);
-    hr = pXHwpWindows->Invoke(dispidActive, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_PROPERTYGET, &paramsEmpty, &activeWindowVar, NULL, NULL);
-
-    if (FAILED(hr) || activeWindowVar.vt != VT_DISPATCH || !activeWindowVar.pdispVal) {
-        VariantClear(&activeWindowVar);
-        pXHwpWindows->Release();
-        return;
-    }
+    ScopedVariant activeWindowVar;
+    hr = ComInvoke(pXHwpWindows, dispidActive, DISPATCH_PROPERTYGET, &paramsEmpty,
+                   activeWindowVar.Receive(), NULL, NULL);
+    if (FAILED(hr) || activeWindowVar.vt() != VT_DISPATCH || !activeWindowVar.get().pdispVal) return;
 
-    IDispatch* pActiveWindow = activeWindowVar.pdispVal;
+    IDispatch* pActiveWindow = activeWindowVar.get().pdispVal;
 
     // 3. Visible 속성 설정
     DISPID dispidVisible;
     OLECHAR* visibleName = const_cast<OLECHAR*>(L"Visible");
-    hr = pActiveWindow->GetIDsOfNames(IID_NULL, &visibleName, 1,
-                                       LOCALE_USER_DEFAULT, &dispidVisible);
+    hr = ComGetIDsOfNames(pActiveWindow, &visibleName, 1, &dispidVisible);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
@@ -1789,12 +1629,12 @@ void HwpWrapper::SetVisible(bool visible)
 
         DISPID putid = DISPID_PROPERTYPUT;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pActiveWindow->Invoke(dispidVisible, IID_NULL, LOCALE_USER_DEFAULT,
-                              DISPATCH_PROPERTYPUT, &params, NULL, NULL, NULL);
+        ComInvoke(pActiveWindow, dispidVisible, DISPATCH_PROPERTYPUT, &params, NULL, NULL, NULL);
     }
 
     m_bVisible = visible;
 
+#if defined(_WIN32)
     // 4. visible=true일 때 추가 처리: WindowHandle로 ShowWindow 호출
     if (visible) {
         HWND hwnd = GetActiveWindowHandle(pActiveWindow);
@@ -1803,19 +1643,19 @@ void HwpWrapper::SetVisible(bool visible)
             ShowWindow(hwnd, SW_MAXIMIZE);  // SW_MAXIMIZE = 3
         }
     }
-
-    pActiveWindow->Release();
-    pXHwpWindows->Release();
+#endif
 }
 
 void HwpWrapper::MaximizeWindow()
 {
+    CPYHWPX_TRACE_METHOD();
     // HAction.Run("WindowMaximize")
     RunAction(L"WindowMaximize");
 }
 
 void HwpWrapper::MinimizeWindow()
 {
+    CPYHWPX_TRACE_METHOD();
     // HAction.Run("WindowMinimize")
     RunAction(L"WindowMinimize");
 }
@@ -1827,89 +1667,110 @@ HWND HwpWrapper::GetActiveWindowHandle(IDispatch* pActiveWindow)
     // WindowHandle 속성 조회
     DISPID dispidHandle;
     OLECHAR* handleName = const_cast<OLECHAR*>(L"WindowHandle");
-    HRESULT hr = pActiveWindow->GetIDsOfNames(IID_NULL, &handleName, 1,
-                                               LOCALE_USER_DEFAULT, &dispidHandle);
+    HRESULT hr = ComGetIDsOfNames(pActiveWindow, &handleName, 1, &dispidHandle);
     if (FAILED(hr)) return NULL;
 
     DISPPARAMS paramsEmpty = { NULL, NULL, 0, 0 };
-    VARIANT handleResult;
-    VariantInit(&handleResult);
-    hr = pActiveWindow->Invoke(dispidHandle, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_PROPERTYGET, &paramsEmpty, &handleResult, NULL, NULL);
+    ScopedVariant handleResult;
+    hr = ComInvoke(pActiveWindow, dispidHandle, DISPATCH_PROPERTYGET, &paramsEmpty,
+                   handleResult.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return NULL;
 
-    HWND hwnd = NULL;
-    if (handleResult.vt == VT_I4) {
-        hwnd = (HWND)(intptr_t)handleResult.lVal;
-    } else if (handleResult.vt == VT_I8) {
-        hwnd = (HWND)(intptr_t)handleResult.llVal;
-    } else if (handleResult.vt == VT_INT || handleResult.vt == VT_UINT) {
-        hwnd = (HWND)(intptr_t)handleResult.intVal;
+    const VARIANT& handle = handleResult.get();
+    if (handle.vt == VT_I4) {
+        return (HWND)(intptr_t)handle.lVal;
+    } else if (handle.vt == VT_I8) {
+        return (HWND)(intptr_t)handle.llVal;
+    } else if (handle.vt == VT_INT || handle.vt == VT_UINT) {
+        return (HWND)(intptr_t)handle.intVal;
     }
-
-    VariantClear(&handleResult);
-    return hwnd;
+    return NULL;
 }
 
 HWND HwpWrapper::GetHwnd()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return NULL;
 
     // XHwpWindows.Active_XHwpWindow.WindowHandle 방식 (pyhwpx와 동일)
 
     // 1. XHwpWindows 속성 획득
-    VARIANT xhwpWindowsVar = GetProperty(L"XHwpWindows");
-    if (xhwpWindowsVar.vt != VT_DISPATCH || !xhwpWindowsVar.pdispVal) {
-        VariantClear(&xhwpWindowsVar);
-        return NULL;
-    }
+    ScopedVariant xhwpWindowsVar(GetProperty(L"XHwpWindows"));
+    if (xhwpWindowsVar.vt() != VT_DISPATCH || !xhwpWindowsVar.get().pdispVal) return NULL;
 
-    IDispatch* pXHwpWindows = xhwpWindowsVar.pdispVal;
+    IDispatch* pXHwpWindows = xhwpWindowsVar.get().pdispVal;
 
     // 2. Active_XHwpWindow 속성 획득
     DISPID dispidActive;
     OLECHAR* activeName = const_cast<OLECHAR*>(L"Active_XHwpWindow");
-    HRESULT hr = pXHwpWindows->GetIDsOfNames(IID_NULL, &activeName, 1,
-                                              LOCALE_USER_DEFAULT, &dispidActive);
+    HRESULT hr = ComGetIDsOfNames(pXHwpWindows, &activeName, 1, &dispidActive);
     if (FAILED(hr)) {
         // 대체: "Active" 시도
         activeName = const_cast<OLECHAR*>(L"Active");
-        hr = pXHwpWindows->GetIDsOfNames(IID_NULL, &activeName, 1,
-                                          LOCALE_USER_DEFAULT, &dispidActive);
-    }
-    if (FAILED(hr)) {
-        pXHwpWindows->Release();
-        return NULL;
+        hr = ComGetIDsOfNames(pXHwpWindows, &activeName, 1, &dispidActive);
     }
+    if (FAILED(hr)) return NULL;
 
     DISPPARAMS paramsEmpty = { NULL, NULL, 0, 0 };
-    VARIANT activeWindowVar;
-    VariantInit(&activeWindowVar);
-    hr = pXHwpWindows->Invoke(dispidActive, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_PROPERTYGET, &paramsEmpty, &activeWindowVar, NULL, NULL);
+    ScopedVariant activeWindowVar;
+    hr = ComInvoke(pXHwpWindows, dispidActive, DISPATCH_PROPERTYGET, &paramsEmpty,
+                   activeWindowVar.Receive(), NULL, NULL);
+    if (FAILED(hr) || activeWindowVar.vt() != VT_DISPATCH || !activeWindowVar.get().pdispVal) return NULL;
 
-    if (FAILED(hr) || activeWindowVar.vt != VT_DISPATCH || !activeWindowVar.pdispVal) {
-        VariantClear(&activeWindowVar);
-        pXHwpWindows->Release();
-        return NULL;
-    }
-
-    IDispatch* pActiveWindow = activeWindowVar.pdispVal;
+    IDispatch* pActiveWindow = activeWindowVar.get().pdispVal;
 
     // 3. WindowHandle 획득
-    HWND hwnd = GetActiveWindowHandle(pActiveWindow);
+    return GetActiveWindowHandle(pActiveWindow);
+}
 
-    pActiveWindow->Release();
-    pXHwpWindows->Release();
+uint32_t HwpWrapper::GetProcessId()
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return 0;
+
+#if defined(_WIN32)
+    HWND hwnd = GetHwnd();
+    if (!hwnd) return 0;
+
+    DWORD processId = 0;
+    GetWindowThreadProcessId(hwnd, &processId);
+    return processId;
+#else
+    return 0;
+#endif
+}
+
+size_t HwpWrapper::GetProcessMemory()
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return 0;
+
+#if defined(_WIN32)
+    DWORD processId = GetProcessId();
+    if (processId == 0) return 0;
 
-    return hwnd;
+    HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, processId);
+    if (!process) return 0;
+
+    PROCESS_MEMORY_COUNTERS counters = {};
+    size_t workingSet = 0;
+    if (GetProcessMemoryInfo(process, &counters, sizeof(counters))) {
+        workingSet = counters.WorkingSetSize;
+    }
+    CloseHandle(process);
+    return workingSet;
+#else
+    return 0;
+#endif
 }
 
 bool HwpWrapper::ActivateOleObject()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
+#if defined(_WIN32)
     IOleObject* pOleObject = nullptr;
     HRESULT hr = m_pHwp->QueryInterface(IID_IOleObject, (void**)&pOleObject);
     if (SUCCEEDED(hr) && pOleObject) {
@@ -1918,11 +1779,14 @@ bool HwpWrapper::ActivateOleObject()
         pOleObject->Release();
         return SUCCEEDED(hr);
     }
+#endif
     return false;
 }
 
 void HwpWrapper::ShowWindowWithForeground(HWND hwnd)
 {
+    CPYHWPX_TRACE_METHOD();
+#if defined(_WIN32)
     if (!hwnd || !IsWindow(hwnd)) return;
 
     // 1. 창이 최소화되어 있으면 복원
@@ -1961,10 +1825,14 @@ void HwpWrapper::ShowWindowWithForeground(HWND hwnd)
     // 5. Z-order 최상위로 이동
     SetWindowPos(hwnd, HWND_TOP, 0, 0, 0, 0,
                  SWP_NOMOVE | SWP_NOSIZE | SWP_SHOWWINDOW);
+#else
+    (void)hwnd;
+#endif
 }
 
 bool HwpWrapper::SetViewState(int flag)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
     VARIANT val;
@@ -1977,9 +1845,10 @@ bool HwpWrapper::SetViewState(int flag)
 
 int HwpWrapper::GetViewState()
 {
-    VARIANT result = GetProperty(L"ViewProperties");
-    if (result.vt == VT_I4) {
-        return result.lVal;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"ViewProperties"));
+    if (result.vt() == VT_I4) {
+        return result.get().lVal;
     }
     return 0;
 }
@@ -1990,13 +1859,15 @@ int HwpWrapper::GetViewState()
 
 int HwpWrapper::MsgBox(const std::wstring& message, int flag)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return -1;
 
     DISPID dispid;
     OLECHAR* name = const_cast<OLECHAR*>(L"MsgBox");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &name, 1, &dispid);
     if (FAILED(hr)) return -1;
 
+    ScopedBstr messageBstr(message);
     VARIANT args[2];
     VariantInit(&args[0]);
     VariantInit(&args[1]);
@@ -2004,16 +1875,14 @@ int HwpWrapper::MsgBox(const std::wstring& message, int flag)
     args[0].vt = VT_I4;
     args[0].lVal = flag;
     args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(message.c_str());
+    args[1].bstrVal = messageBstr.get();
 
     DISPPARAMS params = { args, NULL, 2, 0 };
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
-
-    SysFreeString(args[1].bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, &result, NULL, NULL);
 
     if (FAILED(hr)) return -1;
     return (result.vt == VT_I4) ? result.lVal : -1;
@@ -2021,15 +1890,14 @@ int HwpWrapper::MsgBox(const std::wstring& message, int flag)
 
 int HwpWrapper::GetMessageBoxMode()
 {
-    VARIANT result = GetProperty(L"MessageBoxMode");
-    if (result.vt == VT_I4) {
-        return result.lVal;
-    }
-    return 0;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"MessageBoxMode"));
+    return (result.vt() == VT_I4) ? result.get().lVal : 0;
 }
 
 int HwpWrapper::SetMessageBoxMode(int mode)
 {
+    CPYHWPX_TRACE_METHOD();
     int old_mode = GetMessageBoxMode();
 
     VARIANT val;
@@ -2047,29 +1915,31 @@ int HwpWrapper::SetMessageBoxMode(int mode)
 
 bool HwpWrapper::IsEmpty()
 {
-    VARIANT result = GetProperty(L"IsEmpty");
-    if (result.vt == VT_BOOL) {
-        return result.boolVal != VARIANT_FALSE;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"IsEmpty"));
+    if (result.vt() == VT_BOOL) {
+        return result.ToBool();
     }
     return true;
 }
 
 bool HwpWrapper::IsModified()
 {
-    VARIANT result = GetProperty(L"IsModified");
-    if (result.vt == VT_BOOL) {
-        return result.boolVal != VARIANT_FALSE;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"IsModified"));
+    if (result.vt() == VT_BOOL) {
+        return result.ToBool();
     }
     return false;
 }
 
 bool HwpWrapper::IsCell()
 {
+    CPYHWPX_TRACE_METHOD();
     // 현재 커서가 표 셀 안에 있는지 확인
-    VARIANT result = GetProperty(L"ParentCtrl");
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
+    ScopedVariant result(GetProperty(L"ParentCtrl"));
+    if (result.vt() == VT_DISPATCH && result.get().pdispVal) {
         // ParentCtrl이 존재하면 셀 내부
-        result.pdispVal->Release();
         return true;
     }
     return false;
@@ -2085,12 +1955,18 @@ bool HwpWrapper::Find(const std::wstring& text,
                        bool regex,
                        bool replace_mode)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || text.empty()) return false;
+    m_edits.Note(EditKind::Caret);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"Find");
+    }
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
     // 1. HParameterSet 속성 가져오기
     IDispatch* pHParameterSet = GetHParameterSet();
@@ -2098,34 +1974,32 @@ bool HwpWrapper::Find(const std::wstring& text,
 
     // 2. HFindReplace 속성 가져오기
     OLECHAR* findReplaceName = const_cast<OLECHAR*>(L"HFindReplace");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &findReplaceName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHParameterSet, &findReplaceName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pHFindReplace = result.pdispVal;
+    IDispatch* pHFindReplace = result.DetachDispatch();
 
     // 3. HSet 속성 가져오기
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &hsetName, 1, &dispid);
     if (FAILED(hr)) {
         pHFindReplace->Release();
         return false;
     }
 
-    VariantInit(&result);
-    hr = pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
+    hr = ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) {
         pHFindReplace->Release();
         return false;
     }
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = result.DetachDispatch();
 
     // 4. HAction 가져오기
     IDispatch* pHAction = GetHAction();
@@ -2137,21 +2011,20 @@ bool HwpWrapper::Find(const std::wstring& text,
 
     // 5. HAction.GetDefault("FindDlg", HSet) 호출하여 초기화
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (SUCCEEDED(hr)) {
+        static const BSTR s_findDlg = InternBstr(L"FindDlg");
         VARIANT getDefaultArgs[2];
         VariantInit(&getDefaultArgs[0]);
         VariantInit(&getDefaultArgs[1]);
         getDefaultArgs[0].vt = VT_DISPATCH;
         getDefaultArgs[0].pdispVal = pHSet;
         getDefaultArgs[1].vt = VT_BSTR;
-        getDefaultArgs[1].bstrVal = SysAllocString(L"FindDlg");
+        getDefaultArgs[1].bstrVal = s_findDlg;
 
         DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                         &getDefaultParams, &result, NULL, NULL);
-        SysFreeString(getDefaultArgs[1].bstrVal);
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &getDefaultParams, result.Receive(), NULL, NULL);
     }
 
     // 6. 파라미터 설정
@@ -2159,110 +2032,109 @@ bool HwpWrapper::Find(const std::wstring& text,
 
     // FindString 설정
     OLECHAR* findStringName = const_cast<OLECHAR*>(L"FindString");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &findStringName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &findStringName, 1, &dispid);
     if (SUCCEEDED(hr)) {
+        ScopedBstr textBstr(text);
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_BSTR;
-        val.bstrVal = SysAllocString(text.c_str());
+        val.bstrVal = textBstr.get();
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
-        SysFreeString(val.bstrVal);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // MatchCase 설정
     OLECHAR* matchCaseName = const_cast<OLECHAR*>(L"MatchCase");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &matchCaseName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &matchCaseName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = match_case ? 1 : 0;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // FindRegExp 설정 (정규식)
     OLECHAR* findRegExpName = const_cast<OLECHAR*>(L"FindRegExp");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &findRegExpName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &findRegExpName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = regex ? 1 : 0;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // Direction 설정 (0=Forward, 1=Backward)
     OLECHAR* directionName = const_cast<OLECHAR*>(L"Direction");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &directionName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &directionName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = forward ? 0 : 1;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // IgnoreMessage 설정 (메시지 무시)
     OLECHAR* ignoreMsgName = const_cast<OLECHAR*>(L"IgnoreMessage");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &ignoreMsgName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &ignoreMsgName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = 1;  // 메시지 무시
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // ReplaceMode 설정
     OLECHAR* replaceModeName = const_cast<OLECHAR*>(L"ReplaceMode");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &replaceModeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &replaceModeName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = replace_mode ? 1 : 0;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // 7. HAction.Execute("RepeatFind", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pHFindReplace->Release();
         return false;
     }
 
+    static const BSTR s_repeatFind = InternBstr(L"RepeatFind");
     VARIANT executeArgs[2];
     VariantInit(&executeArgs[0]);
     VariantInit(&executeArgs[1]);
     executeArgs[0].vt = VT_DISPATCH;
     executeArgs[0].pdispVal = pHSet;
     executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"RepeatFind");
+    executeArgs[1].bstrVal = s_repeatFind;
 
     DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
     pHSet->Release();
     pHFindReplace->Release();
 
-    return SUCCEEDED(hr) && (result.vt == VT_BOOL ? result.boolVal != VARIANT_FALSE : true);
+    return SUCCEEDED(hr) && (result.vt() == VT_BOOL ? result.ToBool() : true);
 }
 
 bool HwpWrapper::Replace(const std::wstring& find_text,
@@ -2271,12 +2143,18 @@ bool HwpWrapper::Replace(const std::wstring& find_text,
                           bool match_case,
                           bool regex)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"Replace");
+    }
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
     // 1. HParameterSet 속성 가져오기
     IDispatch* pHParameterSet = GetHParameterSet();
@@ -2284,34 +2162,32 @@ bool HwpWrapper::Replace(const std::wstring& find_text,
 
     // 2. HFindReplace 속성 가져오기
     OLECHAR* findReplaceName = const_cast<OLECHAR*>(L"HFindReplace");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &findReplaceName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHParameterSet, &findReplaceName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pHFindReplace = result.pdispVal;
+    IDispatch* pHFindReplace = result.DetachDispatch();
 
     // 3. HSet 속성 가져오기
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &hsetName, 1, &dispid);
     if (FAILED(hr)) {
         pHFindReplace->Release();
         return false;
     }
 
-    VariantInit(&result);
-    hr = pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
+    hr = ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) {
         pHFindReplace->Release();
         return false;
     }
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = result.DetachDispatch();
 
     // 4. HAction 가져오기
     IDispatch* pHAction = GetHAction();
@@ -2323,21 +2199,20 @@ bool HwpWrapper::Replace(const std::wstring& find_text,
 
     // 5. HAction.GetDefault("FindDlg", HSet) 호출하여 초기화
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (SUCCEEDED(hr)) {
+        static const BSTR s_findDlg = InternBstr(L"FindDlg");
         VARIANT getDefaultArgs[2];
         VariantInit(&getDefaultArgs[0]);
         VariantInit(&getDefaultArgs[1]);
         getDefaultArgs[0].vt = VT_DISPATCH;
         getDefaultArgs[0].pdispVal = pHSet;
         getDefaultArgs[1].vt = VT_BSTR;
-        getDefaultArgs[1].bstrVal = SysAllocString(L"FindDlg");
+        getDefaultArgs[1].bstrVal = s_findDlg;
 
         DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                         &getDefaultParams, &result, NULL, NULL);
-        SysFreeString(getDefaultArgs[1].bstrVal);
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &getDefaultParams, result.Receive(), NULL, NULL);
     }
 
     // 6. 파라미터 설정
@@ -2345,124 +2220,123 @@ bool HwpWrapper::Replace(const std::wstring& find_text,
 
     // FindString 설정
     OLECHAR* findStringName = const_cast<OLECHAR*>(L"FindString");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &findStringName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &findStringName, 1, &dispid);
     if (SUCCEEDED(hr)) {
+        ScopedBstr findTextBstr(find_text);
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_BSTR;
-        val.bstrVal = SysAllocString(find_text.c_str());
+        val.bstrVal = findTextBstr.get();
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
-        SysFreeString(val.bstrVal);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // ReplaceString 설정
     OLECHAR* replaceStringName = const_cast<OLECHAR*>(L"ReplaceString");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &replaceStringName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &replaceStringName, 1, &dispid);
     if (SUCCEEDED(hr)) {
+        ScopedBstr replaceTextBstr(replace_text);
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_BSTR;
-        val.bstrVal = SysAllocString(replace_text.c_str());
+        val.bstrVal = replaceTextBstr.get();
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
-        SysFreeString(val.bstrVal);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // MatchCase 설정
     OLECHAR* matchCaseName = const_cast<OLECHAR*>(L"MatchCase");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &matchCaseName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &matchCaseName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = match_case ? 1 : 0;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // FindRegExp 설정 (정규식)
     OLECHAR* findRegExpName = const_cast<OLECHAR*>(L"FindRegExp");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &findRegExpName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &findRegExpName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = regex ? 1 : 0;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // Direction 설정 (0=Forward, 1=Backward)
     OLECHAR* directionName = const_cast<OLECHAR*>(L"Direction");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &directionName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &directionName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = forward ? 0 : 1;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // IgnoreMessage 설정 (메시지 무시)
     OLECHAR* ignoreMsgName = const_cast<OLECHAR*>(L"IgnoreMessage");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &ignoreMsgName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &ignoreMsgName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = 1;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // ReplaceMode 설정
     OLECHAR* replaceModeName = const_cast<OLECHAR*>(L"ReplaceMode");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &replaceModeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &replaceModeName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = 1;  // 바꾸기 모드
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // 7. HAction.Execute("ExecReplace", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pHFindReplace->Release();
         return false;
     }
 
+    static const BSTR s_execReplace = InternBstr(L"ExecReplace");
     VARIANT executeArgs[2];
     VariantInit(&executeArgs[0]);
     VariantInit(&executeArgs[1]);
     executeArgs[0].vt = VT_DISPATCH;
     executeArgs[0].pdispVal = pHSet;
     executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"ExecReplace");
+    executeArgs[1].bstrVal = s_execReplace;
 
     DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
     pHSet->Release();
     pHFindReplace->Release();
 
-    return SUCCEEDED(hr) && (result.vt == VT_BOOL ? result.boolVal != VARIANT_FALSE : true);
+    return SUCCEEDED(hr) && (result.vt() == VT_BOOL ? result.ToBool() : true);
 }
 
 int HwpWrapper::ReplaceAll(const std::wstring& find_text,
@@ -2470,12 +2344,18 @@ int HwpWrapper::ReplaceAll(const std::wstring& find_text,
                             bool match_case,
                             bool regex)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || find_text.empty()) return 0;
+    m_edits.Note(EditKind::Content);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"ReplaceAll");
+    }
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
     // 1. HParameterSet 속성 가져오기
     IDispatch* pHParameterSet = GetHParameterSet();
@@ -2483,34 +2363,32 @@ int HwpWrapper::ReplaceAll(const std::wstring& find_text,
 
     // 2. HFindReplace 속성 가져오기
     OLECHAR* findReplaceName = const_cast<OLECHAR*>(L"HFindReplace");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &findReplaceName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHParameterSet, &findReplaceName, 1, &dispid);
     if (FAILED(hr)) return 0;
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return 0;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) return 0;
 
-    IDispatch* pHFindReplace = result.pdispVal;
+    IDispatch* pHFindReplace = result.DetachDispatch();
 
     // 3. HSet 속성 가져오기
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &hsetName, 1, &dispid);
     if (FAILED(hr)) {
         pHFindReplace->Release();
         return 0;
     }
 
-    VariantInit(&result);
-    hr = pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
+    hr = ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) {
         pHFindReplace->Release();
         return 0;
     }
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = result.DetachDispatch();
 
     // 4. HAction 가져오기
     IDispatch* pHAction = GetHAction();
@@ -2522,21 +2400,20 @@ int HwpWrapper::ReplaceAll(const std::wstring& find_text,
 
     // 5. HAction.GetDefault("FindDlg", HSet) 호출하여 초기화
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (SUCCEEDED(hr)) {
+        static const BSTR s_findDlg = InternBstr(L"FindDlg");
         VARIANT getDefaultArgs[2];
         VariantInit(&getDefaultArgs[0]);
         VariantInit(&getDefaultArgs[1]);
         getDefaultArgs[0].vt = VT_DISPATCH;
         getDefaultArgs[0].pdispVal = pHSet;
         getDefaultArgs[1].vt = VT_BSTR;
-        getDefaultArgs[1].bstrVal = SysAllocString(L"FindDlg");
+        getDefaultArgs[1].bstrVal = s_findDlg;
 
         DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                         &getDefaultParams, &result, NULL, NULL);
-        SysFreeString(getDefaultArgs[1].bstrVal);
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &getDefaultParams, result.Receive(), NULL, NULL);
     }
 
     // 6. 파라미터 설정
@@ -2544,125 +2421,121 @@ int HwpWrapper::ReplaceAll(const std::wstring& find_text,
 
     // FindString 설정
     OLECHAR* findStringName = const_cast<OLECHAR*>(L"FindString");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &findStringName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &findStringName, 1, &dispid);
     if (SUCCEEDED(hr)) {
+        ScopedBstr findTextBstr(find_text);
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_BSTR;
-        val.bstrVal = SysAllocString(find_text.c_str());
+        val.bstrVal = findTextBstr.get();
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
-        SysFreeString(val.bstrVal);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // ReplaceString 설정
     OLECHAR* replaceStringName = const_cast<OLECHAR*>(L"ReplaceString");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &replaceStringName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &replaceStringName, 1, &dispid);
     if (SUCCEEDED(hr)) {
+        ScopedBstr replaceTextBstr(replace_text);
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_BSTR;
-        val.bstrVal = SysAllocString(replace_text.c_str());
+        val.bstrVal = replaceTextBstr.get();
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
-        SysFreeString(val.bstrVal);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // MatchCase 설정
     OLECHAR* matchCaseName = const_cast<OLECHAR*>(L"MatchCase");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &matchCaseName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &matchCaseName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = match_case ? 1 : 0;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // FindRegExp 설정 (정규식)
     OLECHAR* findRegExpName = const_cast<OLECHAR*>(L"FindRegExp");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &findRegExpName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &findRegExpName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = regex ? 1 : 0;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // IgnoreMessage 설정 (메시지 무시)
     OLECHAR* ignoreMsgName = const_cast<OLECHAR*>(L"IgnoreMessage");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &ignoreMsgName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &ignoreMsgName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = 1;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // ReplaceMode 설정
     OLECHAR* replaceModeName = const_cast<OLECHAR*>(L"ReplaceMode");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &replaceModeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &replaceModeName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = 1;  // 바꾸기 모드
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // 7. HAction.Execute("AllReplace", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pHFindReplace->Release();
         return 0;
     }
 
+    static const BSTR s_allReplace = InternBstr(L"AllReplace");
     VARIANT executeArgs[2];
     VariantInit(&executeArgs[0]);
     VariantInit(&executeArgs[1]);
     executeArgs[0].vt = VT_DISPATCH;
     executeArgs[0].pdispVal = pHSet;
     executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"AllReplace");
+    executeArgs[1].bstrVal = s_allReplace;
 
     DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
     int replaceCount = 0;
     if (SUCCEEDED(hr)) {
         // 바꾼 개수 가져오기 (결과에서 또는 Count 속성에서)
-        if (result.vt == VT_I4) {
-            replaceCount = result.lVal;
-        } else if (result.vt == VT_BOOL && result.boolVal != VARIANT_FALSE) {
+        if (result.vt() == VT_I4) {
+            replaceCount = result.get().lVal;
+        } else if (result.vt() == VT_BOOL && result.ToBool()) {
             // 성공했지만 개수를 반환하지 않는 경우, Count 속성 확인
             OLECHAR* countName = const_cast<OLECHAR*>(L"Count");
             DISPID dispidCount;
-            if (SUCCEEDED(pHFindReplace->GetIDsOfNames(IID_NULL, &countName, 1,
-                                                        LOCALE_USER_DEFAULT, &dispidCount))) {
-                VARIANT countResult;
-                VariantInit(&countResult);
-                if (SUCCEEDED(pHFindReplace->Invoke(dispidCount, IID_NULL, LOCALE_USER_DEFAULT,
-                                                     DISPATCH_PROPERTYGET, &noParams,
-                                                     &countResult, NULL, NULL))) {
-                    if (countResult.vt == VT_I4) {
-                        replaceCount = countResult.lVal;
+            if (SUCCEEDED(ComGetIDsOfNames(pHFindReplace, &countName, 1, &dispidCount))) {
+                ScopedVariant countResult;
+                if (SUCCEEDED(ComInvoke(pHFindReplace, dispidCount, DISPATCH_PROPERTYGET, &noParams,
+                                        countResult.Receive(), NULL, NULL))) {
+                    if (countResult.vt() == VT_I4) {
+                        replaceCount = countResult.get().lVal;
                     }
                 }
             }
@@ -2683,113 +2556,152 @@ int HwpWrapper::ReplaceAll(const std::wstring& find_text,
 
 bool HwpWrapper::RunAction(const std::wstring& action_name)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
+    m_edits.NoteAction(action_name);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnRunAction(action_name);
+    }
+
     // HAction 객체 가져오기
     IDispatch* pHAction = GetHAction();
     if (!pHAction) return false;
 
     // Run 메서드 호출
+    static const BSTR s_run = InternBstr(L"Run");
     DISPID dispid;
-    OLECHAR* name = const_cast<OLECHAR*>(L"Run");
-    HRESULT hr = pHAction->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
+    OLECHAR* name = s_run;
+    HRESULT hr = ComGetIDsOfNames(pHAction, &name, 1, &dispid);
     if (FAILED(hr)) return false;
 
-    VARIANT args[1];
-    VariantInit(&args[0]);
-    args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(action_name.c_str());
+    ScopedBstr actionBstr(action_name);
+    VARIANT args[1] = { BstrArg(actionBstr.get()) };
 
     DISPPARAMS params = { args, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    SysFreeString(args[0].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
+    return (result.vt() == VT_BOOL) ? result.ToBool() : true;
 }
 
 IDispatch* HwpWrapper::CreateAction(const std::wstring& action_id)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    DISPID dispid;
-    OLECHAR* name = const_cast<OLECHAR*>(L"CreateAction");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return nullptr;
+    DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"CreateAction");
+    if (dispid == DISPID_UNKNOWN) return nullptr;
 
-    VARIANT args[1];
-    VariantInit(&args[0]);
-    args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(action_id.c_str());
+    ScopedBstr idBstr(action_id);
+    VARIANT args[1] = { BstrArg(idBstr.get()) };
 
     DISPPARAMS params = { args, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                           &params, result.Receive(), NULL, NULL);
 
-    SysFreeString(args[0].bstrVal);
-
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return nullptr;
-    return result.pdispVal;
+    if (FAILED(hr)) return nullptr;
+    return result.DetachDispatch();
 }
 
 IDispatch* HwpWrapper::CreateSet(const std::wstring& set_id)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    DISPID dispid;
-    OLECHAR* name = const_cast<OLECHAR*>(L"CreateSet");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &name, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return nullptr;
+    DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"CreateSet");
+    if (dispid == DISPID_UNKNOWN) return nullptr;
 
-    VARIANT args[1];
-    VariantInit(&args[0]);
-    args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(set_id.c_str());
+    ScopedBstr idBstr(set_id);
+    VARIANT args[1] = { BstrArg(idBstr.get()) };
 
     DISPPARAMS params = { args, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
+
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                           &params, result.Receive(), NULL, NULL);
+
+    if (FAILED(hr)) return nullptr;
+    return result.DetachDispatch();
+}
+
+IDispatch* HwpWrapper::AcquireSet(const std::wstring& set_id)
+{
+    if (!m_pHwp) return nullptr;
+
+    if (IDispatch* pset = m_setPool->Take(set_id)) {
+        return pset;
+    }
+    return CreateSet(set_id);
+}
+
+void HwpWrapper::ReleaseSet(const std::wstring& set_id, IDispatch* pset)
+{
+    m_setPool->Give(set_id, pset);
+}
+
+std::unique_ptr<HwpParameterSet> HwpWrapper::AcquireParameterSet(const std::wstring& set_id)
+{
+    IDispatch* pset = AcquireSet(set_id);
+    if (!pset) return nullptr;
+    return std::make_unique<HwpParameterSet>(pset, m_setPool, set_id);
+}
+
+void HwpWrapper::SetParameterSetPoolLimit(size_t max_per_id)
+{
+    m_setPool->SetMaxPerId(max_per_id);
+}
+
+void HwpWrapper::ClearParameterSetPool()
+{
+    m_setPool->Clear();
+}
+
+bool HwpWrapper::ExecuteSetItems(const std::wstring& action_name, const std::wstring& set_name,
+                                 const std::vector<std::pair<std::wstring, VARIANT>>& items)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return false;
+
+    return HwpActionHelper::RunWithSet(this, action_name, set_name, [&](IDispatch* pSet) {
+        HwpParameterSet(pSet, set_name).SetItems(items);
+    });
+}
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+std::vector<VARIANT> HwpWrapper::GetPropertySetItems(const std::wstring& property,
+                                                     const std::vector<std::wstring>& names)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return {};
 
-    SysFreeString(args[0].bstrVal);
+    ScopedVariant set(GetProperty(property));
+    if (set.vt() != VT_DISPATCH || !set.get().pdispVal) return {};
 
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return nullptr;
-    return result.pdispVal;
+    return HwpParameterSet(set.get().pdispVal).GetItems(names);
 }
 
 bool HwpWrapper::FindCtrl()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"FindCtrl");
     if (dispid == DISPID_UNKNOWN) return false;
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_METHOD, &params, &result, NULL, NULL);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, result.Receive(), NULL, NULL);
 
     // FindCtrl은 찾은 컨트롤 객체를 반환 (VT_DISPATCH면 성공)
-    bool success = SUCCEEDED(hr) && result.vt == VT_DISPATCH && result.pdispVal != nullptr;
-
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        result.pdispVal->Release();
-    }
-    VariantClear(&result);
-
-    return success;
+    return SUCCEEDED(hr) && result.vt() == VT_DISPATCH && result.get().pdispVal != nullptr;
 }
 
 //=============================================================================
@@ -2799,50 +2711,44 @@ bool HwpWrapper::FindCtrl()
 std::unique_ptr<HwpCtrl> HwpWrapper::InsertCtrl(const std::wstring& ctrl_id,
                                                   IDispatch* initparam)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
+    m_edits.Note(EditKind::Content);
 
     HRESULT hr;
     DISPID dispid;
 
     // 1. InsertCtrl 메서드의 DISPID 획득
     OLECHAR* methodName = const_cast<OLECHAR*>(L"InsertCtrl");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return nullptr;
 
     // 2. InsertCtrl(CtrlID, initparam) 호출
+    ScopedBstr ctrlIdBstr(ctrl_id);
     VARIANT args[2];
     VariantInit(&args[0]);
-    VariantInit(&args[1]);
 
     // 인자는 역순 (initparam, CtrlID)
     if (initparam) {
-        args[0].vt = VT_DISPATCH;
-        args[0].pdispVal = initparam;
+        args[0] = DispatchArg(initparam);
     } else {
         args[0].vt = VT_ERROR;
         args[0].scode = DISP_E_PARAMNOTFOUND;  // Optional parameter
     }
-    args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(ctrl_id.c_str());
+    args[1] = BstrArg(ctrlIdBstr.get());
 
     DISPPARAMS params = { args, NULL, 2, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
-
-    SysFreeString(args[1].bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return nullptr;
 
     // 3. 반환된 컨트롤 객체 래핑
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        IDispatch* pCtrl = result.pdispVal;
-        // HwpCtrl 생성자에서 AddRef를 하므로 여기서 Release 필요
-        auto ctrl = std::make_unique<HwpCtrl>(pCtrl, this);
-        pCtrl->Release();
-        return ctrl;
+    // 래퍼가 AddRef 하므로 결과 참조는 ScopedVariant가 해제
+    if (result.vt() == VT_DISPATCH && result.get().pdispVal) {
+        return std::make_unique<HwpCtrl>(result.get().pdispVal, this);
     }
 
     return nullptr;
@@ -2850,20 +2756,24 @@ std::unique_ptr<HwpCtrl> HwpWrapper::InsertCtrl(const std::wstring& ctrl_id,
 
 bool HwpWrapper::DeleteCtrl(HwpCtrl* ctrl)
 {
+    CPYHWPX_TRACE_METHOD();
+    m_edits.Note(EditKind::Content);
     if (!ctrl || !ctrl->IsValid()) return false;
     return DeleteCtrl(ctrl->GetDispatch());
 }
 
 bool HwpWrapper::DeleteCtrl(IDispatch* pCtrl)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || !pCtrl) return false;
+    m_edits.Note(EditKind::Content);
 
     HRESULT hr;
     DISPID dispid;
 
     // 1. DeleteCtrl 메서드의 DISPID 획득
     OLECHAR* methodName = const_cast<OLECHAR*>(L"DeleteCtrl");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     // 2. DeleteCtrl(ctrl) 호출
@@ -2876,8 +2786,8 @@ bool HwpWrapper::DeleteCtrl(IDispatch* pCtrl)
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, &result, NULL, NULL);
 
     if (FAILED(hr)) return false;
 
@@ -2892,64 +2802,61 @@ bool HwpWrapper::DeleteCtrl(IDispatch* pCtrl)
 
 std::wstring HwpWrapper::GetVersion()
 {
-    VARIANT result = GetProperty(L"Version");
-    if (result.vt == VT_BSTR) {
-        std::wstring ver(result.bstrVal ? result.bstrVal : L"");
-        SysFreeString(result.bstrVal);
-        return ver;
-    }
-    return L"";
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"Version"));
+    return result.ToString();
 }
 
 std::wstring HwpWrapper::GetBuildNumber()
 {
-    VARIANT result = GetProperty(L"BuildNumber");
-    if (result.vt == VT_BSTR) {
-        std::wstring build(result.bstrVal ? result.bstrVal : L"");
-        SysFreeString(result.bstrVal);
-        return build;
-    }
-    return L"";
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"BuildNumber"));
+    return result.ToString();
 }
 
 int HwpWrapper::GetCurrentPage()
 {
-    VARIANT result = GetProperty(L"CurrentPage");
-    if (result.vt == VT_I4) {
-        return result.lVal;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"CurrentPage"));
+    if (result.vt() == VT_I4) {
+        return result.get().lVal;
     }
     return 0;
 }
 
 int HwpWrapper::GetCurrentPrintPage()
 {
-    VARIANT result = GetProperty(L"CurrentPrnPage");
-    if (result.vt == VT_I4) {
-        return result.lVal;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"CurrentPrnPage"));
+    if (result.vt() == VT_I4) {
+        return result.get().lVal;
     }
     return 0;
 }
 
 int HwpWrapper::GetPageCount()
 {
-    VARIANT result = GetProperty(L"PageCount");
-    if (result.vt == VT_I4) {
-        return result.lVal;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"PageCount"));
+    if (result.vt() == VT_I4) {
+        return result.get().lVal;
     }
     return 0;
 }
 
 bool HwpWrapper::GetEditMode()
 {
-    VARIANT result = GetProperty(L"EditMode");
-    if (result.vt == VT_BOOL) {
-        return result.boolVal != VARIANT_FALSE;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"EditMode"));
+    if (result.vt() == VT_BOOL) {
+        return result.ToBool();
     }
     return false;
 }
 
 void HwpWrapper::SetEditMode(bool mode)
 {
+    CPYHWPX_TRACE_METHOD();
     VARIANT val;
     VariantInit(&val);
     val.vt = VT_BOOL;
@@ -2964,50 +2871,59 @@ void HwpWrapper::SetEditMode(bool mode)
 
 std::unique_ptr<HwpCtrl> HwpWrapper::GetCurSelectedCtrl()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    VARIANT result = GetProperty(L"CurSelectedCtrl");
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        return std::make_unique<HwpCtrl>(result.pdispVal, this);
+    // 래퍼가 AddRef 하므로 결과 참조는 ScopedVariant가 해제
+    ScopedVariant result(GetProperty(L"CurSelectedCtrl"));
+    if (result.vt() == VT_DISPATCH && result.get().pdispVal) {
+        return std::make_unique<HwpCtrl>(result.get().pdispVal, this);
     }
     return nullptr;
 }
 
 std::unique_ptr<HwpCtrl> HwpWrapper::GetHeadCtrl()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    VARIANT result = GetProperty(L"HeadCtrl");
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        return std::make_unique<HwpCtrl>(result.pdispVal, this);
+    // 래퍼가 AddRef 하므로 결과 참조는 ScopedVariant가 해제
+    ScopedVariant result(GetProperty(L"HeadCtrl"));
+    if (result.vt() == VT_DISPATCH && result.get().pdispVal) {
+        return std::make_unique<HwpCtrl>(result.get().pdispVal, this);
     }
     return nullptr;
 }
 
 std::unique_ptr<HwpCtrl> HwpWrapper::GetLastCtrl()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    VARIANT result = GetProperty(L"LastCtrl");
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        return std::make_unique<HwpCtrl>(result.pdispVal, this);
+    // 래퍼가 AddRef 하므로 결과 참조는 ScopedVariant가 해제
+    ScopedVariant result(GetProperty(L"LastCtrl"));
+    if (result.vt() == VT_DISPATCH && result.get().pdispVal) {
+        return std::make_unique<HwpCtrl>(result.get().pdispVal, this);
     }
     return nullptr;
 }
 
 std::unique_ptr<HwpCtrl> HwpWrapper::GetParentCtrl()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    VARIANT result = GetProperty(L"ParentCtrl");
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        return std::make_unique<HwpCtrl>(result.pdispVal, this);
+    // 래퍼가 AddRef 하므로 결과 참조는 ScopedVariant가 해제
+    ScopedVariant result(GetProperty(L"ParentCtrl"));
+    if (result.vt() == VT_DISPATCH && result.get().pdispVal) {
+        return std::make_unique<HwpCtrl>(result.get().pdispVal, this);
     }
     return nullptr;
 }
 
 std::vector<std::unique_ptr<HwpCtrl>> HwpWrapper::GetCtrlList()
 {
+    CPYHWPX_TRACE_METHOD();
     std::vector<std::unique_ptr<HwpCtrl>> result;
     if (!m_pHwp) return result;
 
@@ -3038,17 +2954,20 @@ std::vector<std::unique_ptr<HwpCtrl>> HwpWrapper::GetCtrlList()
 
 std::unique_ptr<XHwpDocuments> HwpWrapper::GetXHwpDocuments()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    VARIANT result = GetProperty(L"XHwpDocuments");
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        return std::make_unique<XHwpDocuments>(result.pdispVal);
+    // 래퍼가 AddRef 하므로 결과 참조는 ScopedVariant가 해제
+    ScopedVariant result(GetProperty(L"XHwpDocuments"));
+    if (result.vt() == VT_DISPATCH && result.get().pdispVal) {
+        return std::make_unique<XHwpDocuments>(result.get().pdispVal, this);
     }
     return nullptr;
 }
 
 std::unique_ptr<XHwpDocument> HwpWrapper::SwitchTo(int num)
 {
+    CPYHWPX_TRACE_METHOD();
     auto docs = GetXHwpDocuments();
     if (!docs) return nullptr;
 
@@ -3064,6 +2983,7 @@ std::unique_ptr<XHwpDocument> HwpWrapper::SwitchTo(int num)
 
 std::unique_ptr<XHwpDocument> HwpWrapper::AddTab()
 {
+    CPYHWPX_TRACE_METHOD();
     auto docs = GetXHwpDocuments();
     if (!docs) return nullptr;
 
@@ -3072,6 +2992,7 @@ std::unique_ptr<XHwpDocument> HwpWrapper::AddTab()
 
 std::unique_ptr<XHwpDocument> HwpWrapper::AddDoc()
 {
+    CPYHWPX_TRACE_METHOD();
     auto docs = GetXHwpDocuments();
     if (!docs) return nullptr;
 
@@ -3084,30 +3005,30 @@ std::unique_ptr<XHwpDocument> HwpWrapper::AddDoc()
 
 IDispatch* HwpWrapper::GetHParameterSet()
 {
+    CPYHWPX_TRACE_METHOD();
     if (m_pHParameterSet) {
         return m_pHParameterSet;
     }
 
-    VARIANT result = GetProperty(L"HParameterSet");
-    if (result.vt == VT_DISPATCH) {
-        m_pHParameterSet = result.pdispVal;
-        return m_pHParameterSet;
-    }
-    return nullptr;
+    ScopedVariant result(GetProperty(L"HParameterSet"));
+    m_pHParameterSet = result.DetachDispatch();
+    // 추적을 나중에 켜도 이름이 붙도록 계측 여부와 관계없이 지정
+    ComStats::Label(m_pHParameterSet, L"HParameterSet");
+    return m_pHParameterSet;
 }
 
 IDispatch* HwpWrapper::GetHAction()
 {
+    CPYHWPX_TRACE_METHOD();
     if (m_pHAction) {
         return m_pHAction;
     }
 
-    VARIANT result = GetProperty(L"HAction");
-    if (result.vt == VT_DISPATCH) {
-        m_pHAction = result.pdispVal;
-        return m_pHAction;
-    }
-    return nullptr;
+    ScopedVariant result(GetProperty(L"HAction"));
+    m_pHAction = result.DetachDispatch();
+    // Run/Execute 액션 ID 기록은 "HAction" 이름에 의존하므로 추적을 나중에 켜도 붙도록
+    ComStats::Label(m_pHAction, L"HAction");
+    return m_pHAction;
 }
 
 //=============================================================================
@@ -3126,8 +3047,8 @@ VARIANT HwpWrapper::GetProperty(const std::wstring& name)
     if (dispid == DISPID_UNKNOWN) return result;
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                   &params, &result, NULL, NULL);
+    ComInvoke(m_pHwp, dispid, DISPATCH_PROPERTYGET,
+              &params, &result, NULL, NULL);
 
     return result;
 }
@@ -3143,16 +3064,15 @@ bool HwpWrapper::SetProperty(const std::wstring& name, const VARIANT& value)
     DISPID putid = DISPID_PROPERTYPUT;
     DISPPARAMS params = { const_cast<VARIANT*>(&value), &putid, 1, 1 };
 
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                        &params, NULL, NULL, NULL);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_PROPERTYPUT,
+                           &params, NULL, NULL, NULL);
 
     return SUCCEEDED(hr);
 }
 
 bool HwpWrapper::InvokeMethod(const std::wstring& name)
 {
-    VARIANT result = InvokeMethodWithResult(name);
-    VariantClear(&result);
+    ScopedVariant result(InvokeMethodWithResult(name));
     return true;
 }
 
@@ -3178,8 +3098,8 @@ VARIANT HwpWrapper::InvokeMethodWithResult(const std::wstring& name,
         0
     };
 
-    m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                   &params, &result, NULL, NULL);
+    ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+              &params, &result, NULL, NULL);
 
     return result;
 }
@@ -3192,13 +3112,18 @@ bool HwpWrapper::CreateField(const std::wstring& name,
                               const std::wstring& direction,
                               const std::wstring& memo)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
 
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"CreateField");
     if (dispid == DISPID_UNKNOWN) return false;
 
     // Positional parameters (역순): name, memo, direction
     // COM에서 arguments는 역순으로 전달됨
+    ScopedBstr nameBstr(name);
+    ScopedBstr memoBstr(memo);
+    ScopedBstr directionBstr(direction);
     VARIANT args[3];
     VariantInit(&args[0]);
     VariantInit(&args[1]);
@@ -3206,38 +3131,38 @@ bool HwpWrapper::CreateField(const std::wstring& name,
 
     // 역순: [0]=name, [1]=memo, [2]=direction
     args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(name.c_str());
+    args[0].bstrVal = nameBstr.get();
     args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(memo.c_str());
+    args[1].bstrVal = memoBstr.get();
     args[2].vt = VT_BSTR;
-    args[2].bstrVal = SysAllocString(direction.c_str());
+    args[2].bstrVal = directionBstr.get();
 
     DISPPARAMS params = { args, NULL, 3, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                        DISPATCH_METHOD, &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    VariantClear(&args[0]);
-    VariantClear(&args[1]);
-    VariantClear(&args[2]);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, result.Receive(), NULL, NULL);
 
-    bool success = SUCCEEDED(hr) && (result.vt == VT_BOOL) &&
-                   (result.boolVal != VARIANT_FALSE);
-    VariantClear(&result);
-    return success;
+    return SUCCEEDED(hr) && result.vt() == VT_BOOL && result.ToBool();
 }
 
 std::wstring HwpWrapper::GetFieldList(int number, int option)
 {
-    if (!m_pHwp) return L"";
+    CPYHWPX_TRACE_METHOD();
+    return GetFieldListBstr(number, option).str();
+}
+
+BstrString HwpWrapper::GetFieldListBstr(int number, int option)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return BstrString();
 
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"GetFieldList");
-    if (dispid == DISPID_UNKNOWN) return L"";
+    if (dispid == DISPID_UNKNOWN) return BstrString();
 
     // Positional parameters (역순): option, number
     VARIANT args[2];
+    VariantInit(&args[0]);
+    VariantInit(&args[1]);
     args[0].vt = VT_I4;
     args[0].lVal = option;
     args[1].vt = VT_I4;
@@ -3247,19 +3172,15 @@ std::wstring HwpWrapper::GetFieldList(int number, int option)
     VARIANT result;
     VariantInit(&result);
 
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_METHOD, &params, &result, NULL, NULL);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, &result, NULL, NULL);
 
-    std::wstring fieldList;
-    if (SUCCEEDED(hr) && result.vt == VT_BSTR && result.bstrVal) {
-        fieldList = result.bstrVal;
-    }
-    VariantClear(&result);
-    return fieldList;
+    if (FAILED(hr)) return BstrString();
+    return BstrString::FromVariant(result);
 }
 
 std::wstring HwpWrapper::GetFieldText(const std::wstring& field, int idx)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return L"";
 
     // 인덱스 처리: "field{{n}}" 형식
@@ -3268,87 +3189,145 @@ std::wstring HwpWrapper::GetFieldText(const std::wstring& field, int idx)
         fieldName = field + L"{{" + std::to_wstring(idx) + L"}}";
     }
 
+    // 단일 필드는 색인에서 (복수 필드 목록은 한/글에 그대로 전달)
+    if (IsFieldIndexTrusted() && fieldName.find(L'\x02') == std::wstring::npos) {
+        const FieldIndex& index = EnsureFieldIndex(true);
+        if (const std::wstring* cached = index.Text(fieldName)) {
+            return *cached;
+        }
+        if (!index.Exists(fieldName)) {
+            return L"";
+        }
+    }
+
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"GetFieldText");
     if (dispid == DISPID_UNKNOWN) return L"";
 
     // Positional parameter: Field
+    ScopedBstr fieldNameBstr(fieldName);
     VARIANT arg;
     arg.vt = VT_BSTR;
-    arg.bstrVal = SysAllocString(fieldName.c_str());
+    arg.bstrVal = fieldNameBstr.get();
 
     DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_METHOD, &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    SysFreeString(arg.bstrVal);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, result.Receive(), NULL, NULL);
 
     std::wstring text;
-    if (SUCCEEDED(hr) && result.vt == VT_BSTR && result.bstrVal) {
-        text = result.bstrVal;
+    if (SUCCEEDED(hr) && result.vt() == VT_BSTR && result.get().bstrVal) {
+        text = result.get().bstrVal;
     }
-    VariantClear(&result);
     return text;
 }
 
 bool HwpWrapper::PutFieldText(const std::wstring& field, const std::wstring& text)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
+    // 값만 바뀌고 필드 구성은 그대로이므로 최신 색인은 값을 반영해 살려 둠
+    bool indexCurrent = IsFieldIndexCurrent();
+    m_edits.Note(EditKind::Content);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnPutFieldText(field, text);
+    }
+
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"PutFieldText");
     if (dispid == DISPID_UNKNOWN) return false;
 
     // Positional parameters (역순): text, field
+    ScopedBstr textBstr(text);
+    ScopedBstr fieldBstr(field);
     VARIANT args[2];
     args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(text.c_str());
+    args[0].bstrVal = textBstr.get();
     args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(field.c_str());
+    args[1].bstrVal = fieldBstr.get();
 
     DISPPARAMS params = { args, NULL, 2, 0 };
 
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_METHOD, &params, NULL, NULL, NULL);
-
-    SysFreeString(args[0].bstrVal);
-    SysFreeString(args[1].bstrVal);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, NULL, NULL, NULL);
 
+    if (SUCCEEDED(hr) && indexCurrent) {
+        m_fieldIndex.Update(field, text);
+        m_fieldIndexStamp = m_edits.Stamp(EditKind::Content);
+    }
     return SUCCEEDED(hr);
 }
 
 bool HwpWrapper::FieldExist(const std::wstring& field)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
+    // 색인에서 조회 (색인이 최신이면 COM 호출 없음)
+    if (IsFieldIndexTrusted()) {
+        return EnsureFieldIndex(false).Exists(field);
+    }
+
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"FieldExist");
     if (dispid == DISPID_UNKNOWN) return false;
 
     // Positional parameter: Field
-    VARIANT arg;
-    arg.vt = VT_BSTR;
-    arg.bstrVal = SysAllocString(field.c_str());
+    ScopedBstr fieldBstr(field);
+    VARIANT args[1] = { BstrArg(fieldBstr.get()) };
+    DISPPARAMS params = { args, NULL, 1, 0 };
+    ScopedVariant result;
 
-    DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, result.Receive(), NULL, NULL);
+    return SUCCEEDED(hr) && result.vt() == VT_BOOL && result.get().boolVal != VARIANT_FALSE;
+}
+
+int HwpWrapper::GetFieldCount(const std::wstring& name)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return 0;
+    return EnsureFieldIndex(false).Count(name);
+}
 
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_METHOD, &params, &result, NULL, NULL);
+void HwpWrapper::InvalidateFieldIndex()
+{
+    m_fieldIndex.Clear();
+    m_fieldTextsTried = false;
+}
+
+bool HwpWrapper::IsFieldIndexCurrent() const
+{
+    return IsFieldIndexTrusted() && m_fieldIndex.IsBuilt() &&
+           m_fieldIndexStamp == m_edits.Stamp(EditKind::Content);
+}
 
-    SysFreeString(arg.bstrVal);
+const FieldIndex& HwpWrapper::EnsureFieldIndex(bool with_texts)
+{
+    if (!IsFieldIndexCurrent()) {
+        InvalidateFieldIndex();
+        m_fieldIndex.Build(GetFieldListBstr(1, 0).str());
+        m_fieldIndexStamp = m_edits.Stamp(EditKind::Content);
+    }
 
-    bool exists = SUCCEEDED(hr) && (result.vt == VT_BOOL) &&
-                  (result.boolVal != VARIANT_FALSE);
-    VariantClear(&result);
-    return exists;
+    if (with_texts && !m_fieldIndex.HasTexts() && !m_fieldTextsTried) {
+        m_fieldTextsTried = true;
+        if (!m_fieldIndex.GetEntries().empty()) {
+            m_fieldIndex.LoadTexts(GetFieldText(m_fieldIndex.GetFieldListString()));
+        }
+    }
+    return m_fieldIndex;
 }
 
 bool HwpWrapper::MoveToField(const std::wstring& field, int idx,
                               bool text, bool start, bool select)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Caret);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnMoveToField(field, idx, text, start, select);
+    }
 
     // 인덱스 처리: "field{{n}}" 형식
     std::wstring fieldName = field;
@@ -3356,10 +3335,16 @@ bool HwpWrapper::MoveToField(const std::wstring& field, int idx,
         fieldName = field + L"{{" + std::to_wstring(idx) + L"}}";
     }
 
+    // 최신 색인에 없는 필드는 COM 호출 없이 실패 (색인을 새로 만들지는 않음)
+    if (IsFieldIndexCurrent() && !m_fieldIndex.Exists(fieldName)) {
+        return false;
+    }
+
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"MoveToField");
     if (dispid == DISPID_UNKNOWN) return false;
 
     // Positional parameters (역순): select, start, text, field
+    ScopedBstr fieldNameBstr(fieldName);
     VARIANT args[4];
     args[0].vt = VT_BOOL;
     args[0].boolVal = select ? VARIANT_TRUE : VARIANT_FALSE;
@@ -3368,55 +3353,45 @@ bool HwpWrapper::MoveToField(const std::wstring& field, int idx,
     args[2].vt = VT_BOOL;
     args[2].boolVal = text ? VARIANT_TRUE : VARIANT_FALSE;
     args[3].vt = VT_BSTR;
-    args[3].bstrVal = SysAllocString(fieldName.c_str());
+    args[3].bstrVal = fieldNameBstr.get();
 
     DISPPARAMS params = { args, NULL, 4, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_METHOD, &params, &result, NULL, NULL);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, result.Receive(), NULL, NULL);
 
-    SysFreeString(args[3].bstrVal);
-
-    bool success = SUCCEEDED(hr) && (result.vt == VT_BOOL) &&
-                   (result.boolVal != VARIANT_FALSE);
-    VariantClear(&result);
-    return success;
+    return SUCCEEDED(hr) && result.vt() == VT_BOOL && result.ToBool();
 }
 
 bool HwpWrapper::RenameField(const std::wstring& oldname, const std::wstring& newname)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
 
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"RenameField");
     if (dispid == DISPID_UNKNOWN) return false;
 
     // Positional parameters (역순): newname, oldname
+    ScopedBstr newnameBstr(newname);
+    ScopedBstr oldnameBstr(oldname);
     VARIANT args[2];
     args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(newname.c_str());
+    args[0].bstrVal = newnameBstr.get();
     args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(oldname.c_str());
+    args[1].bstrVal = oldnameBstr.get();
 
     DISPPARAMS params = { args, NULL, 2, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_METHOD, &params, &result, NULL, NULL);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, result.Receive(), NULL, NULL);
 
-    SysFreeString(args[0].bstrVal);
-    SysFreeString(args[1].bstrVal);
-
-    bool success = SUCCEEDED(hr) && (result.vt == VT_BOOL) &&
-                   (result.boolVal != VARIANT_FALSE);
-    VariantClear(&result);
-    return success;
+    return SUCCEEDED(hr) && result.vt() == VT_BOOL && result.ToBool();
 }
 
 std::wstring HwpWrapper::GetCurFieldName(int option)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return L"";
 
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"GetCurFieldName");
@@ -3428,17 +3403,14 @@ std::wstring HwpWrapper::GetCurFieldName(int option)
     arg.lVal = option;
 
     DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_METHOD, &params, &result, NULL, NULL);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, result.Receive(), NULL, NULL);
 
     std::wstring fieldName;
-    if (SUCCEEDED(hr) && result.vt == VT_BSTR && result.bstrVal) {
-        fieldName = result.bstrVal;
+    if (SUCCEEDED(hr) && result.vt() == VT_BSTR && result.get().bstrVal) {
+        fieldName = result.get().bstrVal;
     }
-    VariantClear(&result);
     return fieldName;
 }
 
@@ -3447,40 +3419,39 @@ bool HwpWrapper::SetCurFieldName(const std::wstring& field,
                                   const std::wstring& memo,
                                   int option)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
 
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"SetCurFieldName");
     if (dispid == DISPID_UNKNOWN) return false;
 
     // Positional parameters (역순): option, memo, direction, field
+    ScopedBstr memoBstr(memo);
+    ScopedBstr directionBstr(direction);
+    ScopedBstr fieldBstr(field);
     VARIANT args[4];
     args[0].vt = VT_I4;
     args[0].lVal = option;
     args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(memo.c_str());
+    args[1].bstrVal = memoBstr.get();
     args[2].vt = VT_BSTR;
-    args[2].bstrVal = SysAllocString(direction.c_str());
+    args[2].bstrVal = directionBstr.get();
     args[3].vt = VT_BSTR;
-    args[3].bstrVal = SysAllocString(field.c_str());
+    args[3].bstrVal = fieldBstr.get();
 
     DISPPARAMS params = { args, NULL, 4, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_METHOD, &params, &result, NULL, NULL);
-
-    SysFreeString(args[1].bstrVal);
-    SysFreeString(args[2].bstrVal);
-    SysFreeString(args[3].bstrVal);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, result.Receive(), NULL, NULL);
 
     bool success = SUCCEEDED(hr);
-    VariantClear(&result);
     return success;
 }
 
 int HwpWrapper::SetFieldViewOption(int option)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return -1;
 
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"SetFieldViewOption");
@@ -3492,23 +3463,22 @@ int HwpWrapper::SetFieldViewOption(int option)
     arg.lVal = option;
 
     DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_METHOD, &params, &result, NULL, NULL);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, result.Receive(), NULL, NULL);
 
     int prevOption = -1;
-    if (SUCCEEDED(hr) && result.vt == VT_I4) {
-        prevOption = result.lVal;
+    if (SUCCEEDED(hr) && result.vt() == VT_I4) {
+        prevOption = result.get().lVal;
     }
-    VariantClear(&result);
     return prevOption;
 }
 
 bool HwpWrapper::DeleteAllFields()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
 
     // 현재 위치 저장
     HwpPos startPos = GetPos();
@@ -3544,46 +3514,38 @@ bool HwpWrapper::DeleteAllFields()
 
 bool HwpWrapper::DeleteFieldByName(const std::wstring& field_name, int idx)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
-    // 현재 위치 저장
-    HwpPos startPos = GetPos();
-
+    // 지울 필드 찾기 (색인 사용, 없으면 편집 없이 종료)
+    std::vector<std::wstring> targets;
+    const FieldIndex& index = EnsureFieldIndex(false);
     if (idx == -1) {
-        // 모든 동일 이름 필드 삭제
-        std::wstring fieldList = GetFieldList();
-        if (fieldList.empty()) return true;
-
-        // 필드 목록에서 해당 이름의 필드 찾아서 삭제
-        std::vector<std::wstring> fields;
-        size_t start = 0;
-        size_t end = 0;
-        while ((end = fieldList.find(L'\x02', start)) != std::wstring::npos) {
-            if (end > start) {
-                fields.push_back(fieldList.substr(start, end - start));
-            }
-            start = end + 1;
-        }
-        if (start < fieldList.length()) {
-            fields.push_back(fieldList.substr(start));
-        }
-
-        // 역순으로 해당 이름의 필드만 삭제
-        for (auto it = fields.rbegin(); it != fields.rend(); ++it) {
-            // field_name{{n}} 형식에서 이름 부분 추출
-            std::wstring fieldNamePart = *it;
-            size_t bracketPos = it->find(L"{{");
-            if (bracketPos != std::wstring::npos) {
-                fieldNamePart = it->substr(0, bracketPos);
-            }
-            if (fieldNamePart == field_name) {
-                RenameField(*it, L"");
+        // 모든 동일 이름 필드
+        for (const auto& entry : index.GetEntries()) {
+            std::wstring name;
+            FieldIndex::SplitReference(entry, name);
+            if (name == field_name) {
+                targets.push_back(entry);
             }
         }
     } else {
-        // 특정 인덱스의 필드만 삭제
+        // 특정 인덱스의 필드만
         std::wstring fieldWithIdx = field_name + L"{{" + std::to_wstring(idx) + L"}}";
-        RenameField(fieldWithIdx, L"");
+        if (index.Exists(fieldWithIdx)) {
+            targets.push_back(fieldWithIdx);
+        }
+    }
+    if (targets.empty()) return true;
+
+    m_edits.Note(EditKind::Content);
+
+    // 현재 위치 저장
+    HwpPos startPos = GetPos();
+
+    // 역순으로 삭제 (rename으로 이름 제거)
+    for (auto it = targets.rbegin(); it != targets.rend(); ++it) {
+        RenameField(*it, L"");
     }
 
     // 원래 위치로 복원
@@ -3593,32 +3555,17 @@ bool HwpWrapper::DeleteFieldByName(const std::wstring& field_name, int idx)
 }
 
 std::map<std::wstring, std::wstring> HwpWrapper::FieldsToMap()
-{
-    std::map<std::wstring, std::wstring> result;
-    if (!m_pHwp) return result;
-
-    // 필드 목록 가져오기
-    std::wstring fieldList = GetFieldList(1, 0);
-    if (fieldList.empty()) return result;
-
-    // \x02로 분리
-    std::vector<std::wstring> fields;
-    size_t start = 0;
-    size_t end = 0;
-    while ((end = fieldList.find(L'\x02', start)) != std::wstring::npos) {
-        if (end > start) {
-            fields.push_back(fieldList.substr(start, end - start));
-        }
-        start = end + 1;
-    }
-    if (start < fieldList.length()) {
-        fields.push_back(fieldList.substr(start));
-    }
+{
+    CPYHWPX_TRACE_METHOD();
+    std::map<std::wstring, std::wstring> result;
+    if (!m_pHwp) return result;
 
-    // 각 필드의 텍스트 가져오기
-    for (const auto& field : fields) {
-        std::wstring text = GetFieldText(field, 0);
-        result[field] = text;
+    // 필드 목록과 값 모두 색인에서 (GetFieldList 한 번 + GetFieldText 한 번)
+    const FieldIndex& index = EnsureFieldIndex(true);
+    for (const auto& field : index.GetEntries()) {
+        if (field.empty()) continue;
+        const std::wstring* cached = index.Text(field);
+        result[field] = cached ? *cached : GetFieldText(field, 0);
     }
 
     return result;
@@ -3634,12 +3581,18 @@ bool HwpWrapper::CreateTable(int rows, int cols,
                               int height_type,
                               bool header)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"CreateTable");
+    }
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
     // 1. HParameterSet 속성 가져오기
     IDispatch* pHParameterSet = GetHParameterSet();
@@ -3647,36 +3600,30 @@ bool HwpWrapper::CreateTable(int rows, int cols,
 
     // 2. HTableCreation 속성 가져오기
     OLECHAR* tableCreationName = const_cast<OLECHAR*>(L"HTableCreation");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &tableCreationName, 1,
-                                        LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHParameterSet, &tableCreationName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                 DISPATCH_PROPERTYGET, &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET, &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pTableCreation = result.pdispVal;
+    IDispatch* pTableCreation = result.DetachDispatch();
 
     // 3. HSet 속성 가져오기
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pTableCreation->GetIDsOfNames(IID_NULL, &hsetName, 1,
-                                        LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pTableCreation, &hsetName, 1, &dispid);
     if (FAILED(hr)) {
         pTableCreation->Release();
         return false;
     }
 
-    VariantInit(&result);
-    hr = pTableCreation->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                 DISPATCH_PROPERTYGET, &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
+    hr = ComInvoke(pTableCreation, dispid, DISPATCH_PROPERTYGET, &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) {
         pTableCreation->Release();
         return false;
     }
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = result.DetachDispatch();
 
     // 4. HAction 가져오기
     IDispatch* pHAction = GetHAction();
@@ -3688,105 +3635,92 @@ bool HwpWrapper::CreateTable(int rows, int cols,
 
     // 5. HAction.GetDefault("TableCreate", HSet) 호출
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1,
-                                  LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pTableCreation->Release();
         return false;
     }
 
+    static const BSTR s_tableCreate = InternBstr(L"TableCreate");
     VARIANT getDefaultArgs[2];
     VariantInit(&getDefaultArgs[0]);
     VariantInit(&getDefaultArgs[1]);
     getDefaultArgs[0].vt = VT_DISPATCH;
     getDefaultArgs[0].pdispVal = pHSet;
     getDefaultArgs[1].vt = VT_BSTR;
-    getDefaultArgs[1].bstrVal = SysAllocString(L"TableCreate");
+    getDefaultArgs[1].bstrVal = s_tableCreate;
 
     DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &getDefaultParams, &result, NULL, NULL);
-    SysFreeString(getDefaultArgs[1].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &getDefaultParams, result.Receive(), NULL, NULL);
 
     // 6. 파라미터 설정: Rows, Cols, WidthType, HeightType
     DISPID putid = DISPID_PROPERTYPUT;
 
     // Rows 설정
     OLECHAR* rowsName = const_cast<OLECHAR*>(L"Rows");
-    hr = pTableCreation->GetIDsOfNames(IID_NULL, &rowsName, 1,
-                                        LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pTableCreation, &rowsName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT rowsVal;
         VariantInit(&rowsVal);
         rowsVal.vt = VT_I4;
         rowsVal.lVal = rows;
         DISPPARAMS rowsParams = { &rowsVal, &putid, 1, 1 };
-        pTableCreation->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_PROPERTYPUT, &rowsParams, NULL, NULL, NULL);
+        ComInvoke(pTableCreation, dispid, DISPATCH_PROPERTYPUT, &rowsParams, NULL, NULL, NULL);
     }
 
     // Cols 설정
     OLECHAR* colsName = const_cast<OLECHAR*>(L"Cols");
-    hr = pTableCreation->GetIDsOfNames(IID_NULL, &colsName, 1,
-                                        LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pTableCreation, &colsName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT colsVal;
         VariantInit(&colsVal);
         colsVal.vt = VT_I4;
         colsVal.lVal = cols;
         DISPPARAMS colsParams = { &colsVal, &putid, 1, 1 };
-        pTableCreation->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_PROPERTYPUT, &colsParams, NULL, NULL, NULL);
+        ComInvoke(pTableCreation, dispid, DISPATCH_PROPERTYPUT, &colsParams, NULL, NULL, NULL);
     }
 
     // WidthType 설정
     OLECHAR* widthTypeName = const_cast<OLECHAR*>(L"WidthType");
-    hr = pTableCreation->GetIDsOfNames(IID_NULL, &widthTypeName, 1,
-                                        LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pTableCreation, &widthTypeName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT widthTypeVal;
         VariantInit(&widthTypeVal);
         widthTypeVal.vt = VT_I4;
         widthTypeVal.lVal = width_type;
         DISPPARAMS widthTypeParams = { &widthTypeVal, &putid, 1, 1 };
-        pTableCreation->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_PROPERTYPUT, &widthTypeParams, NULL, NULL, NULL);
+        ComInvoke(pTableCreation, dispid, DISPATCH_PROPERTYPUT, &widthTypeParams, NULL, NULL, NULL);
     }
 
     // HeightType 설정
     OLECHAR* heightTypeName = const_cast<OLECHAR*>(L"HeightType");
-    hr = pTableCreation->GetIDsOfNames(IID_NULL, &heightTypeName, 1,
-                                        LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pTableCreation, &heightTypeName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT heightTypeVal;
         VariantInit(&heightTypeVal);
         heightTypeVal.vt = VT_I4;
         heightTypeVal.lVal = height_type;
         DISPPARAMS heightTypeParams = { &heightTypeVal, &putid, 1, 1 };
-        pTableCreation->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_PROPERTYPUT, &heightTypeParams, NULL, NULL, NULL);
+        ComInvoke(pTableCreation, dispid, DISPATCH_PROPERTYPUT, &heightTypeParams, NULL, NULL, NULL);
     }
 
     // TreatAsChar 설정 (CreateItemArray 대신 직접 설정)
     OLECHAR* treatAsCharName = const_cast<OLECHAR*>(L"TreatAsChar");
-    hr = pTableCreation->GetIDsOfNames(IID_NULL, &treatAsCharName, 1,
-                                        LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pTableCreation, &treatAsCharName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT treatVal;
         VariantInit(&treatVal);
         treatVal.vt = VT_I4;
         treatVal.lVal = treat_as_char ? 1 : 0;
         DISPPARAMS treatParams = { &treatVal, &putid, 1, 1 };
-        pTableCreation->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_PROPERTYPUT, &treatParams, NULL, NULL, NULL);
+        ComInvoke(pTableCreation, dispid, DISPATCH_PROPERTYPUT, &treatParams, NULL, NULL, NULL);
     }
 
     // 7. HAction.Execute("TableCreate", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1,
-                                  LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pTableCreation->Release();
@@ -3799,16 +3733,14 @@ bool HwpWrapper::CreateTable(int rows, int cols,
     executeArgs[0].vt = VT_DISPATCH;
     executeArgs[0].pdispVal = pHSet;
     executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"TableCreate");
+    executeArgs[1].bstrVal = s_tableCreate;
 
     DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
-    bool success = SUCCEEDED(hr) && (result.vt == VT_BOOL) &&
-                   (result.boolVal != VARIANT_FALSE);
+    bool success = SUCCEEDED(hr) && (result.vt() == VT_BOOL) &&
+                   result.ToBool();
 
     pHSet->Release();
     pTableCreation->Release();
@@ -3818,19 +3750,17 @@ bool HwpWrapper::CreateTable(int rows, int cols,
 
 bool HwpWrapper::GetIntoNthTable(int n, bool select_cell)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
     // 문서 시작으로 이동
     MovePos(2, 0, 0);  // moveDocBegin = 2
 
     // HeadCtrl 가져오기
-    VARIANT headCtrlVar = GetProperty(L"HeadCtrl");
-    if (headCtrlVar.vt != VT_DISPATCH || !headCtrlVar.pdispVal) {
-        VariantClear(&headCtrlVar);
-        return false;
-    }
+    ScopedVariant headCtrlVar(GetProperty(L"HeadCtrl"));
+    if (headCtrlVar.vt() != VT_DISPATCH || !headCtrlVar.get().pdispVal) return false;
 
-    IDispatch* pCtrl = headCtrlVar.pdispVal;
+    IDispatch* pCtrl = headCtrlVar.DetachDispatch();
     int tableCount = 0;
     int targetN = (n >= 0) ? n : -(n + 1);
 
@@ -3840,37 +3770,31 @@ bool HwpWrapper::GetIntoNthTable(int n, bool select_cell)
     while (pCtrl) {
         // UserDesc 속성 조회
         OLECHAR* userDescName = const_cast<OLECHAR*>(L"UserDesc");
-        HRESULT hr = pCtrl->GetIDsOfNames(IID_NULL, &userDescName, 1,
-                                           LOCALE_USER_DEFAULT, &dispidUserDesc);
+        HRESULT hr = ComGetIDsOfNames(pCtrl, &userDescName, 1, &dispidUserDesc);
         if (SUCCEEDED(hr)) {
-            VARIANT userDescVar;
-            VariantInit(&userDescVar);
-            hr = pCtrl->Invoke(dispidUserDesc, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_PROPERTYGET, &noParams, &userDescVar, NULL, NULL);
-            if (SUCCEEDED(hr) && userDescVar.vt == VT_BSTR && userDescVar.bstrVal) {
-                std::wstring userDesc(userDescVar.bstrVal);
+            ScopedVariant userDescVar;
+            hr = ComInvoke(pCtrl, dispidUserDesc, DISPATCH_PROPERTYGET, &noParams, userDescVar.Receive(), NULL, NULL);
+            if (SUCCEEDED(hr) && userDescVar.vt() == VT_BSTR && userDescVar.get().bstrVal) {
+                std::wstring userDesc(userDescVar.get().bstrVal);
                 if (userDesc == L"표") {
                     if (tableCount == targetN) {
                         // 테이블 찾음 - 테이블 안으로 이동
                         OLECHAR* getAnchorPosName = const_cast<OLECHAR*>(L"GetAnchorPos");
                         DISPID dispidGetAnchorPos;
-                        hr = pCtrl->GetIDsOfNames(IID_NULL, &getAnchorPosName, 1,
-                                                   LOCALE_USER_DEFAULT, &dispidGetAnchorPos);
+                        hr = ComGetIDsOfNames(pCtrl, &getAnchorPosName, 1, &dispidGetAnchorPos);
                         if (SUCCEEDED(hr)) {
                             // GetAnchorPos(0) - 시작 위치의 ParameterSet 반환
                             VARIANT anchorArg;
                             anchorArg.vt = VT_I4;
                             anchorArg.lVal = 0;
                             DISPPARAMS anchorParams = { &anchorArg, NULL, 1, 0 };
-                            VARIANT anchorResult;
-                            VariantInit(&anchorResult);
-                            hr = pCtrl->Invoke(dispidGetAnchorPos, IID_NULL, LOCALE_USER_DEFAULT,
-                                                DISPATCH_METHOD, &anchorParams, &anchorResult, NULL, NULL);
+                            ScopedVariant anchorResult;
+                            hr = ComInvoke(pCtrl, dispidGetAnchorPos, DISPATCH_METHOD, &anchorParams, anchorResult.Receive(), NULL, NULL);
 
                             // GetAnchorPos는 ParameterSet (IDispatch)을 반환
-                            if (SUCCEEDED(hr) && anchorResult.vt == VT_DISPATCH && anchorResult.pdispVal) {
+                            if (SUCCEEDED(hr) && anchorResult.vt() == VT_DISPATCH && anchorResult.get().pdispVal) {
                                 // 1. SetPosBySet으로 위치 이동 (핵심!)
-                                SetPosBySet(anchorResult.pdispVal);
+                                SetPosBySet(anchorResult.get().pdispVal);
 
                                 // 2. FindCtrl() - 컨트롤을 선택 상태로 만듦
                                 FindCtrl();
@@ -3884,41 +3808,30 @@ bool HwpWrapper::GetIntoNthTable(int n, bool select_cell)
                                     RunAction(L"ShapeObjTextBoxEdit");
                                 }
                             }
-                            VariantClear(&anchorResult);
                         }
 
-                        VariantClear(&userDescVar);
                         pCtrl->Release();
                         return true;
                     }
                     tableCount++;
                 }
-                VariantClear(&userDescVar);
             }
         }
 
         // Next 컨트롤로 이동
         OLECHAR* nextName = const_cast<OLECHAR*>(L"Next");
-        hr = pCtrl->GetIDsOfNames(IID_NULL, &nextName, 1,
-                                   LOCALE_USER_DEFAULT, &dispidNext);
+        hr = ComGetIDsOfNames(pCtrl, &nextName, 1, &dispidNext);
         if (FAILED(hr)) {
             pCtrl->Release();
             break;
         }
 
-        VARIANT nextVar;
-        VariantInit(&nextVar);
-        hr = pCtrl->Invoke(dispidNext, IID_NULL, LOCALE_USER_DEFAULT,
-                            DISPATCH_PROPERTYGET, &noParams, &nextVar, NULL, NULL);
+        ScopedVariant nextVar;
+        hr = ComInvoke(pCtrl, dispidNext, DISPATCH_PROPERTYGET, &noParams, nextVar.Receive(), NULL, NULL);
 
         pCtrl->Release();
 
-        if (SUCCEEDED(hr) && nextVar.vt == VT_DISPATCH && nextVar.pdispVal) {
-            pCtrl = nextVar.pdispVal;
-        } else {
-            VariantClear(&nextVar);
-            pCtrl = nullptr;
-        }
+        pCtrl = SUCCEEDED(hr) ? nextVar.DetachDispatch() : nullptr;
     }
 
     return false;
@@ -3926,37 +3839,27 @@ bool HwpWrapper::GetIntoNthTable(int n, bool select_cell)
 
 int HwpWrapper::GetTableRowCount()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return -1;
 
     // CurSelectedCtrl 또는 ParentCtrl에서 테이블 정보 조회
-    VARIANT parentVar = GetProperty(L"ParentCtrl");
-    if (parentVar.vt != VT_DISPATCH || !parentVar.pdispVal) {
-        VariantClear(&parentVar);
-        return -1;
-    }
+    ScopedVariant parentVar(GetProperty(L"ParentCtrl"));
+    if (parentVar.vt() != VT_DISPATCH || !parentVar.get().pdispVal) return -1;
 
-    IDispatch* pParentCtrl = parentVar.pdispVal;
+    IDispatch* pParentCtrl = parentVar.get().pdispVal;
 
     // RowCount 속성 조회
     OLECHAR* rowCountName = const_cast<OLECHAR*>(L"RowCount");
     DISPID dispid;
-    HRESULT hr = pParentCtrl->GetIDsOfNames(IID_NULL, &rowCountName, 1,
-                                             LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pParentCtrl->Release();
-        return -1;
-    }
+    HRESULT hr = ComGetIDsOfNames(pParentCtrl, &rowCountName, 1, &dispid);
+    if (FAILED(hr)) return -1;
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
-    hr = pParentCtrl->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                              DISPATCH_PROPERTYGET, &noParams, &result, NULL, NULL);
+    ScopedVariant result;
+    hr = ComInvoke(pParentCtrl, dispid, DISPATCH_PROPERTYGET, &noParams, result.Receive(), NULL, NULL);
 
-    pParentCtrl->Release();
-
-    if (SUCCEEDED(hr) && result.vt == VT_I4) {
-        return result.lVal;
+    if (SUCCEEDED(hr) && result.vt() == VT_I4) {
+        return result.get().lVal;
     }
 
     return -1;
@@ -3964,37 +3867,27 @@ int HwpWrapper::GetTableRowCount()
 
 int HwpWrapper::GetTableColCount()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return -1;
 
     // CurSelectedCtrl 또는 ParentCtrl에서 테이블 정보 조회
-    VARIANT parentVar = GetProperty(L"ParentCtrl");
-    if (parentVar.vt != VT_DISPATCH || !parentVar.pdispVal) {
-        VariantClear(&parentVar);
-        return -1;
-    }
+    ScopedVariant parentVar(GetProperty(L"ParentCtrl"));
+    if (parentVar.vt() != VT_DISPATCH || !parentVar.get().pdispVal) return -1;
 
-    IDispatch* pParentCtrl = parentVar.pdispVal;
+    IDispatch* pParentCtrl = parentVar.get().pdispVal;
 
     // ColCount 속성 조회
     OLECHAR* colCountName = const_cast<OLECHAR*>(L"ColCount");
     DISPID dispid;
-    HRESULT hr = pParentCtrl->GetIDsOfNames(IID_NULL, &colCountName, 1,
-                                             LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) {
-        pParentCtrl->Release();
-        return -1;
-    }
+    HRESULT hr = ComGetIDsOfNames(pParentCtrl, &colCountName, 1, &dispid);
+    if (FAILED(hr)) return -1;
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
-    hr = pParentCtrl->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                              DISPATCH_PROPERTYGET, &noParams, &result, NULL, NULL);
-
-    pParentCtrl->Release();
+    ScopedVariant result;
+    hr = ComInvoke(pParentCtrl, dispid, DISPATCH_PROPERTYGET, &noParams, result.Receive(), NULL, NULL);
 
-    if (SUCCEEDED(hr) && result.vt == VT_I4) {
-        return result.lVal;
+    if (SUCCEEDED(hr) && result.vt() == VT_I4) {
+        return result.get().lVal;
     }
 
     return -1;
@@ -4002,88 +3895,104 @@ int HwpWrapper::GetTableColCount()
 
 bool HwpWrapper::TableLeftCell()
 {
+    CPYHWPX_TRACE_METHOD();
     return RunAction(L"TableLeftCell");
 }
 
 bool HwpWrapper::TableRightCell()
 {
+    CPYHWPX_TRACE_METHOD();
     return RunAction(L"TableRightCell");
 }
 
 bool HwpWrapper::TableUpperCell()
 {
+    CPYHWPX_TRACE_METHOD();
     return RunAction(L"TableUpperCell");
 }
 
 bool HwpWrapper::TableLowerCell()
 {
+    CPYHWPX_TRACE_METHOD();
     return RunAction(L"TableLowerCell");
 }
 
 bool HwpWrapper::TableRightCellAppend()
 {
+    CPYHWPX_TRACE_METHOD();
+    m_edits.Note(EditKind::Content);
     return RunAction(L"TableRightCellAppend");
 }
 
 bool HwpWrapper::TableColBegin()
 {
+    CPYHWPX_TRACE_METHOD();
     return RunAction(L"TableColBegin");
 }
 
 bool HwpWrapper::TableColEnd()
 {
+    CPYHWPX_TRACE_METHOD();
     return RunAction(L"TableColEnd");
 }
 
 bool HwpWrapper::TableColPageUp()
 {
+    CPYHWPX_TRACE_METHOD();
     return RunAction(L"TableColPageUp");
 }
 
 bool HwpWrapper::TableCellBlockExtendAbs()
 {
+    CPYHWPX_TRACE_METHOD();
     return RunAction(L"TableCellBlockExtendAbs");
 }
 
 bool HwpWrapper::Cancel()
 {
+    CPYHWPX_TRACE_METHOD();
     return RunAction(L"Cancel");
 }
 
 bool HwpWrapper::CellFill(int r, int g, int b)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Layout);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"CellFill");
+    }
 
     // CellShape 파라미터셋 생성
-    IDispatch* pSet = CreateSet(L"CellShape");
+    IDispatch* pSet = AcquireSet(L"CellShape");
     if (!pSet) return false;
 
     // FillAttr 하위 파라미터셋 접근
     DISPID dispidItem = m_dispidCache.GetOrLoad(pSet, L"Item");
     if (dispidItem == DISPID_UNKNOWN) {
-        pSet->Release();
+        ReleaseSet(L"CellShape", pSet);
         return false;
     }
 
+    static const BSTR s_fillAttr = InternBstr(L"FillAttr");
     VARIANT argFillAttr;
     VariantInit(&argFillAttr);
     argFillAttr.vt = VT_BSTR;
-    argFillAttr.bstrVal = SysAllocString(L"FillAttr");
+    argFillAttr.bstrVal = s_fillAttr;
 
     DISPPARAMS params = { &argFillAttr, NULL, 1, 0 };
-    VARIANT vFillAttr;
-    VariantInit(&vFillAttr);
+    ScopedVariant vFillAttr;
 
-    HRESULT hr = pSet->Invoke(dispidItem, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_PROPERTYGET, &params, &vFillAttr, NULL, NULL);
-    SysFreeString(argFillAttr.bstrVal);
+    HRESULT hr = ComInvoke(pSet, dispidItem, DISPATCH_PROPERTYGET, &params, vFillAttr.Receive(), NULL, NULL);
 
-    if (FAILED(hr) || vFillAttr.vt != VT_DISPATCH || !vFillAttr.pdispVal) {
-        pSet->Release();
+    if (FAILED(hr) || vFillAttr.vt() != VT_DISPATCH || !vFillAttr.get().pdispVal) {
+        ReleaseSet(L"CellShape", pSet);
         return false;
     }
 
-    IDispatch* pFillAttr = vFillAttr.pdispVal;
+    IDispatch* pFillAttr = vFillAttr.DetachDispatch();
 
     // FillAttr.Type = 1 (단색)
     DISPID dispidType = m_dispidCache.GetOrLoad(pFillAttr, L"Type");
@@ -4095,8 +4004,7 @@ bool HwpWrapper::CellFill(int r, int g, int b)
 
         DISPID dispidPut = DISPID_PROPERTYPUT;
         DISPPARAMS paramsType = { &vType, &dispidPut, 1, 1 };
-        pFillAttr->Invoke(dispidType, IID_NULL, LOCALE_USER_DEFAULT,
-                          DISPATCH_PROPERTYPUT, &paramsType, NULL, NULL, NULL);
+        ComInvoke(pFillAttr, dispidType, DISPATCH_PROPERTYPUT, &paramsType, NULL, NULL, NULL);
     }
 
     // FaceColor 설정 (RGB -> COLORREF)
@@ -4110,15 +4018,14 @@ bool HwpWrapper::CellFill(int r, int g, int b)
 
         DISPID dispidPut = DISPID_PROPERTYPUT;
         DISPPARAMS paramsColor = { &vColor, &dispidPut, 1, 1 };
-        pFillAttr->Invoke(dispidFaceColor, IID_NULL, LOCALE_USER_DEFAULT,
-                          DISPATCH_PROPERTYPUT, &paramsColor, NULL, NULL, NULL);
+        ComInvoke(pFillAttr, dispidFaceColor, DISPATCH_PROPERTYPUT, &paramsColor, NULL, NULL, NULL);
     }
 
     // CellShape 액션 실행
     IDispatch* pAction = CreateAction(L"CellShape");
     if (!pAction) {
         pFillAttr->Release();
-        pSet->Release();
+        ReleaseSet(L"CellShape", pSet);
         return false;
     }
 
@@ -4126,11 +4033,8 @@ bool HwpWrapper::CellFill(int r, int g, int b)
     DISPID dispidGetDefault = m_dispidCache.GetOrLoad(pAction, L"GetDefault");
     if (dispidGetDefault != DISPID_UNKNOWN) {
         DISPPARAMS paramsEmpty = { NULL, NULL, 0, 0 };
-        VARIANT vDefault;
-        VariantInit(&vDefault);
-        pAction->Invoke(dispidGetDefault, IID_NULL, LOCALE_USER_DEFAULT,
-                        DISPATCH_METHOD, &paramsEmpty, &vDefault, NULL, NULL);
-        VariantClear(&vDefault);
+        ScopedVariant vDefault;
+        ComInvoke(pAction, dispidGetDefault, DISPATCH_METHOD, &paramsEmpty, vDefault.Receive(), NULL, NULL);
     }
 
     // Execute
@@ -4143,20 +4047,17 @@ bool HwpWrapper::CellFill(int r, int g, int b)
         argSet.pdispVal = pSet;
 
         DISPPARAMS paramsExec = { &argSet, NULL, 1, 0 };
-        VARIANT vResult;
-        VariantInit(&vResult);
+        ScopedVariant vResult;
 
-        hr = pAction->Invoke(dispidExecute, IID_NULL, LOCALE_USER_DEFAULT,
-                             DISPATCH_METHOD, &paramsExec, &vResult, NULL, NULL);
-        if (SUCCEEDED(hr) && vResult.vt == VT_BOOL) {
-            success = (vResult.boolVal != VARIANT_FALSE);
+        hr = ComInvoke(pAction, dispidExecute, DISPATCH_METHOD, &paramsExec, vResult.Receive(), NULL, NULL);
+        if (SUCCEEDED(hr) && vResult.vt() == VT_BOOL) {
+            success = vResult.ToBool();
         }
-        VariantClear(&vResult);
     }
 
     pAction->Release();
     pFillAttr->Release();
-    pSet->Release();
+    ReleaseSet(L"CellShape", pSet);
 
     return success;
 }
@@ -4170,6 +4071,7 @@ bool HwpWrapper::TableFromData(
     int cell_fill_g,
     int cell_fill_b)
 {
+    CPYHWPX_TRACE_METHOD();
     if (data.empty() || data[0].empty()) return false;
 
     int rows = static_cast<int>(data.size());
@@ -4223,11 +4125,18 @@ bool HwpWrapper::TableFromData(
 
 std::wstring HwpWrapper::GetTableXml()
 {
+    CPYHWPX_TRACE_METHOD();
+    return GetTableXmlBstr().str();
+}
+
+BstrString HwpWrapper::GetTableXmlBstr()
+{
+    CPYHWPX_TRACE_METHOD();
     // 현재 테이블의 XML 추출 (HWPML2X 형식)
     // Python에서 파싱하여 DataFrame으로 변환
 
     if (!IsCell()) {
-        return L"";
+        return BstrString();
     }
 
     // 1. 테이블 전체 선택
@@ -4242,7 +4151,7 @@ std::wstring HwpWrapper::GetTableXml()
     }
 
     // 2. 선택된 테이블을 HWPML2X로 추출
-    std::wstring xml = GetTextFile(L"HWPML2X", L"");
+    BstrString xml = GetTextFileBstr(L"HWPML2X", L"");
 
     // 3. 선택 취소
     Cancel();
@@ -4263,13 +4172,16 @@ bool HwpWrapper::InsertPicture(const std::wstring& path,
                                 int width,
                                 int height)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
 
     DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"InsertPicture");
     if (dispid == DISPID_UNKNOWN) return false;
 
     // InsertPicture 파라미터 (역순)
     // Path, Embedded, sizeoption, Reverse, watermark, Effect, Width, Height
+    ScopedBstr pathBstr(path);
     VARIANT args[8];
     for (int i = 0; i < 8; i++) VariantInit(&args[i]);
 
@@ -4281,26 +4193,15 @@ bool HwpWrapper::InsertPicture(const std::wstring& path,
     args[4].vt = VT_BOOL;  args[4].boolVal = reverse ? VARIANT_TRUE : VARIANT_FALSE;   // Reverse
     args[5].vt = VT_I4;    args[5].lVal = sizeoption;                                // sizeoption
     args[6].vt = VT_BOOL;  args[6].boolVal = embedded ? VARIANT_TRUE : VARIANT_FALSE;  // Embedded
-    args[7].vt = VT_BSTR;  args[7].bstrVal = SysAllocString(path.c_str());           // Path
+    args[7] = BstrArg(pathBstr.get());                                               // Path
 
     DISPPARAMS params = { args, NULL, 8, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    HRESULT hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_METHOD, &params, &result, NULL, NULL);
-
-    SysFreeString(args[7].bstrVal);
+    HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD, &params, result.Receive(), NULL, NULL);
 
     // InsertPicture는 컨트롤 객체 반환 (성공 시 VT_DISPATCH)
-    bool success = SUCCEEDED(hr) && result.vt == VT_DISPATCH && result.pdispVal != nullptr;
-
-    if (result.vt == VT_DISPATCH && result.pdispVal) {
-        result.pdispVal->Release();
-    }
-    VariantClear(&result);
-
-    return success;
+    return SUCCEEDED(hr) && result.vt() == VT_DISPATCH && result.get().pdispVal != nullptr;
 }
 
 //=============================================================================
@@ -4309,31 +4210,28 @@ bool HwpWrapper::InsertPicture(const std::wstring& path,
 
 std::map<std::wstring, int> HwpWrapper::GetCharShape()
 {
+    CPYHWPX_TRACE_METHOD();
     std::map<std::wstring, int> result;
     if (!m_pHwp) return result;
 
     // hwp.CharShape 속성 가져오기 (HParameterSet.HCharShape가 아님!)
     DISPID dispidCharShape;
     OLECHAR* charShapeName = const_cast<OLECHAR*>(L"CharShape");
-    HRESULT hr = m_pHwp->GetIDsOfNames(IID_NULL, &charShapeName, 1,
-                                        LOCALE_USER_DEFAULT, &dispidCharShape);
+    HRESULT hr = ComGetIDsOfNames(m_pHwp, &charShapeName, 1, &dispidCharShape);
     if (FAILED(hr)) {
         result[L"_error"] = -30000 - (int)(hr & 0xFFFF);
         return result;
     }
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VARIANT vCharShape;
-    VariantInit(&vCharShape);
-    hr = m_pHwp->Invoke(dispidCharShape, IID_NULL, LOCALE_USER_DEFAULT,
-                         DISPATCH_PROPERTYGET, &noParams, &vCharShape, NULL, NULL);
-    if (FAILED(hr) || vCharShape.vt != VT_DISPATCH || !vCharShape.pdispVal) {
+    ScopedVariant vCharShape;
+    hr = ComInvoke(m_pHwp, dispidCharShape, DISPATCH_PROPERTYGET, &noParams, vCharShape.Receive(), NULL, NULL);
+    if (FAILED(hr) || vCharShape.vt() != VT_DISPATCH || !vCharShape.get().pdispVal) {
         result[L"_error"] = -31000 - (int)(hr & 0xFFFF);
-        VariantClear(&vCharShape);
         return result;
     }
 
-    IDispatch* pCharShape = vCharShape.pdispVal;
+    IDispatch* pCharShape = vCharShape.DetachDispatch();
 
     // 주요 CharShape 속성들
     const wchar_t* charShapeProps[] = {
@@ -4358,49 +4256,44 @@ std::map<std::wstring, int> HwpWrapper::GetCharShape()
     // Item 메서드 DISPID 가져오기
     DISPID dispidItem;
     OLECHAR* itemName = const_cast<OLECHAR*>(L"Item");
-    hr = pCharShape->GetIDsOfNames(IID_NULL, &itemName, 1, LOCALE_USER_DEFAULT, &dispidItem);
+    hr = ComGetIDsOfNames(pCharShape, &itemName, 1, &dispidItem);
     if (SUCCEEDED(hr)) {
         for (const wchar_t* propName : charShapeProps) {
-            VARIANT vPropName;
-            VariantInit(&vPropName);
-            vPropName.vt = VT_BSTR;
-            vPropName.bstrVal = SysAllocString(propName);
+            VARIANT vPropName = BstrArg(InternBstr(propName));     // 상수 이름: 해제 금지
 
             DISPPARAMS itemParams = { &vPropName, NULL, 1, 0 };
-            VARIANT vValue;
-            VariantInit(&vValue);
+            ScopedVariant vValue;
 
             // Item은 메서드이므로 DISPATCH_METHOD 사용
-            hr = pCharShape->Invoke(dispidItem, IID_NULL, LOCALE_USER_DEFAULT,
-                                     DISPATCH_METHOD, &itemParams, &vValue, NULL, NULL);
+            hr = ComInvoke(pCharShape, dispidItem, DISPATCH_METHOD, &itemParams, vValue.Receive(), NULL, NULL);
             if (SUCCEEDED(hr)) {
-                switch (vValue.vt) {
+                switch (vValue.vt()) {
                     case VT_I4:
-                        result[propName] = vValue.lVal;
+                        result[propName] = vValue.get().lVal;
                         break;
                     case VT_I2:
-                        result[propName] = vValue.iVal;
+                        result[propName] = vValue.get().iVal;
                         break;
                     case VT_I1:
-                        result[propName] = vValue.cVal;
+                        result[propName] = vValue.get().cVal;
                         break;
                     case VT_UI1:
-                        result[propName] = vValue.bVal;
+                        result[propName] = vValue.get().bVal;
                         break;
                     case VT_UI2:
-                        result[propName] = vValue.uiVal;
+                        result[propName] = vValue.get().uiVal;
                         break;
                     case VT_UI4:
-                        result[propName] = static_cast<int>(vValue.ulVal);
+                        result[propName] = static_cast<int>(vValue.get().ulVal);
                         break;
                     case VT_BOOL:
-                        result[propName] = (vValue.boolVal != VARIANT_FALSE) ? 1 : 0;
+                        result[propName] = vValue.ToBool() ? 1 : 0;
                         break;
                     case VT_R4:
-                        result[propName] = static_cast<int>(vValue.fltVal);
+                        result[propName] = static_cast<int>(vValue.get().fltVal);
                         break;
                     case VT_R8:
-                        result[propName] = static_cast<int>(vValue.dblVal);
+                        result[propName] = static_cast<int>(vValue.get().dblVal);
                         break;
                     case VT_EMPTY:
                     case VT_NULL:
@@ -4408,12 +4301,10 @@ std::map<std::wstring, int> HwpWrapper::GetCharShape()
                         break;
                     default:
                         // 디버그: 알 수 없는 타입 (음수로 타입 코드 저장)
-                        result[propName] = -1000 - (int)vValue.vt;
+                        result[propName] = -1000 - (int)vValue.vt();
                         break;
                 }
             }
-            VariantClear(&vValue);
-            SysFreeString(vPropName.bstrVal);
         }
     } else {
         result[L"_error"] = -20000 - (int)(hr & 0xFFFF);
@@ -4425,7 +4316,14 @@ std::map<std::wstring, int> HwpWrapper::GetCharShape()
 
 bool HwpWrapper::SetCharShape(const std::map<std::wstring, int>& props)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || props.empty()) return false;
+    m_edits.Note(EditKind::Layout);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnExecuteProps(L"CharShape", L"CharShape", props);
+    }
 
     // 1. HParameterSet.HCharShape 가져오기
     IDispatch* pHParameterSet = GetHParameterSet();
@@ -4433,42 +4331,35 @@ bool HwpWrapper::SetCharShape(const std::map<std::wstring, int>& props)
 
     DISPID dispidHCharShape;
     OLECHAR* charShapeName = const_cast<OLECHAR*>(L"HCharShape");
-    HRESULT hr = pHParameterSet->GetIDsOfNames(IID_NULL, &charShapeName, 1,
-                                                LOCALE_USER_DEFAULT, &dispidHCharShape);
+    HRESULT hr = ComGetIDsOfNames(pHParameterSet, &charShapeName, 1, &dispidHCharShape);
     if (FAILED(hr)) return false;
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VARIANT vCharShape;
-    VariantInit(&vCharShape);
-    hr = pHParameterSet->Invoke(dispidHCharShape, IID_NULL, LOCALE_USER_DEFAULT,
-                                 DISPATCH_PROPERTYGET, &noParams, &vCharShape, NULL, NULL);
-    if (FAILED(hr) || vCharShape.vt != VT_DISPATCH || !vCharShape.pdispVal) {
-        VariantClear(&vCharShape);
+    ScopedVariant vCharShape;
+    hr = ComInvoke(pHParameterSet, dispidHCharShape, DISPATCH_PROPERTYGET, &noParams, vCharShape.Receive(), NULL, NULL);
+    if (FAILED(hr) || vCharShape.vt() != VT_DISPATCH || !vCharShape.get().pdispVal) {
         return false;
     }
 
-    IDispatch* pCharShape = vCharShape.pdispVal;
+    IDispatch* pCharShape = vCharShape.DetachDispatch();
 
     // 2. HSet 가져오기 (Execute에 필요)
     DISPID dispidHSet;
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pCharShape->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispidHSet);
+    hr = ComGetIDsOfNames(pCharShape, &hsetName, 1, &dispidHSet);
     if (FAILED(hr)) {
         pCharShape->Release();
         return false;
     }
 
-    VARIANT vHSet;
-    VariantInit(&vHSet);
-    hr = pCharShape->Invoke(dispidHSet, IID_NULL, LOCALE_USER_DEFAULT,
-                             DISPATCH_PROPERTYGET, &noParams, &vHSet, NULL, NULL);
-    if (FAILED(hr) || vHSet.vt != VT_DISPATCH || !vHSet.pdispVal) {
-        VariantClear(&vHSet);
+    ScopedVariant vHSet;
+    hr = ComInvoke(pCharShape, dispidHSet, DISPATCH_PROPERTYGET, &noParams, vHSet.Receive(), NULL, NULL);
+    if (FAILED(hr) || vHSet.vt() != VT_DISPATCH || !vHSet.get().pdispVal) {
         pCharShape->Release();
         return false;
     }
 
-    IDispatch* pHSet = vHSet.pdispVal;
+    IDispatch* pHSet = vHSet.DetachDispatch();
 
     // 3. 속성값 설정 (각 속성을 직접 설정) - GetDefault 호출 없이!
     IDispatch* pHAction = GetHAction();
@@ -4481,18 +4372,14 @@ bool HwpWrapper::SetCharShape(const std::map<std::wstring, int>& props)
     for (const auto& prop : props) {
         DISPID dispidProp;
         OLECHAR* propName = const_cast<OLECHAR*>(prop.first.c_str());
-        hr = pCharShape->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &dispidProp);
+        hr = ComGetIDsOfNames(pCharShape, &propName, 1, &dispidProp);
         if (SUCCEEDED(hr)) {
-            VARIANT vValue;
-            VariantInit(&vValue);
-            vValue.vt = VT_I4;
-            vValue.lVal = prop.second;
+            VARIANT vValue = IntArg(prop.second);
 
             DISPID putid = DISPID_PROPERTYPUT;
             DISPPARAMS params = { &vValue, &putid, 1, 1 };
 
-            pCharShape->Invoke(dispidProp, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_PROPERTYPUT, &params, NULL, NULL, NULL);
+            ComInvoke(pCharShape, dispidProp, DISPATCH_PROPERTYPUT, &params, NULL, NULL, NULL);
         }
     }
 
@@ -4500,30 +4387,26 @@ bool HwpWrapper::SetCharShape(const std::map<std::wstring, int>& props)
     bool success = false;
     DISPID dispidExecute;
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispidExecute);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispidExecute);
     if (SUCCEEDED(hr)) {
+        static const BSTR s_charShape = InternBstr(L"CharShape");
         VARIANT args[2];
         VariantInit(&args[0]);
         VariantInit(&args[1]);
         args[0].vt = VT_DISPATCH;
         args[0].pdispVal = pHSet;
         args[1].vt = VT_BSTR;
-        args[1].bstrVal = SysAllocString(L"CharShape");
+        args[1].bstrVal = s_charShape;
 
         DISPPARAMS params = { args, NULL, 2, 0 };
-        VARIANT vResult;
-        VariantInit(&vResult);
+        ScopedVariant vResult;
 
-        hr = pHAction->Invoke(dispidExecute, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_METHOD, &params, &vResult, NULL, NULL);
-        if (SUCCEEDED(hr) && vResult.vt == VT_BOOL) {
-            success = (vResult.boolVal != VARIANT_FALSE);
+        hr = ComInvoke(pHAction, dispidExecute, DISPATCH_METHOD, &params, vResult.Receive(), NULL, NULL);
+        if (SUCCEEDED(hr) && vResult.vt() == VT_BOOL) {
+            success = vResult.ToBool();
         } else if (SUCCEEDED(hr)) {
             success = true;
         }
-
-        SysFreeString(args[1].bstrVal);
-        VariantClear(&vResult);
     }
 
     pHSet->Release();
@@ -4538,6 +4421,7 @@ bool HwpWrapper::SetFont(const std::wstring& face_name,
                           int italic,
                           int text_color)
 {
+    CPYHWPX_TRACE_METHOD();
     std::map<std::wstring, int> props;
 
     if (height >= 0) {
@@ -4553,6 +4437,12 @@ bool HwpWrapper::SetFont(const std::wstring& face_name,
         props[L"TextColor"] = text_color;
     }
 
+    // 글꼴 이름은 원시 IDispatch로 쓰므로 안쪽 SetCharShape 대신 재생 불가로 기록
+    ActionRecorder::Scope recordScope(face_name.empty() ? nullptr : m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"SetFont");
+    }
+
     // 글꼴 이름 설정은 별도 처리 필요 (문자열 속성)
     if (!face_name.empty()) {
         // 간단히 HAction 방식 사용
@@ -4563,42 +4453,27 @@ bool HwpWrapper::SetFont(const std::wstring& face_name,
 
         DISPID dispidHCharShape;
         OLECHAR* charShapeName = const_cast<OLECHAR*>(L"HCharShape");
-        HRESULT hr = pHParameterSet->GetIDsOfNames(IID_NULL, &charShapeName, 1,
-                                                    LOCALE_USER_DEFAULT, &dispidHCharShape);
+        HRESULT hr = ComGetIDsOfNames(pHParameterSet, &charShapeName, 1, &dispidHCharShape);
         if (SUCCEEDED(hr)) {
             DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-            VARIANT vCharShape;
-            VariantInit(&vCharShape);
-            hr = pHParameterSet->Invoke(dispidHCharShape, IID_NULL, LOCALE_USER_DEFAULT,
-                                         DISPATCH_PROPERTYGET, &noParams, &vCharShape, NULL, NULL);
-            if (SUCCEEDED(hr) && vCharShape.vt == VT_DISPATCH && vCharShape.pdispVal) {
-                IDispatch* pCharShape = vCharShape.pdispVal;
+            ScopedVariant vCharShape;
+            hr = ComInvoke(pHParameterSet, dispidHCharShape, DISPATCH_PROPERTYGET, &noParams, vCharShape.Receive(), NULL, NULL);
+            if (SUCCEEDED(hr) && vCharShape.vt() == VT_DISPATCH && vCharShape.get().pdispVal) {
+                IDispatch* pCharShape = vCharShape.DetachDispatch();
 
                 DISPID dispidItem;
                 OLECHAR* itemName = const_cast<OLECHAR*>(L"Item");
-                hr = pCharShape->GetIDsOfNames(IID_NULL, &itemName, 1, LOCALE_USER_DEFAULT, &dispidItem);
+                hr = ComGetIDsOfNames(pCharShape, &itemName, 1, &dispidItem);
                 if (SUCCEEDED(hr)) {
                     // FaceNameHangul 설정
                     const wchar_t* fontProps[] = { L"FaceNameHangul", L"FaceNameLatin", L"FaceNameHanja" };
+                    ScopedBstr faceBstr(face_name);
                     for (const wchar_t* fontProp : fontProps) {
-                        VARIANT vPropName, vValue;
-                        VariantInit(&vPropName);
-                        VariantInit(&vValue);
-
-                        vPropName.vt = VT_BSTR;
-                        vPropName.bstrVal = SysAllocString(fontProp);
-                        vValue.vt = VT_BSTR;
-                        vValue.bstrVal = SysAllocString(face_name.c_str());
-
-                        VARIANT args[2] = { vValue, vPropName };
+                        VARIANT args[2] = { BstrArg(faceBstr.get()), BstrArg(InternBstr(fontProp)) };
                         DISPID putid = DISPID_PROPERTYPUT;
                         DISPPARAMS itemParams = { args, &putid, 2, 1 };
 
-                        pCharShape->Invoke(dispidItem, IID_NULL, LOCALE_USER_DEFAULT,
-                                            DISPATCH_PROPERTYPUT, &itemParams, NULL, NULL, NULL);
-
-                        SysFreeString(vPropName.bstrVal);
-                        SysFreeString(vValue.bstrVal);
+                        ComInvoke(pCharShape, dispidItem, DISPATCH_PROPERTYPUT, &itemParams, NULL, NULL, NULL);
                     }
                 }
                 pCharShape->Release();
@@ -4624,62 +4499,54 @@ bool HwpWrapper::SetFont(const std::wstring& face_name,
 
         DISPID dispidHCharShape;
         OLECHAR* charShapeName = const_cast<OLECHAR*>(L"HCharShape");
-        HRESULT hr = pHParameterSet->GetIDsOfNames(IID_NULL, &charShapeName, 1,
-                                                    LOCALE_USER_DEFAULT, &dispidHCharShape);
+        HRESULT hr = ComGetIDsOfNames(pHParameterSet, &charShapeName, 1, &dispidHCharShape);
         if (FAILED(hr)) return false;
 
         DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-        VARIANT vCharShape;
-        VariantInit(&vCharShape);
-        hr = pHParameterSet->Invoke(dispidHCharShape, IID_NULL, LOCALE_USER_DEFAULT,
-                                     DISPATCH_PROPERTYGET, &noParams, &vCharShape, NULL, NULL);
-        if (FAILED(hr) || vCharShape.vt != VT_DISPATCH) return false;
+        ScopedVariant vCharShape;
+        hr = ComInvoke(pHParameterSet, dispidHCharShape, DISPATCH_PROPERTYGET, &noParams, vCharShape.Receive(), NULL, NULL);
+        if (FAILED(hr) || vCharShape.vt() != VT_DISPATCH) return false;
 
-        IDispatch* pCharShape = vCharShape.pdispVal;
+        IDispatch* pCharShape = vCharShape.DetachDispatch();
 
         DISPID dispidHSet;
         OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-        hr = pCharShape->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispidHSet);
+        hr = ComGetIDsOfNames(pCharShape, &hsetName, 1, &dispidHSet);
         if (FAILED(hr)) {
             pCharShape->Release();
             return false;
         }
 
-        VARIANT vHSet;
-        VariantInit(&vHSet);
-        hr = pCharShape->Invoke(dispidHSet, IID_NULL, LOCALE_USER_DEFAULT,
-                                 DISPATCH_PROPERTYGET, &noParams, &vHSet, NULL, NULL);
-        if (FAILED(hr) || vHSet.vt != VT_DISPATCH) {
+        ScopedVariant vHSet;
+        hr = ComInvoke(pCharShape, dispidHSet, DISPATCH_PROPERTYGET, &noParams, vHSet.Receive(), NULL, NULL);
+        if (FAILED(hr) || vHSet.vt() != VT_DISPATCH) {
             pCharShape->Release();
             return false;
         }
 
-        IDispatch* pHSet = vHSet.pdispVal;
+        IDispatch* pHSet = vHSet.DetachDispatch();
 
         // Execute
         DISPID dispidExecute;
         OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-        hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispidExecute);
+        hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispidExecute);
         bool success = false;
         if (SUCCEEDED(hr)) {
+            static const BSTR s_charShape = InternBstr(L"CharShape");
             VARIANT args[2];
             VariantInit(&args[0]);
             VariantInit(&args[1]);
             args[0].vt = VT_DISPATCH;
             args[0].pdispVal = pHSet;
             args[1].vt = VT_BSTR;
-            args[1].bstrVal = SysAllocString(L"CharShape");
+            args[1].bstrVal = s_charShape;
 
             DISPPARAMS params = { args, NULL, 2, 0 };
-            VARIANT vResult;
-            VariantInit(&vResult);
+            ScopedVariant vResult;
 
-            hr = pHAction->Invoke(dispidExecute, IID_NULL, LOCALE_USER_DEFAULT,
-                                   DISPATCH_METHOD, &params, &vResult, NULL, NULL);
+            hr = ComInvoke(pHAction, dispidExecute, DISPATCH_METHOD, &params, vResult.Receive(), NULL, NULL);
             success = SUCCEEDED(hr);
-
-            SysFreeString(args[1].bstrVal);
-            VariantClear(&vResult);
+            m_edits.Note(EditKind::Layout);
         }
 
         pHSet->Release();
@@ -4692,6 +4559,7 @@ bool HwpWrapper::SetFont(const std::wstring& face_name,
 
 std::map<std::wstring, int> HwpWrapper::GetParaShape()
 {
+    CPYHWPX_TRACE_METHOD();
     std::map<std::wstring, int> result;
     if (!m_pHwp) return result;
 
@@ -4701,21 +4569,17 @@ std::map<std::wstring, int> HwpWrapper::GetParaShape()
 
     DISPID dispidHParaShape;
     OLECHAR* paraShapeName = const_cast<OLECHAR*>(L"HParaShape");
-    HRESULT hr = pHParameterSet->GetIDsOfNames(IID_NULL, &paraShapeName, 1,
-                                                LOCALE_USER_DEFAULT, &dispidHParaShape);
+    HRESULT hr = ComGetIDsOfNames(pHParameterSet, &paraShapeName, 1, &dispidHParaShape);
     if (FAILED(hr)) return result;
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VARIANT vParaShape;
-    VariantInit(&vParaShape);
-    hr = pHParameterSet->Invoke(dispidHParaShape, IID_NULL, LOCALE_USER_DEFAULT,
-                                 DISPATCH_PROPERTYGET, &noParams, &vParaShape, NULL, NULL);
-    if (FAILED(hr) || vParaShape.vt != VT_DISPATCH || !vParaShape.pdispVal) {
-        VariantClear(&vParaShape);
+    ScopedVariant vParaShape;
+    hr = ComInvoke(pHParameterSet, dispidHParaShape, DISPATCH_PROPERTYGET, &noParams, vParaShape.Receive(), NULL, NULL);
+    if (FAILED(hr) || vParaShape.vt() != VT_DISPATCH || !vParaShape.get().pdispVal) {
         return result;
     }
 
-    IDispatch* pParaShape = vParaShape.pdispVal;
+    IDispatch* pParaShape = vParaShape.DetachDispatch();
 
     // 2. HAction.GetDefault 호출
     IDispatch* pHAction = GetHAction();
@@ -4726,44 +4590,38 @@ std::map<std::wstring, int> HwpWrapper::GetParaShape()
 
     DISPID dispidHSet;
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pParaShape->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispidHSet);
+    hr = ComGetIDsOfNames(pParaShape, &hsetName, 1, &dispidHSet);
     if (FAILED(hr)) {
         pParaShape->Release();
         return result;
     }
 
-    VARIANT vHSet;
-    VariantInit(&vHSet);
-    hr = pParaShape->Invoke(dispidHSet, IID_NULL, LOCALE_USER_DEFAULT,
-                             DISPATCH_PROPERTYGET, &noParams, &vHSet, NULL, NULL);
-    if (FAILED(hr) || vHSet.vt != VT_DISPATCH || !vHSet.pdispVal) {
-        VariantClear(&vHSet);
+    ScopedVariant vHSet;
+    hr = ComInvoke(pParaShape, dispidHSet, DISPATCH_PROPERTYGET, &noParams, vHSet.Receive(), NULL, NULL);
+    if (FAILED(hr) || vHSet.vt() != VT_DISPATCH || !vHSet.get().pdispVal) {
         pParaShape->Release();
         return result;
     }
 
-    IDispatch* pHSet = vHSet.pdispVal;
+    IDispatch* pHSet = vHSet.DetachDispatch();
 
     // GetDefault 호출
     DISPID dispidGetDefault;
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispidGetDefault);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispidGetDefault);
     if (SUCCEEDED(hr)) {
+        static const BSTR s_paraShape = InternBstr(L"ParaShape");
         VARIANT args[2];
         VariantInit(&args[0]);
         VariantInit(&args[1]);
         args[0].vt = VT_DISPATCH;
         args[0].pdispVal = pHSet;
         args[1].vt = VT_BSTR;
-        args[1].bstrVal = SysAllocString(L"ParaShape");
+        args[1].bstrVal = s_paraShape;
 
         DISPPARAMS params = { args, NULL, 2, 0 };
-        VARIANT vResult;
-        VariantInit(&vResult);
-        pHAction->Invoke(dispidGetDefault, IID_NULL, LOCALE_USER_DEFAULT,
-                         DISPATCH_METHOD, &params, &vResult, NULL, NULL);
-        SysFreeString(args[1].bstrVal);
-        VariantClear(&vResult);
+        ScopedVariant vResult;
+        ComInvoke(pHAction, dispidGetDefault, DISPATCH_METHOD, &params, vResult.Receive(), NULL, NULL);
     }
 
     // 3. 속성값 읽기 (주요 ParaShape 속성들)
@@ -4783,31 +4641,24 @@ std::map<std::wstring, int> HwpWrapper::GetParaShape()
 
     DISPID dispidItem;
     OLECHAR* itemName = const_cast<OLECHAR*>(L"Item");
-    hr = pParaShape->GetIDsOfNames(IID_NULL, &itemName, 1, LOCALE_USER_DEFAULT, &dispidItem);
+    hr = ComGetIDsOfNames(pParaShape, &itemName, 1, &dispidItem);
     if (SUCCEEDED(hr)) {
         for (const wchar_t* propName : paraShapeProps) {
-            VARIANT vPropName;
-            VariantInit(&vPropName);
-            vPropName.vt = VT_BSTR;
-            vPropName.bstrVal = SysAllocString(propName);
+            VARIANT vPropName = BstrArg(InternBstr(propName));     // 상수 이름: 해제 금지
 
             DISPPARAMS itemParams = { &vPropName, NULL, 1, 0 };
-            VARIANT vValue;
-            VariantInit(&vValue);
+            ScopedVariant vValue;
 
-            hr = pParaShape->Invoke(dispidItem, IID_NULL, LOCALE_USER_DEFAULT,
-                                     DISPATCH_PROPERTYGET, &itemParams, &vValue, NULL, NULL);
+            hr = ComInvoke(pParaShape, dispidItem, DISPATCH_PROPERTYGET, &itemParams, vValue.Receive(), NULL, NULL);
             if (SUCCEEDED(hr)) {
-                if (vValue.vt == VT_I4) {
-                    result[propName] = vValue.lVal;
-                } else if (vValue.vt == VT_I2) {
-                    result[propName] = vValue.iVal;
-                } else if (vValue.vt == VT_BOOL) {
-                    result[propName] = (vValue.boolVal != VARIANT_FALSE) ? 1 : 0;
+                if (vValue.vt() == VT_I4) {
+                    result[propName] = vValue.get().lVal;
+                } else if (vValue.vt() == VT_I2) {
+                    result[propName] = vValue.get().iVal;
+                } else if (vValue.vt() == VT_BOOL) {
+                    result[propName] = vValue.ToBool() ? 1 : 0;
                 }
             }
-            VariantClear(&vValue);
-            SysFreeString(vPropName.bstrVal);
         }
     }
 
@@ -4819,7 +4670,14 @@ std::map<std::wstring, int> HwpWrapper::GetParaShape()
 
 bool HwpWrapper::SetParaShape(const std::map<std::wstring, int>& props)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || props.empty()) return false;
+    m_edits.Note(EditKind::Layout);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnExecuteProps(L"ParaShape", L"ParaShape", props);
+    }
 
     // 1. HParameterSet.HParaShape 가져오기
     IDispatch* pHParameterSet = GetHParameterSet();
@@ -4827,21 +4685,17 @@ bool HwpWrapper::SetParaShape(const std::map<std::wstring, int>& props)
 
     DISPID dispidHParaShape;
     OLECHAR* paraShapeName = const_cast<OLECHAR*>(L"HParaShape");
-    HRESULT hr = pHParameterSet->GetIDsOfNames(IID_NULL, &paraShapeName, 1,
-                                                LOCALE_USER_DEFAULT, &dispidHParaShape);
+    HRESULT hr = ComGetIDsOfNames(pHParameterSet, &paraShapeName, 1, &dispidHParaShape);
     if (FAILED(hr)) return false;
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VARIANT vParaShape;
-    VariantInit(&vParaShape);
-    hr = pHParameterSet->Invoke(dispidHParaShape, IID_NULL, LOCALE_USER_DEFAULT,
-                                 DISPATCH_PROPERTYGET, &noParams, &vParaShape, NULL, NULL);
-    if (FAILED(hr) || vParaShape.vt != VT_DISPATCH || !vParaShape.pdispVal) {
-        VariantClear(&vParaShape);
+    ScopedVariant vParaShape;
+    hr = ComInvoke(pHParameterSet, dispidHParaShape, DISPATCH_PROPERTYGET, &noParams, vParaShape.Receive(), NULL, NULL);
+    if (FAILED(hr) || vParaShape.vt() != VT_DISPATCH || !vParaShape.get().pdispVal) {
         return false;
     }
 
-    IDispatch* pParaShape = vParaShape.pdispVal;
+    IDispatch* pParaShape = vParaShape.DetachDispatch();
 
     // 2. HAction.GetDefault 호출
     IDispatch* pHAction = GetHAction();
@@ -4852,28 +4706,26 @@ bool HwpWrapper::SetParaShape(const std::map<std::wstring, int>& props)
 
     DISPID dispidHSet;
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pParaShape->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispidHSet);
+    hr = ComGetIDsOfNames(pParaShape, &hsetName, 1, &dispidHSet);
     if (FAILED(hr)) {
         pParaShape->Release();
         return false;
     }
 
-    VARIANT vHSet;
-    VariantInit(&vHSet);
-    hr = pParaShape->Invoke(dispidHSet, IID_NULL, LOCALE_USER_DEFAULT,
-                             DISPATCH_PROPERTYGET, &noParams, &vHSet, NULL, NULL);
-    if (FAILED(hr) || vHSet.vt != VT_DISPATCH || !vHSet.pdispVal) {
-        VariantClear(&vHSet);
+    ScopedVariant vHSet;
+    hr = ComInvoke(pParaShape, dispidHSet, DISPATCH_PROPERTYGET, &noParams, vHSet.Receive(), NULL, NULL);
+    if (FAILED(hr) || vHSet.vt() != VT_DISPATCH || !vHSet.get().pdispVal) {
         pParaShape->Release();
         return false;
     }
 
-    IDispatch* pHSet = vHSet.pdispVal;
+    IDispatch* pHSet = vHSet.DetachDispatch();
 
     // GetDefault 호출
+    static const BSTR s_paraShape = InternBstr(L"ParaShape");
     DISPID dispidGetDefault;
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispidGetDefault);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispidGetDefault);
     if (SUCCEEDED(hr)) {
         VARIANT args[2];
         VariantInit(&args[0]);
@@ -4881,48 +4733,26 @@ bool HwpWrapper::SetParaShape(const std::map<std::wstring, int>& props)
         args[0].vt = VT_DISPATCH;
         args[0].pdispVal = pHSet;
         args[1].vt = VT_BSTR;
-        args[1].bstrVal = SysAllocString(L"ParaShape");
+        args[1].bstrVal = s_paraShape;
 
         DISPPARAMS params = { args, NULL, 2, 0 };
-        VARIANT vResult;
-        VariantInit(&vResult);
-        pHAction->Invoke(dispidGetDefault, IID_NULL, LOCALE_USER_DEFAULT,
-                         DISPATCH_METHOD, &params, &vResult, NULL, NULL);
-        SysFreeString(args[1].bstrVal);
-        VariantClear(&vResult);
+        ScopedVariant vResult;
+        ComInvoke(pHAction, dispidGetDefault, DISPATCH_METHOD, &params, vResult.Receive(), NULL, NULL);
     }
 
-    // 3. 속성값 설정
-    DISPID dispidItem;
-    OLECHAR* itemName = const_cast<OLECHAR*>(L"Item");
-    hr = pParaShape->GetIDsOfNames(IID_NULL, &itemName, 1, LOCALE_USER_DEFAULT, &dispidItem);
-    if (SUCCEEDED(hr)) {
-        for (const auto& prop : props) {
-            VARIANT vPropName, vValue;
-            VariantInit(&vPropName);
-            VariantInit(&vValue);
-
-            vPropName.vt = VT_BSTR;
-            vPropName.bstrVal = SysAllocString(prop.first.c_str());
-            vValue.vt = VT_I4;
-            vValue.lVal = prop.second;
-
-            VARIANT args[2] = { vValue, vPropName };
-            DISPID putid = DISPID_PROPERTYPUT;
-            DISPPARAMS itemParams = { args, &putid, 2, 1 };
-
-            pParaShape->Invoke(dispidItem, IID_NULL, LOCALE_USER_DEFAULT,
-                                DISPATCH_PROPERTYPUT, &itemParams, NULL, NULL, NULL);
-
-            SysFreeString(vPropName.bstrVal);
-        }
+    // 3. 속성값 설정 (Item DISPID 캐시 + 상수 이름 BSTR)
+    std::vector<std::pair<std::wstring, VARIANT>> items;
+    items.reserve(props.size());
+    for (const auto& prop : props) {
+        items.emplace_back(prop.first, IntArg(prop.second));
     }
+    HwpParameterSet(pParaShape, L"HParaShape").SetItems(items);
 
     // 4. HAction.Execute 호출
     bool success = false;
     DISPID dispidExecute;
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispidExecute);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispidExecute);
     if (SUCCEEDED(hr)) {
         VARIANT args[2];
         VariantInit(&args[0]);
@@ -4930,22 +4760,17 @@ bool HwpWrapper::SetParaShape(const std::map<std::wstring, int>& props)
         args[0].vt = VT_DISPATCH;
         args[0].pdispVal = pHSet;
         args[1].vt = VT_BSTR;
-        args[1].bstrVal = SysAllocString(L"ParaShape");
+        args[1].bstrVal = s_paraShape;
 
         DISPPARAMS params = { args, NULL, 2, 0 };
-        VARIANT vResult;
-        VariantInit(&vResult);
+        ScopedVariant vResult;
 
-        hr = pHAction->Invoke(dispidExecute, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_METHOD, &params, &vResult, NULL, NULL);
-        if (SUCCEEDED(hr) && vResult.vt == VT_BOOL) {
-            success = (vResult.boolVal != VARIANT_FALSE);
+        hr = ComInvoke(pHAction, dispidExecute, DISPATCH_METHOD, &params, vResult.Receive(), NULL, NULL);
+        if (SUCCEEDED(hr) && vResult.vt() == VT_BOOL) {
+            success = vResult.ToBool();
         } else if (SUCCEEDED(hr)) {
             success = true;
         }
-
-        SysFreeString(args[1].bstrVal);
-        VariantClear(&vResult);
     }
 
     pHSet->Release();
@@ -4959,6 +4784,7 @@ bool HwpWrapper::SetPara(int align_type,
                           int left_margin,
                           int indentation)
 {
+    CPYHWPX_TRACE_METHOD();
     std::map<std::wstring, int> props;
 
     if (align_type >= 0) {
@@ -4987,170 +4813,163 @@ bool HwpWrapper::SetPara(int align_type,
 
 IDispatch* HwpWrapper::GetApplication()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    VARIANT result = GetProperty(L"Application");
-    if (result.vt == VT_DISPATCH) {
-        return result.pdispVal;  // 참조 카운트 유지
+    ScopedVariant result(GetProperty(L"Application"));
+    if (result.vt() == VT_DISPATCH) {
+        return result.DetachDispatch();  // 참조 카운트 유지
     }
     return nullptr;
 }
 
 std::wstring HwpWrapper::GetCLSID()
 {
-    VARIANT result = GetProperty(L"CLSID");
-    if (result.vt == VT_BSTR && result.bstrVal) {
-        std::wstring clsid(result.bstrVal);
-        SysFreeString(result.bstrVal);
-        return clsid;
-    }
-    return L"";
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"CLSID"));
+    return result.ToString();
 }
 
 int HwpWrapper::GetCurFieldState()
 {
-    VARIANT result = GetProperty(L"CurFieldState");
-    if (result.vt == VT_I4) {
-        return result.lVal;
-    } else if (result.vt == VT_I2) {
-        return result.iVal;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"CurFieldState"));
+    if (result.vt() == VT_I4) {
+        return result.get().lVal;
+    } else if (result.vt() == VT_I2) {
+        return result.get().iVal;
     }
     return 0;
 }
 
 int HwpWrapper::GetCurMetatagState()
 {
-    VARIANT result = GetProperty(L"CurMetatagState");
-    if (result.vt == VT_I4) {
-        return result.lVal;
-    } else if (result.vt == VT_I2) {
-        return result.iVal;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"CurMetatagState"));
+    if (result.vt() == VT_I4) {
+        return result.get().lVal;
+    } else if (result.vt() == VT_I2) {
+        return result.get().iVal;
     }
     return 0;
 }
 
 IDispatch* HwpWrapper::GetEngineProperties()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    VARIANT result = GetProperty(L"EngineProperties");
-    if (result.vt == VT_DISPATCH) {
-        return result.pdispVal;
+    ScopedVariant result(GetProperty(L"EngineProperties"));
+    if (result.vt() == VT_DISPATCH) {
+        return result.DetachDispatch();
     }
     return nullptr;
 }
 
 bool HwpWrapper::GetIsPrivateInfoProtected()
 {
-    VARIANT result = GetProperty(L"IsPrivateInfoProtected");
-    if (result.vt == VT_BOOL) {
-        return result.boolVal != VARIANT_FALSE;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"IsPrivateInfoProtected"));
+    if (result.vt() == VT_BOOL) {
+        return result.ToBool();
     }
     return false;
 }
 
 bool HwpWrapper::GetIsTrackChange()
 {
-    VARIANT result = GetProperty(L"IsTrackChange");
-    if (result.vt == VT_BOOL) {
-        return result.boolVal != VARIANT_FALSE;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"IsTrackChange"));
+    if (result.vt() == VT_BOOL) {
+        return result.ToBool();
     }
     return false;
 }
 
 std::wstring HwpWrapper::GetDocPath()
 {
-    VARIANT result = GetProperty(L"Path");
-    if (result.vt == VT_BSTR && result.bstrVal) {
-        std::wstring path(result.bstrVal);
-        SysFreeString(result.bstrVal);
-        return path;
-    }
-    return L"";
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"Path"));
+    return result.ToString();
 }
 
 int HwpWrapper::GetSelectionMode()
 {
-    VARIANT result = GetProperty(L"SelectionMode");
-    if (result.vt == VT_I4) {
-        return result.lVal;
-    } else if (result.vt == VT_I2) {
-        return result.iVal;
+    CPYHWPX_TRACE_METHOD();
+    ScopedVariant result(GetProperty(L"SelectionMode"));
+    if (result.vt() == VT_I4) {
+        return result.get().lVal;
+    } else if (result.vt() == VT_I2) {
+        return result.get().iVal;
     }
     return 0;
 }
 
 std::wstring HwpWrapper::GetTitle()
 {
+    CPYHWPX_TRACE_METHOD();
     // pyhwpx의 get_title() 구현 참조
     // hwp.XHwpWindows.Active_XHwpWindow.Caption 접근
     if (!m_pHwp) return L"";
 
     // XHwpWindows 가져오기
-    VARIANT vWindows = GetProperty(L"XHwpWindows");
-    if (vWindows.vt != VT_DISPATCH || !vWindows.pdispVal) {
+    ScopedVariant vWindows(GetProperty(L"XHwpWindows"));
+    if (vWindows.vt() != VT_DISPATCH || !vWindows.get().pdispVal) {
         return L"";
     }
 
-    IDispatch* pWindows = vWindows.pdispVal;
+    IDispatch* pWindows = vWindows.DetachDispatch();
 
     // Active_XHwpWindow 가져오기
     DISPID dispid;
     OLECHAR* propName = const_cast<OLECHAR*>(L"Active_XHwpWindow");
-    HRESULT hr = pWindows->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(pWindows, &propName, 1, &dispid);
     if (FAILED(hr)) {
         pWindows->Release();
         return L"";
     }
 
     DISPPARAMS params = { nullptr, nullptr, 0, 0 };
-    VARIANT vActiveWindow;
-    VariantInit(&vActiveWindow);
-    hr = pWindows->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET, &params, &vActiveWindow, nullptr, nullptr);
+    ScopedVariant vActiveWindow;
+    hr = ComInvoke(pWindows, dispid, DISPATCH_PROPERTYGET, &params, vActiveWindow.Receive(), nullptr, nullptr);
     pWindows->Release();
 
-    if (FAILED(hr) || vActiveWindow.vt != VT_DISPATCH || !vActiveWindow.pdispVal) {
-        VariantClear(&vActiveWindow);
+    if (FAILED(hr) || vActiveWindow.vt() != VT_DISPATCH || !vActiveWindow.get().pdispVal) {
         return L"";
     }
 
-    IDispatch* pActiveWindow = vActiveWindow.pdispVal;
+    IDispatch* pActiveWindow = vActiveWindow.DetachDispatch();
 
     // Caption 가져오기
     propName = const_cast<OLECHAR*>(L"Caption");
-    hr = pActiveWindow->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pActiveWindow, &propName, 1, &dispid);
     if (FAILED(hr)) {
         pActiveWindow->Release();
         return L"";
     }
 
-    VARIANT vCaption;
-    VariantInit(&vCaption);
-    hr = pActiveWindow->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET, &params, &vCaption, nullptr, nullptr);
+    ScopedVariant vCaption;
+    hr = ComInvoke(pActiveWindow, dispid, DISPATCH_PROPERTYGET, &params, vCaption.Receive(), nullptr, nullptr);
     pActiveWindow->Release();
 
-    std::wstring title;
-    if (SUCCEEDED(hr) && vCaption.vt == VT_BSTR && vCaption.bstrVal) {
-        title = vCaption.bstrVal;
-    }
-    VariantClear(&vCaption);
-
-    return title;
+    return SUCCEEDED(hr) ? vCaption.ToString() : L"";
 }
 
 IDispatch* HwpWrapper::GetViewProperties()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    VARIANT result = GetProperty(L"ViewProperties");
-    if (result.vt == VT_DISPATCH) {
-        return result.pdispVal;
+    ScopedVariant result(GetProperty(L"ViewProperties"));
+    if (result.vt() == VT_DISPATCH) {
+        return result.DetachDispatch();
     }
     return nullptr;
 }
 
 void HwpWrapper::SetViewProperties(IDispatch* props)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || !props) return;
 
     VARIANT vProps;
@@ -5163,39 +4982,43 @@ void HwpWrapper::SetViewProperties(IDispatch* props)
 
 IDispatch* HwpWrapper::GetXHwpMessageBox()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    VARIANT result = GetProperty(L"XHwpMessageBox");
-    if (result.vt == VT_DISPATCH) {
-        return result.pdispVal;
+    ScopedVariant result(GetProperty(L"XHwpMessageBox"));
+    if (result.vt() == VT_DISPATCH) {
+        return result.DetachDispatch();
     }
     return nullptr;
 }
 
 IDispatch* HwpWrapper::GetXHwpODBC()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    VARIANT result = GetProperty(L"XHwpODBC");
-    if (result.vt == VT_DISPATCH) {
-        return result.pdispVal;
+    ScopedVariant result(GetProperty(L"XHwpODBC"));
+    if (result.vt() == VT_DISPATCH) {
+        return result.DetachDispatch();
     }
     return nullptr;
 }
 
 IDispatch* HwpWrapper::GetXHwpWindows()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return nullptr;
 
-    VARIANT result = GetProperty(L"XHwpWindows");
-    if (result.vt == VT_DISPATCH) {
-        return result.pdispVal;
+    ScopedVariant result(GetProperty(L"XHwpWindows"));
+    if (result.vt() == VT_DISPATCH) {
+        return result.DetachDispatch();
     }
     return nullptr;
 }
 
 std::wstring HwpWrapper::GetCurrentFont()
 {
+    CPYHWPX_TRACE_METHOD();
     // HParameterSet.HCharShape.Item("FaceNameHangul") 접근
     if (!m_pHwp) return L"";
 
@@ -5206,74 +5029,50 @@ std::wstring HwpWrapper::GetCurrentFont()
     // 2. HCharShape 가져오기
     DISPID dispid;
     OLECHAR* propName = const_cast<OLECHAR*>(L"HCharShape");
-    HRESULT hr = pHParamSet->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(pHParamSet, &propName, 1, &dispid);
     if (FAILED(hr)) return L"";
 
     DISPPARAMS params = { nullptr, nullptr, 0, 0 };
-    VARIANT vCharShape;
-    VariantInit(&vCharShape);
-    hr = pHParamSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET, &params, &vCharShape, nullptr, nullptr);
-    if (FAILED(hr) || vCharShape.vt != VT_DISPATCH || !vCharShape.pdispVal) {
-        VariantClear(&vCharShape);
+    ScopedVariant vCharShape;
+    hr = ComInvoke(pHParamSet, dispid, DISPATCH_PROPERTYGET, &params, vCharShape.Receive(), nullptr, nullptr);
+    if (FAILED(hr) || vCharShape.vt() != VT_DISPATCH || !vCharShape.get().pdispVal) {
         return L"";
     }
 
-    IDispatch* pCharShape = vCharShape.pdispVal;
+    IDispatch* pCharShape = vCharShape.DetachDispatch();
 
     // 3. HAction.GetDefault("CharShape") 호출하여 현재 설정 로드
     IDispatch* pHAction = GetHAction();
     if (pHAction) {
         OLECHAR* methodName = const_cast<OLECHAR*>(L"GetDefault");
         DISPID dispidGetDefault;
-        hr = pHAction->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispidGetDefault);
+        hr = ComGetIDsOfNames(pHAction, &methodName, 1, &dispidGetDefault);
         if (SUCCEEDED(hr)) {
-            VARIANT vActName, vParamSet;
-            VariantInit(&vActName);
-            VariantInit(&vParamSet);
-            vActName.vt = VT_BSTR;
-            vActName.bstrVal = SysAllocString(L"CharShape");
-            vParamSet.vt = VT_DISPATCH;
-            vParamSet.pdispVal = pCharShape;
-
-            VARIANT args[2] = { vParamSet, vActName };
+            static const BSTR s_charShape = InternBstr(L"CharShape");
+            VARIANT args[2] = { DispatchArg(pCharShape), BstrArg(s_charShape) };
             DISPPARAMS getDefaultParams = { args, nullptr, 2, 0 };
-            VARIANT vResult;
-            VariantInit(&vResult);
-            pHAction->Invoke(dispidGetDefault, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD, &getDefaultParams, &vResult, nullptr, nullptr);
-            SysFreeString(vActName.bstrVal);
-            VariantClear(&vResult);
+            ScopedVariant vResult;
+            ComInvoke(pHAction, dispidGetDefault, DISPATCH_METHOD, &getDefaultParams, vResult.Receive(), nullptr, nullptr);
         }
     }
 
     // 4. Item("FaceNameHangul") 호출
     propName = const_cast<OLECHAR*>(L"Item");
-    hr = pCharShape->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pCharShape, &propName, 1, &dispid);
     if (FAILED(hr)) {
         pCharShape->Release();
         return L"";
     }
 
-    VARIANT vPropName;
-    VariantInit(&vPropName);
-    vPropName.vt = VT_BSTR;
-    vPropName.bstrVal = SysAllocString(L"FaceNameHangul");
-
-    VARIANT args[1] = { vPropName };
+    static const BSTR s_faceNameHangul = InternBstr(L"FaceNameHangul");
+    VARIANT args[1] = { BstrArg(s_faceNameHangul) };
     DISPPARAMS itemParams = { args, nullptr, 1, 0 };
-    VARIANT vFontName;
-    VariantInit(&vFontName);
+    ScopedVariant vFontName;
 
-    hr = pCharShape->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET, &itemParams, &vFontName, nullptr, nullptr);
-    SysFreeString(vPropName.bstrVal);
+    hr = ComInvoke(pCharShape, dispid, DISPATCH_PROPERTYGET, &itemParams, vFontName.Receive(), nullptr, nullptr);
     pCharShape->Release();
 
-    std::wstring fontName;
-    if (SUCCEEDED(hr) && vFontName.vt == VT_BSTR && vFontName.bstrVal) {
-        fontName = vFontName.bstrVal;
-    }
-    VariantClear(&vFontName);
-
-    return fontName;
+    return SUCCEEDED(hr) ? vFontName.ToString() : L"";
 }
 
 // ============================================================================
@@ -5282,12 +5081,16 @@ std::wstring HwpWrapper::GetCurrentFont()
 
 bool HwpWrapper::FindForward(const std::wstring& src, bool regex)
 {
+    CPYHWPX_TRACE_METHOD();
+    m_edits.Note(EditKind::Caret);
     // Find() 메서드를 forward=true로 호출
     return Find(src, true, true, regex, false);
 }
 
 bool HwpWrapper::FindBackward(const std::wstring& src, bool regex)
 {
+    CPYHWPX_TRACE_METHOD();
+    m_edits.Note(EditKind::Caret);
     // Find() 메서드를 forward=false로 호출
     return Find(src, false, true, regex, false);
 }
@@ -5295,12 +5098,18 @@ bool HwpWrapper::FindBackward(const std::wstring& src, bool regex)
 int HwpWrapper::FindReplace(const std::wstring& src, const std::wstring& dst,
                              bool regex, int direction)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || src.empty()) return 0;
+    m_edits.Note(EditKind::Content);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"FindReplace");
+    }
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
     // 1. HParameterSet 속성 가져오기
     IDispatch* pHParameterSet = GetHParameterSet();
@@ -5308,34 +5117,32 @@ int HwpWrapper::FindReplace(const std::wstring& src, const std::wstring& dst,
 
     // 2. HFindReplace 속성 가져오기
     OLECHAR* findReplaceName = const_cast<OLECHAR*>(L"HFindReplace");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &findReplaceName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHParameterSet, &findReplaceName, 1, &dispid);
     if (FAILED(hr)) return 0;
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return 0;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) return 0;
 
-    IDispatch* pHFindReplace = result.pdispVal;
+    IDispatch* pHFindReplace = result.DetachDispatch();
 
     // 3. HSet 속성 가져오기
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &hsetName, 1, &dispid);
     if (FAILED(hr)) {
         pHFindReplace->Release();
         return 0;
     }
 
-    VariantInit(&result);
-    hr = pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
+    hr = ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) {
         pHFindReplace->Release();
         return 0;
     }
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = result.DetachDispatch();
 
     // 4. HAction 가져오기
     IDispatch* pHAction = GetHAction();
@@ -5345,9 +5152,10 @@ int HwpWrapper::FindReplace(const std::wstring& src, const std::wstring& dst,
         return 0;
     }
 
+    static const BSTR s_allReplace = InternBstr(L"AllReplace");
     // 5. HAction.GetDefault("AllReplace", HSet) 호출하여 초기화
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT getDefaultArgs[2];
         VariantInit(&getDefaultArgs[0]);
@@ -5355,13 +5163,11 @@ int HwpWrapper::FindReplace(const std::wstring& src, const std::wstring& dst,
         getDefaultArgs[0].vt = VT_DISPATCH;
         getDefaultArgs[0].pdispVal = pHSet;
         getDefaultArgs[1].vt = VT_BSTR;
-        getDefaultArgs[1].bstrVal = SysAllocString(L"AllReplace");
+        getDefaultArgs[1].bstrVal = s_allReplace;
 
         DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                         &getDefaultParams, &result, NULL, NULL);
-        SysFreeString(getDefaultArgs[1].bstrVal);
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &getDefaultParams, result.Receive(), NULL, NULL);
     }
 
     // 6. 파라미터 설정
@@ -5369,87 +5175,87 @@ int HwpWrapper::FindReplace(const std::wstring& src, const std::wstring& dst,
 
     // FindString 설정
     OLECHAR* findStringName = const_cast<OLECHAR*>(L"FindString");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &findStringName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &findStringName, 1, &dispid);
     if (SUCCEEDED(hr)) {
+        ScopedBstr srcBstr(src);
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_BSTR;
-        val.bstrVal = SysAllocString(src.c_str());
+        val.bstrVal = srcBstr.get();
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
-        SysFreeString(val.bstrVal);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // ReplaceString 설정
     OLECHAR* replaceStringName = const_cast<OLECHAR*>(L"ReplaceString");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &replaceStringName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &replaceStringName, 1, &dispid);
     if (SUCCEEDED(hr)) {
+        ScopedBstr dstBstr(dst);
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_BSTR;
-        val.bstrVal = SysAllocString(dst.c_str());
+        val.bstrVal = dstBstr.get();
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
-        SysFreeString(val.bstrVal);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // MatchCase 설정
     OLECHAR* matchCaseName = const_cast<OLECHAR*>(L"MatchCase");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &matchCaseName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &matchCaseName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = 1;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // UseRegExp 설정 (정규식)
     OLECHAR* useRegExpName = const_cast<OLECHAR*>(L"UseRegExp");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &useRegExpName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &useRegExpName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = regex ? 1 : 0;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // Direction 설정 (0=Forward, 1=Backward, 2=AllDoc)
     OLECHAR* directionName = const_cast<OLECHAR*>(L"Direction");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &directionName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &directionName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = direction;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // IgnoreMessage 설정 (메시지 무시)
     OLECHAR* ignoreMsgName = const_cast<OLECHAR*>(L"IgnoreMessage");
-    hr = pHFindReplace->GetIDsOfNames(IID_NULL, &ignoreMsgName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHFindReplace, &ignoreMsgName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = 1;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHFindReplace->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHFindReplace, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // 7. HAction.Execute("AllReplace", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pHFindReplace->Release();
@@ -5462,21 +5268,19 @@ int HwpWrapper::FindReplace(const std::wstring& src, const std::wstring& dst,
     executeArgs[0].vt = VT_DISPATCH;
     executeArgs[0].pdispVal = pHSet;
     executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"AllReplace");
+    executeArgs[1].bstrVal = s_allReplace;
 
     DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
     pHSet->Release();
     pHFindReplace->Release();
 
     // 반환값: 교체된 횟수
     int replaceCount = 0;
-    if (SUCCEEDED(hr) && result.vt == VT_I4) {
-        replaceCount = result.lVal;
+    if (SUCCEEDED(hr) && result.vt() == VT_I4) {
+        replaceCount = result.get().lVal;
     }
 
     return replaceCount;
@@ -5484,12 +5288,18 @@ int HwpWrapper::FindReplace(const std::wstring& src, const std::wstring& dst,
 
 bool HwpWrapper::Paste(int option)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"Paste");
+    }
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
     // 1. HParameterSet 속성 가져오기
     IDispatch* pHParameterSet = GetHParameterSet();
@@ -5497,34 +5307,32 @@ bool HwpWrapper::Paste(int option)
 
     // 2. HSelectionOpt 속성 가져오기
     OLECHAR* selOptName = const_cast<OLECHAR*>(L"HSelectionOpt");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &selOptName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHParameterSet, &selOptName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pHSelectionOpt = result.pdispVal;
+    IDispatch* pHSelectionOpt = result.DetachDispatch();
 
     // 3. HSet 속성 가져오기
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHSelectionOpt->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHSelectionOpt, &hsetName, 1, &dispid);
     if (FAILED(hr)) {
         pHSelectionOpt->Release();
         return false;
     }
 
-    VariantInit(&result);
-    hr = pHSelectionOpt->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
+    hr = ComInvoke(pHSelectionOpt, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) {
         pHSelectionOpt->Release();
         return false;
     }
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = result.DetachDispatch();
 
     // 4. HAction 가져오기
     IDispatch* pHAction = GetHAction();
@@ -5534,9 +5342,11 @@ bool HwpWrapper::Paste(int option)
         return false;
     }
 
+    static const BSTR s_paste = InternBstr(L"Paste");
+
     // 5. HAction.GetDefault("Paste", HSet) 호출하여 초기화
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT getDefaultArgs[2];
         VariantInit(&getDefaultArgs[0]);
@@ -5544,32 +5354,30 @@ bool HwpWrapper::Paste(int option)
         getDefaultArgs[0].vt = VT_DISPATCH;
         getDefaultArgs[0].pdispVal = pHSet;
         getDefaultArgs[1].vt = VT_BSTR;
-        getDefaultArgs[1].bstrVal = SysAllocString(L"Paste");
+        getDefaultArgs[1].bstrVal = s_paste;
 
         DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                         &getDefaultParams, &result, NULL, NULL);
-        SysFreeString(getDefaultArgs[1].bstrVal);
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &getDefaultParams, result.Receive(), NULL, NULL);
     }
 
     // 6. option 파라미터 설정
     DISPID putid = DISPID_PROPERTYPUT;
     OLECHAR* optionName = const_cast<OLECHAR*>(L"option");
-    hr = pHSelectionOpt->GetIDsOfNames(IID_NULL, &optionName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHSelectionOpt, &optionName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT val;
         VariantInit(&val);
         val.vt = VT_I4;
         val.lVal = option;
         DISPPARAMS params = { &val, &putid, 1, 1 };
-        pHSelectionOpt->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                               &params, NULL, NULL, NULL);
+        ComInvoke(pHSelectionOpt, dispid, DISPATCH_PROPERTYPUT,
+                  &params, NULL, NULL, NULL);
     }
 
     // 7. HAction.Execute("Paste", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pHSelectionOpt->Release();
@@ -5582,13 +5390,11 @@ bool HwpWrapper::Paste(int option)
     executeArgs[0].vt = VT_DISPATCH;
     executeArgs[0].pdispVal = pHSet;
     executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"Paste");
+    executeArgs[1].bstrVal = s_paste;
 
     DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
     pHSet->Release();
     pHSelectionOpt->Release();
@@ -5602,12 +5408,12 @@ bool HwpWrapper::Paste(int option)
 
 bool HwpWrapper::ExportStyle(const std::wstring& styFilepath)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || styFilepath.empty()) return false;
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
 
     // 1. HParameterSet 속성 가져오기
@@ -5616,33 +5422,31 @@ bool HwpWrapper::ExportStyle(const std::wstring& styFilepath)
 
     // 2. HStyleTemplate 속성 가져오기
     OLECHAR* styleTemplateName = const_cast<OLECHAR*>(L"HStyleTemplate");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &styleTemplateName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHParameterSet, &styleTemplateName, 1, &dispid);
     if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pHStyleTemplate = result.pdispVal;
+    IDispatch* pHStyleTemplate = result.DetachDispatch();
 
     // 3. HSet 속성 가져오기 (filename 설정 전에 먼저)
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHStyleTemplate->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHStyleTemplate, &hsetName, 1, &dispid);
     if (FAILED(hr)) {
         pHStyleTemplate->Release();
         return false;
     }
 
-    VariantInit(&result);
-    hr = pHStyleTemplate->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                  &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
+    hr = ComInvoke(pHStyleTemplate, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) {
         pHStyleTemplate->Release();
         return false;
     }
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = result.DetachDispatch();
 
     // 4. HAction 가져오기
     IDispatch* pHAction = GetHAction();
@@ -5652,9 +5456,11 @@ bool HwpWrapper::ExportStyle(const std::wstring& styFilepath)
         return false;
     }
 
+    static const BSTR s_fileExportStyle = InternBstr(L"FileExportStyle");
+
     // 5. HAction.GetDefault("FileExportStyle", HSet) 호출
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT getDefaultArgs[2];
         VariantInit(&getDefaultArgs[0]);
@@ -5662,19 +5468,16 @@ bool HwpWrapper::ExportStyle(const std::wstring& styFilepath)
         getDefaultArgs[0].vt = VT_DISPATCH;
         getDefaultArgs[0].pdispVal = pHSet;
         getDefaultArgs[1].vt = VT_BSTR;
-        getDefaultArgs[1].bstrVal = SysAllocString(L"FileExportStyle");
+        getDefaultArgs[1].bstrVal = s_fileExportStyle;
 
         DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &getDefaultParams, &result, NULL, NULL);
-        SysFreeString(getDefaultArgs[1].bstrVal);
-        VariantClear(&result);
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &getDefaultParams, result.Receive(), NULL, NULL);
     }
 
     // 6. filename 속성 설정
     OLECHAR* filenameName = const_cast<OLECHAR*>(L"filename");
-    hr = pHStyleTemplate->GetIDsOfNames(IID_NULL, &filenameName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHStyleTemplate, &filenameName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pHStyleTemplate->Release();
@@ -5682,18 +5485,18 @@ bool HwpWrapper::ExportStyle(const std::wstring& styFilepath)
     }
 
     DISPID putid = DISPID_PROPERTYPUT;
+    ScopedBstr styFilepathBstr(styFilepath);
     VARIANT filenameVal;
     VariantInit(&filenameVal);
     filenameVal.vt = VT_BSTR;
-    filenameVal.bstrVal = SysAllocString(styFilepath.c_str());
+    filenameVal.bstrVal = styFilepathBstr.get();
     DISPPARAMS filenameParams = { &filenameVal, &putid, 1, 1 };
-    hr = pHStyleTemplate->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                                  &filenameParams, NULL, NULL, NULL);
-    SysFreeString(filenameVal.bstrVal);
+    hr = ComInvoke(pHStyleTemplate, dispid, DISPATCH_PROPERTYPUT,
+                   &filenameParams, NULL, NULL, NULL);
 
     // 7. HAction.Execute("FileExportStyle", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pHStyleTemplate->Release();
@@ -5706,28 +5509,32 @@ bool HwpWrapper::ExportStyle(const std::wstring& styFilepath)
     executeArgs[0].vt = VT_DISPATCH;
     executeArgs[0].pdispVal = pHSet;
     executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"FileExportStyle");
+    executeArgs[1].bstrVal = s_fileExportStyle;
 
     DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                           &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
     pHSet->Release();
     pHStyleTemplate->Release();
 
-    return SUCCEEDED(hr) && (result.vt == VT_BOOL ? result.boolVal != VARIANT_FALSE : true);
+    return SUCCEEDED(hr) && (result.vt() == VT_BOOL ? result.ToBool() : true);
 }
 
 bool HwpWrapper::ImportStyle(const std::wstring& styFilepath)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || styFilepath.empty()) return false;
+    m_edits.Note(EditKind::Layout);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"ImportStyle");
+    }
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
 
     // 1. HParameterSet 속성 가져오기
@@ -5736,33 +5543,31 @@ bool HwpWrapper::ImportStyle(const std::wstring& styFilepath)
 
     // 2. HStyleTemplate 속성 가져오기
     OLECHAR* styleTemplateName = const_cast<OLECHAR*>(L"HStyleTemplate");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &styleTemplateName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHParameterSet, &styleTemplateName, 1, &dispid);
     if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pHStyleTemplate = result.pdispVal;
+    IDispatch* pHStyleTemplate = result.DetachDispatch();
 
     // 3. HSet 속성 가져오기 (filename 설정 전에 먼저)
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHStyleTemplate->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHStyleTemplate, &hsetName, 1, &dispid);
     if (FAILED(hr)) {
         pHStyleTemplate->Release();
         return false;
     }
 
-    VariantInit(&result);
-    hr = pHStyleTemplate->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                  &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
+    hr = ComInvoke(pHStyleTemplate, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) {
         pHStyleTemplate->Release();
         return false;
     }
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = result.DetachDispatch();
 
     // 4. HAction 가져오기
     IDispatch* pHAction = GetHAction();
@@ -5772,9 +5577,11 @@ bool HwpWrapper::ImportStyle(const std::wstring& styFilepath)
         return false;
     }
 
+    static const BSTR s_fileImportStyle = InternBstr(L"FileImportStyle");
+
     // 5. HAction.GetDefault("FileImportStyle", HSet) 호출
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT getDefaultArgs[2];
         VariantInit(&getDefaultArgs[0]);
@@ -5782,19 +5589,16 @@ bool HwpWrapper::ImportStyle(const std::wstring& styFilepath)
         getDefaultArgs[0].vt = VT_DISPATCH;
         getDefaultArgs[0].pdispVal = pHSet;
         getDefaultArgs[1].vt = VT_BSTR;
-        getDefaultArgs[1].bstrVal = SysAllocString(L"FileImportStyle");
+        getDefaultArgs[1].bstrVal = s_fileImportStyle;
 
         DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &getDefaultParams, &result, NULL, NULL);
-        SysFreeString(getDefaultArgs[1].bstrVal);
-        VariantClear(&result);
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &getDefaultParams, result.Receive(), NULL, NULL);
     }
 
     // 6. filename 속성 설정
     OLECHAR* filenameName = const_cast<OLECHAR*>(L"filename");
-    hr = pHStyleTemplate->GetIDsOfNames(IID_NULL, &filenameName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHStyleTemplate, &filenameName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pHStyleTemplate->Release();
@@ -5802,18 +5606,18 @@ bool HwpWrapper::ImportStyle(const std::wstring& styFilepath)
     }
 
     DISPID putid = DISPID_PROPERTYPUT;
+    ScopedBstr styFilepathBstr(styFilepath);
     VARIANT filenameVal;
     VariantInit(&filenameVal);
     filenameVal.vt = VT_BSTR;
-    filenameVal.bstrVal = SysAllocString(styFilepath.c_str());
+    filenameVal.bstrVal = styFilepathBstr.get();
     DISPPARAMS filenameParams = { &filenameVal, &putid, 1, 1 };
-    hr = pHStyleTemplate->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                                  &filenameParams, NULL, NULL, NULL);
-    SysFreeString(filenameVal.bstrVal);
+    hr = ComInvoke(pHStyleTemplate, dispid, DISPATCH_PROPERTYPUT,
+                   &filenameParams, NULL, NULL, NULL);
 
     // 7. HAction.Execute("FileImportStyle", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pHStyleTemplate->Release();
@@ -5826,22 +5630,21 @@ bool HwpWrapper::ImportStyle(const std::wstring& styFilepath)
     executeArgs[0].vt = VT_DISPATCH;
     executeArgs[0].pdispVal = pHSet;
     executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"FileImportStyle");
+    executeArgs[1].bstrVal = s_fileImportStyle;
 
     DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                           &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
     pHSet->Release();
     pHStyleTemplate->Release();
 
-    return SUCCEEDED(hr) && (result.vt == VT_BOOL ? result.boolVal != VARIANT_FALSE : true);
+    return SUCCEEDED(hr) && (result.vt() == VT_BOOL ? result.ToBool() : true);
 }
 
 void HwpWrapper::LockCommand(const std::wstring& actId, bool isLock)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || actId.empty()) return;
 
     HRESULT hr;
@@ -5849,25 +5652,23 @@ void HwpWrapper::LockCommand(const std::wstring& actId, bool isLock)
 
     // LockCommand 메서드 호출
     OLECHAR* lockCommandName = const_cast<OLECHAR*>(L"LockCommand");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &lockCommandName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &lockCommandName, 1, &dispid);
     if (FAILED(hr)) return;
 
     // 파라미터 설정 (역순: isLock, actId)
+    ScopedBstr actIdBstr(actId);
     VARIANT args[2];
     VariantInit(&args[0]);
     VariantInit(&args[1]);
     args[0].vt = VT_BOOL;
     args[0].boolVal = isLock ? VARIANT_TRUE : VARIANT_FALSE;
     args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(actId.c_str());
+    args[1].bstrVal = actIdBstr.get();
 
     DISPPARAMS params = { args, NULL, 2, 0 };
-    VARIANT result;
-    VariantInit(&result);
-    m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                    &params, &result, NULL, NULL);
-
-    SysFreeString(args[1].bstrVal);
+    ScopedVariant result;
+    ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+              &params, result.Receive(), NULL, NULL);
 }
 
 bool HwpWrapper::CreatePageImage(const std::wstring& path,
@@ -5876,6 +5677,7 @@ bool HwpWrapper::CreatePageImage(const std::wstring& path,
                                   int depth,
                                   const std::wstring& format)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || path.empty()) return false;
 
     HRESULT hr;
@@ -5883,7 +5685,7 @@ bool HwpWrapper::CreatePageImage(const std::wstring& path,
 
     // CreatePageImage 메서드 호출
     OLECHAR* createPageImageName = const_cast<OLECHAR*>(L"CreatePageImage");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &createPageImageName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &createPageImageName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     // pgno 변환: 0이면 현재 페이지, 1이상이면 0-index로 변환
@@ -5891,11 +5693,13 @@ bool HwpWrapper::CreatePageImage(const std::wstring& path,
     if (actualPgno < 0) actualPgno = 0;
 
     // 파라미터 설정 (역순: Format, depth, resolution, pgno, Path)
+    ScopedBstr formatBstr(format);
+    ScopedBstr pathBstr(path);
     VARIANT args[5];
     for (int i = 0; i < 5; i++) VariantInit(&args[i]);
 
     args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(format.c_str());
+    args[0].bstrVal = formatBstr.get();
     args[1].vt = VT_I4;
     args[1].lVal = depth;
     args[2].vt = VT_I4;
@@ -5903,22 +5707,19 @@ bool HwpWrapper::CreatePageImage(const std::wstring& path,
     args[3].vt = VT_I4;
     args[3].lVal = actualPgno;
     args[4].vt = VT_BSTR;
-    args[4].bstrVal = SysAllocString(path.c_str());
+    args[4].bstrVal = pathBstr.get();
 
     DISPPARAMS params = { args, NULL, 5, 0 };
-    VARIANT result;
-    VariantInit(&result);
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                         &params, &result, NULL, NULL);
-
-    SysFreeString(args[0].bstrVal);
-    SysFreeString(args[4].bstrVal);
+    ScopedVariant result;
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    return SUCCEEDED(hr) && (result.vt == VT_BOOL ? result.boolVal != VARIANT_FALSE : true);
+    return SUCCEEDED(hr) && (result.vt() == VT_BOOL ? result.ToBool() : true);
 }
 
 bool HwpWrapper::PrintDocument()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
     // Run("FilePrint") 액션으로 인쇄 다이얼로그 실행
@@ -5927,7 +5728,9 @@ bool HwpWrapper::PrintDocument()
 
 bool HwpWrapper::MailMerge()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Document);
 
     // Run("MailMerge") 액션으로 메일머지 실행
     return RunAction(L"MailMerge");
@@ -5942,37 +5745,37 @@ bool HwpWrapper::Insert(const std::wstring& path,
                          const std::wstring& arg,
                          bool moveDocEnd)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || path.empty()) return false;
+    m_edits.Note(EditKind::Content);
 
     HRESULT hr;
     DISPID dispid;
 
     // Insert 메서드 호출
     OLECHAR* insertName = const_cast<OLECHAR*>(L"Insert");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &insertName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &insertName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     // 파라미터 설정 (역순: arg, Format, Path)
+    ScopedBstr argBstr(arg);
+    ScopedBstr formatBstr(format);
+    ScopedBstr pathBstr(path);
     VARIANT args[3];
     for (int i = 0; i < 3; i++) VariantInit(&args[i]);
     args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(arg.c_str());
+    args[0].bstrVal = argBstr.get();
     args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(format.c_str());
+    args[1].bstrVal = formatBstr.get();
     args[2].vt = VT_BSTR;
-    args[2].bstrVal = SysAllocString(path.c_str());
+    args[2].bstrVal = pathBstr.get();
 
     DISPPARAMS params = { args, NULL, 3, 0 };
-    VARIANT result;
-    VariantInit(&result);
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                         &params, &result, NULL, NULL);
+    ScopedVariant result;
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    SysFreeString(args[0].bstrVal);
-    SysFreeString(args[1].bstrVal);
-    SysFreeString(args[2].bstrVal);
-
-    bool success = SUCCEEDED(hr) && (result.vt == VT_BOOL ? result.boolVal != VARIANT_FALSE : true);
+    bool success = SUCCEEDED(hr) && (result.vt() == VT_BOOL ? result.ToBool() : true);
 
     // moveDocEnd가 true이면 문서 끝으로 이동
     if (success && moveDocEnd) {
@@ -5991,17 +5794,21 @@ bool HwpWrapper::InsertBackgroundPicture(const std::wstring& path,
                                           int brightness,
                                           int contrast)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || path.empty()) return false;
+    m_edits.Note(EditKind::Content);
 
     HRESULT hr;
     DISPID dispid;
 
     // InsertBackgroundPicture 메서드 호출
     OLECHAR* methodName = const_cast<OLECHAR*>(L"InsertBackgroundPicture");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     // 파라미터 설정 (역순: Contrast, Brightness, watermark, Effect, filloption, Embedded, BorderType, Path)
+    ScopedBstr borderTypeBstr(borderType);
+    ScopedBstr pathBstr(path);
     VARIANT args[8];
     for (int i = 0; i < 8; i++) VariantInit(&args[i]);
     args[0].vt = VT_I4;    args[0].lVal = contrast;
@@ -6010,19 +5817,15 @@ bool HwpWrapper::InsertBackgroundPicture(const std::wstring& path,
     args[3].vt = VT_I4;    args[3].lVal = effect;
     args[4].vt = VT_I4;    args[4].lVal = fillOption;
     args[5].vt = VT_BOOL;  args[5].boolVal = embedded ? VARIANT_TRUE : VARIANT_FALSE;
-    args[6].vt = VT_BSTR;  args[6].bstrVal = SysAllocString(borderType.c_str());
-    args[7].vt = VT_BSTR;  args[7].bstrVal = SysAllocString(path.c_str());
+    args[6].vt = VT_BSTR;  args[6].bstrVal = borderTypeBstr.get();
+    args[7].vt = VT_BSTR;  args[7].bstrVal = pathBstr.get();
 
     DISPPARAMS params = { args, NULL, 8, 0 };
-    VARIANT result;
-    VariantInit(&result);
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                         &params, &result, NULL, NULL);
-
-    SysFreeString(args[6].bstrVal);
-    SysFreeString(args[7].bstrVal);
+    ScopedVariant result;
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    return SUCCEEDED(hr) && (result.vt == VT_BOOL ? result.boolVal != VARIANT_FALSE : true);
+    return SUCCEEDED(hr) && (result.vt() == VT_BOOL ? result.ToBool() : true);
 }
 
 bool HwpWrapper::MoveToMetatag(const std::wstring& tag,
@@ -6030,39 +5833,41 @@ bool HwpWrapper::MoveToMetatag(const std::wstring& tag,
                                 bool start,
                                 bool select)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || tag.empty()) return false;
+    m_edits.Note(EditKind::Caret);
 
     HRESULT hr;
     DISPID dispid;
 
     // MoveToMetatag 메서드 호출
     OLECHAR* methodName = const_cast<OLECHAR*>(L"MoveToMetatag");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     // 파라미터 설정 (역순: select, start, Text, tag)
+    ScopedBstr textBstr(text);
+    ScopedBstr tagBstr(tag);
     VARIANT args[4];
     for (int i = 0; i < 4; i++) VariantInit(&args[i]);
     args[0].vt = VT_BOOL;  args[0].boolVal = select ? VARIANT_TRUE : VARIANT_FALSE;
     args[1].vt = VT_BOOL;  args[1].boolVal = start ? VARIANT_TRUE : VARIANT_FALSE;
-    args[2].vt = VT_BSTR;  args[2].bstrVal = SysAllocString(text.c_str());
-    args[3].vt = VT_BSTR;  args[3].bstrVal = SysAllocString(tag.c_str());
+    args[2].vt = VT_BSTR;  args[2].bstrVal = textBstr.get();
+    args[3].vt = VT_BSTR;  args[3].bstrVal = tagBstr.get();
 
     DISPPARAMS params = { args, NULL, 4, 0 };
-    VARIANT result;
-    VariantInit(&result);
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                         &params, &result, NULL, NULL);
+    ScopedVariant result;
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    SysFreeString(args[2].bstrVal);
-    SysFreeString(args[3].bstrVal);
-
-    return SUCCEEDED(hr) && (result.vt == VT_BOOL ? result.boolVal != VARIANT_FALSE : true);
+    return SUCCEEDED(hr) && (result.vt() == VT_BOOL ? result.ToBool() : true);
 }
 
 void HwpWrapper::ClearFieldText()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return;
+    m_edits.Note(EditKind::Content);
 
     // GetFieldList(1)로 모든 필드 목록 가져오기
     std::wstring fieldList = GetFieldList(1, 0);
@@ -6088,12 +5893,18 @@ void HwpWrapper::ClearFieldText()
 bool HwpWrapper::InsertHyperlink(const std::wstring& hypertext,
                                   const std::wstring& description)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || hypertext.empty()) return false;
+    m_edits.Note(EditKind::Content);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"InsertHyperlink");
+    }
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
 
     // 1. HParameterSet 가져오기
@@ -6102,33 +5913,31 @@ bool HwpWrapper::InsertHyperlink(const std::wstring& hypertext,
 
     // 2. HHyperLink 속성 가져오기
     OLECHAR* hyperLinkName = const_cast<OLECHAR*>(L"HHyperLink");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &hyperLinkName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHParameterSet, &hyperLinkName, 1, &dispid);
     if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pHHyperLink = result.pdispVal;
+    IDispatch* pHHyperLink = result.DetachDispatch();
 
     // 3. HSet 가져오기
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHHyperLink->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHHyperLink, &hsetName, 1, &dispid);
     if (FAILED(hr)) {
         pHHyperLink->Release();
         return false;
     }
 
-    VariantInit(&result);
-    hr = pHHyperLink->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                              &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
+    hr = ComInvoke(pHHyperLink, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) {
         pHHyperLink->Release();
         return false;
     }
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = result.DetachDispatch();
 
     // 4. HAction.GetDefault("InsertHyperlink", HSet) 호출
     IDispatch* pHAction = GetHAction();
@@ -6138,8 +5947,10 @@ bool HwpWrapper::InsertHyperlink(const std::wstring& hypertext,
         return false;
     }
 
+    static const BSTR s_insertHyperlink = InternBstr(L"InsertHyperlink");
+
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT getDefaultArgs[2];
         VariantInit(&getDefaultArgs[0]);
@@ -6147,35 +5958,32 @@ bool HwpWrapper::InsertHyperlink(const std::wstring& hypertext,
         getDefaultArgs[0].vt = VT_DISPATCH;
         getDefaultArgs[0].pdispVal = pHSet;
         getDefaultArgs[1].vt = VT_BSTR;
-        getDefaultArgs[1].bstrVal = SysAllocString(L"InsertHyperlink");
+        getDefaultArgs[1].bstrVal = s_insertHyperlink;
 
         DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &getDefaultParams, &result, NULL, NULL);
-        SysFreeString(getDefaultArgs[1].bstrVal);
-        VariantClear(&result);
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &getDefaultParams, result.Receive(), NULL, NULL);
     }
 
     // 5. Command 속성 설정: "?{hypertext}|{description};0;0;0;"
     std::wstring command = L"?" + hypertext + L"|" + description + L";0;0;0;";
     OLECHAR* commandName = const_cast<OLECHAR*>(L"Command");
-    hr = pHHyperLink->GetIDsOfNames(IID_NULL, &commandName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHHyperLink, &commandName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         DISPID putid = DISPID_PROPERTYPUT;
+        ScopedBstr commandBstr(command);
         VARIANT commandVal;
         VariantInit(&commandVal);
         commandVal.vt = VT_BSTR;
-        commandVal.bstrVal = SysAllocString(command.c_str());
+        commandVal.bstrVal = commandBstr.get();
         DISPPARAMS commandParams = { &commandVal, &putid, 1, 1 };
-        pHHyperLink->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                             &commandParams, NULL, NULL, NULL);
-        SysFreeString(commandVal.bstrVal);
+        ComInvoke(pHHyperLink, dispid, DISPATCH_PROPERTYPUT,
+                  &commandParams, NULL, NULL, NULL);
     }
 
     // 6. HAction.Execute("InsertHyperlink", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pHHyperLink->Release();
@@ -6188,24 +5996,24 @@ bool HwpWrapper::InsertHyperlink(const std::wstring& hypertext,
     executeArgs[0].vt = VT_DISPATCH;
     executeArgs[0].pdispVal = pHSet;
     executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"InsertHyperlink");
+    executeArgs[1].bstrVal = s_insertHyperlink;
 
     DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                           &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
     pHSet->Release();
     pHHyperLink->Release();
 
-    return SUCCEEDED(hr) && (result.vt == VT_BOOL ? result.boolVal != VARIANT_FALSE : true);
+    return SUCCEEDED(hr) && (result.vt() == VT_BOOL ? result.ToBool() : true);
 }
 
 void HwpWrapper::InsertMemo(const std::wstring& text,
                              const std::wstring& memoType)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return;
+    m_edits.Note(EditKind::Content);
 
     // memo_type에 따라 다른 액션 실행
     if (memoType == L"revision") {
@@ -6228,12 +6036,18 @@ bool HwpWrapper::ComposeChars(const std::wstring& chars,
                                int checkCompose,
                                int circleType)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"ComposeChars");
+    }
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
 
     // 1. HParameterSet 가져오기
@@ -6242,33 +6056,31 @@ bool HwpWrapper::ComposeChars(const std::wstring& chars,
 
     // 2. HChCompose 속성 가져오기
     OLECHAR* composeName = const_cast<OLECHAR*>(L"HChCompose");
-    hr = pHParameterSet->GetIDsOfNames(IID_NULL, &composeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHParameterSet, &composeName, 1, &dispid);
     if (FAILED(hr)) return false;
 
-    VariantInit(&result);
-    hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                 &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
+    hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) return false;
 
-    IDispatch* pHChCompose = result.pdispVal;
+    IDispatch* pHChCompose = result.DetachDispatch();
 
     // 3. HSet 가져오기
     OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-    hr = pHChCompose->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHChCompose, &hsetName, 1, &dispid);
     if (FAILED(hr)) {
         pHChCompose->Release();
         return false;
     }
 
-    VariantInit(&result);
-    hr = pHChCompose->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                              &noParams, &result, NULL, NULL);
-    if (FAILED(hr) || result.vt != VT_DISPATCH) {
+    hr = ComInvoke(pHChCompose, dispid, DISPATCH_PROPERTYGET,
+                   &noParams, result.Receive(), NULL, NULL);
+    if (FAILED(hr) || result.vt() != VT_DISPATCH) {
         pHChCompose->Release();
         return false;
     }
 
-    IDispatch* pHSet = result.pdispVal;
+    IDispatch* pHSet = result.DetachDispatch();
 
     // 4. HAction.GetDefault("ComposeChars", HSet) 호출
     IDispatch* pHAction = GetHAction();
@@ -6278,8 +6090,10 @@ bool HwpWrapper::ComposeChars(const std::wstring& chars,
         return false;
     }
 
+    static const BSTR s_composeChars = InternBstr(L"ComposeChars");
+
     OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT getDefaultArgs[2];
         VariantInit(&getDefaultArgs[0]);
@@ -6287,14 +6101,11 @@ bool HwpWrapper::ComposeChars(const std::wstring& chars,
         getDefaultArgs[0].vt = VT_DISPATCH;
         getDefaultArgs[0].pdispVal = pHSet;
         getDefaultArgs[1].vt = VT_BSTR;
-        getDefaultArgs[1].bstrVal = SysAllocString(L"ComposeChars");
+        getDefaultArgs[1].bstrVal = s_composeChars;
 
         DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-        VariantInit(&result);
-        pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                          &getDefaultParams, &result, NULL, NULL);
-        SysFreeString(getDefaultArgs[1].bstrVal);
-        VariantClear(&result);
+        ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                  &getDefaultParams, result.Receive(), NULL, NULL);
     }
 
     // 5. 속성 설정
@@ -6303,61 +6114,61 @@ bool HwpWrapper::ComposeChars(const std::wstring& chars,
     // Chars 속성
     if (!chars.empty()) {
         OLECHAR* charsName = const_cast<OLECHAR*>(L"Chars");
-        hr = pHChCompose->GetIDsOfNames(IID_NULL, &charsName, 1, LOCALE_USER_DEFAULT, &dispid);
+        hr = ComGetIDsOfNames(pHChCompose, &charsName, 1, &dispid);
         if (SUCCEEDED(hr)) {
+            ScopedBstr charsBstr(chars);
             VARIANT charsVal;
             VariantInit(&charsVal);
             charsVal.vt = VT_BSTR;
-            charsVal.bstrVal = SysAllocString(chars.c_str());
+            charsVal.bstrVal = charsBstr.get();
             DISPPARAMS charsParams = { &charsVal, &putid, 1, 1 };
-            pHChCompose->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                                 &charsParams, NULL, NULL, NULL);
-            SysFreeString(charsVal.bstrVal);
+            ComInvoke(pHChCompose, dispid, DISPATCH_PROPERTYPUT,
+                      &charsParams, NULL, NULL, NULL);
         }
     }
 
     // CharSize 속성
     OLECHAR* charSizeName = const_cast<OLECHAR*>(L"CharSize");
-    hr = pHChCompose->GetIDsOfNames(IID_NULL, &charSizeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHChCompose, &charSizeName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT sizeVal;
         VariantInit(&sizeVal);
         sizeVal.vt = VT_I4;
         sizeVal.lVal = charSize;
         DISPPARAMS sizeParams = { &sizeVal, &putid, 1, 1 };
-        pHChCompose->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                             &sizeParams, NULL, NULL, NULL);
+        ComInvoke(pHChCompose, dispid, DISPATCH_PROPERTYPUT,
+                  &sizeParams, NULL, NULL, NULL);
     }
 
     // CheckCompose 속성
     OLECHAR* checkComposeName = const_cast<OLECHAR*>(L"CheckCompose");
-    hr = pHChCompose->GetIDsOfNames(IID_NULL, &checkComposeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHChCompose, &checkComposeName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT checkVal;
         VariantInit(&checkVal);
         checkVal.vt = VT_I4;
         checkVal.lVal = checkCompose;
         DISPPARAMS checkParams = { &checkVal, &putid, 1, 1 };
-        pHChCompose->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                             &checkParams, NULL, NULL, NULL);
+        ComInvoke(pHChCompose, dispid, DISPATCH_PROPERTYPUT,
+                  &checkParams, NULL, NULL, NULL);
     }
 
     // CircleType 속성
     OLECHAR* circleTypeName = const_cast<OLECHAR*>(L"CircleType");
-    hr = pHChCompose->GetIDsOfNames(IID_NULL, &circleTypeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHChCompose, &circleTypeName, 1, &dispid);
     if (SUCCEEDED(hr)) {
         VARIANT circleVal;
         VariantInit(&circleVal);
         circleVal.vt = VT_I4;
         circleVal.lVal = circleType;
         DISPPARAMS circleParams = { &circleVal, &putid, 1, 1 };
-        pHChCompose->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYPUT,
-                             &circleParams, NULL, NULL, NULL);
+        ComInvoke(pHChCompose, dispid, DISPATCH_PROPERTYPUT,
+                  &circleParams, NULL, NULL, NULL);
     }
 
     // 6. HAction.Execute("ComposeChars", HSet) 호출
     OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-    hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
     if (FAILED(hr)) {
         pHSet->Release();
         pHChCompose->Release();
@@ -6370,23 +6181,23 @@ bool HwpWrapper::ComposeChars(const std::wstring& chars,
     executeArgs[0].vt = VT_DISPATCH;
     executeArgs[0].pdispVal = pHSet;
     executeArgs[1].vt = VT_BSTR;
-    executeArgs[1].bstrVal = SysAllocString(L"ComposeChars");
+    executeArgs[1].bstrVal = s_composeChars;
 
     DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-    VariantInit(&result);
-    hr = pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                           &executeParams, &result, NULL, NULL);
-    SysFreeString(executeArgs[1].bstrVal);
+    hr = ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                   &executeParams, result.Receive(), NULL, NULL);
 
     pHSet->Release();
     pHChCompose->Release();
 
-    return SUCCEEDED(hr) && (result.vt == VT_BOOL ? result.boolVal != VARIANT_FALSE : true);
+    return SUCCEEDED(hr) && (result.vt() == VT_BOOL ? result.ToBool() : true);
 }
 
 bool HwpWrapper::MoveToCtrl(IDispatch* pCtrl, int option)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || !pCtrl) return false;
+    m_edits.Note(EditKind::Caret);
 
     HRESULT hr;
     DISPID dispid;
@@ -6395,7 +6206,7 @@ bool HwpWrapper::MoveToCtrl(IDispatch* pCtrl, int option)
 
     // 1. 컨트롤의 GetAnchorPos(option) 호출
     OLECHAR* getAnchorPosName = const_cast<OLECHAR*>(L"GetAnchorPos");
-    hr = pCtrl->GetIDsOfNames(IID_NULL, &getAnchorPosName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pCtrl, &getAnchorPosName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     VARIANT optionArg;
@@ -6405,8 +6216,8 @@ bool HwpWrapper::MoveToCtrl(IDispatch* pCtrl, int option)
     DISPPARAMS optionParams = { &optionArg, NULL, 1, 0 };
 
     VariantInit(&result);
-    hr = pCtrl->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &optionParams, &result, NULL, NULL);
+    hr = ComInvoke(pCtrl, dispid, DISPATCH_METHOD,
+                   &optionParams, &result, NULL, NULL);
     if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
 
     IDispatch* pPos = result.pdispVal;
@@ -6420,7 +6231,9 @@ bool HwpWrapper::MoveToCtrl(IDispatch* pCtrl, int option)
 
 bool HwpWrapper::SelectCtrl(IDispatch* pCtrl, int anchorType, int option)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp || !pCtrl) return false;
+    m_edits.Note(EditKind::Caret);
 
     HRESULT hr;
     DISPID dispid;
@@ -6429,7 +6242,7 @@ bool HwpWrapper::SelectCtrl(IDispatch* pCtrl, int anchorType, int option)
 
     // 1. 컨트롤의 GetAnchorPos(anchorType) 호출
     OLECHAR* getAnchorPosName = const_cast<OLECHAR*>(L"GetAnchorPos");
-    hr = pCtrl->GetIDsOfNames(IID_NULL, &getAnchorPosName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(pCtrl, &getAnchorPosName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     VARIANT optionArg;
@@ -6439,8 +6252,8 @@ bool HwpWrapper::SelectCtrl(IDispatch* pCtrl, int anchorType, int option)
     DISPPARAMS optionParams = { &optionArg, NULL, 1, 0 };
 
     VariantInit(&result);
-    hr = pCtrl->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &optionParams, &result, NULL, NULL);
+    hr = ComInvoke(pCtrl, dispid, DISPATCH_METHOD,
+                   &optionParams, &result, NULL, NULL);
     if (FAILED(hr) || result.vt != VT_DISPATCH) return false;
 
     IDispatch* pPos = result.pdispVal;
@@ -6463,7 +6276,14 @@ bool HwpWrapper::SelectCtrl(IDispatch* pCtrl, int anchorType, int option)
 bool HwpWrapper::MoveAllCaption(const std::wstring& location,
                                  const std::wstring& align)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Layout);
+
+    ActionRecorder::Scope recordScope(m_recorder.get());
+    if (ActionRecorder* recorder = recordScope.Record()) {
+        recorder->OnUnreplayable(L"MoveAllCaption");
+    }
 
     // ctrl_list를 순회하며 tbl, gso 컨트롤 찾기
     std::vector<std::unique_ptr<HwpCtrl>> ctrls = GetCtrlList();
@@ -6471,8 +6291,7 @@ bool HwpWrapper::MoveAllCaption(const std::wstring& location,
 
     HRESULT hr;
     DISPID dispid;
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
 
     // 현재 위치 저장
@@ -6484,16 +6303,14 @@ bool HwpWrapper::MoveAllCaption(const std::wstring& location,
 
         // 컨트롤 타입 확인 (CtrlID 속성)
         OLECHAR* ctrlIdName = const_cast<OLECHAR*>(L"CtrlID");
-        hr = pCtrl->GetIDsOfNames(IID_NULL, &ctrlIdName, 1, LOCALE_USER_DEFAULT, &dispid);
+        hr = ComGetIDsOfNames(pCtrl, &ctrlIdName, 1, &dispid);
         if (FAILED(hr)) continue;
 
-        VariantInit(&result);
-        hr = pCtrl->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                            &noParams, &result, NULL, NULL);
-        if (FAILED(hr) || result.vt != VT_BSTR) continue;
+        hr = ComInvoke(pCtrl, dispid, DISPATCH_PROPERTYGET,
+                       &noParams, result.Receive(), NULL, NULL);
+        if (FAILED(hr) || result.vt() != VT_BSTR) continue;
 
-        std::wstring ctrlId(result.bstrVal);
-        VariantClear(&result);
+        std::wstring ctrlId = result.ToString();
 
         // tbl 또는 gso 컨트롤만 처리
         if (ctrlId != L"tbl" && ctrlId != L"gso") continue;
@@ -6519,39 +6336,39 @@ bool HwpWrapper::MoveAllCaption(const std::wstring& location,
         if (!pHParameterSet) continue;
 
         OLECHAR* shapeObjName = const_cast<OLECHAR*>(L"HShapeObject");
-        hr = pHParameterSet->GetIDsOfNames(IID_NULL, &shapeObjName, 1, LOCALE_USER_DEFAULT, &dispid);
+        hr = ComGetIDsOfNames(pHParameterSet, &shapeObjName, 1, &dispid);
         if (FAILED(hr)) continue;
 
-        VariantInit(&result);
-        hr = pHParameterSet->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                     &noParams, &result, NULL, NULL);
-        if (FAILED(hr) || result.vt != VT_DISPATCH) continue;
+        hr = ComInvoke(pHParameterSet, dispid, DISPATCH_PROPERTYGET,
+                       &noParams, result.Receive(), NULL, NULL);
+        if (FAILED(hr) || result.vt() != VT_DISPATCH) continue;
 
-        IDispatch* pHShapeObject = result.pdispVal;
+        IDispatch* pHShapeObject = result.DetachDispatch();
 
         // HSet 가져오기
         OLECHAR* hsetName = const_cast<OLECHAR*>(L"HSet");
-        hr = pHShapeObject->GetIDsOfNames(IID_NULL, &hsetName, 1, LOCALE_USER_DEFAULT, &dispid);
+        hr = ComGetIDsOfNames(pHShapeObject, &hsetName, 1, &dispid);
         if (FAILED(hr)) {
             pHShapeObject->Release();
             continue;
         }
 
-        VariantInit(&result);
-        hr = pHShapeObject->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                                    &noParams, &result, NULL, NULL);
-        if (FAILED(hr) || result.vt != VT_DISPATCH) {
+        hr = ComInvoke(pHShapeObject, dispid, DISPATCH_PROPERTYGET,
+                       &noParams, result.Receive(), NULL, NULL);
+        if (FAILED(hr) || result.vt() != VT_DISPATCH) {
             pHShapeObject->Release();
             continue;
         }
 
-        IDispatch* pHSet = result.pdispVal;
+        IDispatch* pHSet = result.DetachDispatch();
 
         // HAction.GetDefault 호출
         IDispatch* pHAction = GetHAction();
         if (pHAction) {
+            static const BSTR s_tablePropertyDialog = InternBstr(L"TablePropertyDialog");
+
             OLECHAR* getDefaultName = const_cast<OLECHAR*>(L"GetDefault");
-            hr = pHAction->GetIDsOfNames(IID_NULL, &getDefaultName, 1, LOCALE_USER_DEFAULT, &dispid);
+            hr = ComGetIDsOfNames(pHAction, &getDefaultName, 1, &dispid);
             if (SUCCEEDED(hr)) {
                 VARIANT getDefaultArgs[2];
                 VariantInit(&getDefaultArgs[0]);
@@ -6559,14 +6376,11 @@ bool HwpWrapper::MoveAllCaption(const std::wstring& location,
                 getDefaultArgs[0].vt = VT_DISPATCH;
                 getDefaultArgs[0].pdispVal = pHSet;
                 getDefaultArgs[1].vt = VT_BSTR;
-                getDefaultArgs[1].bstrVal = SysAllocString(L"TablePropertyDialog");
+                getDefaultArgs[1].bstrVal = s_tablePropertyDialog;
 
                 DISPPARAMS getDefaultParams = { getDefaultArgs, NULL, 2, 0 };
-                VariantInit(&result);
-                pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                                  &getDefaultParams, &result, NULL, NULL);
-                SysFreeString(getDefaultArgs[1].bstrVal);
-                VariantClear(&result);
+                ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                          &getDefaultParams, result.Receive(), NULL, NULL);
             }
 
             // CaptionAttr.SideType 설정 (간소화 - 위치 설정 생략)
@@ -6574,7 +6388,7 @@ bool HwpWrapper::MoveAllCaption(const std::wstring& location,
 
             // HAction.Execute 호출
             OLECHAR* executeName = const_cast<OLECHAR*>(L"Execute");
-            hr = pHAction->GetIDsOfNames(IID_NULL, &executeName, 1, LOCALE_USER_DEFAULT, &dispid);
+            hr = ComGetIDsOfNames(pHAction, &executeName, 1, &dispid);
             if (SUCCEEDED(hr)) {
                 VARIANT executeArgs[2];
                 VariantInit(&executeArgs[0]);
@@ -6582,14 +6396,11 @@ bool HwpWrapper::MoveAllCaption(const std::wstring& location,
                 executeArgs[0].vt = VT_DISPATCH;
                 executeArgs[0].pdispVal = pHSet;
                 executeArgs[1].vt = VT_BSTR;
-                executeArgs[1].bstrVal = SysAllocString(L"TablePropertyDialog");
+                executeArgs[1].bstrVal = s_tablePropertyDialog;
 
                 DISPPARAMS executeParams = { executeArgs, NULL, 2, 0 };
-                VariantInit(&result);
-                pHAction->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                                  &executeParams, &result, NULL, NULL);
-                SysFreeString(executeArgs[1].bstrVal);
-                VariantClear(&result);
+                ComInvoke(pHAction, dispid, DISPATCH_METHOD,
+                          &executeParams, result.Receive(), NULL, NULL);
             }
         }
 
@@ -6609,102 +6420,108 @@ bool HwpWrapper::MoveAllCaption(const std::wstring& location,
 
 bool HwpWrapper::ModifyFieldProperties(const std::wstring& field, bool remove, bool add)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"ModifyFieldProperties");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
+    ScopedBstr fieldBstr(field);
     VARIANT args[3];
     VariantInit(&args[0]);
     VariantInit(&args[1]);
     VariantInit(&args[2]);
     args[2].vt = VT_BSTR;
-    args[2].bstrVal = SysAllocString(field.c_str());
+    args[2].bstrVal = fieldBstr.get();
     args[1].vt = VT_BOOL;
     args[1].boolVal = remove ? VARIANT_TRUE : VARIANT_FALSE;
     args[0].vt = VT_BOOL;
     args[0].boolVal = add ? VARIANT_TRUE : VARIANT_FALSE;
 
     DISPPARAMS params = { args, NULL, 3, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    SysFreeString(args[2].bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return result.vt == VT_BOOL ? (result.boolVal != VARIANT_FALSE) : true;
+    return result.vt() == VT_BOOL ? result.ToBool() : true;
 }
 
 int HwpWrapper::FindPrivateInfo(int privateType, const std::wstring& privateString)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return -1;
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"FindPrivateInfo");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return -1;
 
+    ScopedBstr privateStringBstr(privateString);
     VARIANT args[2];
     VariantInit(&args[0]);
     VariantInit(&args[1]);
     args[1].vt = VT_I4;
     args[1].lVal = privateType;
     args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(privateString.c_str());
+    args[0].bstrVal = privateStringBstr.get();
 
     DISPPARAMS params = { args, NULL, 2, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
-
-    SysFreeString(args[0].bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return -1;
-    return result.vt == VT_I4 ? result.lVal : -1;
+    return result.vt() == VT_I4 ? result.get().lVal : -1;
+}
+
+std::vector<PrivateInfoMatch> HwpWrapper::ScanPrivateInfo(int types, bool validate_checksum)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return {};
+
+    std::wstring text = GetTextFile(L"UNICODE", L"");
+    if (text.empty()) return {};
+
+    return PrivateInfoScanner::Scan(text, types, validate_checksum);
 }
 
 std::wstring HwpWrapper::GetCurMetatagName()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return L"";
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"GetCurMetatagName");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return L"";
 
     DISPPARAMS noParams = { NULL, NULL, 0, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &noParams, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &noParams, result.Receive(), NULL, NULL);
 
-    if (FAILED(hr) || result.vt != VT_BSTR) return L"";
-
-    std::wstring ret(result.bstrVal);
-    VariantClear(&result);
-    return ret;
+    if (FAILED(hr)) return L"";
+    return result.ToString();
 }
 
 std::wstring HwpWrapper::GetMetatagList(int number, int option)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return L"";
 
     HRESULT hr;
-    DISPID dispid;
-    OLECHAR* methodName = const_cast<OLECHAR*>(L"GetMetatagList");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return L"";
+    DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"GetMetatagList");
+    if (dispid == DISPID_UNKNOWN) return L"";
 
     VARIANT args[2];
     VariantInit(&args[0]);
@@ -6715,150 +6532,198 @@ std::wstring HwpWrapper::GetMetatagList(int number, int option)
     args[0].lVal = option;
 
     DISPPARAMS params = { args, NULL, 2, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    if (FAILED(hr) || result.vt != VT_BSTR) return L"";
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    std::wstring ret(result.bstrVal);
-    VariantClear(&result);
-    return ret;
+    if (FAILED(hr)) return L"";
+    return result.ToString();
 }
 
 std::wstring HwpWrapper::GetMetatagNameText(const std::wstring& tag)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return L"";
 
     HRESULT hr;
-    DISPID dispid;
-    OLECHAR* methodName = const_cast<OLECHAR*>(L"GetMetatagNameText");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return L"";
+    DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"GetMetatagNameText");
+    if (dispid == DISPID_UNKNOWN) return L"";
 
+    ScopedBstr tagBstr(tag);
     VARIANT args[1];
     VariantInit(&args[0]);
     args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(tag.c_str());
+    args[0].bstrVal = tagBstr.get();
 
     DISPPARAMS params = { args, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    SysFreeString(args[0].bstrVal);
-
-    if (FAILED(hr) || result.vt != VT_BSTR) return L"";
-
-    std::wstring ret(result.bstrVal);
-    VariantClear(&result);
-    return ret;
+    if (FAILED(hr)) return L"";
+    return result.ToString();
 }
 
 bool HwpWrapper::PutMetatagNameText(const std::wstring& tag, const std::wstring& text)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
 
     HRESULT hr;
-    DISPID dispid;
-    OLECHAR* methodName = const_cast<OLECHAR*>(L"PutMetatagNameText");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
-    if (FAILED(hr)) return false;
+    DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"PutMetatagNameText");
+    if (dispid == DISPID_UNKNOWN) return false;
 
+    ScopedBstr tagBstr(tag);
+    ScopedBstr textBstr(text);
     VARIANT args[2];
     VariantInit(&args[0]);
     VariantInit(&args[1]);
     args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(tag.c_str());
+    args[1].bstrVal = tagBstr.get();
     args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(text.c_str());
+    args[0].bstrVal = textBstr.get();
 
     DISPPARAMS params = { args, NULL, 2, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
-
-    SysFreeString(args[1].bstrVal);
-    SysFreeString(args[0].bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return result.vt == VT_BOOL ? (result.boolVal != VARIANT_FALSE) : true;
+    return result.vt() == VT_BOOL ? result.ToBool() : true;
 }
 
 bool HwpWrapper::RenameMetatag(const std::wstring& oldtag, const std::wstring& newtag)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"RenameMetatag");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
+    ScopedBstr oldtagBstr(oldtag);
+    ScopedBstr newtagBstr(newtag);
     VARIANT args[2];
     VariantInit(&args[0]);
     VariantInit(&args[1]);
     args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(oldtag.c_str());
+    args[1].bstrVal = oldtagBstr.get();
     args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(newtag.c_str());
+    args[0].bstrVal = newtagBstr.get();
 
     DISPPARAMS params = { args, NULL, 2, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    SysFreeString(args[1].bstrVal);
-    SysFreeString(args[0].bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return result.vt == VT_BOOL ? (result.boolVal != VARIANT_FALSE) : true;
+    return result.vt() == VT_BOOL ? result.ToBool() : true;
 }
 
 bool HwpWrapper::ModifyMetatagProperties(const std::wstring& tag, bool remove, bool add)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"ModifyMetatagProperties");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
+    ScopedBstr tagBstr(tag);
     VARIANT args[3];
     VariantInit(&args[0]);
     VariantInit(&args[1]);
     VariantInit(&args[2]);
     args[2].vt = VT_BSTR;
-    args[2].bstrVal = SysAllocString(tag.c_str());
+    args[2].bstrVal = tagBstr.get();
     args[1].vt = VT_BOOL;
     args[1].boolVal = remove ? VARIANT_TRUE : VARIANT_FALSE;
     args[0].vt = VT_BOOL;
     args[0].boolVal = add ? VARIANT_TRUE : VARIANT_FALSE;
 
     DISPPARAMS params = { args, NULL, 3, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
-
-    SysFreeString(args[2].bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return result.vt == VT_BOOL ? (result.boolVal != VARIANT_FALSE) : true;
+    return result.vt() == VT_BOOL ? result.ToBool() : true;
+}
+
+std::map<std::wstring, std::wstring> HwpWrapper::MetatagsToMap()
+{
+    CPYHWPX_TRACE_METHOD();
+    std::map<std::wstring, std::wstring> result;
+    if (!m_pHwp) return result;
+
+    std::wstring tagList = GetMetatagList(0, 0);
+    if (tagList.empty()) return result;
+
+    DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"GetMetatagNameText");
+    if (dispid == DISPID_UNKNOWN) return result;
+
+    // GetMetatagNameText는 태그 하나씩만 받으므로 DISPID와 인자 버퍼를 재사용
+    ScopedVariant text;
+    for (const auto& entry : Utils::Split(tagList, L"\x02")) {
+        std::wstring tag;
+        FieldIndex::SplitReference(entry, tag);
+        if (tag.empty() || result.count(tag)) continue;
+
+        ScopedBstr tagBstr(tag);
+        VARIANT args[1] = { BstrArg(tagBstr.get()) };
+        DISPPARAMS params = { args, NULL, 1, 0 };
+
+        HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                               &params, text.Receive(), NULL, NULL);
+        result[tag] = SUCCEEDED(hr) ? text.ToString() : std::wstring();
+    }
+
+    return result;
+}
+
+bool HwpWrapper::PutMetatagTexts(const std::map<std::wstring, std::wstring>& texts)
+{
+    CPYHWPX_TRACE_METHOD();
+    if (!m_pHwp) return false;
+    if (texts.empty()) return true;
+    m_edits.Note(EditKind::Content);
+
+    DISPID dispid = m_dispidCache.GetOrLoad(m_pHwp, L"PutMetatagNameText");
+    if (dispid == DISPID_UNKNOWN) return false;
+
+    bool allSucceeded = true;
+    ScopedVariant result;
+    for (const auto& entry : texts) {
+        // Positional parameters (역순): text, tag
+        ScopedBstr tagBstr(entry.first);
+        ScopedBstr textBstr(entry.second);
+        VARIANT args[2] = { BstrArg(textBstr.get()), BstrArg(tagBstr.get()) };
+        DISPPARAMS params = { args, NULL, 2, 0 };
+
+        HRESULT hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                               &params, result.Receive(), NULL, NULL);
+        if (FAILED(hr) || (result.vt() == VT_BOOL && !result.ToBool())) {
+            allSucceeded = false;
+        }
+    }
+    return allSucceeded;
 }
 
 std::vector<std::map<std::wstring, std::wstring>> HwpWrapper::GetFieldInfo()
 {
+    CPYHWPX_TRACE_METHOD();
     std::vector<std::map<std::wstring, std::wstring>> results;
     if (!m_pHwp) return results;
 
@@ -6942,7 +6807,9 @@ std::vector<std::map<std::wstring, std::wstring>> HwpWrapper::GetFieldInfo()
 
 void HwpWrapper::SetFieldByBracket()
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return;
+    m_edits.Note(EditKind::Content);
 
     // 현재 위치 저장
     HwpPos curPos = GetPos();
@@ -7029,6 +6896,7 @@ void HwpWrapper::SetFieldByBracket()
 
 std::tuple<int, int, int, int, int, int, int, int, std::wstring> HwpWrapper::KeyIndicator()
 {
+    CPYHWPX_TRACE_METHOD();
     // 기본값으로 초기화
     std::tuple<int, int, int, int, int, int, int, int, std::wstring> result =
         std::make_tuple(0, 0, 0, 0, 0, 0, 0, 0, L"");
@@ -7038,21 +6906,20 @@ std::tuple<int, int, int, int, int, int, int, int, std::wstring> HwpWrapper::Key
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"KeyIndicator");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return result;
 
     DISPPARAMS params = { NULL, NULL, 0, 0 };
-    VARIANT vResult;
-    VariantInit(&vResult);
+    ScopedVariant vResult;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &vResult, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, vResult.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return result;
 
     // KeyIndicator는 SafeArray를 반환
-    if (vResult.vt == (VT_ARRAY | VT_VARIANT)) {
-        SAFEARRAY* psa = vResult.parray;
+    if (vResult.vt() == (VT_ARRAY | VT_VARIANT)) {
+        SAFEARRAY* psa = vResult.get().parray;
         LONG lBound, uBound;
         SafeArrayGetLBound(psa, 1, &lBound);
         SafeArrayGetUBound(psa, 1, &uBound);
@@ -7078,14 +6945,15 @@ std::tuple<int, int, int, int, int, int, int, int, std::wstring> HwpWrapper::Key
         SafeArrayUnaccessData(psa);
     }
 
-    VariantClear(&vResult);
     return result;
 }
 
 std::pair<int, int> HwpWrapper::GotoPage(int pageIndex)
 {
+    CPYHWPX_TRACE_METHOD();
     std::pair<int, int> result = std::make_pair(0, 0);
     if (!m_pHwp) return result;
+    m_edits.Note(EditKind::Caret);
 
     int targetPage = pageIndex;
     int pageCount = GetPageCount();
@@ -7129,12 +6997,13 @@ std::pair<int, int> HwpWrapper::GotoPage(int pageIndex)
 
 int HwpWrapper::MiliToHwpUnit(double mili)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return 0;
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"MiliToHwpUnit");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) {
         // API가 없으면 수식으로 계산: mili * 7200 / 25.4
         return static_cast<int>(mili * 7200.0 / 25.4 + 0.5);
@@ -7146,29 +7015,28 @@ int HwpWrapper::MiliToHwpUnit(double mili)
     arg.dblVal = mili;
 
     DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) {
         return static_cast<int>(mili * 7200.0 / 25.4 + 0.5);
     }
 
     int hwpUnit = 0;
-    if (result.vt == VT_I4) {
-        hwpUnit = result.lVal;
-    } else if (result.vt == VT_R8) {
-        hwpUnit = static_cast<int>(result.dblVal);
+    if (result.vt() == VT_I4) {
+        hwpUnit = result.get().lVal;
+    } else if (result.vt() == VT_R8) {
+        hwpUnit = static_cast<int>(result.get().dblVal);
     }
 
-    VariantClear(&result);
     return hwpUnit;
 }
 
 double HwpWrapper::HwpUnitToMili(int hwpUnit)
 {
+    CPYHWPX_TRACE_METHOD();
     // 정적 메서드: hwpUnit / 7200 * 25.4
     // 반올림하여 소수점 2자리까지
     double mili = static_cast<double>(hwpUnit) / 7200.0 * 25.4;
@@ -7187,33 +7055,30 @@ int HwpWrapper::InvokeParamHelper(const std::wstring& method, const std::wstring
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(method.c_str());
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return 0;
 
+    ScopedBstr paramBstr(param);
     VARIANT arg;
     VariantInit(&arg);
     arg.vt = VT_BSTR;
-    arg.bstrVal = SysAllocString(param.c_str());
+    arg.bstrVal = paramBstr.get();
 
     DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
+    ScopedVariant result;
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
-
-    SysFreeString(arg.bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return 0;
 
     int retVal = 0;
-    if (result.vt == VT_I4) {
-        retVal = result.lVal;
-    } else if (result.vt == VT_I2) {
-        retVal = result.iVal;
+    if (result.vt() == VT_I4) {
+        retVal = result.get().lVal;
+    } else if (result.vt() == VT_I2) {
+        retVal = result.get().iVal;
     }
 
-    VariantClear(&result);
     return retVal;
 }
 
@@ -7309,12 +7174,13 @@ int HwpWrapper::Canonical(const std::wstring& canonical) { return InvokeParamHel
 
 int HwpWrapper::ConvertPUAHangulToUnicode(bool reverse)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return 0;
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"ConvertPUAHangulToUnicode");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return 0;
 
     VARIANT arg;
@@ -7326,8 +7192,9 @@ int HwpWrapper::ConvertPUAHangulToUnicode(bool reverse)
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, &result, NULL, NULL);
+    m_edits.Note(EditKind::Content);
 
     if (FAILED(hr)) return 0;
     return (result.vt == VT_I4) ? result.lVal : 0;
@@ -7353,161 +7220,147 @@ int HwpWrapper::ViewFlag(const std::wstring& view_flag) { return InvokeParamHelp
 // === 사용자 정보 ===
 std::wstring HwpWrapper::GetUserInfo(const std::wstring& user_info_id)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return L"";
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"GetUserInfo");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return L"";
 
+    ScopedBstr userInfoIdBstr(user_info_id);
     VARIANT arg;
     VariantInit(&arg);
     arg.vt = VT_BSTR;
-    arg.bstrVal = SysAllocString(user_info_id.c_str());
+    arg.bstrVal = userInfoIdBstr.get();
 
     DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
-
-    SysFreeString(arg.bstrVal);
+    ScopedVariant result;
 
-    if (FAILED(hr) || result.vt != VT_BSTR) {
-        VariantClear(&result);
-        return L"";
-    }
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    std::wstring ret(result.bstrVal ? result.bstrVal : L"");
-    VariantClear(&result);
-    return ret;
+    if (FAILED(hr)) return L"";
+    return result.ToString();
 }
 
 bool HwpWrapper::SetUserInfo(const std::wstring& user_info_id, const std::wstring& value)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"SetUserInfo");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
+    ScopedBstr userInfoIdBstr(user_info_id);
+    ScopedBstr valueBstr(value);
     VARIANT args[2];
     VariantInit(&args[0]);
     VariantInit(&args[1]);
     args[1].vt = VT_BSTR;
-    args[1].bstrVal = SysAllocString(user_info_id.c_str());
+    args[1].bstrVal = userInfoIdBstr.get();
     args[0].vt = VT_BSTR;
-    args[0].bstrVal = SysAllocString(value.c_str());
+    args[0].bstrVal = valueBstr.get();
 
     DISPPARAMS params = { args, NULL, 2, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    SysFreeString(args[1].bstrVal);
-    SysFreeString(args[0].bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
+    return (result.vt() == VT_BOOL) ? result.ToBool() : true;
 }
 
 // === 메타태그/DRM ===
 bool HwpWrapper::SetCurMetatagName(const std::wstring& tag)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
+    m_edits.Note(EditKind::Content);
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"SetCurMetatagName");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
+    ScopedBstr tagBstr(tag);
     VARIANT arg;
     VariantInit(&arg);
     arg.vt = VT_BSTR;
-    arg.bstrVal = SysAllocString(tag.c_str());
+    arg.bstrVal = tagBstr.get();
 
     DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    SysFreeString(arg.bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
+    return (result.vt() == VT_BOOL) ? result.ToBool() : true;
 }
 
 bool HwpWrapper::SetDRMAuthority(const std::wstring& authority)
 {
+    CPYHWPX_TRACE_METHOD();
     if (!m_pHwp) return false;
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"SetDRMAuthority");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
+    ScopedBstr authorityBstr(authority);
     VARIANT arg;
     VariantInit(&arg);
     arg.vt = VT_BSTR;
-    arg.bstrVal = SysAllocString(authority.c_str());
+    arg.bstrVal = authorityBstr.get();
 
     DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    SysFreeString(arg.bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
     if (FAILED(hr)) return false;
-    return (result.vt == VT_BOOL) ? (result.boolVal != VARIANT_FALSE) : true;
+    return (result.vt() == VT_BOOL) ? result.ToBool() : true;
 }
 
 // === 번역 ===
 std::vector<std::wstring> HwpWrapper::GetTranslateLangList(const std::wstring& cur_lang)
 {
+    CPYHWPX_TRACE_METHOD();
     std::vector<std::wstring> langList;
     if (!m_pHwp) return langList;
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"TranslateLangList");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return langList;
 
+    ScopedBstr curLangBstr(cur_lang);
     VARIANT arg;
     VariantInit(&arg);
     arg.vt = VT_BSTR;
-    arg.bstrVal = SysAllocString(cur_lang.c_str());
+    arg.bstrVal = curLangBstr.get();
 
     DISPPARAMS params = { &arg, NULL, 1, 0 };
-    VARIANT result;
-    VariantInit(&result);
-
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &result, NULL, NULL);
+    ScopedVariant result;
 
-    SysFreeString(arg.bstrVal);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, result.Receive(), NULL, NULL);
 
-    if (FAILED(hr) || result.vt != VT_BSTR || !result.bstrVal) {
-        VariantClear(&result);
-        return langList;
-    }
+    if (FAILED(hr)) return langList;
 
     // 결과를 구분자로 분리
-    std::wstring listStr(result.bstrVal);
-    VariantClear(&result);
+    std::wstring listStr = result.ToString();
 
     std::wstring delimiter = L"\x02";  // Control-B
     size_t pos = 0;
@@ -7529,13 +7382,14 @@ std::vector<std::wstring> HwpWrapper::GetTranslateLangList(const std::wstring& c
 // === 음력/양력 변환 ===
 std::tuple<int, int, int> HwpWrapper::LunarToSolarBySet(int l_year, int l_month, int l_day, bool l_leap)
 {
+    CPYHWPX_TRACE_METHOD();
     std::tuple<int, int, int> result = std::make_tuple(0, 0, 0);
     if (!m_pHwp) return result;
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"LunarToSolarBySet");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return result;
 
     VARIANT args[4];
@@ -7549,8 +7403,8 @@ std::tuple<int, int, int> HwpWrapper::LunarToSolarBySet(int l_year, int l_month,
     VARIANT vResult;
     VariantInit(&vResult);
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &vResult, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, &vResult, NULL, NULL);
 
     if (FAILED(hr)) return result;
 
@@ -7562,14 +7416,14 @@ std::tuple<int, int, int> HwpWrapper::LunarToSolarBySet(int l_year, int l_month,
         auto getIntProp = [pSet](const wchar_t* name) -> int {
             DISPID propId;
             OLECHAR* propName = const_cast<OLECHAR*>(name);
-            HRESULT hr = pSet->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &propId);
+            HRESULT hr = ComGetIDsOfNames(pSet, &propName, 1, &propId);
             if (FAILED(hr)) return 0;
 
             DISPPARAMS noParams = { NULL, NULL, 0, 0 };
             VARIANT val;
             VariantInit(&val);
-            hr = pSet->Invoke(propId, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                              &noParams, &val, NULL, NULL);
+            hr = ComInvoke(pSet, propId, DISPATCH_PROPERTYGET,
+                           &noParams, &val, NULL, NULL);
             if (FAILED(hr) || val.vt != VT_I4) return 0;
             return val.lVal;
         };
@@ -7587,13 +7441,14 @@ std::tuple<int, int, int> HwpWrapper::LunarToSolarBySet(int l_year, int l_month,
 
 std::tuple<int, int, int, bool> HwpWrapper::SolarToLunarBySet(int s_year, int s_month, int s_day)
 {
+    CPYHWPX_TRACE_METHOD();
     std::tuple<int, int, int, bool> result = std::make_tuple(0, 0, 0, false);
     if (!m_pHwp) return result;
 
     HRESULT hr;
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"SolarToLunarBySet");
-    hr = m_pHwp->GetIDsOfNames(IID_NULL, &methodName, 1, LOCALE_USER_DEFAULT, &dispid);
+    hr = ComGetIDsOfNames(m_pHwp, &methodName, 1, &dispid);
     if (FAILED(hr)) return result;
 
     VARIANT args[3];
@@ -7606,8 +7461,8 @@ std::tuple<int, int, int, bool> HwpWrapper::SolarToLunarBySet(int s_year, int s_
     VARIANT vResult;
     VariantInit(&vResult);
 
-    hr = m_pHwp->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_METHOD,
-                        &params, &vResult, NULL, NULL);
+    hr = ComInvoke(m_pHwp, dispid, DISPATCH_METHOD,
+                   &params, &vResult, NULL, NULL);
 
     if (FAILED(hr)) return result;
 
@@ -7619,14 +7474,14 @@ std::tuple<int, int, int, bool> HwpWrapper::SolarToLunarBySet(int s_year, int s_
         auto getIntProp = [pSet](const wchar_t* name) -> int {
             DISPID propId;
             OLECHAR* propName = const_cast<OLECHAR*>(name);
-            HRESULT hr = pSet->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &propId);
+            HRESULT hr = ComGetIDsOfNames(pSet, &propName, 1, &propId);
             if (FAILED(hr)) return 0;
 
             DISPPARAMS noParams = { NULL, NULL, 0, 0 };
             VARIANT val;
             VariantInit(&val);
-            hr = pSet->Invoke(propId, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                              &noParams, &val, NULL, NULL);
+            hr = ComInvoke(pSet, propId, DISPATCH_PROPERTYGET,
+                           &noParams, &val, NULL, NULL);
             if (FAILED(hr) || val.vt != VT_I4) return 0;
             return val.lVal;
         };
@@ -7634,14 +7489,14 @@ std::tuple<int, int, int, bool> HwpWrapper::SolarToLunarBySet(int s_year, int s_
         auto getBoolProp = [pSet](const wchar_t* name) -> bool {
             DISPID propId;
             OLECHAR* propName = const_cast<OLECHAR*>(name);
-            HRESULT hr = pSet->GetIDsOfNames(IID_NULL, &propName, 1, LOCALE_USER_DEFAULT, &propId);
+            HRESULT hr = ComGetIDsOfNames(pSet, &propName, 1, &propId);
             if (FAILED(hr)) return false;
 
             DISPPARAMS noParams = { NULL, NULL, 0, 0 };
             VARIANT val;
             VariantInit(&val);
-            hr = pSet->Invoke(propId, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
-                              &noParams, &val, NULL, NULL);
+            hr = ComInvoke(pSet, propId, DISPATCH_PROPERTYGET,
+                           &noParams, &val, NULL, NULL);
             if (FAILED(hr)) return false;
             if (val.vt == VT_BOOL) return val.boolVal != VARIANT_FALSE;
             if (val.vt == VT_I4) return val.lVal != 0;
@@ -7663,18 +7518,21 @@ std::tuple<int, int, int, bool> HwpWrapper::SolarToLunarBySet(int s_year, int s_
 // === 단위 변환 확장 ===
 double HwpWrapper::HwpUnitToInch(int hwp_unit)
 {
+    CPYHWPX_TRACE_METHOD();
     // 7200 HwpUnit = 1 inch
     return static_cast<double>(hwp_unit) / 7200.0;
 }
 
 double HwpWrapper::HwpUnitToPoint(int hwp_unit)
 {
+    CPYHWPX_TRACE_METHOD();
     // 7200 HwpUnit = 72 point, 100 HwpUnit = 1 point
     return static_cast<double>(hwp_unit) / 100.0;
 }
 
 int HwpWrapper::PointToHwpUnit(double point)
 {
+    CPYHWPX_TRACE_METHOD();
     // 1 point = 100 HwpUnit
     return static_cast<int>(point * 100.0 + 0.5);
 }
@@ -11,9 +11,14 @@
 #include "HwpTypes.h"
 #include "XHwpDocument.h"
 #include "XHwpDocuments.h"
-#include <Windows.h>
-#include <comdef.h>
-#include <oleidl.h>  // IOleWindow, IOleObject 지원
+#include "PrivateInfoScanner.h"
+#include "BstrString.h"
+#include "HwpBatch.h"
+#include "EditTracker.h"
+#include "FieldIndex.h"
+#include "TemplateCache.h"
+#include "CheckpointStore.h"
+#include "ComPlatform.h"
 #include <memory>
 #include <functional>
 #include <unordered_map>
@@ -53,6 +58,9 @@ class HwpAction;
 class HwpParameterSet;
 class XHwpDocument;
 class XHwpDocuments;
+class ActionRecorder;
+class ParameterSetPool;
+class BulkEditScope;
 
 /**
  * @class HwpWrapper
@@ -97,6 +105,16 @@ public:
      */
     bool Initialize();
 
+    /**
+     * @brief 외부에서 만든 HwpObject 연결 (테스트/벤치마크용)
+     * @param hwp_object HwpObject와 같은 멤버를 제공하는 IDispatch (AddRef 함)
+     * @return 성공 여부
+     *
+     * 기존 객체와 DISPID 캐시를 해제한 뒤 초기화된 상태로 전환한다.
+     * 편집 모드/창 표시/보안 모듈 등록은 하지 않는다.
+     */
+    bool Attach(IDispatch* hwp_object);
+
     /**
      * @brief 보안 모듈 등록 (COM API 직접 호출)
      * @param module_type 모듈 유형 ("FilePathCheckDLL" 등)
@@ -234,6 +252,29 @@ public:
     std::wstring GetTextFile(const std::wstring& format = L"UNICODE",
                              const std::wstring& option = L"");
 
+    /**
+     * @brief GetTextFile 결과를 BSTR 그대로 반환 (복사 없음)
+     *
+     * Python 바인딩용. 대용량 HWPML2X 결과의 중간 std::wstring 복사를 피한다.
+     */
+    BstrString GetTextFileBstr(const std::wstring& format = L"UNICODE",
+                               const std::wstring& option = L"");
+
+    /**
+     * @brief 문단 블록 단위 스트리밍 추출
+     * @param format GetTextFile 형식 ("UNICODE", "HWPML2X" 등)
+     * @param chunk_paras 청크당 최대 문단 수
+     * @param callback 청크마다 호출 (청크, 0부터 시작하는 순번). false 반환 시 중단
+     * @param max_chunk_bytes 청크당 최대 바이트 (UTF-16 기준, 0이면 문단 수로만 나눔)
+     * @return 전달한 청크 수
+     *
+     * 문서 전체를 하나의 BSTR로 받지 않으므로 최대 메모리가 청크 크기로 제한된다.
+     * 추출 후 원래 캐럿 위치로 복원. 자세한 동작은 TextChunkReader 참고.
+     */
+    int GetTextFileChunks(const std::wstring& format, int chunk_paras,
+                          const std::function<bool(const BstrString&, int)>& callback,
+                          size_t max_chunk_bytes = 0);
+
     /**
      * @brief 텍스트 데이터 삽입 (SetTextFile API)
      * @param data GetTextFile로 추출한 텍스트 데이터
@@ -245,6 +286,92 @@ public:
                     const std::wstring& format = L"HWPML2X",
                     const std::wstring& option = L"insertfile");
 
+    /**
+     * @brief 텍스트 데이터 삽입 (BSTR 직접 전달)
+     *
+     * 수 MB 단위 HTML/HWPML 데이터를 std::wstring 복사 없이 전달한다.
+     * Python 바인딩은 str/bytes(UTF-8, BOM 있는 UTF-16LE)를 바로 BSTR로 변환.
+     */
+    int SetTextFileBstr(const BstrString& data,
+                        const std::wstring& format = L"HWPML2X",
+                        const std::wstring& option = L"insertfile");
+
+    //=========================================================================
+    // 서식 캐시 (Template Cache)
+    //=========================================================================
+
+    /**
+     * @brief 서식 문서로 새 문서 시작 (처음 한 번만 파일에서 열기)
+     * @param filename 서식 파일 경로 (.hwt/.hwp/.hwpx)
+     * @param format 보관 형식 ("HWP"=BASE64, "HWPML2X")
+     * @return 성공 여부
+     *
+     * 캐시에 없으면 Open 후 GetTextFile(format) 결과를 보관하고,
+     * 있으면 현재 문서를 비우고(ClearDocument) SetTextFile로 내용을 채운다.
+     * 서식 파일 크기나 수정 시각이 보관할 때와 다르면 다시 연다.
+     */
+    bool OpenTemplate(const std::wstring& filename, const std::wstring& format = L"HWP");
+
+    /**
+     * @brief 서식 캐시에서 빼기
+     * @return 캐시에 있었으면 true
+     */
+    bool EvictTemplate(const std::wstring& filename, const std::wstring& format = L"HWP");
+
+    /**
+     * @brief 서식 캐시 바이트 한도 (기본 64MB, 0이면 캐시 사용 안 함)
+     */
+    void SetTemplateCacheLimit(size_t max_bytes) { m_templates.SetMaxBytes(max_bytes); }
+
+    /**
+     * @brief 서식 캐시 (보관 수/적중 통계 조회용)
+     */
+    const TemplateCache& GetTemplateCache() const { return m_templates; }
+
+    /**
+     * @brief 서식 캐시 비우기
+     */
+    void ClearTemplateCache() { m_templates.Clear(); }
+
+    //=========================================================================
+    // 체크포인트 (Checkpoint)
+    //=========================================================================
+
+    /**
+     * @brief 현재 문서를 메모리에 스냅샷 (활성 문서의 DocumentID도 함께 보관)
+     * @param format GetTextFile 형식 ("HWP"=BASE64, 디코딩해서 보관)
+     * @return 토큰 (실패하거나 한도보다 크면 0)
+     */
+    int Checkpoint(const std::wstring& format = L"HWP");
+
+    /**
+     * @brief 스냅샷으로 문서 되돌리기 (SetTextFile로 전체 교체 후 캐럿 위치 복원)
+     * @param token Checkpoint 결과 (복원 후에도 유지)
+     * @return 성공 여부 (없는 토큰이거나 활성 문서가 스냅샷을 뜬 문서가 아니면 false)
+     */
+    bool Restore(int token);
+
+    /**
+     * @brief 스냅샷 삭제
+     * @return 있었으면 true
+     */
+    bool DropCheckpoint(int token) { return m_checkpoints.Erase(token); }
+
+    /**
+     * @brief 체크포인트 한도 (기본 256MB, 16개, 0이면 체크포인트 사용 안 함)
+     */
+    void SetCheckpointLimits(size_t max_bytes, size_t max_count) { m_checkpoints.SetLimits(max_bytes, max_count); }
+
+    /**
+     * @brief 체크포인트 저장소 (보관 수/바이트 조회용)
+     */
+    const CheckpointStore& GetCheckpointStore() const { return m_checkpoints; }
+
+    /**
+     * @brief 모든 스냅샷 삭제
+     */
+    void ClearCheckpoints() { m_checkpoints.Clear(); }
+
     /**
      * @brief PDF 파일 열기
      * pyhwpx의 open_pdf()에 대응
@@ -285,12 +412,24 @@ public:
      */
     bool InsertText(const std::wstring& text);
 
+    /**
+     * @brief 텍스트 삽입 (BSTR 직접 전달)
+     * @param text 미리 할당한 BSTR (Python str/bytes에서 한 번만 변환)
+     * @return 성공 여부
+     */
+    bool InsertTextBstr(const BstrString& text);
+
     /**
      * @brief 현재 위치의 텍스트 가져오기
      * @return (상태코드, 텍스트) 튜플
      */
     std::tuple<int, std::wstring> GetText();
 
+    /**
+     * @brief GetText 결과를 BSTR 그대로 반환 (복사 없음)
+     */
+    std::tuple<int, BstrString> GetTextBstr();
+
     /**
      * @brief 선택된 텍스트 가져오기
      * @param keep_select 선택 유지 여부
@@ -412,12 +551,34 @@ public:
      */
     void SetVisible(bool visible);
 
+    /**
+     * @brief 마지막으로 설정한 창 표시 여부
+     */
+    bool IsVisible() const { return m_bVisible; }
+
+    /**
+     * @brief BulkEditScope 안인지 여부
+     */
+    bool IsBulkEdit() const { return m_bulkEditDepth > 0; }
+
     /**
      * @brief HWP 창 핸들(HWND) 획득
      * @return HWND (실패 시 NULL)
      */
     HWND GetHwnd();
 
+    /**
+     * @brief 한/글 프로세스 ID (창을 가진 프로세스)
+     * @return 알 수 없으면 0
+     */
+    uint32_t GetProcessId();
+
+    /**
+     * @brief 한/글 프로세스 메모리 사용량 (창을 가진 프로세스의 작업 집합)
+     * @return 바이트 (알 수 없으면 0)
+     */
+    size_t GetProcessMemory();
+
     /**
      * @brief OLE 객체 활성화 (OLEIVERB_SHOW)
      * @return 성공 여부
@@ -778,6 +939,11 @@ public:
      */
     std::wstring GetFieldList(int number = 1, int option = 0);
 
+    /**
+     * @brief GetFieldList 결과를 BSTR 그대로 반환 (복사 없음)
+     */
+    BstrString GetFieldListBstr(int number = 1, int option = 0);
+
     /**
      * @brief 필드 텍스트 조회
      * @param field 필드 이름 ({{n}} 인덱스 지원)
@@ -868,6 +1034,29 @@ public:
      */
     std::map<std::wstring, std::wstring> FieldsToMap();
 
+    /**
+     * @brief 같은 이름의 필드 개수 (필드 색인 사용)
+     * @param name 필드 이름
+     * @return 필드 개수 (없으면 0)
+     */
+    int GetFieldCount(const std::wstring& name);
+
+    /**
+     * @brief 필드 색인 (오래됐으면 GetFieldList 한 번으로 다시 구성)
+     *
+     * FieldsToMap, DeleteFieldByName, GetFieldCount가 이 색인을 쓴다.
+     * 내용 편집(EditKind::Content)이 기록되면 다음 조회 때 다시 구성하며,
+     * PutFieldText는 색인이 최신일 때 값을 그대로 반영해 최신 상태를 유지한다.
+     * 창이 보이는 동안은 화면에서의 편집을 알 수 없으므로 색인을 매번 다시 구성하고,
+     * FieldExist/GetFieldText(단일 필드)는 색인 대신 한/글에 직접 묻는다.
+     */
+    const FieldIndex& GetFieldIndex() { return EnsureFieldIndex(false); }
+
+    /**
+     * @brief 필드 색인 버림 (래퍼 밖에서 필드를 바꾼 경우)
+     */
+    void InvalidateFieldIndex();
+
     //=========================================================================
     // 필드/메타태그 확장
     //=========================================================================
@@ -889,6 +1078,23 @@ public:
      */
     int FindPrivateInfo(int privateType, const std::wstring& privateString);
 
+    /**
+     * @brief 문서 전체 개인정보 네이티브 스캔
+     *
+     * GetTextFile("UNICODE")로 한 번만 추출한 뒤 PrivateInfoScanner로 검사.
+     * 유형/문자열마다 COM을 호출하는 FindPrivateInfo보다 훨씬 빠르다.
+     *
+     * @param types 탐지할 유형 (PrivateInfoType 비트 조합)
+     * @param validate_checksum 주민/외국인등록번호 체크섬 검증 여부
+     * @return 탐지 결과 (오프셋은 추출된 텍스트 기준)
+     *
+     * 오프셋은 문서 위치(list/para/pos)로 바꿀 수 없다. 추출 텍스트에는 표/글상자 등
+     * 다른 리스트의 문단이 본문 사이에 끼고 컨트롤 자리가 빠지기 때문이다.
+     * 문서에서 찾아가려면 탐지된 text로 Find 한다.
+     */
+    std::vector<PrivateInfoMatch> ScanPrivateInfo(int types = PrivateInfoType::All,
+                                                  bool validate_checksum = true);
+
     /**
      * @brief 현재 메타태그명 조회
      * @return 메타태그 이름 (없으면 빈 문자열)
@@ -935,6 +1141,21 @@ public:
      */
     bool ModifyMetatagProperties(const std::wstring& tag, bool remove, bool add);
 
+    /**
+     * @brief 모든 메타태그를 맵으로 변환
+     *
+     * GetMetatagList 한 번 후 같은 DISPID와 인자 버퍼로 태그별 텍스트를 읽는다.
+     * @return 메타태그명:텍스트 맵
+     */
+    std::map<std::wstring, std::wstring> MetatagsToMap();
+
+    /**
+     * @brief 여러 메타태그 텍스트 일괄 설정
+     * @param texts 메타태그명:텍스트 맵
+     * @return 모두 성공하면 true (실패해도 나머지는 계속 설정)
+     */
+    bool PutMetatagTexts(const std::map<std::wstring, std::wstring>& texts);
+
     /**
      * @brief 필드 정보 리스트 (HWPML2X 파싱)
      * @return 필드 정보 목록 [{name, direction, memo}, ...]
@@ -1076,6 +1297,11 @@ public:
      */
     std::wstring GetTableXml();
 
+    /**
+     * @brief GetTableXml 결과를 BSTR 그대로 반환 (복사 없음)
+     */
+    BstrString GetTableXmlBstr();
+
     //=========================================================================
     // 스타일 관리 (CharShape/ParaShape)
     //=========================================================================
@@ -1192,6 +1418,53 @@ public:
      */
     IDispatch* CreateSet(const std::wstring& set_id);
 
+    /**
+     * @brief 풀에서 파라미터셋 빌리기 (없으면 CreateSet)
+     * @return 항목이 비워진 세트 (호출자가 참조 소유, 다 쓰면 ReleaseSet)
+     */
+    IDispatch* AcquireSet(const std::wstring& set_id);
+
+    /**
+     * @brief 빌린 파라미터셋을 풀에 반환 (참조를 넘겨받음)
+     */
+    void ReleaseSet(const std::wstring& set_id, IDispatch* pset);
+
+    /**
+     * @brief 풀에서 파라미터셋 빌리기 (HwpParameterSet 소멸 시 자동 반환)
+     */
+    std::unique_ptr<HwpParameterSet> AcquireParameterSet(const std::wstring& set_id);
+
+    /**
+     * @brief 세트 ID별 파라미터셋 풀 최대 보관 수 (기본 8, 0이면 풀 사용 안 함)
+     */
+    void SetParameterSetPoolLimit(size_t max_per_id);
+
+    /**
+     * @brief 파라미터셋 풀 (보관 수/적중 통계 조회용)
+     */
+    const ParameterSetPool& GetParameterSetPool() const { return *m_setPool; }
+
+    /**
+     * @brief 파라미터셋 풀 비우기
+     */
+    void ClearParameterSetPool();
+
+    /**
+     * @brief 파라미터셋 액션 실행 (항목 일괄 설정)
+     * @param action_name 액션 ID (예: "CharShape")
+     * @param set_name 파라미터셋 ID
+     * @param items (이름, 값) 목록 (값 VARIANT는 빌려서 전달)
+     */
+    bool ExecuteSetItems(const std::wstring& action_name, const std::wstring& set_name,
+                         const std::vector<std::pair<std::wstring, VARIANT>>& items);
+
+    /**
+     * @brief 파라미터셋 속성(CharShape, ParaShape, CellShape 등)의 항목 일괄 조회
+     * @return names 순서의 값 (호출자가 VariantClear 책임), 속성을 얻지 못하면 빈 벡터
+     */
+    std::vector<VARIANT> GetPropertySetItems(const std::wstring& property,
+                                             const std::vector<std::wstring>& names);
+
     /**
      * @brief 현재 위치의 컨트롤을 찾아 선택
      * @return 성공 여부 (컨트롤을 찾으면 true)
@@ -1421,6 +1694,55 @@ public:
      */
     std::wstring GetCurrentFont();
 
+    //=========================================================================
+    // 편집 세대 (Edit Generation)
+    //=========================================================================
+
+    /**
+     * @brief 편집 세대 추적기 (캐시 무효화 등록, 도장 비교)
+     */
+    EditTracker& GetEditTracker() { return m_edits; }
+    const EditTracker& GetEditTracker() const { return m_edits; }
+
+    /**
+     * @brief 문서 세대 (캐럿 이동을 뺀 편집마다 증가)
+     */
+    uint64_t GetEditGeneration() const { return m_edits.GetGeneration(); }
+
+    /**
+     * @brief 래퍼 밖에서 문서를 바꾼 경우 직접 알림 (원시 COM 호출, 화면 편집 등)
+     * @param kinds EditKind 조합
+     */
+    void NoteEdit(int kinds = EditKind::All) { m_edits.Note(kinds); }
+
+    //=========================================================================
+    // 작업 기록 (Action Recording)
+    //=========================================================================
+
+    /**
+     * @brief 이 HwpWrapper의 작업 기록 시작 (이전 기록 삭제)
+     * @param log_path 비어 있지 않으면 작업마다 이 파일에 이어 쓰고 flush
+     *                 (비정상 종료 후 HwpBatch::LoadFile로 복구)
+     * @return 로그 파일을 열지 못하면 false
+     */
+    bool StartRecording(const std::wstring& log_path = L"");
+
+    /**
+     * @brief 작업 기록 중지
+     * @return 기록된 작업 (HwpBatch::Execute로 재생, 재생할 수 없는 작업은 Skipped)
+     */
+    HwpBatch StopRecording();
+
+    /**
+     * @brief 작업 기록 중인지 여부
+     */
+    bool IsRecording() const;
+
+    /**
+     * @brief 작업 기록기 (기록 중이 아니면 nullptr일 수 있음, HwpAction 등 기록 지점용)
+     */
+    ActionRecorder* GetActionRecorder() const { return m_recorder.get(); }
+
     //=========================================================================
     // COM 인터페이스 직접 접근 (고급)
     //=========================================================================
@@ -1625,6 +1947,40 @@ private:
 
     DISPIDCache m_dispidCache;      // DISPID 캐시 (성능 최적화)
     std::vector<IDispatch*> m_posCache;  // GetPosBySet 결과 캐시 (Python용)
+    std::unique_ptr<ActionRecorder> m_recorder;  // 작업 기록기 (기록 중에만 생성)
+    std::shared_ptr<ParameterSetPool> m_setPool;  // 세트 ID별 파라미터셋 풀
+    EditTracker m_edits;            // 편집 세대/캐시 무효화
+    FieldIndex m_fieldIndex;        // 필드 이름 → 개수/값 색인
+    uint64_t m_fieldIndexStamp;     // 색인 구성 시점의 Content 도장
+    bool m_fieldTextsTried;         // 이번 색인에서 값 일괄 조회를 시도했는지
+    TemplateCache m_templates;      // 서식 문서 직렬화 캐시
+    CheckpointStore m_checkpoints;  // 문서 스냅샷
+    int m_bulkEditDepth;            // 중첩된 BulkEditScope 수
+
+    friend class BulkEditScope;
+
+    /**
+     * @brief 필드 색인이 현재 문서와 맞는지 여부
+     */
+    bool IsFieldIndexCurrent() const;
+
+    /**
+     * @brief 편집 세대로 필드 색인을 재사용해도 되는지
+     *
+     * 창이 보이면 사용자가 화면에서 직접 고칠 수 있어 세대를 믿을 수 없다.
+     */
+    bool IsFieldIndexTrusted() const { return !m_bVisible; }
+
+    /**
+     * @brief 필드 색인 확보
+     * @param with_texts true면 값 캐시도 채움 (GetFieldText 일괄 호출 한 번)
+     */
+    const FieldIndex& EnsureFieldIndex(bool with_texts);
+
+    /**
+     * @brief 활성 문서의 DocumentID (알 수 없으면 -1)
+     */
+    int GetActiveDocumentID();
 
     /**
      * @brief COM 초기화
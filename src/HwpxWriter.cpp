@@ -0,0 +1,1091 @@
+/**
+ * @file HwpxWriter.cpp
+ * @brief HwpxWriter 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "HwpxWriter.h"
+#include "ZipReader.h"
+#include "Platform.h"
+#include "Utils.h"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+
+namespace cpyhwpx {
+
+namespace {
+
+const char kXmlDeclaration[] = "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\" ?>";
+
+const char kNamespaces[] =
+    " xmlns:ha=\"http://www.hancom.co.kr/hwpml/2011/app\""
+    " xmlns:hp=\"http://www.hancom.co.kr/hwpml/2011/paragraph\""
+    " xmlns:hp10=\"http://www.hancom.co.kr/hwpml/2016/paragraph\""
+    " xmlns:hs=\"http://www.hancom.co.kr/hwpml/2011/section\""
+    " xmlns:hc=\"http://www.hancom.co.kr/hwpml/2011/core\""
+    " xmlns:hh=\"http://www.hancom.co.kr/hwpml/2011/head\""
+    " xmlns:hhs=\"http://www.hancom.co.kr/hwpml/2011/history\""
+    " xmlns:hm=\"http://www.hancom.co.kr/hwpml/2011/master-page\""
+    " xmlns:hpf=\"http://www.hancom.co.kr/schema/2011/hpf\""
+    " xmlns:dc=\"http://purl.org/dc/elements/1.1/\""
+    " xmlns:opf=\"http://www.idpf.org/2007/opf/\""
+    " xmlns:ooxmlchart=\"http://www.hancom.co.kr/hwpml/2016/ooxmlchart\""
+    " xmlns:hwpunitchar=\"http://www.hancom.co.kr/hwpml/2016/HwpUnitChar\""
+    " xmlns:epub=\"http://www.idpf.org/2007/ops\""
+    " xmlns:config=\"urn:oasis:names:tc:opendocument:xmlns:config:1.0\"";
+
+const char* const kFontLangs[] = { "HANGUL", "LATIN", "HANJA", "JAPANESE", "OTHER", "SYMBOL", "USER" };
+constexpr int kLangCount = 7;
+
+const wchar_t kDefaultFace[] = L"함초롬바탕";
+
+constexpr size_t kSectionFlushSize = 64 * 1024;
+constexpr HwpUnit kPixel = 75;                  // 96 DPI에서 1픽셀
+constexpr HwpUnit kDefaultPicture = 14173;      // 크기를 알 수 없는 그림 (5cm)
+constexpr HwpUnit kCellHeight = 1000;
+constexpr HwpUnit kCellMarginX = 510;
+constexpr HwpUnit kCellMarginY = 141;
+
+// header.xml borderFill ID (1부터)
+constexpr int kNoBorderFill = 1;
+constexpr int kSolidBorderFill = 2;
+
+FILE* OpenFile(const std::wstring& path)
+{
+#if defined(_WIN32)
+    return _wfopen(path.c_str(), L"rb");
+#else
+    return fopen(Utils::ToUtf8(path).c_str(), "rb");
+#endif
+}
+
+void Append(std::string& out, const char* format, ...)
+{
+    char buf[512];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    if (n > 0) out.append(buf, std::min(static_cast<size_t>(n), sizeof(buf) - 1));
+}
+
+/**
+ * @brief 속성 값/본문용 XML 이스케이프
+ */
+void AppendEscaped(std::string& out, const std::wstring& text)
+{
+    std::wstring escaped;
+    escaped.reserve(text.size());
+    for (wchar_t ch : text) {
+        switch (ch) {
+        case L'&': escaped += L"&amp;"; break;
+        case L'<': escaped += L"&lt;"; break;
+        case L'>': escaped += L"&gt;"; break;
+        case L'"': escaped += L"&quot;"; break;
+        default:
+            if (ch >= 0x20 || ch == L'\t') escaped += ch;
+            break;
+        }
+    }
+    out += Utils::ToUtf8(escaped);
+}
+
+/**
+ * @brief <hp:t> 본문 (\t → 탭, \n → 줄 바꿈)
+ */
+void AppendText(std::string& out, const std::wstring& text)
+{
+    if (text.empty()) {
+        out += "<hp:t/>";
+        return;
+    }
+
+    out += "<hp:t>";
+    size_t start = 0;
+    for (size_t i = 0; i <= text.size(); ++i) {
+        if (i < text.size() && text[i] != L'\t' && text[i] != L'\n') continue;
+        AppendEscaped(out, text.substr(start, i - start));
+        if (i < text.size()) {
+            out += (text[i] == L'\t') ? "<hp:tab/>" : "<hp:lineBreak/>";
+        }
+        start = i + 1;
+    }
+    out += "</hp:t>";
+}
+
+std::string ColorString(int rgb)
+{
+    // RGB() 값 (0x00BBGGRR) → #RRGGBB
+    char buf[8];
+    snprintf(buf, sizeof(buf), "#%02X%02X%02X", rgb & 0xFF, (rgb >> 8) & 0xFF, (rgb >> 16) & 0xFF);
+    return buf;
+}
+
+const char* AlignName(HAlign align)
+{
+    switch (align) {
+    case HAlign::Left:       return "LEFT";
+    case HAlign::Center:     return "CENTER";
+    case HAlign::Right:      return "RIGHT";
+    case HAlign::Distribute: return "DISTRIBUTE";
+    case HAlign::Division:   return "DISTRIBUTE_SPACE";
+    case HAlign::Justify:
+    default:                 return "JUSTIFY";
+    }
+}
+
+const char* LineSpacingName(int type)
+{
+    switch (type) {
+    case 1:  return "FIXED";
+    case 2:  return "BETWEEN_LINES";
+    case 3:  return "AT_LEAST";
+    default: return "PERCENT";
+    }
+}
+
+/**
+ * @brief 이미 압축된 형식 (다시 Deflate해도 줄지 않음)
+ */
+bool IsCompressedFormat(const std::string& name)
+{
+    size_t dot = name.rfind('.');
+    if (dot == std::string::npos) return false;
+    std::string ext = name.substr(dot + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](char c) {
+        return static_cast<char>((c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c);
+    });
+    return ext == "jpg" || ext == "jpeg" || ext == "png" || ext == "gif" ||
+           ext == "zip" || ext == "hwpx" || ext == "ole";
+}
+
+std::string MediaType(const std::string& extension)
+{
+    if (extension == "jpg" || extension == "jpeg") return "image/jpeg";
+    if (extension == "png") return "image/png";
+    if (extension == "gif") return "image/gif";
+    if (extension == "bmp") return "image/bmp";
+    return "application/octet-stream";
+}
+
+uint32_t ReadBE(const std::string& data, size_t pos, int bytes)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < bytes; ++i) value = (value << 8) | static_cast<uint8_t>(data[pos + i]);
+    return value;
+}
+
+uint32_t ReadLE(const std::string& data, size_t pos, int bytes)
+{
+    uint32_t value = 0;
+    for (int i = bytes - 1; i >= 0; --i) value = (value << 8) | static_cast<uint8_t>(data[pos + i]);
+    return value;
+}
+
+/**
+ * @brief 이미지 헤더에서 픽셀 크기 읽기 (PNG/JPEG/GIF/BMP)
+ */
+bool ReadImageSize(const std::string& data, int& width, int& height)
+{
+    if (data.size() >= 24 && data.compare(0, 8, "\x89PNG\r\n\x1a\n") == 0) {
+        width = static_cast<int>(ReadBE(data, 16, 4));
+        height = static_cast<int>(ReadBE(data, 20, 4));
+        return true;
+    }
+    if (data.size() >= 10 && (data.compare(0, 6, "GIF87a") == 0 || data.compare(0, 6, "GIF89a") == 0)) {
+        width = static_cast<int>(ReadLE(data, 6, 2));
+        height = static_cast<int>(ReadLE(data, 8, 2));
+        return true;
+    }
+    if (data.size() >= 26 && data.compare(0, 2, "BM") == 0) {
+        width = static_cast<int>(ReadLE(data, 18, 4));
+        height = std::abs(static_cast<int>(ReadLE(data, 22, 4)));
+        return true;
+    }
+    if (data.size() >= 4 && static_cast<uint8_t>(data[0]) == 0xFF && static_cast<uint8_t>(data[1]) == 0xD8) {
+        size_t pos = 2;
+        while (pos + 9 < data.size()) {
+            if (static_cast<uint8_t>(data[pos]) != 0xFF) return false;
+            uint8_t marker = static_cast<uint8_t>(data[pos + 1]);
+            if (marker == 0xFF) {
+                ++pos;
+                continue;
+            }
+            size_t length = ReadBE(data, pos + 2, 2);
+            bool sof = marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+            if (sof) {
+                height = static_cast<int>(ReadBE(data, pos + 5, 2));
+                width = static_cast<int>(ReadBE(data, pos + 7, 2));
+                return true;
+            }
+            pos += 2 + length;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+//=============================================================================
+// 문서 모델
+//=============================================================================
+
+HwpxParagraph& HwpxParagraph::AddText(const std::wstring& text, int char_shape)
+{
+    HwpxRun run;
+    run.kind = HwpxRun::Kind::Text;
+    run.text = text;
+    run.char_shape = char_shape;
+    runs.push_back(std::move(run));
+    return *this;
+}
+
+HwpxParagraph& HwpxParagraph::AddField(const std::wstring& name, const std::wstring& text, int char_shape)
+{
+    HwpxRun run;
+    run.kind = HwpxRun::Kind::Field;
+    run.field_name = name;
+    run.text = text;
+    run.char_shape = char_shape;
+    runs.push_back(std::move(run));
+    return *this;
+}
+
+HwpxParagraph& HwpxParagraph::AddPicture(int image, HwpUnit width, HwpUnit height)
+{
+    HwpxRun run;
+    run.kind = HwpxRun::Kind::Picture;
+    run.image = image;
+    run.width = width;
+    run.height = height;
+    runs.push_back(std::move(run));
+    return *this;
+}
+
+HwpxParagraph& HwpxParagraph::AddTable(const HwpxTable& table)
+{
+    HwpxRun run;
+    run.kind = HwpxRun::Kind::Table;
+    run.table = std::make_shared<HwpxTable>(table);
+    runs.push_back(std::move(run));
+    return *this;
+}
+
+HwpxTable::HwpxTable(int rows_, int cols_)
+    : rows(std::max(rows_, 0))
+    , cols(std::max(cols_, 0))
+{
+    cells.reserve(static_cast<size_t>(rows) * static_cast<size_t>(cols));
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            HwpxCell cell;
+            cell.row = r;
+            cell.col = c;
+            cells.push_back(std::move(cell));
+        }
+    }
+}
+
+HwpxTable HwpxTable::FromRows(const std::vector<std::vector<std::wstring>>& data,
+                              int char_shape, int para_shape)
+{
+    size_t width = 0;
+    for (const auto& row : data) width = std::max(width, row.size());
+
+    HwpxTable table(static_cast<int>(data.size()), static_cast<int>(width));
+    for (size_t r = 0; r < data.size(); ++r) {
+        for (size_t c = 0; c < data[r].size(); ++c) {
+            table.SetText(static_cast<int>(r), static_cast<int>(c), data[r][c], char_shape, para_shape);
+        }
+    }
+    return table;
+}
+
+HwpxCell* HwpxTable::Cell(int row, int col)
+{
+    for (HwpxCell& cell : cells) {
+        if (cell.row == row && cell.col == col) return &cell;
+    }
+    return nullptr;
+}
+
+bool HwpxTable::SetText(int row, int col, const std::wstring& text, int char_shape, int para_shape)
+{
+    HwpxCell* cell = Cell(row, col);
+    if (!cell) return false;
+
+    cell->paragraphs.clear();
+    size_t start = 0;
+    for (;;) {
+        size_t end = text.find(L'\n', start);
+        HwpxParagraph paragraph;
+        paragraph.para_shape = para_shape;
+        paragraph.AddText(text.substr(start, end == std::wstring::npos ? std::wstring::npos : end - start),
+                          char_shape);
+        cell->paragraphs.push_back(std::move(paragraph));
+        if (end == std::wstring::npos) break;
+        start = end + 1;
+    }
+    return true;
+}
+
+bool HwpxTable::Merge(int row, int col, int row_span, int col_span)
+{
+    if (row_span < 1 || col_span < 1 || row < 0 || col < 0 ||
+        row + row_span > rows || col + col_span > cols) {
+        return false;
+    }
+
+    HwpxCell* anchor = Cell(row, col);
+    if (!anchor) return false;
+
+    // 이미 다른 병합에 걸친 칸은 병합하지 않음
+    for (const HwpxCell& cell : cells) {
+        if (&cell == anchor) continue;
+        bool overlaps = cell.row < row + row_span && row < cell.row + cell.row_span &&
+                        cell.col < col + col_span && col < cell.col + cell.col_span;
+        bool inside = cell.row >= row && cell.row + cell.row_span <= row + row_span &&
+                      cell.col >= col && cell.col + cell.col_span <= col + col_span;
+        if (overlaps && !inside) return false;
+    }
+
+    anchor->row_span = row_span;
+    anchor->col_span = col_span;
+    cells.erase(std::remove_if(cells.begin(), cells.end(), [&](const HwpxCell& cell) {
+                    return !(cell.row == row && cell.col == col) &&
+                           cell.row >= row && cell.row < row + row_span &&
+                           cell.col >= col && cell.col < col + col_span;
+                }),
+                cells.end());
+    return true;
+}
+
+//=============================================================================
+// 생성자/소멸자
+//=============================================================================
+
+int HwpxWriter::ShapeTable::Add(std::string body)
+{
+    auto it = lookup.find(body);
+    if (it != lookup.end()) return it->second;
+
+    int id = static_cast<int>(xml.size());
+    lookup.emplace(body, id);
+    xml.push_back(std::move(body));
+    return id;
+}
+
+HwpxWriter::HwpxWriter()
+    : m_level(6)
+    , m_fonts(kLangCount)
+    , m_inSection(false)
+    , m_textWidth(0)
+    , m_sectionCount(0)
+    , m_nextObjectId(1)
+    , m_paragraphs(0)
+    , m_xmlBytes(0)
+{
+    // 기본 모양 (ID 0) 과 테두리 (1: 없음, 2: 실선)
+    AddCharShape(CharShape());
+    AddParaShape(ParaShape());
+    HwpxBorderFill none;
+    none.border = false;
+    AddBorderFill(none);
+    AddBorderFill(HwpxBorderFill());
+}
+
+HwpxWriter::~HwpxWriter() = default;
+
+bool HwpxWriter::Open(const std::wstring& path, int level, size_t threads)
+{
+    if (m_zip.IsOpen()) return false;
+    m_zip.SetThreads(threads);
+    if (!m_zip.Open(path)) return false;
+
+    m_level = level;
+    m_sectionCount = 0;
+    m_paragraphs = 0;
+    m_xmlBytes = 0;
+    m_nextObjectId = 1;
+
+    // mimetype은 압축하지 않은 첫 항목이어야 함
+    static const char kMimeType[] = "application/hwp+zip";
+    m_zip.AddEntry("mimetype", kMimeType, sizeof(kMimeType) - 1, ZipWriter::Method::Store);
+
+    std::string version = kXmlDeclaration;
+    version += "<hv:HCFVersion xmlns:hv=\"http://www.hancom.co.kr/hwpml/2011/version\""
+               " tagetApplication=\"WORDPROCESSOR\" major=\"5\" minor=\"1\" micro=\"0\" buildNumber=\"1\""
+               " os=\"1\" xmlVersion=\"1.4\" application=\"Hancom Office Hangul\" appVersion=\"11, 0, 0, 0\"/>";
+    return m_zip.AddEntry("version.xml", version.data(), version.size(), ZipWriter::Method::Deflate, m_level);
+}
+
+//=============================================================================
+// 모양
+//=============================================================================
+
+int HwpxWriter::AddFont(int lang, const std::wstring& face, int type)
+{
+    std::wstring name = face.empty() ? std::wstring(kDefaultFace) : face;
+    auto& fonts = m_fonts[static_cast<size_t>(lang)];
+    for (size_t i = 0; i < fonts.size(); ++i) {
+        if (fonts[i].first == name && fonts[i].second == type) return static_cast<int>(i);
+    }
+    fonts.emplace_back(name, type);
+    return static_cast<int>(fonts.size() - 1);
+}
+
+int HwpxWriter::AddCharShape(const CharShape& shape)
+{
+    const std::wstring* faces[kLangCount] = {
+        &shape.FaceNameHangul, &shape.FaceNameLatin, &shape.FaceNameHanja, &shape.FaceNameJapanese,
+        &shape.FaceNameOther, &shape.FaceNameSymbol, &shape.FaceNameUser,
+    };
+    const int types[kLangCount] = {
+        shape.FontTypeHangul, shape.FontTypeLatin, shape.FontTypeHanja, shape.FontTypeJapanese,
+        shape.FontTypeOther, shape.FontTypeSymbol, shape.FontTypeUser,
+    };
+    int fontIds[kLangCount];
+    for (int i = 0; i < kLangCount; ++i) {
+        fontIds[i] = AddFont(i, *faces[i], types[i]);
+    }
+
+    std::string body;
+    Append(body, " height=\"%d\" textColor=\"%s\" shadeColor=\"%s\" useFontSpace=\"0\" useKerning=\"0\""
+                 " symMark=\"NONE\" borderFillIDRef=\"%d\">",
+           shape.Height, ColorString(shape.TextColor).c_str(),
+           shape.ShadeColor < 0 ? "none" : ColorString(shape.ShadeColor).c_str(), kNoBorderFill);
+    Append(body, "<hh:fontRef hangul=\"%d\" latin=\"%d\" hanja=\"%d\" japanese=\"%d\" other=\"%d\""
+                 " symbol=\"%d\" user=\"%d\"/>",
+           fontIds[0], fontIds[1], fontIds[2], fontIds[3], fontIds[4], fontIds[5], fontIds[6]);
+
+    const char* groups[] = { "ratio", "spacing", "relSz", "offset" };
+    const int values[] = { shape.Ratio, shape.Spacing, 100, shape.Offset };
+    for (int g = 0; g < 4; ++g) {
+        int v = values[g];
+        Append(body, "<hh:%s hangul=\"%d\" latin=\"%d\" hanja=\"%d\" japanese=\"%d\" other=\"%d\""
+                     " symbol=\"%d\" user=\"%d\"/>",
+               groups[g], v, v, v, v, v, v, v);
+    }
+
+    if (shape.Italic) body += "<hh:italic/>";
+    if (shape.Bold) body += "<hh:bold/>";
+    Append(body, "<hh:underline type=\"%s\" shape=\"SOLID\" color=\"#000000\"/>",
+           shape.Underline ? "BOTTOM" : "NONE");
+    Append(body, "<hh:strikeout shape=\"%s\" color=\"#000000\"/>", shape.Strikeout ? "SOLID" : "NONE");
+    Append(body, "<hh:outline type=\"%s\"/>", shape.Outline ? "SOLID" : "NONE");
+    Append(body, "<hh:shadow type=\"%s\" color=\"#B2B2B2\" offsetX=\"10\" offsetY=\"10\"/>",
+           shape.Shadow ? "DROP" : "NONE");
+    if (shape.Emboss) body += "<hh:emboss/>";
+    if (shape.Engrave) body += "<hh:engrave/>";
+    if (shape.Superscript) body += "<hh:supscript/>";
+    if (shape.Subscript) body += "<hh:subscript/>";
+
+    return m_charShapes.Add(std::move(body));
+}
+
+int HwpxWriter::AddParaShape(const ParaShape& shape)
+{
+    std::string body;
+    body += " tabPrIDRef=\"0\" condense=\"0\" fontLineHeight=\"0\" snapToGrid=\"1\""
+            " suppressLineNumbers=\"0\" checked=\"0\">";
+    Append(body, "<hh:align horizontal=\"%s\" vertical=\"BASELINE\"/>", AlignName(shape.Align));
+    body += "<hh:heading type=\"NONE\" idRef=\"0\" level=\"0\"/>";
+    Append(body, "<hh:breakSetting breakLatinWord=\"KEEP_WORD\" breakNonLatinWord=\"KEEP_WORD\""
+                 " widowOrphan=\"%d\" keepWithNext=\"%d\" keepLines=\"%d\" pageBreakBefore=\"%d\""
+                 " lineWrap=\"BREAK\"/>",
+           shape.WidowOrphan ? 1 : 0, shape.KeepWithNext ? 1 : 0, shape.KeepLines ? 1 : 0,
+           shape.PageBreakBefore ? 1 : 0);
+    body += "<hh:autoSpacing eAsianEng=\"0\" eAsianNum=\"0\"/>";
+    Append(body, "<hh:margin><hc:intent value=\"%d\" unit=\"HWPUNIT\"/><hc:left value=\"%d\" unit=\"HWPUNIT\"/>"
+                 "<hc:right value=\"%d\" unit=\"HWPUNIT\"/><hc:prev value=\"%d\" unit=\"HWPUNIT\"/>"
+                 "<hc:next value=\"%d\" unit=\"HWPUNIT\"/></hh:margin>",
+           shape.Indent, shape.LeftMargin, shape.RightMargin, shape.SpaceBefore, shape.SpaceAfter);
+    Append(body, "<hh:lineSpacing type=\"%s\" value=\"%d\" unit=\"HWPUNIT\"/>",
+           LineSpacingName(shape.LineSpacingType), shape.LineSpacing);
+    Append(body, "<hh:border borderFillIDRef=\"%d\" offsetLeft=\"0\" offsetRight=\"0\" offsetTop=\"0\""
+                 " offsetBottom=\"0\" connect=\"0\" ignoreMargin=\"0\"/>",
+           kNoBorderFill);
+
+    return m_paraShapes.Add(std::move(body));
+}
+
+int HwpxWriter::AddBorderFill(const HwpxBorderFill& fill)
+{
+    std::string color = ColorString(fill.border_color);
+    const char* type = fill.border ? "SOLID" : "NONE";
+
+    std::string body = " threeD=\"0\" shadow=\"0\" centerLine=\"NONE\" breakCellSeparateLine=\"0\">"
+                       "<hh:slash type=\"NONE\" Crooked=\"0\" isCounter=\"0\"/>"
+                       "<hh:backSlash type=\"NONE\" Crooked=\"0\" isCounter=\"0\"/>";
+    const char* sides[] = { "leftBorder", "rightBorder", "topBorder", "bottomBorder" };
+    for (const char* side : sides) {
+        Append(body, "<hh:%s type=\"%s\" width=\"0.12 mm\" color=\"%s\"/>", side, type, color.c_str());
+    }
+    body += "<hh:diagonal type=\"SOLID\" width=\"0.1 mm\" color=\"#000000\"/>";
+    if (fill.fill_color >= 0) {
+        Append(body, "<hc:fillBrush><hc:winBrush faceColor=\"%s\" hatchColor=\"#999999\" alpha=\"0\"/>"
+                     "</hc:fillBrush>",
+               ColorString(fill.fill_color).c_str());
+    }
+
+    return m_borderFills.Add(std::move(body)) + 1;     // borderFill ID는 1부터
+}
+
+int HwpxWriter::AddImage(const std::wstring& path)
+{
+    auto it = m_imagePaths.find(path);
+    if (it != m_imagePaths.end()) return it->second;
+
+    FILE* file = OpenFile(path);
+    if (!file) return 0;
+
+    std::string data;
+    char buf[65536];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) {
+        data.append(buf, n);
+    }
+    fclose(file);
+
+    std::wstring ext = Utils::GetExtension(path);
+    if (!ext.empty() && ext[0] == L'.') ext.erase(0, 1);
+    int id = AddImageData(data, ext);
+    if (id > 0) m_imagePaths[path] = id;
+    return id;
+}
+
+int HwpxWriter::AddImageData(const std::string& data, const std::wstring& extension)
+{
+    if (data.empty()) return 0;
+
+    Image image;
+    image.data = data;
+    image.extension = Utils::ToUtf8(Utils::ToLower(extension));
+    if (image.extension == "jpeg") image.extension = "jpg";
+
+    int width = 0, height = 0;
+    if (ReadImageSize(data, width, height) && width > 0 && height > 0) {
+        image.width = width * kPixel;
+        image.height = height * kPixel;
+    } else {
+        image.width = 0;
+        image.height = 0;
+    }
+
+    m_images.push_back(std::move(image));
+    return static_cast<int>(m_images.size());
+}
+
+//=============================================================================
+// 섹션
+//=============================================================================
+
+std::string HwpxWriter::RenderSectionProperties(const HwpxPageDef& page) const
+{
+    std::string out;
+    out += "<hp:secPr id=\"\" textDirection=\"HORIZONTAL\" spaceColumns=\"1134\" tabStop=\"8000\""
+           " tabStopVal=\"4000\" tabStopUnit=\"HWPUNIT\" outlineShapeIDRef=\"0\" memoShapeIDRef=\"0\""
+           " textVerticalWidthHead=\"0\" masterPageCnt=\"0\">"
+           "<hp:grid lineGrid=\"0\" charGrid=\"0\" wonggojiFormat=\"0\"/>"
+           "<hp:startNum pageStartsOn=\"BOTH\" page=\"0\" pic=\"0\" tbl=\"0\" equation=\"0\"/>"
+           "<hp:visibility hideFirstHeader=\"0\" hideFirstFooter=\"0\" hideFirstMasterPage=\"0\""
+           " border=\"SHOW_ALL\" fill=\"SHOW_ALL\" hideFirstPageNum=\"0\" hideFirstEmptyLine=\"0\""
+           " showLineNumber=\"0\"/>"
+           "<hp:lineNumberShape restartType=\"0\" countBy=\"0\" distance=\"0\" startNumber=\"0\"/>";
+    // OWPML: WIDELY = 세로, NARROWLY = 가로
+    Append(out, "<hp:pagePr landscape=\"%s\" width=\"%d\" height=\"%d\" gutterType=\"LEFT_ONLY\">"
+                "<hp:margin header=\"%d\" footer=\"%d\" gutter=\"%d\" left=\"%d\" right=\"%d\" top=\"%d\""
+                " bottom=\"%d\"/></hp:pagePr>",
+           page.landscape ? "NARROWLY" : "WIDELY", page.width, page.height,
+           page.header, page.footer, page.gutter, page.left, page.right, page.top, page.bottom);
+    out += "<hp:footNotePr><hp:autoNumFormat type=\"DIGIT\" userChar=\"\" prefixChar=\"\" suffixChar=\")\""
+           " supscript=\"0\"/><hp:noteLine length=\"-1\" type=\"SOLID\" width=\"0.12 mm\" color=\"#000000\"/>"
+           "<hp:noteSpacing betweenNotes=\"283\" belowLine=\"567\" aboveLine=\"850\"/>"
+           "<hp:numbering type=\"CONTINUOUS\" newNum=\"1\"/><hp:placement place=\"EACH_COLUMN\" beneathText=\"0\"/>"
+           "</hp:footNotePr>"
+           "<hp:endNotePr><hp:autoNumFormat type=\"DIGIT\" userChar=\"\" prefixChar=\"\" suffixChar=\")\""
+           " supscript=\"0\"/><hp:noteLine length=\"14692344\" type=\"SOLID\" width=\"0.12 mm\" color=\"#000000\"/>"
+           "<hp:noteSpacing betweenNotes=\"0\" belowLine=\"567\" aboveLine=\"850\"/>"
+           "<hp:numbering type=\"CONTINUOUS\" newNum=\"1\"/>"
+           "<hp:placement place=\"END_OF_DOCUMENT\" beneathText=\"0\"/></hp:endNotePr>";
+    const char* borderTypes[] = { "BOTH", "EVEN", "ODD" };
+    for (const char* type : borderTypes) {
+        Append(out, "<hp:pageBorderFill type=\"%s\" borderFillIDRef=\"%d\" textBorder=\"PAPER\""
+                    " headerInside=\"0\" footerInside=\"0\" fillArea=\"PAPER\">"
+                    "<hp:offset left=\"1417\" right=\"1417\" top=\"1417\" bottom=\"1417\"/></hp:pageBorderFill>",
+               type, kNoBorderFill);
+    }
+    out += "</hp:secPr>"
+           "<hp:ctrl><hp:colPr id=\"\" type=\"NEWSPAPER\" layout=\"LEFT\" colCount=\"1\" sameSz=\"1\""
+           " sameGap=\"0\"/></hp:ctrl>";
+    return out;
+}
+
+bool HwpxWriter::BeginSection(const HwpxPageDef& page)
+{
+    if (!m_zip.IsOpen()) return false;
+    EndSection();
+
+    std::string name = "Contents/section" + std::to_string(m_sectionCount) + ".xml";
+    if (!m_zip.BeginEntry(name, ZipWriter::Method::Deflate, m_level)) return false;
+
+    m_inSection = true;
+    m_sectionCount++;
+    m_textWidth = (page.landscape ? page.height : page.width) - page.left - page.right - page.gutter;
+    m_sectionProperties = RenderSectionProperties(page);
+    m_sectionXml = kXmlDeclaration;
+    m_sectionXml += "<hs:sec";
+    m_sectionXml += kNamespaces;
+    m_sectionXml += ">";
+    return true;
+}
+
+void HwpxWriter::EndSection()
+{
+    if (!m_inSection) return;
+
+    if (!m_sectionProperties.empty()) {
+        AddParagraph(HwpxParagraph());      // 빈 섹션에도 secPr를 가진 문단 하나
+    }
+    m_sectionXml += "</hs:sec>";
+    FlushSection(true);
+    m_zip.EndEntry();
+    m_inSection = false;
+}
+
+void HwpxWriter::FlushSection(bool force)
+{
+    if (m_sectionXml.empty() || (!force && m_sectionXml.size() < kSectionFlushSize)) return;
+    m_xmlBytes += m_sectionXml.size();
+    m_zip.Write(m_sectionXml);
+    m_sectionXml.clear();
+}
+
+//=============================================================================
+// 본문
+//=============================================================================
+
+bool HwpxWriter::AddParagraph(const HwpxParagraph& paragraph)
+{
+    if (!m_zip.IsOpen()) return false;
+    if (!m_inSection && !BeginSection()) return false;
+
+    std::string xml;
+    if (!RenderParagraph(paragraph, m_textWidth, xml)) return false;
+
+    if (!m_sectionProperties.empty()) {
+        // 섹션의 첫 문단 맨 앞에 구역/단 정의
+        size_t open = xml.find('>') + 1;
+        xml.insert(open, "<hp:run charPrIDRef=\"0\">" + m_sectionProperties + "</hp:run>");
+        m_sectionProperties.clear();
+    }
+
+    m_sectionXml += xml;
+    m_paragraphs++;
+    FlushSection(false);
+    return true;
+}
+
+bool HwpxWriter::AddText(const std::wstring& text, int char_shape, int para_shape)
+{
+    size_t start = 0;
+    for (;;) {
+        size_t end = text.find(L'\n', start);
+        HwpxParagraph paragraph;
+        paragraph.para_shape = para_shape;
+        paragraph.AddText(text.substr(start, end == std::wstring::npos ? std::wstring::npos : end - start),
+                          char_shape);
+        if (!AddParagraph(paragraph)) return false;
+        if (end == std::wstring::npos) return true;
+        start = end + 1;
+    }
+}
+
+bool HwpxWriter::RenderParagraph(const HwpxParagraph& paragraph, HwpUnit width, std::string& out)
+{
+    if (paragraph.para_shape < 0 || paragraph.para_shape >= static_cast<int>(m_paraShapes.xml.size())) {
+        return false;
+    }
+
+    Append(out, "<hp:p id=\"0\" paraPrIDRef=\"%d\" styleIDRef=\"0\" pageBreak=\"%d\" columnBreak=\"0\""
+                " merged=\"0\">",
+           paragraph.para_shape, paragraph.page_break ? 1 : 0);
+    if (paragraph.runs.empty()) {
+        out += "<hp:run charPrIDRef=\"0\"/>";
+    }
+    for (const HwpxRun& run : paragraph.runs) {
+        if (!RenderRun(run, width, out)) return false;
+    }
+    out += "</hp:p>";
+    return true;
+}
+
+bool HwpxWriter::RenderRun(const HwpxRun& run, HwpUnit width, std::string& out)
+{
+    if (run.char_shape < 0 || run.char_shape >= static_cast<int>(m_charShapes.xml.size())) {
+        return false;
+    }
+
+    Append(out, "<hp:run charPrIDRef=\"%d\">", run.char_shape);
+    switch (run.kind) {
+    case HwpxRun::Kind::Text:
+        AppendText(out, run.text);
+        break;
+
+    case HwpxRun::Kind::Field: {
+        uint32_t id = m_nextObjectId++;
+        Append(out, "<hp:ctrl><hp:fieldBegin id=\"%u\" type=\"CLICK_HERE\" name=\"", id);
+        AppendEscaped(out, run.field_name);
+        Append(out, "\" editable=\"1\" dirty=\"0\" zorder=\"-1\" fieldid=\"%u\">"
+                    "<hp:parameters cnt=\"1\" name=\"\"><hp:stringParam name=\"Direction\">", id);
+        AppendEscaped(out, run.field_name);
+        out += "</hp:stringParam></hp:parameters></hp:fieldBegin></hp:ctrl>";
+        AppendText(out, run.text);
+        Append(out, "<hp:ctrl><hp:fieldEnd beginIDRef=\"%u\" fieldid=\"%u\"/></hp:ctrl>", id, id);
+        break;
+    }
+
+    case HwpxRun::Kind::Picture:
+        if (!RenderPicture(run, width, out)) return false;
+        out += "<hp:t/>";
+        break;
+
+    case HwpxRun::Kind::Table:
+        if (!run.table || !RenderTable(*run.table, run.char_shape, width, out)) return false;
+        out += "<hp:t/>";
+        break;
+    }
+    out += "</hp:run>";
+    return true;
+}
+
+bool HwpxWriter::RenderTable(const HwpxTable& table, int char_shape, HwpUnit width, std::string& out)
+{
+    (void)char_shape;
+    if (table.rows <= 0 || table.cols <= 0) return false;
+
+    int tableFill = table.border_fill > 0 ? table.border_fill : kSolidBorderFill;
+    if (tableFill > static_cast<int>(m_borderFills.xml.size())) return false;
+
+    std::vector<HwpUnit> widths = table.col_widths;
+    if (widths.size() != static_cast<size_t>(table.cols)) {
+        widths.assign(static_cast<size_t>(table.cols), std::max<HwpUnit>(width, 1000) / table.cols);
+    }
+    HwpUnit tableWidth = 0;
+    for (HwpUnit w : widths) tableWidth += w;
+
+    std::vector<const HwpxCell*> cells;
+    cells.reserve(table.cells.size());
+    for (const HwpxCell& cell : table.cells) {
+        if (cell.row < 0 || cell.col < 0 || cell.row_span < 1 || cell.col_span < 1 ||
+            cell.row + cell.row_span > table.rows || cell.col + cell.col_span > table.cols) {
+            return false;
+        }
+        cells.push_back(&cell);
+    }
+    std::stable_sort(cells.begin(), cells.end(), [](const HwpxCell* a, const HwpxCell* b) {
+        return a->row != b->row ? a->row < b->row : a->col < b->col;
+    });
+
+    uint32_t id = m_nextObjectId++;
+    Append(out, "<hp:tbl id=\"%u\" zOrder=\"%u\" numberingType=\"TABLE\" textWrap=\"TOP_AND_BOTTOM\""
+                " textFlow=\"BOTH_SIDES\" lock=\"0\" dropcapstyle=\"None\" pageBreak=\"CELL\""
+                " repeatHeader=\"%d\" rowCnt=\"%d\" colCnt=\"%d\" cellSpacing=\"0\" borderFillIDRef=\"%d\""
+                " noAdjust=\"0\">",
+           id, id, table.repeat_header ? 1 : 0, table.rows, table.cols, tableFill);
+    Append(out, "<hp:sz width=\"%d\" widthRelTo=\"ABSOLUTE\" height=\"%d\" heightRelTo=\"ABSOLUTE\""
+                " protect=\"0\"/>",
+           tableWidth, table.rows * kCellHeight);
+    out += "<hp:pos treatAsChar=\"1\" affectLSpacing=\"0\" flowWithText=\"1\" allowOverlap=\"0\""
+           " holdAnchorAndSO=\"0\" vertRelTo=\"PARA\" horzRelTo=\"COLUMN\" vertAlign=\"TOP\" horzAlign=\"LEFT\""
+           " vertOffset=\"0\" horzOffset=\"0\"/>"
+           "<hp:outMargin left=\"283\" right=\"283\" top=\"283\" bottom=\"283\"/>";
+    Append(out, "<hp:inMargin left=\"%d\" right=\"%d\" top=\"%d\" bottom=\"%d\"/>",
+           kCellMarginX, kCellMarginX, kCellMarginY, kCellMarginY);
+
+    size_t next = 0;
+    for (int row = 0; row < table.rows; ++row) {
+        out += "<hp:tr>";
+        for (; next < cells.size() && cells[next]->row == row; ++next) {
+            const HwpxCell& cell = *cells[next];
+            int fill = cell.border_fill > 0 ? cell.border_fill : tableFill;
+            if (fill > static_cast<int>(m_borderFills.xml.size())) return false;
+
+            HwpUnit cellWidth = 0;
+            for (int c = cell.col; c < cell.col + cell.col_span; ++c) cellWidth += widths[static_cast<size_t>(c)];
+            HwpUnit cellHeight = cell.height > 0 ? cell.height : kCellHeight * cell.row_span;
+
+            Append(out, "<hp:tc name=\"\" header=\"%d\" hasMargin=\"0\" protect=\"0\" editable=\"0\" dirty=\"0\""
+                        " borderFillIDRef=\"%d\">"
+                        "<hp:subList id=\"\" textDirection=\"HORIZONTAL\" lineWrap=\"BREAK\" vertAlign=\"CENTER\""
+                        " linkListIDRef=\"0\" linkListNextIDRef=\"0\" textWidth=\"0\" textHeight=\"0\""
+                        " hasTextRef=\"0\" hasNumRef=\"0\">",
+                   (table.repeat_header && cell.row == 0) ? 1 : 0, fill);
+            HwpUnit innerWidth = std::max<HwpUnit>(cellWidth - 2 * kCellMarginX, 0);
+            if (cell.paragraphs.empty()) {
+                if (!RenderParagraph(HwpxParagraph(), innerWidth, out)) return false;
+            }
+            for (const HwpxParagraph& paragraph : cell.paragraphs) {
+                if (!RenderParagraph(paragraph, innerWidth, out)) return false;
+            }
+            Append(out, "</hp:subList><hp:cellAddr colAddr=\"%d\" rowAddr=\"%d\"/>"
+                        "<hp:cellSpan colSpan=\"%d\" rowSpan=\"%d\"/><hp:cellSz width=\"%d\" height=\"%d\"/>"
+                        "<hp:cellMargin left=\"%d\" right=\"%d\" top=\"%d\" bottom=\"%d\"/></hp:tc>",
+                   cell.col, cell.row, cell.col_span, cell.row_span, cellWidth, cellHeight,
+                   kCellMarginX, kCellMarginX, kCellMarginY, kCellMarginY);
+        }
+        out += "</hp:tr>";
+    }
+    out += "</hp:tbl>";
+    return true;
+}
+
+bool HwpxWriter::RenderPicture(const HwpxRun& run, HwpUnit width, std::string& out)
+{
+    if (run.image <= 0 || run.image > static_cast<int>(m_images.size())) return false;
+    const Image& image = m_images[static_cast<size_t>(run.image - 1)];
+
+    HwpUnit orgWidth = image.width > 0 ? image.width : kDefaultPicture;
+    HwpUnit orgHeight = image.height > 0 ? image.height : kDefaultPicture;
+
+    // 크기를 하나만 주면 비율 유지, 둘 다 없으면 원래 크기 (본문보다 넓으면 줄임)
+    HwpUnit w = run.width;
+    HwpUnit h = run.height;
+    if (w <= 0 && h <= 0) {
+        w = orgWidth;
+        h = orgHeight;
+        if (width > 0 && w > width) {
+            h = static_cast<HwpUnit>(static_cast<int64_t>(h) * width / w);
+            w = width;
+        }
+    } else if (w <= 0) {
+        w = static_cast<HwpUnit>(static_cast<int64_t>(orgWidth) * h / orgHeight);
+    } else if (h <= 0) {
+        h = static_cast<HwpUnit>(static_cast<int64_t>(orgHeight) * w / orgWidth);
+    }
+
+    uint32_t id = m_nextObjectId++;
+    Append(out, "<hp:pic id=\"%u\" zOrder=\"%u\" numberingType=\"PICTURE\" textWrap=\"TOP_AND_BOTTOM\""
+                " textFlow=\"BOTH_SIDES\" lock=\"0\" dropcapstyle=\"None\" href=\"\" groupLevel=\"0\""
+                " instid=\"%u\" reverse=\"0\">",
+           id, id, id);
+    Append(out, "<hp:offset x=\"0\" y=\"0\"/><hp:orgSz width=\"%d\" height=\"%d\"/>"
+                "<hp:curSz width=\"%d\" height=\"%d\"/><hp:flip horizontal=\"0\" vertical=\"0\"/>"
+                "<hp:rotationInfo angle=\"0\" centerX=\"%d\" centerY=\"%d\" rotateimage=\"1\"/>",
+           orgWidth, orgHeight, w, h, w / 2, h / 2);
+    out += "<hp:renderingInfo><hc:transMatrix e1=\"1\" e2=\"0\" e3=\"0\" e4=\"0\" e5=\"1\" e6=\"0\"/>";
+    Append(out, "<hc:scaMatrix e1=\"%.6f\" e2=\"0\" e3=\"0\" e4=\"0\" e5=\"%.6f\" e6=\"0\"/>",
+           static_cast<double>(w) / orgWidth, static_cast<double>(h) / orgHeight);
+    out += "<hc:rotMatrix e1=\"1\" e2=\"0\" e3=\"0\" e4=\"0\" e5=\"1\" e6=\"0\"/></hp:renderingInfo>";
+    Append(out, "<hc:img binaryItemIDRef=\"image%d\" bright=\"0\" contrast=\"0\" effect=\"REAL_PIC\" alpha=\"0\"/>",
+           run.image);
+    Append(out, "<hp:imgRect><hc:pt0 x=\"0\" y=\"0\"/><hc:pt1 x=\"%d\" y=\"0\"/><hc:pt2 x=\"%d\" y=\"%d\"/>"
+                "<hc:pt3 x=\"0\" y=\"%d\"/></hp:imgRect>"
+                "<hp:imgClip left=\"0\" right=\"%d\" top=\"0\" bottom=\"%d\"/>"
+                "<hp:inMargin left=\"0\" right=\"0\" top=\"0\" bottom=\"0\"/>"
+                "<hp:imgDim dimwidth=\"%d\" dimheight=\"%d\"/><hp:effects/>",
+           orgWidth, orgWidth, orgHeight, orgHeight, orgWidth, orgHeight, orgWidth, orgHeight);
+    Append(out, "<hp:sz width=\"%d\" widthRelTo=\"ABSOLUTE\" height=\"%d\" heightRelTo=\"ABSOLUTE\" protect=\"0\"/>",
+           w, h);
+    out += "<hp:pos treatAsChar=\"1\" affectLSpacing=\"0\" flowWithText=\"1\" allowOverlap=\"0\""
+           " holdAnchorAndSO=\"0\" vertRelTo=\"PARA\" horzRelTo=\"COLUMN\" vertAlign=\"TOP\" horzAlign=\"LEFT\""
+           " vertOffset=\"0\" horzOffset=\"0\"/>"
+           "<hp:outMargin left=\"0\" right=\"0\" top=\"0\" bottom=\"0\"/></hp:pic>";
+    return true;
+}
+
+//=============================================================================
+// 패키지
+//=============================================================================
+
+std::string HwpxWriter::RenderHeader() const
+{
+    std::string out = kXmlDeclaration;
+    out += "<hh:head";
+    out += kNamespaces;
+    Append(out, " version=\"1.4\" secCnt=\"%zu\">", m_sectionCount);
+    out += "<hh:beginNum page=\"1\" footnote=\"1\" endnote=\"1\" pic=\"1\" tbl=\"1\" equation=\"1\"/>";
+    out += "<hh:refList>";
+
+    Append(out, "<hh:fontfaces itemCnt=\"%d\">", kLangCount);
+    for (int lang = 0; lang < kLangCount; ++lang) {
+        const auto& fonts = m_fonts[static_cast<size_t>(lang)];
+        Append(out, "<hh:fontface lang=\"%s\" fontCnt=\"%zu\">", kFontLangs[lang], fonts.size());
+        for (size_t i = 0; i < fonts.size(); ++i) {
+            Append(out, "<hh:font id=\"%zu\" face=\"", i);
+            AppendEscaped(out, fonts[i].first);
+            Append(out, "\" type=\"%s\" isEmbedded=\"0\"/>", fonts[i].second == 1 ? "HFT" : "TTF");
+        }
+        out += "</hh:fontface>";
+    }
+    out += "</hh:fontfaces>";
+
+    Append(out, "<hh:borderFills itemCnt=\"%zu\">", m_borderFills.xml.size());
+    for (size_t i = 0; i < m_borderFills.xml.size(); ++i) {
+        Append(out, "<hh:borderFill id=\"%zu\"", i + 1);
+        out += m_borderFills.xml[i];
+        out += "</hh:borderFill>";
+    }
+    out += "</hh:borderFills>";
+
+    Append(out, "<hh:charProperties itemCnt=\"%zu\">", m_charShapes.xml.size());
+    for (size_t i = 0; i < m_charShapes.xml.size(); ++i) {
+        Append(out, "<hh:charPr id=\"%zu\"", i);
+        out += m_charShapes.xml[i];
+        out += "</hh:charPr>";
+    }
+    out += "</hh:charProperties>";
+
+    out += "<hh:tabProperties itemCnt=\"1\"><hh:tabPr id=\"0\" autoTabLeft=\"0\" autoTabRight=\"0\"/>"
+           "</hh:tabProperties>";
+
+    Append(out, "<hh:paraProperties itemCnt=\"%zu\">", m_paraShapes.xml.size());
+    for (size_t i = 0; i < m_paraShapes.xml.size(); ++i) {
+        Append(out, "<hh:paraPr id=\"%zu\"", i);
+        out += m_paraShapes.xml[i];
+        out += "</hh:paraPr>";
+    }
+    out += "</hh:paraProperties>";
+
+    out += "<hh:styles itemCnt=\"1\"><hh:style id=\"0\" type=\"PARA\" name=\"바탕글\" engName=\"Normal\""
+           " paraPrIDRef=\"0\" charPrIDRef=\"0\" nextStyleIDRef=\"0\" langID=\"1042\" lockForm=\"0\"/>"
+           "</hh:styles>";
+    out += "</hh:refList>";
+    out += "<hh:compatibleDocument targetProgram=\"HWP201X\"><hh:layoutCompatibility/></hh:compatibleDocument>"
+           "<hh:docOption><hh:linkinfo path=\"\" pageInherit=\"0\" footnoteInherit=\"0\"/></hh:docOption>"
+           "<hh:trackchageConfig flags=\"56\"/>";
+    out += "</hh:head>";
+    return out;
+}
+
+std::string HwpxWriter::RenderContent() const
+{
+    std::string out = kXmlDeclaration;
+    out += "<opf:package";
+    out += kNamespaces;
+    out += " version=\"\" unique-identifier=\"\" id=\"\">"
+           "<opf:metadata><opf:title/><opf:language>ko</opf:language>"
+           "<opf:meta name=\"creator\" content=\"text\">cpyhwpx</opf:meta></opf:metadata>"
+           "<opf:manifest>"
+           "<opf:item id=\"header\" href=\"Contents/header.xml\" media-type=\"application/xml\"/>";
+    for (size_t i = 0; i < m_images.size(); ++i) {
+        const Image& image = m_images[i];
+        Append(out, "<opf:item id=\"image%zu\" href=\"BinData/image%zu.%s\" media-type=\"%s\" isEmbeded=\"1\"/>",
+               i + 1, i + 1, image.extension.c_str(), MediaType(image.extension).c_str());
+    }
+    for (size_t i = 0; i < m_sectionCount; ++i) {
+        Append(out, "<opf:item id=\"section%zu\" href=\"Contents/section%zu.xml\" media-type=\"application/xml\"/>",
+               i, i);
+    }
+    out += "<opf:item id=\"settings\" href=\"settings.xml\" media-type=\"application/xml\"/>"
+           "</opf:manifest><opf:spine><opf:itemref idref=\"header\" linear=\"yes\"/>";
+    for (size_t i = 0; i < m_sectionCount; ++i) {
+        Append(out, "<opf:itemref idref=\"section%zu\" linear=\"yes\"/>", i);
+    }
+    out += "</opf:spine></opf:package>";
+    return out;
+}
+
+bool HwpxWriter::Close()
+{
+    if (!m_zip.IsOpen()) return false;
+
+    if (m_sectionCount == 0) BeginSection();   // 문단이 없어도 섹션은 하나 있어야 함
+    EndSection();
+
+    for (size_t i = 0; i < m_images.size(); ++i) {
+        const Image& image = m_images[i];
+        std::string name = "BinData/image" + std::to_string(i + 1) + "." + image.extension;
+        ZipWriter::Method method = IsCompressedFormat(name) ? ZipWriter::Method::Store : ZipWriter::Method::Deflate;
+        m_zip.AddEntry(name, image.data.data(), image.data.size(), method, m_level);
+    }
+
+    std::string header = RenderHeader();
+    m_zip.AddEntry("Contents/header.xml", header.data(), header.size(), ZipWriter::Method::Deflate, m_level);
+
+    std::string content = RenderContent();
+    m_zip.AddEntry("Contents/content.hpf", content.data(), content.size(), ZipWriter::Method::Deflate, m_level);
+
+    std::string settings = kXmlDeclaration;
+    settings += "<ha:HWPApplicationSetting xmlns:ha=\"http://www.hancom.co.kr/hwpml/2011/app\""
+                " xmlns:config=\"urn:oasis:names:tc:opendocument:xmlns:config:1.0\">"
+                "<ha:CaretPosition listIDRef=\"0\" paraIDRef=\"0\" pos=\"0\"/></ha:HWPApplicationSetting>";
+    m_zip.AddEntry("settings.xml", settings.data(), settings.size(), ZipWriter::Method::Deflate, m_level);
+
+    std::string container = kXmlDeclaration;
+    container += "<ocf:container xmlns:ocf=\"urn:oasis:names:tc:opendocument:xmlns:container\""
+                 " xmlns:hpf=\"http://www.hancom.co.kr/schema/2011/hpf\"><ocf:rootfiles>"
+                 "<ocf:rootfile full-path=\"Contents/content.hpf\" media-type=\"application/hwpml-package+xml\"/>"
+                 "</ocf:rootfiles></ocf:container>";
+    m_zip.AddEntry("META-INF/container.xml", container.data(), container.size(),
+                   ZipWriter::Method::Deflate, m_level);
+
+    std::string manifest = kXmlDeclaration;
+    manifest += "<odf:manifest xmlns:odf=\"urn:oasis:names:tc:opendocument:xmlns:manifest:1.0\"/>";
+    m_zip.AddEntry("META-INF/manifest.xml", manifest.data(), manifest.size(),
+                   ZipWriter::Method::Deflate, m_level);
+
+    return m_zip.Close();
+}
+
+//=============================================================================
+// 기존 패키지
+//=============================================================================
+
+bool HwpxWriter::RewritePackage(const std::wstring& source, const std::wstring& dest,
+                                const std::map<std::string, std::string>& parts,
+                                int level, size_t threads)
+{
+    // dest 옆 임시 파일에 다 쓴 뒤에만 dest를 바꿈 (source == dest여도 원본이 남음)
+    std::wstring temp = dest + L".tmp";
+    bool ok = true;
+    {
+        ZipReader reader;
+        if (!reader.Open(source)) return false;
+
+        ZipWriter zip;
+        zip.SetThreads(threads);
+        if (!zip.Open(temp)) return false;
+
+        auto addPart = [&](const std::string& name, const std::string& data) {
+            bool store = name == "mimetype" || IsCompressedFormat(name);
+            return zip.AddEntry(name, data.data(), data.size(),
+                                store ? ZipWriter::Method::Store : ZipWriter::Method::Deflate, level);
+        };
+
+        const auto& entries = reader.GetEntries();
+        for (size_t i = 0; i < entries.size() && ok; ++i) {
+            auto it = parts.find(entries[i].name);
+            if (it != parts.end()) {
+                ok = addPart(it->first, it->second);
+            } else {
+                ok = zip.CopyEntry(reader, i);
+            }
+        }
+        for (const auto& part : parts) {
+            if (ok && reader.Find(part.first) < 0) {
+                ok = addPart(part.first, part.second);
+            }
+        }
+        ok = ok && zip.Close();
+    }   // 이름을 바꾸기 전에 source와 임시 파일을 닫음 (Windows는 열린 파일을 덮어쓸 수 없음)
+
+    PlatformServices& platform = PlatformServices::Get();
+    if (!ok || !platform.ReplaceFile(temp, dest)) {
+        platform.RemoveFile(temp);
+        return false;
+    }
+    return true;
+}
+
+bool HwpxWriter::ReadPart(const std::wstring& path, const std::string& name, std::string& out)
+{
+    ZipReader reader;
+    if (!reader.Open(path)) return false;
+    int index = reader.Find(name);
+    return index >= 0 && reader.Read(static_cast<size_t>(index), out);
+}
+
+} // namespace cpyhwpx
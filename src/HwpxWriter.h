@@ -0,0 +1,303 @@
+/**
+ * @file HwpxWriter.h
+ * @brief COM 없이 HWPX(OWPML) 문서 만들기
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * InsertText/CreateTable/SetCharShape를 COM으로 하나씩 부르는 대신,
+ * 메모리 모델(문단, 표, 그림, 누름틀)을 OWPML XML로 바로 써서 ZIP 패키지로 묶는다.
+ * 한/글 인스턴스가 필요 없으므로 Linux에서도 문서를 만들 수 있다.
+ */
+
+#pragma once
+
+#include "HwpTypes.h"
+#include "ZipWriter.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cpyhwpx {
+
+struct HwpxTable;
+
+//=============================================================================
+// 문서 모델
+//=============================================================================
+
+/**
+ * @brief 문단 안의 조각
+ */
+struct HwpxRun {
+    enum class Kind {
+        Text,
+        Field,          // 누름틀
+        Picture,
+        Table,
+    };
+
+    Kind kind = Kind::Text;
+    int char_shape = 0;                         // HwpxWriter::AddCharShape() ID
+    std::wstring text;                          // Text/Field (\t 탭, \n 줄 바꿈)
+    std::wstring field_name;                    // Field
+    int image = 0;                              // Picture: HwpxWriter::AddImage() ID
+    HwpUnit width = 0;                          // Picture (0이면 이미지 픽셀 크기, 96 DPI)
+    HwpUnit height = 0;
+    std::shared_ptr<const HwpxTable> table;     // Table
+};
+
+/**
+ * @brief 문단
+ */
+struct HwpxParagraph {
+    int para_shape = 0;             // HwpxWriter::AddParaShape() ID
+    bool page_break = false;        // 문단 앞에서 쪽 나눔
+    std::vector<HwpxRun> runs;
+
+    HwpxParagraph& AddText(const std::wstring& text, int char_shape = 0);
+    HwpxParagraph& AddField(const std::wstring& name, const std::wstring& text, int char_shape = 0);
+    HwpxParagraph& AddPicture(int image, HwpUnit width = 0, HwpUnit height = 0);
+    HwpxParagraph& AddTable(const HwpxTable& table);
+};
+
+/**
+ * @brief 표 칸
+ */
+struct HwpxCell {
+    int row = 0;
+    int col = 0;
+    int row_span = 1;
+    int col_span = 1;
+    int border_fill = 0;            // 0이면 표의 테두리/배경
+    HwpUnit height = 0;             // 0이면 기본 높이 (내용에 맞춰 늘어남)
+    std::vector<HwpxParagraph> paragraphs;
+};
+
+/**
+ * @brief 표 (글자처럼 취급, 병합으로 가려진 칸은 cells에 없음)
+ */
+struct HwpxTable {
+    int rows = 0;
+    int cols = 0;
+    std::vector<HwpUnit> col_widths;    // 비어 있으면 본문 너비를 똑같이 나눔
+    int border_fill = 0;                // 0이면 기본 실선
+    bool repeat_header = true;          // 쪽이 넘어가면 첫 줄 반복
+    std::vector<HwpxCell> cells;        // 행 우선 순서
+
+    HwpxTable() = default;
+
+    /**
+     * @brief rows x cols 빈 칸으로 채운 표
+     */
+    HwpxTable(int rows, int cols);
+
+    /**
+     * @brief 2차원 문자열 목록으로 표 만들기 (열 수는 가장 긴 행)
+     */
+    static HwpxTable FromRows(const std::vector<std::vector<std::wstring>>& rows,
+                              int char_shape = 0, int para_shape = 0);
+
+    /**
+     * @brief 칸 찾기 (병합으로 가려졌거나 범위 밖이면 nullptr)
+     */
+    HwpxCell* Cell(int row, int col);
+
+    /**
+     * @brief 칸 내용을 문단 하나로 바꿈 (\n은 문단 나눔)
+     */
+    bool SetText(int row, int col, const std::wstring& text, int char_shape = 0, int para_shape = 0);
+
+    /**
+     * @brief (row, col)부터 row_span x col_span 병합 (가려지는 칸은 제거)
+     */
+    bool Merge(int row, int col, int row_span, int col_span);
+};
+
+/**
+ * @brief 용지/여백 (HwpUnit, 기본 A4 세로)
+ */
+struct HwpxPageDef {
+    HwpUnit width = 59528;
+    HwpUnit height = 84186;
+    bool landscape = false;
+    HwpUnit left = 8504;
+    HwpUnit right = 8504;
+    HwpUnit top = 5668;
+    HwpUnit bottom = 4252;
+    HwpUnit header = 4252;
+    HwpUnit footer = 4252;
+    HwpUnit gutter = 0;
+};
+
+/**
+ * @brief 테두리/배경
+ */
+struct HwpxBorderFill {
+    bool border = true;             // 네 변 실선 0.12mm
+    int border_color = 0;           // RGB()
+    int fill_color = -1;            // 배경색 RGB() (-1이면 없음)
+};
+
+//=============================================================================
+// HwpxWriter
+//=============================================================================
+
+/**
+ * @class HwpxWriter
+ * @brief HWPX 패키지 스트리밍 쓰기
+ *
+ * - 글자/문단 모양과 테두리는 같은 정의를 한 번만 등록하고 ID를 돌려줌 (header.xml 표)
+ * - 섹션 XML은 문단을 추가하는 대로 압축해 파일에 쓰므로 문서 크기만큼 메모리를 쓰지 않는다
+ * - header.xml, content.hpf, 이미지(BinData)는 모든 ID가 정해진 Close()에서 쓴다
+ * - ID 0은 기본 모양 (CharShape{}/ParaShape{}, 함초롬바탕 10pt)
+ */
+class HwpxWriter {
+public:
+    HwpxWriter();
+
+    /**
+     * @brief Close()하지 않았으면 불완전한 파일만 남김
+     */
+    ~HwpxWriter();
+
+    HwpxWriter(const HwpxWriter&) = delete;
+    HwpxWriter& operator=(const HwpxWriter&) = delete;
+
+    /**
+     * @brief 파일 열기
+     * @param level Deflate 압축 수준 (0~9)
+     * @param threads 압축 스레드 수 (0=CPU 수, 1=호출한 스레드)
+     */
+    bool Open(const std::wstring& path, int level = 6, size_t threads = 0);
+
+    /**
+     * @brief 모든 섹션을 닫고 header.xml/이미지/패키지 정보를 쓴 뒤 파일 닫기
+     */
+    bool Close();
+
+    bool IsOpen() const { return m_zip.IsOpen(); }
+
+    //=========================================================================
+    // 모양 (Open 전에도 등록 가능)
+    //=========================================================================
+
+    int AddCharShape(const CharShape& shape);
+    int AddParaShape(const ParaShape& shape);
+    int AddBorderFill(const HwpxBorderFill& fill);
+
+    /**
+     * @brief 이미지 파일을 BinData로 추가 (같은 경로는 같은 ID)
+     * @return 이미지 ID (실패 시 0)
+     */
+    int AddImage(const std::wstring& path);
+
+    /**
+     * @brief 이미지 데이터를 BinData로 추가 (JPEG/PNG/GIF는 다시 압축하지 않고 Stored)
+     * @param extension "png", "jpg", "gif", "bmp"
+     */
+    int AddImageData(const std::string& data, const std::wstring& extension);
+
+    //=========================================================================
+    // 기존 패키지
+    //=========================================================================
+
+    /**
+     * @brief 기존 HWPX의 일부 항목만 바꿔 새 파일로 쓰기
+     *
+     * parts에 없는 항목은 풀지 않고 압축된 그대로 복사하고,
+     * 바뀐 항목만 압축 스레드에서 압축한다. source에 없는 이름은 끝에 추가.
+     * dest 옆 임시 파일("dest.tmp")에 쓰고 성공했을 때만 dest로 이름을 바꾸므로
+     * source와 dest가 같아도 되고, 실패하면 dest는 그대로 남는다.
+     * @param parts 항목 이름 (예: "Contents/section0.xml") → 새 내용
+     */
+    static bool RewritePackage(const std::wstring& source, const std::wstring& dest,
+                               const std::map<std::string, std::string>& parts,
+                               int level = 6, size_t threads = 0);
+
+    /**
+     * @brief HWPX 항목 하나 읽기 (풀어서)
+     */
+    static bool ReadPart(const std::wstring& path, const std::string& name, std::string& out);
+
+    //=========================================================================
+    // 본문
+    //=========================================================================
+
+    /**
+     * @brief 새 섹션 시작 (첫 문단 전에 부르지 않으면 기본 용지로 시작)
+     */
+    bool BeginSection(const HwpxPageDef& page = HwpxPageDef());
+
+    /**
+     * @brief 문단 추가
+     * @return 파일이 열려 있지 않거나 없는 모양/이미지 ID를 쓰면 false
+     */
+    bool AddParagraph(const HwpxParagraph& paragraph);
+
+    /**
+     * @brief 글자만 있는 문단 추가 (\n마다 문단 나눔)
+     */
+    bool AddText(const std::wstring& text, int char_shape = 0, int para_shape = 0);
+
+    //=========================================================================
+    // 통계
+    //=========================================================================
+
+    size_t GetCharShapeCount() const { return m_charShapes.xml.size(); }
+    size_t GetParaShapeCount() const { return m_paraShapes.xml.size(); }
+    size_t GetSectionCount() const { return m_sectionCount; }
+    uint64_t GetParagraphCount() const { return m_paragraphs; }
+    uint64_t GetXmlBytes() const { return m_xmlBytes; }         // 압축 전 섹션 XML
+    uint64_t GetBytesWritten() const { return m_zip.GetBytesWritten(); }
+    size_t GetThreads() const { return m_zip.GetThreads(); }
+
+private:
+    struct ShapeTable {
+        std::vector<std::string> xml;                   // id 속성 뒤의 내용
+        std::unordered_map<std::string, int> lookup;
+
+        int Add(std::string body);
+    };
+
+    struct Image {
+        std::string data;
+        std::string extension;
+        HwpUnit width;              // 96 DPI 기준 크기 (알 수 없으면 0)
+        HwpUnit height;
+    };
+
+    int AddFont(int lang, const std::wstring& face, int type);
+
+    void EndSection();
+    void FlushSection(bool force);
+    bool RenderParagraph(const HwpxParagraph& paragraph, HwpUnit width, std::string& out);
+    bool RenderRun(const HwpxRun& run, HwpUnit width, std::string& out);
+    bool RenderTable(const HwpxTable& table, int char_shape, HwpUnit width, std::string& out);
+    bool RenderPicture(const HwpxRun& run, HwpUnit width, std::string& out);
+
+    std::string RenderHeader() const;
+    std::string RenderContent() const;
+    std::string RenderSectionProperties(const HwpxPageDef& page) const;
+
+    ZipWriter m_zip;
+    int m_level;
+
+    ShapeTable m_charShapes;
+    ShapeTable m_paraShapes;
+    ShapeTable m_borderFills;
+    std::vector<std::vector<std::pair<std::wstring, int>>> m_fonts;    // 언어별 (글꼴, 종류)
+    std::vector<Image> m_images;
+    std::map<std::wstring, int> m_imagePaths;
+
+    bool m_inSection;
+    std::string m_sectionXml;           // 아직 압축기에 넘기지 않은 섹션 XML
+    std::string m_sectionProperties;    // 섹션 첫 문단에 넣을 secPr
+    HwpUnit m_textWidth;
+    size_t m_sectionCount;
+    uint32_t m_nextObjectId;
+    uint64_t m_paragraphs;
+    uint64_t m_xmlBytes;
+};
+
+} // namespace cpyhwpx
@@ -0,0 +1,30 @@
+/**
+ * @file Platform.cpp
+ * @brief 현재 PlatformServices 구현 선택
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "Platform.h"
+#include <atomic>
+
+namespace cpyhwpx {
+
+namespace {
+
+std::atomic<PlatformServices*> s_override{ nullptr };
+
+} // namespace
+
+PlatformServices& PlatformServices::Get()
+{
+    PlatformServices* services = s_override.load(std::memory_order_acquire);
+    return services ? *services : Native();
+}
+
+void PlatformServices::Set(PlatformServices* services)
+{
+    s_override.store(services, std::memory_order_release);
+}
+
+} // namespace cpyhwpx
@@ -0,0 +1,137 @@
+/**
+ * @file Platform.h
+ * @brief 파일 시스템/레지스트리 접근 인터페이스
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * Utils와 보안 모듈 등록 코드는 Win32 API를 직접 부르지 않고 이 인터페이스를 거친다.
+ * Windows에서는 Win32 구현(PlatformWin32.cpp), 그 밖의 환경에서는
+ * POSIX 파일 API와 프로세스 메모리 레지스트리(PlatformPosix.cpp)를 쓴다.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cpyhwpx {
+
+/**
+ * @brief 파일 크기/수정 시각
+ */
+struct FileInfo {
+    uint64_t size = 0;
+    int64_t mtime_ns = 0;           // 1970-01-01 UTC 기준 나노초
+};
+
+/**
+ * @brief 디렉터리 항목
+ */
+struct DirEntry {
+    std::wstring name;              // 경로 없는 이름 ("."/".." 제외)
+    bool is_directory = false;
+};
+
+/**
+ * @class PlatformServices
+ * @brief 운영체제 의존 기능 모음
+ *
+ * 레지스트리 경로는 HKEY_CURRENT_USER 기준 하위 키 ("Software\\HNC\\...").
+ * 테스트/벤치마크에서는 Set()으로 대체 구현을 끼울 수 있다.
+ */
+class PlatformServices {
+public:
+    virtual ~PlatformServices() = default;
+
+    //=========================================================================
+    // 파일 시스템
+    //=========================================================================
+
+    /**
+     * @brief 일반 파일 존재 여부 (디렉터리는 false)
+     */
+    virtual bool FileExists(const std::wstring& path) = 0;
+
+    /**
+     * @brief 디렉터리 존재 여부
+     */
+    virtual bool DirectoryExists(const std::wstring& path) = 0;
+
+    /**
+     * @brief 일반 파일의 크기와 수정 시각
+     * @return 파일이 없거나 디렉터리면 false
+     */
+    virtual bool GetFileInfo(const std::wstring& path, FileInfo& info) = 0;
+
+    /**
+     * @brief 디렉터리 항목 나열 (순서는 운영체제 그대로)
+     * @return 디렉터리를 열 수 없으면 false
+     */
+    virtual bool ListDirectory(const std::wstring& path, std::vector<DirEntry>& entries) = 0;
+
+    /**
+     * @brief 디렉터리 생성 (중간 디렉터리 포함, 이미 있으면 true)
+     */
+    virtual bool CreateDirectories(const std::wstring& path) = 0;
+
+    /**
+     * @brief 파일 삭제
+     */
+    virtual bool RemoveFile(const std::wstring& path) = 0;
+
+    /**
+     * @brief 파일 이름 바꾸기 (to가 있으면 덮어씀, 같은 볼륨 안에서)
+     */
+    virtual bool ReplaceFile(const std::wstring& from, const std::wstring& to) = 0;
+
+    /**
+     * @brief 이 라이브러리가 들어 있는 모듈(cpyhwpx.pyd 등)의 전체 경로
+     * @return 실패 시 빈 문자열
+     */
+    virtual std::wstring ModulePath() = 0;
+
+    //=========================================================================
+    // 레지스트리 (HKEY_CURRENT_USER)
+    //=========================================================================
+
+    /**
+     * @brief 하위 키 존재 여부
+     */
+    virtual bool RegistryKeyExists(const std::wstring& sub_key) = 0;
+
+    /**
+     * @brief 문자열(REG_SZ) 값 읽기
+     * @return 키/값이 없거나 문자열이 아니면 false
+     */
+    virtual bool RegistryReadString(const std::wstring& sub_key,
+                                    const std::wstring& name,
+                                    std::wstring& value) = 0;
+
+    /**
+     * @brief 문자열(REG_SZ) 값 쓰기 (키가 없으면 생성)
+     */
+    virtual bool RegistryWriteString(const std::wstring& sub_key,
+                                     const std::wstring& name,
+                                     const std::wstring& value) = 0;
+
+    //=========================================================================
+    // 현재 구현
+    //=========================================================================
+
+    /**
+     * @brief 현재 구현 (기본값: 운영체제 구현)
+     */
+    static PlatformServices& Get();
+
+    /**
+     * @brief 구현 교체 (nullptr이면 운영체제 구현으로 복귀, 소유권은 호출자)
+     */
+    static void Set(PlatformServices* services);
+
+    /**
+     * @brief 운영체제 구현 (PlatformWin32.cpp / PlatformPosix.cpp)
+     */
+    static PlatformServices& Native();
+};
+
+} // namespace cpyhwpx
@@ -0,0 +1,144 @@
+/**
+ * @file PlatformPosix.cpp
+ * @brief PlatformServices POSIX 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 레지스트리가 없으므로 프로세스 메모리 안의 키/값 표로 대신한다.
+ * 보안 모듈 등록 흐름(확인 → 등록 → 재확인)을 한/글 없이 그대로 실행할 수 있다.
+ */
+
+#include "Platform.h"
+
+#if !defined(_WIN32)
+
+#include "ComPlatform.h"
+#include "Utils.h"
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <dlfcn.h>
+#include <errno.h>
+#include <map>
+#include <mutex>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cpyhwpx {
+
+namespace {
+
+class PosixPlatform : public PlatformServices {
+public:
+    bool FileExists(const std::wstring& path) override
+    {
+        struct stat st;
+        return stat(Utils::ToUtf8(path).c_str(), &st) == 0 && S_ISREG(st.st_mode);
+    }
+
+    bool DirectoryExists(const std::wstring& path) override
+    {
+        struct stat st;
+        return stat(Utils::ToUtf8(path).c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    }
+
+    bool GetFileInfo(const std::wstring& path, FileInfo& info) override
+    {
+        struct stat st;
+        if (stat(Utils::ToUtf8(path).c_str(), &st) != 0 || !S_ISREG(st.st_mode)) return false;
+        info.size = static_cast<uint64_t>(st.st_size);
+        info.mtime_ns = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000LL + st.st_mtim.tv_nsec;
+        return true;
+    }
+
+    bool ListDirectory(const std::wstring& path, std::vector<DirEntry>& entries) override
+    {
+        std::string dir = Utils::ToUtf8(path);
+        DIR* handle = opendir(dir.c_str());
+        if (!handle) return false;
+
+        while (struct dirent* entry = readdir(handle)) {
+            std::string name = entry->d_name;
+            if (name == "." || name == "..") continue;
+
+            struct stat st;
+            bool isDir = stat((dir + "/" + name).c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+            entries.push_back(DirEntry{ Utils::FromUtf8(name), isDir });
+        }
+        closedir(handle);
+        return true;
+    }
+
+    bool CreateDirectories(const std::wstring& path) override
+    {
+        if (path.empty() || DirectoryExists(path)) return true;
+
+        size_t slash = path.find_last_of(L"\\/");
+        if (slash != std::wstring::npos && slash > 0 && !CreateDirectories(path.substr(0, slash))) {
+            return false;
+        }
+        return mkdir(Utils::ToUtf8(path).c_str(), 0777) == 0 || errno == EEXIST;
+    }
+
+    bool RemoveFile(const std::wstring& path) override
+    {
+        return unlink(Utils::ToUtf8(path).c_str()) == 0;
+    }
+
+    bool ReplaceFile(const std::wstring& from, const std::wstring& to) override
+    {
+        return std::rename(Utils::ToUtf8(from).c_str(), Utils::ToUtf8(to).c_str()) == 0;
+    }
+
+    std::wstring ModulePath() override
+    {
+        Dl_info info;
+        if (!dladdr(reinterpret_cast<void*>(&PlatformServices::Native), &info) || !info.dli_fname) {
+            return L"";
+        }
+        return Utils::FromUtf8(info.dli_fname, strlen(info.dli_fname));
+    }
+
+    bool RegistryKeyExists(const std::wstring& sub_key) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_registry.count(sub_key) > 0;
+    }
+
+    bool RegistryReadString(const std::wstring& sub_key,
+                            const std::wstring& name,
+                            std::wstring& value) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto key = m_registry.find(sub_key);
+        if (key == m_registry.end()) return false;
+        auto entry = key->second.find(name);
+        if (entry == key->second.end()) return false;
+        value = entry->second;
+        return true;
+    }
+
+    bool RegistryWriteString(const std::wstring& sub_key,
+                             const std::wstring& name,
+                             const std::wstring& value) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_registry[sub_key][name] = value;
+        return true;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::map<std::wstring, std::map<std::wstring, std::wstring>> m_registry;
+};
+
+} // namespace
+
+PlatformServices& PlatformServices::Native()
+{
+    static PosixPlatform s_platform;
+    return s_platform;
+}
+
+} // namespace cpyhwpx
+
+#endif // !_WIN32
@@ -0,0 +1,181 @@
+/**
+ * @file PlatformWin32.cpp
+ * @brief PlatformServices Win32 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "Platform.h"
+
+#if defined(_WIN32)
+
+#include <Windows.h>
+
+namespace cpyhwpx {
+
+namespace {
+
+class Win32Platform : public PlatformServices {
+public:
+    bool FileExists(const std::wstring& path) override
+    {
+        DWORD attr = GetFileAttributesW(path.c_str());
+        return (attr != INVALID_FILE_ATTRIBUTES && !(attr & FILE_ATTRIBUTE_DIRECTORY));
+    }
+
+    bool DirectoryExists(const std::wstring& path) override
+    {
+        DWORD attr = GetFileAttributesW(path.c_str());
+        return (attr != INVALID_FILE_ATTRIBUTES && (attr & FILE_ATTRIBUTE_DIRECTORY));
+    }
+
+    bool GetFileInfo(const std::wstring& path, FileInfo& info) override
+    {
+        WIN32_FILE_ATTRIBUTE_DATA data;
+        if (!GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data) ||
+            (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+            return false;
+        }
+        info.size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+
+        // FILETIME: 1601-01-01 기준 100ns
+        uint64_t ticks = (static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) |
+                         data.ftLastWriteTime.dwLowDateTime;
+        const uint64_t kEpochDiff = 116444736000000000ULL;
+        info.mtime_ns = (static_cast<int64_t>(ticks) - static_cast<int64_t>(kEpochDiff)) * 100;
+        return true;
+    }
+
+    bool ListDirectory(const std::wstring& path, std::vector<DirEntry>& entries) override
+    {
+        std::wstring pattern = path;
+        if (!pattern.empty() && pattern.back() != L'\\' && pattern.back() != L'/') {
+            pattern += L'\\';
+        }
+        pattern += L'*';
+
+        WIN32_FIND_DATAW data;
+        HANDLE find = FindFirstFileExW(pattern.c_str(), FindExInfoBasic, &data,
+                                       FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+        if (find == INVALID_HANDLE_VALUE) return false;
+
+        do {
+            std::wstring name = data.cFileName;
+            if (name == L"." || name == L"..") continue;
+            entries.push_back(DirEntry{ name, (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0 });
+        } while (FindNextFileW(find, &data));
+
+        FindClose(find);
+        return true;
+    }
+
+    bool CreateDirectories(const std::wstring& path) override
+    {
+        if (path.empty() || DirectoryExists(path)) return true;
+
+        // 상위 디렉터리부터 (드라이브 루트 "C:"는 건너뜀)
+        size_t slash = path.find_last_of(L"\\/");
+        if (slash != std::wstring::npos && slash > 0) {
+            std::wstring parent = path.substr(0, slash);
+            if (!(parent.size() == 2 && parent[1] == L':') && !CreateDirectories(parent)) {
+                return false;
+            }
+        }
+        return CreateDirectoryW(path.c_str(), NULL) || GetLastError() == ERROR_ALREADY_EXISTS;
+    }
+
+    bool RemoveFile(const std::wstring& path) override
+    {
+        return DeleteFileW(path.c_str()) != FALSE;
+    }
+
+    bool ReplaceFile(const std::wstring& from, const std::wstring& to) override
+    {
+        return MoveFileExW(from.c_str(), to.c_str(),
+                           MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE;
+    }
+
+    std::wstring ModulePath() override
+    {
+        // 이 함수가 들어 있는 모듈 (exe가 아니라 cpyhwpx.pyd)
+        HMODULE hModule = NULL;
+        if (!GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+                                GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                                reinterpret_cast<LPCWSTR>(&PlatformServices::Native),
+                                &hModule)) {
+            return L"";
+        }
+
+        wchar_t modulePath[MAX_PATH];
+        DWORD len = GetModuleFileNameW(hModule, modulePath, MAX_PATH);
+        return std::wstring(modulePath, len);
+    }
+
+    bool RegistryKeyExists(const std::wstring& sub_key) override
+    {
+        HKEY hKey;
+        if (RegOpenKeyExW(HKEY_CURRENT_USER, sub_key.c_str(), 0, KEY_READ, &hKey) != ERROR_SUCCESS) {
+            return false;
+        }
+        RegCloseKey(hKey);
+        return true;
+    }
+
+    bool RegistryReadString(const std::wstring& sub_key,
+                            const std::wstring& name,
+                            std::wstring& value) override
+    {
+        HKEY hKey;
+        if (RegOpenKeyExW(HKEY_CURRENT_USER, sub_key.c_str(), 0, KEY_READ, &hKey) != ERROR_SUCCESS) {
+            return false;
+        }
+
+        wchar_t buffer[MAX_PATH];
+        DWORD bufferSize = sizeof(buffer);
+        DWORD type;
+
+        LONG result = RegQueryValueExW(hKey, name.c_str(), NULL, &type,
+                                       (LPBYTE)buffer, &bufferSize);
+        RegCloseKey(hKey);
+
+        if (result != ERROR_SUCCESS || type != REG_SZ) {
+            return false;
+        }
+
+        // 저장된 값에 NUL이 없을 수도 있으므로 길이로 자름
+        size_t chars = bufferSize / sizeof(wchar_t);
+        while (chars > 0 && buffer[chars - 1] == L'\0') --chars;
+        value.assign(buffer, chars);
+        return true;
+    }
+
+    bool RegistryWriteString(const std::wstring& sub_key,
+                             const std::wstring& name,
+                             const std::wstring& value) override
+    {
+        HKEY hKey;
+        if (RegCreateKeyExW(HKEY_CURRENT_USER, sub_key.c_str(), 0, NULL,
+                            REG_OPTION_NON_VOLATILE, KEY_WRITE, NULL, &hKey, NULL) != ERROR_SUCCESS) {
+            return false;
+        }
+
+        LONG result = RegSetValueExW(hKey, name.c_str(), 0, REG_SZ,
+                                     (const BYTE*)value.c_str(),
+                                     (DWORD)((value.length() + 1) * sizeof(wchar_t)));
+        RegCloseKey(hKey);
+
+        return result == ERROR_SUCCESS;
+    }
+};
+
+} // namespace
+
+PlatformServices& PlatformServices::Native()
+{
+    static Win32Platform s_platform;
+    return s_platform;
+}
+
+} // namespace cpyhwpx
+
+#endif // _WIN32
@@ -0,0 +1,511 @@
+/**
+ * @file PrivateInfoScanner.cpp
+ * @brief 네이티브 개인정보 탐지기 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "PrivateInfoScanner.h"
+#include <algorithm>
+#include <cwchar>
+#include <initializer_list>
+
+// SIMD 사전 필터: wchar_t가 UTF-16(2바이트)인 환경에서만 사용
+#if WCHAR_MAX <= 0xFFFF
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CPYHWPX_PII_SSE2 1
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#define CPYHWPX_PII_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace cpyhwpx {
+
+namespace {
+
+//=============================================================================
+// 문자 분류
+//=============================================================================
+
+inline bool IsDigit(wchar_t c) { return c >= L'0' && c <= L'9'; }
+
+inline bool IsAsciiAlpha(wchar_t c)
+{
+    return (c >= L'A' && c <= L'Z') || (c >= L'a' && c <= L'z');
+}
+
+inline bool IsAsciiAlnum(wchar_t c) { return IsDigit(c) || IsAsciiAlpha(c); }
+
+inline bool IsNumberSeparator(wchar_t c) { return c == L'-' || c == L'.' || c == L' '; }
+
+inline bool IsEmailLocalChar(wchar_t c)
+{
+    return IsAsciiAlnum(c) || c == L'.' || c == L'_' || c == L'%' || c == L'+' || c == L'-';
+}
+
+inline bool IsEmailDomainChar(wchar_t c) { return IsAsciiAlnum(c) || c == L'.' || c == L'-'; }
+
+#if defined(CPYHWPX_PII_SSE2) || defined(CPYHWPX_PII_AVX2)
+inline unsigned CountTrailingZeros(unsigned mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+#endif
+
+//=============================================================================
+// 숫자 토큰
+//=============================================================================
+
+/**
+ * @brief 구분자로 나뉜 숫자 묶음 (예: "010-1234-5678" → [3,4,4])
+ */
+struct DigitToken {
+    size_t begin = 0;
+    size_t end = 0;             // 마지막 숫자 다음 위치
+    std::wstring digits;        // 구분자를 뺀 숫자열
+    std::vector<int> groups;    // 묶음별 숫자 개수
+    wchar_t separator = 0;      // 묶음 구분자 (없으면 0)
+};
+
+constexpr size_t kMaxTokenDigits = 24;
+constexpr size_t kMaxTokenGroups = 6;
+
+DigitToken ReadDigitToken(const wchar_t* s, size_t n, size_t begin)
+{
+    DigitToken tok;
+    tok.begin = begin;
+
+    size_t j = begin;
+    int run = 0;
+    while (j < n) {
+        wchar_t c = s[j];
+        if (IsDigit(c)) {
+            tok.digits.push_back(c);
+            ++run;
+            ++j;
+            if (tok.digits.size() > kMaxTokenDigits) break;
+            continue;
+        }
+        // 같은 구분자 뒤에 숫자가 이어질 때만 같은 토큰으로 본다
+        // ("2024.01.15 1588-1234"는 두 토큰)
+        if (IsNumberSeparator(c) && j + 1 < n && IsDigit(s[j + 1]) &&
+            (tok.separator == 0 || tok.separator == c) &&
+            tok.groups.size() + 1 < kMaxTokenGroups) {
+            tok.groups.push_back(run);
+            run = 0;
+            tok.separator = c;
+            ++j;
+            continue;
+        }
+        break;
+    }
+    tok.groups.push_back(run);
+    tok.end = j;
+    return tok;
+}
+
+bool GroupsAre(const std::vector<int>& groups, std::initializer_list<int> expected)
+{
+    if (groups.size() != expected.size()) return false;
+    size_t k = 0;
+    for (int g : expected) {
+        if (groups[k++] != g) return false;
+    }
+    return true;
+}
+
+inline int D(const std::wstring& digits, size_t i) { return digits[i] - L'0'; }
+
+//=============================================================================
+// 유형별 검증
+//=============================================================================
+
+bool IsValidBirthDate(const std::wstring& digits)
+{
+    int month = D(digits, 2) * 10 + D(digits, 3);
+    int day = D(digits, 4) * 10 + D(digits, 5);
+    return month >= 1 && month <= 12 && day >= 1 && day <= 31;
+}
+
+/**
+ * @brief 주민/외국인등록번호 판별
+ * @return RRN, ForeignRRN 또는 0
+ */
+int MatchRegistrationNumber(const DigitToken& tok, int types, bool validate_checksum)
+{
+    bool shape = GroupsAre(tok.groups, {13}) ||
+                 (GroupsAre(tok.groups, {6, 7}) &&
+                  (tok.separator == L'-' || tok.separator == L' '));
+    if (!shape || !IsValidBirthDate(tok.digits)) return 0;
+
+    wchar_t gender = tok.digits[6];
+    if (gender >= L'5' && gender <= L'8') {
+        if (!(types & PrivateInfoType::ForeignRRN)) return 0;
+        if (validate_checksum && !PrivateInfoScanner::IsValidForeignRRN(tok.digits)) return 0;
+        return PrivateInfoType::ForeignRRN;
+    }
+
+    if (!(types & PrivateInfoType::RRN)) return 0;
+    if (validate_checksum && !PrivateInfoScanner::IsValidRRN(tok.digits)) return 0;
+    return PrivateInfoType::RRN;
+}
+
+bool MatchCreditCard(const DigitToken& tok)
+{
+    size_t len = tok.digits.size();
+    if (len < 13 || len > 19) return false;
+    if (tok.separator != 0 && tok.separator != L'-' && tok.separator != L' ') {
+        return false;
+    }
+
+    // 허용 묶음: 단일 숫자열, 4-4-4-(1~4), 4-6-5 (AMEX), 4-6-4 (Diners)
+    bool shape = tok.groups.size() == 1 ||
+                 GroupsAre(tok.groups, {4, 6, 5}) ||
+                 GroupsAre(tok.groups, {4, 6, 4});
+    if (!shape && tok.groups.size() == 4) {
+        shape = tok.groups[0] == 4 && tok.groups[1] == 4 && tok.groups[2] == 4 &&
+                tok.groups[3] >= 1 && tok.groups[3] <= 4;
+    }
+    if (!shape) return false;
+
+    wchar_t first = tok.digits[0];
+    if (first < L'3' || first > L'6') return false;
+    return PrivateInfoScanner::LuhnCheck(tok.digits);
+}
+
+bool MatchPhone(const DigitToken& tok)
+{
+    const std::wstring& d = tok.digits;
+    size_t len = d.size();
+    if (len < 8 || len > 12) return false;
+
+    auto middle = [&](int prefix) {
+        // 접두-국번(3~4)-번호(4) 또는 구분자 없는 단일 숫자열
+        if (tok.groups.size() == 1) return true;
+        return tok.groups.size() == 3 && tok.groups[0] == prefix &&
+               (tok.groups[1] == 3 || tok.groups[1] == 4) && tok.groups[2] == 4;
+    };
+
+    // 대표번호 15xx/16xx/18xx-xxxx
+    if (d[0] == L'1' && (d[1] == L'5' || d[1] == L'6' || d[1] == L'8')) {
+        return GroupsAre(tok.groups, {4, 4});
+    }
+    if (d[0] != L'0') return false;
+
+    // 휴대전화 010/011/016/017/018/019
+    if (d[1] == L'1') {
+        wchar_t c = d[2];
+        bool carrier = c == L'0' || c == L'1' || c == L'6' || c == L'7' || c == L'8' || c == L'9';
+        return carrier && (len == 10 || len == 11) && middle(3);
+    }
+    // 서울 02
+    if (d[1] == L'2') {
+        return (len == 9 || len == 10) && middle(2);
+    }
+    // 인터넷전화 070
+    if (d[1] == L'7' && d[2] == L'0') {
+        return len == 11 && middle(3);
+    }
+    // 평생번호 050x
+    if (d[1] == L'5' && d[2] == L'0') {
+        return len == 12 && (tok.groups.size() == 1 || GroupsAre(tok.groups, {4, 4, 4}));
+    }
+    // 지역번호 0[3-6][1-5]
+    if (d[1] >= L'3' && d[1] <= L'6' && d[2] >= L'1' && d[2] <= L'5') {
+        return (len == 10 || len == 11) && middle(3);
+    }
+    return false;
+}
+
+inline bool IsPassportPrefix(wchar_t c)
+{
+    return c == L'M' || c == L'S' || c == L'R' || c == L'O' || c == L'D' || c == L'G';
+}
+
+/**
+ * @brief 여권번호 판별 (M12345678 또는 신형 M123A4567)
+ * @param i 숫자 토큰 시작 위치 (s[i-1]이 영문자)
+ * @return 여권번호 끝 위치 (실패 시 0)
+ */
+size_t MatchPassport(const wchar_t* s, size_t n, size_t i)
+{
+    if (i == 0 || !IsPassportPrefix(s[i - 1])) return 0;
+    if (i >= 2 && IsAsciiAlnum(s[i - 2])) return 0;
+
+    size_t j = i;
+    while (j < n && IsDigit(s[j])) ++j;
+    size_t run = j - i;
+
+    if (run == 8) {
+        return (j == n || !IsAsciiAlnum(s[j])) ? j : 0;
+    }
+    if (run == 3 && j + 5 <= n && s[j] >= L'A' && s[j] <= L'Z') {
+        for (size_t k = j + 1; k < j + 5; ++k) {
+            if (!IsDigit(s[k])) return 0;
+        }
+        size_t end = j + 5;
+        return (end == n || !IsAsciiAlnum(s[end])) ? end : 0;
+    }
+    return 0;
+}
+
+/**
+ * @brief '@' 위치에서 전자우편 주소 판별
+ * @return 성공 여부 (begin/end 갱신)
+ */
+bool MatchEmail(const wchar_t* s, size_t n, size_t at, size_t& begin, size_t& end)
+{
+    // 로컬 파트 (최대 64자)
+    size_t b = at;
+    while (b > 0 && at - b < 64 && IsEmailLocalChar(s[b - 1])) --b;
+    while (b < at && s[b] == L'.') ++b;
+    if (b == at) return false;
+
+    // 도메인 파트
+    size_t e = at + 1;
+    while (e < n && e - at <= 255 && IsEmailDomainChar(s[e])) ++e;
+    while (e > at + 1 && (s[e - 1] == L'.' || s[e - 1] == L'-')) --e;
+    if (e <= at + 1) return false;
+
+    // 마지막 '.' 뒤 최상위 도메인은 영문 2자 이상
+    size_t dot = e;
+    for (size_t k = e; k > at + 1; --k) {
+        if (s[k - 1] == L'.') { dot = k - 1; break; }
+    }
+    if (dot == e || dot == at + 1 || e - dot - 1 < 2) return false;
+    for (size_t k = dot + 1; k < e; ++k) {
+        if (!IsAsciiAlpha(s[k])) return false;
+    }
+
+    begin = b;
+    end = e;
+    return true;
+}
+
+void AddMatch(std::vector<PrivateInfoMatch>& out, const std::wstring& text,
+              int type, size_t begin, size_t end)
+{
+    PrivateInfoMatch m;
+    m.type = type;
+    m.offset = begin;
+    m.length = end - begin;
+    m.text = text.substr(begin, end - begin);
+    out.push_back(std::move(m));
+}
+
+} // namespace
+
+//=============================================================================
+// SIMD 후보 탐색
+//=============================================================================
+
+size_t PrivateInfoScanner::FindCandidate(const wchar_t* s, size_t n, size_t from)
+{
+    size_t i = from;
+
+#if defined(CPYHWPX_PII_AVX2)
+    {
+        const __m256i lo = _mm256_set1_epi16(static_cast<short>(L'0' - 1));
+        const __m256i hi = _mm256_set1_epi16(static_cast<short>(L'9' + 1));
+        const __m256i at = _mm256_set1_epi16(static_cast<short>(L'@'));
+        for (; i + 16 <= n; i += 16) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+            // 0x8000 이상 문자는 부호 있는 비교에서 음수가 되어 lo 비교에서 탈락
+            __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi16(v, lo),
+                                             _mm256_cmpgt_epi16(hi, v));
+            __m256i hit = _mm256_or_si256(digit, _mm256_cmpeq_epi16(v, at));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(hit));
+            if (mask) {
+                return i + (CountTrailingZeros(mask) >> 1);
+            }
+        }
+    }
+#endif
+
+#if defined(CPYHWPX_PII_SSE2)
+    {
+        const __m128i lo = _mm_set1_epi16(static_cast<short>(L'0' - 1));
+        const __m128i hi = _mm_set1_epi16(static_cast<short>(L'9' + 1));
+        const __m128i at = _mm_set1_epi16(static_cast<short>(L'@'));
+        for (; i + 8 <= n; i += 8) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            __m128i digit = _mm_and_si128(_mm_cmpgt_epi16(v, lo), _mm_cmplt_epi16(v, hi));
+            __m128i hit = _mm_or_si128(digit, _mm_cmpeq_epi16(v, at));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hit));
+            if (mask) {
+                return i + (CountTrailingZeros(mask) >> 1);
+            }
+        }
+    }
+#endif
+
+    return FindCandidateScalar(s, n, i);
+}
+
+size_t PrivateInfoScanner::FindCandidateScalar(const wchar_t* s, size_t n, size_t from)
+{
+    for (size_t i = from; i < n; ++i) {
+        if (IsDigit(s[i]) || s[i] == L'@') {
+            return i;
+        }
+    }
+    return n;
+}
+
+//=============================================================================
+// 스캔
+//=============================================================================
+
+std::vector<PrivateInfoMatch> PrivateInfoScanner::Scan(const std::wstring& text,
+                                                       int types,
+                                                       bool validate_checksum)
+{
+    std::vector<PrivateInfoMatch> matches;
+    const wchar_t* s = text.c_str();
+    const size_t n = text.size();
+
+    size_t i = 0;
+    while ((i = FindCandidate(s, n, i)) < n) {
+        if (s[i] == L'@') {
+            size_t begin, end;
+            if ((types & PrivateInfoType::Email) && MatchEmail(s, n, i, begin, end)) {
+                // 로컬 파트의 숫자가 먼저 잡힌 경우 전자우편으로 대체
+                while (!matches.empty() &&
+                       matches.back().offset + matches.back().length > begin) {
+                    matches.pop_back();
+                }
+                AddMatch(matches, text, PrivateInfoType::Email, begin, end);
+                i = end;
+            } else {
+                ++i;
+            }
+            continue;
+        }
+
+        // 여권번호: 영문 접두 + 숫자
+        if (i > 0 && IsAsciiAlpha(s[i - 1])) {
+            size_t end = 0;
+            if (types & PrivateInfoType::Passport) {
+                end = MatchPassport(s, n, i);
+            }
+            if (end) {
+                AddMatch(matches, text, PrivateInfoType::Passport, i - 1, end);
+                i = end;
+            } else {
+                while (i < n && IsDigit(s[i])) ++i;
+            }
+            continue;
+        }
+
+        DigitToken tok = ReadDigitToken(s, n, i);
+        bool bounded = tok.end == n || !IsAsciiAlnum(s[tok.end]);
+
+        int type = 0;
+        if (bounded) {
+            type = MatchRegistrationNumber(tok, types, validate_checksum);
+            if (!type && (types & PrivateInfoType::CreditCard) && MatchCreditCard(tok)) {
+                type = PrivateInfoType::CreditCard;
+            }
+            if (!type && (types & PrivateInfoType::Phone) && MatchPhone(tok)) {
+                type = PrivateInfoType::Phone;
+            }
+        }
+
+        if (type) {
+            AddMatch(matches, text, type, tok.begin, tok.end);
+        }
+        // 토큰이 길이 제한으로 잘렸으면 남은 숫자도 건너뛴다
+        i = tok.end;
+        while (i < n && IsDigit(s[i])) ++i;
+    }
+
+    return matches;
+}
+
+std::wstring PrivateInfoScanner::Mask(const std::wstring& text,
+                                      const std::vector<PrivateInfoMatch>& matches,
+                                      wchar_t mask_char)
+{
+    std::wstring result = text;
+    for (const auto& m : matches) {
+        if (m.offset >= result.size()) continue;
+        size_t end = (std::min)(m.offset + m.length, result.size());
+        for (size_t k = m.offset; k < end; ++k) {
+            wchar_t c = result[k];
+            if (!IsNumberSeparator(c) && c != L'@') {
+                result[k] = mask_char;
+            }
+        }
+    }
+    return result;
+}
+
+//=============================================================================
+// 개별 검증기
+//=============================================================================
+
+bool PrivateInfoScanner::IsValidRRN(const std::wstring& digits)
+{
+    if (digits.size() != 13) return false;
+    static const int weights[12] = { 2, 3, 4, 5, 6, 7, 8, 9, 2, 3, 4, 5 };
+    int sum = 0;
+    for (size_t k = 0; k < 12; ++k) {
+        if (!IsDigit(digits[k])) return false;
+        sum += D(digits, k) * weights[k];
+    }
+    if (!IsDigit(digits[12])) return false;
+    return (11 - sum % 11) % 10 == D(digits, 12);
+}
+
+bool PrivateInfoScanner::IsValidForeignRRN(const std::wstring& digits)
+{
+    if (digits.size() != 13) return false;
+    static const int weights[12] = { 2, 3, 4, 5, 6, 7, 8, 9, 2, 3, 4, 5 };
+    int sum = 0;
+    for (size_t k = 0; k < 12; ++k) {
+        if (!IsDigit(digits[k])) return false;
+        sum += D(digits, k) * weights[k];
+    }
+    if (!IsDigit(digits[12])) return false;
+
+    // 외국인등록번호: 11 - (합 % 11)에서 10 이상이면 10을 빼고 2를 더한 뒤 다시 10 보정
+    int check = 11 - sum % 11;
+    if (check >= 10) check -= 10;
+    check += 2;
+    if (check >= 10) check -= 10;
+    return check == D(digits, 12);
+}
+
+bool PrivateInfoScanner::LuhnCheck(const std::wstring& digits)
+{
+    if (digits.empty()) return false;
+    int sum = 0;
+    bool twice = false;
+    for (size_t k = digits.size(); k > 0; --k) {
+        wchar_t c = digits[k - 1];
+        if (!IsDigit(c)) return false;
+        int v = c - L'0';
+        if (twice) {
+            v *= 2;
+            if (v > 9) v -= 9;
+        }
+        sum += v;
+        twice = !twice;
+    }
+    return sum % 10 == 0;
+}
+
+} // namespace cpyhwpx
@@ -0,0 +1,113 @@
+/**
+ * @file PrivateInfoScanner.h
+ * @brief 네이티브 개인정보 탐지기
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * FindPrivateInfo(COM) 대신 추출된 UTF-16 텍스트를 직접 스캔
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace cpyhwpx {
+
+/**
+ * @brief 개인정보 유형 비트마스크
+ *
+ * HWP FindPrivateInfo의 PrivateType 값과 동일한 비트를 사용한다.
+ * Passport는 HWP에 없는 네이티브 전용 비트.
+ */
+namespace PrivateInfoType {
+    constexpr int Phone       = 0x0001;  // 전화번호
+    constexpr int RRN         = 0x0002;  // 주민등록번호
+    constexpr int ForeignRRN  = 0x0004;  // 외국인등록번호
+    constexpr int Email       = 0x0008;  // 전자우편
+    constexpr int CreditCard  = 0x0020;  // 신용카드번호
+    constexpr int Passport    = 0x0800;  // 여권번호 (네이티브 전용)
+    constexpr int All = Phone | RRN | ForeignRRN | Email | CreditCard | Passport;
+}
+
+/**
+ * @brief 개인정보 탐지 결과
+ *
+ * offset/length는 UTF-16 코드 유닛 기준 (BMP 문자만 있으면 Python 인덱스와 동일)
+ * 검사한 텍스트 안의 위치이며 문서 위치(list/para/pos)가 아니다.
+ */
+struct PrivateInfoMatch {
+    int type = 0;           // PrivateInfoType 비트 하나
+    size_t offset = 0;      // 시작 위치
+    size_t length = 0;      // 길이
+    std::wstring text;      // 탐지된 원문
+};
+
+/**
+ * @class PrivateInfoScanner
+ * @brief UTF-16 텍스트 개인정보 스캐너
+ *
+ * SIMD(SSE2/AVX2)로 숫자/'@' 후보 위치를 먼저 찾고,
+ * 후보 주변에서만 정확한 검증기(체크섬, Luhn 등)를 실행한다.
+ */
+class PrivateInfoScanner {
+public:
+    /**
+     * @brief 텍스트에서 개인정보 탐지
+     * @param text 검사할 텍스트
+     * @param types 탐지할 유형 (PrivateInfoType 비트 조합)
+     * @param validate_checksum 주민/외국인등록번호 체크섬 검증 여부
+     * @return 오프셋 순으로 정렬된 탐지 결과 (겹치지 않음)
+     */
+    static std::vector<PrivateInfoMatch> Scan(const std::wstring& text,
+                                              int types = PrivateInfoType::All,
+                                              bool validate_checksum = true);
+
+    /**
+     * @brief 탐지 결과 구간을 마스킹
+     * @param text 원본 텍스트
+     * @param matches Scan 결과
+     * @param mask_char 마스킹 문자
+     * @return 마스킹된 텍스트 (구분자 '-', '.', ' '는 유지)
+     */
+    static std::wstring Mask(const std::wstring& text,
+                             const std::vector<PrivateInfoMatch>& matches,
+                             wchar_t mask_char = L'*');
+
+    //=========================================================================
+    // 개별 검증기
+    //=========================================================================
+
+    /**
+     * @brief 주민등록번호 체크섬 검증 (숫자 13자리)
+     */
+    static bool IsValidRRN(const std::wstring& digits);
+
+    /**
+     * @brief 외국인등록번호 체크섬 검증 (숫자 13자리)
+     */
+    static bool IsValidForeignRRN(const std::wstring& digits);
+
+    /**
+     * @brief Luhn 체크섬 검증 (카드번호 숫자열)
+     */
+    static bool LuhnCheck(const std::wstring& digits);
+
+    //=========================================================================
+    // 후보 탐색 (Scan 내부, 테스트에서 SIMD 경로 확인용으로 공개)
+    //=========================================================================
+
+    /**
+     * @brief from 이후 첫 번째 숫자 또는 '@' 위치 (없으면 n)
+     *
+     * 문서 본문의 대부분은 숫자가 없으므로 SIMD로 8/16글자 단위로 건너뛴다.
+     * wchar_t가 2바이트가 아니거나 SSE2가 없으면 FindCandidateScalar와 같다.
+     */
+    static size_t FindCandidate(const wchar_t* s, size_t n, size_t from);
+
+    /**
+     * @brief FindCandidate의 글자 단위 구현
+     */
+    static size_t FindCandidateScalar(const wchar_t* s, size_t n, size_t from);
+};
+
+} // namespace cpyhwpx
@@ -0,0 +1,100 @@
+/**
+ * @file TemplateCache.cpp
+ * @brief TemplateCache 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "TemplateCache.h"
+
+namespace cpyhwpx {
+
+//=============================================================================
+// 생성자
+//=============================================================================
+
+TemplateCache::TemplateCache(size_t max_bytes)
+    : m_maxBytes(max_bytes)
+    , m_bytes(0)
+    , m_hits(0)
+    , m_misses(0)
+    , m_evictions(0)
+    , m_stale(0)
+{
+}
+
+//=============================================================================
+// 조회/보관
+//=============================================================================
+
+const BstrString* TemplateCache::Find(const std::wstring& key, const FileInfo& stamp)
+{
+    auto it = m_lookup.find(key);
+    if (it == m_lookup.end()) {
+        m_misses++;
+        return nullptr;
+    }
+
+    const FileInfo& saved = it->second->stamp;
+    if (saved.size != stamp.size || saved.mtime_ns != stamp.mtime_ns) {
+        Erase(key);
+        m_stale++;
+        m_misses++;
+        return nullptr;
+    }
+
+    m_hits++;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return &it->second->data;
+}
+
+bool TemplateCache::Insert(const std::wstring& key, BstrString& data, const FileInfo& stamp)
+{
+    Erase(key);
+
+    size_t bytes = data.size() * sizeof(wchar_t);
+    if (bytes == 0 || bytes > m_maxBytes) return false;
+
+    Trim(m_maxBytes - bytes);
+    m_entries.push_front(Entry{ key, std::move(data), bytes, stamp });
+    m_lookup[key] = m_entries.begin();
+    m_bytes += bytes;
+    return true;
+}
+
+bool TemplateCache::Erase(const std::wstring& key)
+{
+    auto it = m_lookup.find(key);
+    if (it == m_lookup.end()) return false;
+
+    m_bytes -= it->second->bytes;
+    m_entries.erase(it->second);
+    m_lookup.erase(it);
+    return true;
+}
+
+void TemplateCache::Clear()
+{
+    m_lookup.clear();
+    m_entries.clear();
+    m_bytes = 0;
+}
+
+void TemplateCache::SetMaxBytes(size_t max_bytes)
+{
+    m_maxBytes = max_bytes;
+    Trim(max_bytes);
+}
+
+void TemplateCache::Trim(size_t max_bytes)
+{
+    while (m_bytes > max_bytes && !m_entries.empty()) {
+        Entry& oldest = m_entries.back();
+        m_bytes -= oldest.bytes;
+        m_lookup.erase(oldest.key);
+        m_entries.pop_back();
+        m_evictions++;
+    }
+}
+
+} // namespace cpyhwpx
@@ -0,0 +1,106 @@
+/**
+ * @file TemplateCache.h
+ * @brief 서식 문서 직렬화 캐시 (바이트 한도 LRU)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 메일 머지처럼 같은 .hwt/.hwp 서식을 레코드마다 다시 여는 대신,
+ * 처음 연 문서를 GetTextFile("HWP") 결과로 보관해 두고 SetTextFile로 찍어 낸다.
+ */
+
+#pragma once
+
+#include "BstrString.h"
+#include "Platform.h"
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace cpyhwpx {
+
+/**
+ * @class TemplateCache
+ * @brief 서식 키 → 직렬화된 문서 (GetTextFile 결과 BSTR)
+ *
+ * 보관 바이트 합이 한도를 넘으면 가장 오래 쓰지 않은 항목부터 버린다.
+ * 한도보다 큰 문서는 보관하지 않는다. HwpWrapper와 같은 스레드에서만 사용한다.
+ *
+ * 항목마다 보관할 때의 서식 파일 크기/수정 시각을 함께 두고, 찾을 때 달라졌으면
+ * 고친 서식으로 보고 버린다 (파일 정보를 읽지 못한 항목은 키만으로 찾는다).
+ */
+class TemplateCache {
+public:
+    static constexpr size_t kDefaultMaxBytes = 64 * 1024 * 1024;
+
+    explicit TemplateCache(size_t max_bytes = kDefaultMaxBytes);
+
+    TemplateCache(const TemplateCache&) = delete;
+    TemplateCache& operator=(const TemplateCache&) = delete;
+
+    /**
+     * @brief 보관된 문서 찾기 (찾으면 가장 최근 항목으로)
+     * @param stamp 현재 서식 파일 크기/수정 시각 (보관할 때와 다르면 항목을 버림)
+     * @return 없으면 nullptr (다음 Insert/Erase/Clear 전까지 유효)
+     */
+    const BstrString* Find(const std::wstring& key, const FileInfo& stamp = FileInfo());
+
+    /**
+     * @brief 문서 보관 (같은 키는 교체)
+     * @param data 보관할 문서 (보관하면 비워짐, 한도보다 크면 그대로 둠)
+     * @param stamp 보관하는 서식 파일 크기/수정 시각
+     * @return 보관했으면 true
+     */
+    bool Insert(const std::wstring& key, BstrString& data, const FileInfo& stamp = FileInfo());
+
+    /**
+     * @brief 항목 삭제
+     * @return 있었으면 true
+     */
+    bool Erase(const std::wstring& key);
+
+    /**
+     * @brief 모든 항목 삭제 (통계는 유지)
+     */
+    void Clear();
+
+    /**
+     * @brief 바이트 한도 변경 (0이면 캐시 사용 안 함, 넘치는 항목은 바로 버림)
+     */
+    void SetMaxBytes(size_t max_bytes);
+    size_t GetMaxBytes() const { return m_maxBytes; }
+
+    //=========================================================================
+    // 통계
+    //=========================================================================
+
+    size_t GetBytes() const { return m_bytes; }
+    size_t GetCount() const { return m_entries.size(); }
+    uint64_t GetHitCount() const { return m_hits; }
+    uint64_t GetMissCount() const { return m_misses; }
+    uint64_t GetEvictionCount() const { return m_evictions; }
+    uint64_t GetStaleCount() const { return m_stale; }     // 파일이 바뀌어 버린 항목 (miss에 포함)
+
+private:
+    struct Entry {
+        std::wstring key;
+        BstrString data;
+        size_t bytes;
+        FileInfo stamp;
+    };
+
+    /**
+     * @brief 한도 안으로 들어올 때까지 가장 오래된 항목 삭제
+     */
+    void Trim(size_t max_bytes);
+
+    std::list<Entry> m_entries;     // 앞쪽이 가장 최근
+    std::unordered_map<std::wstring, std::list<Entry>::iterator> m_lookup;
+    size_t m_maxBytes;
+    size_t m_bytes;
+    uint64_t m_hits;
+    uint64_t m_misses;
+    uint64_t m_evictions;
+    uint64_t m_stale;
+};
+
+} // namespace cpyhwpx
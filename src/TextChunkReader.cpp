@@ -0,0 +1,112 @@
+/**
+ * @file TextChunkReader.cpp
+ * @brief 문단 블록 단위 GetTextFile 스트리밍 추출 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "TextChunkReader.h"
+#include "HwpWrapper.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace cpyhwpx {
+
+TextChunkReader::TextChunkReader(HwpWrapper* hwp, const std::wstring& format, int chunk_paras,
+                                 size_t max_chunk_bytes)
+    : m_hwp(hwp)
+    , m_format(format)
+    , m_chunkParas((std::max)(chunk_paras, 1))
+    , m_maxChunkBytes(max_chunk_bytes)
+    , m_spanParas(m_chunkParas)
+    , m_saved{ 0, 0, 0 }
+    , m_end{ 0, 0, 0 }
+{
+}
+
+TextChunkReader::~TextChunkReader()
+{
+    Close();
+}
+
+void TextChunkReader::Start()
+{
+    m_started = true;
+    if (!m_hwp) {
+        m_finished = true;
+        return;
+    }
+
+    m_saved = m_hwp->GetPos();
+
+    // 본문 끝 위치로 문단 수 측정
+    m_hwp->MovePos(3, 0, 0);  // moveDocEnd = 3
+    m_end = m_hwp->GetPos();
+}
+
+bool TextChunkReader::Next(BstrString& chunk)
+{
+    if (!m_started) {
+        Start();
+    }
+    if (m_finished) return false;
+    chunk.Reset();  // 이전 청크와 새 청크가 동시에 메모리에 있지 않도록
+
+    int start = m_nextPara;
+    if (start > m_end.para || (start == m_end.para && m_end.pos == 0)) {
+        // 마지막 빈 문단은 내보낼 내용이 없음
+        Close();
+        return false;
+    }
+
+    for (;;) {
+        int last = (std::min)(start + m_spanParas - 1, m_end.para);
+        if (!Extract(start, last, chunk)) {
+            Close();
+            return false;
+        }
+
+        size_t bytes = chunk.size() * sizeof(OLECHAR);
+        if (m_maxChunkBytes == 0 || bytes <= m_maxChunkBytes || last == start) {
+            // 한도의 절반도 안 되면 다음 청크는 문단을 늘림 (chunk_paras까지)
+            if (m_maxChunkBytes != 0 && bytes < m_maxChunkBytes / 2) {
+                m_spanParas = (std::min)(m_spanParas * 2, m_chunkParas);
+            }
+            m_nextPara = last + 1;
+            ++m_chunkIndex;
+            return true;
+        }
+
+        // 한도를 넘으면 버리고 크기 비율만큼 문단 수를 줄여 다시 추출
+        chunk.Reset();
+        int paras = last - start + 1;
+        uint64_t fit = static_cast<uint64_t>(paras) * m_maxChunkBytes / bytes;
+        m_spanParas = (std::max)(1, (std::min)(paras - 1, static_cast<int>(fit)));
+    }
+}
+
+bool TextChunkReader::Extract(int start, int last, BstrString& chunk)
+{
+    // 블록 선택: 다음 청크 첫 문단 앞까지 (문단 나누기 포함), 마지막 청크는 본문 끝까지
+    bool selected = (last < m_end.para)
+        ? m_hwp->SelectText(start, 0, last + 1, 0, m_end.list)
+        : m_hwp->SelectText(start, 0, m_end.para, m_end.pos, m_end.list);
+    if (!selected) return false;
+
+    chunk = m_hwp->GetTextFileBstr(m_format, L"saveblock:true");
+    m_hwp->Cancel();
+    return true;
+}
+
+void TextChunkReader::Close()
+{
+    if (m_finished) return;
+    m_finished = true;
+
+    if (m_started && m_hwp) {
+        m_hwp->Cancel();
+        m_hwp->SetPos(m_saved.list, m_saved.para, m_saved.pos);
+    }
+}
+
+} // namespace cpyhwpx
@@ -0,0 +1,99 @@
+/**
+ * @file TextChunkReader.h
+ * @brief 문단 블록 단위 GetTextFile 스트리밍 추출
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 대용량 문서를 한 번에 BSTR로 받지 않고 블록별로 나누어 추출
+ */
+
+#pragma once
+
+#include "HwpTypes.h"
+#include "BstrString.h"
+#include <cstddef>
+#include <string>
+
+namespace cpyhwpx {
+
+// 전방 선언
+class HwpWrapper;
+
+/**
+ * @class TextChunkReader
+ * @brief 문단 N개씩 블록 선택 후 "saveblock"으로 추출하는 읽기 객체
+ *
+ * 한 번에 하나의 청크만 메모리에 있으므로 최대 사용량은 청크 크기로 제한된다.
+ * 바이트 한도를 주면 추출한 블록이 한도를 넘을 때 버리고 문단 수를 줄여 다시 추출한다
+ * (문단 하나가 한도보다 크면 그 문단은 그대로 반환).
+ * 추출이 끝나거나 객체가 소멸되면 선택을 해제하고 원래 캐럿 위치로 복원한다.
+ * HWPML2X/HTML 형식은 청크마다 완결된 문서로 반환된다.
+ */
+class TextChunkReader {
+public:
+    /**
+     * @brief TextChunkReader 생성자
+     * @param hwp 부모 HwpWrapper (reader보다 오래 살아 있어야 함)
+     * @param format GetTextFile 형식 ("UNICODE", "HWPML2X" 등)
+     * @param chunk_paras 청크당 최대 문단 수 (1 이상)
+     * @param max_chunk_bytes 청크당 최대 바이트 (UTF-16 기준, 0이면 문단 수로만 나눔)
+     */
+    TextChunkReader(HwpWrapper* hwp, const std::wstring& format, int chunk_paras,
+                    size_t max_chunk_bytes = 0);
+
+    /**
+     * @brief 소멸자 (캐럿 위치 복원)
+     */
+    ~TextChunkReader();
+
+    // 복사 금지
+    TextChunkReader(const TextChunkReader&) = delete;
+    TextChunkReader& operator=(const TextChunkReader&) = delete;
+
+    /**
+     * @brief 다음 청크 추출
+     * @param chunk 추출된 청크 (BSTR 소유)
+     * @return 청크가 있으면 true, 끝이면 false
+     */
+    bool Next(BstrString& chunk);
+
+    /**
+     * @brief 추출 중단 및 캐럿 위치 복원
+     */
+    void Close();
+
+    /**
+     * @brief 지금까지 반환한 청크 수
+     */
+    int GetChunkIndex() const { return m_chunkIndex; }
+
+    /**
+     * @brief 본문 문단 수 (첫 Next 호출 이후 유효)
+     */
+    int GetParaCount() const { return m_started ? m_end.para + 1 : 0; }
+
+private:
+    /**
+     * @brief 캐럿 위치 저장 및 문서 끝 위치 측정
+     */
+    void Start();
+
+    /**
+     * @brief 문단 start~last 블록 선택 후 추출
+     */
+    bool Extract(int start, int last, BstrString& chunk);
+
+    HwpWrapper* m_hwp;
+    std::wstring m_format;
+    int m_chunkParas;
+    size_t m_maxChunkBytes;
+    int m_spanParas;        // 다음 청크 문단 수 (바이트 한도에 맞춰 줄었다 늘어남)
+
+    HwpPos m_saved;         // 시작 전 캐럿 위치
+    HwpPos m_end;           // 본문 마지막 위치
+    int m_nextPara = 0;     // 다음 청크 시작 문단
+    int m_chunkIndex = 0;
+    bool m_started = false;
+    bool m_finished = false;
+};
+
+} // namespace cpyhwpx
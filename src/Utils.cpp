@@ -6,8 +6,11 @@
  */
 
 #include "Utils.h"
+#include "Platform.h"
 #include <algorithm>
 #include <cctype>
+#include <climits>
+#include <cstdio>
 #include <cwctype>
 #include <sstream>
 #include <iomanip>
@@ -206,6 +209,30 @@ bool EqualsIgnoreCase(const std::wstring& a, const std::wstring& b)
     return true;
 }
 
+bool MatchWildcard(const std::wstring& pattern, const std::wstring& text)
+{
+    // 마지막 '*' 위치로만 되돌아가는 선형 비교
+    size_t p = 0, t = 0;
+    size_t star = std::wstring::npos, mark = 0;
+    while (t < text.length()) {
+        if (p < pattern.length() &&
+            (pattern[p] == L'?' || towlower(pattern[p]) == towlower(text[t]))) {
+            ++p;
+            ++t;
+        } else if (p < pattern.length() && pattern[p] == L'*') {
+            star = p++;
+            mark = t;
+        } else if (star != std::wstring::npos) {
+            p = star + 1;
+            t = ++mark;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.length() && pattern[p] == L'*') ++p;
+    return p == pattern.length();
+}
+
 std::wstring ToLower(const std::wstring& str)
 {
     std::wstring result = str;
@@ -220,6 +247,130 @@ std::wstring ToUpper(const std::wstring& str)
     return result;
 }
 
+//=============================================================================
+// UTF-8 / JSON
+//=============================================================================
+
+std::string ToUtf8(const std::wstring& str)
+{
+    if (str.empty()) return std::string();
+    int n = WideCharToMultiByte(CP_UTF8, 0, str.c_str(), static_cast<int>(str.size()),
+                                NULL, 0, NULL, NULL);
+    if (n <= 0) return std::string();
+    std::string out(static_cast<size_t>(n), '\0');
+    WideCharToMultiByte(CP_UTF8, 0, str.c_str(), static_cast<int>(str.size()),
+                        &out[0], n, NULL, NULL);
+    return out;
+}
+
+std::wstring FromUtf8(const char* data, size_t len)
+{
+    if (!data || len == 0) return std::wstring();
+    int n = MultiByteToWideChar(CP_UTF8, 0, data, static_cast<int>(len), NULL, 0);
+    if (n <= 0) return std::wstring();
+    std::wstring out(static_cast<size_t>(n), L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, data, static_cast<int>(len), &out[0], n);
+    return out;
+}
+
+void AppendJsonEscaped(std::string& out, const char* data, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        unsigned char c = static_cast<unsigned char>(data[i]);
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += static_cast<char>(c);
+        } else if (c < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+        } else {
+            out += static_cast<char>(c);
+        }
+    }
+}
+
+void AppendJsonString(std::string& out, const std::wstring& str)
+{
+    std::string utf8 = ToUtf8(str);
+    out += '"';
+    AppendJsonEscaped(out, utf8.data(), utf8.size());
+    out += '"';
+}
+
+//=============================================================================
+// BASE64
+//=============================================================================
+
+namespace {
+
+const char kBase64Chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+int Base64Value(wchar_t ch)
+{
+    if (ch >= L'A' && ch <= L'Z') return ch - L'A';
+    if (ch >= L'a' && ch <= L'z') return ch - L'a' + 26;
+    if (ch >= L'0' && ch <= L'9') return ch - L'0' + 52;
+    if (ch == L'+') return 62;
+    if (ch == L'/') return 63;
+    return -1;
+}
+
+} // namespace
+
+void Base64Encode(const unsigned char* data, size_t len, wchar_t* out)
+{
+    size_t i = 0;
+    for (; i + 3 <= len; i += 3) {
+        unsigned int n = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+        *out++ = kBase64Chars[(n >> 18) & 0x3F];
+        *out++ = kBase64Chars[(n >> 12) & 0x3F];
+        *out++ = kBase64Chars[(n >> 6) & 0x3F];
+        *out++ = kBase64Chars[n & 0x3F];
+    }
+    if (i < len) {
+        unsigned int n = data[i] << 16;
+        if (i + 1 < len) n |= data[i + 1] << 8;
+        *out++ = kBase64Chars[(n >> 18) & 0x3F];
+        *out++ = kBase64Chars[(n >> 12) & 0x3F];
+        *out++ = (i + 1 < len) ? kBase64Chars[(n >> 6) & 0x3F] : L'=';
+        *out++ = L'=';
+    }
+}
+
+bool Base64Decode(const wchar_t* data, size_t len, std::string& out)
+{
+    out.clear();
+    out.reserve(len / 4 * 3);
+
+    unsigned int buffer = 0;
+    int bits = 0;
+    size_t padding = 0;
+    size_t symbols = 0;
+    for (size_t i = 0; i < len; ++i) {
+        wchar_t ch = data[i];
+        if (ch == L' ' || ch == L'\r' || ch == L'\n' || ch == L'\t') continue;
+        if (ch == L'=') {
+            padding++;
+            symbols++;
+            continue;
+        }
+
+        int value = Base64Value(ch);
+        if (value < 0 || padding > 0) return false;     // 패딩 뒤에 데이터
+        symbols++;
+
+        buffer = (buffer << 6) | static_cast<unsigned int>(value);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            out.push_back(static_cast<char>((buffer >> bits) & 0xFF));
+        }
+    }
+    return symbols % 4 == 0 && padding <= 2;
+}
+
 //=============================================================================
 // 파일 경로 처리
 //=============================================================================
@@ -303,14 +454,12 @@ std::wstring CombinePath(const std::wstring& path1, const std::wstring& path2)
 
 bool FileExists(const std::wstring& path)
 {
-    DWORD attr = GetFileAttributesW(path.c_str());
-    return (attr != INVALID_FILE_ATTRIBUTES && !(attr & FILE_ATTRIBUTE_DIRECTORY));
+    return PlatformServices::Get().FileExists(path);
 }
 
 bool DirectoryExists(const std::wstring& path)
 {
-    DWORD attr = GetFileAttributesW(path.c_str());
-    return (attr != INVALID_FILE_ATTRIBUTES && (attr & FILE_ATTRIBUTE_DIRECTORY));
+    return PlatformServices::Get().DirectoryExists(path);
 }
 
 //=============================================================================
@@ -413,17 +562,8 @@ bool CheckRegistryKey(const std::wstring& key_name)
 {
     // HWP 보안 모듈 레지스트리 확인
     // HKEY_CURRENT_USER\Software\HNC\HwpAutomation
-    HKEY hKey;
     std::wstring fullPath = L"Software\\HNC\\HwpAutomation\\" + key_name;
-
-    LONG result = RegOpenKeyExW(HKEY_CURRENT_USER, fullPath.c_str(), 0, KEY_READ, &hKey);
-
-    if (result == ERROR_SUCCESS) {
-        RegCloseKey(hKey);
-        return true;
-    }
-
-    return false;
+    return PlatformServices::Get().RegistryKeyExists(fullPath);
 }
 
 //=============================================================================
@@ -9,8 +9,7 @@
 #pragma once
 
 #include "HwpTypes.h"
-#include <Windows.h>
-#include <OAIdl.h>      // VARIANT
+#include "ComPlatform.h"
 #include <string>
 #include <vector>
 #include <tuple>
@@ -137,6 +136,12 @@ std::wstring Replace(const std::wstring& str, const std::wstring& from, const st
  */
 bool EqualsIgnoreCase(const std::wstring& a, const std::wstring& b);
 
+/**
+ * @brief 와일드카드 비교 (*, ?, 대소문자 무시)
+ * @param pattern 예: "*.hwp", "보고서_??.hwpx"
+ */
+bool MatchWildcard(const std::wstring& pattern, const std::wstring& text);
+
 /**
  * @brief 소문자로 변환
  */
@@ -147,6 +152,55 @@ std::wstring ToLower(const std::wstring& str);
  */
 std::wstring ToUpper(const std::wstring& str);
 
+//=============================================================================
+// UTF-8 / JSON
+//=============================================================================
+
+/**
+ * @brief wchar_t 문자열을 UTF-8로 변환 (파일 경로, 기록 파일, 압축 파일 이름 등)
+ */
+std::string ToUtf8(const std::wstring& str);
+
+/**
+ * @brief UTF-8을 wchar_t 문자열로 변환 (잘못된 바이트는 U+FFFD)
+ */
+std::wstring FromUtf8(const char* data, size_t len);
+inline std::wstring FromUtf8(const std::string& str) { return FromUtf8(str.data(), str.size()); }
+
+/**
+ * @brief UTF-8 바이트를 JSON 문자열 내용으로 이스케이프해 out 끝에 추가 (따옴표 없음)
+ *
+ * '"', '\'와 제어 문자만 바꾸고 나머지 바이트는 그대로 둔다.
+ */
+void AppendJsonEscaped(std::string& out, const char* data, size_t len);
+
+/**
+ * @brief 따옴표로 감싼 JSON 문자열을 out 끝에 추가 (UTF-8)
+ */
+void AppendJsonString(std::string& out, const std::wstring& str);
+
+//=============================================================================
+// BASE64
+//=============================================================================
+
+/**
+ * @brief BASE64 인코딩 결과 길이 (패딩 포함)
+ */
+inline size_t Base64EncodedLength(size_t len) { return (len + 2) / 3 * 4; }
+
+/**
+ * @brief BASE64 인코딩 (줄바꿈 없음)
+ * @param out Base64EncodedLength(len) 이상의 버퍼 (BSTR에 바로 기록 가능)
+ */
+void Base64Encode(const unsigned char* data, size_t len, wchar_t* out);
+
+/**
+ * @brief BASE64 디코딩 (공백/줄바꿈은 건너뜀)
+ * @param out 디코딩 결과 (기존 내용 교체)
+ * @return BASE64가 아닌 문자가 있거나 길이가 맞지 않으면 false
+ */
+bool Base64Decode(const wchar_t* data, size_t len, std::string& out);
+
 //=============================================================================
 // 파일 경로 처리
 //=============================================================================
@@ -4,6 +4,8 @@
  */
 
 #include "XHwpDocument.h"
+#include "HwpWrapper.h"
+#include "ComStats.h"
 #include <stdexcept>
 
 namespace cpyhwpx {
@@ -12,8 +14,9 @@ namespace cpyhwpx {
 // 생성자/소멸자
 //=============================================================================
 
-XHwpDocument::XHwpDocument(IDispatch* pDocument)
+XHwpDocument::XHwpDocument(IDispatch* pDocument, HwpWrapper* hwp)
     : m_pDocument(pDocument)
+    , m_pHwp(hwp)
 {
     if (m_pDocument) {
         m_pDocument->AddRef();
@@ -30,6 +33,7 @@ XHwpDocument::~XHwpDocument()
 
 XHwpDocument::XHwpDocument(XHwpDocument&& other) noexcept
     : m_pDocument(other.m_pDocument)
+    , m_pHwp(other.m_pHwp)
 {
     other.m_pDocument = nullptr;
 }
@@ -41,6 +45,7 @@ XHwpDocument& XHwpDocument::operator=(XHwpDocument&& other) noexcept
             m_pDocument->Release();
         }
         m_pDocument = other.m_pDocument;
+        m_pHwp = other.m_pHwp;
         other.m_pDocument = nullptr;
     }
     return *this;
@@ -56,16 +61,14 @@ std::wstring XHwpDocument::GetStringProperty(const std::wstring& name) const
 
     DISPID dispid;
     OLECHAR* propName = const_cast<OLECHAR*>(name.c_str());
-    HRESULT hr = m_pDocument->GetIDsOfNames(IID_NULL, &propName, 1,
-                                             LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocument, &propName, 1, &dispid);
     if (FAILED(hr)) return L"";
 
     DISPPARAMS params = { nullptr, nullptr, 0, 0 };
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocument->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                              DISPATCH_PROPERTYGET, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocument, dispid, DISPATCH_PROPERTYGET, &params, &result, nullptr, nullptr);
     if (FAILED(hr)) {
         VariantClear(&result);
         return L"";
@@ -85,16 +88,14 @@ int XHwpDocument::GetIntProperty(const std::wstring& name) const
 
     DISPID dispid;
     OLECHAR* propName = const_cast<OLECHAR*>(name.c_str());
-    HRESULT hr = m_pDocument->GetIDsOfNames(IID_NULL, &propName, 1,
-                                             LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocument, &propName, 1, &dispid);
     if (FAILED(hr)) return 0;
 
     DISPPARAMS params = { nullptr, nullptr, 0, 0 };
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocument->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                              DISPATCH_PROPERTYGET, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocument, dispid, DISPATCH_PROPERTYGET, &params, &result, nullptr, nullptr);
     if (FAILED(hr)) {
         VariantClear(&result);
         return 0;
@@ -118,16 +119,14 @@ bool XHwpDocument::GetBoolProperty(const std::wstring& name) const
 
     DISPID dispid;
     OLECHAR* propName = const_cast<OLECHAR*>(name.c_str());
-    HRESULT hr = m_pDocument->GetIDsOfNames(IID_NULL, &propName, 1,
-                                             LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocument, &propName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     DISPPARAMS params = { nullptr, nullptr, 0, 0 };
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocument->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                              DISPATCH_PROPERTYGET, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocument, dispid, DISPATCH_PROPERTYGET, &params, &result, nullptr, nullptr);
     if (FAILED(hr)) {
         VariantClear(&result);
         return false;
@@ -151,16 +150,14 @@ bool XHwpDocument::InvokeMethod(const std::wstring& name)
 
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(name.c_str());
-    HRESULT hr = m_pDocument->GetIDsOfNames(IID_NULL, &methodName, 1,
-                                             LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocument, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     DISPPARAMS params = { nullptr, nullptr, 0, 0 };
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocument->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                              DISPATCH_METHOD, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocument, dispid, DISPATCH_METHOD, &params, &result, nullptr, nullptr);
     VariantClear(&result);
     return SUCCEEDED(hr);
 }
@@ -171,8 +168,7 @@ bool XHwpDocument::InvokeMethodInt(const std::wstring& name, int arg)
 
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(name.c_str());
-    HRESULT hr = m_pDocument->GetIDsOfNames(IID_NULL, &methodName, 1,
-                                             LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocument, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     VARIANT vArg;
@@ -184,8 +180,7 @@ bool XHwpDocument::InvokeMethodInt(const std::wstring& name, int arg)
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocument->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                              DISPATCH_METHOD, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocument, dispid, DISPATCH_METHOD, &params, &result, nullptr, nullptr);
     VariantClear(&vArg);
     VariantClear(&result);
     return SUCCEEDED(hr);
@@ -197,8 +192,7 @@ bool XHwpDocument::InvokeMethodBool(const std::wstring& name, bool arg)
 
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(name.c_str());
-    HRESULT hr = m_pDocument->GetIDsOfNames(IID_NULL, &methodName, 1,
-                                             LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocument, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     VARIANT vArg;
@@ -210,8 +204,7 @@ bool XHwpDocument::InvokeMethodBool(const std::wstring& name, bool arg)
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocument->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                              DISPATCH_METHOD, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocument, dispid, DISPATCH_METHOD, &params, &result, nullptr, nullptr);
     VariantClear(&vArg);
     VariantClear(&result);
     return SUCCEEDED(hr);
@@ -257,7 +250,9 @@ int XHwpDocument::GetEditMode() const
 
 bool XHwpDocument::SetActiveDocument()
 {
-    return InvokeMethod(L"SetActive_XHwpDocument");
+    bool ok = InvokeMethod(L"SetActive_XHwpDocument");
+    NoteEdit(EditKind::Document);
+    return ok;
 }
 
 //=============================================================================
@@ -272,8 +267,7 @@ bool XHwpDocument::Open(const std::wstring& filename,
 
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"Open");
-    HRESULT hr = m_pDocument->GetIDsOfNames(IID_NULL, &methodName, 1,
-                                             LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocument, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     // Open(filename, Format, arg) - 역순으로 인자 배열
@@ -293,8 +287,7 @@ bool XHwpDocument::Open(const std::wstring& filename,
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocument->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                              DISPATCH_METHOD, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocument, dispid, DISPATCH_METHOD, &params, &result, nullptr, nullptr);
 
     for (auto& a : args) VariantClear(&a);
     VariantClear(&result);
@@ -314,8 +307,7 @@ bool XHwpDocument::SaveAs(const std::wstring& path,
 
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"SaveAs");
-    HRESULT hr = m_pDocument->GetIDsOfNames(IID_NULL, &methodName, 1,
-                                             LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocument, &methodName, 1, &dispid);
     if (FAILED(hr)) return false;
 
     // SaveAs(Path, Format, arg) - 역순으로 인자 배열
@@ -335,8 +327,7 @@ bool XHwpDocument::SaveAs(const std::wstring& path,
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocument->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                              DISPATCH_METHOD, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocument, dispid, DISPATCH_METHOD, &params, &result, nullptr, nullptr);
 
     for (auto& a : args) VariantClear(&a);
     VariantClear(&result);
@@ -346,11 +337,13 @@ bool XHwpDocument::SaveAs(const std::wstring& path,
 void XHwpDocument::Close(bool isDirty)
 {
     InvokeMethodBool(L"Close", isDirty);
+    NoteEdit(EditKind::Document);
 }
 
 void XHwpDocument::Clear(bool option)
 {
     InvokeMethodBool(L"Clear", option);
+    NoteEdit(EditKind::Content);
 }
 
 //=============================================================================
@@ -359,12 +352,22 @@ void XHwpDocument::Clear(bool option)
 
 bool XHwpDocument::Undo(int count)
 {
-    return InvokeMethodInt(L"Undo", count);
+    bool ok = InvokeMethodInt(L"Undo", count);
+    NoteEdit(EditKind::Content | EditKind::Layout);
+    return ok;
 }
 
 bool XHwpDocument::Redo(int count)
 {
-    return InvokeMethodInt(L"Redo", count);
+    bool ok = InvokeMethodInt(L"Redo", count);
+    NoteEdit(EditKind::Content | EditKind::Layout);
+    return ok;
+}
+
+void XHwpDocument::NoteEdit(int kinds)
+{
+    // 다른 문서를 바꿔도 활성 문서 캐시가 맞는지 알 수 없으므로 문서 구분 없이 기록
+    if (m_pHwp) m_pHwp->NoteEdit(kinds);
 }
 
 } // namespace cpyhwpx
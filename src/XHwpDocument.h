@@ -8,8 +8,7 @@
 
 #pragma once
 
-#include <Windows.h>
-#include <comdef.h>
+#include "ComPlatform.h"
 #include <string>
 
 namespace cpyhwpx {
@@ -33,8 +32,9 @@ public:
     /**
      * @brief XHwpDocument 생성자
      * @param pDocument COM 문서 객체
+     * @param hwp 편집을 기록할 HwpWrapper (nullptr이면 기록 안 함)
      */
-    explicit XHwpDocument(IDispatch* pDocument);
+    explicit XHwpDocument(IDispatch* pDocument, HwpWrapper* hwp = nullptr);
 
     /**
      * @brief 소멸자
@@ -199,8 +199,14 @@ protected:
      */
     bool InvokeMethodBool(const std::wstring& name, bool arg);
 
+    /**
+     * @brief HwpWrapper에 편집 기록 (EditKind 조합)
+     */
+    void NoteEdit(int kinds);
+
 private:
     IDispatch* m_pDocument;  // 문서 COM 포인터
+    HwpWrapper* m_pHwp;      // 편집 기록 (소유하지 않음)
 };
 
 } // namespace cpyhwpx
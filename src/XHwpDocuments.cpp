@@ -4,6 +4,8 @@
  */
 
 #include "XHwpDocuments.h"
+#include "HwpWrapper.h"
+#include "ComStats.h"
 #include <stdexcept>
 
 namespace cpyhwpx {
@@ -12,8 +14,9 @@ namespace cpyhwpx {
 // 생성자/소멸자
 //=============================================================================
 
-XHwpDocuments::XHwpDocuments(IDispatch* pDocuments)
+XHwpDocuments::XHwpDocuments(IDispatch* pDocuments, HwpWrapper* hwp)
     : m_pDocuments(pDocuments)
+    , m_pHwp(hwp)
 {
     if (m_pDocuments) {
         m_pDocuments->AddRef();
@@ -30,6 +33,7 @@ XHwpDocuments::~XHwpDocuments()
 
 XHwpDocuments::XHwpDocuments(XHwpDocuments&& other) noexcept
     : m_pDocuments(other.m_pDocuments)
+    , m_pHwp(other.m_pHwp)
 {
     other.m_pDocuments = nullptr;
 }
@@ -41,6 +45,7 @@ XHwpDocuments& XHwpDocuments::operator=(XHwpDocuments&& other) noexcept
             m_pDocuments->Release();
         }
         m_pDocuments = other.m_pDocuments;
+        m_pHwp = other.m_pHwp;
         other.m_pDocuments = nullptr;
     }
     return *this;
@@ -56,16 +61,14 @@ int XHwpDocuments::GetCount() const
 
     DISPID dispid;
     OLECHAR* propName = const_cast<OLECHAR*>(L"Count");
-    HRESULT hr = m_pDocuments->GetIDsOfNames(IID_NULL, &propName, 1,
-                                              LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocuments, &propName, 1, &dispid);
     if (FAILED(hr)) return 0;
 
     DISPPARAMS params = { nullptr, nullptr, 0, 0 };
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocuments->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_PROPERTYGET, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocuments, dispid, DISPATCH_PROPERTYGET, &params, &result, nullptr, nullptr);
     if (FAILED(hr)) {
         VariantClear(&result);
         return 0;
@@ -87,16 +90,14 @@ std::unique_ptr<XHwpDocument> XHwpDocuments::GetActiveDocument() const
 
     DISPID dispid;
     OLECHAR* propName = const_cast<OLECHAR*>(L"Active_XHwpDocument");
-    HRESULT hr = m_pDocuments->GetIDsOfNames(IID_NULL, &propName, 1,
-                                              LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocuments, &propName, 1, &dispid);
     if (FAILED(hr)) return nullptr;
 
     DISPPARAMS params = { nullptr, nullptr, 0, 0 };
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocuments->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_PROPERTYGET, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocuments, dispid, DISPATCH_PROPERTYGET, &params, &result, nullptr, nullptr);
     if (FAILED(hr)) {
         VariantClear(&result);
         return nullptr;
@@ -104,7 +105,7 @@ std::unique_ptr<XHwpDocument> XHwpDocuments::GetActiveDocument() const
 
     std::unique_ptr<XHwpDocument> doc;
     if (result.vt == VT_DISPATCH && result.pdispVal) {
-        doc = std::make_unique<XHwpDocument>(result.pdispVal);
+        doc = std::make_unique<XHwpDocument>(result.pdispVal, m_pHwp);
     }
     VariantClear(&result);
     return doc;
@@ -135,8 +136,7 @@ std::unique_ptr<XHwpDocument> XHwpDocuments::Item(int index) const
     // Item 메서드 호출
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"Item");
-    HRESULT hr = m_pDocuments->GetIDsOfNames(IID_NULL, &methodName, 1,
-                                              LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocuments, &methodName, 1, &dispid);
     if (FAILED(hr)) {
         throw std::runtime_error("Failed to get Item method");
     }
@@ -151,8 +151,7 @@ std::unique_ptr<XHwpDocument> XHwpDocuments::Item(int index) const
     VariantInit(&result);
 
     // DISPATCH_PROPERTYGET로 먼저 시도 (COM 컬렉션 표준)
-    hr = m_pDocuments->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_PROPERTYGET | DISPATCH_METHOD, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocuments, dispid, DISPATCH_PROPERTYGET | DISPATCH_METHOD, &params, &result, nullptr, nullptr);
     VariantClear(&vIndex);
 
     if (FAILED(hr)) {
@@ -162,7 +161,7 @@ std::unique_ptr<XHwpDocument> XHwpDocuments::Item(int index) const
 
     std::unique_ptr<XHwpDocument> doc;
     if (result.vt == VT_DISPATCH && result.pdispVal) {
-        doc = std::make_unique<XHwpDocument>(result.pdispVal);
+        doc = std::make_unique<XHwpDocument>(result.pdispVal, m_pHwp);
     }
     VariantClear(&result);
     return doc;
@@ -174,8 +173,7 @@ std::unique_ptr<XHwpDocument> XHwpDocuments::FindItem(int docID) const
 
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"FindItem");
-    HRESULT hr = m_pDocuments->GetIDsOfNames(IID_NULL, &methodName, 1,
-                                              LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocuments, &methodName, 1, &dispid);
     if (FAILED(hr)) return nullptr;
 
     VARIANT vDocID;
@@ -187,8 +185,7 @@ std::unique_ptr<XHwpDocument> XHwpDocuments::FindItem(int docID) const
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocuments->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_METHOD, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocuments, dispid, DISPATCH_METHOD, &params, &result, nullptr, nullptr);
     VariantClear(&vDocID);
 
     if (FAILED(hr)) {
@@ -198,7 +195,7 @@ std::unique_ptr<XHwpDocument> XHwpDocuments::FindItem(int docID) const
 
     std::unique_ptr<XHwpDocument> doc;
     if (result.vt == VT_DISPATCH && result.pdispVal) {
-        doc = std::make_unique<XHwpDocument>(result.pdispVal);
+        doc = std::make_unique<XHwpDocument>(result.pdispVal, m_pHwp);
     }
     VariantClear(&result);
     return doc;
@@ -214,8 +211,7 @@ std::unique_ptr<XHwpDocument> XHwpDocuments::Add(bool isTab)
 
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"Add");
-    HRESULT hr = m_pDocuments->GetIDsOfNames(IID_NULL, &methodName, 1,
-                                              LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocuments, &methodName, 1, &dispid);
     if (FAILED(hr)) return nullptr;
 
     VARIANT vIsTab;
@@ -227,9 +223,9 @@ std::unique_ptr<XHwpDocument> XHwpDocuments::Add(bool isTab)
     VARIANT result;
     VariantInit(&result);
 
-    hr = m_pDocuments->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                               DISPATCH_METHOD, &params, &result, nullptr, nullptr);
+    hr = ComInvoke(m_pDocuments, dispid, DISPATCH_METHOD, &params, &result, nullptr, nullptr);
     VariantClear(&vIsTab);
+    if (m_pHwp) m_pHwp->NoteEdit(EditKind::Document);
 
     if (FAILED(hr)) {
         VariantClear(&result);
@@ -238,7 +234,7 @@ std::unique_ptr<XHwpDocument> XHwpDocuments::Add(bool isTab)
 
     std::unique_ptr<XHwpDocument> doc;
     if (result.vt == VT_DISPATCH && result.pdispVal) {
-        doc = std::make_unique<XHwpDocument>(result.pdispVal);
+        doc = std::make_unique<XHwpDocument>(result.pdispVal, m_pHwp);
     }
     VariantClear(&result);
     return doc;
@@ -250,8 +246,7 @@ void XHwpDocuments::Close(bool isDirty)
 
     DISPID dispid;
     OLECHAR* methodName = const_cast<OLECHAR*>(L"Close");
-    HRESULT hr = m_pDocuments->GetIDsOfNames(IID_NULL, &methodName, 1,
-                                              LOCALE_USER_DEFAULT, &dispid);
+    HRESULT hr = ComGetIDsOfNames(m_pDocuments, &methodName, 1, &dispid);
     if (FAILED(hr)) return;
 
     VARIANT vIsDirty;
@@ -263,10 +258,10 @@ void XHwpDocuments::Close(bool isDirty)
     VARIANT result;
     VariantInit(&result);
 
-    m_pDocuments->Invoke(dispid, IID_NULL, LOCALE_USER_DEFAULT,
-                          DISPATCH_METHOD, &params, &result, nullptr, nullptr);
+    ComInvoke(m_pDocuments, dispid, DISPATCH_METHOD, &params, &result, nullptr, nullptr);
     VariantClear(&vIsDirty);
     VariantClear(&result);
+    if (m_pHwp) m_pHwp->NoteEdit(EditKind::Document);
 }
 
 } // namespace cpyhwpx
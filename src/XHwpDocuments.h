@@ -9,8 +9,7 @@
 #pragma once
 
 #include "XHwpDocument.h"
-#include <Windows.h>
-#include <comdef.h>
+#include "ComPlatform.h"
 #include <memory>
 #include <string>
 
@@ -32,8 +31,9 @@ public:
     /**
      * @brief XHwpDocuments 생성자
      * @param pDocuments COM 문서 컬렉션 객체
+     * @param hwp 편집을 기록할 HwpWrapper (문서 객체에도 전달, nullptr이면 기록 안 함)
      */
-    explicit XHwpDocuments(IDispatch* pDocuments);
+    explicit XHwpDocuments(IDispatch* pDocuments, HwpWrapper* hwp = nullptr);
 
     /**
      * @brief 소멸자
@@ -126,6 +126,7 @@ public:
 
 private:
     IDispatch* m_pDocuments;  // 문서 컬렉션 COM 포인터
+    HwpWrapper* m_pHwp;       // 편집 기록 (소유하지 않음)
 };
 
 } // namespace cpyhwpx
@@ -0,0 +1,210 @@
+/**
+ * @file ZipReader.cpp
+ * @brief ZipReader 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "ZipReader.h"
+#include "Deflate.h"
+#include "ComPlatform.h"
+#include "Utils.h"
+#include <algorithm>
+
+namespace cpyhwpx {
+
+namespace {
+
+constexpr uint32_t kLocalHeaderSignature = 0x04034b50;
+constexpr uint32_t kCentralHeaderSignature = 0x02014b50;
+constexpr uint32_t kEndOfCentralSignature = 0x06054b50;
+constexpr size_t kEndOfCentralSize = 22;
+constexpr size_t kMaxComment = 0xFFFF;
+constexpr uint16_t kFlagEncrypted = 0x0001;
+
+FILE* OpenFile(const std::wstring& path)
+{
+#if defined(_WIN32)
+    return _wfopen(path.c_str(), L"rb");
+#else
+    return fopen(Utils::ToUtf8(path).c_str(), "rb");
+#endif
+}
+
+uint32_t Get16(const uint8_t* p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8);
+}
+
+uint32_t Get32(const uint8_t* p)
+{
+    return Get16(p) | (Get16(p + 2) << 16);
+}
+
+} // namespace
+
+//=============================================================================
+// 생성자/소멸자
+//=============================================================================
+
+ZipReader::ZipReader()
+    : m_file(nullptr)
+{
+}
+
+ZipReader::~ZipReader()
+{
+    Close();
+}
+
+void ZipReader::Close()
+{
+    if (m_file) {
+        fclose(m_file);
+        m_file = nullptr;
+    }
+    m_entries.clear();
+}
+
+//=============================================================================
+// 중앙 디렉터리
+//=============================================================================
+
+bool ZipReader::Open(const std::wstring& path)
+{
+    Close();
+
+    m_file = OpenFile(path);
+    if (!m_file) return false;
+
+    if (fseek(m_file, 0, SEEK_END) != 0) {
+        Close();
+        return false;
+    }
+    long fileSize = ftell(m_file);
+    if (fileSize < static_cast<long>(kEndOfCentralSize)) {
+        Close();
+        return false;
+    }
+
+    // 끝에서 주석 최대 길이만큼 거슬러 올라가며 EOCD 찾기
+    size_t tailSize = std::min(static_cast<size_t>(fileSize), kEndOfCentralSize + kMaxComment);
+    std::vector<uint8_t> tail(tailSize);
+    if (!ReadAt(static_cast<uint64_t>(fileSize) - tailSize, tail.data(), tailSize)) {
+        Close();
+        return false;
+    }
+
+    const uint8_t* eocd = nullptr;
+    for (size_t i = tailSize - kEndOfCentralSize + 1; i-- > 0;) {
+        if (Get32(&tail[i]) == kEndOfCentralSignature) {
+            eocd = &tail[i];
+            break;
+        }
+    }
+    if (!eocd) {
+        Close();
+        return false;
+    }
+
+    size_t count = Get16(eocd + 10);
+    uint32_t directorySize = Get32(eocd + 12);
+    uint32_t directoryOffset = Get32(eocd + 16);
+    if (static_cast<uint64_t>(directoryOffset) + directorySize > static_cast<uint64_t>(fileSize)) {
+        Close();
+        return false;
+    }
+
+    std::vector<uint8_t> directory(directorySize);
+    if (directorySize > 0 && !ReadAt(directoryOffset, directory.data(), directorySize)) {
+        Close();
+        return false;
+    }
+
+    size_t pos = 0;
+    m_entries.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (pos + 46 > directory.size() || Get32(&directory[pos]) != kCentralHeaderSignature) {
+            Close();
+            return false;
+        }
+        const uint8_t* p = &directory[pos];
+        size_t nameLength = Get16(p + 28);
+        size_t extraLength = Get16(p + 30);
+        size_t commentLength = Get16(p + 32);
+        if (pos + 46 + nameLength > directory.size()) {
+            Close();
+            return false;
+        }
+
+        Entry entry;
+        entry.flags = static_cast<uint16_t>(Get16(p + 8));
+        entry.method = static_cast<uint16_t>(Get16(p + 10));
+        entry.crc = Get32(p + 16);
+        entry.compressedSize = Get32(p + 20);
+        entry.size = Get32(p + 24);
+        entry.headerOffset = Get32(p + 42);
+        entry.name.assign(reinterpret_cast<const char*>(p + 46), nameLength);
+        m_entries.push_back(std::move(entry));
+
+        pos += 46 + nameLength + extraLength + commentLength;
+    }
+    return true;
+}
+
+int ZipReader::Find(const std::string& name) const
+{
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].name == name) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+//=============================================================================
+// 항목
+//=============================================================================
+
+bool ZipReader::ReadAt(uint64_t offset, void* data, size_t size)
+{
+    return fseek(m_file, static_cast<long>(offset), SEEK_SET) == 0 &&
+           fread(data, 1, size, m_file) == size;
+}
+
+bool ZipReader::ReadRaw(size_t index, std::string& out)
+{
+    if (!m_file || index >= m_entries.size()) return false;
+    const Entry& entry = m_entries[index];
+
+    // 데이터 위치는 로컬 헤더의 이름/추가 필드 길이로 정해짐 (중앙 디렉터리와 다를 수 있음)
+    uint8_t header[30];
+    if (!ReadAt(entry.headerOffset, header, sizeof(header)) || Get32(header) != kLocalHeaderSignature) {
+        return false;
+    }
+    uint64_t dataOffset = entry.headerOffset + sizeof(header) + Get16(header + 26) + Get16(header + 28);
+
+    out.resize(static_cast<size_t>(entry.compressedSize));
+    return entry.compressedSize == 0 || ReadAt(dataOffset, &out[0], out.size());
+}
+
+bool ZipReader::Read(size_t index, std::string& out)
+{
+    out.clear();
+    if (!m_file || index >= m_entries.size()) return false;
+    const Entry& entry = m_entries[index];
+    if (entry.flags & kFlagEncrypted) return false;
+
+    std::string raw;
+    if (!ReadRaw(index, raw)) return false;
+
+    if (entry.method == 0) {
+        out.swap(raw);
+    } else if (entry.method == 8) {
+        out.reserve(static_cast<size_t>(entry.size));
+        if (!InflateBuffer(raw.data(), raw.size(), out)) return false;
+    } else {
+        return false;
+    }
+    return out.size() == entry.size && Crc32(out.data(), out.size()) == entry.crc;
+}
+
+} // namespace cpyhwpx
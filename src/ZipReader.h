@@ -0,0 +1,74 @@
+/**
+ * @file ZipReader.h
+ * @brief ZIP 패키지 읽기 (HWPX 컨테이너용)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace cpyhwpx {
+
+/**
+ * @class ZipReader
+ * @brief 중앙 디렉터리로 항목을 찾아 읽는 ZIP 읽기
+ *
+ * - ReadRaw()는 압축된 바이트를 그대로 돌려주므로 ZipWriter::CopyEntry()로
+ *   바뀌지 않은 항목을 풀고 다시 압축하지 않고 옮길 수 있다
+ * - Stored/Deflate 항목만 풀 수 있음, 암호화/ZIP64는 지원하지 않음
+ */
+class ZipReader {
+public:
+    struct Entry {
+        std::string name;           // UTF-8 (CP437 이름도 바이트 그대로)
+        uint16_t method;            // 0=Stored, 8=Deflate
+        uint16_t flags;
+        uint32_t crc;
+        uint64_t compressedSize;
+        uint64_t size;
+        uint64_t headerOffset;      // 로컬 헤더 위치
+    };
+
+    ZipReader();
+    ~ZipReader();
+
+    ZipReader(const ZipReader&) = delete;
+    ZipReader& operator=(const ZipReader&) = delete;
+
+    /**
+     * @brief 파일을 열고 중앙 디렉터리 읽기
+     */
+    bool Open(const std::wstring& path);
+    void Close();
+
+    bool IsOpen() const { return m_file != nullptr; }
+    const std::vector<Entry>& GetEntries() const { return m_entries; }
+
+    /**
+     * @return 항목 번호 (없으면 -1)
+     */
+    int Find(const std::string& name) const;
+
+    /**
+     * @brief 압축된 그대로의 데이터
+     */
+    bool ReadRaw(size_t index, std::string& out);
+
+    /**
+     * @brief 풀린 데이터 (CRC 확인)
+     */
+    bool Read(size_t index, std::string& out);
+
+private:
+    bool ReadAt(uint64_t offset, void* data, size_t size);
+
+    FILE* m_file;
+    std::vector<Entry> m_entries;
+};
+
+} // namespace cpyhwpx
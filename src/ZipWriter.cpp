@@ -0,0 +1,505 @@
+/**
+ * @file ZipWriter.cpp
+ * @brief ZipWriter 구현
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "ZipWriter.h"
+#include "ZipReader.h"
+#include "ComPlatform.h"
+#include "Utils.h"
+#include <algorithm>
+#include <ctime>
+
+namespace cpyhwpx {
+
+namespace {
+
+constexpr uint32_t kLocalHeaderSignature = 0x04034b50;
+constexpr uint32_t kCentralHeaderSignature = 0x02014b50;
+constexpr uint32_t kEndOfCentralSignature = 0x06054b50;
+constexpr uint16_t kVersionNeeded = 20;
+constexpr uint16_t kFlagUtf8 = 0x0800;
+constexpr uint16_t kFlagEncrypted = 0x0001;
+constexpr size_t kLocalHeaderSize = 30;
+constexpr size_t kFlushSize = 256 * 1024;
+constexpr size_t kChunkSize = 256 * 1024;           // 압축 조각 (스레드 하나가 맡는 입력)
+constexpr size_t kDictionarySize = 32 * 1024;
+constexpr size_t kMaxQueuedChunks = 3;              // 스레드당 쓰지 않고 쌓아 둘 조각 수
+
+FILE* OpenFile(const std::wstring& path)
+{
+#if defined(_WIN32)
+    return _wfopen(path.c_str(), L"wb");
+#else
+    return fopen(Utils::ToUtf8(path).c_str(), "wb");
+#endif
+}
+
+void Put16(std::string& out, uint32_t value)
+{
+    out.push_back(static_cast<char>(value & 0xFF));
+    out.push_back(static_cast<char>((value >> 8) & 0xFF));
+}
+
+void Put32(std::string& out, uint32_t value)
+{
+    Put16(out, value & 0xFFFF);
+    Put16(out, value >> 16);
+}
+
+} // namespace
+
+//=============================================================================
+// 생성자/소멸자
+//=============================================================================
+
+ZipWriter::ZipWriter()
+    : m_file(nullptr)
+    , m_inEntry(false)
+    , m_failed(false)
+    , m_offset(0)
+    , m_dosTime(0)
+    , m_dosDate(0)
+    , m_entryLevel(6)
+    , m_firstChunk(true)
+    , m_queuedBytes(0)
+    , m_threads(1)
+    , m_deflater(6)
+    , m_stopping(false)
+    , m_copied(0)
+    , m_storedFallbacks(0)
+{
+}
+
+ZipWriter::~ZipWriter()
+{
+    StopWorkers();
+    if (m_file) {
+        fclose(m_file);
+        m_file = nullptr;
+    }
+}
+
+void ZipWriter::SetThreads(size_t threads)
+{
+    if (m_file) return;
+    if (threads == 0) {
+        threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    m_threads = threads;
+}
+
+bool ZipWriter::Open(const std::wstring& path)
+{
+    if (m_file) return false;
+
+    m_file = OpenFile(path);
+    if (!m_file) return false;
+
+    m_entries.clear();
+    m_ops.clear();
+    m_buffer.clear();
+    m_inEntry = false;
+    m_failed = false;
+    m_offset = 0;
+    m_queuedBytes = 0;
+    m_copied = 0;
+    m_storedFallbacks = 0;
+
+    // 모든 항목에 같은 수정 시각 (MS-DOS 형식, 지역 시간)
+    time_t now = time(nullptr);
+    struct tm local = {};
+#if defined(_WIN32)
+    localtime_s(&local, &now);
+#else
+    localtime_r(&now, &local);
+#endif
+    int year = local.tm_year + 1900;
+    if (year < 1980) year = 1980;
+    m_dosTime = static_cast<uint16_t>((local.tm_hour << 11) | (local.tm_min << 5) | (local.tm_sec / 2));
+    m_dosDate = static_cast<uint16_t>(((year - 1980) << 9) | ((local.tm_mon + 1) << 5) | local.tm_mday);
+
+    if (m_threads > 1) {
+        m_stopping = false;
+        for (size_t i = 0; i < m_threads; ++i) {
+            m_workers.emplace_back(&ZipWriter::WorkerLoop, this);
+        }
+    }
+    return true;
+}
+
+//=============================================================================
+// 항목
+//=============================================================================
+
+void ZipWriter::WriteLocalHeader(const Entry& entry, std::string& out) const
+{
+    Put32(out, kLocalHeaderSignature);
+    Put16(out, kVersionNeeded);
+    Put16(out, kFlagUtf8);
+    Put16(out, static_cast<uint16_t>(entry.method));
+    Put16(out, m_dosTime);
+    Put16(out, m_dosDate);
+    Put32(out, entry.crc);
+    Put32(out, static_cast<uint32_t>(entry.compressedSize));
+    Put32(out, static_cast<uint32_t>(entry.size));
+    Put16(out, static_cast<uint32_t>(entry.name.size()));
+    Put16(out, 0);                  // 추가 필드 없음
+    out += entry.name;
+}
+
+bool ZipWriter::BeginEntry(const std::string& name, Method method, int level)
+{
+    if (!m_file || m_failed) return false;
+    if (m_inEntry && !EndEntry()) return false;
+
+    m_entries.push_back(Entry{ name, method, 0, 0, 0, 0 });
+    m_ops.push_back(Op{ Op::Kind::Header, m_entries.size() - 1, nullptr, std::string() });
+
+    m_inEntry = true;
+    m_entryLevel = level;
+    m_firstChunk = true;
+    m_chunk.clear();
+    m_dictionary.clear();
+    return true;
+}
+
+bool ZipWriter::Write(const void* data, size_t size)
+{
+    if (!m_inEntry || m_failed) return false;
+
+    Entry& entry = m_entries.back();
+    entry.crc = Crc32(data, size, entry.crc);
+    entry.size += size;
+
+    const char* p = static_cast<const char*>(data);
+    while (size > 0) {
+        size_t n = std::min(size, kChunkSize - m_chunk.size());
+        m_chunk.append(p, n);
+        p += n;
+        size -= n;
+        if (m_chunk.size() == kChunkSize) {
+            SubmitChunk(false);
+            if (!Drain(m_threads * kMaxQueuedChunks * kChunkSize)) return false;
+        }
+    }
+    return true;
+}
+
+bool ZipWriter::EndEntry()
+{
+    if (!m_inEntry) return false;
+    m_inEntry = false;
+
+    SubmitChunk(true);
+    m_ops.push_back(Op{ Op::Kind::End, m_entries.size() - 1, nullptr, std::string() });
+    return Drain(m_threads * kMaxQueuedChunks * kChunkSize);
+}
+
+bool ZipWriter::AddEntry(const std::string& name, const void* data, size_t size,
+                         Method method, int level)
+{
+    return BeginEntry(name, method, level) && Write(data, size) && EndEntry();
+}
+
+bool ZipWriter::CopyEntry(ZipReader& reader, size_t index, const std::string& name)
+{
+    if (!m_file || m_failed) return false;
+    if (m_inEntry && !EndEntry()) return false;
+    if (index >= reader.GetEntries().size()) return false;
+
+    const ZipReader::Entry& source = reader.GetEntries()[index];
+    if ((source.flags & kFlagEncrypted) ||
+        (source.method != static_cast<uint16_t>(Method::Store) &&
+         source.method != static_cast<uint16_t>(Method::Deflate))) {
+        return false;
+    }
+
+    std::string raw;
+    if (!reader.ReadRaw(index, raw)) return false;
+
+    m_entries.push_back(Entry{ name.empty() ? source.name : name, static_cast<Method>(source.method),
+                               source.crc, 0, source.size, 0 });
+    size_t id = m_entries.size() - 1;
+    m_ops.push_back(Op{ Op::Kind::Header, id, nullptr, std::string() });
+    m_ops.push_back(Op{ Op::Kind::Data, id, nullptr, std::move(raw) });
+    m_ops.push_back(Op{ Op::Kind::End, id, nullptr, std::string() });
+    m_copied++;
+    return Drain(m_threads * kMaxQueuedChunks * kChunkSize);
+}
+
+//=============================================================================
+// 조각 압축
+//=============================================================================
+
+void ZipWriter::SubmitChunk(bool final)
+{
+    const Entry& entry = m_entries.back();
+    size_t id = m_entries.size() - 1;
+
+    if (entry.method == Method::Store) {
+        if (!m_chunk.empty()) {
+            m_ops.push_back(Op{ Op::Kind::Data, id, nullptr, std::move(m_chunk) });
+            m_chunk = std::string();
+        }
+        return;
+    }
+
+    auto job = std::make_shared<Job>();
+    job->dictionary.swap(m_dictionary);
+    job->level = m_entryLevel;
+    job->final = final;
+    job->allowStore = final && m_firstChunk;
+    job->stored = false;
+    job->done = false;
+
+    if (!final) {
+        // 다음 조각의 사전
+        size_t keep = std::min(m_chunk.size(), kDictionarySize);
+        m_dictionary.assign(m_chunk, m_chunk.size() - keep, keep);
+    }
+    job->input.swap(m_chunk);
+    job->inputSize = job->input.size();
+    m_chunk.clear();
+    m_firstChunk = false;
+
+    m_queuedBytes += job->inputSize;
+    m_ops.push_back(Op{ Op::Kind::Data, id, job, std::string() });
+
+    if (m_workers.empty()) {
+        RunJob(*job, m_deflater);
+        job->done = true;
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(job);
+    }
+    m_jobReady.notify_one();
+}
+
+void ZipWriter::RunJob(Job& job, Deflater& deflater)
+{
+    if (deflater.GetLevel() != job.level) {
+        deflater = Deflater(job.level);
+    } else {
+        deflater.Reset();
+    }
+    deflater.SetDictionary(job.dictionary.data(), job.dictionary.size());
+
+    job.output.reserve(job.input.size() / 3 + 64);
+    deflater.Write(job.input.data(), job.input.size(), job.output);
+    if (job.final) {
+        deflater.Finish(job.output);
+    } else {
+        deflater.Flush(job.output);
+    }
+
+    if (job.allowStore && job.output.size() >= job.input.size()) {
+        // 이미 압축된 데이터 (JPEG/PNG 등)
+        job.output.swap(job.input);
+        job.stored = true;
+    }
+    std::string().swap(job.input);
+    std::string().swap(job.dictionary);
+}
+
+void ZipWriter::WorkerLoop()
+{
+    Deflater deflater(6);
+    for (;;) {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobReady.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+            if (m_jobs.empty()) return;
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        RunJob(*job, deflater);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            job->done = true;
+        }
+        m_jobDone.notify_all();
+    }
+}
+
+void ZipWriter::StopWorkers()
+{
+    if (m_workers.empty()) return;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_jobReady.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+    m_jobs.clear();
+}
+
+//=============================================================================
+// 순서대로 쓰기
+//=============================================================================
+
+bool ZipWriter::Drain(size_t maxQueued)
+{
+    while (!m_ops.empty()) {
+        Op& op = m_ops.front();
+        if (op.job && !m_workers.empty()) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (!op.job->done) {
+                // 쌓인 조각이 한도 안이면 기다리지 않고 계속 입력을 받음
+                if (m_queuedBytes <= maxQueued) return !m_failed;
+                m_jobDone.wait(lock, [&op] { return op.job->done; });
+            }
+        }
+        if (!ProcessOp(op)) return false;
+        m_ops.pop_front();
+    }
+    return !m_failed;
+}
+
+bool ZipWriter::ProcessOp(Op& op)
+{
+    Entry& entry = m_entries[op.entry];
+
+    switch (op.kind) {
+    case Op::Kind::Header: {
+        entry.offset = m_offset;
+        std::string header;
+        WriteLocalHeader(entry, header);        // CRC/크기는 End에서 채움
+        return WriteRaw(header.data(), header.size());
+    }
+
+    case Op::Kind::Data:
+        if (op.job) {
+            m_queuedBytes -= op.job->inputSize;
+            if (op.job->stored) {
+                entry.method = Method::Store;
+                m_storedFallbacks++;
+            }
+            bool ok = WriteRaw(op.job->output.data(), op.job->output.size());
+            op.job.reset();
+            return ok;
+        }
+        return WriteRaw(op.data.data(), op.data.size());
+
+    case Op::Kind::End: {
+        entry.compressedSize = m_offset - entry.offset - kLocalHeaderSize - entry.name.size();
+        if (entry.size > 0xFFFFFFFFull || m_offset > 0xFFFFFFFFull) {
+            m_failed = true;    // ZIP64 필요
+            return false;
+        }
+
+        // 로컬 헤더의 방식/CRC/크기 채우기 (아직 버퍼에 있으면 메모리에서)
+        std::string fields;
+        Put16(fields, static_cast<uint16_t>(entry.method));
+        Put16(fields, m_dosTime);
+        Put16(fields, m_dosDate);
+        Put32(fields, entry.crc);
+        Put32(fields, static_cast<uint32_t>(entry.compressedSize));
+        Put32(fields, static_cast<uint32_t>(entry.size));
+
+        uint64_t target = entry.offset + 8;
+        uint64_t bufferStart = m_offset - m_buffer.size();
+        if (target >= bufferStart) {
+            m_buffer.replace(static_cast<size_t>(target - bufferStart), fields.size(), fields);
+            return true;
+        }
+        if (fseek(m_file, static_cast<long>(target), SEEK_SET) != 0 ||
+            fwrite(fields.data(), 1, fields.size(), m_file) != fields.size() ||
+            fseek(m_file, 0, SEEK_END) != 0) {
+            m_failed = true;
+            return false;
+        }
+        return true;
+    }
+    }
+    return false;
+}
+
+//=============================================================================
+// 닫기
+//=============================================================================
+
+bool ZipWriter::Close()
+{
+    if (!m_file) return false;
+    if (m_inEntry) EndEntry();
+    bool ok = Drain(0);
+    StopWorkers();
+
+    uint64_t directoryOffset = m_offset;
+    std::string directory;
+    for (const Entry& entry : m_entries) {
+        Put32(directory, kCentralHeaderSignature);
+        Put16(directory, kVersionNeeded);       // 만든 버전 (MS-DOS)
+        Put16(directory, kVersionNeeded);
+        Put16(directory, kFlagUtf8);
+        Put16(directory, static_cast<uint16_t>(entry.method));
+        Put16(directory, m_dosTime);
+        Put16(directory, m_dosDate);
+        Put32(directory, entry.crc);
+        Put32(directory, static_cast<uint32_t>(entry.compressedSize));
+        Put32(directory, static_cast<uint32_t>(entry.size));
+        Put16(directory, static_cast<uint32_t>(entry.name.size()));
+        Put16(directory, 0);        // 추가 필드
+        Put16(directory, 0);        // 주석
+        Put16(directory, 0);        // 디스크 번호
+        Put16(directory, 0);        // 내부 속성
+        Put32(directory, 0);        // 외부 속성
+        Put32(directory, static_cast<uint32_t>(entry.offset));
+        directory += entry.name;
+    }
+
+    uint32_t directorySize = static_cast<uint32_t>(directory.size());
+    Put32(directory, kEndOfCentralSignature);
+    Put16(directory, 0);
+    Put16(directory, 0);
+    Put16(directory, static_cast<uint32_t>(m_entries.size()));
+    Put16(directory, static_cast<uint32_t>(m_entries.size()));
+    Put32(directory, directorySize);
+    Put32(directory, static_cast<uint32_t>(directoryOffset));
+    Put16(directory, 0);
+
+    ok = ok && !m_failed && m_entries.size() < 0xFFFF && WriteRaw(directory.data(), directory.size());
+    if (ok && !m_buffer.empty()) {
+        ok = fwrite(m_buffer.data(), 1, m_buffer.size(), m_file) == m_buffer.size();
+    }
+    m_buffer.clear();
+    m_ops.clear();
+    ok = (fclose(m_file) == 0) && ok;
+    m_file = nullptr;
+    return ok;
+}
+
+//=============================================================================
+// 출력
+//=============================================================================
+
+bool ZipWriter::WriteRaw(const void* data, size_t size)
+{
+    if (m_failed) return false;
+
+    // 작은 헤더와 조각을 모아서 fwrite
+    m_buffer.append(static_cast<const char*>(data), size);
+    m_offset += size;
+    if (m_buffer.size() >= kFlushSize) {
+        if (fwrite(m_buffer.data(), 1, m_buffer.size(), m_file) != m_buffer.size()) {
+            m_failed = true;
+            return false;
+        }
+        m_buffer.clear();
+    }
+    return true;
+}
+
+} // namespace cpyhwpx
@@ -0,0 +1,181 @@
+/**
+ * @file ZipWriter.h
+ * @brief ZIP 패키지 쓰기 (HWPX 컨테이너용)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#pragma once
+
+#include "Deflate.h"
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cpyhwpx {
+
+class ZipReader;
+
+/**
+ * @class ZipWriter
+ * @brief 항목을 차례로 스트리밍하는 ZIP 쓰기
+ *
+ * - 항목 이름은 UTF-8 (일반 플래그 비트 11)
+ * - BeginEntry/Write/EndEntry로 크기를 모르는 항목(섹션 XML)을 조금씩 압축해 쓰고,
+ *   끝난 뒤 로컬 헤더의 CRC/크기를 되돌아가 채운다 (데이터 설명자 없음)
+ * - 입력은 256KB 조각으로 나눠 압축 스레드에서 압축하고 (앞 조각 32KB를 사전으로,
+ *   조각 끝은 sync flush), 결과는 항목/조각 순서대로 파일에 쓴다.
+ *   서로 다른 항목도, 큰 항목 하나의 조각들도 동시에 압축된다
+ * - 조각 하나로 끝나는 항목이 압축해도 줄지 않으면 Stored로 바꿔 씀
+ * - CopyEntry()는 다른 ZIP의 항목을 풀지 않고 압축된 그대로 옮김
+ * - ZIP64는 지원하지 않음 (항목/파일 4GB 미만)
+ */
+class ZipWriter {
+public:
+    enum class Method : uint16_t {
+        Store = 0,
+        Deflate = 8,
+    };
+
+    ZipWriter();
+
+    /**
+     * @brief Close()하지 않았으면 파일만 닫음 (중앙 디렉터리가 없는 불완전한 파일)
+     */
+    ~ZipWriter();
+
+    ZipWriter(const ZipWriter&) = delete;
+    ZipWriter& operator=(const ZipWriter&) = delete;
+
+    /**
+     * @brief 압축 스레드 수 (Open 전에 설정)
+     * @param threads 0=CPU 수, 1=호출한 스레드에서 압축 (기본)
+     */
+    void SetThreads(size_t threads);
+    size_t GetThreads() const { return m_threads; }
+
+    bool Open(const std::wstring& path);
+
+    /**
+     * @brief 항목 시작 (이전 항목이 열려 있으면 먼저 닫음)
+     * @param level Deflate 압축 수준 (0~9)
+     */
+    bool BeginEntry(const std::string& name, Method method = Method::Deflate, int level = 6);
+    bool Write(const void* data, size_t size);
+    bool Write(const std::string& data) { return Write(data.data(), data.size()); }
+    bool EndEntry();
+
+    /**
+     * @brief 전체 내용을 한 번에 쓰는 항목
+     */
+    bool AddEntry(const std::string& name, const void* data, size_t size,
+                  Method method = Method::Deflate, int level = 6);
+
+    /**
+     * @brief 다른 ZIP의 항목을 압축된 그대로 복사 (풀기/다시 압축 없음)
+     * @param name 새 이름 (비우면 원래 이름)
+     * @return 읽기 실패, 암호화, Stored/Deflate 이외의 방식이면 false
+     */
+    bool CopyEntry(ZipReader& reader, size_t index, const std::string& name = std::string());
+
+    /**
+     * @brief 남은 조각을 모두 쓰고 중앙 디렉터리를 쓴 뒤 파일 닫기
+     */
+    bool Close();
+
+    bool IsOpen() const { return m_file != nullptr; }
+    size_t GetEntryCount() const { return m_entries.size(); }
+    uint64_t GetBytesWritten() const { return m_offset; }
+    uint64_t GetCopiedCount() const { return m_copied; }            // CopyEntry 항목
+    uint64_t GetStoredFallbackCount() const { return m_storedFallbacks; }
+
+private:
+    struct Entry {
+        std::string name;
+        Method method;
+        uint32_t crc;
+        uint64_t compressedSize;
+        uint64_t size;
+        uint64_t offset;
+    };
+
+    /**
+     * @brief 압축 스레드에서 처리하는 조각
+     */
+    struct Job {
+        std::string input;
+        size_t inputSize;
+        std::string dictionary;     // 앞 조각의 마지막 32KB
+        int level;
+        bool final;                 // 항목의 마지막 조각
+        bool allowStore;            // 항목 전체가 이 조각이면 Stored로 바꿀 수 있음
+        std::string output;
+        bool stored;
+        bool done;
+    };
+
+    /**
+     * @brief 파일에 쓸 순서대로 쌓인 작업
+     */
+    struct Op {
+        enum class Kind {
+            Header,     // 로컬 헤더 (CRC/크기는 End에서 채움)
+            Data,       // data 또는 job->output
+            End,        // 로컬 헤더 채우기
+        };
+        Kind kind;
+        size_t entry;
+        std::shared_ptr<Job> job;
+        std::string data;
+    };
+
+    void SubmitChunk(bool final);
+    bool Drain(size_t maxQueued);
+    bool ProcessOp(Op& op);
+    static void RunJob(Job& job, Deflater& deflater);
+    void WorkerLoop();
+    void StopWorkers();
+
+    bool WriteRaw(const void* data, size_t size);
+    void WriteLocalHeader(const Entry& entry, std::string& out) const;
+
+    FILE* m_file;
+    std::vector<Entry> m_entries;
+    bool m_inEntry;
+    bool m_failed;
+    uint64_t m_offset;
+    uint16_t m_dosTime;
+    uint16_t m_dosDate;
+
+    // 현재 항목 입력
+    int m_entryLevel;
+    bool m_firstChunk;
+    std::string m_chunk;            // 아직 조각으로 넘기지 않은 입력
+    std::string m_dictionary;       // 마지막으로 넘긴 조각의 끝 32KB
+
+    // 쓰기 순서 (호출한 스레드만 접근)
+    std::deque<Op> m_ops;
+    size_t m_queuedBytes;           // 아직 쓰지 않은 조각 입력 크기
+    std::string m_buffer;           // 모아서 fwrite
+
+    // 압축 스레드
+    size_t m_threads;
+    Deflater m_deflater;            // m_threads == 1일 때
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_jobReady;
+    std::condition_variable m_jobDone;
+    std::deque<std::shared_ptr<Job>> m_jobs;
+    bool m_stopping;
+
+    uint64_t m_copied;
+    uint64_t m_storedFallbacks;
+};
+
+} // namespace cpyhwpx
@@ -16,10 +16,435 @@
 #include "HwpAction.h"
 #include "HwpParameter.h"
 #include "FontDefs.h"
+#include "PrivateInfoScanner.h"
+#include "TextChunkReader.h"
+#include "BulkEditScope.h"
+#include "ComStats.h"
+#include "ComTrace.h"
+#include "AsyncHwp.h"
+#include "HwpInstancePool.h"
+#include "BatchConverter.h"
+#include "HwpxWriter.h"
+#include "HwpBatch.h"
 #include "Utils.h"
+#include "ComScope.h"
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+
+#if defined(CPYHWPX_PYTHON_TESTING)
+#include "FakeHwpObject.h"
+#endif
 
 namespace py = pybind11;
 
+//=============================================================================
+// BstrString → str 타입 캐스터
+//=============================================================================
+
+namespace pybind11 { namespace detail {
+
+/**
+ * @brief BSTR 버퍼와 Python str/bytes 직접 변환
+ *
+ * 반환: std::wstring을 거치지 않고 PyUnicode_DecodeUTF16으로 한 번만 변환한다.
+ * 반환 후 BstrString 임시 객체가 소멸하면서 BSTR이 곧바로 해제된다.
+ *
+ * 인자: str은 PyUnicode_AsWideChar로, bytes는 UTF-8(또는 BOM 있는 UTF-16LE)로
+ * 최종 BSTR에 바로 기록한다 (SysAllocStringLen 1회).
+ * BOM 뒤 길이가 홀수인 UTF-16LE bytes와 잘못된 UTF-8 bytes는 UnicodeDecodeError.
+ */
+template <> struct type_caster<cpyhwpx::BstrString> {
+public:
+    PYBIND11_TYPE_CASTER(cpyhwpx::BstrString, const_name("str"));
+
+    bool load(handle src, bool)
+    {
+        if (!src) return false;
+
+        if (PyUnicode_Check(src.ptr())) {
+            PyObject* obj = src.ptr();
+            if (PyUnicode_KIND(obj) == PyUnicode_1BYTE_KIND) {
+                value = cpyhwpx::BstrString::FromLatin1(
+                    static_cast<const unsigned char*>(PyUnicode_DATA(obj)),
+                    static_cast<size_t>(PyUnicode_GET_LENGTH(obj)));
+                return value.bstr() != nullptr;
+            }
+            // UCS2/UCS4 → UTF-16 (서로게이트 쌍 포함) 길이 계산 후 한 번에 기록
+            Py_ssize_t needed = PyUnicode_AsWideChar(obj, nullptr, 0);
+            if (needed <= 0) {
+                PyErr_Clear();
+                return false;
+            }
+            BSTR bstr = SysAllocStringLen(nullptr, static_cast<UINT>(needed - 1));
+            if (!bstr) return false;
+            PyUnicode_AsWideChar(obj, bstr, needed - 1);
+            value = cpyhwpx::BstrString(bstr);
+            return true;
+        }
+
+        if (PyBytes_Check(src.ptr())) {
+            const char* data = PyBytes_AS_STRING(src.ptr());
+            size_t len = static_cast<size_t>(PyBytes_GET_SIZE(src.ptr()));
+            // UTF-16LE BOM (FF FE)
+            if (len >= 2 && static_cast<unsigned char>(data[0]) == 0xFF &&
+                static_cast<unsigned char>(data[1]) == 0xFE) {
+                // 마지막 1바이트가 남으면 잘린 코드 단위: 버리지 않고 UnicodeDecodeError
+                if ((len - 2) % sizeof(wchar_t) != 0) {
+                    PyObject* exc = PyUnicodeDecodeError_Create(
+                        "utf-16-le", data, static_cast<Py_ssize_t>(len),
+                        static_cast<Py_ssize_t>(len - 1), static_cast<Py_ssize_t>(len),
+                        "truncated data");
+                    if (exc) {
+                        PyErr_SetObject(PyExc_UnicodeDecodeError, exc);
+                        Py_DECREF(exc);
+                    }
+                    throw error_already_set();
+                }
+                value = cpyhwpx::BstrString::FromUtf16(
+                    reinterpret_cast<const wchar_t*>(data + 2), (len - 2) / sizeof(wchar_t));
+            } else {
+                value = cpyhwpx::BstrString::FromUtf8(data, len);
+                // 잘못된 UTF-8은 U+FFFD로 바꿔 넘기지 않고 UnicodeDecodeError
+                if (!value.bstr()) {
+                    PyObject* exc = PyUnicodeDecodeError_Create(
+                        "utf-8", data, static_cast<Py_ssize_t>(len),
+                        0, static_cast<Py_ssize_t>(len), "invalid utf-8");
+                    if (exc) {
+                        PyErr_SetObject(PyExc_UnicodeDecodeError, exc);
+                        Py_DECREF(exc);
+                    }
+                    throw error_already_set();
+                }
+            }
+            return value.bstr() != nullptr;
+        }
+
+        return false;
+    }
+
+    static handle cast(const cpyhwpx::BstrString& src, return_value_policy, handle)
+    {
+        size_t len = src.size();
+        if (len == 0) {
+            return PyUnicode_FromStringAndSize("", 0);
+        }
+        int byteorder = -1;  // little endian (Windows UTF-16LE)
+        PyObject* obj = PyUnicode_DecodeUTF16(reinterpret_cast<const char*>(src.data()),
+                                              static_cast<ssize_t>(len * sizeof(wchar_t)),
+                                              "surrogatepass", &byteorder);
+        if (!obj) {
+            throw error_already_set();
+        }
+        return obj;
+    }
+};
+
+}} // namespace pybind11::detail
+
+namespace {
+
+//=============================================================================
+// 파라미터셋 항목 ↔ Python 값
+//=============================================================================
+
+/**
+ * @brief ToSetItems 결과 (items의 문자열 VARIANT는 strings의 BSTR을 빌림)
+ */
+struct SetItemValues {
+    std::vector<std::pair<std::wstring, VARIANT>> items;
+    std::deque<cpyhwpx::ScopedVariant> strings;     // 소멸 시 해제 (변환 중 예외에도)
+};
+
+/**
+ * @brief dict {이름: bool/int/float/str} → (이름, VARIANT) 목록
+ *
+ * 정수는 VT_I4 범위(-2^31 ~ 2^31-1)를 벗어나면 OverflowError.
+ */
+SetItemValues ToSetItems(const py::dict& items)
+{
+    SetItemValues result;
+    result.items.reserve(items.size());
+    for (const auto& kv : items) {
+        std::wstring name = kv.first.cast<std::wstring>();
+        VARIANT var;
+        VariantInit(&var);
+        py::handle value = kv.second;
+        if (py::isinstance<py::bool_>(value)) {
+            var.vt = VT_BOOL;
+            var.boolVal = value.cast<bool>() ? VARIANT_TRUE : VARIANT_FALSE;
+        } else if (py::isinstance<py::int_>(value)) {
+            long long number = PyLong_AsLongLong(value.ptr());
+            if ((number == -1 && PyErr_Occurred()) ||
+                number < std::numeric_limits<int32_t>::min() || number > std::numeric_limits<int32_t>::max()) {
+                PyErr_Clear();
+                throw std::overflow_error("파라미터 " + py::str(kv.first).cast<std::string>() +
+                                          "의 정수 값이 32비트 범위를 벗어났습니다");
+            }
+            var.vt = VT_I4;
+            var.lVal = static_cast<LONG>(number);
+        } else if (py::isinstance<py::float_>(value)) {
+            var.vt = VT_R8;
+            var.dblVal = value.cast<double>();
+        } else if (py::isinstance<py::str>(value)) {
+            std::wstring str = value.cast<std::wstring>();
+            VARIANT owned;
+            VariantInit(&owned);
+            owned.vt = VT_BSTR;
+            owned.bstrVal = SysAllocStringLen(str.c_str(), static_cast<UINT>(str.size()));
+            result.strings.emplace_back(owned);
+            var = result.strings.back().get();
+        } else {
+            throw py::type_error("파라미터 값은 bool, int, float, str만 지원합니다");
+        }
+        result.items.emplace_back(std::move(name), var);
+    }
+    return result;
+}
+
+/**
+ * @brief VARIANT → Python 값 (정수/실수/불리언/문자열, 그 외 None). VARIANT는 해제됨
+ */
+py::object FromSetItem(VARIANT& value)
+{
+    py::object result;
+    switch (value.vt) {
+    case VT_I4:   result = py::int_(value.lVal); break;
+    case VT_INT:  result = py::int_(value.intVal); break;
+    case VT_I2:   result = py::int_(value.iVal); break;
+    case VT_I1:   result = py::int_(value.cVal); break;
+    case VT_UI1:  result = py::int_(value.bVal); break;
+    case VT_UI2:  result = py::int_(value.uiVal); break;
+    case VT_UI4:  result = py::int_(value.ulVal); break;
+    case VT_R4:   result = py::float_(value.fltVal); break;
+    case VT_R8:   result = py::float_(value.dblVal); break;
+    case VT_BOOL: result = py::bool_(value.boolVal != VARIANT_FALSE); break;
+    case VT_BSTR:
+        result = py::cast(value.bstrVal
+            ? std::wstring(value.bstrVal, SysStringLen(value.bstrVal)) : std::wstring());
+        break;
+    default:
+        result = py::none();
+        break;
+    }
+    VariantClear(&value);
+    return result;
+}
+
+//=============================================================================
+// AsyncHwp ↔ Python 작업
+//=============================================================================
+
+/**
+ * @brief AsyncHwp 실행 스레드에서 돌릴 Python 호출
+ *
+ * method가 None이면 fn(hwp, *args, **kwargs), 아니면 hwp.<method>(*args, **kwargs).
+ * 결과는 concurrent.futures.Future로 전달한다 (asyncio.wrap_future로 await 가능).
+ */
+struct PyAsyncTask {
+    py::object fn;
+    py::object method;
+    py::tuple args;
+    py::dict kwargs;
+    py::object future;
+};
+
+/**
+ * @brief PyAsyncTask 생성 (해제 시 GIL 획득)
+ *
+ * 실행 스레드에서 마지막 참조가 사라질 수 있으므로 Python 객체는 GIL을 잡고 놓는다.
+ * 종료로 실행되지 못한 작업은 future에 RuntimeError를 설정한다.
+ */
+std::shared_ptr<PyAsyncTask> MakePyAsyncTask(py::object fn, py::object method,
+                                             py::args args, py::kwargs kwargs)
+{
+    auto* task = new PyAsyncTask{
+        std::move(fn), std::move(method), py::tuple(std::move(args)), py::dict(std::move(kwargs)),
+        py::module_::import("concurrent.futures").attr("Future")()
+    };
+    return std::shared_ptr<PyAsyncTask>(task, [](PyAsyncTask* t) {
+        py::gil_scoped_acquire gil;
+        if (!t->future.attr("done")().cast<bool>()) {
+            t->future.attr("set_exception")(
+                py::module_::import("builtins").attr("RuntimeError")(
+                    "AsyncHwp가 종료되어 작업이 실행되지 않았습니다"));
+        }
+        delete t;
+    });
+}
+
+/**
+ * @brief cpyhwpx.HwpTimeoutError (모듈 초기화 시 등록, 모듈이 참조를 유지)
+ */
+PyObject* g_hwpTimeoutError = nullptr;
+
+py::object MakePyTimeoutError()
+{
+    return py::reinterpret_borrow<py::object>(g_hwpTimeoutError)("HWP call timed out");
+}
+
+/**
+ * @brief 마감 시각에 future를 HwpTimeoutError로 끝내는 콜백 (워치독 스레드에서 불림)
+ *
+ * Hwp 메서드는 COM 호출 중 GIL을 놓으므로 멈춘 호출이 있어도 마감 시각에 설정된다.
+ * submit()의 Python 코드는 GIL을 쥔 채 멈출 수 있으므로 워치독은 GIL을 기다리지 않고
+ * 별도 스레드에서 설정한다 (워치독이 막히면 한/글 종료도 못 함).
+ */
+std::function<void()> MakePyTimeoutCallback(std::shared_ptr<PyAsyncTask> task)
+{
+    return [task]() {
+        std::thread([task]() {
+            py::gil_scoped_acquire gil;
+            if (!task->future.attr("done")().cast<bool>()) {
+                task->future.attr("set_exception")(MakePyTimeoutError());
+            }
+        }).detach();
+    };
+}
+
+/**
+ * @brief 제한 시간을 넘긴 작업은 결과 대신 HwpTimeoutError를 설정
+ */
+void RunPyAsyncTask(PyAsyncTask& task, cpyhwpx::HwpWrapper& hwp, const cpyhwpx::AsyncHwp& owner)
+{
+    py::gil_scoped_acquire gil;
+    // 취소된 future는 실행하지 않음
+    if (!task.future.attr("set_running_or_notify_cancel")().cast<bool>()) {
+        return;
+    }
+    // 이미 시간 초과로 끝났으면 (MakePyTimeoutCallback) 결과는 버림
+    auto settled = [&task]() { return task.future.attr("done")().cast<bool>(); };
+    try {
+        py::object self = py::cast(&hwp, py::return_value_policy::reference);
+        py::object result;
+        if (task.method.is_none()) {
+            result = task.fn(self, *task.args, **task.kwargs);
+        } else {
+            result = self.attr(task.method)(*task.args, **task.kwargs);
+        }
+        if (settled()) return;
+        if (owner.IsCallTimedOut()) {
+            task.future.attr("set_exception")(MakePyTimeoutError());
+        } else {
+            task.future.attr("set_result")(result);
+        }
+    } catch (py::error_already_set& e) {
+        if (settled()) return;
+        task.future.attr("set_exception")(owner.IsCallTimedOut() ? MakePyTimeoutError() : e.value());
+    } catch (const std::exception& e) {
+        if (settled()) return;
+        task.future.attr("set_exception")(owner.IsCallTimedOut() ? MakePyTimeoutError() :
+            py::module_::import("builtins").attr("RuntimeError")(e.what()));
+    }
+}
+
+/**
+ * @param timeout_ms 제한 시간 (음수면 AsyncHwp의 call_timeout_ms, 0이면 제한 없음)
+ */
+py::object SubmitPyAsyncTask(cpyhwpx::AsyncHwp& self, std::shared_ptr<PyAsyncTask> task,
+                             int64_t timeout_ms = -1)
+{
+    py::object future = task->future;
+    cpyhwpx::AsyncHwp* owner = &self;
+    auto fn = [task, owner](cpyhwpx::HwpWrapper& hwp) { RunPyAsyncTask(*task, hwp, *owner); };
+    self.Post(fn, std::chrono::milliseconds(timeout_ms), MakePyTimeoutCallback(task));
+    return future;
+}
+
+/**
+ * @brief 작업 묶음 제출 (묶음 실행 중에는 GIL을 잡지 않음)
+ */
+py::object SubmitPyBatch(cpyhwpx::AsyncHwp& self, const cpyhwpx::HwpBatch& batch, bool stop_on_error)
+{
+    auto task = MakePyAsyncTask(py::none(), py::none(), py::args(), py::kwargs());
+    auto snapshot = std::make_shared<const cpyhwpx::HwpBatch>(batch);
+    py::object future = task->future;
+    cpyhwpx::AsyncHwp* owner = &self;
+    self.Post([task, snapshot, stop_on_error, owner](cpyhwpx::HwpWrapper& hwp) {
+        {
+            py::gil_scoped_acquire gil;
+            if (!task->future.attr("set_running_or_notify_cancel")().cast<bool>()) {
+                return;
+            }
+        }
+        std::vector<bool> results = snapshot->Execute(hwp, stop_on_error);
+        py::gil_scoped_acquire gil;
+        if (task->future.attr("done")().cast<bool>()) return;
+        if (owner->IsCallTimedOut()) {
+            task->future.attr("set_exception")(MakePyTimeoutError());
+        } else {
+            task->future.attr("set_result")(py::cast(results));
+        }
+    }, std::chrono::milliseconds(-1), MakePyTimeoutCallback(task));
+    return future;
+}
+
+/**
+ * @brief Python 쪽 해제 시 GIL을 놓고 실행 스레드 종료를 기다림
+ *
+ * 남은 Python 작업이 GIL을 잡아야 끝날 수 있으므로 GIL을 쥔 채 join하면 교착된다.
+ */
+struct AsyncHwpDeleter {
+    void operator()(cpyhwpx::AsyncHwp* p) const
+    {
+        py::gil_scoped_release release;
+        delete p;
+    }
+};
+
+/**
+ * @brief 인스턴스 풀/Lease 해제도 실행 스레드 종료를 기다릴 수 있으므로 GIL을 놓음
+ */
+struct HwpInstancePoolDeleter {
+    void operator()(cpyhwpx::HwpInstancePool* p) const
+    {
+        py::gil_scoped_release release;
+        delete p;
+    }
+};
+
+struct HwpLeaseDeleter {
+    void operator()(cpyhwpx::HwpInstancePool::Lease* p) const
+    {
+        py::gil_scoped_release release;
+        delete p;
+    }
+};
+
+using HwpLeaseHolder = std::unique_ptr<cpyhwpx::HwpInstancePool::Lease, HwpLeaseDeleter>;
+
+/**
+ * @brief 빌린 AsyncHwp (반환된 Lease면 RuntimeError)
+ *
+ * 반환된 인스턴스는 풀에서 다른 호출자에게 가거나 종료되므로
+ * Python 쪽에는 AsyncHwp 포인터를 넘기지 않고 호출할 때마다 Lease를 거친다.
+ */
+cpyhwpx::AsyncHwp& LeasedHwp(const cpyhwpx::HwpInstancePool::Lease& lease)
+{
+    if (!lease) throw std::runtime_error("HwpLease has been released");
+    return *lease.get();
+}
+
+#if defined(CPYHWPX_PYTHON_TESTING)
+/**
+ * @brief 테스트용 가짜 한/글 (AsyncHwp 설정 함수와 참조를 나눠 가짐)
+ */
+struct FakeHwpHandle {
+    std::shared_ptr<cpyhwpx::bench::FakeHwpObject> fake;
+};
+#endif
+
+struct BatchConverterDeleter {
+    void operator()(cpyhwpx::BatchConverter* p) const
+    {
+        py::gil_scoped_release release;
+        delete p;
+    }
+};
+
+} // namespace
+
 PYBIND11_MODULE(cpyhwpx, m) {
     m.doc() = "cpyhwpx - C++ HWP Automation Library (pyhwpx C++ port)";
 
@@ -155,6 +580,7 @@ PYBIND11_MODULE(cpyhwpx, m) {
     // HwpWrapper 클래스 바인딩 (메인 클래스 - Hwp)
     //=========================================================================
 
+    // COM을 호출하는 메서드는 GIL을 놓는다 (AsyncHwp 실행 스레드가 이벤트 루프/다른 스레드를 막지 않도록)
     py::class_<cpyhwpx::HwpWrapper>(m, "Hwp")
         .def(py::init<bool, bool, bool>(),
              py::arg("visible") = true,
@@ -177,6 +603,7 @@ Examples:
 
         // 초기화/종료
         .def("initialize", &cpyhwpx::HwpWrapper::Initialize,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 HWP COM 객체를 초기화합니다.
 
@@ -184,6 +611,7 @@ HWP COM 객체를 초기화합니다.
 )doc")
         .def("register_module", &cpyhwpx::HwpWrapper::RegisterModule,
              py::arg("module_type"), py::arg("module_data"),
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 보안 모듈을 등록합니다.
 
@@ -208,10 +636,12 @@ Args:
         .def("auto_register_module", &cpyhwpx::HwpWrapper::AutoRegisterModule,
              py::arg("module_type") = L"FilePathCheckDLL",
              py::arg("module_data") = L"FilePathCheckerModule",
+             py::call_guard<py::gil_scoped_release>(),
              "보안 모듈 자동 등록 (레지스트리 확인/등록 + COM API)")
 
         .def("quit", &cpyhwpx::HwpWrapper::Quit,
              py::arg("save") = false,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 한/글 프로그램을 종료합니다.
 
@@ -223,6 +653,7 @@ Examples:
     >>> hwp.quit(save=True)  # 변경사항 저장 후 종료
 )doc")
         .def("is_initialized", &cpyhwpx::HwpWrapper::IsInitialized,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 HWP COM 객체가 초기화되었는지 확인합니다.
 
@@ -235,6 +666,7 @@ Returns:
              py::arg("filename"),
              py::arg("format") = L"",
              py::arg("arg") = L"",
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 문서를 연다.
 
@@ -267,6 +699,7 @@ Examples:
 )doc")
         .def("save", &cpyhwpx::HwpWrapper::Save,
              py::arg("save_if_dirty") = true,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 편집중인 문서를 저장한다.
 
@@ -286,6 +719,7 @@ Examples:
              py::arg("filename"),
              py::arg("format") = L"HWP",
              py::arg("arg") = L"",
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 편집중인 문서를 지정한 이름으로 저장한다.
 
@@ -312,6 +746,7 @@ Examples:
 )doc")
         .def("clear", &cpyhwpx::HwpWrapper::Clear,
              py::arg("option") = 1,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 편집중인 문서의 내용을 닫고 빈문서 편집 상태로 돌아간다.
 
@@ -328,6 +763,7 @@ Examples:
 )doc")
         .def("close", &cpyhwpx::HwpWrapper::Close,
              py::arg("is_dirty") = false,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 문서를 닫는다.
 
@@ -346,6 +782,7 @@ Returns:
              py::arg("keep_parashape") = 1,
              py::arg("keep_style") = 1,
              py::arg("move_doc_end") = false,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 커서 위치에 외부 문서 파일을 삽입한다.
 
@@ -364,9 +801,10 @@ Examples:
     >>> hwp.insert_file("C:/문서/template.hwp")
     >>> hwp.insert_file("내용.hwp", keep_charshape=0)  # 현재 문서 글자모양 적용
 )doc")
-        .def("get_text_file", &cpyhwpx::HwpWrapper::GetTextFile,
+        .def("get_text_file", &cpyhwpx::HwpWrapper::GetTextFileBstr,
              py::arg("format") = L"UNICODE",
              py::arg("option") = L"",
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 열린 문서 전체 또는 선택한 범위를 문자열로 리턴한다.
 
@@ -389,15 +827,50 @@ Examples:
     >>> text = hwp.get_text_file(format="HWPML2X")  # HWPML 형식
     >>> text = hwp.get_text_file(option="saveblock:true")  # 선택 블록만
 )doc")
-        .def("set_text_file", &cpyhwpx::HwpWrapper::SetTextFile,
+        .def("get_text_file_chunks", [](cpyhwpx::HwpWrapper& self,
+                                         const std::wstring& format, int chunk_paras,
+                                         size_t max_chunk_bytes) {
+                 return std::make_unique<cpyhwpx::TextChunkReader>(&self, format, chunk_paras,
+                                                                   max_chunk_bytes);
+             },
+             py::arg("format") = L"UNICODE",
+             py::arg("chunk_paras") = 100,
+             py::arg("max_chunk_bytes") = 0,
+             py::keep_alive<0, 1>(),
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+문서를 문단 블록 단위로 나누어 추출하는 제너레이터를 반환합니다.
+
+문단 chunk_paras개씩 블록 선택 후 "saveblock:true"로 get_text_file을 호출하므로
+한 번에 하나의 청크만 메모리에 올라갑니다. 32비트 모듈에서 수천 쪽 문서를
+get_text_file로 한 번에 추출할 때의 메모리 부족을 피할 수 있습니다.
+반복이 끝나거나 close()를 호출하면 원래 캐럿 위치로 복원합니다.
+
+Args:
+    format: get_text_file 형식. 기본값은 "UNICODE"
+        - HWPML2X/HTML은 청크마다 완결된 문서로 반환
+    chunk_paras: 청크당 최대 문단 수. 기본값은 100
+    max_chunk_bytes: 청크당 최대 바이트 (UTF-16 기준). 기본값 0은 제한 없음
+        - 블록이 한도를 넘으면 문단 수를 줄여 다시 추출 (문단 하나가 넘으면 그대로 반환)
+
+Examples:
+    >>> for chunk in hwp.get_text_file_chunks("UNICODE", 200):
+    ...     out.write(chunk)
+    >>> for chunk in hwp.get_text_file_chunks("HWPML2X", 500, max_chunk_bytes=16 << 20):
+    ...     out.write(chunk)
+)doc")
+        .def("set_text_file", &cpyhwpx::HwpWrapper::SetTextFileBstr,
              py::arg("data"),
              py::arg("format") = L"HWPML2X",
              py::arg("option") = L"insertfile",
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 GetTextFile로 저장한 문자열 정보를 문서에 삽입한다.
 
 Args:
-    data: 삽입할 문자열 데이터
+    data: 삽입할 문자열 데이터. str 또는 bytes (UTF-8, BOM 있는 UTF-16LE)
+        - 중간 복사 없이 BSTR로 바로 변환됨
+        - UTF-16LE 바이트 수가 홀수면 UnicodeDecodeError
     format: 파일 형식 (기본값: "HWPML2X")
         - "HWP": HWP native format, BASE64 인코딩
         - "HWPML2X": HWP 형식과 호환
@@ -413,29 +886,142 @@ Examples:
     >>> content = hwp.get_text_file(format="HWPML2X")
     >>> hwp.set_text_file(content, format="HWPML2X")
 )doc")
+        .def("open_template", &cpyhwpx::HwpWrapper::OpenTemplate,
+             py::arg("filename"),
+             py::arg("format") = L"HWP",
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+서식 문서로 새 문서를 시작한다. 파일은 처음 한 번만 연다.
+
+처음 호출 때는 파일을 열고 GetTextFile(format) 결과를 메모리에 보관한다.
+이후 호출은 현재 문서를 비우고 보관한 내용을 SetTextFile로 채우므로
+파일 열기와 해석 비용이 없다. 캐시는 바이트 한도 LRU (기본 64MB).
+서식 파일의 크기나 수정 시각이 바뀌었으면 다시 열어 새로 보관한다.
+
+Args:
+    filename: 서식 파일 경로 (.hwt/.hwp/.hwpx)
+    format: 보관 형식 ("HWP"=BASE64, "HWPML2X")
+
+Returns:
+    성공하면 True
+
+Examples:
+    >>> for record in records:
+    ...     hwp.open_template("C:/form.hwt")
+    ...     hwp.put_field_text("name", record["name"])
+    ...     hwp.save_as(f"C:/out/{record['id']}.hwp")
+)doc")
+        .def("evict_template", &cpyhwpx::HwpWrapper::EvictTemplate,
+             py::arg("filename"),
+             py::arg("format") = L"HWP",
+             py::call_guard<py::gil_scoped_release>(),
+             "서식 캐시에서 빼기")
+        .def("set_template_cache_limit", &cpyhwpx::HwpWrapper::SetTemplateCacheLimit,
+             py::arg("max_bytes"),
+             py::call_guard<py::gil_scoped_release>(),
+             "서식 캐시 바이트 한도 (기본 64MB, 0이면 캐시 사용 안 함)")
+        .def("clear_template_cache", &cpyhwpx::HwpWrapper::ClearTemplateCache,
+             py::call_guard<py::gil_scoped_release>(),
+             "서식 캐시 비우기")
+        .def_property_readonly("template_cache_stats", [](const cpyhwpx::HwpWrapper& self) {
+                 const cpyhwpx::TemplateCache& cache = self.GetTemplateCache();
+                 py::dict stats;
+                 stats["max_bytes"] = cache.GetMaxBytes();
+                 stats["bytes"] = cache.GetBytes();
+                 stats["count"] = cache.GetCount();
+                 stats["hits"] = cache.GetHitCount();
+                 stats["misses"] = cache.GetMissCount();
+                 stats["evictions"] = cache.GetEvictionCount();
+                 stats["stale"] = cache.GetStaleCount();
+                 return stats;
+             },
+             "서식 캐시 상태 (max_bytes, bytes, count, hits, misses, evictions, stale)")
+        .def("checkpoint", &cpyhwpx::HwpWrapper::Checkpoint,
+             py::arg("format") = L"HWP",
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+현재 문서를 메모리에 스냅샷한다.
+
+"HWP" 형식(BASE64)은 디코딩한 바이트로 보관해 메모리를 줄인다.
+스냅샷은 바이트/개수 한도 LRU로 관리된다 (기본 256MB, 16개).
+
+Args:
+    format: GetTextFile 형식 (기본값: "HWP")
+
+Returns:
+    restore()에 넘길 토큰 (실패하면 0)
+
+Examples:
+    >>> token = hwp.checkpoint()
+    >>> try:
+    ...     run_steps(hwp)
+    ... except Exception:
+    ...     hwp.restore(token)
+)doc")
+        .def("restore", &cpyhwpx::HwpWrapper::Restore,
+             py::arg("token"),
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+스냅샷으로 문서를 되돌린다 (문서 전체 교체 후 캐럿 위치 복원).
+
+Args:
+    token: checkpoint() 결과 (복원 후에도 다시 쓸 수 있음)
+
+Returns:
+    성공하면 True (없는 토큰이거나 checkpoint() 뒤에 다른 문서로 전환했으면 False)
+)doc")
+        .def("drop_checkpoint", &cpyhwpx::HwpWrapper::DropCheckpoint,
+             py::arg("token"),
+             py::call_guard<py::gil_scoped_release>(),
+             "스냅샷 삭제")
+        .def("set_checkpoint_limits", &cpyhwpx::HwpWrapper::SetCheckpointLimits,
+             py::arg("max_bytes"),
+             py::arg("max_count"),
+             py::call_guard<py::gil_scoped_release>(),
+             "체크포인트 한도 (기본 256MB, 16개, 0이면 사용 안 함)")
+        .def("clear_checkpoints", &cpyhwpx::HwpWrapper::ClearCheckpoints,
+             py::call_guard<py::gil_scoped_release>(),
+             "모든 스냅샷 삭제")
+        .def_property_readonly("checkpoint_stats", [](const cpyhwpx::HwpWrapper& self) {
+                 const cpyhwpx::CheckpointStore& store = self.GetCheckpointStore();
+                 py::dict stats;
+                 stats["max_bytes"] = store.GetMaxBytes();
+                 stats["max_count"] = store.GetMaxCount();
+                 stats["bytes"] = store.GetBytes();
+                 stats["count"] = store.GetCount();
+                 stats["evictions"] = store.GetEvictionCount();
+                 return stats;
+             },
+             "체크포인트 상태 (max_bytes, max_count, bytes, count, evictions)")
         .def("open_pdf", &cpyhwpx::HwpWrapper::OpenPdf,
              py::arg("pdf_path"),
              py::arg("this_window") = 1,
+             py::call_guard<py::gil_scoped_release>(),
              "PDF 파일 열기 (this_window: 1=현재창, 0=새창)")
         .def("save_block_as", &cpyhwpx::HwpWrapper::SaveBlockAs,
              py::arg("path"),
              py::arg("format") = L"HWP",
              py::arg("attributes") = 1,
+             py::call_guard<py::gil_scoped_release>(),
              "선택 블록을 파일로 저장")
         .def("get_file_info", &cpyhwpx::HwpWrapper::GetFileInfo,
              py::arg("filename"),
+             py::call_guard<py::gil_scoped_release>(),
              "파일 정보 조회 (Format, VersionStr, VersionNum, Encrypted)")
 
         // 파일 I/O 확장
         .def("export_style", &cpyhwpx::HwpWrapper::ExportStyle,
              py::arg("sty_filepath"),
+             py::call_guard<py::gil_scoped_release>(),
              "스타일 내보내기 (.sty 파일)")
         .def("import_style", &cpyhwpx::HwpWrapper::ImportStyle,
              py::arg("sty_filepath"),
+             py::call_guard<py::gil_scoped_release>(),
              "스타일 가져오기 (.sty 파일)")
         .def("lock_command", &cpyhwpx::HwpWrapper::LockCommand,
              py::arg("act_id"),
              py::arg("is_lock"),
+             py::call_guard<py::gil_scoped_release>(),
              "명령 잠금/해제 (예: 'Undo', 'Redo')")
         .def("create_page_image", &cpyhwpx::HwpWrapper::CreatePageImage,
              py::arg("path"),
@@ -443,20 +1029,24 @@ Examples:
              py::arg("resolution") = 300,
              py::arg("depth") = 24,
              py::arg("format") = L"bmp",
+             py::call_guard<py::gil_scoped_release>(),
              "페이지 이미지 생성 (pgno: 0=현재, 1~n=해당 페이지)")
         .def("print_document", &cpyhwpx::HwpWrapper::PrintDocument,
+             py::call_guard<py::gil_scoped_release>(),
              "문서 인쇄 다이얼로그")
         .def("mail_merge", &cpyhwpx::HwpWrapper::MailMerge,
+             py::call_guard<py::gil_scoped_release>(),
              "메일 머지 실행")
 
         // 텍스트 편집
-        .def("insert_text", &cpyhwpx::HwpWrapper::InsertText,
+        .def("insert_text", &cpyhwpx::HwpWrapper::InsertTextBstr,
              py::arg("text"),
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 한/글 문서 내 캐럿 위치에 문자열을 삽입한다.
 
 Args:
-    text: 삽입할 문자열
+    text: 삽입할 문자열. str 또는 UTF-8 bytes
 
 Returns:
     삽입 성공 시 True, 실패 시 False
@@ -465,7 +1055,8 @@ Examples:
     >>> hwp.insert_text("Hello world!")
     >>> hwp.insert_text("줄바꿈\n다음 줄")
 )doc")
-        .def("get_text", &cpyhwpx::HwpWrapper::GetText,
+        .def("get_text", &cpyhwpx::HwpWrapper::GetTextBstr,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 문서 내에서 텍스트를 얻어온다.
 
@@ -494,6 +1085,7 @@ Examples:
 )doc")
         .def("get_selected_text", &cpyhwpx::HwpWrapper::GetSelectedText,
              py::arg("keep_select") = false,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 한/글 문서 선택 구간의 텍스트를 리턴한다.
 
@@ -508,6 +1100,7 @@ Returns:
 
         // 위치 관리
         .def("get_pos", &cpyhwpx::HwpWrapper::GetPos,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 캐럿의 위치를 얻어온다.
 
@@ -523,6 +1116,7 @@ Examples:
 )doc")
         .def("set_pos", &cpyhwpx::HwpWrapper::SetPos,
              py::arg("list"), py::arg("para"), py::arg("pos"),
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 캐럿을 문서 내 특정 위치로 옮긴다.
 
@@ -540,6 +1134,7 @@ Examples:
 )doc")
         .def("move_pos", &cpyhwpx::HwpWrapper::MovePos,
              py::arg("move_id"), py::arg("para") = 0, py::arg("pos") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 캐럿의 위치를 옮긴다.
 
@@ -586,6 +1181,7 @@ Examples:
              py::arg("option") = 0x07, py::arg("range") = 0x77,
              py::arg("spara") = 0, py::arg("spos") = 0,
              py::arg("epara") = -1, py::arg("epos") = -1,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 문서의 내용을 검색하기 위해 초기설정을 한다.
 
@@ -620,6 +1216,7 @@ Examples:
     >>> hwp.init_scan(range=0xFF)  # 선택 블록만 스캔
 )doc")
         .def("release_scan", &cpyhwpx::HwpWrapper::ReleaseScan,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 init_scan()으로 설정된 초기화 정보를 해제한다.
 
@@ -629,6 +1226,7 @@ init_scan()으로 설정된 초기화 정보를 해제한다.
              py::arg("spara"), py::arg("spos"),
              py::arg("epara"), py::arg("epos"),
              py::arg("slist") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 특정 범위의 텍스트를 블록 선택한다.
 
@@ -650,6 +1248,7 @@ Examples:
 )doc")
         .def("select_text_by_get_pos", &cpyhwpx::HwpWrapper::SelectTextByGetPos,
              py::arg("s_pos"), py::arg("e_pos"),
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 get_pos()로 얻은 튜플을 사용하여 텍스트를 선택한다.
 
@@ -667,6 +1266,7 @@ Examples:
     >>> hwp.select_text_by_get_pos(start, end)
 )doc")
         .def("get_pos_by_set", &cpyhwpx::HwpWrapper::GetPosBySetPy,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 캐럿 위치를 내부 캐시에 저장하고 인덱스를 반환한다.
 
@@ -680,6 +1280,7 @@ Examples:
 )doc")
         .def("set_pos_by_set", &cpyhwpx::HwpWrapper::SetPosBySetPy,
              py::arg("idx"),
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 get_pos_by_set()으로 저장한 위치로 캐럿을 이동한다.
 
@@ -690,6 +1291,7 @@ Returns:
     성공하면 True, 실패하면 False
 )doc")
         .def("clear_pos_cache", &cpyhwpx::HwpWrapper::ClearPosCache,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 get_pos_by_set()으로 저장한 모든 위치 정보를 삭제한다.
 
@@ -699,34 +1301,73 @@ get_pos_by_set()으로 저장한 모든 위치 정보를 삭제한다.
         // 창/UI 관리
         .def("set_visible", &cpyhwpx::HwpWrapper::SetVisible,
              py::arg("visible"),
+             py::call_guard<py::gil_scoped_release>(),
              "창 표시/숨김")
         .def("maximize_window", &cpyhwpx::HwpWrapper::MaximizeWindow,
+             py::call_guard<py::gil_scoped_release>(),
              "창 최대화")
         .def("minimize_window", &cpyhwpx::HwpWrapper::MinimizeWindow,
+             py::call_guard<py::gil_scoped_release>(),
              "창 최소화")
         .def("set_viewstate", &cpyhwpx::HwpWrapper::SetViewState,
              py::arg("flag"),
+             py::call_guard<py::gil_scoped_release>(),
              "뷰 상태 설정 (0=조판부호, 1=쪽머리메모, 2=그림, 3=숨긴글, 4=쪽맞춤, 5=문단부호, 6=줄표시)")
         .def("get_viewstate", &cpyhwpx::HwpWrapper::GetViewState,
+             py::call_guard<py::gil_scoped_release>(),
              "뷰 상태 가져오기")
         .def("msgbox", &cpyhwpx::HwpWrapper::MsgBox,
              py::arg("message"),
              py::arg("flag") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              "메시지 박스 표시 (flag: MB_* 상수)")
         .def("get_message_box_mode", &cpyhwpx::HwpWrapper::GetMessageBoxMode,
+             py::call_guard<py::gil_scoped_release>(),
              "메시지 박스 모드 가져오기")
         .def("set_message_box_mode", &cpyhwpx::HwpWrapper::SetMessageBoxMode,
              py::arg("mode"),
+             py::call_guard<py::gil_scoped_release>(),
              "메시지 박스 모드 설정 (0=다이얼로그, 1=확인무시, 2=오류반환)")
+        .def("bulk_edit", [](cpyhwpx::HwpWrapper& self, int message_box_mode,
+                             bool hide_window, bool suppress_redraw) {
+                 cpyhwpx::BulkEditOptions options;
+                 options.message_box_mode = message_box_mode;
+                 options.hide_window = hide_window;
+                 options.suppress_redraw = suppress_redraw;
+                 return std::make_unique<cpyhwpx::BulkEditScope>(self, options);
+             },
+             py::arg("message_box_mode") = 0x2FFF1,
+             py::arg("hide_window") = true,
+             py::arg("suppress_redraw") = true,
+             py::keep_alive<0, 1>(),
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+대량 편집용 빠른 편집 범위를 시작합니다 (with 문과 함께 사용).
+
+범위 동안 메시지 박스를 자동 응답(message_box_mode, -1이면 그대로)으로 바꾸고,
+보이는 창을 숨기거나(hide_window) 다시 그리기를 멈춥니다(suppress_redraw, Windows).
+with 블록을 벗어나면 예외가 나도 원래대로 되돌립니다. 중첩하면 가장 바깥 범위만 적용됩니다.
+실행 취소 기록은 한/글 API로 끌 수 없어 그대로 남습니다.
+
+Examples:
+    >>> with hwp.bulk_edit():
+    ...     hwp.table_from_data(rows)
+    ...     hwp.put_field_text(fields)
+)doc")
+        .def_property_readonly("is_bulk_edit", &cpyhwpx::HwpWrapper::IsBulkEdit,
+                               "bulk_edit() 범위 안인지 여부")
 
         // 유틸리티
         .def("key_indicator", &cpyhwpx::HwpWrapper::KeyIndicator,
+             py::call_guard<py::gil_scoped_release>(),
              "키 인디케이터 (suc, seccnt, secno, prnpageno, colno, line, pos, over, ctrlname)")
         .def("goto_page", &cpyhwpx::HwpWrapper::GotoPage,
              py::arg("page_index"),
+             py::call_guard<py::gil_scoped_release>(),
              "페이지로 이동 (1-based), 반환: (인쇄페이지, 현재페이지)")
         .def("mili_to_hwp_unit", &cpyhwpx::HwpWrapper::MiliToHwpUnit,
              py::arg("mili"),
+             py::call_guard<py::gil_scoped_release>(),
              "밀리미터를 HWP 단위로 변환")
         .def_static("hwp_unit_to_mili", &cpyhwpx::HwpWrapper::HwpUnitToMili,
              py::arg("hwp_unit"),
@@ -738,230 +1379,324 @@ get_pos_by_set()으로 저장한 모든 위치 정보를 삭제한다.
 
         // 정렬 관련
         .def("h_align", &cpyhwpx::HwpWrapper::HAlign,
-             py::arg("h_align"), "수평 정렬 (Left, Center, Right, Justify)")
+             py::arg("h_align"),
+             py::call_guard<py::gil_scoped_release>(), "수평 정렬 (Left, Center, Right, Justify)")
         .def("v_align", &cpyhwpx::HwpWrapper::VAlign,
-             py::arg("v_align"), "수직 정렬 (Top, Center, Bottom)")
+             py::arg("v_align"),
+             py::call_guard<py::gil_scoped_release>(), "수직 정렬 (Top, Center, Bottom)")
         .def("text_align", &cpyhwpx::HwpWrapper::TextAlign,
-             py::arg("text_align"), "텍스트 정렬")
+             py::arg("text_align"),
+             py::call_guard<py::gil_scoped_release>(), "텍스트 정렬")
         .def("para_head_align", &cpyhwpx::HwpWrapper::ParaHeadAlign,
-             py::arg("para_head_align"), "문단 머리 정렬")
+             py::arg("para_head_align"),
+             py::call_guard<py::gil_scoped_release>(), "문단 머리 정렬")
         .def("text_art_align", &cpyhwpx::HwpWrapper::TextArtAlign,
-             py::arg("text_art_align"), "글맵시 정렬")
+             py::arg("text_art_align"),
+             py::call_guard<py::gil_scoped_release>(), "글맵시 정렬")
 
         // 선/테두리 관련
         .def("hwp_line_type", &cpyhwpx::HwpWrapper::HwpLineType,
-             py::arg("line_type"), "선 종류 (Solid, Dash, Dot, DashDot, etc.)")
+             py::arg("line_type"),
+             py::call_guard<py::gil_scoped_release>(), "선 종류 (Solid, Dash, Dot, DashDot, etc.)")
         .def("hwp_line_width", &cpyhwpx::HwpWrapper::HwpLineWidth,
-             py::arg("line_width"), "선 두께 (0.1mm, 0.12mm, 0.15mm, etc.)")
+             py::arg("line_width"),
+             py::call_guard<py::gil_scoped_release>(), "선 두께 (0.1mm, 0.12mm, 0.15mm, etc.)")
         .def("border_shape", &cpyhwpx::HwpWrapper::BorderShape,
-             py::arg("border_type"), "테두리 모양")
+             py::arg("border_type"),
+             py::call_guard<py::gil_scoped_release>(), "테두리 모양")
         .def("end_style", &cpyhwpx::HwpWrapper::EndStyle,
-             py::arg("end_style"), "끝 스타일")
+             py::arg("end_style"),
+             py::call_guard<py::gil_scoped_release>(), "끝 스타일")
         .def("end_size", &cpyhwpx::HwpWrapper::EndSize,
-             py::arg("end_size"), "끝 크기")
+             py::arg("end_size"),
+             py::call_guard<py::gil_scoped_release>(), "끝 크기")
 
         // 서식 관련
         .def("number_format", &cpyhwpx::HwpWrapper::NumberFormat,
-             py::arg("num_format"), "번호 형식")
+             py::arg("num_format"),
+             py::call_guard<py::gil_scoped_release>(), "번호 형식")
         .def("head_type", &cpyhwpx::HwpWrapper::HeadType,
-             py::arg("heading_type"), "머리말 유형")
+             py::arg("heading_type"),
+             py::call_guard<py::gil_scoped_release>(), "머리말 유형")
         .def("font_type", &cpyhwpx::HwpWrapper::FontType,
-             py::arg("font_type"), "글꼴 유형")
+             py::arg("font_type"),
+             py::call_guard<py::gil_scoped_release>(), "글꼴 유형")
         .def("strike_out", &cpyhwpx::HwpWrapper::StrikeOut,
-             py::arg("strike_out_type"), "취소선 유형")
+             py::arg("strike_out_type"),
+             py::call_guard<py::gil_scoped_release>(), "취소선 유형")
         .def("hwp_underline_type", &cpyhwpx::HwpWrapper::HwpUnderlineType,
-             py::arg("underline_type"), "밑줄 유형")
+             py::arg("underline_type"),
+             py::call_guard<py::gil_scoped_release>(), "밑줄 유형")
         .def("hwp_underline_shape", &cpyhwpx::HwpWrapper::HwpUnderlineShape,
-             py::arg("underline_shape"), "밑줄 모양")
+             py::arg("underline_shape"),
+             py::call_guard<py::gil_scoped_release>(), "밑줄 모양")
         .def("style_type", &cpyhwpx::HwpWrapper::StyleType,
-             py::arg("style_type"), "스타일 유형")
+             py::arg("style_type"),
+             py::call_guard<py::gil_scoped_release>(), "스타일 유형")
 
         // 검색/효과
         .def("find_dir", &cpyhwpx::HwpWrapper::FindDir,
-             py::arg("find_dir"), "찾기 방향")
+             py::arg("find_dir"),
+             py::call_guard<py::gil_scoped_release>(), "찾기 방향")
         .def("pic_effect", &cpyhwpx::HwpWrapper::PicEffect,
-             py::arg("pic_effect"), "그림 효과")
+             py::arg("pic_effect"),
+             py::call_guard<py::gil_scoped_release>(), "그림 효과")
         .def("hwp_zoom_type", &cpyhwpx::HwpWrapper::HwpZoomType,
-             py::arg("zoom_type"), "줌 유형")
+             py::arg("zoom_type"),
+             py::call_guard<py::gil_scoped_release>(), "줌 유형")
 
         // 페이지/인쇄
         .def("page_num_position", &cpyhwpx::HwpWrapper::PageNumPosition,
-             py::arg("pagenum_pos"), "페이지 번호 위치")
+             py::arg("pagenum_pos"),
+             py::call_guard<py::gil_scoped_release>(), "페이지 번호 위치")
         .def("page_type", &cpyhwpx::HwpWrapper::PageType,
-             py::arg("page_type"), "페이지 유형")
+             py::arg("page_type"),
+             py::call_guard<py::gil_scoped_release>(), "페이지 유형")
         .def("print_range", &cpyhwpx::HwpWrapper::PrintRange,
-             py::arg("print_range"), "인쇄 범위")
+             py::arg("print_range"),
+             py::call_guard<py::gil_scoped_release>(), "인쇄 범위")
         .def("print_type", &cpyhwpx::HwpWrapper::PrintType,
-             py::arg("print_method"), "인쇄 방법")
+             py::arg("print_method"),
+             py::call_guard<py::gil_scoped_release>(), "인쇄 방법")
         .def("print_device", &cpyhwpx::HwpWrapper::PrintDevice,
-             py::arg("print_device"), "인쇄 장치")
+             py::arg("print_device"),
+             py::call_guard<py::gil_scoped_release>(), "인쇄 장치")
         .def("print_paper", &cpyhwpx::HwpWrapper::PrintPaper,
-             py::arg("print_paper"), "인쇄 용지")
+             py::arg("print_paper"),
+             py::call_guard<py::gil_scoped_release>(), "인쇄 용지")
         .def("side_type", &cpyhwpx::HwpWrapper::SideType,
-             py::arg("side_type"), "측면 유형")
+             py::arg("side_type"),
+             py::call_guard<py::gil_scoped_release>(), "측면 유형")
 
         // 채우기/그라데이션
         .def("brush_type", &cpyhwpx::HwpWrapper::BrushType,
-             py::arg("brush_type"), "브러시 유형")
+             py::arg("brush_type"),
+             py::call_guard<py::gil_scoped_release>(), "브러시 유형")
         .def("fill_area_type", &cpyhwpx::HwpWrapper::FillAreaType,
-             py::arg("fill_area"), "채우기 영역")
+             py::arg("fill_area"),
+             py::call_guard<py::gil_scoped_release>(), "채우기 영역")
         .def("gradation", &cpyhwpx::HwpWrapper::Gradation,
-             py::arg("gradation"), "그라데이션")
+             py::arg("gradation"),
+             py::call_guard<py::gil_scoped_release>(), "그라데이션")
         .def("hatch_style", &cpyhwpx::HwpWrapper::HatchStyle,
-             py::arg("hatch_style"), "해치 스타일")
+             py::arg("hatch_style"),
+             py::call_guard<py::gil_scoped_release>(), "해치 스타일")
         .def("watermark_brush", &cpyhwpx::HwpWrapper::WatermarkBrush,
-             py::arg("watermark_brush"), "워터마크 브러시")
+             py::arg("watermark_brush"),
+             py::call_guard<py::gil_scoped_release>(), "워터마크 브러시")
 
         // 표 관련
         .def("table_format", &cpyhwpx::HwpWrapper::TableFormat,
-             py::arg("table_format"), "표 형식")
+             py::arg("table_format"),
+             py::call_guard<py::gil_scoped_release>(), "표 형식")
         .def("table_break", &cpyhwpx::HwpWrapper::TableBreak,
-             py::arg("page_break"), "표 나누기")
+             py::arg("page_break"),
+             py::call_guard<py::gil_scoped_release>(), "표 나누기")
         .def("table_target", &cpyhwpx::HwpWrapper::TableTarget,
-             py::arg("table_target"), "표 대상")
+             py::arg("table_target"),
+             py::call_guard<py::gil_scoped_release>(), "표 대상")
         .def("table_swap_type", &cpyhwpx::HwpWrapper::TableSwapType,
-             py::arg("tableswap"), "표 교환 유형")
+             py::arg("tableswap"),
+             py::call_guard<py::gil_scoped_release>(), "표 교환 유형")
         .def("cell_apply", &cpyhwpx::HwpWrapper::CellApply,
-             py::arg("cell_apply"), "셀 적용")
+             py::arg("cell_apply"),
+             py::call_guard<py::gil_scoped_release>(), "셀 적용")
         .def("grid_method", &cpyhwpx::HwpWrapper::GridMethod,
-             py::arg("grid_method"), "그리드 방법")
+             py::arg("grid_method"),
+             py::call_guard<py::gil_scoped_release>(), "그리드 방법")
         .def("grid_view_line", &cpyhwpx::HwpWrapper::GridViewLine,
-             py::arg("grid_view_line"), "그리드 보기 선")
+             py::arg("grid_view_line"),
+             py::call_guard<py::gil_scoped_release>(), "그리드 보기 선")
 
         // 텍스트 흐름/배치
         .def("text_dir", &cpyhwpx::HwpWrapper::TextDir,
-             py::arg("text_direction"), "텍스트 방향")
+             py::arg("text_direction"),
+             py::call_guard<py::gil_scoped_release>(), "텍스트 방향")
         .def("text_wrap_type", &cpyhwpx::HwpWrapper::TextWrapType,
-             py::arg("text_wrap"), "텍스트 감싸기")
+             py::arg("text_wrap"),
+             py::call_guard<py::gil_scoped_release>(), "텍스트 감싸기")
         .def("text_flow_type", &cpyhwpx::HwpWrapper::TextFlowType,
-             py::arg("text_flow"), "텍스트 흐름")
+             py::arg("text_flow"),
+             py::call_guard<py::gil_scoped_release>(), "텍스트 흐름")
         .def("line_wrap_type", &cpyhwpx::HwpWrapper::LineWrapType,
-             py::arg("line_wrap"), "줄 감싸기")
+             py::arg("line_wrap"),
+             py::call_guard<py::gil_scoped_release>(), "줄 감싸기")
         .def("line_spacing_method", &cpyhwpx::HwpWrapper::LineSpacingMethod,
-             py::arg("line_spacing"), "줄 간격 방법")
+             py::arg("line_spacing"),
+             py::call_guard<py::gil_scoped_release>(), "줄 간격 방법")
 
         // 도형/이미지
         .def("arc_type", &cpyhwpx::HwpWrapper::ArcType,
-             py::arg("arc_type"), "호 유형")
+             py::arg("arc_type"),
+             py::call_guard<py::gil_scoped_release>(), "호 유형")
         .def("draw_aspect", &cpyhwpx::HwpWrapper::DrawAspect,
-             py::arg("draw_aspect"), "그리기 종횡비")
+             py::arg("draw_aspect"),
+             py::call_guard<py::gil_scoped_release>(), "그리기 종횡비")
         .def("draw_fill_image", &cpyhwpx::HwpWrapper::DrawFillImage,
-             py::arg("fillimage"), "그리기 이미지 채우기")
+             py::arg("fillimage"),
+             py::call_guard<py::gil_scoped_release>(), "그리기 이미지 채우기")
         .def("draw_shadow_type", &cpyhwpx::HwpWrapper::DrawShadowType,
-             py::arg("shadow_type"), "그리기 그림자 유형")
+             py::arg("shadow_type"),
+             py::call_guard<py::gil_scoped_release>(), "그리기 그림자 유형")
         .def("char_shadow_type", &cpyhwpx::HwpWrapper::CharShadowType,
-             py::arg("shadow_type"), "글자 그림자 유형")
+             py::arg("shadow_type"),
+             py::call_guard<py::gil_scoped_release>(), "글자 그림자 유형")
         .def("image_format", &cpyhwpx::HwpWrapper::ImageFormat,
-             py::arg("image_format"), "이미지 형식")
+             py::arg("image_format"),
+             py::call_guard<py::gil_scoped_release>(), "이미지 형식")
         .def("placement_type", &cpyhwpx::HwpWrapper::PlacementType,
-             py::arg("restart"), "배치 유형")
+             py::arg("restart"),
+             py::call_guard<py::gil_scoped_release>(), "배치 유형")
 
         // 위치/크기 관련
         .def("horz_rel", &cpyhwpx::HwpWrapper::HorzRel,
-             py::arg("horz_rel"), "수평 상대 위치")
+             py::arg("horz_rel"),
+             py::call_guard<py::gil_scoped_release>(), "수평 상대 위치")
         .def("vert_rel", &cpyhwpx::HwpWrapper::VertRel,
-             py::arg("vert_rel"), "수직 상대 위치")
+             py::arg("vert_rel"),
+             py::call_guard<py::gil_scoped_release>(), "수직 상대 위치")
         .def("height_rel", &cpyhwpx::HwpWrapper::HeightRel,
-             py::arg("height_rel"), "높이 상대 비율")
+             py::arg("height_rel"),
+             py::call_guard<py::gil_scoped_release>(), "높이 상대 비율")
         .def("width_rel", &cpyhwpx::HwpWrapper::WidthRel,
-             py::arg("width_rel"), "너비 상대 비율")
+             py::arg("width_rel"),
+             py::call_guard<py::gil_scoped_release>(), "너비 상대 비율")
 
         // 개요/번호
         .def("auto_num_type", &cpyhwpx::HwpWrapper::AutoNumType,
-             py::arg("autonum"), "자동 번호 유형")
+             py::arg("autonum"),
+             py::call_guard<py::gil_scoped_release>(), "자동 번호 유형")
         .def("numbering", &cpyhwpx::HwpWrapper::Numbering,
-             py::arg("numbering"), "번호 매기기")
+             py::arg("numbering"),
+             py::call_guard<py::gil_scoped_release>(), "번호 매기기")
         .def("hwp_outline_style", &cpyhwpx::HwpWrapper::HwpOutlineStyle,
-             py::arg("hwp_outline_style"), "개요 스타일")
+             py::arg("hwp_outline_style"),
+             py::call_guard<py::gil_scoped_release>(), "개요 스타일")
         .def("hwp_outline_type", &cpyhwpx::HwpWrapper::HwpOutlineType,
-             py::arg("hwp_outline_type"), "개요 유형")
+             py::arg("hwp_outline_type"),
+             py::call_guard<py::gil_scoped_release>(), "개요 유형")
 
         // 열/단 정의
         .def("col_def_type", &cpyhwpx::HwpWrapper::ColDefType,
-             py::arg("col_def_type"), "열 정의 유형")
+             py::arg("col_def_type"),
+             py::call_guard<py::gil_scoped_release>(), "열 정의 유형")
         .def("col_layout_type", &cpyhwpx::HwpWrapper::ColLayoutType,
-             py::arg("col_layout_type"), "열 레이아웃 유형")
+             py::arg("col_layout_type"),
+             py::call_guard<py::gil_scoped_release>(), "열 레이아웃 유형")
         .def("gutter_method", &cpyhwpx::HwpWrapper::GutterMethod,
-             py::arg("gutter_type"), "거터 방법")
+             py::arg("gutter_type"),
+             py::call_guard<py::gil_scoped_release>(), "거터 방법")
 
         // 기타 옵션
         .def("break_word_latin", &cpyhwpx::HwpWrapper::BreakWordLatin,
-             py::arg("break_latin_word"), "라틴어 단어 나누기")
+             py::arg("break_latin_word"),
+             py::call_guard<py::gil_scoped_release>(), "라틴어 단어 나누기")
         .def("canonical", &cpyhwpx::HwpWrapper::Canonical,
-             py::arg("canonical"), "표준 형식")
+             py::arg("canonical"),
+             py::call_guard<py::gil_scoped_release>(), "표준 형식")
         .def("convert_pua_hangul_to_unicode", &cpyhwpx::HwpWrapper::ConvertPUAHangulToUnicode,
-             py::arg("reverse") = false, "PUA 한글을 유니코드로 변환")
+             py::arg("reverse") = false,
+             py::call_guard<py::gil_scoped_release>(), "PUA 한글을 유니코드로 변환")
         .def("crooked_slash", &cpyhwpx::HwpWrapper::CrookedSlash,
-             py::arg("crooked_slash"), "비뚤어진 슬래시")
+             py::arg("crooked_slash"),
+             py::call_guard<py::gil_scoped_release>(), "비뚤어진 슬래시")
         .def("dbf_code_type", &cpyhwpx::HwpWrapper::DbfCodeType,
-             py::arg("dbf_code"), "DBF 코드 유형")
+             py::arg("dbf_code"),
+             py::call_guard<py::gil_scoped_release>(), "DBF 코드 유형")
         .def("delimiter", &cpyhwpx::HwpWrapper::Delimiter,
-             py::arg("delimiter"), "구분 문자")
+             py::arg("delimiter"),
+             py::call_guard<py::gil_scoped_release>(), "구분 문자")
         .def("ds_mark", &cpyhwpx::HwpWrapper::DSMark,
-             py::arg("diac_sym_mark"), "발음 기호 표시")
+             py::arg("diac_sym_mark"),
+             py::call_guard<py::gil_scoped_release>(), "발음 기호 표시")
         .def("encrypt", &cpyhwpx::HwpWrapper::Encrypt,
-             py::arg("encrypt"), "암호화")
+             py::arg("encrypt"),
+             py::call_guard<py::gil_scoped_release>(), "암호화")
         .def("handler", &cpyhwpx::HwpWrapper::Handler,
-             py::arg("handler"), "핸들러")
+             py::arg("handler"),
+             py::call_guard<py::gil_scoped_release>(), "핸들러")
         .def("hash", &cpyhwpx::HwpWrapper::Hash,
-             py::arg("hash"), "해시")
+             py::arg("hash"),
+             py::call_guard<py::gil_scoped_release>(), "해시")
         .def("hiding", &cpyhwpx::HwpWrapper::Hiding,
-             py::arg("hiding"), "숨기기")
+             py::arg("hiding"),
+             py::call_guard<py::gil_scoped_release>(), "숨기기")
         .def("macro_state", &cpyhwpx::HwpWrapper::MacroState,
-             py::arg("macro_state"), "매크로 상태")
+             py::arg("macro_state"),
+             py::call_guard<py::gil_scoped_release>(), "매크로 상태")
         .def("mail_type", &cpyhwpx::HwpWrapper::MailType,
-             py::arg("mail_type"), "메일 유형")
+             py::arg("mail_type"),
+             py::call_guard<py::gil_scoped_release>(), "메일 유형")
         .def("present_effect", &cpyhwpx::HwpWrapper::PresentEffect,
-             py::arg("prsnteffect"), "프레젠테이션 효과")
+             py::arg("prsnteffect"),
+             py::call_guard<py::gil_scoped_release>(), "프레젠테이션 효과")
         .def("signature", &cpyhwpx::HwpWrapper::Signature,
-             py::arg("signature"), "서명")
+             py::arg("signature"),
+             py::call_guard<py::gil_scoped_release>(), "서명")
         .def("slash", &cpyhwpx::HwpWrapper::Slash,
-             py::arg("slash"), "슬래시")
+             py::arg("slash"),
+             py::call_guard<py::gil_scoped_release>(), "슬래시")
         .def("sort_delimiter", &cpyhwpx::HwpWrapper::SortDelimiter,
-             py::arg("sort_delimiter"), "정렬 구분자")
+             py::arg("sort_delimiter"),
+             py::call_guard<py::gil_scoped_release>(), "정렬 구분자")
         .def("subt_pos", &cpyhwpx::HwpWrapper::SubtPos,
-             py::arg("subt_pos"), "자막 위치")
+             py::arg("subt_pos"),
+             py::call_guard<py::gil_scoped_release>(), "자막 위치")
         .def("view_flag", &cpyhwpx::HwpWrapper::ViewFlag,
-             py::arg("view_flag"), "보기 플래그")
+             py::arg("view_flag"),
+             py::call_guard<py::gil_scoped_release>(), "보기 플래그")
 
         // 사용자 정보
         .def("get_user_info", &cpyhwpx::HwpWrapper::GetUserInfo,
-             py::arg("user_info_id"), "사용자 정보 가져오기")
+             py::arg("user_info_id"),
+             py::call_guard<py::gil_scoped_release>(), "사용자 정보 가져오기")
         .def("set_user_info", &cpyhwpx::HwpWrapper::SetUserInfo,
-             py::arg("user_info_id"), py::arg("value"), "사용자 정보 설정")
+             py::arg("user_info_id"), py::arg("value"),
+             py::call_guard<py::gil_scoped_release>(), "사용자 정보 설정")
 
         // 메타태그/DRM
         .def("set_cur_metatag_name", &cpyhwpx::HwpWrapper::SetCurMetatagName,
-             py::arg("tag"), "현재 메타태그 이름 설정")
+             py::arg("tag"),
+             py::call_guard<py::gil_scoped_release>(), "현재 메타태그 이름 설정")
         .def("set_drm_authority", &cpyhwpx::HwpWrapper::SetDRMAuthority,
-             py::arg("authority"), "DRM 권한 설정")
+             py::arg("authority"),
+             py::call_guard<py::gil_scoped_release>(), "DRM 권한 설정")
 
         // 번역
         .def("get_translate_lang_list", &cpyhwpx::HwpWrapper::GetTranslateLangList,
-             py::arg("cur_lang"), "번역 언어 목록 가져오기")
+             py::arg("cur_lang"),
+             py::call_guard<py::gil_scoped_release>(), "번역 언어 목록 가져오기")
 
         // 음력/양력 변환
         .def("lunar_to_solar_by_set", &cpyhwpx::HwpWrapper::LunarToSolarBySet,
              py::arg("l_year"), py::arg("l_month"), py::arg("l_day"), py::arg("l_leap"),
+             py::call_guard<py::gil_scoped_release>(),
              "음력을 양력으로 변환 (year, month, day 튜플 반환)")
         .def("solar_to_lunar_by_set", &cpyhwpx::HwpWrapper::SolarToLunarBySet,
              py::arg("s_year"), py::arg("s_month"), py::arg("s_day"),
+             py::call_guard<py::gil_scoped_release>(),
              "양력을 음력으로 변환 (year, month, day, leap 튜플 반환)")
 
         // 단위 변환 확장
         .def("hwp_unit_to_inch", &cpyhwpx::HwpWrapper::HwpUnitToInch,
-             py::arg("hwp_unit"), "HWP 단위를 인치로 변환")
+             py::arg("hwp_unit"),
+             py::call_guard<py::gil_scoped_release>(), "HWP 단위를 인치로 변환")
         .def("hwp_unit_to_point", &cpyhwpx::HwpWrapper::HwpUnitToPoint,
-             py::arg("hwp_unit"), "HWP 단위를 포인트로 변환")
+             py::arg("hwp_unit"),
+             py::call_guard<py::gil_scoped_release>(), "HWP 단위를 포인트로 변환")
         .def("point_to_hwp_unit", &cpyhwpx::HwpWrapper::PointToHwpUnit,
-             py::arg("point"), "포인트를 HWP 단위로 변환")
+             py::arg("point"),
+             py::call_guard<py::gil_scoped_release>(), "포인트를 HWP 단위로 변환")
 
         // 문서 상태
         .def("is_empty", &cpyhwpx::HwpWrapper::IsEmpty,
+             py::call_guard<py::gil_scoped_release>(),
              "빈 문서 여부")
         .def("is_modified", &cpyhwpx::HwpWrapper::IsModified,
+             py::call_guard<py::gil_scoped_release>(),
              "수정 여부")
         .def("is_cell", &cpyhwpx::HwpWrapper::IsCell,
+             py::call_guard<py::gil_scoped_release>(),
              "셀 안 여부")
 
         // 찾기/바꾸기
@@ -971,6 +1706,7 @@ get_pos_by_set()으로 저장한 모든 위치 정보를 삭제한다.
              py::arg("match_case") = false,
              py::arg("regex") = false,
              py::arg("replace_mode") = false,
+             py::call_guard<py::gil_scoped_release>(),
              "텍스트 찾기")
         .def("replace", &cpyhwpx::HwpWrapper::Replace,
              py::arg("find_text"),
@@ -978,48 +1714,59 @@ get_pos_by_set()으로 저장한 모든 위치 정보를 삭제한다.
              py::arg("forward") = true,
              py::arg("match_case") = false,
              py::arg("regex") = false,
+             py::call_guard<py::gil_scoped_release>(),
              "텍스트 바꾸기")
         .def("replace_all", &cpyhwpx::HwpWrapper::ReplaceAll,
              py::arg("find_text"),
              py::arg("replace_text"),
              py::arg("match_case") = false,
              py::arg("regex") = false,
+             py::call_guard<py::gil_scoped_release>(),
              "모두 바꾸기")
         .def("find_forward", &cpyhwpx::HwpWrapper::FindForward,
              py::arg("src"),
              py::arg("regex") = false,
+             py::call_guard<py::gil_scoped_release>(),
              "아래 방향으로 텍스트 찾기")
         .def("find_backward", &cpyhwpx::HwpWrapper::FindBackward,
              py::arg("src"),
              py::arg("regex") = false,
+             py::call_guard<py::gil_scoped_release>(),
              "위 방향으로 텍스트 찾기")
         .def("find_replace", &cpyhwpx::HwpWrapper::FindReplace,
              py::arg("src"),
              py::arg("dst"),
              py::arg("regex") = false,
              py::arg("direction") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              "모두 찾아 바꾸기 (direction: 0=Forward, 1=Backward, 2=AllDoc)")
         .def("paste", &cpyhwpx::HwpWrapper::Paste,
              py::arg("option") = 4,
+             py::call_guard<py::gil_scoped_release>(),
              "붙여넣기 (option: 0=왼쪽, 1=오른쪽, 2=위, 3=아래, 4=덮어쓰기, 5=내용만, 6=셀안에표)")
 
         // HAction 관련
         .def("run", &cpyhwpx::HwpWrapper::RunAction,
              py::arg("act_id"),
+             py::call_guard<py::gil_scoped_release>(),
              "HAction.Run() 실행")
         .def("Run", &cpyhwpx::HwpWrapper::RunAction,
              py::arg("act_id"),
+             py::call_guard<py::gil_scoped_release>(),
              "HAction.Run() 실행 (pyhwpx 호환)")
         .def("find_ctrl", &cpyhwpx::HwpWrapper::FindCtrl,
+             py::call_guard<py::gil_scoped_release>(),
              "현재 위치의 컨트롤을 찾아 선택")
         .def("insert_ctrl", [](cpyhwpx::HwpWrapper& self, const std::wstring& ctrl_id) {
                  return self.InsertCtrl(ctrl_id, nullptr);
              },
              py::arg("ctrl_id"),
              py::return_value_policy::take_ownership,
+             py::call_guard<py::gil_scoped_release>(),
              "컨트롤 삽입 (ctrl_id: tbl/pic/gso/eqed 등)")
         .def("delete_ctrl", py::overload_cast<cpyhwpx::HwpCtrl*>(&cpyhwpx::HwpWrapper::DeleteCtrl),
              py::arg("ctrl"),
+             py::call_guard<py::gil_scoped_release>(),
              "컨트롤 삭제")
 
         // 속성
@@ -1086,12 +1833,76 @@ get_pos_by_set()으로 저장한 모든 위치 정보를 삭제한다.
                                "문서 컬렉션 (XHwpDocuments 별칭)")
         .def("switch_to", &cpyhwpx::HwpWrapper::SwitchTo,
              py::arg("num"),
+             py::call_guard<py::gil_scoped_release>(),
              "문서 전환 (인덱스)")
         .def("add_tab", &cpyhwpx::HwpWrapper::AddTab,
+             py::call_guard<py::gil_scoped_release>(),
              "새 탭으로 문서 추가")
         .def("add_doc", &cpyhwpx::HwpWrapper::AddDoc,
+             py::call_guard<py::gil_scoped_release>(),
              "새 창으로 문서 추가")
 
+        //=========================================================================
+        // 편집 세대 (Edit Generation)
+        //=========================================================================
+        .def_property_readonly("edit_generation", &cpyhwpx::HwpWrapper::GetEditGeneration,
+                               "문서 세대 (이 Hwp로 한 편집 중 캐럿 이동을 뺀 편집마다 증가)")
+        .def("edit_stamp", [](const cpyhwpx::HwpWrapper& self, int kinds) {
+                 return self.GetEditTracker().Stamp(kinds);
+             },
+             py::arg("kinds") = cpyhwpx::EditKind::All,
+             R"doc(
+EditKind 조합의 도장 값. 조합에 든 종류의 편집이 있었을 때만 바뀝니다.
+
+캐시를 채울 때 저장해 두고 읽을 때 비교하면 다시 조회할지 알 수 있습니다.
+
+Examples:
+    >>> stamp = hwp.edit_stamp(cpyhwpx.EditKind.CONTENT)
+    >>> text = hwp.get_text_file()
+    >>> if hwp.edit_stamp(cpyhwpx.EditKind.CONTENT) != stamp: ...
+)doc")
+        .def("note_edit", &cpyhwpx::HwpWrapper::NoteEdit,
+             py::arg("kinds") = cpyhwpx::EditKind::All,
+             py::call_guard<py::gil_scoped_release>(),
+             "Hwp 메서드를 거치지 않고 문서를 바꾼 경우 직접 알림 (EditKind 조합)")
+        .def_static("classify_action", &cpyhwpx::EditTracker::ClassifyAction,
+                    py::arg("action_id"),
+                    "HAction ID가 바꾸는 것 (EditKind 조합, 모르는 액션은 CONTENT | LAYOUT)")
+
+        //=========================================================================
+        // 작업 기록 (Action Recording)
+        //=========================================================================
+        .def("start_recording", &cpyhwpx::HwpWrapper::StartRecording,
+             py::arg("log_path") = L"",
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+이 스레드에서 실행하는 편집 작업 기록을 시작합니다.
+
+run, set_pos, move_pos, insert_text, put_field_text, move_to_field,
+파라미터셋 액션 실행(set_charshape, set_parashape, HAction.Execute)이 기록됩니다.
+서브셋을 쓰는 액션과 cell_fill, find 등 내용을 기록할 수 없는 작업은
+"Skipped"로 남으며 재생 시 실행되지 않고 False가 됩니다 (Batch.skipped로 확인).
+
+Args:
+    log_path: 지정하면 작업마다 파일에 이어 쓰고 flush (비정상 종료 후 Batch.load로 복구)
+
+Returns:
+    로그 파일을 열지 못하면 False
+)doc")
+        .def("stop_recording", &cpyhwpx::HwpWrapper::StopRecording,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+작업 기록을 중지하고 기록된 작업을 Batch로 반환합니다.
+
+Examples:
+    >>> hwp.start_recording()
+    >>> hwp.insert_text("안녕")
+    >>> batch = hwp.stop_recording()
+    >>> batch.execute(other_hwp)
+)doc")
+        .def_property_readonly("is_recording", &cpyhwpx::HwpWrapper::IsRecording,
+                               "작업 기록 중인지 여부")
+
         //=========================================================================
         // 필드 작업 (Field Operations)
         //=========================================================================
@@ -1099,6 +1910,7 @@ get_pos_by_set()으로 저장한 모든 위치 정보를 삭제한다.
              py::arg("name"),
              py::arg("direction") = L"",
              py::arg("memo") = L"",
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 캐럿의 현재 위치에 누름틀 필드를 생성한다.
 
@@ -1114,9 +1926,10 @@ Examples:
     >>> hwp.create_field("name", direction="이름", memo="이름 입력 필드")
     >>> hwp.put_field_text("name", "홍길동")
 )doc")
-        .def("get_field_list", &cpyhwpx::HwpWrapper::GetFieldList,
+        .def("get_field_list", &cpyhwpx::HwpWrapper::GetFieldListBstr,
              py::arg("number") = 1,
              py::arg("option") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 문서에 존재하는 필드의 목록을 구한다.
 
@@ -1140,6 +1953,7 @@ Examples:
         .def("get_field_text", &cpyhwpx::HwpWrapper::GetFieldText,
              py::arg("field"),
              py::arg("idx") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 지정한 필드에서 문자열을 구한다.
 
@@ -1157,6 +1971,7 @@ Examples:
         .def("put_field_text", &cpyhwpx::HwpWrapper::PutFieldText,
              py::arg("field"),
              py::arg("text"),
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 지정한 필드의 내용을 채운다.
 
@@ -1172,6 +1987,7 @@ Examples:
 )doc")
         .def("field_exist", &cpyhwpx::HwpWrapper::FieldExist,
              py::arg("field"),
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 필드가 문서에 존재하는지 확인한다.
 
@@ -1187,6 +2003,7 @@ Returns:
              py::arg("text") = true,
              py::arg("start") = true,
              py::arg("select") = false,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 지정한 필드로 캐럿을 이동한다.
 
@@ -1207,6 +2024,7 @@ Examples:
         .def("rename_field", &cpyhwpx::HwpWrapper::RenameField,
              py::arg("oldname"),
              py::arg("newname"),
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 지정한 필드의 이름을 바꾼다.
 
@@ -1220,6 +2038,7 @@ Examples:
 )doc")
         .def("get_cur_field_name", &cpyhwpx::HwpWrapper::GetCurFieldName,
              py::arg("option") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 캐럿 위치의 필드 이름을 조회한다.
 
@@ -1234,6 +2053,7 @@ Returns:
              py::arg("direction") = L"",
              py::arg("memo") = L"",
              py::arg("option") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 셀에 필드 이름을 설정한다.
 
@@ -1245,12 +2065,15 @@ Args:
 )doc")
         .def("set_field_view_option", &cpyhwpx::HwpWrapper::SetFieldViewOption,
              py::arg("option"),
+             py::call_guard<py::gil_scoped_release>(),
              "필드 뷰 옵션 설정")
         .def("delete_all_fields", &cpyhwpx::HwpWrapper::DeleteAllFields,
+             py::call_guard<py::gil_scoped_release>(),
              "모든 누름틀 필드를 삭제한다.")
         .def("delete_field_by_name", &cpyhwpx::HwpWrapper::DeleteFieldByName,
              py::arg("field_name"),
              py::arg("idx") = -1,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 이름으로 필드를 삭제한다.
 
@@ -1259,7 +2082,30 @@ Args:
     idx: 삭제할 필드 인덱스 (-1이면 동일 이름 필드 모두 삭제)
 )doc")
         .def("fields_to_map", &cpyhwpx::HwpWrapper::FieldsToMap,
+             py::call_guard<py::gil_scoped_release>(),
              "문서의 모든 필드를 {필드명: 텍스트} 딕셔너리로 반환한다.")
+        .def("field_count", &cpyhwpx::HwpWrapper::GetFieldCount,
+             py::arg("name"),
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+같은 이름의 필드 개수를 반환한다.
+
+필드 색인에서 조회하므로 색인이 최신이면 COM 호출이 없다.
+
+Args:
+    name: 필드 이름
+
+Returns:
+    필드 개수 (없으면 0)
+)doc")
+        .def("invalidate_field_index", &cpyhwpx::HwpWrapper::InvalidateFieldIndex,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+필드 색인을 버린다.
+
+래퍼 밖(한/글 화면, 원시 COM 호출)에서 필드를 바꾼 경우 호출한다.
+다음 field_exist/get_field_text 호출 때 다시 구성된다.
+)doc")
 
         //=========================================================================
         // 테이블 작업 (Table Operations)
@@ -1271,6 +2117,7 @@ Args:
              py::arg("width_type") = 0,
              py::arg("height_type") = 0,
              py::arg("header") = false,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 표를 생성한다.
 
@@ -1294,6 +2141,7 @@ Examples:
         .def("get_into_nth_table", &cpyhwpx::HwpWrapper::GetIntoNthTable,
              py::arg("n") = 0,
              py::arg("select_cell") = false,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 n번째 테이블로 이동한다.
 
@@ -1309,6 +2157,7 @@ Examples:
     >>> hwp.get_into_nth_table(-1)  # 마지막 표로 이동
 )doc")
         .def("get_table_row_count", &cpyhwpx::HwpWrapper::GetTableRowCount,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 커서가 위치한 테이블의 행 개수를 반환한다.
 
@@ -1316,6 +2165,7 @@ Returns:
     행 개수. 테이블 안이 아니면 -1
 )doc")
         .def("get_table_col_count", &cpyhwpx::HwpWrapper::GetTableColCount,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 커서가 위치한 테이블의 열 개수를 반환한다.
 
@@ -1323,29 +2173,40 @@ Returns:
     열 개수. 테이블 안이 아니면 -1
 )doc")
         .def("table_left_cell", &cpyhwpx::HwpWrapper::TableLeftCell,
+             py::call_guard<py::gil_scoped_release>(),
              "왼쪽 셀로 이동")
         .def("table_right_cell", &cpyhwpx::HwpWrapper::TableRightCell,
+             py::call_guard<py::gil_scoped_release>(),
              "오른쪽 셀로 이동")
         .def("table_upper_cell", &cpyhwpx::HwpWrapper::TableUpperCell,
+             py::call_guard<py::gil_scoped_release>(),
              "위쪽 셀로 이동")
         .def("table_lower_cell", &cpyhwpx::HwpWrapper::TableLowerCell,
+             py::call_guard<py::gil_scoped_release>(),
              "아래쪽 셀로 이동")
         .def("table_right_cell_append", &cpyhwpx::HwpWrapper::TableRightCellAppend,
+             py::call_guard<py::gil_scoped_release>(),
              "오른쪽 셀로 이동 (행 끝이면 다음 행 첫 셀로 이동)")
         .def("table_col_begin", &cpyhwpx::HwpWrapper::TableColBegin,
+             py::call_guard<py::gil_scoped_release>(),
              "현재 행의 첫 번째 열로 이동")
         .def("table_col_end", &cpyhwpx::HwpWrapper::TableColEnd,
+             py::call_guard<py::gil_scoped_release>(),
              "현재 행의 마지막 열로 이동")
         .def("table_col_page_up", &cpyhwpx::HwpWrapper::TableColPageUp,
+             py::call_guard<py::gil_scoped_release>(),
              "현재 열의 맨 위 셀로 이동")
         .def("table_cell_block_extend_abs", &cpyhwpx::HwpWrapper::TableCellBlockExtendAbs,
+             py::call_guard<py::gil_scoped_release>(),
              "셀 블록 선택 확장 (절대 위치 기준)")
         .def("cancel", &cpyhwpx::HwpWrapper::Cancel,
+             py::call_guard<py::gil_scoped_release>(),
              "현재 선택을 취소한다 (ESC 키와 동일)")
         .def("cell_fill", &cpyhwpx::HwpWrapper::CellFill,
              py::arg("r") = 217,
              py::arg("g") = 217,
              py::arg("b") = 217,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 셀의 배경색을 설정한다.
 
@@ -1366,6 +2227,7 @@ Examples:
              py::arg("cell_fill_r") = -1,
              py::arg("cell_fill_g") = -1,
              py::arg("cell_fill_b") = -1,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 2차원 리스트 데이터로 테이블을 생성한다.
 
@@ -1384,13 +2246,15 @@ Examples:
     >>> hwp.table_from_data(data, header=True)
 )doc")
 
-        .def("get_table_xml", &cpyhwpx::HwpWrapper::GetTableXml,
+        .def("get_table_xml", &cpyhwpx::HwpWrapper::GetTableXmlBstr,
+             py::call_guard<py::gil_scoped_release>(),
              "현재 커서 위치의 테이블을 HWPML2X XML 문자열로 추출한다.")
 
         //=========================================================================
         // 스타일 관리 (CharShape/ParaShape)
         //=========================================================================
         .def("get_charshape", &cpyhwpx::HwpWrapper::GetCharShape,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 캐럿 위치의 글자모양 속성을 dict로 반환한다.
 
@@ -1401,6 +2265,7 @@ Returns:
 )doc")
         .def("set_charshape", &cpyhwpx::HwpWrapper::SetCharShape,
              py::arg("props"),
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 글자모양 속성을 설정한다.
 
@@ -1420,6 +2285,7 @@ Examples:
              py::arg("bold") = -1,
              py::arg("italic") = -1,
              py::arg("text_color") = -1,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 글자모양을 간편하게 설정한다.
 
@@ -1435,6 +2301,7 @@ Examples:
     >>> hwp.set_font(text_color=0x0000FF)  # 빨간색 글자
 )doc")
         .def("get_parashape", &cpyhwpx::HwpWrapper::GetParaShape,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 캐럿이 위치한 문단의 문단모양 속성을 dict로 반환한다.
 
@@ -1445,6 +2312,7 @@ Returns:
 )doc")
         .def("set_parashape", &cpyhwpx::HwpWrapper::SetParaShape,
              py::arg("props"),
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 문단모양 속성을 설정한다.
 
@@ -1458,6 +2326,7 @@ Args:
              py::arg("line_spacing") = -1,
              py::arg("left_margin") = -1,
              py::arg("indentation") = -1,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 문단모양을 간편하게 설정한다.
 
@@ -1484,6 +2353,7 @@ Examples:
              py::arg("effect") = 0,
              py::arg("width") = 0,
              py::arg("height") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 커서 위치에 이미지를 삽입한다.
 
@@ -1517,6 +2387,7 @@ Examples:
              py::arg("format") = L"",
              py::arg("arg") = L"",
              py::arg("move_doc_end") = false,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 커서 위치에 파일 내용을 끼워넣는다.
 
@@ -1537,6 +2408,7 @@ Args:
              py::arg("watermark") = false,
              py::arg("brightness") = 0,
              py::arg("contrast") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 배경 그림을 삽입한다.
 
@@ -1555,12 +2427,15 @@ Args:
              py::arg("text") = L"",
              py::arg("start") = true,
              py::arg("select") = false,
+             py::call_guard<py::gil_scoped_release>(),
              "지정한 메타태그 위치로 캐럿을 이동한다.")
         .def("clear_field_text", &cpyhwpx::HwpWrapper::ClearFieldText,
+             py::call_guard<py::gil_scoped_release>(),
              "문서 내 모든 필드의 텍스트를 비운다.")
         .def("insert_hyperlink", &cpyhwpx::HwpWrapper::InsertHyperlink,
              py::arg("hypertext"),
              py::arg("description") = L"",
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 선택한 문자열에 하이퍼링크를 삽입한다.
 
@@ -1574,6 +2449,7 @@ Returns:
         .def("insert_memo", &cpyhwpx::HwpWrapper::InsertMemo,
              py::arg("text") = L"",
              py::arg("memo_type") = L"memo",
+             py::call_guard<py::gil_scoped_release>(),
              R"doc(
 현재 위치에 메모를 삽입한다.
 
@@ -1586,12 +2462,14 @@ Args:
              py::arg("char_size") = -3,
              py::arg("check_compose") = 0,
              py::arg("circle_type") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              "원 문자 조합")
         .def("move_to_ctrl", [](cpyhwpx::HwpWrapper& self, cpyhwpx::HwpCtrl& ctrl, int option) {
                  return self.MoveToCtrl(ctrl.GetDispatch(), option);
              },
              py::arg("ctrl"),
              py::arg("option") = 0,
+             py::call_guard<py::gil_scoped_release>(),
              "컨트롤 위치로 이동")
         .def("select_ctrl", [](cpyhwpx::HwpWrapper& self, cpyhwpx::HwpCtrl& ctrl, int anchor_type, int option) {
                  return self.SelectCtrl(ctrl.GetDispatch(), anchor_type, option);
@@ -1599,10 +2477,12 @@ Args:
              py::arg("ctrl"),
              py::arg("anchor_type") = 0,
              py::arg("option") = 1,
+             py::call_guard<py::gil_scoped_release>(),
              "컨트롤 선택")
         .def("move_all_caption", &cpyhwpx::HwpWrapper::MoveAllCaption,
              py::arg("location") = L"Bottom",
              py::arg("align") = L"Justify",
+             py::call_guard<py::gil_scoped_release>(),
              "모든 캡션 위치 이동 (location: Top/Bottom/Left/Right)")
 
         //=========================================================================
@@ -1612,37 +2492,242 @@ Args:
              py::arg("field"),
              py::arg("remove"),
              py::arg("add"),
+             py::call_guard<py::gil_scoped_release>(),
              "필드 속성 수정")
         .def("find_private_info", &cpyhwpx::HwpWrapper::FindPrivateInfo,
              py::arg("private_type"),
              py::arg("private_string"),
+             py::call_guard<py::gil_scoped_release>(),
              "개인정보 찾기 (-1=끝, 0=없음, 비트마스크=유형)")
+        .def("scan_private_info", &cpyhwpx::HwpWrapper::ScanPrivateInfo,
+             py::arg("types") = cpyhwpx::PrivateInfoType::All,
+             py::arg("validate_checksum") = true,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+문서 전체 텍스트에서 개인정보를 네이티브로 탐지합니다.
+
+get_text_file("UNICODE")로 한 번 추출한 뒤 C++ 스캐너로 검사하므로
+유형/문자열마다 COM을 호출하는 find_private_info보다 훨씬 빠릅니다.
+
+Args:
+    types: 탐지할 유형 비트 조합 (PrivateInfoScanner.PHONE | ...). 기본값은 전체
+    validate_checksum: 주민/외국인등록번호 체크섬 검증 여부
+
+Returns:
+    PrivateInfoMatch 리스트 (offset/length는 추출된 텍스트 기준)
+
+Note:
+    offset은 문서 위치(list, para, pos)로 바꿀 수 없습니다. 추출된 텍스트에는
+    표/글상자 문단이 본문 사이에 끼고 컨트롤 자리가 빠집니다.
+    문서에서 해당 위치로 가려면 탐지된 text로 find를 호출하세요.
+
+Examples:
+    >>> for m in hwp.scan_private_info():
+    ...     print(m.type, m.offset, m.text)
+    >>> hwp.find(m.text)  # 문서에서 선택
+)doc")
         .def("get_cur_metatag_name", &cpyhwpx::HwpWrapper::GetCurMetatagName,
+             py::call_guard<py::gil_scoped_release>(),
              "현재 메타태그명 조회")
         .def("get_metatag_list", &cpyhwpx::HwpWrapper::GetMetatagList,
              py::arg("number"),
              py::arg("option"),
+             py::call_guard<py::gil_scoped_release>(),
              "메타태그 목록 조회")
         .def("get_metatag_name_text", &cpyhwpx::HwpWrapper::GetMetatagNameText,
              py::arg("tag"),
+             py::call_guard<py::gil_scoped_release>(),
              "메타태그 텍스트 조회")
         .def("put_metatag_name_text", &cpyhwpx::HwpWrapper::PutMetatagNameText,
              py::arg("tag"),
              py::arg("text"),
+             py::call_guard<py::gil_scoped_release>(),
              "메타태그 텍스트 설정")
         .def("rename_metatag", &cpyhwpx::HwpWrapper::RenameMetatag,
              py::arg("oldtag"),
              py::arg("newtag"),
+             py::call_guard<py::gil_scoped_release>(),
              "메타태그 이름 변경")
         .def("modify_metatag_properties", &cpyhwpx::HwpWrapper::ModifyMetatagProperties,
              py::arg("tag"),
              py::arg("remove"),
              py::arg("add"),
+             py::call_guard<py::gil_scoped_release>(),
              "메타태그 속성 수정")
+        .def("metatags_to_map", &cpyhwpx::HwpWrapper::MetatagsToMap,
+             py::call_guard<py::gil_scoped_release>(),
+             "문서의 모든 메타태그를 {메타태그명: 텍스트} 딕셔너리로 반환한다.")
+        .def("put_metatag_texts", &cpyhwpx::HwpWrapper::PutMetatagTexts,
+             py::arg("texts"),
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+여러 메타태그 텍스트를 한 번에 설정한다.
+
+Args:
+    texts: {메타태그명: 텍스트} 딕셔너리
+
+Returns:
+    모두 성공하면 True (실패한 태그가 있어도 나머지는 계속 설정)
+
+Examples:
+    >>> hwp.put_metatag_texts({"#author": "홍길동", "#dept": "기획팀"})
+)doc")
         .def("get_field_info", &cpyhwpx::HwpWrapper::GetFieldInfo,
+             py::call_guard<py::gil_scoped_release>(),
              "필드 정보 리스트 (HWPML2X 파싱)")
         .def("set_field_by_bracket", &cpyhwpx::HwpWrapper::SetFieldByBracket,
-             "중괄호 구문을 필드로 변환 ({{name:direction:memo}}, [[name]])");
+             py::call_guard<py::gil_scoped_release>(),
+             "중괄호 구문을 필드로 변환 ({{name:direction:memo}}, [[name]])")
+
+        //=========================================================================
+        // 파라미터셋 풀 (Parameter-Set Pool)
+        //=========================================================================
+        .def("set_parameter_set_pool_limit", &cpyhwpx::HwpWrapper::SetParameterSetPoolLimit,
+             py::arg("max_per_id"),
+             py::call_guard<py::gil_scoped_release>(),
+             "세트 ID별 파라미터셋 풀 최대 보관 수 (기본 8, 0이면 풀 사용 안 함)")
+        .def("clear_parameter_set_pool", &cpyhwpx::HwpWrapper::ClearParameterSetPool,
+             py::call_guard<py::gil_scoped_release>(),
+             "파라미터셋 풀 비우기")
+        .def_property_readonly("parameter_set_pool_stats", [](const cpyhwpx::HwpWrapper& self) {
+                 const cpyhwpx::ParameterSetPool& pool = self.GetParameterSetPool();
+                 py::dict stats;
+                 stats["max_per_id"] = pool.GetMaxPerId();
+                 stats["idle"] = pool.GetIdleCount();
+                 stats["hits"] = pool.GetHitCount();
+                 stats["misses"] = pool.GetMissCount();
+                 return stats;
+             },
+             "파라미터셋 풀 상태 (max_per_id, idle, hits, misses)")
+        .def("execute_set", [](cpyhwpx::HwpWrapper& self, const std::wstring& action_name,
+                               const std::wstring& set_name, const py::dict& items) {
+                 SetItemValues values = ToSetItems(items);
+                 py::gil_scoped_release release;
+                 return self.ExecuteSetItems(action_name, set_name, values.items);
+             },
+             py::arg("action_name"), py::arg("set_name"), py::arg("items"),
+             R"doc(
+파라미터셋 액션을 항목 dict로 한 번에 설정해 실행합니다.
+
+Args:
+    action_name: 액션 ID (예: "CharShape")
+    set_name: 파라미터셋 ID
+    items: {항목 이름: bool/int/float/str}
+
+Examples:
+    >>> hwp.execute_set("CharShape", "CharShape", {"Bold": True, "Height": 1200})
+)doc")
+        .def("get_set_items", [](cpyhwpx::HwpWrapper& self, const std::wstring& property,
+                                 const std::vector<std::wstring>& names) {
+                 std::vector<VARIANT> values;
+                 {
+                     py::gil_scoped_release release;
+                     values = self.GetPropertySetItems(property, names);
+                 }
+                 py::dict result;
+                 for (size_t i = 0; i < values.size(); ++i) {
+                     result[py::cast(names[i])] = FromSetItem(values[i]);
+                 }
+                 return result;
+             },
+             py::arg("property"), py::arg("names"),
+             R"doc(
+파라미터셋 속성의 여러 항목을 한 번에 읽어 dict로 반환합니다.
+
+Args:
+    property: 파라미터셋을 반환하는 Hwp 속성 이름 (예: "CharShape", "ParaShape")
+    names: 항목 이름 리스트
+
+Returns:
+    {항목 이름: 값} (지원하지 않는 값 형식은 None, 속성을 얻지 못하면 빈 dict)
+
+Examples:
+    >>> hwp.get_set_items("CharShape", ["Height", "Bold", "FaceNameHangul"])
+)doc")
+
+        //=========================================================================
+        // COM 호출 계측 (COM Call Stats)
+        //=========================================================================
+        .def("enable_stats", [](cpyhwpx::HwpWrapper&, bool enabled) {
+                 cpyhwpx::ComStats::SetEnabled(enabled);
+             },
+             py::arg("enabled") = true,
+             "COM 호출 계측 켜기/끄기 (프로세스 전역, 기본값 꺼짐)")
+        .def_property_readonly("stats_enabled", [](const cpyhwpx::HwpWrapper&) {
+                 return cpyhwpx::ComStats::IsEnabled();
+             },
+             "COM 호출 계측 여부")
+        .def("stats", [](cpyhwpx::HwpWrapper&, bool reset) {
+                 auto snapshot = cpyhwpx::ComStats::Snapshot();
+                 if (reset) {
+                     cpyhwpx::ComStats::Reset();
+                 }
+                 return snapshot;
+             },
+             py::arg("reset") = false,
+             R"doc(
+COM 호출 통계 스냅샷을 반환합니다.
+
+(인터페이스, 멤버, 종류)별 호출 수, 지연 히스토그램, BSTR 전송량을
+모든 스레드에서 합쳐 호출 수 내림차순으로 돌려줍니다.
+enable_stats()로 켠 뒤의 호출만 집계됩니다.
+
+Args:
+    reset: True면 스냅샷 후 누적값 초기화
+
+Returns:
+    ComCallStat 리스트
+
+Examples:
+    >>> hwp.enable_stats()
+    >>> hwp.insert_text("hello")
+    >>> for s in hwp.stats(reset=True)[:5]:
+    ...     print(s.interface_name, s.member, s.calls, s.percentile(0.99))
+)doc")
+        .def("reset_stats", [](cpyhwpx::HwpWrapper&) {
+                 cpyhwpx::ComStats::Reset();
+             },
+             "COM 호출 통계 초기화")
+
+        //=========================================================================
+        // 호출 추적 (Chrome trace-event)
+        //=========================================================================
+        .def("start_trace", [](cpyhwpx::HwpWrapper&, size_t events_per_thread) {
+                 cpyhwpx::ComTrace::Start(events_per_thread);
+             },
+             py::arg("events_per_thread") = 65536,
+             R"doc(
+호출 추적을 시작합니다 (기존 기록 삭제).
+
+Hwp 메서드, 그 안의 COM Invoke, HAction Run/Execute 액션 ID를
+스레드별 링 버퍼에 기록합니다. 가득 차면 오래된 이벤트부터 덮어씁니다.
+
+Args:
+    events_per_thread: 스레드당 최대 이벤트 수
+
+Examples:
+    >>> hwp.start_trace()
+    >>> run_mail_merge(hwp)
+    >>> hwp.stop_trace()
+    >>> hwp.save_trace("merge.json")  # Perfetto / chrome://tracing 에서 열기
+)doc")
+        .def("stop_trace", [](cpyhwpx::HwpWrapper&) {
+                 cpyhwpx::ComTrace::Stop();
+             },
+             "호출 추적 중지 (기록 유지)")
+        .def("clear_trace", [](cpyhwpx::HwpWrapper&) {
+                 cpyhwpx::ComTrace::Clear();
+             },
+             "추적 기록 삭제")
+        .def("get_trace_json", [](cpyhwpx::HwpWrapper&) {
+                 return cpyhwpx::ComTrace::ToJson();
+             },
+             "추적 기록을 Chrome trace-event JSON 문자열로 반환")
+        .def("save_trace", [](cpyhwpx::HwpWrapper&, const std::wstring& path) {
+                 return cpyhwpx::ComTrace::Save(path);
+             },
+             py::arg("path"),
+             "추적 기록을 Chrome trace-event JSON 파일로 저장");
 
     //=========================================================================
     // XHwpDocument 클래스 바인딩
@@ -1784,6 +2869,846 @@ Args:
         .def_static("nanum_myeongjo", &cpyhwpx::FontDefs::NanumMyeongjo,
                     "나눔명조 프리셋");
 
+    //=========================================================================
+    // TextChunkReader 클래스 바인딩
+    //=========================================================================
+
+    py::class_<cpyhwpx::TextChunkReader>(m, "TextChunkReader")
+        .def("__iter__", [](cpyhwpx::TextChunkReader& self) -> cpyhwpx::TextChunkReader& {
+            return self;
+        }, py::return_value_policy::reference_internal)
+        .def("__next__", [](cpyhwpx::TextChunkReader& self) {
+            cpyhwpx::BstrString chunk;
+            if (!self.Next(chunk)) {
+                throw py::stop_iteration();
+            }
+            return chunk;
+        })
+        .def("close", &cpyhwpx::TextChunkReader::Close,
+             "추출 중단 및 캐럿 위치 복원")
+        .def_property_readonly("chunk_index", &cpyhwpx::TextChunkReader::GetChunkIndex,
+             "지금까지 반환한 청크 수")
+        .def_property_readonly("para_count", &cpyhwpx::TextChunkReader::GetParaCount,
+             "본문 문단 수 (첫 청크 이후 유효)");
+
+    //=========================================================================
+    // BulkEditScope 클래스 바인딩
+    //=========================================================================
+
+    py::class_<cpyhwpx::BulkEditScope>(m, "BulkEditScope")
+        .def("__enter__", [](cpyhwpx::BulkEditScope& self) -> cpyhwpx::BulkEditScope& {
+            return self;
+        }, py::return_value_policy::reference_internal)
+        .def("__exit__", [](cpyhwpx::BulkEditScope& self, py::object, py::object, py::object) {
+            self.Restore();
+        })
+        .def("restore", &cpyhwpx::BulkEditScope::Restore,
+             "바꾼 설정을 되돌리고 범위 종료")
+        .def_property_readonly("active", &cpyhwpx::BulkEditScope::IsActive,
+             "아직 되돌리지 않았는지 여부")
+        .def_property_readonly("outermost", &cpyhwpx::BulkEditScope::IsOutermost,
+             "설정을 실제로 바꾼 가장 바깥 범위인지 여부");
+
+    //=========================================================================
+    // ComCallStat 클래스 바인딩
+    //=========================================================================
+
+    py::class_<cpyhwpx::ComCallStat>(m, "ComCallStat")
+        .def_readonly("interface_name", &cpyhwpx::ComCallStat::interface_name)
+        .def_readonly("member", &cpyhwpx::ComCallStat::member)
+        .def_readonly("kind", &cpyhwpx::ComCallStat::kind)
+        .def_readonly("calls", &cpyhwpx::ComCallStat::calls)
+        .def_readonly("failures", &cpyhwpx::ComCallStat::failures)
+        .def_readonly("total_ns", &cpyhwpx::ComCallStat::total_ns)
+        .def_readonly("max_ns", &cpyhwpx::ComCallStat::max_ns)
+        .def_readonly("bstr_bytes_out", &cpyhwpx::ComCallStat::bstr_bytes_out)
+        .def_readonly("bstr_bytes_in", &cpyhwpx::ComCallStat::bstr_bytes_in)
+        .def_readonly("histogram", &cpyhwpx::ComCallStat::histogram,
+                      "로그 구간 히스토그램 ([0]=1µs 미만, [i]=[2^(i-1), 2^i) µs)")
+        .def_property_readonly("mean_us", [](const cpyhwpx::ComCallStat& s) {
+            return s.calls ? static_cast<double>(s.total_ns) / s.calls / 1000.0 : 0.0;
+        }, "평균 지연 (µs)")
+        .def("percentile", &cpyhwpx::ComCallStat::Percentile,
+             py::arg("p"),
+             "백분위 지연 추정 (히스토그램 구간 상한, µs)")
+        .def("__repr__", [](const cpyhwpx::ComCallStat& s) {
+            return py::str("ComCallStat({}.{}, kind={}, calls={})")
+                .format(s.interface_name, s.member, s.kind, s.calls);
+        });
+
+    //=========================================================================
+    // PrivateInfoScanner 클래스 바인딩
+    //=========================================================================
+
+    py::class_<cpyhwpx::PrivateInfoMatch>(m, "PrivateInfoMatch")
+        .def(py::init<>())
+        .def_readwrite("type", &cpyhwpx::PrivateInfoMatch::type)
+        .def_readwrite("offset", &cpyhwpx::PrivateInfoMatch::offset)
+        .def_readwrite("length", &cpyhwpx::PrivateInfoMatch::length)
+        .def_readwrite("text", &cpyhwpx::PrivateInfoMatch::text)
+        .def("__repr__", [](const cpyhwpx::PrivateInfoMatch& p) {
+            return "PrivateInfoMatch(type=" + std::to_string(p.type) +
+                   ", offset=" + std::to_string(p.offset) +
+                   ", length=" + std::to_string(p.length) + ")";
+        });
+
+    py::class_<cpyhwpx::PrivateInfoScanner> pii(m, "PrivateInfoScanner");
+    pii.def_static("scan", &cpyhwpx::PrivateInfoScanner::Scan,
+                   py::arg("text"),
+                   py::arg("types") = cpyhwpx::PrivateInfoType::All,
+                   py::arg("validate_checksum") = true,
+                   "텍스트에서 개인정보 탐지 (SIMD 사전 필터 + 검증기)")
+       .def_static("mask", &cpyhwpx::PrivateInfoScanner::Mask,
+                   py::arg("text"),
+                   py::arg("matches"),
+                   py::arg("mask_char") = L'*',
+                   "탐지 결과 구간 마스킹 (구분자는 유지)")
+       .def_static("is_valid_rrn", &cpyhwpx::PrivateInfoScanner::IsValidRRN,
+                   py::arg("digits"),
+                   "주민등록번호 체크섬 검증 (숫자 13자리)")
+       .def_static("is_valid_foreign_rrn", &cpyhwpx::PrivateInfoScanner::IsValidForeignRRN,
+                   py::arg("digits"),
+                   "외국인등록번호 체크섬 검증 (숫자 13자리)")
+       .def_static("luhn_check", &cpyhwpx::PrivateInfoScanner::LuhnCheck,
+                   py::arg("digits"),
+                   "Luhn 체크섬 검증");
+
+    // 유형 상수 (HWP FindPrivateInfo 비트마스크와 동일)
+    pii.attr("PHONE") = cpyhwpx::PrivateInfoType::Phone;
+    pii.attr("RRN") = cpyhwpx::PrivateInfoType::RRN;
+    pii.attr("FOREIGN_RRN") = cpyhwpx::PrivateInfoType::ForeignRRN;
+    pii.attr("EMAIL") = cpyhwpx::PrivateInfoType::Email;
+    pii.attr("CREDIT_CARD") = cpyhwpx::PrivateInfoType::CreditCard;
+    pii.attr("PASSPORT") = cpyhwpx::PrivateInfoType::Passport;
+    pii.attr("ALL") = cpyhwpx::PrivateInfoType::All;
+
+    //=========================================================================
+    // Batch 클래스 바인딩
+    //=========================================================================
+
+    py::class_<cpyhwpx::HwpBatch>(m, "Batch", R"doc(
+작업 묶음. 작은 편집을 기록해 두었다가 한 번에 실행합니다.
+
+기록 메서드는 자기 자신을 반환하므로 이어서 호출할 수 있습니다.
+실행 중에는 GIL을 놓으며, AsyncHwp.submit_batch()로 넘기면 실행 스레드 왕복이 한 번입니다.
+
+Examples:
+    >>> b = cpyhwpx.Batch()
+    >>> b.move_to_field("이름").insert_text("홍길동").run("TableRightCell")
+    >>> b.execute_set("CharShape", "CharShape").item("Bold", True)
+    >>> results = b.execute(hwp)  # [True, True, True, True]
+)doc")
+        .def(py::init<>())
+        .def("run", &cpyhwpx::HwpBatch::RunAction,
+             py::arg("action_name"),
+             py::return_value_policy::reference_internal,
+             "HAction.Run(action_name) 기록")
+        .def("set_pos", &cpyhwpx::HwpBatch::SetPos,
+             py::arg("list"), py::arg("para"), py::arg("pos"),
+             py::return_value_policy::reference_internal,
+             "캐럿 위치 설정 기록")
+        .def("move_pos", &cpyhwpx::HwpBatch::MovePos,
+             py::arg("move_id"), py::arg("para") = 0, py::arg("pos") = 0,
+             py::return_value_policy::reference_internal,
+             "캐럿 이동 기록")
+        .def("insert_text", &cpyhwpx::HwpBatch::InsertText,
+             py::arg("text"),
+             py::return_value_policy::reference_internal,
+             "텍스트 삽입 기록")
+        .def("put_field_text", &cpyhwpx::HwpBatch::PutFieldText,
+             py::arg("field"), py::arg("text"),
+             py::return_value_policy::reference_internal,
+             "필드 텍스트 설정 기록")
+        .def("move_to_field", &cpyhwpx::HwpBatch::MoveToField,
+             py::arg("field"), py::arg("idx") = 0,
+             py::arg("text") = true, py::arg("start") = true, py::arg("select") = false,
+             py::return_value_policy::reference_internal,
+             "필드로 캐럿 이동 기록")
+        .def("execute_set", &cpyhwpx::HwpBatch::ExecuteSet,
+             py::arg("action_name"), py::arg("set_name"),
+             py::return_value_policy::reference_internal,
+             "파라미터셋 액션 실행 기록 (이어서 item()으로 값 지정)")
+        .def("item", py::overload_cast<const std::wstring&, bool>(&cpyhwpx::HwpBatch::Item),
+             py::arg("name"), py::arg("value"),
+             py::return_value_policy::reference_internal)
+        .def("item", py::overload_cast<const std::wstring&, int>(&cpyhwpx::HwpBatch::Item),
+             py::arg("name"), py::arg("value"),
+             py::return_value_policy::reference_internal)
+        .def("item", py::overload_cast<const std::wstring&, double>(&cpyhwpx::HwpBatch::Item),
+             py::arg("name"), py::arg("value"),
+             py::return_value_policy::reference_internal)
+        .def("item", py::overload_cast<const std::wstring&, const std::wstring&>(&cpyhwpx::HwpBatch::Item),
+             py::arg("name"), py::arg("value"),
+             py::return_value_policy::reference_internal,
+             "마지막 execute_set의 파라미터 값 기록 (bool/int/float/str)")
+        .def("execute", &cpyhwpx::HwpBatch::Execute,
+             py::arg("hwp"), py::arg("stop_on_error") = false,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+기록된 작업을 순서대로 실행합니다 (hwp를 만든 스레드에서 호출).
+
+Args:
+    hwp: 대상 Hwp
+    stop_on_error: True면 처음 실패한 작업 이후는 실행하지 않음
+
+Returns:
+    작업별 성공 여부 리스트
+)doc")
+        .def("append", &cpyhwpx::HwpBatch::Append,
+             py::arg("other"),
+             py::return_value_policy::reference_internal,
+             "다른 Batch의 작업을 뒤에 이어 붙임")
+        .def("to_bytes", [](const cpyhwpx::HwpBatch& self) {
+                 return py::bytes(self.ToBinary());
+             },
+             "바이너리 직렬화 (from_bytes로 복원)")
+        .def_static("from_bytes", [](const py::bytes& data) {
+                 cpyhwpx::HwpBatch batch;
+                 if (!cpyhwpx::HwpBatch::FromBinary(std::string(data), batch)) {
+                     throw py::value_error("Batch 바이너리 형식이 아닙니다");
+                 }
+                 return batch;
+             },
+             py::arg("data"),
+             "바이너리에서 복원 (끝이 잘린 작업은 버림)")
+        .def("save", &cpyhwpx::HwpBatch::SaveFile,
+             py::arg("path"),
+             "바이너리 파일로 저장")
+        .def_static("load", [](const std::wstring& path) {
+                 cpyhwpx::HwpBatch batch;
+                 if (!cpyhwpx::HwpBatch::LoadFile(path, batch)) {
+                     throw py::value_error("Batch 파일을 읽을 수 없습니다");
+                 }
+                 return batch;
+             },
+             py::arg("path"),
+             "바이너리 파일 또는 start_recording 로그에서 복원")
+        .def("to_json", &cpyhwpx::HwpBatch::ToJson,
+             "사람이 읽을 수 있는 JSON 문자열 (확인용, 다시 읽을 수 없음)")
+        .def("clear", &cpyhwpx::HwpBatch::Clear, "기록 삭제")
+        .def_property_readonly("skipped", &cpyhwpx::HwpBatch::SkippedCount,
+                               "재생할 수 없어 Skipped로 기록된 작업 수 (execute에서 False)")
+        .def("__len__", &cpyhwpx::HwpBatch::size);
+
+    //=========================================================================
+    // AsyncHwp 클래스 바인딩
+    //=========================================================================
+
+    g_hwpTimeoutError = py::register_exception<cpyhwpx::HwpTimeoutError>(
+        m, "HwpTimeoutError", PyExc_TimeoutError).ptr();
+
+    py::class_<cpyhwpx::AsyncHwp, std::unique_ptr<cpyhwpx::AsyncHwp, AsyncHwpDeleter>>(m, "AsyncHwp")
+        .def(py::init<bool, bool, bool>(),
+             py::arg("visible") = true,
+             py::arg("new_instance") = true,
+             py::arg("register_module") = true,
+             R"doc(
+전용 STA 스레드에서 한/글을 실행하는 비동기 자동화 객체를 생성합니다.
+
+한/글 초기화는 실행 스레드에서 진행되며 생성자는 곧바로 반환합니다.
+작업은 제출 순서대로 실행되고, 호출자는 결과를 기다리지 않고 계속 제출할 수 있습니다.
+
+Examples:
+    >>> hwp = cpyhwpx.AsyncHwp(visible=False)
+    >>> await hwp.call_async("insert_text", "안녕하세요")
+    >>> text = await hwp.submit_async(lambda h: h.get_text_file())
+    >>> hwp.close()
+)doc")
+        .def("submit", [](cpyhwpx::AsyncHwp& self, py::function fn, py::args args, py::kwargs kwargs) {
+                 return SubmitPyAsyncTask(self, MakePyAsyncTask(fn, py::none(), args, kwargs));
+             },
+             py::arg("fn"),
+             R"doc(
+fn(hwp, *args, **kwargs)를 실행 스레드에서 호출합니다.
+
+Returns:
+    concurrent.futures.Future. hwp 인자는 fn 안에서만 사용해야 합니다.
+)doc")
+        .def("submit_async", [](cpyhwpx::AsyncHwp& self, py::function fn, py::args args, py::kwargs kwargs) {
+                 py::object future = SubmitPyAsyncTask(self, MakePyAsyncTask(fn, py::none(), args, kwargs));
+                 return py::module_::import("asyncio").attr("wrap_future")(future);
+             },
+             py::arg("fn"),
+             "submit()의 asyncio 버전 (await 가능한 asyncio.Future 반환)")
+        .def("call", [](cpyhwpx::AsyncHwp& self, py::str method, py::args args, py::kwargs kwargs) {
+                 return SubmitPyAsyncTask(self, MakePyAsyncTask(py::none(), method, args, kwargs));
+             },
+             py::arg("method"),
+             R"doc(
+Hwp 메서드 이름으로 호출합니다: hwp.<method>(*args, **kwargs)
+
+Returns:
+    concurrent.futures.Future
+)doc")
+        .def("call_async", [](cpyhwpx::AsyncHwp& self, py::str method, py::args args, py::kwargs kwargs) {
+                 py::object future = SubmitPyAsyncTask(self, MakePyAsyncTask(py::none(), method, args, kwargs));
+                 return py::module_::import("asyncio").attr("wrap_future")(future);
+             },
+             py::arg("method"),
+             "call()의 asyncio 버전 (await 가능한 asyncio.Future 반환)")
+        .def("submit_with_timeout", [](cpyhwpx::AsyncHwp& self, int64_t timeout_ms, py::function fn,
+                                       py::args args, py::kwargs kwargs) {
+                 return SubmitPyAsyncTask(self, MakePyAsyncTask(fn, py::none(), args, kwargs),
+                                          timeout_ms > 0 ? timeout_ms : 0);
+             },
+             py::arg("timeout_ms"), py::arg("fn"),
+             R"doc(
+제한 시간을 지정해 submit()합니다 (0이면 제한 없음).
+
+제한 시간을 넘기면 호출을 취소하고 한/글을 종료한 뒤 새 인스턴스로 교체하며,
+future에는 HwpTimeoutError가 설정됩니다.
+)doc")
+        .def("call_with_timeout", [](cpyhwpx::AsyncHwp& self, int64_t timeout_ms, py::str method,
+                                     py::args args, py::kwargs kwargs) {
+                 return SubmitPyAsyncTask(self, MakePyAsyncTask(py::none(), method, args, kwargs),
+                                          timeout_ms > 0 ? timeout_ms : 0);
+             },
+             py::arg("timeout_ms"), py::arg("method"),
+             "제한 시간을 지정해 call()합니다 (0이면 제한 없음)")
+        .def("submit_batch", &SubmitPyBatch,
+             py::arg("batch"), py::arg("stop_on_error") = false,
+             R"doc(
+작업 묶음을 실행 스레드에서 한 번에 실행합니다 (제출 시점의 묶음을 복사).
+
+Returns:
+    작업별 성공 여부 리스트의 concurrent.futures.Future
+)doc")
+        .def("submit_batch_async", [](cpyhwpx::AsyncHwp& self, const cpyhwpx::HwpBatch& batch, bool stop_on_error) {
+                 py::object future = SubmitPyBatch(self, batch, stop_on_error);
+                 return py::module_::import("asyncio").attr("wrap_future")(future);
+             },
+             py::arg("batch"), py::arg("stop_on_error") = false,
+             "submit_batch()의 asyncio 버전")
+        .def("wait_ready", [](cpyhwpx::AsyncHwp& self) { return self.Ready().get(); },
+             py::call_guard<py::gil_scoped_release>(),
+             "한/글 초기화가 끝날 때까지 대기 (초기화 성공 여부 반환)")
+        .def_property_readonly("pending", &cpyhwpx::AsyncHwp::GetPendingCount,
+                               "대기 중이거나 실행 중인 작업 수")
+        .def_property_readonly("running", &cpyhwpx::AsyncHwp::IsRunning,
+                               "작업을 받는 중인지 여부")
+        .def_property("call_timeout_ms",
+                      [](const cpyhwpx::AsyncHwp& self) { return self.GetCallTimeout().count(); },
+                      [](cpyhwpx::AsyncHwp& self, int64_t ms) {
+                          self.SetCallTimeout(std::chrono::milliseconds(ms));
+                      },
+                      R"doc(
+제한 시간을 지정하지 않은 작업의 제한 시간 (밀리초, 0이면 제한 없음)
+
+모달 대화상자 등으로 한/글이 멈추면 워치독이 호출을 취소하고
+한/글을 종료한 뒤 새 인스턴스로 교체합니다. 해당 작업은 HwpTimeoutError로 끝납니다.
+)doc")
+        .def_property_readonly("watchdog_stats", [](const cpyhwpx::AsyncHwp& self) {
+                 py::dict d;
+                 d["timeouts"] = self.GetTimeoutCount();
+                 d["recoveries"] = self.GetRecoveryCount();
+                 d["healthy"] = self.IsHealthy();
+                 return d;
+             },
+             "시간 초과 수, 인스턴스 교체 수, 마지막 초기화 성공 여부")
+        .def("close", &cpyhwpx::AsyncHwp::Shutdown,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+새 작업을 막고, 이미 제출한 작업을 모두 실행한 뒤 실행 스레드를 종료합니다.
+
+한/글을 종료하려면 먼저 call("quit")을 제출하세요.
+)doc")
+        .def("__enter__", [](cpyhwpx::AsyncHwp& self) -> cpyhwpx::AsyncHwp& { return self; },
+             py::return_value_policy::reference)
+        .def("__exit__", [](cpyhwpx::AsyncHwp& self, py::object, py::object, py::object) {
+                 py::gil_scoped_release release;
+                 self.Shutdown();
+             });
+
+    //=========================================================================
+    // HwpInstancePool 클래스 바인딩
+    //=========================================================================
+
+    py::class_<cpyhwpx::HwpInstancePool::Lease, HwpLeaseHolder>(m, "HwpLease",
+        "HwpInstancePool에서 빌린 인스턴스 (with 블록을 벗어나거나 release()하면 반환)")
+        .def_property_readonly("hwp", [](py::object self) -> py::object {
+                                   return self.cast<cpyhwpx::HwpInstancePool::Lease&>() ? self : py::none();
+                               },
+                               "빌린 AsyncHwp 대신 쓰는 이 Lease (반환 후에는 None)")
+        .def_property_readonly("job_count", &cpyhwpx::HwpInstancePool::Lease::GetJobCount,
+                               "이 인스턴스가 이전에 처리한 대여 수")
+        .def("release", &cpyhwpx::HwpInstancePool::Lease::Release,
+             py::call_guard<py::gil_scoped_release>(),
+             "풀에 반환")
+        .def("discard", &cpyhwpx::HwpInstancePool::Lease::Discard,
+             "반환할 때 다시 쓰지 않고 종료 (작업이 실패했거나 멈춘 경우)")
+        .def("__bool__", [](const cpyhwpx::HwpInstancePool::Lease& self) { return static_cast<bool>(self); })
+        .def("__getattr__", [](py::object self, const std::string& name) -> py::object {
+                 // AsyncHwp 속성/메서드 전달 (메서드는 호출할 때마다 반환 여부 확인)
+                 cpyhwpx::AsyncHwp& hwp = LeasedHwp(self.cast<cpyhwpx::HwpInstancePool::Lease&>());
+                 py::object attr = py::getattr(py::cast(&hwp, py::return_value_policy::reference),
+                                               name.c_str());
+                 if (!PyCallable_Check(attr.ptr())) return attr;
+                 return py::cpp_function([self, name](py::args args, py::kwargs kwargs) {
+                     cpyhwpx::AsyncHwp& current = LeasedHwp(self.cast<cpyhwpx::HwpInstancePool::Lease&>());
+                     py::object method = py::getattr(py::cast(&current, py::return_value_policy::reference),
+                                                     name.c_str());
+                     return method(*args, **kwargs);
+                 });
+             },
+             "빌린 AsyncHwp의 속성/메서드 (반환 후에는 RuntimeError)")
+        .def("__enter__", [](py::object self) { return self; })
+        .def("__exit__", [](cpyhwpx::HwpInstancePool::Lease& self, py::object exc_type, py::object, py::object) {
+                 if (!exc_type.is_none()) self.Discard();
+                 py::gil_scoped_release release;
+                 self.Release();
+             });
+
+    py::class_<cpyhwpx::HwpInstancePool, std::unique_ptr<cpyhwpx::HwpInstancePool, HwpInstancePoolDeleter>>(m, "HwpInstancePool")
+        .def(py::init([](size_t warm_count, size_t max_jobs, size_t max_memory_bytes,
+                         bool visible, bool register_module, int64_t shutdown_timeout_ms) {
+                 cpyhwpx::HwpInstancePoolConfig config;
+                 config.warm_count = warm_count;
+                 config.max_jobs = max_jobs;
+                 config.max_memory_bytes = max_memory_bytes;
+                 config.visible = visible;
+                 config.register_module = register_module;
+                 config.shutdown_timeout = std::chrono::milliseconds(shutdown_timeout_ms > 0 ? shutdown_timeout_ms : 0);
+                 return new cpyhwpx::HwpInstancePool(config);
+             }),
+             py::arg("warm_count") = 2,
+             py::arg("max_jobs") = 100,
+             py::arg("max_memory_bytes") = 0,
+             py::arg("visible") = false,
+             py::arg("register_module") = true,
+             py::arg("shutdown_timeout_ms") = 10000,
+             R"doc(
+미리 띄워 둔 한/글 인스턴스 풀을 생성합니다.
+
+숨겨진 인스턴스 warm_count개를 각자의 실행 스레드에서 초기화해 두고,
+acquire()마다 하나씩 빌려 줍니다. 반환된 인스턴스는 문서만 비우고 다시 쓰며,
+max_jobs번 쓰였거나 한/글 프로세스 메모리가 max_memory_bytes를 넘으면 교체합니다 (0=제한 없음).
+shutdown()은 종료 중인 인스턴스를 shutdown_timeout_ms까지만 기다립니다.
+
+Examples:
+    >>> pool = cpyhwpx.HwpInstancePool(warm_count=2)
+    >>> with pool.acquire() as hwp:
+    ...     hwp.call("open", "a.hwp").result()
+    >>> pool.shutdown()
+
+with 블록의 hwp는 AsyncHwp 메서드를 그대로 전달하는 HwpLease이며,
+반환한 뒤에 호출하면 RuntimeError가 납니다.
+)doc")
+        .def("acquire", [](cpyhwpx::HwpInstancePool& self) {
+                 cpyhwpx::HwpInstancePool::Lease lease;
+                 {
+                     py::gil_scoped_release release;
+                     lease = self.Acquire();
+                 }
+                 return HwpLeaseHolder(new cpyhwpx::HwpInstancePool::Lease(std::move(lease)));
+             },
+             R"doc(
+인스턴스를 빌립니다 (대기 인스턴스가 초기화 중이면 끝날 때까지 대기).
+
+with 블록에서 예외가 나면 그 인스턴스는 다시 쓰지 않고 종료합니다.
+초기화에 실패했거나 종료된 풀이면 빈 HwpLease(bool 값 False)를 반환합니다.
+)doc")
+        .def("shutdown", &cpyhwpx::HwpInstancePool::Shutdown,
+             py::call_guard<py::gil_scoped_release>(),
+             "대기 인스턴스를 종료 (빌려 간 인스턴스는 반환될 때 종료)")
+        .def_property_readonly("pool_stats", [](const cpyhwpx::HwpInstancePool& self) {
+                 py::dict d;
+                 d["idle"] = self.GetIdleCount();
+                 d["leased"] = self.GetLeasedCount();
+                 d["warm_hits"] = self.GetWarmHitCount();
+                 d["cold_starts"] = self.GetColdStartCount();
+                 d["recycled"] = self.GetRecycleCount();
+                 return d;
+             },
+             "대기/대여 인스턴스 수, 바로 준 횟수, 새로 띄운 횟수, 교체 수")
+        .def("__enter__", [](cpyhwpx::HwpInstancePool& self) -> cpyhwpx::HwpInstancePool& { return self; },
+             py::return_value_policy::reference)
+        .def("__exit__", [](cpyhwpx::HwpInstancePool& self, py::object, py::object, py::object) {
+                 py::gil_scoped_release release;
+                 self.Shutdown();
+             });
+
+    //=========================================================================
+    // BatchConverter 클래스 바인딩
+    //=========================================================================
+
+    py::class_<cpyhwpx::BatchConvertResult>(m, "BatchConvertResult", "BatchConverter 파일별 결과")
+        .def_readonly("input", &cpyhwpx::BatchConvertResult::input)
+        .def_readonly("output", &cpyhwpx::BatchConvertResult::output)
+        .def_property_readonly("status", [](const cpyhwpx::BatchConvertResult& self) {
+                                   return std::string(cpyhwpx::ConvertStatusName(self.status));
+                               },
+                               "\"converted\", \"skipped\", \"failed\", \"timeout\"")
+        .def_readonly("attempts", &cpyhwpx::BatchConvertResult::attempts)
+        .def_readonly("open_ms", &cpyhwpx::BatchConvertResult::open_ms)
+        .def_readonly("save_ms", &cpyhwpx::BatchConvertResult::save_ms)
+        .def_readonly("total_ms", &cpyhwpx::BatchConvertResult::total_ms)
+        .def_readonly("input_size", &cpyhwpx::BatchConvertResult::input_size)
+        .def_readonly("output_size", &cpyhwpx::BatchConvertResult::output_size)
+        .def_readonly("error", &cpyhwpx::BatchConvertResult::error)
+        .def_property_readonly("ok", [](const cpyhwpx::BatchConvertResult& self) {
+                                   return self.status == cpyhwpx::ConvertStatus::Converted ||
+                                          self.status == cpyhwpx::ConvertStatus::Skipped;
+                               },
+                               "변환했거나 최신이라 건너뛰었는지")
+        .def("__repr__", [](const cpyhwpx::BatchConvertResult& self) {
+                 return "<BatchConvertResult " + std::string(cpyhwpx::ConvertStatusName(self.status)) +
+                        " attempts=" + std::to_string(self.attempts) + ">";
+             });
+
+    py::class_<cpyhwpx::BatchConverter, std::unique_ptr<cpyhwpx::BatchConverter, BatchConverterDeleter>>(m, "BatchConverter")
+        .def(py::init([](const std::wstring& format, const std::wstring& output_dir, size_t workers,
+                         int64_t timeout_ms, int retries, bool skip_up_to_date,
+                         const std::wstring& manifest, const std::wstring& extension,
+                         const std::wstring& open_arg, const std::wstring& save_arg,
+                         size_t max_jobs_per_instance, bool visible) {
+                 cpyhwpx::BatchConvertConfig config;
+                 config.format = format;
+                 config.output_dir = output_dir;
+                 config.workers = workers;
+                 config.timeout = std::chrono::milliseconds(timeout_ms > 0 ? timeout_ms : 0);
+                 config.retries = retries;
+                 config.skip_up_to_date = skip_up_to_date;
+                 config.manifest_path = manifest;
+                 config.extension = extension;
+                 config.open_arg = open_arg;
+                 config.save_arg = save_arg;
+                 config.max_jobs_per_instance = max_jobs_per_instance;
+                 config.visible = visible;
+                 return new cpyhwpx::BatchConverter(config);
+             }),
+             py::arg("format") = L"PDF",
+             py::arg("output_dir") = L"",
+             py::arg("workers") = 2,
+             py::arg("timeout_ms") = 120000,
+             py::arg("retries") = 1,
+             py::arg("skip_up_to_date") = true,
+             py::arg("manifest") = L"",
+             py::arg("extension") = L"",
+             py::arg("open_arg") = L"forceopen:true",
+             py::arg("save_arg") = L"",
+             py::arg("max_jobs_per_instance") = 200,
+             py::arg("visible") = false,
+             R"doc(
+여러 한/글 인스턴스로 파일을 일괄 변환하는 변환기를 생성합니다.
+
+숨겨진 인스턴스 workers개를 미리 띄워 두고, run()마다 파일을 나눠 Open → SaveAs 합니다.
+파일당 timeout_ms를 넘기면 인스턴스를 교체하고 retries번까지 다시 시도하며 (0=제한 없음),
+skip_up_to_date이면 출력이 비어 있지 않고 입력보다 새로운 파일은 건너뜁니다
+(이전에 기록한 입력/출력 크기와 다르면 다시 변환).
+manifest를 주면 파일마다 결과를 JSONL 한 줄로 기록하고, 다음 run()에서 크기 기록을 읽습니다.
+출력 경로가 겹치는 입력은 변환하지 않고 "output path collision"으로 실패합니다.
+
+Args:
+    format: SaveAs 형식 ("PDF", "HWPX", "TEXT", "HTML", "HWP" ...)
+    output_dir: 출력 디렉터리 (비우면 입력 파일과 같은 디렉터리, 없으면 생성).
+        패턴으로 run()하면 패턴 기준 하위 디렉터리를 그대로 만듭니다
+    extension: 출력 확장자 (비우면 형식에서 결정)
+
+Examples:
+    >>> conv = cpyhwpx.BatchConverter("PDF", output_dir="D:/pdf", workers=4, manifest="D:/pdf/log.jsonl")
+    >>> results = conv.run("D:/archive/**/*.hwp", progress=lambda r, done, total: print(done, total, r.status))
+    >>> failed = [r.input for r in results if not r.ok]
+)doc")
+        .def("run", [](cpyhwpx::BatchConverter& self, py::object inputs, py::object progress) {
+                 std::vector<std::wstring> files;
+                 std::wstring root;
+                 if (py::isinstance<py::str>(inputs)) {
+                     std::wstring pattern = inputs.cast<std::wstring>();
+                     files = cpyhwpx::BatchConverter::ExpandGlob(pattern);
+                     root = cpyhwpx::BatchConverter::GlobRoot(pattern);
+                 } else {
+                     files = inputs.cast<std::vector<std::wstring>>();
+                 }
+
+                 cpyhwpx::BatchConverter::Progress callback;
+                 if (!progress.is_none()) {
+                     callback = [progress](const cpyhwpx::BatchConvertResult& result, size_t done, size_t total) {
+                         py::gil_scoped_acquire acquire;
+                         progress(result, done, total);
+                     };
+                 }
+
+                 py::gil_scoped_release release;
+                 return self.Run(files, callback, root);
+             },
+             py::arg("inputs"),
+             py::arg("progress") = py::none(),
+             R"doc(
+파일을 변환하고 모두 끝날 때까지 기다립니다.
+
+Args:
+    inputs: 파일 경로 목록 또는 패턴 문자열 (예: "D:/archive/**/*.hwp", "**"는 하위 디렉터리 포함)
+    progress: 파일 하나가 끝날 때마다 progress(result, done, total) 호출 (run()을 부른 스레드에서)
+
+Returns:
+    입력 순서대로의 BatchConvertResult 목록
+)doc")
+        .def_static("expand_glob", &cpyhwpx::BatchConverter::ExpandGlob,
+                    py::arg("pattern"),
+                    "패턴에 맞는 파일 경로 목록 (이름순)")
+        .def("output_path_for", &cpyhwpx::BatchConverter::OutputPathFor,
+             py::arg("input"),
+             py::arg("input_root") = L"",
+             "입력 파일의 출력 경로 (input_root 아래 파일은 상대 디렉터리를 output_dir 아래에 유지)")
+        .def("shutdown", &cpyhwpx::BatchConverter::Shutdown,
+             py::call_guard<py::gil_scoped_release>(),
+             "한/글 인스턴스 종료")
+        .def_property_readonly("converter_stats", [](const cpyhwpx::BatchConverter& self) {
+                 py::dict d;
+                 d["converted"] = self.GetConvertedCount();
+                 d["skipped"] = self.GetSkippedCount();
+                 d["failed"] = self.GetFailedCount();
+                 d["timeouts"] = self.GetTimeoutCount();
+                 d["retries"] = self.GetRetryCount();
+                 return d;
+             },
+             "변환/건너뜀/실패/시간 초과 파일 수와 재시도 횟수 (누적)")
+        .def("__enter__", [](cpyhwpx::BatchConverter& self) -> cpyhwpx::BatchConverter& { return self; },
+             py::return_value_policy::reference)
+        .def("__exit__", [](cpyhwpx::BatchConverter& self, py::object, py::object, py::object) {
+                 py::gil_scoped_release release;
+                 self.Shutdown();
+             });
+
+    //=========================================================================
+    // HwpxWriter 클래스 바인딩
+    //=========================================================================
+
+    py::class_<cpyhwpx::HwpxTable>(m, "HwpxTable", "HwpxWriter 표 (글자처럼 취급)")
+        .def(py::init<int, int>(), py::arg("rows"), py::arg("cols"))
+        .def_static("from_rows", &cpyhwpx::HwpxTable::FromRows,
+                    py::arg("rows"),
+                    py::arg("char_shape") = 0,
+                    py::arg("para_shape") = 0,
+                    "2차원 문자열 목록으로 표 만들기 (열 수는 가장 긴 행)")
+        .def_readonly("rows", &cpyhwpx::HwpxTable::rows)
+        .def_readonly("cols", &cpyhwpx::HwpxTable::cols)
+        .def_readwrite("col_widths", &cpyhwpx::HwpxTable::col_widths, "열 너비 목록 (HwpUnit, 비우면 본문 너비를 똑같이 나눔)")
+        .def_readwrite("border_fill", &cpyhwpx::HwpxTable::border_fill, "add_border_fill() ID (0이면 기본 실선)")
+        .def_readwrite("repeat_header", &cpyhwpx::HwpxTable::repeat_header, "쪽이 넘어가면 첫 줄 반복")
+        .def("set_text", &cpyhwpx::HwpxTable::SetText,
+             py::arg("row"), py::arg("col"), py::arg("text"),
+             py::arg("char_shape") = 0,
+             py::arg("para_shape") = 0,
+             "칸 내용 바꾸기 (\\n은 문단 나눔, 병합으로 가려진 칸이면 False)")
+        .def("set_cell_border_fill", [](cpyhwpx::HwpxTable& self, int row, int col, int border_fill) {
+                 cpyhwpx::HwpxCell* cell = self.Cell(row, col);
+                 if (!cell) return false;
+                 cell->border_fill = border_fill;
+                 return true;
+             },
+             py::arg("row"), py::arg("col"), py::arg("border_fill"),
+             "칸 테두리/배경 (add_border_fill() ID)")
+        .def("merge", &cpyhwpx::HwpxTable::Merge,
+             py::arg("row"), py::arg("col"), py::arg("row_span"), py::arg("col_span"),
+             "(row, col)부터 row_span x col_span 칸 병합");
+
+    py::class_<cpyhwpx::HwpxParagraph>(m, "HwpxParagraph", "HwpxWriter 문단")
+        .def(py::init([](int para_shape, bool page_break) {
+                 cpyhwpx::HwpxParagraph paragraph;
+                 paragraph.para_shape = para_shape;
+                 paragraph.page_break = page_break;
+                 return paragraph;
+             }),
+             py::arg("para_shape") = 0,
+             py::arg("page_break") = false)
+        .def_readwrite("para_shape", &cpyhwpx::HwpxParagraph::para_shape)
+        .def_readwrite("page_break", &cpyhwpx::HwpxParagraph::page_break)
+        .def("add_text", &cpyhwpx::HwpxParagraph::AddText,
+             py::arg("text"), py::arg("char_shape") = 0,
+             py::return_value_policy::reference_internal,
+             "글자 추가 (\\t 탭, \\n 줄 바꿈)")
+        .def("add_field", &cpyhwpx::HwpxParagraph::AddField,
+             py::arg("name"), py::arg("text") = L"", py::arg("char_shape") = 0,
+             py::return_value_policy::reference_internal,
+             "누름틀 추가")
+        .def("add_picture", &cpyhwpx::HwpxParagraph::AddPicture,
+             py::arg("image"), py::arg("width") = 0, py::arg("height") = 0,
+             py::return_value_policy::reference_internal,
+             "그림 추가 (HwpxWriter.add_image() ID, 크기를 하나만 주면 비율 유지)")
+        .def("add_table", &cpyhwpx::HwpxParagraph::AddTable,
+             py::arg("table"),
+             py::return_value_policy::reference_internal,
+             "표 추가 (표를 복사하므로 이후 변경은 반영되지 않음)");
+
+    py::class_<cpyhwpx::HwpxWriter>(m, "HwpxWriter")
+        .def(py::init<>(), R"doc(
+한/글 없이 HWPX 문서를 만드는 쓰기 객체를 생성합니다.
+
+문단을 추가하는 대로 섹션 XML을 압축해 파일에 쓰므로, 수만 쪽짜리 보고서도
+문서 크기만큼 메모리를 쓰지 않고 COM 호출 없이 만들 수 있습니다.
+같은 글자/문단 모양은 한 번만 등록되고 같은 ID를 돌려받습니다 (ID 0은 기본 모양).
+
+Examples:
+    >>> w = cpyhwpx.HwpxWriter()
+    >>> title = cpyhwpx.CharShape(); title.Bold = True; title.Height = 1600
+    >>> center = cpyhwpx.ParaShape(); center.Align = cpyhwpx.HAlign.Center
+    >>> with w:
+    ...     w.open("D:/report.hwpx")
+    ...     w.add_text("월간 보고서", w.add_char_shape(title), w.add_para_shape(center))
+    ...     w.add_table([["항목", "값"], ["매출", "1,234"]])
+    ...     w.add_paragraph(cpyhwpx.HwpxParagraph().add_text("담당: ").add_field("name", "홍길동"))
+)doc")
+        .def("open", &cpyhwpx::HwpxWriter::Open,
+             py::arg("path"),
+             py::arg("level") = 6,
+             py::arg("threads") = 0,
+             "파일 열기 (level: Deflate 압축 수준 0~9, threads: 압축 스레드 수, 0=CPU 수)")
+        .def("close", &cpyhwpx::HwpxWriter::Close,
+             py::call_guard<py::gil_scoped_release>(),
+             "header.xml/이미지/패키지 정보를 쓰고 파일 닫기")
+        .def_property_readonly("is_open", &cpyhwpx::HwpxWriter::IsOpen)
+        .def("add_char_shape", &cpyhwpx::HwpxWriter::AddCharShape,
+             py::arg("shape"),
+             "글자 모양 등록, ID 반환")
+        .def("add_para_shape", &cpyhwpx::HwpxWriter::AddParaShape,
+             py::arg("shape"),
+             "문단 모양 등록, ID 반환")
+        .def("add_border_fill", [](cpyhwpx::HwpxWriter& self, bool border, int border_color, int fill_color) {
+                 cpyhwpx::HwpxBorderFill fill;
+                 fill.border = border;
+                 fill.border_color = border_color;
+                 fill.fill_color = fill_color;
+                 return self.AddBorderFill(fill);
+             },
+             py::arg("border") = true,
+             py::arg("border_color") = 0,
+             py::arg("fill_color") = -1,
+             "표/칸 테두리·배경 등록, ID 반환 (색은 RGB(), fill_color=-1이면 배경 없음)")
+        .def("add_image", &cpyhwpx::HwpxWriter::AddImage,
+             py::arg("path"),
+             "이미지 파일 등록, ID 반환 (실패 시 0)")
+        .def("add_image_data", [](cpyhwpx::HwpxWriter& self, py::bytes data, const std::wstring& extension) {
+                 return self.AddImageData(std::string(data), extension);
+             },
+             py::arg("data"),
+             py::arg("extension") = L"png",
+             "이미지 데이터 등록, ID 반환")
+        .def("begin_section", [](cpyhwpx::HwpxWriter& self, int width, int height, bool landscape,
+                                 int left, int right, int top, int bottom, int header, int footer, int gutter) {
+                 cpyhwpx::HwpxPageDef page;
+                 page.width = width;
+                 page.height = height;
+                 page.landscape = landscape;
+                 page.left = left;
+                 page.right = right;
+                 page.top = top;
+                 page.bottom = bottom;
+                 page.header = header;
+                 page.footer = footer;
+                 page.gutter = gutter;
+                 return self.BeginSection(page);
+             },
+             py::arg("width") = 59528,
+             py::arg("height") = 84186,
+             py::arg("landscape") = false,
+             py::arg("left") = 8504,
+             py::arg("right") = 8504,
+             py::arg("top") = 5668,
+             py::arg("bottom") = 4252,
+             py::arg("header") = 4252,
+             py::arg("footer") = 4252,
+             py::arg("gutter") = 0,
+             "새 섹션 시작 (HwpUnit, 기본 A4 세로)")
+        .def("add_paragraph", &cpyhwpx::HwpxWriter::AddParagraph,
+             py::arg("paragraph"),
+             py::call_guard<py::gil_scoped_release>(),
+             "문단 추가 (없는 모양/이미지 ID면 False)")
+        .def("add_text", &cpyhwpx::HwpxWriter::AddText,
+             py::arg("text"),
+             py::arg("char_shape") = 0,
+             py::arg("para_shape") = 0,
+             py::call_guard<py::gil_scoped_release>(),
+             "글자만 있는 문단 추가 (\\n마다 문단 나눔)")
+        .def("add_table", [](cpyhwpx::HwpxWriter& self, py::object table, int char_shape, int para_shape) {
+                 cpyhwpx::HwpxParagraph paragraph;
+                 if (py::isinstance<cpyhwpx::HwpxTable>(table)) {
+                     paragraph.AddTable(table.cast<const cpyhwpx::HwpxTable&>());
+                 } else {
+                     paragraph.AddTable(cpyhwpx::HwpxTable::FromRows(
+                         table.cast<std::vector<std::vector<std::wstring>>>(), char_shape, para_shape));
+                 }
+                 py::gil_scoped_release release;
+                 return self.AddParagraph(paragraph);
+             },
+             py::arg("table"),
+             py::arg("char_shape") = 0,
+             py::arg("para_shape") = 0,
+             "표 하나로 된 문단 추가 (HwpxTable 또는 2차원 문자열 목록)")
+        .def_static("rewrite_package", [](const std::wstring& source, const std::wstring& dest,
+                                          const std::map<std::string, py::bytes>& parts, int level, size_t threads) {
+                        std::map<std::string, std::string> data;
+                        for (const auto& part : parts) {
+                            data[part.first] = std::string(part.second);
+                        }
+                        py::gil_scoped_release release;
+                        return cpyhwpx::HwpxWriter::RewritePackage(source, dest, data, level, threads);
+                    },
+                    py::arg("source"),
+                    py::arg("dest"),
+                    py::arg("parts"),
+                    py::arg("level") = 6,
+                    py::arg("threads") = 0,
+                    R"doc(
+기존 HWPX의 일부 항목만 바꿔 새 파일로 씁니다.
+
+parts에 없는 항목(이미지, 바뀌지 않은 섹션 등)은 풀지 않고 압축된 그대로 복사하고,
+바뀐 항목만 여러 스레드에서 압축합니다.
+새 파일은 dest 옆 임시 파일에 다 쓴 뒤 dest로 바꾸므로 source와 dest가 같아도 되고,
+실패하면 dest는 건드리지 않습니다.
+
+Args:
+    parts: {항목 이름: 새 내용(bytes)} (예: {"Contents/section0.xml": xml})
+
+Examples:
+    >>> xml = cpyhwpx.HwpxWriter.read_part("D:/a.hwpx", "Contents/section0.xml")
+    >>> xml = xml.replace("{{날짜}}".encode(), "2026-10-19".encode())
+    >>> cpyhwpx.HwpxWriter.rewrite_package("D:/a.hwpx", "D:/b.hwpx", {"Contents/section0.xml": xml})
+)doc")
+        .def_static("read_part", [](const std::wstring& path, const std::string& name) -> py::object {
+                        std::string data;
+                        bool ok;
+                        {
+                            py::gil_scoped_release release;
+                            ok = cpyhwpx::HwpxWriter::ReadPart(path, name, data);
+                        }
+                        if (!ok) return py::none();
+                        return py::bytes(data);
+                    },
+                    py::arg("path"),
+                    py::arg("name"),
+                    "HWPX 항목 하나를 풀어서 bytes로 반환 (없으면 None)")
+        .def_property_readonly("writer_stats", [](const cpyhwpx::HwpxWriter& self) {
+                 py::dict d;
+                 d["sections"] = self.GetSectionCount();
+                 d["paragraphs"] = self.GetParagraphCount();
+                 d["char_shapes"] = self.GetCharShapeCount();
+                 d["para_shapes"] = self.GetParaShapeCount();
+                 d["xml_bytes"] = self.GetXmlBytes();
+                 d["bytes_written"] = self.GetBytesWritten();
+                 d["threads"] = self.GetThreads();
+                 return d;
+             },
+             "섹션/문단 수, 등록된 모양 수, 압축 전 섹션 XML 크기, 쓴 파일 크기와 압축 스레드 수")
+        .def("__enter__", [](cpyhwpx::HwpxWriter& self) -> cpyhwpx::HwpxWriter& { return self; },
+             py::return_value_policy::reference)
+        .def("__exit__", [](cpyhwpx::HwpxWriter& self, py::object, py::object, py::object) {
+                 py::gil_scoped_release release;
+                 if (self.IsOpen()) self.Close();
+             });
+
+    //=========================================================================
+    // EditKind 서브모듈 (편집 종류 비트)
+    //=========================================================================
+
+    py::module_ edit_kind = m.def_submodule("EditKind", "편집 종류 (비트 조합)");
+    edit_kind.attr("NONE") = cpyhwpx::EditKind::None;
+    edit_kind.attr("CARET") = cpyhwpx::EditKind::Caret;
+    edit_kind.attr("LAYOUT") = cpyhwpx::EditKind::Layout;
+    edit_kind.attr("CONTENT") = cpyhwpx::EditKind::Content;
+    edit_kind.attr("DOCUMENT") = cpyhwpx::EditKind::Document;
+    edit_kind.attr("ALL") = cpyhwpx::EditKind::All;
+
     //=========================================================================
     // Utils 서브모듈
     //=========================================================================
@@ -2538,4 +4463,35 @@ Args:
     actions.def("SplitMemoClose", &cpyhwpx::HwpActionHelper::SplitMemoClose, py::arg("hwp"), "메모 분할 닫기");
     actions.def("SplitMemoOpen", &cpyhwpx::HwpActionHelper::SplitMemoOpen, py::arg("hwp"), "메모 분할 열기");
     actions.def("SplitMainActive", &cpyhwpx::HwpActionHelper::SplitMainActive, py::arg("hwp"), "메인 분할 활성화");
+
+#if defined(CPYHWPX_PYTHON_TESTING)
+    //=========================================================================
+    // 테스트 전용 (tests/CMakeLists.txt가 테스트 빌드에서만 켬)
+    //=========================================================================
+
+    py::module_ testing = m.def_submodule("_testing", "가짜 한/글 (테스트 전용)");
+
+    py::class_<FakeHwpHandle>(testing, "FakeHwp")
+        .def("unhang", [](FakeHwpHandle& self) { self.fake->Unhang(); },
+             "멈춘 호출 풀기 (이후 hang_on 호출은 바로 실패)");
+
+    testing.def("fake_async_hwp", [](const std::wstring& hang_on) {
+                    cpyhwpx::bench::FakeHwpConfig config;
+                    config.hang_on = hang_on;
+                    FakeHwpHandle handle{ std::shared_ptr<cpyhwpx::bench::FakeHwpObject>(
+                        new cpyhwpx::bench::FakeHwpObject(config),
+                        [](cpyhwpx::bench::FakeHwpObject* p) { p->Release(); }) };
+                    auto fake = handle.fake;
+                    std::unique_ptr<cpyhwpx::AsyncHwp, AsyncHwpDeleter> async(
+                        new cpyhwpx::AsyncHwp(false, false, false, [fake](cpyhwpx::HwpWrapper& hwp) {
+                            return hwp.Attach(fake.get());
+                        }));
+                    return py::make_tuple(py::cast(std::move(async)), py::cast(std::move(handle)));
+                },
+                py::arg("hang_on") = L"",
+                "가짜 한/글을 붙인 (AsyncHwp, FakeHwp)");
+    testing.def("set_fake_latency_ns", &cpyhwpx::bench::FakeDispatch::SetLatency,
+                py::arg("latency_ns"),
+                "가짜 COM 호출 1회당 지연 (busy-wait, 프로세스 전역)");
+#endif
 }
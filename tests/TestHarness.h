@@ -0,0 +1,70 @@
+/**
+ * @file TestHarness.h
+ * @brief 단위 테스트용 최소 검사 매크로 (외부 의존성 없음)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 실패한 CHECK는 위치를 출력하고 계속 진행하며, main은 실패가 있으면 1을 반환한다.
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+namespace cpyhwpx {
+namespace test {
+
+struct TestCase {
+    const char* name;
+    std::function<void()> fn;
+};
+
+inline std::vector<TestCase>& Registry()
+{
+    static std::vector<TestCase> tests;
+    return tests;
+}
+
+inline int& FailureCount()
+{
+    static int failures = 0;
+    return failures;
+}
+
+struct Registrar {
+    Registrar(const char* name, std::function<void()> fn) { Registry().push_back({name, std::move(fn)}); }
+};
+
+/**
+ * @brief 등록된 테스트를 모두 실행
+ * @return 실패가 있으면 1
+ */
+inline int RunAll()
+{
+    for (const TestCase& test : Registry()) {
+        int before = FailureCount();
+        test.fn();
+        std::printf("[%s] %s\n", FailureCount() == before ? " OK " : "FAIL", test.name);
+    }
+    return FailureCount() == 0 ? 0 : 1;
+}
+
+} // namespace test
+} // namespace cpyhwpx
+
+#define CPYHWPX_TEST(name) \
+    static void name(); \
+    static ::cpyhwpx::test::Registrar name##_registrar(#name, name); \
+    static void name()
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            ++::cpyhwpx::test::FailureCount(); \
+        } \
+    } while (0)
+
+#define CPYHWPX_TEST_MAIN() \
+    int main() { return ::cpyhwpx::test::RunAll(); }
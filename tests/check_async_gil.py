@@ -0,0 +1,90 @@
+# -*- coding: utf-8 -*-
+"""AsyncHwp가 COM 호출 동안 GIL을 놓는지, 시간 초과 future가 마감 시각에 끝나는지 확인
+
+테스트 빌드의 cpyhwpx._testing (가짜 한/글) 사용
+"""
+import sys
+import threading
+import time
+
+sys.path.insert(0, sys.argv[1] if len(sys.argv) > 1 else ".")
+
+import cpyhwpx
+from cpyhwpx import _testing
+
+
+def check_slow_call_lets_other_threads_run(failures):
+    hwp, fake = _testing.fake_async_hwp()
+    if not hwp.wait_ready():
+        failures.append("fake AsyncHwp did not initialize")
+        return
+
+    ticks = []
+    stop = threading.Event()
+
+    def spin():
+        while not stop.is_set():
+            ticks.append(time.monotonic())
+            time.sleep(0.001)
+
+    _testing.set_fake_latency_ns(100 * 1000 * 1000)     # COM 호출 1회당 0.1초
+    try:
+        spinner = threading.Thread(target=spin)
+        spinner.start()
+        begin = time.monotonic()
+        hwp.call("get_text_file").result(timeout=30)
+        end = time.monotonic()
+        stop.set()
+        spinner.join()
+    finally:
+        _testing.set_fake_latency_ns(0)
+        hwp.close()
+
+    during = [t for t in ticks if begin < t < end]
+    print("slow call %.2fs, other thread ran %d times" % (end - begin, len(during)))
+    if end - begin < 0.1:
+        failures.append("fake call was not slow (%.3fs)" % (end - begin))
+    elif len(during) < 10:
+        failures.append("other thread stalled during the call (%d ticks)" % len(during))
+
+
+def check_timeout_fails_future_at_deadline(failures):
+    # Open에서 멈춘 호출: future는 호출이 풀리기 전에 마감 시각에 실패해야 함
+    hwp, fake = _testing.fake_async_hwp("Open")
+    if not hwp.wait_ready():
+        failures.append("fake AsyncHwp did not initialize")
+        return
+
+    try:
+        begin = time.monotonic()
+        future = hwp.call_with_timeout(200, "open", "hang.hwp")
+        try:
+            error = future.exception(timeout=10)
+        except Exception as e:
+            error = e
+        elapsed = time.monotonic() - begin
+        still_hung = hwp.pending
+    finally:
+        fake.unhang()
+        hwp.close()
+
+    print("timed out after %.2fs (%r)" % (elapsed, error))
+    if not isinstance(error, cpyhwpx.HwpTimeoutError):
+        failures.append("expected HwpTimeoutError, got %r" % (error,))
+    elif elapsed > 1.0:
+        failures.append("future failed %.2fs after submit (deadline 0.2s)" % elapsed)
+    if still_hung != 1:
+        failures.append("call was not hung when the future failed (pending=%d)" % still_hung)
+
+
+def main():
+    failures = []
+    check_slow_call_lets_other_threads_run(failures)
+    check_timeout_fails_future_at_deadline(failures)
+    for failure in failures:
+        print("FAIL " + failure)
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
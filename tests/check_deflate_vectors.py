@@ -0,0 +1,41 @@
+# -*- coding: utf-8 -*-
+"""test_deflate가 남긴 raw deflate 스트림을 zlib으로 풀어 입력과 비교"""
+import os
+import re
+import sys
+import zlib
+
+
+def main(vector_dir):
+    inputs = {}
+    checked = 0
+    failures = 0
+    for name in sorted(os.listdir(vector_dir)):
+        match = re.match(r"(.+)_(\d+)\.deflate$", name)
+        if not match:
+            continue
+        size = match.group(2)
+        if size not in inputs:
+            with open(os.path.join(vector_dir, "input_%s.bin" % size), "rb") as f:
+                inputs[size] = f.read()
+        with open(os.path.join(vector_dir, name), "rb") as f:
+            data = f.read()
+
+        d = zlib.decompressobj(-15)
+        try:
+            out = d.decompress(data) + d.flush()
+        except zlib.error as e:
+            print("FAIL %s: %s" % (name, e))
+            failures += 1
+            continue
+        if out != inputs[size] or not d.eof or d.unused_data:
+            print("FAIL %s: %d bytes, eof=%s, unused=%d" % (name, len(out), d.eof, len(d.unused_data)))
+            failures += 1
+        checked += 1
+
+    print("%d streams checked with zlib %s" % (checked, zlib.ZLIB_VERSION))
+    return 1 if failures or checked == 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1]))
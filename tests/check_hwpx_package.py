@@ -0,0 +1,47 @@
+# -*- coding: utf-8 -*-
+"""test_hwpx_writer가 남긴 HWPX를 zipfile/ElementTree로 확인"""
+import sys
+import zipfile
+import xml.etree.ElementTree as ET
+
+XML_SUFFIXES = (".xml", ".hpf", ".rdf")
+
+
+def main(path):
+    failures = []
+    with zipfile.ZipFile(path) as z:
+        bad = z.testzip()
+        if bad:
+            failures.append("CRC mismatch: %s" % bad)
+
+        infos = z.infolist()
+        if not infos or infos[0].filename != "mimetype":
+            failures.append("mimetype is not the first entry")
+        elif infos[0].compress_type != zipfile.ZIP_STORED:
+            failures.append("mimetype is compressed")
+        elif z.read("mimetype") != b"application/hwp+zip":
+            failures.append("unexpected mimetype %r" % z.read("mimetype"))
+
+        parsed = 0
+        for info in infos:
+            if info.filename.endswith(XML_SUFFIXES):
+                try:
+                    ET.fromstring(z.read(info))
+                    parsed += 1
+                except ET.ParseError as e:
+                    failures.append("%s: %s" % (info.filename, e))
+
+        names = z.namelist()
+        for required in ("Contents/header.xml", "Contents/section0.xml", "Contents/content.hpf",
+                         "META-INF/container.xml"):
+            if required not in names:
+                failures.append("missing %s" % required)
+
+    for failure in failures:
+        print("FAIL " + failure)
+    print("%d XML parts parsed" % parsed)
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1]))
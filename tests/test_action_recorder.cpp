@@ -0,0 +1,177 @@
+/**
+ * @file test_action_recorder.cpp
+ * @brief ActionRecorder 기록 지점 테스트
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "TestHarness.h"
+#include "FakeHwpObject.h"
+#include "HwpWrapper.h"
+#include "HwpAction.h"
+#include "HwpBatch.h"
+#include "HwpParameter.h"
+
+using namespace cpyhwpx;
+using namespace cpyhwpx::bench;
+
+namespace {
+
+/**
+ * @brief 가짜 한/글을 붙인 HwpWrapper
+ */
+struct WrapperFixture {
+    HwpWrapper hwp{false, false, false};
+
+    WrapperFixture()
+    {
+        FakeHwpObject* obj = new FakeHwpObject();
+        hwp.Attach(obj);
+        obj->Release();
+    }
+};
+
+bool Contains(const std::string& text, const std::string& part)
+{
+    return text.find(part) != std::string::npos;
+}
+
+/**
+ * @brief CellBorderFill 세트에 BorderWidth를 쓰고 (sub_set이면 FillAttr 서브셋도 열고) 실행
+ */
+bool ExecuteCellBorderFill(HwpWrapper& hwp, bool sub_set)
+{
+    IDispatch* pSet = hwp.CreateSet(L"CellBorderFill");
+    IDispatch* pAction = hwp.CreateAction(L"CellBorderFill");
+    if (!pSet || !pAction) return false;
+
+    bool ok;
+    {
+        HwpParameterSet set(pSet, L"CellBorderFill");
+        set.SetItem(L"BorderWidth", 3);
+        if (sub_set) {
+            IDispatch* pFill = set.CreateItemSet(L"FillAttr", L"DrawFillAttr");
+            if (pFill) pFill->Release();
+        }
+        HwpAction action(pAction, &hwp, L"CellBorderFill");
+        ok = action.Execute(pSet);
+    }
+    pAction->Release();
+    pSet->Release();
+    return ok;
+}
+
+} // namespace
+
+CPYHWPX_TEST(HwpActionRunIsJournaled)
+{
+    WrapperFixture fx;
+    CHECK(fx.hwp.StartRecording());
+
+    IDispatch* pAction = fx.hwp.CreateAction(L"BreakPara");
+    CHECK(pAction != nullptr);
+    {
+        HwpAction action(pAction, &fx.hwp, L"BreakPara");
+        CHECK(action.Run());
+    }
+    pAction->Release();
+
+    HwpBatch journal = fx.hwp.StopRecording();
+    CHECK(journal.size() == 1);
+    CHECK(Contains(journal.ToJson(), "\"op\":\"RunAction\",\"action\":\"BreakPara\""));
+}
+
+CPYHWPX_TEST(RunActionIsJournaledOnce)
+{
+    // RunAction 안에서 HwpAction::Run을 거쳐도 바깥 호출 하나로만 기록
+    WrapperFixture fx;
+    CHECK(fx.hwp.StartRecording());
+    CHECK(fx.hwp.RunAction(L"MoveDocEnd"));
+
+    HwpBatch journal = fx.hwp.StopRecording();
+    CHECK(journal.size() == 1);
+}
+
+CPYHWPX_TEST(PlainSetIsJournaledWithItems)
+{
+    WrapperFixture fx;
+    CHECK(fx.hwp.StartRecording());
+    CHECK(ExecuteCellBorderFill(fx.hwp, false));
+
+    HwpBatch journal = fx.hwp.StopRecording();
+    CHECK(journal.size() == 1);
+    CHECK(journal.SkippedCount() == 0);
+    CHECK(Contains(journal.ToJson(), "\"op\":\"ExecuteSet\""));
+    CHECK(Contains(journal.ToJson(), "\"BorderWidth\":3"));
+}
+
+CPYHWPX_TEST(SubSetActionIsSkippedNotPartial)
+{
+    // 서브셋 내용을 빼고 ExecuteSet으로 남기면 재생이 다른 편집이 됨
+    WrapperFixture fx;
+    CHECK(fx.hwp.StartRecording());
+    CHECK(ExecuteCellBorderFill(fx.hwp, true));
+
+    HwpBatch journal = fx.hwp.StopRecording();
+    CHECK(journal.size() == 1);
+    CHECK(journal.SkippedCount() == 1);
+    CHECK(Contains(journal.ToJson(), "\"op\":\"Skipped\",\"action\":\"CellBorderFill\""));
+    CHECK(!Contains(journal.ToJson(), "BorderWidth"));
+
+    WrapperFixture target;
+    std::vector<bool> results = journal.Execute(target.hwp);
+    CHECK(results.size() == 1 && !results[0]);
+}
+
+CPYHWPX_TEST(RawComEditIsSkipped)
+{
+    WrapperFixture fx;
+    CHECK(fx.hwp.StartRecording());
+    fx.hwp.CellFill(255, 0, 0);
+    CHECK(fx.hwp.InsertText(L"a"));
+
+    HwpBatch journal = fx.hwp.StopRecording();
+    CHECK(journal.size() == 2);
+    CHECK(journal.SkippedCount() == 1);
+    CHECK(Contains(journal.ToJson(), "\"op\":\"Skipped\",\"action\":\"CellFill\""));
+
+    HwpBatch restored;
+    CHECK(HwpBatch::FromBinary(journal.ToBinary(), restored));
+    CHECK(restored.size() == 2);
+    CHECK(restored.SkippedCount() == 1);
+}
+
+CPYHWPX_TEST(SetFontWithFaceNameIsSkipped)
+{
+    WrapperFixture fx;
+    CHECK(fx.hwp.StartRecording());
+    fx.hwp.SetFont(L"바탕", 1000);
+    fx.hwp.SetFont(L"", 1200);
+
+    HwpBatch journal = fx.hwp.StopRecording();
+    CHECK(journal.size() == 2);
+    CHECK(journal.SkippedCount() == 1);
+    CHECK(Contains(journal.ToJson(), "\"action\":\"SetFont\""));
+    CHECK(Contains(journal.ToJson(), "\"Height\":1200"));
+}
+
+CPYHWPX_TEST(WarmReplayLooksUpNoNames)
+{
+    // 재생은 DISPID를 캐시하고 같은 액션의 HAction 객체를 한 번만 만든다
+    HwpBatch batch;
+    for (int i = 0; i < 20; ++i) {
+        batch.ExecuteSet(L"CharShape", L"CharShape").Item(L"Bold", i % 2 == 0);
+    }
+
+    WrapperFixture fx;
+    std::vector<bool> results = batch.Execute(fx.hwp);
+    CHECK(results.size() == 20 && results[0] && results[19]);
+
+    FakeDispatch::ResetCounts();
+    results = batch.Execute(fx.hwp);
+    FakeCallCounts counts = FakeDispatch::Counts();
+    CHECK(results.size() == 20 && results[19]);
+    CHECK(counts.get_ids == 0);
+}
+
+CPYHWPX_TEST_MAIN()
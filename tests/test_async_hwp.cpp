@@ -0,0 +1,191 @@
+/**
+ * @file test_async_hwp.cpp
+ * @brief AsyncHwp 워치독 테스트 (멈추는 가짜 한/글)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "TestHarness.h"
+#include "FakeHwpObject.h"
+#include "AsyncHwp.h"
+#include "HwpWrapper.h"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+
+using namespace cpyhwpx;
+using namespace cpyhwpx::bench;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Open에서 멈추는 가짜 한/글을 붙이는 AsyncHwp
+ */
+struct HangingFixture {
+    std::atomic<FakeHwpObject*> current{nullptr};
+    AsyncHwp async;
+
+    HangingFixture()
+        : async(false, false, false, [this](HwpWrapper& hwp) {
+              FakeHwpConfig config;
+              config.hang_on = L"Open";
+              FakeHwpObject* obj = new FakeHwpObject(config);
+              current.store(obj);
+              bool ok = hwp.Attach(obj);
+              obj->Release();
+              return ok;
+          })
+    {
+        async.Ready().wait();
+    }
+};
+
+bool AttachFake(HwpWrapper& hwp)
+{
+    FakeHwpObject* obj = new FakeHwpObject();
+    bool ok = hwp.Attach(obj);
+    obj->Release();
+    return ok;
+}
+
+} // namespace
+
+CPYHWPX_TEST(TimedOutFutureFailsWhileCallIsStillHung)
+{
+    HangingFixture fx;
+    // 한/글을 종료하지 않는 처리기: 호출은 테스트가 Unhang()할 때까지 멈춰 있다
+    std::atomic<int> hangs{0};
+    fx.async.SetHangHandler([&hangs] { hangs.fetch_add(1); });
+
+    FakeHwpObject* hung = fx.current.load();
+    auto start = Clock::now();
+    std::future<bool> result = fx.async.Submit([](HwpWrapper& hwp) { return hwp.Open(L"stuck.hwp"); },
+                                               std::chrono::milliseconds(50));
+    bool timedOut = false;
+    CHECK(result.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    try {
+        result.get();
+    } catch (const HwpTimeoutError&) {
+        timedOut = true;
+    }
+    CHECK(timedOut);
+    CHECK(Clock::now() - start < std::chrono::seconds(5));
+
+    // 워치독 처리기가 불린 뒤 풀어 주면 새 인스턴스에서 다음 작업 실행
+    auto deadline = Clock::now() + std::chrono::seconds(5);
+    while (hangs.load() == 0 && Clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    CHECK(hangs.load() == 1);
+    CHECK(fx.async.GetTimeoutCount() == 1);
+    hung->Unhang();
+    CHECK(fx.async.Submit([](HwpWrapper& hwp) { return hwp.InsertText(L"가"); }).get());
+    CHECK(fx.async.GetRecoveryCount() == 1);
+}
+
+CPYHWPX_TEST(PostTimeoutCallbackRunsOnceAtDeadline)
+{
+    HangingFixture fx;
+    fx.async.SetHangHandler([] {});
+
+    FakeHwpObject* hung = fx.current.load();
+    std::promise<void> expired;
+    std::atomic<int> calls{0};
+    std::atomic<bool> finished{false};
+    fx.async.Post([&finished](HwpWrapper& hwp) { hwp.Open(L"stuck.hwp"); finished.store(true); },
+                  std::chrono::milliseconds(50),
+                  [&expired, &calls] {
+                      if (calls.fetch_add(1) == 0) expired.set_value();
+                  });
+    CHECK(expired.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    CHECK(!finished.load());
+
+    hung->Unhang();
+    fx.async.Submit([](HwpWrapper&) {}).get();
+    CHECK(finished.load());
+    CHECK(calls.load() == 1);
+}
+
+CPYHWPX_TEST(HangHandlerFinishesBeforeTheInstanceIsReplaced)
+{
+    // 처리기 안에서 호출이 풀려도 (한/글 종료 흉내) 처리기가 끝나기 전에는 새 인스턴스를 띄우지 않음
+    HangingFixture fx;
+    FakeHwpObject* hung = fx.current.load();
+    std::atomic<uint64_t> recoveriesInHandler{~0ull};
+    fx.async.SetHangHandler([&] {
+        hung->Unhang();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        recoveriesInHandler.store(fx.async.GetRecoveryCount());
+    });
+
+    std::future<bool> result = fx.async.Submit([](HwpWrapper& hwp) { return hwp.Open(L"stuck.hwp"); },
+                                               std::chrono::milliseconds(20));
+    CHECK(result.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    fx.async.Submit([](HwpWrapper&) {}).get();
+    CHECK(recoveriesInHandler.load() == 0);
+    CHECK(fx.async.GetRecoveryCount() == 1);
+}
+
+CPYHWPX_TEST(CompletionRacingTheDeadlineSettlesOnce)
+{
+    // 마감 시각 근처에서 끝나는 작업: 결과 또는 시간 초과 중 정확히 하나 (future_error 없음)
+    AsyncHwp async(false, false, false, AttachFake);
+    async.Ready().wait();
+    async.SetHangHandler([] {});
+
+    int values = 0;
+    int timeouts = 0;
+    int others = 0;
+    for (int i = 0; i < 200; ++i) {
+        std::future<int> result = async.Submit([i](HwpWrapper&) {
+            std::this_thread::sleep_for(std::chrono::microseconds(900 + (i % 5) * 50));
+            return i;
+        }, std::chrono::milliseconds(1));
+        try {
+            CHECK(result.get() == i);
+            ++values;
+        } catch (const HwpTimeoutError&) {
+            ++timeouts;
+        } catch (...) {
+            ++others;
+        }
+    }
+    CHECK(others == 0);
+    CHECK(values + timeouts == 200);
+    CHECK(async.GetTimeoutCount() == static_cast<uint64_t>(timeouts));
+}
+
+CPYHWPX_TEST(ReleasingTheLastReferenceInsideATaskDetaches)
+{
+    // 작업이 마지막 shared_ptr을 놓음: 소멸자가 실행 스레드에서 돌아도 종료되지 않아야 함
+    auto owner = std::make_shared<AsyncHwp>(false, false, false, AttachFake);
+    owner->Ready().wait();
+    owner->SetCallTimeout(std::chrono::seconds(5));     // 워치독도 띄워 둔다
+
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    std::future<int> first = owner->Submit([opened, keep = owner](HwpWrapper&) mutable {
+        opened.wait();
+        keep.reset();
+        return 1;
+    });
+    std::future<int> queued = owner->Submit([](HwpWrapper&) { return 2; });
+
+    owner.reset();
+    gate.set_value();
+
+    CHECK(first.get() == 1);
+    bool broken = false;
+    try {
+        queued.get();
+    } catch (const std::future_error& e) {
+        broken = e.code() == std::future_errc::broken_promise;
+    }
+    CHECK(broken);
+}
+
+CPYHWPX_TEST_MAIN()
@@ -0,0 +1,280 @@
+/**
+ * @file test_batch_converter.cpp
+ * @brief BatchConverter 테스트 (가짜 한/글: 실패/멈춤/저장 흉내)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "TestHarness.h"
+#include "FakeHwpObject.h"
+#include "BatchConverter.h"
+#include "HwpWrapper.h"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+using namespace cpyhwpx;
+using namespace cpyhwpx::bench;
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * @brief 파일 이름으로 동작을 고르는 가짜 한/글
+ *
+ * - "bad"가 들어간 파일은 Open 실패
+ * - "flaky"가 들어간 파일은 처음 한 번만 Open 실패
+ * - "stuck"이 들어간 파일은 Unhang()까지 Open에서 멈춤
+ * - SaveAs는 출력 파일에 입력 이름을 씀
+ */
+class ConvertingFake : public FakeHwpObject {
+public:
+    explicit ConvertingFake(std::atomic<int>* flaky_opens) : m_flakyOpens(flaky_opens) {}
+
+    void Unhang()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_unhung = true;
+        m_cv.notify_all();
+    }
+
+protected:
+    bool OnInvoke(const std::wstring& name, WORD flags, DISPPARAMS* params, VARIANT* result) override
+    {
+        if ((name == L"Open" || name == L"SaveAs") && params && params->cArgs > 0) {
+            std::wstring path = params->rgvarg[params->cArgs - 1].bstrVal;
+            bool ok = true;
+            if (name == L"Open") {
+                if (path.find(L"stuck") != std::wstring::npos) {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_cv.wait(lock, [this] { return m_unhung; });
+                    ok = false;
+                } else if (path.find(L"bad") != std::wstring::npos) {
+                    ok = false;
+                } else if (path.find(L"flaky") != std::wstring::npos) {
+                    ok = m_flakyOpens->fetch_add(1) > 0;
+                }
+                m_opened = path;
+            } else {
+                std::ofstream out(fs::path(path), std::ios::binary);
+                out << "converted from " << fs::path(m_opened).filename().string();
+                ok = static_cast<bool>(out);
+            }
+            if (result) {
+                result->vt = VT_BOOL;
+                result->boolVal = ok ? VARIANT_TRUE : VARIANT_FALSE;
+            }
+            return true;
+        }
+        return FakeHwpObject::OnInvoke(name, flags, params, result);
+    }
+
+private:
+    std::atomic<int>* m_flakyOpens;
+    std::wstring m_opened;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_unhung = false;
+};
+
+/**
+ * @brief ConvertingFake를 붙이고 멈추면 풀어 주는 인스턴스 생성 함수
+ */
+HwpInstancePool::Factory FakeFactory(std::shared_ptr<std::atomic<int>> flaky_opens)
+{
+    return [flaky_opens]() {
+        auto current = std::make_shared<std::atomic<ConvertingFake*>>(nullptr);
+        auto async = std::make_unique<AsyncHwp>(false, false, false, [current, flaky_opens](HwpWrapper& hwp) {
+            ConvertingFake* obj = new ConvertingFake(flaky_opens.get());
+            current->store(obj);
+            bool ok = hwp.Attach(obj);
+            obj->Release();
+            return ok;
+        });
+        async->SetHangHandler([current] { current->load()->Unhang(); });
+        return async;
+    };
+}
+
+/**
+ * @brief 테스트마다 새로 만드는 임시 디렉터리
+ */
+struct TempDir {
+    fs::path path;
+
+    explicit TempDir(const char* name)
+        : path(fs::temp_directory_path() / (std::string("cpyhwpx_") + name))
+    {
+        fs::remove_all(path);
+        fs::create_directories(path);
+    }
+    ~TempDir() { fs::remove_all(path); }
+
+    std::wstring Touch(const std::string& rel, const std::string& content = "hwp") const
+    {
+        fs::path file = path / rel;
+        fs::create_directories(file.parent_path());
+        std::ofstream(file, std::ios::binary) << content;
+        return file.wstring();
+    }
+};
+
+std::vector<std::string> ReadLines(const std::wstring& path)
+{
+    std::ifstream in{fs::path(path)};
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(in, line);) lines.push_back(line);
+    return lines;
+}
+
+bool Contains(const std::string& text, const std::string& part)
+{
+    return text.find(part) != std::string::npos;
+}
+
+} // namespace
+
+CPYHWPX_TEST(SkipsRetriesTimesOutAndWritesManifest)
+{
+    TempDir tmp("batch_manifest");
+    std::wstring good = tmp.Touch("in/good.hwp");
+    std::wstring fresh = tmp.Touch("in/fresh.hwp");
+    std::wstring flaky = tmp.Touch("in/flaky.hwp");
+    std::wstring bad = tmp.Touch("in/bad.hwp");
+    std::wstring stuck = tmp.Touch("in/stuck.hwp");
+
+    BatchConvertConfig config;
+    config.output_dir = (tmp.path / "out").wstring();
+    config.manifest_path = (tmp.path / "manifest.jsonl").wstring();
+    config.workers = 2;
+    config.retries = 1;
+    config.timeout = std::chrono::milliseconds(100);
+    auto flakyOpens = std::make_shared<std::atomic<int>>(0);
+    BatchConverter converter(config, FakeFactory(flakyOpens));
+
+    // 입력보다 새로운 출력은 건너뜀
+    std::wstring freshOut = converter.OutputPathFor(fresh);
+    fs::create_directories(tmp.path / "out");
+    std::ofstream(fs::path(freshOut), std::ios::binary) << "already converted";
+    fs::last_write_time(fs::path(freshOut), fs::last_write_time(fs::path(fresh)) + std::chrono::seconds(10));
+
+    std::vector<std::wstring> inputs = { good, fresh, flaky, bad, stuck };
+    size_t progressCalls = 0;
+    std::vector<BatchConvertResult> results = converter.Run(inputs,
+        [&progressCalls](const BatchConvertResult&, size_t done, size_t total) {
+            ++progressCalls;
+            CHECK(done == progressCalls);
+            CHECK(total == 5);
+        });
+
+    CHECK(results.size() == 5);
+    CHECK(progressCalls == 5);
+    CHECK(results[0].status == ConvertStatus::Converted);
+    CHECK(results[0].attempts == 1);
+    CHECK(results[0].output_size > 0);
+    CHECK(results[1].status == ConvertStatus::Skipped);
+    CHECK(results[1].attempts == 0);
+    CHECK(results[2].status == ConvertStatus::Converted);
+    CHECK(results[2].attempts == 2);
+    CHECK(results[3].status == ConvertStatus::Failed);
+    CHECK(results[3].attempts == 2);
+    CHECK(results[3].error == L"open failed");
+    CHECK(results[4].status == ConvertStatus::TimedOut);
+    CHECK(results[4].attempts == 2);
+    CHECK(converter.GetRetryCount() == 3);
+    CHECK(converter.GetTimeoutCount() == 1);
+
+    // 파일마다 한 줄, 끝난 순서대로
+    std::vector<std::string> lines = ReadLines(config.manifest_path);
+    CHECK(lines.size() == 5);
+    std::map<std::string, std::string> byName;
+    for (const std::string& line : lines) {
+        for (const char* name : { "good", "fresh", "flaky", "bad", "stuck" }) {
+            if (Contains(line, std::string("/") + name + ".hwp\"")) byName[name] = line;
+        }
+    }
+    CHECK(byName.size() == 5);
+    CHECK(Contains(byName["good"], "\"status\":\"converted\",\"attempts\":1"));
+    CHECK(Contains(byName["fresh"], "\"status\":\"skipped\",\"attempts\":0"));
+    CHECK(Contains(byName["flaky"], "\"status\":\"converted\",\"attempts\":2"));
+    CHECK(Contains(byName["bad"], "\"status\":\"failed\",\"attempts\":2"));
+    CHECK(Contains(byName["stuck"], "\"status\":\"timeout\",\"attempts\":2"));
+    CHECK(Contains(byName["stuck"], "\"error\":\"timed out\""));
+    CHECK(Contains(byName["good"], "\"input_size\":3,\"output_size\":"));
+    converter.Shutdown();
+}
+
+CPYHWPX_TEST(SizeChangeSinceManifestForcesReconvert)
+{
+    TempDir tmp("batch_sizes");
+    std::wstring a = tmp.Touch("in/a.hwp");
+    std::wstring b = tmp.Touch("in/b.hwp");
+
+    BatchConvertConfig config;
+    config.output_dir = (tmp.path / "out").wstring();
+    config.manifest_path = (tmp.path / "manifest.jsonl").wstring();
+    config.workers = 1;
+    {
+        BatchConverter converter(config, FakeFactory(std::make_shared<std::atomic<int>>(0)));
+        std::vector<BatchConvertResult> first = converter.Run({ a, b });
+        CHECK(first[0].status == ConvertStatus::Converted);
+        CHECK(first[1].status == ConvertStatus::Converted);
+    }
+
+    // 출력이 중간에 잘린 것처럼 (시각은 여전히 입력보다 나중)
+    std::wstring bOut = (tmp.path / "out" / "b.pdf").wstring();
+    std::ofstream(fs::path(bOut), std::ios::binary) << "x";
+    fs::last_write_time(fs::path(bOut), fs::last_write_time(fs::path(b)) + std::chrono::seconds(10));
+
+    // 새 변환기는 결과 목록에서 크기 기록을 읽는다
+    BatchConverter converter(config, FakeFactory(std::make_shared<std::atomic<int>>(0)));
+    std::vector<BatchConvertResult> second = converter.Run({ a, b });
+    CHECK(second[0].status == ConvertStatus::Skipped);
+    CHECK(second[1].status == ConvertStatus::Converted);
+    CHECK(fs::file_size(fs::path(bOut)) > 1);
+}
+
+CPYHWPX_TEST(GlobMirrorsSubdirectoriesAndListsFailCollisions)
+{
+    TempDir tmp("batch_glob");
+    std::wstring x1 = tmp.Touch("in/a/x.hwp");
+    std::wstring x2 = tmp.Touch("in/b/x.hwp");
+    std::wstring top = tmp.Touch("in/top.hwp");
+
+    BatchConvertConfig config;
+    config.output_dir = (tmp.path / "out").wstring();
+    config.workers = 1;
+    BatchConverter converter(config, FakeFactory(std::make_shared<std::atomic<int>>(0)));
+
+    std::wstring pattern = (tmp.path / "in" / "**" / "*.hwp").wstring();
+    CHECK(BatchConverter::GlobRoot(pattern) == (tmp.path / "in").wstring());
+
+    std::vector<BatchConvertResult> results = converter.RunGlob(pattern);
+    CHECK(results.size() == 3);
+    std::map<std::wstring, BatchConvertResult> byInput;
+    for (const BatchConvertResult& result : results) byInput[result.input] = result;
+    CHECK(byInput[x1].output == (tmp.path / "out" / "a" / "x.pdf").wstring());
+    CHECK(byInput[x2].output == (tmp.path / "out" / "b" / "x.pdf").wstring());
+    CHECK(byInput[top].output == (tmp.path / "out" / "top.pdf").wstring());
+    for (const BatchConvertResult& result : results) {
+        CHECK(result.status == ConvertStatus::Converted);
+        CHECK(fs::exists(fs::path(result.output)));
+    }
+
+    // 기준 디렉터리 없이 같은 이름이 겹치면 둘 다 변환하지 않음
+    config.output_dir = (tmp.path / "flat").wstring();
+    BatchConverter flat(config, FakeFactory(std::make_shared<std::atomic<int>>(0)));
+    std::vector<BatchConvertResult> collided = flat.Run({ x1, x2, top });
+    CHECK(collided[0].status == ConvertStatus::Failed);
+    CHECK(collided[0].error == L"output path collision");
+    CHECK(collided[1].status == ConvertStatus::Failed);
+    CHECK(collided[2].status == ConvertStatus::Converted);
+    CHECK(!fs::exists(tmp.path / "flat" / "x.pdf"));
+}
+
+CPYHWPX_TEST_MAIN()
@@ -0,0 +1,40 @@
+/**
+ * @file test_bstr_string.cpp
+ * @brief BstrString::FromUtf8 테스트 (잘못된 UTF-8 거부)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "TestHarness.h"
+#include "BstrString.h"
+#include <cstring>
+
+using namespace cpyhwpx;
+
+namespace {
+
+BstrString Utf8(const char* s)
+{
+    return BstrString::FromUtf8(s, strlen(s));
+}
+
+} // namespace
+
+CPYHWPX_TEST(ValidUtf8Converts)
+{
+    CHECK(Utf8("plain ascii").str() == L"plain ascii");
+    CHECK(Utf8("abc \xED\x95\x9C\xEA\xB8\x80").str() == L"abc 한글");
+    CHECK(Utf8("\xEF\xBF\xBD").str() == L"\xFFFD");         // 원문에 있는 U+FFFD는 그대로
+    CHECK(Utf8("").bstr() != nullptr);
+}
+
+CPYHWPX_TEST(InvalidUtf8IsRejected)
+{
+    CHECK(Utf8("abc\x80").bstr() == nullptr);                // 홀로 남은 연속 바이트
+    CHECK(Utf8("abc\xED\x95").bstr() == nullptr);            // 끝에서 잘린 글자
+    CHECK(Utf8("\xC0\x80").bstr() == nullptr);               // 과잉 길이 표현
+    CHECK(Utf8("\xED\xA0\x80").bstr() == nullptr);           // 서로게이트
+    CHECK(Utf8("\xED\x95\x9C\xFF\xEA\xB8\x80").bstr() == nullptr);
+}
+
+CPYHWPX_TEST_MAIN()
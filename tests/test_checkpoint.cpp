@@ -0,0 +1,68 @@
+/**
+ * @file test_checkpoint.cpp
+ * @brief Checkpoint/Restore 문서 확인 테스트
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "TestHarness.h"
+#include "FakeHwpObject.h"
+#include "HwpWrapper.h"
+
+using namespace cpyhwpx;
+using namespace cpyhwpx::bench;
+
+namespace {
+
+/**
+ * @brief 가짜 한/글을 붙인 HwpWrapper
+ */
+struct WrapperFixture {
+    HwpWrapper hwp{false, false, false};
+
+    WrapperFixture()
+    {
+        FakeHwpObject* obj = new FakeHwpObject();
+        hwp.Attach(obj);
+        obj->Release();
+    }
+
+    /**
+     * @brief 활성 문서의 DocumentID 바꾸기 (다른 문서로 전환한 것처럼)
+     */
+    void SetActiveDocumentID(int id)
+    {
+        std::unique_ptr<XHwpDocuments> docs = hwp.GetXHwpDocuments();
+        std::unique_ptr<XHwpDocument> doc = docs->GetActiveDocument();
+        static_cast<FakeDispatch*>(doc->GetDispatch())->SetInt(L"DocumentID", id);
+    }
+};
+
+} // namespace
+
+CPYHWPX_TEST(RestoreAppliesToTheCheckpointedDocument)
+{
+    WrapperFixture fx;
+    fx.SetActiveDocumentID(7);
+
+    int token = fx.hwp.Checkpoint();
+    CHECK(token != 0);
+    CHECK(fx.hwp.GetCheckpointStore().GetDocumentID(token) == 7);
+    CHECK(fx.hwp.Restore(token));
+}
+
+CPYHWPX_TEST(RestoreRefusesAfterSwitchingDocuments)
+{
+    WrapperFixture fx;
+    fx.SetActiveDocumentID(7);
+    int token = fx.hwp.Checkpoint();
+    CHECK(token != 0);
+
+    fx.SetActiveDocumentID(8);
+    CHECK(!fx.hwp.Restore(token));
+
+    fx.SetActiveDocumentID(7);
+    CHECK(fx.hwp.Restore(token));
+}
+
+CPYHWPX_TEST_MAIN()
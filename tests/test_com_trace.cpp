@@ -0,0 +1,79 @@
+/**
+ * @file test_com_trace.cpp
+ * @brief ComStats/ComTrace 이름 부여 테스트 (계측을 나중에 켠 경우)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "TestHarness.h"
+#include "FakeHwpObject.h"
+#include "HwpWrapper.h"
+#include "ComStats.h"
+#include "ComTrace.h"
+#include <string>
+
+using namespace cpyhwpx;
+using namespace cpyhwpx::bench;
+
+namespace {
+
+/**
+ * @brief 가짜 한/글을 붙인 HwpWrapper
+ */
+struct WrapperFixture {
+    HwpWrapper hwp{false, false, false};
+
+    WrapperFixture()
+    {
+        FakeHwpObject* obj = new FakeHwpObject();
+        hwp.Attach(obj);
+        obj->Release();
+    }
+};
+
+bool Contains(const std::string& text, const std::string& part)
+{
+    return text.find(part) != std::string::npos;
+}
+
+} // namespace
+
+CPYHWPX_TEST(ActionIdsAreTracedWhenTracingStartsAfterHActionIsCached)
+{
+    WrapperFixture fx;
+    CHECK(!ComTrace::IsEnabled());
+    fx.hwp.RunAction(L"MoveDocEnd");        // 추적이 꺼진 채 HAction을 가져와 캐시
+
+    ComTrace::Start(1024);
+    fx.hwp.RunAction(L"MoveDocBegin");
+    ComTrace::Stop();
+    std::string json = ComTrace::ToJson();
+    ComTrace::Clear();
+
+    CHECK(Contains(json, "{\"name\":\"HAction.Run\",\"cat\":\"com\""));
+    CHECK(Contains(json, "{\"name\":\"MoveDocBegin\",\"cat\":\"action\""));
+    CHECK(!Contains(json, "MoveDocEnd"));
+}
+
+CPYHWPX_TEST(CachedDispidsKeepMemberNamesWhenStatsStartLater)
+{
+    WrapperFixture fx;
+    CHECK(!ComStats::IsEnabled());
+    fx.hwp.GetFieldList();                  // 계측이 꺼진 채 DISPID를 캐시
+
+    ComStats::Reset();
+    ComStats::SetEnabled(true);
+    fx.hwp.GetFieldList();
+    ComStats::SetEnabled(false);
+
+    bool named = false;
+    for (const ComCallStat& s : ComStats::Snapshot()) {
+        if (s.kind != L"Invoke") continue;
+        CHECK(s.member.empty() || s.member[0] != L'#');
+        if (s.interface_name == L"HwpObject" && s.member == L"GetFieldList") named = true;
+    }
+    CHECK(named);
+    ComStats::Reset();
+}
+
+CPYHWPX_TEST_MAIN()
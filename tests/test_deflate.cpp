@@ -0,0 +1,164 @@
+/**
+ * @file test_deflate.cpp
+ * @brief Deflater/DeflateBuffer 왕복 테스트
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 자체 InflateBuffer로 풀어 보고, 같은 압축 결과를 deflate_vectors/에 남겨
+ * check_deflate_vectors.py가 Python zlib으로 다시 풀어 본다.
+ */
+
+#include "TestHarness.h"
+#include "Deflate.h"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace cpyhwpx;
+namespace fs = std::filesystem;
+
+namespace {
+
+// 0, 1, 최대 일치 길이, 창 크기, 블록 경계(64KB), ZipWriter 조각 경계(256KB) 앞뒤
+const size_t kSizes[] = { 0, 1, 258, 32768, 65535, 65536, 65537, 262143, 262144, 262145 };
+
+const fs::path kVectorDir = "deflate_vectors";
+
+/**
+ * @brief 섹션 XML 비슷한 반복 텍스트와 압축되지 않는 바이트가 섞인 입력
+ */
+std::string SampleInput(size_t size)
+{
+    std::string out;
+    out.reserve(size);
+    uint32_t state = 2463534242u;
+    while (out.size() < size) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        if ((state & 7) != 0) {
+            out += "<hp:p paraPrIDRef=\"" + std::to_string(state % 16) + "\"><hp:run><hp:t>보고서 문단</hp:t></hp:run></hp:p>";
+        } else {
+            for (int i = 0; i < 64; ++i) {
+                state = state * 1664525u + 1013904223u;
+                out += static_cast<char>(state >> 24);
+            }
+        }
+    }
+    out.resize(size);
+    return out;
+}
+
+/**
+ * @brief Deflater를 작은 조각으로 나눠 쓰고 중간에 Flush
+ */
+std::string StreamDeflate(const std::string& input, int level)
+{
+    Deflater deflater(level);
+    std::string out;
+    size_t pos = 0;
+    size_t step = 1;
+    while (pos < input.size()) {
+        size_t n = std::min(step, input.size() - pos);
+        deflater.Write(input.data() + pos, n, out);
+        pos += n;
+        step = step * 3 + 7;
+        if (pos > input.size() / 2 && pos - n <= input.size() / 2) {
+            deflater.Flush(out);
+        }
+    }
+    deflater.Finish(out);
+    return out;
+}
+
+/**
+ * @brief ZipWriter처럼 조각마다 새 Deflater + 앞 조각 32KB 사전, 조각 끝은 sync flush
+ */
+std::string ChunkedDeflate(const std::string& input, size_t chunk, int level)
+{
+    std::string out;
+    Deflater deflater(level);
+    size_t pos = 0;
+    do {
+        size_t n = std::min(chunk, input.size() - pos);
+        deflater.Reset();
+        if (pos > 0) {
+            size_t dict = std::min<size_t>(pos, 32768);
+            deflater.SetDictionary(input.data() + pos - dict, dict);
+        }
+        deflater.Write(input.data() + pos, n, out);
+        pos += n;
+        if (pos < input.size()) {
+            deflater.Flush(out);
+        } else {
+            deflater.Finish(out);
+        }
+    } while (pos < input.size());
+    return out;
+}
+
+void Save(const std::string& name, const std::string& data)
+{
+    std::ofstream(kVectorDir / name, std::ios::binary).write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+/**
+ * @brief 자체 풀기로 확인하고 zlib 확인용으로 저장
+ */
+void CheckAndSave(const std::string& name, const std::string& input, const std::string& compressed)
+{
+    std::string inflated;
+    bool ok = InflateBuffer(compressed.data(), compressed.size(), inflated);
+    CHECK(ok);
+    CHECK(inflated == input);
+    if (!ok || inflated != input) std::fprintf(stderr, "  vector %s\n", name.c_str());
+    Save(name + ".deflate", compressed);
+}
+
+} // namespace
+
+CPYHWPX_TEST(DeflateBufferRoundTrips)
+{
+    fs::create_directories(kVectorDir);
+    for (size_t size : kSizes) {
+        std::string input = SampleInput(size);
+        Save("input_" + std::to_string(size) + ".bin", input);
+        for (int level : { 0, 1, 6, 9 }) {
+            CheckAndSave("buffer_l" + std::to_string(level) + "_" + std::to_string(size), input,
+                         DeflateBuffer(input.data(), input.size(), level));
+        }
+    }
+}
+
+CPYHWPX_TEST(StreamingWriteFlushRoundTrips)
+{
+    fs::create_directories(kVectorDir);
+    for (size_t size : kSizes) {
+        std::string input = SampleInput(size);
+        for (int level : { 1, 6 }) {
+            CheckAndSave("stream_l" + std::to_string(level) + "_" + std::to_string(size), input,
+                         StreamDeflate(input, level));
+        }
+    }
+}
+
+CPYHWPX_TEST(DictionaryChunksConcatenateIntoOneStream)
+{
+    fs::create_directories(kVectorDir);
+    for (size_t size : kSizes) {
+        std::string input = SampleInput(size);
+        for (size_t chunk : { size_t(32768), size_t(65536) }) {
+            CheckAndSave("chunked_" + std::to_string(chunk) + "_" + std::to_string(size), input,
+                         ChunkedDeflate(input, chunk, 6));
+        }
+    }
+}
+
+CPYHWPX_TEST(Crc32MatchesKnownValue)
+{
+    // zlib.crc32(b"123456789") == 0xCBF43926
+    CHECK(Crc32("123456789", 9) == 0xCBF43926u);
+    CHECK(Crc32("6789", 4, Crc32("12345", 5)) == 0xCBF43926u);
+}
+
+CPYHWPX_TEST_MAIN()
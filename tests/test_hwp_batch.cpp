@@ -0,0 +1,188 @@
+/**
+ * @file test_hwp_batch.cpp
+ * @brief HwpBatch 이진 형식(HWPJ) 왕복 및 손상된 입력 테스트
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "TestHarness.h"
+#include "HwpBatch.h"
+#include <vector>
+
+using namespace cpyhwpx;
+
+namespace {
+
+/**
+ * @brief 모든 명령 종류와 아이템 종류를 담은 묶음
+ */
+HwpBatch AllOps()
+{
+    HwpBatch batch;
+    batch.RunAction(L"BreakPara")
+         .SetPos(1, -2, 30)
+         .MovePos(2, 0, 0x7FFFFFFF)
+         .InsertText(L"한글 \"따옴표\" \\ 줄\n바꿈")
+         .InsertText(L"")
+         .PutFieldText(L"이름", L"홍길동")
+         .MoveToField(L"주소", 3, false, true, true)
+         .MoveToField(L"주소", 0, true, false, false);
+    batch.ExecuteSet(L"CharShape", L"CharShape")
+         .Item(L"Height", -1000)
+         .Item(L"Ratio", 0.125)
+         .Item(L"Bold", true)
+         .Item(L"Italic", false)
+         .Item(L"FaceNameHangul", L"바탕");
+    batch.ExecuteSet(L"Cancel", L"");      // 아이템 없는 세트
+    batch.Skipped(L"CellFill");
+    return batch;
+}
+
+/**
+ * @brief 헤더 뒤 각 레코드가 끝나는 바이트 위치
+ */
+std::vector<size_t> RecordEnds(const HwpBatch& batch)
+{
+    std::vector<size_t> ends;
+    std::string data = HwpBatch::BinaryHeader();
+    for (size_t i = 0; i < batch.size(); ++i) {
+        batch.AppendRecord(i, data);
+        ends.push_back(data.size());
+    }
+    return ends;
+}
+
+void PutU32(std::string& out, uint32_t v)
+{
+    for (int i = 0; i < 4; ++i) {
+        out += static_cast<char>((v >> (8 * i)) & 0xFF);
+    }
+}
+
+} // namespace
+
+//=============================================================================
+// 왕복
+//=============================================================================
+
+CPYHWPX_TEST(RoundTripKeepsEveryCommand)
+{
+    HwpBatch batch = AllOps();
+    std::string data = batch.ToBinary();
+
+    HwpBatch restored;
+    CHECK(HwpBatch::FromBinary(data, restored));
+    CHECK(restored.size() == batch.size());
+    CHECK(restored.SkippedCount() == 1);
+    CHECK(restored.ToBinary() == data);
+    CHECK(restored.ToJson() == batch.ToJson());
+}
+
+CPYHWPX_TEST(RoundTripOfEmptyBatch)
+{
+    HwpBatch restored;
+    restored.RunAction(L"남은 명령");      // FromBinary는 out을 비우고 읽음
+    CHECK(HwpBatch::FromBinary(HwpBatch().ToBinary(), restored));
+    CHECK(restored.size() == 0);
+}
+
+CPYHWPX_TEST(AppendedRecordsReadAsOneJournal)
+{
+    // ActionRecorder처럼 헤더 한 번 뒤에 레코드를 이어 붙인 파일
+    HwpBatch batch = AllOps();
+    std::string data = HwpBatch::BinaryHeader();
+    for (size_t i = 0; i < batch.size(); ++i) {
+        batch.AppendRecord(i, data);
+    }
+    CHECK(data == batch.ToBinary());
+}
+
+//=============================================================================
+// 잘리거나 손상된 입력
+//=============================================================================
+
+CPYHWPX_TEST(TruncatedBufferKeepsCompleteRecords)
+{
+    HwpBatch batch = AllOps();
+    std::string data = batch.ToBinary();
+    std::vector<size_t> ends = RecordEnds(batch);
+
+    for (size_t cut = HwpBatch::BinaryHeader().size(); cut <= data.size(); ++cut) {
+        size_t complete = 0;
+        while (complete < ends.size() && ends[complete] <= cut) ++complete;
+
+        HwpBatch restored;
+        CHECK(HwpBatch::FromBinary(data.substr(0, cut), restored));
+        CHECK(restored.size() == complete);
+        if (complete > 0) {
+            CHECK(restored.ToBinary() == data.substr(0, ends[complete - 1]));
+        }
+    }
+}
+
+CPYHWPX_TEST(BadHeaderIsRejected)
+{
+    std::string data = AllOps().ToBinary();
+    HwpBatch restored;
+
+    CHECK(!HwpBatch::FromBinary("", restored));
+    CHECK(!HwpBatch::FromBinary(data.substr(0, 7), restored));
+
+    std::string badMagic = data;
+    badMagic[0] = 'X';
+    CHECK(!HwpBatch::FromBinary(badMagic, restored));
+    CHECK(restored.size() == 0);
+
+    std::string badVersion = data;
+    badVersion[4] = 2;
+    CHECK(!HwpBatch::FromBinary(badVersion, restored));
+    CHECK(restored.size() == 0);
+}
+
+CPYHWPX_TEST(UnknownOpStopsReading)
+{
+    HwpBatch batch;
+    batch.RunAction(L"BreakPara").InsertText(L"a");
+    std::string data = batch.ToBinary();
+    data += static_cast<char>(0x7F);
+    data += batch.ToBinary().substr(HwpBatch::BinaryHeader().size());
+
+    HwpBatch restored;
+    CHECK(HwpBatch::FromBinary(data, restored));
+    CHECK(restored.size() == 2);
+}
+
+CPYHWPX_TEST(UnknownItemKindDropsTheRecord)
+{
+    HwpBatch batch;
+    batch.RunAction(L"BreakPara");
+    batch.ExecuteSet(L"CharShape", L"CharShape").Item(L"Bold", true);
+    std::string data = batch.ToBinary();
+    std::vector<size_t> ends = RecordEnds(batch);
+
+    // ExecuteSet 레코드의 첫 아이템 종류 바이트: op, 두 문자열, 개수 뒤
+    size_t kindPos = ends[0] + 1 + (4 + 9) + (4 + 9) + 4;
+    CHECK(data[kindPos] == 2);      // SetItem::Bool
+    data[kindPos] = 9;
+
+    HwpBatch restored;
+    CHECK(HwpBatch::FromBinary(data, restored));
+    CHECK(restored.size() == 1);
+    CHECK(restored.ToBinary() == data.substr(0, ends[0]));
+}
+
+CPYHWPX_TEST(OversizedStringLengthStopsReading)
+{
+    HwpBatch batch;
+    batch.RunAction(L"BreakPara");
+    std::string data = batch.ToBinary();
+    data += static_cast<char>(HwpBatch::Op::InsertText);
+    PutU32(data, 0xFFFFFFFFu);
+    data += "abc";
+
+    HwpBatch restored;
+    CHECK(HwpBatch::FromBinary(data, restored));
+    CHECK(restored.size() == 1);
+}
+
+CPYHWPX_TEST_MAIN()
@@ -0,0 +1,238 @@
+/**
+ * @file test_hwpx_writer.cpp
+ * @brief HwpxWriter 패키지 구조 테스트
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ * 병합한 표, 누름틀, 그림이 든 패키지를 만들어 ZipReader로 확인하고,
+ * hwpx_package/sample.hwpx를 남겨 check_hwpx_package.py가 XML을 파싱해 본다.
+ * 압축 스레드 수와 무관한 출력, RewritePackage의 원본 그대로 복사도 확인한다.
+ */
+
+#include "TestHarness.h"
+#include "HwpxWriter.h"
+#include "ZipReader.h"
+#include <filesystem>
+#include <map>
+#include <string>
+
+using namespace cpyhwpx;
+namespace fs = std::filesystem;
+
+namespace {
+
+const fs::path kPackageDir = "hwpx_package";
+
+// 1x1 PNG
+const unsigned char kPng[] = {
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1F, 0x15, 0xC4,
+    0x89, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9C, 0x63, 0xF8, 0xCF, 0xC0, 0xF0,
+    0x1F, 0x00, 0x05, 0x00, 0x01, 0xFF, 0x89, 0x99, 0x3D, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+};
+
+/**
+ * @brief 병합한 표, 누름틀, 그림, 섹션 두 개짜리 문서
+ * @param paragraphs 두 번째 섹션 문단 수 (많으면 섹션이 여러 압축 조각으로 나뉨)
+ */
+bool BuildSample(const std::wstring& path, size_t threads, int paragraphs = 2000)
+{
+    HwpxWriter writer;
+    CharShape bold;
+    bold.Bold = true;
+    int title = writer.AddCharShape(bold);
+    int image = writer.AddImageData(std::string(reinterpret_cast<const char*>(kPng), sizeof(kPng)), L"png");
+    if (!writer.Open(path, 6, threads)) return false;
+
+    HwpxParagraph heading;
+    heading.AddText(L"보고서 <제목> & \"인용\"", title);
+    writer.AddParagraph(heading);
+
+    HwpxParagraph field;
+    field.AddText(L"담당자: ").AddField(L"담당자", L"홍길동").AddText(L"\t끝\n다음 줄");
+    writer.AddParagraph(field);
+
+    HwpxTable table = HwpxTable::FromRows({
+        { L"항목", L"수량", L"비고" },
+        { L"가", L"1", L"" },
+        { L"나", L"2", L"" },
+    });
+    table.Merge(1, 2, 2, 1);
+    table.SetText(1, 2, L"병합\n두 줄");
+    HwpxParagraph holder;
+    holder.AddTable(table);
+    writer.AddParagraph(holder);
+
+    HwpxParagraph picture;
+    picture.AddPicture(image, 2835, 2835);
+    writer.AddParagraph(picture);
+
+    writer.BeginSection();
+    for (int i = 0; i < paragraphs; ++i) {
+        writer.AddText(L"두 번째 섹션 문단 " + std::to_wstring(i * 7919));
+    }
+    return writer.Close();
+}
+
+bool Contains(const std::string& text, const char* part)
+{
+    return text.find(part) != std::string::npos;
+}
+
+/**
+ * @brief 항목 이름 → 압축된 그대로의 데이터
+ */
+std::map<std::string, std::string> ReadRawEntries(ZipReader& reader)
+{
+    std::map<std::string, std::string> raw;
+    for (size_t i = 0; i < reader.GetEntries().size(); ++i) {
+        CHECK(reader.ReadRaw(i, raw[reader.GetEntries()[i].name]));
+    }
+    return raw;
+}
+
+} // namespace
+
+CPYHWPX_TEST(MimetypeIsFirstAndStored)
+{
+    fs::create_directories(kPackageDir);
+    const std::wstring path = (kPackageDir / "sample.hwpx").wstring();
+    CHECK(BuildSample(path, 0));
+
+    ZipReader reader;
+    CHECK(reader.Open(path));
+    const std::vector<ZipReader::Entry>& entries = reader.GetEntries();
+    CHECK(!entries.empty());
+    if (entries.empty()) return;
+    CHECK(entries[0].name == "mimetype");
+    CHECK(entries[0].method == 0);
+    CHECK(entries[0].headerOffset == 0);
+
+    std::string mimetype;
+    CHECK(reader.Read(0, mimetype));
+    CHECK(mimetype == "application/hwp+zip");
+
+    // 모든 항목이 CRC까지 맞게 풀림
+    for (size_t i = 0; i < entries.size(); ++i) {
+        std::string data;
+        CHECK(reader.Read(i, data));
+    }
+}
+
+CPYHWPX_TEST(TableFieldAndImageAreWritten)
+{
+    fs::create_directories(kPackageDir);
+    const std::wstring path = (kPackageDir / "parts.hwpx").wstring();
+    CHECK(BuildSample(path, 1));
+
+    std::string section, header, content, image;
+    CHECK(HwpxWriter::ReadPart(path, "Contents/section0.xml", section));
+    CHECK(HwpxWriter::ReadPart(path, "Contents/header.xml", header));
+    CHECK(HwpxWriter::ReadPart(path, "Contents/content.hpf", content));
+    CHECK(HwpxWriter::ReadPart(path, "BinData/image1.png", image));
+
+    CHECK(Contains(section, "rowSpan=\"2\""));
+    CHECK(Contains(section, "<hp:fieldBegin"));
+    CHECK(Contains(section, "<hp:fieldEnd"));
+    CHECK(Contains(section, "binaryItemIDRef=\"image1\""));
+    CHECK(Contains(section, "&lt;제목&gt; &amp;"));
+    CHECK(Contains(content, "image1"));
+    CHECK(image == std::string(reinterpret_cast<const char*>(kPng), sizeof(kPng)));
+
+    ZipReader reader;
+    CHECK(reader.Open(path));
+    int png = reader.Find("BinData/image1.png");
+    CHECK(png >= 0);
+    if (png >= 0) CHECK(reader.GetEntries()[png].method == 0);     // 이미 압축된 형식은 Stored
+}
+
+CPYHWPX_TEST(ThreadCountDoesNotChangeOutput)
+{
+    // 섹션 XML이 256KB 조각 여러 개로 나뉘도록
+    fs::create_directories(kPackageDir);
+    const std::wstring single = (kPackageDir / "threads1.hwpx").wstring();
+    const std::wstring multi = (kPackageDir / "threads4.hwpx").wstring();
+    CHECK(BuildSample(single, 1, 40000));
+    CHECK(BuildSample(multi, 4, 40000));
+
+    // 항목 수정 시각(DOS 시각)만 만든 때에 따라 다를 수 있으므로 항목별로 비교
+    CHECK(fs::file_size(single) == fs::file_size(multi));
+    ZipReader a, b;
+    CHECK(a.Open(single));
+    CHECK(b.Open(multi));
+    CHECK(a.GetEntries().size() == b.GetEntries().size());
+    for (size_t i = 0; i < a.GetEntries().size() && i < b.GetEntries().size(); ++i) {
+        const ZipReader::Entry& ea = a.GetEntries()[i];
+        const ZipReader::Entry& eb = b.GetEntries()[i];
+        CHECK(ea.name == eb.name);
+        CHECK(ea.method == eb.method);
+        CHECK(ea.crc == eb.crc);
+        CHECK(ea.compressedSize == eb.compressedSize);
+        CHECK(ea.headerOffset == eb.headerOffset);
+    }
+    CHECK(ReadRawEntries(a) == ReadRawEntries(b));
+
+    int section = a.Find("Contents/section1.xml");
+    CHECK(section >= 0);
+    if (section >= 0) CHECK(a.GetEntries()[section].size > 1024 * 1024);
+}
+
+CPYHWPX_TEST(RewriteCopiesUnchangedEntriesRaw)
+{
+    fs::create_directories(kPackageDir);
+    const std::wstring source = (kPackageDir / "rewrite_src.hwpx").wstring();
+    const std::wstring dest = (kPackageDir / "rewrite_dst.hwpx").wstring();
+    CHECK(BuildSample(source, 0));
+
+    std::string section;
+    CHECK(HwpxWriter::ReadPart(source, "Contents/section0.xml", section));
+    std::string replaced = section;
+    replaced.replace(replaced.find("보고서"), std::string("보고서").size(), "결과서");
+    const std::map<std::string, std::string> parts = {
+        { "Contents/section0.xml", replaced },
+        { "Contents/extra.xml", "<extra/>" },
+    };
+    CHECK(HwpxWriter::RewritePackage(source, dest, parts, 6, 4));
+
+    ZipReader before, after;
+    CHECK(before.Open(source));
+    CHECK(after.Open(dest));
+    std::map<std::string, std::string> rawBefore = ReadRawEntries(before);
+    std::map<std::string, std::string> rawAfter = ReadRawEntries(after);
+
+    // 바꾸지 않은 항목은 CRC/압축 크기/압축된 바이트까지 그대로, 순서도 그대로
+    CHECK(after.GetEntries().size() == before.GetEntries().size() + 1);
+    for (size_t i = 0; i < before.GetEntries().size() && i < after.GetEntries().size(); ++i) {
+        const ZipReader::Entry& eb = before.GetEntries()[i];
+        const ZipReader::Entry& ea = after.GetEntries()[i];
+        CHECK(ea.name == eb.name);
+        if (eb.name == "Contents/section0.xml") continue;
+        CHECK(ea.method == eb.method);
+        CHECK(ea.crc == eb.crc);
+        CHECK(ea.compressedSize == eb.compressedSize);
+        CHECK(rawAfter[ea.name] == rawBefore[eb.name]);
+    }
+    CHECK(after.GetEntries().back().name == "Contents/extra.xml");
+
+    // 바꾼 항목은 ReadPart로 새 내용이 읽힘
+    std::string readBack;
+    CHECK(HwpxWriter::ReadPart(dest, "Contents/section0.xml", readBack));
+    CHECK(readBack == replaced);
+    CHECK(HwpxWriter::ReadPart(dest, "Contents/extra.xml", readBack));
+    CHECK(readBack == "<extra/>");
+
+    // 같은 파일에 다시 쓰기: 임시 파일 없이 바뀐 내용만 남음
+    CHECK(HwpxWriter::RewritePackage(dest, dest, { { "Contents/extra.xml", "<extra n=\"2\"/>" } }));
+    CHECK(!fs::exists(fs::path(dest + L".tmp")));
+    CHECK(HwpxWriter::ReadPart(dest, "Contents/extra.xml", readBack));
+    CHECK(readBack == "<extra n=\"2\"/>");
+    CHECK(HwpxWriter::ReadPart(dest, "Contents/section0.xml", readBack));
+    CHECK(readBack == replaced);
+
+    // 원본이 없으면 실패하고 dest는 그대로
+    uintmax_t size = fs::file_size(fs::path(dest));
+    CHECK(!HwpxWriter::RewritePackage((kPackageDir / "missing.hwpx").wstring(), dest, parts));
+    CHECK(fs::file_size(fs::path(dest)) == size);
+}
+
+CPYHWPX_TEST_MAIN()
@@ -0,0 +1,141 @@
+/**
+ * @file test_private_info_scanner.cpp
+ * @brief PrivateInfoScanner 테스트 (체크섬, Luhn, SIMD 블록 경계)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "TestHarness.h"
+#include "PrivateInfoScanner.h"
+
+using namespace cpyhwpx;
+
+namespace {
+
+// SIMD 블록 경계 앞뒤 길이 (SSE2 8글자, AVX2 16글자)
+const size_t kEdgeLengths[] = { 7, 8, 15, 16, 17, 31, 32, 33 };
+
+std::wstring Filler(size_t n)
+{
+    return std::wstring(n, L'가');
+}
+
+bool ScansAs(const std::wstring& text, int type, size_t offset, size_t length)
+{
+    std::vector<PrivateInfoMatch> matches = PrivateInfoScanner::Scan(text);
+    return matches.size() == 1 && matches[0].type == type &&
+           matches[0].offset == offset && matches[0].length == length;
+}
+
+} // namespace
+
+//=============================================================================
+// 체크섬
+//=============================================================================
+
+CPYHWPX_TEST(RrnChecksum)
+{
+    CHECK(PrivateInfoScanner::IsValidRRN(L"9001011234568"));
+    CHECK(PrivateInfoScanner::IsValidRRN(L"8503152345678"));
+    CHECK(!PrivateInfoScanner::IsValidRRN(L"9001011234567"));
+    CHECK(!PrivateInfoScanner::IsValidRRN(L"900101123456"));     // 12자리
+    CHECK(!PrivateInfoScanner::IsValidRRN(L"90010112345a8"));
+
+    CHECK(ScansAs(L"주민번호 900101-1234568 확인", PrivateInfoType::RRN, 5, 14));
+    CHECK(PrivateInfoScanner::Scan(L"주민번호 900101-1234567 확인").empty());
+    CHECK(PrivateInfoScanner::Scan(L"900101-1234567", PrivateInfoType::All, false).size() == 1);
+}
+
+CPYHWPX_TEST(ForeignRrnChecksum)
+{
+    CHECK(PrivateInfoScanner::IsValidForeignRRN(L"9001015123452"));
+    CHECK(PrivateInfoScanner::IsValidForeignRRN(L"0102036123451"));
+    CHECK(!PrivateInfoScanner::IsValidForeignRRN(L"9001015123453"));
+    CHECK(!PrivateInfoScanner::IsValidForeignRRN(L"900101512345"));
+
+    CHECK(ScansAs(L"900101-5123452", PrivateInfoType::ForeignRRN, 0, 14));
+    CHECK(PrivateInfoScanner::Scan(L"900101-5123453").empty());
+
+    // 외국인등록번호만 끄면 탐지하지 않음 (주민등록번호로 바꿔 잡지 않음)
+    CHECK(PrivateInfoScanner::Scan(L"900101-5123452", PrivateInfoType::RRN).empty());
+}
+
+CPYHWPX_TEST(LuhnCardNumbers)
+{
+    CHECK(PrivateInfoScanner::LuhnCheck(L"4111111111111111"));
+    CHECK(PrivateInfoScanner::LuhnCheck(L"5500000000000004"));
+    CHECK(PrivateInfoScanner::LuhnCheck(L"378282246310005"));
+    CHECK(!PrivateInfoScanner::LuhnCheck(L"4111111111111112"));
+    CHECK(!PrivateInfoScanner::LuhnCheck(L""));
+    CHECK(!PrivateInfoScanner::LuhnCheck(L"41111a1111111111"));
+
+    CHECK(ScansAs(L"카드 4111-1111-1111-1111", PrivateInfoType::CreditCard, 3, 19));
+    CHECK(ScansAs(L"4111 1111 1111 1111", PrivateInfoType::CreditCard, 0, 19));
+    CHECK(ScansAs(L"3782-822463-10005", PrivateInfoType::CreditCard, 0, 17));
+    CHECK(PrivateInfoScanner::Scan(L"4111-1111-1111-1112").empty());
+    CHECK(PrivateInfoScanner::Scan(L"4111.1111.1111.1111").empty());     // '.'은 카드 구분자 아님
+}
+
+//=============================================================================
+// SIMD 블록 경계
+//=============================================================================
+
+CPYHWPX_TEST(FindCandidateMatchesScalarAtEveryOffset)
+{
+    // 숫자/'@'/0x8000 이상 문자(부호 있는 비교)를 블록 경계 곳곳에 둔다
+    const wchar_t probes[] = { L'0', L'9', L'@', L'/', L':', L'\xFF10', L'\x8030', L'\xFFFF' };
+    for (size_t n : kEdgeLengths) {
+        for (wchar_t probe : probes) {
+            for (size_t at = 0; at < n; ++at) {
+                std::wstring text = Filler(n);
+                text[at] = probe;
+                for (size_t from = 0; from <= n; ++from) {
+                    CHECK(PrivateInfoScanner::FindCandidate(text.c_str(), n, from) ==
+                          PrivateInfoScanner::FindCandidateScalar(text.c_str(), n, from));
+                }
+            }
+        }
+    }
+}
+
+CPYHWPX_TEST(DigitRunStartingAtBlockEdge)
+{
+    const std::wstring phone = L"010-1234-5678";
+    for (size_t n : kEdgeLengths) {
+        CHECK(ScansAs(Filler(n) + phone, PrivateInfoType::Phone, n, phone.size()));
+        CHECK(ScansAs(Filler(n) + phone + Filler(n), PrivateInfoType::Phone, n, phone.size()));
+    }
+}
+
+CPYHWPX_TEST(DigitRunEndingAtBlockEdge)
+{
+    // 숫자열 끝이 블록 경계(= 텍스트 끝 포함)에 걸리는 경우
+    const std::wstring rrn = L"9001011234568";
+    for (size_t n : kEdgeLengths) {
+        if (n < rrn.size()) continue;
+        std::wstring text = Filler(n - rrn.size()) + rrn;
+        CHECK(ScansAs(text, PrivateInfoType::RRN, n - rrn.size(), rrn.size()));
+        CHECK(ScansAs(text + L"가", PrivateInfoType::RRN, n - rrn.size(), rrn.size()));
+    }
+}
+
+CPYHWPX_TEST(DigitRunOfEdgeLength)
+{
+    // 블록 길이 그대로인 숫자열: 개인정보 모양이 아니면 아무것도 잡지 않고,
+    // 뒤이은 번호는 경계와 무관하게 잡는다
+    for (size_t n : kEdgeLengths) {
+        std::wstring digits(n, L'7');
+        CHECK(PrivateInfoScanner::Scan(digits).empty());
+        CHECK(ScansAs(digits + L"가02-123-4567", PrivateInfoType::Phone, n + 1, 11));
+    }
+}
+
+CPYHWPX_TEST(EmailAcrossBlockEdge)
+{
+    for (size_t n : kEdgeLengths) {
+        std::wstring text = Filler(n) + L" user@example.com";
+        CHECK(ScansAs(text, PrivateInfoType::Email, n + 1, 16));
+    }
+}
+
+CPYHWPX_TEST_MAIN()
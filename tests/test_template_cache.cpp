@@ -0,0 +1,108 @@
+/**
+ * @file test_template_cache.cpp
+ * @brief TemplateCache / HwpWrapper::OpenTemplate 테스트 (서식 파일 변경 감지)
+ *
+ * pyhwpx → cpyhwpx 포팅 프로젝트
+ */
+
+#include "TestHarness.h"
+#include "FakeHwpObject.h"
+#include "HwpWrapper.h"
+#include "TemplateCache.h"
+#include <filesystem>
+#include <fstream>
+
+using namespace cpyhwpx;
+using namespace cpyhwpx::bench;
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * @brief 테스트마다 새로 만드는 임시 서식 파일
+ */
+struct TempTemplate {
+    fs::path path;
+
+    explicit TempTemplate(const char* name)
+        : path(fs::temp_directory_path() / (std::string("cpyhwpx_") + name))
+    {
+        Write("form");
+    }
+    ~TempTemplate() { fs::remove(path); }
+
+    void Write(const std::string& content) const
+    {
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << content;
+    }
+};
+
+BstrString Document(const std::wstring& text)
+{
+    return BstrString::FromUtf16(text.data(), text.size());
+}
+
+} // namespace
+
+CPYHWPX_TEST(FindMatchesOnlyTheSameStamp)
+{
+    TemplateCache cache;
+    FileInfo stamp;
+    stamp.size = 4;
+    stamp.mtime_ns = 1000;
+
+    BstrString data = Document(L"문서");
+    CHECK(cache.Insert(L"HWP|form.hwt", data, stamp));
+    CHECK(cache.Find(L"HWP|form.hwt", stamp) != nullptr);
+    CHECK(cache.GetHitCount() == 1);
+
+    FileInfo edited = stamp;
+    edited.mtime_ns = 2000;
+    CHECK(cache.Find(L"HWP|form.hwt", edited) == nullptr);
+    CHECK(cache.GetStaleCount() == 1);
+    CHECK(cache.GetMissCount() == 1);
+    CHECK(cache.GetCount() == 0);
+    CHECK(cache.GetBytes() == 0);
+}
+
+CPYHWPX_TEST(SizeChangeIsStale)
+{
+    TemplateCache cache;
+    FileInfo stamp;
+    stamp.size = 4;
+    stamp.mtime_ns = 1000;
+
+    BstrString data = Document(L"문서");
+    CHECK(cache.Insert(L"k", data, stamp));
+
+    FileInfo resized = stamp;
+    resized.size = 5;
+    CHECK(cache.Find(L"k", resized) == nullptr);
+    CHECK(cache.GetStaleCount() == 1);
+}
+
+CPYHWPX_TEST(OpenTemplateReopensAnEditedFile)
+{
+    TempTemplate form("template_cache.hwt");
+    std::wstring path = form.path.wstring();
+
+    HwpWrapper hwp(false, false, false);
+    FakeHwpObject* obj = new FakeHwpObject();
+    hwp.Attach(obj);
+    obj->Release();
+
+    CHECK(hwp.OpenTemplate(path));
+    CHECK(hwp.OpenTemplate(path));
+    CHECK(hwp.GetTemplateCache().GetHitCount() == 1);
+
+    form.Write("edited form");      // 크기가 바뀌므로 수정 시각 해상도와 무관
+    CHECK(hwp.OpenTemplate(path));
+    CHECK(hwp.GetTemplateCache().GetStaleCount() == 1);
+    CHECK(hwp.GetTemplateCache().GetHitCount() == 1);
+    CHECK(hwp.GetTemplateCache().GetCount() == 1);
+
+    CHECK(hwp.OpenTemplate(path));
+    CHECK(hwp.GetTemplateCache().GetHitCount() == 2);
+}
+
+CPYHWPX_TEST_MAIN()